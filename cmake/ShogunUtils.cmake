@@ -319,6 +319,9 @@ function(ADD_SHOGUN_BENCHMARK REL_BENCHMARK_NAME)
 		set_target_properties (${BENCHMARK_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY_DEBUG ${CMAKE_BINARY_DIR}/bin)
 		set_target_properties (${BENCHMARK_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY_RELEASE ${CMAKE_BINARY_DIR}/bin)
 		target_link_libraries(${BENCHMARK_NAME} ${SHOGUN_BENCHMARK_LINK_LIBS})
+		if(TARGET benchmarks)
+			add_dependencies(benchmarks ${BENCHMARK_NAME})
+		endif()
 		set(NO_COLOR "--color_print=false")
 	endif()
 
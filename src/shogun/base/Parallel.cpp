@@ -10,6 +10,7 @@
 #include <shogun/lib/config.h>
 #include <shogun/lib/memory.h>
 
+#include <algorithm>
 #include <thread>
 
 #if defined(LINUX)
@@ -88,3 +89,26 @@ int32_t Parallel::get_num_threads() const
 {
 	return num_threads;
 }
+
+int32_t Parallel::claim_threads(int32_t requested)
+{
+	if (requested<0 || requested>num_threads)
+		requested=num_threads;
+	if (requested<1)
+		requested=1;
+
+	int32_t claimed=num_claimed_threads.load();
+	int32_t granted;
+	do
+	{
+		granted=std::min(requested, std::max(1, num_threads-claimed));
+	} while (!num_claimed_threads.compare_exchange_weak(
+	    claimed, claimed+granted));
+
+	return granted;
+}
+
+void Parallel::release_threads(int32_t claimed)
+{
+	num_claimed_threads.fetch_sub(claimed);
+}
@@ -12,6 +12,8 @@
 
 #include <shogun/lib/common.h>
 
+#include <atomic>
+
 namespace shogun
 {
 /** @brief Class Parallel provides helper functions for multithreading.
@@ -47,6 +49,25 @@ public:
 	 */
 	int32_t get_num_threads() const;
 
+	/** Claims threads from the process-wide budget. The budget equals the
+	 * configured number of threads; a region is granted at most what is
+	 * currently left of it, but always at least one thread. Nested
+	 * parallel regions therefore degrade towards serial execution instead
+	 * of oversubscribing the machine. Each successful claim must be
+	 * returned via release_threads(); prefer the RAII ThreadBudget
+	 * wrapper.
+	 *
+	 * @param requested number of threads the region would like to use,
+	 * or -1 for the configured maximum
+	 * @return number of threads granted (>=1)
+	 */
+	int32_t claim_threads(int32_t requested=-1);
+
+	/** Returns previously claimed threads to the budget.
+	 * @param claimed value returned by the matching claim_threads() call
+	 */
+	void release_threads(int32_t claimed);
+
 	// FIXME: Should be dropped, but needed to be wrappable by some
 	int32_t ref() { return 1; }
 	int32_t ref_count() const { return 1; }
@@ -55,6 +76,51 @@ public:
 private:
 	/** number of threads */
 	int32_t num_threads;
+
+	/** threads currently claimed out of the budget */
+	std::atomic<int32_t> num_claimed_threads{0};
+};
+
+/** @brief RAII claim on the process-wide thread budget of Parallel.
+ *
+ * A parallel region asks for the number of threads it would like to run
+ * with and is granted at most what is left of the global budget, e.g.
+ * when cross-validation trains machines whose kernels parallelize
+ * internally, inner regions receive fewer threads (down to one) instead
+ * of multiplying the configured thread count at every nesting level. The
+ * claim is returned when the object goes out of scope, so it must stay
+ * alive until the region's threads have joined.
+ */
+class ThreadBudget
+{
+public:
+	/** Claims threads for the lifetime of this object.
+	 * @param parallel thread budget owner, usually env()
+	 * @param requested desired number of threads, or -1 for the
+	 * configured maximum
+	 */
+	explicit ThreadBudget(Parallel* parallel, int32_t requested=-1)
+	    : m_parallel(parallel), m_granted(parallel->claim_threads(requested))
+	{
+	}
+
+	ThreadBudget(const ThreadBudget&) = delete;
+	ThreadBudget& operator=(const ThreadBudget&) = delete;
+
+	~ThreadBudget()
+	{
+		m_parallel->release_threads(m_granted);
+	}
+
+	/** @return number of threads granted to this region (>=1) */
+	int32_t get_num_threads() const
+	{
+		return m_granted;
+	}
+
+private:
+	Parallel* m_parallel;
+	int32_t m_granted;
 };
 }
 #endif
@@ -336,6 +336,21 @@ std::shared_ptr<SGObject> SGObject::clone(ParameterProperties pp) const
 			continue;
 		}
 
+		if (it.second.get_properties().has_property(
+		        ParameterProperties::READONLY))
+		{
+			// READONLY parameters (e.g. the feature matrices a kernel
+			// holds) are immutable from the outside, so the clone can
+			// share the underlying storage instead of deep-copying it.
+			// This makes cloning machines for cross-validation and
+			// bagging a metadata-only operation.
+			SG_DEBUG(
+			    "Sharing read-only parameter {}::{} of type {}.",
+			    this->get_name(), tag.name().c_str(), own.type().c_str());
+			clone->get_parameter(tag).get_value() = own;
+			continue;
+		}
+
 		SG_DEBUG(
 			"Cloning parameter {}::{} of type {}.", this->get_name(),
 			tag.name().c_str(), own.type().c_str());
@@ -117,6 +117,9 @@ SG_FORCED_INLINE const char* convert_string_to_char(const char* name)
  * End of macros for registering parameter properties
  ******************************************************************************/
 
+template <typename T>
+class ParameterHandle;
+
 /** @brief Class SGObject is the base class of all shogun objects.
  *
  * Apart from dealing with reference counting that is used to manage shogung
@@ -142,7 +145,10 @@ class SGObject: public std::enable_shared_from_this<SGObject>
 	{
 		const ValueType& m_value;
 	};
-	
+
+	template <typename T>
+	friend class ParameterHandle;
+
 public:
 	/** Definition of observed subject */
 	typedef rxcpp::subjects::subject<std::shared_ptr<ObservedValue>> SGSubject;
@@ -562,6 +568,20 @@ public:
 		}
 		return result;
 	}
+
+	/** Resolves a registered parameter into a typed handle. The name is
+	 * hashed and the type checked only once; afterwards reads, writes and
+	 * observe() calls through the handle bypass the parameter map
+	 * entirely. Meant for code that touches a parameter inside training
+	 * loops, where per-access lookups are measurable.
+	 * Throws an exception if the class does not have such a parameter or
+	 * if the type does not match.
+	 *
+	 * @param name name of the parameter
+	 * @return typed handle bound to the parameter
+	 */
+	template <typename T>
+	ParameterHandle<T> get_parameter_handle(std::string_view name);
 #endif
 
 	/** Getter for a class parameter, identified by a name.
@@ -1280,6 +1300,11 @@ protected:
 	template <class T>
 	void observe(const int64_t step, std::string_view name) const
 	{
+		// Resolving and cloning the parameter is pointless when nobody
+		// listens; bail out before paying for either.
+		if (get_num_subscriptions() == 0)
+			return;
+
 		const auto tag = Tag<T>(name);
 		auto& param = this->get_parameter(tag);
 		auto pprop = param.get_properties();
@@ -1343,6 +1368,76 @@ protected:
 		int64_t m_next_subscription_index;
 	};
 
+#ifndef SWIG
+/** @brief Typed, pre-resolved view on a registered parameter of an
+ * SGObject.
+ *
+ * Accessing a parameter through SGObject::get()/put() hashes the name and
+ * boxes the value in an Any on every call, which is wasteful when done
+ * inside training loops. A handle performs the lookup and the type check
+ * once at resolution; afterwards reads and writes go straight to the
+ * watched variable, and observe() only pays for cloning the value when an
+ * observer is actually subscribed.
+ *
+ * The handle borrows the storage of the watched parameter, so it must not
+ * outlive the object it was resolved from.
+ */
+template <typename T>
+class ParameterHandle
+{
+	friend class SGObject;
+
+public:
+	/** @return current value of the parameter */
+	const T& get() const
+	{
+		return *m_value;
+	}
+
+	/** Writes the parameter without re-resolving it.
+	 * @param value new value
+	 */
+	void set(const T& value)
+	{
+		*m_value = value;
+	}
+
+	/** Emits the current value to subscribed observers. Without
+	 * subscribers this is a cheap no-op.
+	 * @param step time step (e.g. the current training iteration)
+	 */
+	void observe(const int64_t step) const
+	{
+		if (m_owner->get_num_subscriptions() == 0)
+			return;
+		m_owner->observe(step, m_name, *m_value, m_properties);
+	}
+
+private:
+	ParameterHandle(
+	    SGObject* owner, std::string_view name, T* value,
+	    const AnyParameterProperties& properties)
+	    : m_owner(owner), m_name(name), m_value(value),
+	      m_properties(properties)
+	{
+	}
+
+	SGObject* m_owner;
+	std::string m_name;
+	T* m_value;
+	AnyParameterProperties m_properties;
+};
+
+template <typename T>
+ParameterHandle<T> SGObject::get_parameter_handle(std::string_view name)
+{
+	auto& param = get_parameter(BaseTag(name));
+	return ParameterHandle<T>(
+	    this, name, param.get_value().template pointer<T>(),
+	    param.get_properties());
+}
+#endif
+
 template <class T>
 std::shared_ptr<T> make_clone(std::shared_ptr<T> orig, ParameterProperties pp = ParameterProperties::ALL)
 {
@@ -0,0 +1,229 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <shogun/classifier/svm/LibLinear.h>
+#include <shogun/classifier/svm/LibSVM.h>
+#include <shogun/clustering/KMeans.h>
+#include <shogun/distance/EuclideanDistance.h>
+#include <shogun/ensemble/MajorityVote.h>
+#include <shogun/features/DataGenerator.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/machine/RandomForest.h>
+#include <shogun/machine/gp/ExactInferenceMethod.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/machine/gp/ZeroMean.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+#include <shogun/regression/GaussianProcessRegression.h>
+
+#include <random>
+
+namespace shogun
+{
+
+/* End-to-end workloads over the training hot paths. Unlike the per-class
+ * micro benchmarks scattered through the tree, each benchmark here runs a
+ * whole train (or train+apply) cycle on synthetic data, so regressions
+ * anywhere along a path show up in one number. For regression tracking run
+ * the executables with --benchmark_out_format=json --benchmark_out=<file>.
+ *
+ * All generators are seeded so successive runs measure the same problem.
+ */
+static constexpr int32_t BENCHMARK_SEED = 17;
+
+/* m points per class around n Gaussian blobs, one blob per class */
+static std::pair<
+    std::shared_ptr<DenseFeatures<float64_t>>, SGVector<float64_t>>
+make_blob_problem(index_t m, index_t num_classes, index_t dim)
+{
+	std::mt19937_64 prng(BENCHMARK_SEED);
+	SGMatrix<float64_t> data =
+	    DataGenerator::generate_gaussians(m, num_classes, dim, prng);
+	SGVector<float64_t> labels(m * num_classes);
+	for (index_t i = 0; i < labels.vlen; i++)
+		labels[i] = i / m;
+	return {std::make_shared<DenseFeatures<float64_t>>(data), labels};
+}
+
+/* text-like sparse problem: num_feat dimensions, nnz hot ones per vector */
+static std::shared_ptr<SparseFeatures<float64_t>>
+make_sparse_problem(index_t num_vec, index_t num_feat, index_t nnz)
+{
+	std::mt19937_64 prng(BENCHMARK_SEED);
+	UniformIntDistribution<index_t> uniform_index(0, num_feat - 1);
+	UniformRealDistribution<float64_t> uniform_real(0.0, 1.0);
+
+	SGSparseMatrix<float64_t> mat(num_feat, num_vec);
+	for (index_t i = 0; i < num_vec; i++)
+	{
+		mat.sparse_matrix[i] = SGSparseVector<float64_t>(nnz);
+		for (index_t j = 0; j < nnz; j++)
+		{
+			mat.sparse_matrix[i].features[j].feat_index =
+			    uniform_index(prng);
+			mat.sparse_matrix[i].features[j].entry = uniform_real(prng);
+		}
+	}
+	return std::make_shared<SparseFeatures<float64_t>>(mat);
+}
+
+static void BM_RBFSVM_Train(benchmark::State& state)
+{
+	auto [feats, raw_labels] =
+	    make_blob_problem(state.range(0), 2, state.range(1));
+	for (index_t i = 0; i < raw_labels.vlen; i++)
+		raw_labels[i] = raw_labels[i] > 0 ? 1 : -1;
+	auto labels = std::make_shared<BinaryLabels>(raw_labels);
+
+	for (auto _ : state)
+	{
+		auto kernel =
+		    std::make_shared<GaussianKernel>(10, 2.0 * state.range(1));
+		auto svm = std::make_shared<LibSVM>(1.0, kernel, labels);
+		svm->train(feats);
+	}
+}
+
+static void BM_RBFSVM_Apply(benchmark::State& state)
+{
+	auto [feats, raw_labels] =
+	    make_blob_problem(state.range(0), 2, state.range(1));
+	for (index_t i = 0; i < raw_labels.vlen; i++)
+		raw_labels[i] = raw_labels[i] > 0 ? 1 : -1;
+	auto labels = std::make_shared<BinaryLabels>(raw_labels);
+
+	auto kernel = std::make_shared<GaussianKernel>(10, 2.0 * state.range(1));
+	auto svm = std::make_shared<LibSVM>(1.0, kernel, labels);
+	svm->train(feats);
+
+	for (auto _ : state)
+	{
+		auto predictions = svm->apply(feats);
+		benchmark::DoNotOptimize(predictions);
+	}
+}
+
+static void BM_LibLinear_TrainSparse(benchmark::State& state)
+{
+	auto feats =
+	    make_sparse_problem(state.range(0), state.range(1), state.range(2));
+
+	std::mt19937_64 prng(BENCHMARK_SEED);
+	UniformIntDistribution<int32_t> uniform_label(0, 1);
+	SGVector<float64_t> raw_labels(state.range(0));
+	for (index_t i = 0; i < raw_labels.vlen; i++)
+		raw_labels[i] = uniform_label(prng) ? 1 : -1;
+	auto labels = std::make_shared<BinaryLabels>(raw_labels);
+
+	for (auto _ : state)
+	{
+		auto ll = std::make_shared<LibLinear>();
+		ll->set_features(feats);
+		ll->set_labels(labels);
+		ll->set_liblinear_solver_type(L2R_L2LOSS_SVC);
+		ll->train();
+	}
+}
+
+static void BM_RandomForest_Train(benchmark::State& state)
+{
+	const index_t dim = state.range(1);
+	auto [feats, raw_labels] = make_blob_problem(state.range(0), 3, dim);
+	auto labels = std::make_shared<MulticlassLabels>(raw_labels);
+	SGVector<bool> feature_types(dim);
+	feature_types.set_const(false);
+
+	for (auto _ : state)
+	{
+		auto forest = std::make_shared<RandomForest>(
+		    feats, labels, state.range(2), dim / 2);
+		forest->set_feature_types(feature_types);
+		forest->set_combination_rule(std::make_shared<MajorityVote>());
+		forest->train(feats);
+	}
+}
+
+static void BM_KMeans_Train(benchmark::State& state)
+{
+	auto feats =
+	    make_blob_problem(state.range(0), state.range(2), state.range(1))
+	        .first;
+
+	for (auto _ : state)
+	{
+		auto distance = std::make_shared<EuclideanDistance>(feats, feats);
+		auto clustering =
+		    std::make_shared<KMeans>(state.range(2), distance);
+		clustering->train(feats);
+	}
+}
+
+static void BM_GPRegression_Train(benchmark::State& state)
+{
+	const index_t n = state.range(0);
+	std::mt19937_64 prng(BENCHMARK_SEED);
+	UniformRealDistribution<float64_t> uniform_real(0.0, 1.0);
+
+	SGMatrix<float64_t> X(1, n);
+	SGVector<float64_t> Y(n);
+	for (index_t i = 0; i < n; i++)
+	{
+		X(0, i) = 6.0 * i / n;
+		Y[i] = std::sin(X(0, i)) + 0.1 * uniform_real(prng);
+	}
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(X);
+	auto labels = std::make_shared<RegressionLabels>(Y);
+
+	for (auto _ : state)
+	{
+		auto kernel = std::make_shared<GaussianKernel>(10, 2.0);
+		auto lik = std::make_shared<GaussianLikelihood>();
+		lik->set_sigma(0.1);
+		auto inf = std::make_shared<ExactInferenceMethod>(
+		    kernel, feats, std::make_shared<ZeroMean>(), labels, lik);
+		auto gpr = std::make_shared<GaussianProcessRegression>(inf);
+		gpr->train();
+	}
+}
+
+/* {points per class, dim} */
+BENCHMARK(BM_RBFSVM_Train)
+    ->Args({100, 10})
+    ->Args({500, 10})
+    ->Args({500, 100})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RBFSVM_Apply)
+    ->Args({100, 10})
+    ->Args({500, 10})
+    ->Args({500, 100})
+    ->Unit(benchmark::kMillisecond);
+/* {num vectors, num features, nnz per vector} */
+BENCHMARK(BM_LibLinear_TrainSparse)
+    ->Args({1000, 10000, 50})
+    ->Args({10000, 100000, 100})
+    ->Unit(benchmark::kMillisecond);
+/* {points per class, dim, num bags} */
+BENCHMARK(BM_RandomForest_Train)
+    ->Args({100, 10, 10})
+    ->Args({500, 10, 50})
+    ->Unit(benchmark::kMillisecond);
+/* {points per cluster, dim, k} */
+BENCHMARK(BM_KMeans_Train)
+    ->Args({500, 10, 4})
+    ->Args({2000, 50, 8})
+    ->Unit(benchmark::kMillisecond);
+/* {num training points} */
+BENCHMARK(BM_GPRegression_Train)
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
+
+}
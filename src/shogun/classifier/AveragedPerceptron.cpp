@@ -6,11 +6,9 @@
  */
 
 #include <shogun/classifier/AveragedPerceptron.h>
-#include <shogun/features/iterators/DotIterator.h>
 #include <shogun/labels/Labels.h>
 #include <shogun/lib/observers/ObservedValueTemplated.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
-#include <shogun/util/zip_iterator.h>
 
 using namespace shogun;
 
@@ -28,6 +26,8 @@ void AveragedPerceptron::init()
 	set_max_iter(1000);
 	set_learn_rate(0.1);
 	cached_bias = 0.0;
+	sum_dev_bias = 0.0;
+	m_batch_size = 1;
 
 	SG_ADD(
 	    &learn_rate, kLearnRate, "Learning rate.", ParameterProperties::HYPER)
@@ -38,6 +38,24 @@ void AveragedPerceptron::init()
 	    &cached_bias, "cached_bias",
 	    "Cached bias that contribute to the average.",
 	    ParameterProperties::MODEL)
+	SG_ADD(
+	    &sum_dev_w, "sum_dev_w",
+	    "Accumulated deviation of the weights from the average.",
+	    ParameterProperties::MODEL)
+	SG_ADD(
+	    &sum_dev_bias, "sum_dev_bias",
+	    "Accumulated deviation of the bias from the average.",
+	    ParameterProperties::MODEL)
+	SG_ADD(
+	    &m_batch_size, "batch_size", "Number of examples per mini-batch.",
+	    ParameterProperties::SETTING)
+}
+
+void AveragedPerceptron::set_batch_size(int32_t batch_size)
+{
+	require(
+	    batch_size >= 1, "Batch size ({}) must be at least 1", batch_size);
+	m_batch_size = batch_size;
 }
 
 void AveragedPerceptron::init_model(std::shared_ptr<Features> data)
@@ -64,6 +82,10 @@ void AveragedPerceptron::init_model(std::shared_ptr<Features> data)
 	cached_w.set_const(1.0 / num_feat);
 	w.set_const(0);
 	set_w(w);
+
+	sum_dev_w = SGVector<float64_t>(num_feat);
+	sum_dev_w.set_const(0);
+	sum_dev_bias = 0;
 }
 
 void AveragedPerceptron::iteration()
@@ -74,28 +96,49 @@ void AveragedPerceptron::iteration()
 	auto labels = binary_labels(m_labels)->get_int_labels();
 
 	int32_t num_vec = features->get_num_vectors();
-	// this assumes that m_current_iteration starts at 0
-	int32_t num_prev_weights = num_vec * m_current_iteration + 1;
+	int32_t dim = w.vlen;
+	// global position in the example stream; this assumes that
+	// m_current_iteration starts at 0
+	int64_t step = (int64_t)num_vec * m_current_iteration;
+
+	SGVector<float64_t> outputs(m_batch_size);
 
-	for (const auto& [feature, true_label] : zip_iterator(DotIterator(features), labels))
+	for (int32_t start = 0; start < num_vec; start += m_batch_size)
 	{
-		auto predicted_label = feature.dot(cached_w) + cached_bias;
+		int32_t stop = Math::min(start + m_batch_size, num_vec);
 
-		if (Math::sign<float64_t>(predicted_label) != true_label)
+		if (m_batch_size == 1)
+			outputs[0] = features->dot(start, cached_w) + cached_bias;
+		else
+			features->dense_dot_range(
+			    outputs.vector, start, stop, NULL, cached_w.vector, dim,
+			    cached_bias);
+
+		for (int32_t i = start; i < stop; i++)
 		{
-			converged = false;
-			const auto gradient = learn_rate * true_label;
-			cached_bias += gradient;
-			feature.add(gradient, cached_w);
+			step++;
+
+			if (Math::sign<float64_t>(outputs[i - start]) != labels[i])
+			{
+				converged = false;
+				const auto gradient = learn_rate * labels[i];
+				cached_bias += gradient;
+				sum_dev_bias += (step - 1) * gradient;
+				features->add_to_dense_vec(gradient, i, cached_w.vector, dim);
+				features->add_to_dense_vec(
+				    (step - 1) * gradient, i, sum_dev_w.vector, dim);
+			}
 		}
-		linalg::update_mean(w, cached_w, num_prev_weights);
-		linalg::update_mean(bias, cached_bias, num_prev_weights);
+	}
 
-		observe<SGVector<float64_t>>(m_current_iteration, "w");
-		observe<float64_t>(m_current_iteration, "bias");
+	// materialize the average lazily: the running mean over all weight
+	// snapshots equals the current weights minus the accumulated
+	// deviations, so only mistakes cost more than the dot product
+	linalg::add(cached_w, sum_dev_w, w, 1.0, -1.0 / step);
+	bias = cached_bias - sum_dev_bias / step;
 
-		num_prev_weights++;
-	}
+	observe<SGVector<float64_t>>(m_current_iteration, "w");
+	observe<float64_t>(m_current_iteration, "bias");
 
 	m_complete = converged;
 }
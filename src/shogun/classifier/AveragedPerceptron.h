@@ -59,6 +59,23 @@ namespace shogun
 			m_max_iterations = i;
 		}
 
+		/** Set how many examples are classified per dense_dot_range call
+		 * before their updates are applied. Predictions within a mini-batch
+		 * are made against the weights at batch start, so values above 1
+		 * trade exactly sequential updates for vectorized, parallel dot
+		 * computations. The default of 1 keeps the original per-example
+		 * behavior.
+		 *
+		 * @param batch_size number of examples per mini-batch
+		 */
+		void set_batch_size(int32_t batch_size);
+
+		/** @return number of examples per mini-batch */
+		int32_t get_batch_size() const
+		{
+			return m_batch_size;
+		}
+
 		/** @return object name */
 		const char* get_name() const override
 		{
@@ -80,6 +97,15 @@ namespace shogun
 		float64_t cached_bias;
 		SGVector<float64_t> cached_w;
 
+		/** accumulators of the lazy-averaging trick: only mistakes touch
+		 * them, and the average is materialized once per iteration as
+		 * cached_w - sum_dev_w/num_steps */
+		float64_t sum_dev_bias;
+		SGVector<float64_t> sum_dev_w;
+
+		/** number of examples per mini-batch (1: update per example) */
+		int32_t m_batch_size;
+
 #ifndef SWIG
 	public:
 		static constexpr std::string_view kLearnRate = "learn_rate";
@@ -125,9 +125,14 @@ std::shared_ptr<BinaryLabels> GaussianProcessClassification::apply_binary(
 			data=m_method->get_features();
 	}
 
-	auto result=std::make_shared<BinaryLabels>(get_mean_vector(data));
+	// compute the posterior means and variances of the whole test matrix in
+	// one pass and evaluate both predictive quantities from them
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
+
+	auto result=std::make_shared<BinaryLabels>(lik->get_predictive_means(mu, s2));
 	if (m_compute_variance)
-		result->put("current_values", get_variance_vector(data));
+		result->put("current_values", lik->get_predictive_variances(mu, s2));
 
 
 	return result;
@@ -166,6 +171,9 @@ bool GaussianProcessClassification::train_machine(std::shared_ptr<Features> data
 	// perform inference
 	m_method->update();
 
+	// cache the posterior quantities needed for prediction
+	compile_posterior();
+
 	return true;
 }
 
@@ -179,8 +187,8 @@ SGVector<float64_t> GaussianProcessClassification::get_mean_vector(
 	require(m_method->supports_binary() || m_method->supports_multiclass(),
 		"{} with {} doesn't support classification", m_method->get_name(), lik->get_name());
 
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 
 
 	// evaluate mean
@@ -200,8 +208,8 @@ SGVector<float64_t> GaussianProcessClassification::get_variance_vector(
 	require(m_method->supports_binary() || m_method->supports_multiclass(),
 		"{} with {} doesn't support classification", m_method->get_name(), lik->get_name());
 
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 
 
 	// evaluate variance
@@ -221,8 +229,8 @@ SGVector<float64_t> GaussianProcessClassification::get_probabilities(
 	require(m_method->supports_binary() || m_method->supports_multiclass(),
 		"{} with {} doesn't support classification", m_method->get_name(), lik->get_name());
 
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 	// evaluate log probabilities
 	SGVector<float64_t> p=lik->get_predictive_log_probabilities(mu, s2);
 
@@ -9,6 +9,7 @@
 #include <shogun/features/Features.h>
 #include <shogun/features/FeatureTypes.h>
 #include <shogun/features/iterators/DotIterator.h>
+#include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/util/zip_iterator.h>
 
@@ -40,6 +41,63 @@ namespace shogun{
 	}
 
 
+	std::shared_ptr<MulticlassLabels> NearestCentroid::apply_multiclass(std::shared_ptr<Features> data)
+	{
+		if (data)
+		{
+			/* set distance features to given ones and apply to all */
+			distance->init(distance->get_lhs(), data);
+		}
+
+		int32_t num_centroids=distance->get_num_vec_lhs();
+		int32_t num_queries=distance->get_num_vec_rhs();
+		auto result=std::make_shared<MulticlassLabels>(num_queries);
+
+		if (!distance->has_block_computation())
+		{
+			for (index_t i=0; i<num_queries; ++i)
+				result->set_label(i, apply_one(i));
+			return result;
+		}
+
+		// score whole query blocks against all centroids at once; for the
+		// euclidean distance each block is one matrix product plus norm
+		// corrections instead of per-vector virtual distance calls
+		const int32_t block_size=256;
+		int32_t num_blocks=(num_queries+block_size-1)/block_size;
+
+		#pragma omp parallel
+		{
+			SGVector<float64_t> buffer(int64_t(num_centroids)*block_size);
+
+			#pragma omp for schedule(dynamic)
+			for (int32_t b=0; b<num_blocks; b++)
+			{
+				int32_t col_start=b*block_size;
+				int32_t cols=Math::min(block_size, num_queries-col_start);
+
+				distance->compute_block(
+					0, num_centroids, col_start, cols, buffer.vector,
+					num_centroids);
+
+				for (int32_t j=0; j<cols; j++)
+				{
+					const float64_t* dists=
+						buffer.vector+int64_t(j)*num_centroids;
+					index_t best_index=0;
+					for (int32_t i=1; i<num_centroids; i++)
+					{
+						if (dists[i]<dists[best_index])
+							best_index=i;
+					}
+					result->set_label(col_start+j, best_index);
+				}
+			}
+		}
+
+		return result;
+	}
+
 	bool NearestCentroid::train_machine(std::shared_ptr<Features> data)
 	{
 		ASSERT(m_labels)
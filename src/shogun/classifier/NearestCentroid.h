@@ -81,6 +81,16 @@ public:
 	 */
 	const char* get_name() const override { return "NearestCentroid"; }
 
+	/** classify objects. When the distance supports blockwise computation
+	 * (e.g. EuclideanDistance on dense features), whole query blocks are
+	 * scored against all centroids at once instead of one virtual distance
+	 * call per centroid and query.
+	 *
+	 * @param data (test) data to be classified
+	 * @return classified labels
+	 */
+	std::shared_ptr<MulticlassLabels> apply_multiclass(std::shared_ptr<Features> data=NULL) override;
+
 protected:
 	/** train Nearest Centroid classifier
 	 *
@@ -62,6 +62,12 @@ void Perceptron::iteration()
 	bool converged = true;
 	SGVector<float64_t> w = get_w();
 
+	// resolve the observed parameters once per epoch; emitting through
+	// the handles inside the update loop skips the name hashing and
+	// parameter map lookup of observe<T>(step, name)
+	auto w_observable = get_parameter_handle<SGVector<float64_t>>("w");
+	auto bias_observable = get_parameter_handle<float64_t>("bias");
+
 	auto labels = binary_labels(m_labels)->get_int_labels();
 
 	for (const auto& [v, true_label] : zip_iterator(DotIterator(features), labels))
@@ -75,8 +81,8 @@ void Perceptron::iteration()
 			bias += gradient;
 			v.add(gradient, w);
 
-			observe<SGVector<float64_t>>(m_current_iteration, "w");
-			observe<float64_t>(m_current_iteration, "bias");
+			w_observable.observe(m_current_iteration);
+			bias_observable.observe(m_current_iteration);
 		}
 	}
 	m_complete = converged;
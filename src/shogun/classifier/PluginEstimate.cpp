@@ -13,6 +13,7 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/lib/common.h>
+#include <shogun/mathematics/Math.h>
 
 using namespace shogun;
 
@@ -101,14 +102,77 @@ std::shared_ptr<BinaryLabels> PluginEstimate::apply_binary(std::shared_ptr<Featu
 	}
 
 	ASSERT(features)
-	SGVector<float64_t> result(features->get_num_vectors());
-
-	for (int32_t vec = 0; vec < features->get_num_vectors(); vec++)
-		result[vec] = apply_one(vec);
+	SGVector<float64_t> result=
+		apply_log_odds_batch(0, features->get_num_vectors());
 
 	return std::make_shared<BinaryLabels>(result);
 }
 
+SGVector<float64_t> PluginEstimate::apply_log_odds_batch(
+	int32_t start, int32_t stop)
+{
+	ASSERT(features)
+	require(start>=0 && start<=stop && stop<=features->get_num_vectors(),
+		"Invalid range [{}, {}) for {} vectors", start, stop,
+		features->get_num_vectors());
+
+	if ((!pos_model) || (!neg_model))
+		error("model(s) not assigned");
+
+	int32_t num_vectors=stop-start;
+	SGVector<float64_t> outputs(num_vectors);
+
+	const int32_t chunk_size=256;
+	int32_t num_chunks=(num_vectors+chunk_size-1)/chunk_size;
+#pragma omp parallel for schedule(dynamic)
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		int32_t chunk_start=start+c*chunk_size;
+		int32_t chunk_end=Math::min(chunk_start+chunk_size, stop);
+		int32_t chunk_num=chunk_end-chunk_start;
+
+		uint16_t* vectors[chunk_size];
+		int32_t lens[chunk_size];
+		bool free_vecs[chunk_size];
+
+		bool equal_length=true;
+		for (int32_t i=0; i<chunk_num; i++)
+		{
+			vectors[i]=features->get_feature_vector(
+				chunk_start+i, lens[i], free_vecs[i]);
+			equal_length&=(lens[i]==lens[0]);
+		}
+
+		float64_t* out=outputs.vector+(chunk_start-start);
+		if (equal_length)
+		{
+			float64_t neg_scores[chunk_size];
+			pos_model->get_log_likelihood_batch(
+				vectors, chunk_num, lens[0], out);
+			neg_model->get_log_likelihood_batch(
+				vectors, chunk_num, lens[0], neg_scores);
+
+			for (int32_t i=0; i<chunk_num; i++)
+				out[i]-=neg_scores[i];
+		}
+		else
+		{
+			for (int32_t i=0; i<chunk_num; i++)
+			{
+				out[i]=
+					pos_model->get_log_likelihood_example(vectors[i], lens[i])-
+					neg_model->get_log_likelihood_example(vectors[i], lens[i]);
+			}
+		}
+
+		for (int32_t i=0; i<chunk_num; i++)
+			features->free_feature_vector(
+				vectors[i], chunk_start+i, free_vecs[i]);
+	}
+
+	return outputs;
+}
+
 float64_t PluginEstimate::apply_one(int32_t vec_idx)
 {
 	ASSERT(features)
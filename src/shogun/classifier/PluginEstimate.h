@@ -71,6 +71,26 @@ class PluginEstimate: public Machine
 		/// classify the test feature vector indexed by vec_idx
 		float64_t apply_one(int32_t vec_idx) override;
 
+		/** posterior log odds for a block of feature vectors
+		 *
+		 * The block is scored in chunks across the available threads;
+		 * chunks whose sequences share a common length are evaluated
+		 * via LinearHMM::get_log_likelihood_batch(), which streams the
+		 * log-probability tables position-major over the whole chunk
+		 * instead of walking them once per sequence.
+		 *
+		 * @param start index of first vector to score
+		 * @param stop index of first vector not to score
+		 * @return log odds per vector in [start, stop)
+		 */
+		SGVector<float64_t> apply_log_odds_batch(int32_t start, int32_t stop);
+
+		/** apply_one() only reads the two linear HMMs, so examples can be
+		 * classified concurrently
+		 * @return true
+		 */
+		bool supports_parallel_apply() const override { return true; }
+
 		/** obsolete posterior log odds
 		 *
 		 * @param vector vector
@@ -54,8 +54,12 @@ void LibLinear::init()
 	set_C(1, 1);
 	set_max_iterations();
 	set_epsilon(1e-5);
+	m_warm_start = false;
 
 	SG_ADD(&C1, "C1", "C Cost constant 1.", ParameterProperties::HYPER);
+	SG_ADD(&m_warm_start, "warm_start",
+	    "Warm-start train calls from the previous solution.",
+	    ParameterProperties::SETTING);
 	SG_ADD(&C2, "C2", "C Cost constant 2.", ParameterProperties::HYPER);
 	SG_ADD(&use_bias, "use_bias", "Indicates if bias is used.", ParameterProperties::SETTING);
 	SG_ADD(&epsilon, "epsilon", "Convergence precision.", ParameterProperties::HYPER);
@@ -73,6 +77,47 @@ LibLinear::~LibLinear()
 {
 }
 
+void LibLinear::set_warm_start_enabled(bool enable)
+{
+	m_warm_start = enable;
+	if (!enable)
+		m_warm_alpha = SGVector<float64_t>();
+}
+
+SGMatrix<float64_t> LibLinear::train_path(
+    const SGVector<float64_t>& Cs, std::shared_ptr<Features> data)
+{
+	require(Cs.vlen > 0, "Need at least one C value");
+
+	bool was_enabled = get_warm_start_enabled();
+	set_warm_start_enabled(false); // drop any stale state
+	set_warm_start_enabled(true);
+
+	SGMatrix<float64_t> path;
+	for (index_t c = 0; c < Cs.vlen; c++)
+	{
+		require(
+		    Cs[c] > 0, "C values must be positive, got {} at position {}",
+		    Cs[c], c);
+		set_C(Cs[c], Cs[c]);
+		train(c == 0 ? data : NULL);
+
+		SGVector<float64_t> cur = get_w();
+		int32_t num_rows = cur.vlen + (get_bias_enabled() ? 1 : 0);
+		if (!path.matrix)
+			path = SGMatrix<float64_t>(num_rows, Cs.vlen);
+
+		sg_memcpy(
+		    path.get_column_vector(c), cur.vector,
+		    cur.vlen * sizeof(float64_t));
+		if (get_bias_enabled())
+			path(num_rows - 1, c) = get_bias();
+	}
+
+	set_warm_start_enabled(was_enabled);
+	return path;
+}
+
 bool LibLinear::train_machine(std::shared_ptr<Features> data)
 {
 
@@ -307,12 +352,16 @@ void LibLinear::solve_l2r_l1l2_svc(
 	if (prob->use_bias)
 		n--;
 
+	// warm start: seed the alphas from the previous solution, clipped to
+	// the (possibly changed) box, and rebuild w accordingly; the solver
+	// then only needs to adjust the few coordinates that actually moved
+	bool warm = m_warm_start && m_warm_alpha.vlen == l;
+
 	for (i = 0; i < w_size; i++)
 		w[i] = 0;
 
 	for (i = 0; i < l; i++)
 	{
-		alpha[i] = 0;
 		if (prob->y[i] > 0)
 		{
 			y[i] = +1;
@@ -321,10 +370,19 @@ void LibLinear::solve_l2r_l1l2_svc(
 		{
 			y[i] = -1;
 		}
+		alpha[i] =
+		    warm ? Math::min(m_warm_alpha[i], upper_bound[GETI(i)]) : 0;
 		QD[i] = diag[GETI(i)];
 
 		QD[i] += prob->x->dot(i, prob->x, i);
 		index[i] = i;
+
+		if (warm && alpha[i] > 0)
+		{
+			prob->x->add_to_dense_vec(alpha[i] * y[i], i, w.vector, n);
+			if (prob->use_bias)
+				w.vector[n] += alpha[i] * y[i];
+		}
 	}
 
 	auto pb = SG_PROGRESS(range(10));
@@ -452,6 +510,12 @@ void LibLinear::solve_l2r_l1l2_svc(
 	io::info("Objective value = {}", v / 2);
 	io::info("nSV = {}", nSV);
 
+	if (m_warm_start)
+	{
+		m_warm_alpha = SGVector<float64_t>(l);
+		sg_memcpy(m_warm_alpha.vector, alpha, l * sizeof(double));
+	}
+
 	SG_FREE(QD);
 	SG_FREE(alpha);
 	SG_FREE(y);
@@ -1240,10 +1304,16 @@ void LibLinear::solve_l2r_lr_dual(
 	// Initial alpha can be set here. Note that
 	// 0 < alpha[i] < upper_bound[GETI(i)]
 	// alpha[2*i] + alpha[2*i+1] = upper_bound[GETI(i)]
+	// with warm starting, the previous solution is clipped to the open box
+	bool warm = m_warm_start && m_warm_alpha.vlen == 2 * l;
 	for (i = 0; i < l; i++)
 	{
-		alpha[2 * i] = Math::min(0.001 * upper_bound[GETI(i)], 1e-8);
-		alpha[2 * i + 1] = upper_bound[GETI(i)] - alpha[2 * i];
+		double C = upper_bound[GETI(i)];
+		double amin = Math::min(0.001 * C, 1e-8);
+		alpha[2 * i] =
+		    warm ? Math::min(Math::max(m_warm_alpha[2 * i], amin), C - amin)
+		         : amin;
+		alpha[2 * i + 1] = C - alpha[2 * i];
 	}
 
 	for (i = 0; i < w_size; i++)
@@ -1364,6 +1434,12 @@ void LibLinear::solve_l2r_lr_dual(
 		     upper_bound[GETI(i)] * log(upper_bound[GETI(i)]);
 	io::info("Objective value = {}", v);
 
+	if (m_warm_start)
+	{
+		m_warm_alpha = SGVector<float64_t>(2 * l);
+		sg_memcpy(m_warm_alpha.vector, alpha, 2 * l * sizeof(double));
+	}
+
 	delete[] xTx;
 	delete[] alpha;
 	delete[] y;
@@ -11,6 +11,7 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/lib/common.h>
+#include <shogun/lib/SGMatrix.h>
 #include <shogun/machine/LinearMachine.h>
 #include <shogun/optimization/liblinear/shogun_liblinear.h>
 #include <shogun/mathematics/RandomMixin.h>
@@ -212,6 +213,40 @@ namespace shogun
 			return true;
 		}
 
+		/** enable warm starting: keep the dual alphas of the previous
+		 * solution and start the next train call from them instead of from
+		 * zero. Effective for the dual coordinate descent solvers
+		 * (L2R_L1LOSS_SVC_DUAL, L2R_L2LOSS_SVC_DUAL and L2R_LR_DUAL);
+		 * the remaining solvers fall back to a cold start. The kept state
+		 * only makes sense for train calls on the same training data, so
+		 * it is dropped when warm starting is disabled.
+		 *
+		 * @param enable whether to warm-start subsequent train calls
+		 */
+		void set_warm_start_enabled(bool enable);
+
+		/** @return whether train calls are warm-started */
+		bool get_warm_start_enabled() const
+		{
+			return m_warm_start;
+		}
+
+		/** train one model per C value of a regularization path in a single
+		 * call, reusing each solution to warm-start the next one; adjacent
+		 * solutions of a C grid typically differ in a small fraction of
+		 * their coordinates, so later values converge in few passes.
+		 *
+		 * @param Cs grid of C values, applied to both classes
+		 * @param data training data (can be avoided for the same reasons as
+		 * in train)
+		 * @return one weight vector per C value as columns, with the bias in
+		 * the last row when it is enabled; the machine keeps the model of
+		 * the last C value
+		 */
+		SGMatrix<float64_t> train_path(
+		    const SGVector<float64_t>& Cs,
+		    std::shared_ptr<Features> data = NULL);
+
 	protected:
 		/** train linear SVM classifier
 		 *
@@ -259,6 +294,12 @@ namespace shogun
 		/** precomputed linear term */
 		SGVector<float64_t> m_linear_term;
 
+		/** whether train calls are warm-started from the previous solution */
+		bool m_warm_start;
+
+		/** dual alphas of the previous solution, kept for warm starting */
+		SGVector<float64_t> m_warm_alpha;
+
 		/** solver type */
 		LIBLINEAR_SOLVER_TYPE liblinear_solver_type;
 	};
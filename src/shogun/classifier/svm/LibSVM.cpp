@@ -38,10 +38,25 @@ LibSVM::~LibSVM()
 
 void LibSVM::register_params()
 {
+	m_fold_reuse=false;
+
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&solver_type, "libsvm_solver_type",
 	    "LibSVM Solver type", ParameterProperties::SETTING,
 	    SG_OPTIONS(LIBSVM_C_SVC, LIBSVM_NU_SVC));
+	SG_ADD(&m_fold_reuse, "fold_reuse",
+	    "Reuse kernel rows and warm-start alphas across train calls",
+	    ParameterProperties::SETTING);
+}
+
+void LibSVM::set_fold_reuse_enabled(bool enable)
+{
+	m_fold_reuse=enable;
+	if (!enable)
+	{
+		m_rowstore.reset();
+		m_prev_alpha=SGVector<float64_t>();
+	}
 }
 
 bool LibSVM::train_machine(std::shared_ptr<Features> data)
@@ -110,6 +125,33 @@ bool LibSVM::train_machine(std::shared_ptr<Features> data)
 
 	ASSERT(kernel && kernel->has_features())
 
+	/* map training examples to their full-dataset indices so that kernel
+	 * rows and alphas can be shared across train calls on different
+	 * subsets of the same data */
+	SGVector<int32_t> orig_idx;
+	if (m_fold_reuse && solver_type==LIBSVM_C_SVC)
+	{
+		auto subset_stack=kernel->get_lhs()->get_subset_stack();
+		orig_idx=SGVector<int32_t>(problem.l);
+		int32_t num_total=0;
+		for (int32_t i=0; i<problem.l; i++)
+		{
+			orig_idx[i]=subset_stack->subset_idx_conversion(i);
+			num_total=Math::max(num_total, orig_idx[i]+1);
+		}
+
+		if (!m_rowstore)
+			m_rowstore=std::make_shared<svm_kernel_rowstore>();
+		m_rowstore->ensure_size(num_total, kernel->get_cache_size());
+
+		problem.init_alpha=SG_MALLOC(float64_t, problem.l);
+		for (int32_t i=0; i<problem.l; i++)
+		{
+			problem.init_alpha[i]=(orig_idx[i]<m_prev_alpha.vlen)
+				? m_prev_alpha[orig_idx[i]] : 0.0;
+		}
+	}
+
 	switch (solver_type)
 	{
 	case LIBSVM_C_SVC:
@@ -139,6 +181,8 @@ bool LibSVM::train_machine(std::shared_ptr<Features> data)
 	param.weight_label = weights_label;
 	param.weight = weights;
 	param.use_bias = get_bias_enabled();
+	param.rowstore = m_rowstore.get();
+	param.orig_idx = orig_idx.vector;
 
 	const char* error_msg = svm_check_parameter(&problem, &param);
 
@@ -167,6 +211,18 @@ bool LibSVM::train_machine(std::shared_ptr<Features> data)
 			set_alpha(i, sgn*model->sv_coef[0][i]);
 		}
 
+		/* keep the label-signed alphas per full-dataset index to
+		 * warm-start the next train call */
+		if (m_fold_reuse && orig_idx.vlen)
+		{
+			m_prev_alpha=SGVector<float64_t>(m_rowstore->num_total);
+			m_prev_alpha.zero();
+			for (int32_t i=0; i<num_sv; i++)
+				m_prev_alpha[orig_idx[(model->SV[i])->index]]=
+					sgn*model->sv_coef[0][i];
+		}
+
+		SG_FREE(problem.init_alpha);
 		SG_FREE(problem.x);
 		SG_FREE(problem.y);
 		SG_FREE(problem.pv);
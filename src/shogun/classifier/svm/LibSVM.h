@@ -57,6 +57,22 @@ class LibSVM : public SVM
 		/** @return object name */
 		const char* get_name() const override { return "LibSVM"; }
 
+		/** enable reuse of state across consecutive train calls on subsets
+		 * of the same dataset (e.g. cross-validation folds): kernel rows
+		 * are kept in a store keyed on the full-dataset indices underneath
+		 * the subset stack, and the alphas of the previous solution are
+		 * used to warm-start the solver. The reused state is dropped when
+		 * reuse is disabled; it must also be disabled (or toggled) whenever
+		 * the underlying features or kernel parameters change. Only
+		 * effective for the C-SVC solver.
+		 *
+		 * @param enable whether to reuse kernel rows and alphas
+		 */
+		void set_fold_reuse_enabled(bool enable);
+
+		/** @return whether state is reused across train calls */
+		bool get_fold_reuse_enabled() const { return m_fold_reuse; }
+
 	private:
 		void register_params();
 
@@ -74,6 +90,16 @@ class LibSVM : public SVM
 	protected:
 		/** solver type */
 		LIBSVM_SOLVER_TYPE solver_type;
+
+		/** whether kernel rows and alphas are reused across train calls */
+		bool m_fold_reuse;
+
+		/** kernel row store shared across train calls */
+		std::shared_ptr<svm_kernel_rowstore> m_rowstore;
+
+		/** label-signed alphas of the previous solution, indexed by
+		 * full-dataset index */
+		SGVector<float64_t> m_prev_alpha;
 };
 }
 #endif
@@ -28,6 +28,7 @@ NewtonSVM::NewtonSVM() : IterativeMachine<LinearMachine>()
 	prec = 1e-6;
 	C = 1;
 	t = 0;
+	use_hessian_free = false;
 }
 
 NewtonSVM::NewtonSVM(
@@ -39,6 +40,7 @@ NewtonSVM::NewtonSVM(
 	prec=1e-6;
 	C=c;
 	t = 0;
+	use_hessian_free = false;
 	set_features(std::move(traindat));
 	set_labels(std::move(trainlab));
 }
@@ -86,51 +88,60 @@ void NewtonSVM::iteration()
 	obj_fun_linear();
 	SGVector<float64_t> weights = get_w();
 
-	SGVector<float64_t> sgv;
-	SGMatrix<float64_t> Xsv(x_d, size_sv);
-	for (int32_t k = 0; k < size_sv; k++)
+	SGVector<float64_t> step(x_d + 1);
+
+	if (use_hessian_free)
 	{
-		sgv = features->get_computed_dot_feature_vector(sv[k]);
-		sg_memcpy(&Xsv.matrix[k * x_d], sgv.data(), sizeof(float64_t) * (x_d));
+		compute_newton_step_cg(step);
 	}
+	else
+	{
+		SGVector<float64_t> sgv;
+		SGMatrix<float64_t> Xsv(x_d, size_sv);
+		for (int32_t k = 0; k < size_sv; k++)
+		{
+			sgv = features->get_computed_dot_feature_vector(sv[k]);
+			sg_memcpy(
+			    &Xsv.matrix[k * x_d], sgv.data(), sizeof(float64_t) * (x_d));
+		}
 
-	SGMatrix<float64_t> lcrossdiag(x_d + 1, x_d + 1);
-	SGVector<float64_t> vector(x_d + 1);
+		SGMatrix<float64_t> lcrossdiag(x_d + 1, x_d + 1);
+		SGVector<float64_t> vector(x_d + 1);
 
-	vector.set_const(lambda);
+		vector.set_const(lambda);
 
-	vector[x_d] = 0;
+		vector[x_d] = 0;
 
-	SGMatrix<float64_t>::create_diagonal_matrix(
-	    lcrossdiag.data(), vector.data(), x_d + 1);
-	SGMatrix<float64_t> Xsv2(x_d, x_d);
-	linalg::matrix_prod(Xsv, Xsv, Xsv2, false, true);
+		SGMatrix<float64_t>::create_diagonal_matrix(
+		    lcrossdiag.data(), vector.data(), x_d + 1);
+		SGMatrix<float64_t> Xsv2(x_d, x_d);
+		linalg::matrix_prod(Xsv, Xsv, Xsv2, false, true);
 
-	SGVector<float64_t> sum = linalg::rowwise_sum(Xsv);
+		SGVector<float64_t> sum = linalg::rowwise_sum(Xsv);
 
-	SGMatrix<float64_t> Xsv2sum(x_d + 1, x_d + 1);
+		SGMatrix<float64_t> Xsv2sum(x_d + 1, x_d + 1);
 
-	for (int32_t i = 0; i < x_d; i++)
-	{
-		for (int32_t j = 0; j < x_d; j++)
-			Xsv2sum(i, j) = Xsv2(i, j);
+		for (int32_t i = 0; i < x_d; i++)
+		{
+			for (int32_t j = 0; j < x_d; j++)
+				Xsv2sum(i, j) = Xsv2(i, j);
 
-		Xsv2sum(i, x_d) = sum[i];
-	}
+			Xsv2sum(i, x_d) = sum[i];
+		}
 
-	for (int32_t j = 0; j < x_d; j++)
-		Xsv2sum(x_d, j) = sum[j];
+		for (int32_t j = 0; j < x_d; j++)
+			Xsv2sum(x_d, j) = sum[j];
 
-	Xsv2sum(x_d, x_d) = size_sv;
+		Xsv2sum(x_d, x_d) = size_sv;
 
-	linalg::add(Xsv2sum, lcrossdiag, Xsv2sum);
+		linalg::add(Xsv2sum, lcrossdiag, Xsv2sum);
 
-	SGVector<float64_t> step(x_d + 1);
-	SGVector<float64_t> s2(x_d + 1);
-	s2 = linalg::matrix_prod(linalg::pinvh(Xsv2sum), grad);
+		SGVector<float64_t> s2(x_d + 1);
+		s2 = linalg::matrix_prod(linalg::pinvh(Xsv2sum), grad);
 
-	for (int32_t i = 0; i < x_d + 1; i++)
-		step[i] = -s2[i];
+		for (int32_t i = 0; i < x_d + 1; i++)
+			step[i] = -s2[i];
+	}
 
 	line_search_linear(step);
 
@@ -143,6 +154,88 @@ void NewtonSVM::iteration()
 		m_complete = true;
 }
 
+SGVector<float64_t> NewtonSVM::hessian_times(const SGVector<float64_t>& p)
+{
+	// margins of the support vectors w.r.t. p, q = [Xsv 1]*p
+	SGVector<float64_t> q(size_sv);
+	features->dense_dot_range_subset(
+	    sv.vector, size_sv, q.vector, NULL, p.vector, x_d, p[x_d]);
+
+	// Hp = lambda*[p 0] + [Xsv 1]'*q, without ever forming the Hessian
+	SGVector<float64_t> Hp(x_d + 1);
+	Hp.zero();
+	for (int32_t k = 0; k < size_sv; k++)
+		features->add_to_dense_vec(q[k], sv[k], Hp.vector, x_d);
+
+	Hp[x_d] = linalg::sum(q);
+
+	for (int32_t i = 0; i < x_d; i++)
+		Hp[i] += lambda * p[i];
+
+	return Hp;
+}
+
+void NewtonSVM::compute_newton_step_cg(SGVector<float64_t>& step)
+{
+	// diagonal of the Hessian as Jacobi preconditioner
+	SGVector<float64_t> diag(x_d + 1);
+	diag.set_const(lambda);
+	diag[x_d] = size_sv;
+	for (int32_t k = 0; k < size_sv; k++)
+	{
+		SGVector<float64_t> xk =
+		    features->get_computed_dot_feature_vector(sv[k]);
+		for (int32_t i = 0; i < x_d; i++)
+			diag[i] += xk[i] * xk[i];
+	}
+
+	for (int32_t i = 0; i < x_d + 1; i++)
+	{
+		if (diag[i] <= 0)
+			diag[i] = 1;
+	}
+
+	// preconditioned CG on H*step = -grad
+	step.zero();
+	SGVector<float64_t> r(x_d + 1);
+	for (int32_t i = 0; i < x_d + 1; i++)
+		r[i] = -grad[i];
+
+	float64_t b_norm = std::sqrt(linalg::dot(r, r));
+	if (b_norm == 0)
+		return;
+
+	SGVector<float64_t> z(x_d + 1);
+	for (int32_t i = 0; i < x_d + 1; i++)
+		z[i] = r[i] / diag[i];
+
+	SGVector<float64_t> p = z.clone();
+	float64_t rz = linalg::dot(r, z);
+
+	int32_t max_cg = Math::min(x_d + 1, 250);
+	for (int32_t i = 0; i < max_cg; i++)
+	{
+		SGVector<float64_t> Hp = hessian_times(p);
+		float64_t pHp = linalg::dot(p, Hp);
+		if (pHp <= 0)
+			break;
+
+		float64_t a = rz / pHp;
+		linalg::add(step, p, step, 1.0, a);
+		linalg::add(r, Hp, r, 1.0, -a);
+
+		if (std::sqrt(linalg::dot(r, r)) <= 1e-5 * b_norm)
+			break;
+
+		for (int32_t j = 0; j < x_d + 1; j++)
+			z[j] = r[j] / diag[j];
+
+		float64_t rz_new = linalg::dot(r, z);
+		linalg::add(z, p, p, 1.0, rz_new / rz);
+		rz = rz_new;
+	}
+}
+
 void NewtonSVM::line_search_linear(const SGVector<float64_t>& d)
 {
 	SGVector<float64_t> Y = binary_labels(m_labels)->get_labels();
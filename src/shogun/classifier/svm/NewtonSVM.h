@@ -89,6 +89,25 @@ class NewtonSVM : public IterativeMachine<LinearMachine>
 		 */
 		inline void set_num_iter(int32_t iter) { num_iter=iter; }
 
+		/** set if the Newton system shall be solved Hessian-free. Instead of
+		 *  forming the (dim+1)x(dim+1) Hessian explicitly and inverting it,
+		 *  the Newton step is computed with a preconditioned conjugate
+		 *  gradient solver whose Hessian-vector products are expressed
+		 *  through dot products with the support vectors. This needs O(dim)
+		 *  memory instead of O(dim^2) and is the only feasible mode for
+		 *  high-dimensional (sparse) data.
+		 *  @param enable_hessian_free if the CG solver shall be used
+		 */
+		inline void set_hessian_free_enabled(bool enable_hessian_free)
+		{
+			use_hessian_free = enable_hessian_free;
+		}
+
+		/** get if the Hessian-free CG solver is enabled
+		 *  @return if the CG solver is used
+		 */
+		inline bool get_hessian_free_enabled() { return use_hessian_free; }
+
 		/** @return object name */
 		const char* get_name() const override { return "NewtonSVM"; }
 
@@ -101,6 +120,13 @@ class NewtonSVM : public IterativeMachine<LinearMachine>
 
 		void line_search_linear(const SGVector<float64_t>& d);
 
+		/** compute the Newton step with preconditioned CG, using only
+		 * Hessian-vector products and a diagonal preconditioner */
+		void compute_newton_step_cg(SGVector<float64_t>& step);
+
+		/** multiply the current Hessian with a vector without forming it */
+		SGVector<float64_t> hessian_times(const SGVector<float64_t>& p);
+
 	protected:
 		/** lambda=1/C */
 		float64_t lambda, C, epsilon;
@@ -111,6 +137,9 @@ class NewtonSVM : public IterativeMachine<LinearMachine>
 
 		/** if bias is used */
 		bool use_bias;
+
+		/** if the Newton step is computed Hessian-free with CG */
+		bool use_hessian_free;
 };
 }
 #endif //_NEWTONSVM_H___
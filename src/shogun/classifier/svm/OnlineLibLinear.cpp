@@ -65,10 +65,16 @@ void OnlineLibLinear::init()
 	Cn=1;
 	use_bias=false;
 
+	m_batch_size = 1;
+	m_num_buffered = 0;
+
 	SG_ADD(&C1, "C1", "C Cost constant 1.", ParameterProperties::HYPER);
 	SG_ADD(&C2, "C2", "C Cost constant 2.", ParameterProperties::HYPER);
 	SG_ADD(
 	    &use_bias, "use_bias", "Indicates if bias is used.", ParameterProperties::SETTING);
+	SG_ADD(
+	    &m_batch_size, "batch_size", "Number of examples per mini-batch.",
+	    ParameterProperties::SETTING);
 
 	PG = 0;
 	PGmax_old = Math::INFTY;
@@ -112,8 +118,16 @@ void OnlineLibLinear::start_train()
 	nSV = 0;
 }
 
+void OnlineLibLinear::set_batch_size(int32_t batch_size)
+{
+	require(batch_size >= 1, "Batch size ({}) must be at least 1", batch_size);
+	m_batch_size = batch_size;
+}
+
 void OnlineLibLinear::stop_train()
 {
+	flush_batch();
+
 	float64_t gap = PGmax_new - PGmin_new;
 
 	io::progress_done();
@@ -262,10 +276,161 @@ void OnlineLibLinear::train_one(SGSparseVector<float32_t> ex, float64_t label)
 		nSV++;
 }
 
+void OnlineLibLinear::buffer_example(
+	const std::shared_ptr<StreamingDotFeatures>& feature, float64_t label)
+{
+	if (m_num_buffered == 0)
+	{
+		m_batch_labels = SGVector<float64_t>(m_batch_size);
+		m_batch_qd = SGVector<float64_t>(m_batch_size);
+		m_batch_sparse.clear();
+	}
+
+	if (feature->get_feature_class() == C_STREAMING_DENSE)
+	{
+		auto feat =
+			std::dynamic_pointer_cast<StreamingDenseFeatures<float32_t>>(feature);
+		if (feat == NULL)
+			error("Expected streaming dense feature <float32_t>");
+
+		SGVector<float32_t> ex = feat->get_vector();
+		if (m_num_buffered == 0)
+			m_batch_vecs = SGMatrix<float32_t>(ex.vlen, m_batch_size);
+		require(ex.vlen == m_batch_vecs.num_rows,
+			"Example dimension ({}) differs from the buffered ones ({})",
+			ex.vlen, m_batch_vecs.num_rows);
+
+		sg_memcpy(m_batch_vecs.get_column_vector(m_num_buffered), ex.vector,
+			ex.vlen * sizeof(float32_t));
+		m_batch_qd[m_num_buffered] = linalg::dot(ex, ex);
+	}
+	else if (feature->get_feature_class() == C_STREAMING_SPARSE)
+	{
+		auto feat =
+			std::dynamic_pointer_cast<StreamingSparseFeatures<float32_t>>(feature);
+		if (feat == NULL)
+			error("Expected streaming sparse feature <float32_t>");
+
+		// the streamed vector is only valid until the example is
+		// released, so keep a copy
+		SGSparseVector<float32_t> ex = feat->get_vector();
+		m_batch_sparse.push_back(ex.clone());
+		m_batch_qd[m_num_buffered] =
+			SGSparseVector<float32_t>::sparse_dot(ex, ex);
+	}
+	else
+	{
+		not_implemented(SOURCE_LOCATION);
+	}
+
+	m_batch_labels[m_num_buffered] = label;
+	m_num_buffered++;
+
+	if (m_num_buffered == m_batch_size)
+		flush_batch();
+}
+
+void OnlineLibLinear::flush_batch()
+{
+	int32_t num = m_num_buffered;
+	if (num == 0)
+		return;
+
+	bool dense = m_batch_sparse.empty();
+
+	// gradients of all buffered examples against the weights at batch
+	// start; for dense features this is one matrix-vector product
+	SGVector<float64_t> dots(num);
+	if (dense)
+	{
+		SGMatrix<float32_t> batch(
+			m_batch_vecs.matrix, m_batch_vecs.num_rows, num, false);
+		SGVector<float32_t> g = linalg::matrix_prod(batch, m_w, true);
+		for (int32_t k = 0; k < num; k++)
+			dots[k] = g[k];
+	}
+	else
+	{
+		for (int32_t k = 0; k < num; k++)
+			dots[k] = m_batch_sparse[k].dense_dot(
+				1.0, m_w.vector, m_w.vlen, 0.0);
+	}
+
+	SGVector<float32_t> coeff(num);
+	float64_t bias_update = 0;
+	for (int32_t k = 0; k < num; k++)
+	{
+		int32_t y_current = (m_batch_labels[k] > 0) ? +1 : -1;
+		coeff[k] = 0;
+
+		float64_t G_cur = dots[k];
+		if (use_bias)
+			G_cur += bias;
+		G_cur = G_cur * y_current - 1;
+
+		// every streamed example starts at alpha=0, as in train_one
+		if (G_cur > PGmax_old)
+			continue;
+		float64_t PG_cur = (G_cur < 0) ? G_cur : 0;
+
+		PGmax_new = Math::max(PGmax_new, PG_cur);
+		PGmin_new = Math::min(PGmin_new, PG_cur);
+
+		float64_t alpha_cur = 0;
+		if (fabs(PG_cur) > 1.0e-12)
+		{
+			float64_t QD_cur = diag[y_current + 1] + m_batch_qd[k];
+			alpha_cur = Math::min(
+				Math::max(-G_cur / QD_cur, 0.0), upper_bound[y_current + 1]);
+			float64_t d_cur = alpha_cur * y_current;
+			coeff[k] = (float32_t)d_cur;
+			bias_update += d_cur;
+		}
+
+		v += alpha_cur * (alpha_cur * diag[y_current + 1] - 2);
+		if (alpha_cur > 0)
+			nSV++;
+	}
+
+	// apply all updates at once: one matrix-vector product for dense
+	// features, sparse axpys otherwise
+	if (dense)
+	{
+		SGMatrix<float32_t> batch(
+			m_batch_vecs.matrix, m_batch_vecs.num_rows, num, false);
+		SGVector<float32_t> delta = linalg::matrix_prod(batch, coeff);
+		linalg::add(m_w, delta, m_w, 1.0f, 1.0f);
+	}
+	else
+	{
+		for (int32_t k = 0; k < num; k++)
+		{
+			if (coeff[k] == 0)
+				continue;
+			const SGSparseVector<float32_t>& ex = m_batch_sparse[k];
+			for (int32_t i = 0; i < ex.num_feat_entries; i++)
+				m_w[ex.features[i].feat_index] +=
+					coeff[k] * ex.features[i].entry;
+		}
+	}
+
+	if (use_bias)
+		bias += bias_update;
+
+	m_num_buffered = 0;
+	m_batch_sparse.clear();
+}
+
 void OnlineLibLinear::train_example(std::shared_ptr<StreamingDotFeatures >feature, float64_t label)
 {
 	feature->expand_if_required(m_w.vector, m_w.vlen);
 
+	if (m_batch_size > 1)
+	{
+		buffer_example(feature, label);
+		return;
+	}
+
 	if (feature->get_feature_class() == C_STREAMING_DENSE) {
 		auto feat =
 			std::dynamic_pointer_cast<StreamingDenseFeatures<float32_t>>(feature);
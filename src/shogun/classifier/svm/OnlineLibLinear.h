@@ -11,10 +11,14 @@
 
 #include <shogun/lib/config.h>
 
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSparseVector.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/common.h>
 #include <shogun/machine/OnlineLinearMachine.h>
 
+#include <vector>
+
 namespace shogun
 {
 /** @brief Class implementing a purely online version of LibLinear,
@@ -103,6 +107,23 @@ public:
 		/** @return Object name */
 		const char* get_name() const override { return "OnlineLibLinear"; }
 
+		/** Set the number of streamed examples that are buffered and
+		 * updated as one mini-batch. With a batch size of B, the gradients
+		 * of the B buffered examples are computed against the weights at
+		 * batch start (a single matrix-vector product for dense features)
+		 * and the resulting updates are applied together, trading exact
+		 * per-example gradients for vectorized, bandwidth-friendly
+		 * updates. The parser thread keeps filling its queue while a
+		 * batch is processed. The default of 1 keeps the original
+		 * per-example behavior.
+		 *
+		 * @param batch_size number of examples per mini-batch
+		 */
+		void set_batch_size(int32_t batch_size);
+
+		/** @return number of examples per mini-batch */
+		int32_t get_batch_size() const { return m_batch_size; }
+
 		/** start training */
 		void start_train() override;
 
@@ -137,6 +158,18 @@ private:
 		 */
 		void train_one(SGSparseVector<float32_t> ex, float64_t label);
 
+		/** copy the current example into the mini-batch buffers and flush
+		 * the batch once it is full
+		 * @param feature the feature object containing the current example
+		 * @param label label of this example
+		 */
+		void buffer_example(
+			const std::shared_ptr<StreamingDotFeatures>& feature,
+			float64_t label);
+
+		/** apply the dual coordinate updates of all buffered examples */
+		void flush_batch();
+
 private:
 		/// use bias or not
 		bool use_bias;
@@ -174,6 +207,19 @@ private:
 		float64_t v;
 		// Number of support vectors
 		int32_t nSV;
+
+		// number of examples per mini-batch (1: update per example)
+		int32_t m_batch_size;
+		// buffered dense examples, one column per example
+		SGMatrix<float32_t> m_batch_vecs;
+		// buffered sparse examples
+		std::vector<SGSparseVector<float32_t>> m_batch_sparse;
+		// labels of the buffered examples
+		SGVector<float64_t> m_batch_labels;
+		// squared norms of the buffered examples
+		SGVector<float64_t> m_batch_qd;
+		// number of buffered examples
+		int32_t m_num_buffered;
 };
 }
 #endif // _ONLINELIBLINEAR_H__
@@ -96,39 +96,8 @@ struct S_THREAD_PARAM_REACTIVATE_VANILLA
 	int32_t end;
 };
 
-struct S_THREAD_PARAM_KERNEL
-{
-	float64_t *Kval ;
-	int32_t *KI, *KJ ;
-	int32_t start, end;
-    std::shared_ptr<SVMLight> svmlight;
-};
-
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 
-void* SVMLight::update_linear_component_linadd_helper(void* p)
-{
-	S_THREAD_PARAM_SVMLIGHT* params = (S_THREAD_PARAM_SVMLIGHT*) p;
-
-	int32_t jj=0, j=0 ;
-
-	for (jj=params->start;(jj<params->end) && (j=params->active2dnum[jj])>=0;jj++)
-		params->lin[j]+=params->kernel->compute_optimized(params->docs[j]);
-
-	return NULL ;
-}
-
-void* SVMLight::compute_kernel_helper(void* p)
-{
-	S_THREAD_PARAM_KERNEL* params = (S_THREAD_PARAM_KERNEL*) p;
-
-	int32_t jj=0 ;
-	for (jj=params->start;jj<params->end;jj++)
-		params->Kval[jj]=params->svmlight->compute_kernel(params->KI[jj], params->KJ[jj]) ;
-
-	return NULL ;
-}
-
 SVMLight::SVMLight()
 : SVM()
 {
@@ -1059,19 +1028,17 @@ void SVMLight::compute_matrices_for_optimization_parallel(
 	float64_t *a, float64_t *lin, float64_t *c, int32_t varnum, int32_t totdoc,
 	float64_t *aicache, QP *qp)
 {
-	// TODO: port to use OpenMP backend instead of pthread
-#ifdef HAVE_PTHREAD
-	int32_t num_threads=env()->get_num_threads();
-#else
-	int32_t num_threads=1;
-#endif
+	// claim threads from the global budget so that nested parallel
+	// regions (e.g. cross-validation around SVMLight) fall back to the
+	// serial path instead of oversubscribing the machine
+	ThreadBudget budget(env());
+	int32_t num_threads=budget.get_num_threads();
 	if (num_threads < 2)
 	{
 		compute_matrices_for_optimization(docs, label, exclude_from_eq_const, eq_target,
 												   chosen, active2dnum, key, a, lin, c,
 												   varnum, totdoc, aicache, qp) ;
 	}
-#ifdef HAVE_PTHREAD
 	else
 	{
 		int32_t ki,kj,i,j;
@@ -1115,28 +1082,9 @@ void SVMLight::compute_matrices_for_optimization_parallel(
 		}
 		ASSERT(Knum<=varnum*(varnum+1)/2)
 
-		pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-		S_THREAD_PARAM_KERNEL* params = SG_MALLOC(S_THREAD_PARAM_KERNEL, num_threads-1);
-		int32_t step= Knum/num_threads;
-		//SG_DEBUG("\nkernel-step size: {}", step)
-		for (int32_t t=0; t<num_threads-1; t++)
-		{
-			params[t].svmlight = std::shared_ptr<SVMLight>(this);
-			params[t].start = t*step;
-			params[t].end = (t+1)*step;
-			params[t].KI=KI ;
-			params[t].KJ=KJ ;
-			params[t].Kval=Kval ;
-			pthread_create(&threads[t], NULL, SVMLight::compute_kernel_helper, (void*)&params[t]);
-		}
-		for (i=params[num_threads-2].end; i<Knum; i++)
-			Kval[i]=compute_kernel(KI[i],KJ[i]) ;
-
-		for (int32_t t=0; t<num_threads-1; t++)
-			pthread_join(threads[t], NULL);
-
-		SG_FREE(params);
-		SG_FREE(threads);
+		#pragma omp parallel for num_threads(num_threads) schedule(static)
+		for (int32_t k=0; k<Knum; k++)
+			Kval[k]=compute_kernel(KI[k],KJ[k]) ;
 
 		Knum=0 ;
 		for (i=0;i<varnum;i++) {
@@ -1188,7 +1136,6 @@ void SVMLight::compute_matrices_for_optimization_parallel(
 			io::progress_done();
 		}
 	}
-#endif
 }
 
 void SVMLight::compute_matrices_for_optimization(
@@ -1474,54 +1421,15 @@ void SVMLight::update_linear_component(
 
 			if (num_working>0)
 			{
-				// TODO: port to use OpenMP backend instead of pthread
-#ifdef HAVE_PTHREAD
-				int32_t num_threads=env()->get_num_threads();
-#else
-				int32_t num_threads=1;
-#endif
-				if (num_threads < 2)
-				{
-					for (jj=0;(j=active2dnum[jj])>=0;jj++) {
-						lin[j]+=kernel->compute_optimized(docs[j]);
-					}
-				}
-#ifdef HAVE_PTHREAD
-				else
+				int32_t num_elem = 0 ;
+				for (jj=0;(j=active2dnum[jj])>=0;jj++) num_elem++ ;
+
+				#pragma omp parallel for
+				for (int32_t e=0; e<num_elem; e++)
 				{
-					int32_t num_elem = 0 ;
-					for (jj=0;(j=active2dnum[jj])>=0;jj++) num_elem++ ;
-
-					pthread_t* threads = SG_MALLOC(pthread_t, num_threads-1);
-					S_THREAD_PARAM_SVMLIGHT* params = SG_MALLOC(S_THREAD_PARAM_SVMLIGHT, num_threads-1);
-					int32_t start = 0 ;
-					int32_t step = num_elem/num_threads;
-					int32_t end = step ;
-
-					for (int32_t t=0; t<num_threads-1; t++)
-					{
-						params[t].kernel = kernel.get();
-						params[t].lin = lin ;
-						params[t].docs = docs ;
-						params[t].active2dnum=active2dnum ;
-						params[t].start = start ;
-						params[t].end = end ;
-						start=end ;
-						end+=step ;
-						pthread_create(&threads[t], NULL, update_linear_component_linadd_helper, (void*)&params[t]) ;
-					}
-
-					for (jj=params[num_threads-2].end;(j=active2dnum[jj])>=0;jj++) {
-						lin[j]+=kernel->compute_optimized(docs[j]);
-					}
-					void* ret;
-					for (int32_t t=0; t<num_threads-1; t++)
-						pthread_join(threads[t], &ret) ;
-
-					SG_FREE(params);
-					SG_FREE(threads);
+					int32_t doc=active2dnum[e];
+					lin[doc]+=kernel->compute_optimized(docs[doc]);
 				}
-#endif
 			}
 		}
 	}
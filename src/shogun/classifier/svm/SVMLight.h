@@ -610,18 +610,6 @@ protected:
 		return kernel->kernel(i, j);
 	}
 
-	/** helper for compute kernel
-	 *
-	 * @param p p
-	 */
-	static void* compute_kernel_helper(void* p);
-
-	/** helper for update linear component linadd
-	 *
-	 * @param p p
-	 */
-	static void* update_linear_component_linadd_helper(void* p);
-
 	/** helper for reactivate inactive examples vanilla
 	 *
 	 * @param p p
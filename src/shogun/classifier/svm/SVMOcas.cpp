@@ -10,6 +10,7 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/lib/Time.h>
 #include <shogun/base/Parallel.h>
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/machine/LinearMachine.h>
 #include <shogun/features/DotFeatures.h>
 #include <shogun/labels/Labels.h>
@@ -201,12 +202,42 @@ int SVMOcas::add_new_cut(
 	float64_t* new_a = o->tmp_a_buf;
 	memset(new_a, 0, sizeof(float64_t)*nDim);
 
-	for(i=0; i < cut_length; i++)
+	if (env()->get_num_threads()<2)
 	{
-		f->add_to_dense_vec(y[new_cut[i]], new_cut[i], new_a, nDim);
+		for(i=0; i < cut_length; i++)
+		{
+			f->add_to_dense_vec(y[new_cut[i]], new_cut[i], new_a, nDim);
 
-		if (o->use_bias)
-			c_bias[nSel]+=y[new_cut[i]];
+			if (o->use_bias)
+				c_bias[nSel]+=y[new_cut[i]];
+		}
+	}
+	else
+	{
+		/* the cut spans a large fraction of the dataset: accumulate the
+		 * subgradient into per-thread partial vectors and merge them */
+		#pragma omp parallel
+		{
+			SGVector<float64_t> partial(nDim);
+			partial.zero();
+			float64_t partial_bias=0;
+
+			#pragma omp for schedule(dynamic, 256) nowait
+			for (int64_t k=0; k<(int64_t) cut_length; k++)
+			{
+				f->add_to_dense_vec(y[new_cut[k]], new_cut[k], partial.vector, nDim);
+
+				if (o->use_bias)
+					partial_bias+=y[new_cut[k]];
+			}
+
+			#pragma omp critical
+			{
+				for (uint32_t d=0; d<nDim; d++)
+					new_a[d]+=partial[d];
+				c_bias[nSel]+=partial_bias;
+			}
+		}
 	}
 
 	/* compute new_a'*new_a and count number of non-zerou dimensions */
@@ -242,13 +273,15 @@ int SVMOcas::add_new_cut(
 
 	new_col_H[nSel] = sq_norm_a;
 
-	for(i=0; i < nSel; i++)
+	/* dot products against the previous cut planes are independent */
+	#pragma omp parallel for schedule(dynamic, 16)
+	for (int64_t p=0; p<(int64_t) nSel; p++)
 	{
-		float64_t tmp = c_bias[nSel]*c_bias[i];
-		for(j=0; j < c_nzd[i]; j++)
-			tmp += new_a[c_idx[i][j]]*c_val[i][j];
+		float64_t tmp = c_bias[nSel]*c_bias[p];
+		for(uint32_t d=0; d < c_nzd[p]; d++)
+			tmp += new_a[c_idx[p][d]]*c_val[p][d];
 
-		new_col_H[i] = tmp;
+		new_col_H[p] = tmp;
 	}
 	//Math::display_vector(new_col_H, nSel+1, "new_col_H");
 	//Math::display_vector((int32_t*) c_idx[nSel], (int32_t) nz_dims, "c_idx");
@@ -144,38 +144,76 @@ float64_t GMM::train_em(float64_t min_cov, int32_t max_iter, float64_t min_chang
 		alpha=SGMatrix<float64_t>(num_vectors,int32_t(m_components.size()));
 
 	int32_t iter=0;
+	int32_t num_components=int32_t(m_components.size());
+	int32_t num_dim=dotdata->get_num_features();
 	float64_t log_likelihood_prev=0;
 	float64_t log_likelihood_cur=0;
 	SGVector<float64_t> logPxy(num_vectors * m_components.size());
 	SGVector<float64_t> logPx(num_vectors);
-	//float64_t* logPost=SG_MALLOC(float64_t, num_vectors*m_components.vlen);
+
+	/* points per E-step block: big enough to amortize the per-component
+	 * matrix operations, small enough to keep the block cache-resident */
+	const int32_t block_size=Math::min(2048, num_vectors);
+	SGMatrix<float64_t> block_feats(num_dim, block_size);
+
 	auto pb = SG_PROGRESS(range(max_iter));
 	while (iter<max_iter)
 	{
 		log_likelihood_prev=log_likelihood_cur;
 		log_likelihood_cur=0;
 
-		for (int32_t i=0; i<num_vectors; i++)
+		for (int32_t start=0; start<num_vectors; start+=block_size)
 		{
-			logPx[i]=0;
-			SGVector<float64_t> v=dotdata->get_computed_dot_feature_vector(i);
-			for (int32_t j=0; j<int32_t(m_components.size()); j++)
+			int32_t cur=Math::min(block_size, num_vectors-start);
+
+			for (int32_t i=0; i<cur; i++)
 			{
-				logPxy[index_t(i * m_components.size() + j)] =
-				    m_components[j]->compute_log_PDF(v) +
-				    std::log(m_coefficients[j]);
-				logPx[i] +=
-				    std::exp(logPxy[index_t(i * m_components.size() + j)]);
+				SGVector<float64_t> v =
+				    dotdata->get_computed_dot_feature_vector(start + i);
+				sg_memcpy(
+				    block_feats.get_column_vector(i), v.vector,
+				    num_dim * sizeof(float64_t));
 			}
 
-			logPx[i] = std::log(logPx[i]);
-			log_likelihood_cur+=logPx[i];
+			SGMatrix<float64_t> block(block_feats.matrix, num_dim, cur, false);
 
-			for (int32_t j=0; j<int32_t(m_components.size()); j++)
+			/* per component one batched log-density evaluation over the
+			 * whole block instead of per-point scalar calls */
+			for (int32_t j=0; j<num_components; j++)
 			{
-				//logPost[i*m_components.vlen+j]=logPxy[i*m_components.vlen+j]-logPx[i];
-				alpha.matrix[i * m_components.size() + j] = std::exp(
-				    logPxy[index_t(i * m_components.size() + j)] - logPx[i]);
+				SGVector<float64_t> log_density =
+				    m_components[j]->compute_log_PDF(block);
+				const float64_t log_coef=std::log(m_coefficients[j]);
+				for (int32_t i=0; i<cur; i++)
+					logPxy[index_t(
+					    (start + i) * num_components + j)] =
+					    log_density[i] + log_coef;
+			}
+
+			/* log-sum-exp across components and responsibilities,
+			 * thread-parallel over the block's points */
+#pragma omp parallel for reduction(+:log_likelihood_cur)
+			for (int32_t i=0; i<cur; i++)
+			{
+				const float64_t* row =
+				    &logPxy.vector[index_t((start + i) * num_components)];
+
+				float64_t max_log=row[0];
+				for (int32_t j=1; j<num_components; j++)
+					max_log=Math::max(max_log, row[j]);
+
+				float64_t sum=0;
+				for (int32_t j=0; j<num_components; j++)
+					sum+=std::exp(row[j]-max_log);
+
+				logPx[start + i] = max_log + std::log(sum);
+				log_likelihood_cur+=logPx[start+i];
+
+				for (int32_t j=0; j<num_components; j++)
+				{
+					alpha.matrix[(start + i) * num_components + j] =
+					    std::exp(row[j] - logPx[start + i]);
+				}
 			}
 		}
 
@@ -490,6 +528,11 @@ void GMM::partial_em(int32_t comp1, int32_t comp2, int32_t comp3, float64_t min_
 		components[2]->get_d().vector[0]=components[0]->get_d().vector[0];
 	}
 
+	/* the in-place covariance edits above bypass set_d, so refresh the
+	 * cached normalizers before the partial EM evaluates the components */
+	for (int32_t i=0; i<3; i++)
+		components[i]->init();
+
 	auto partial_candidate=std::make_shared<GMM>(components, coefficients);
 	seed(partial_candidate);
 	partial_candidate->train(features);
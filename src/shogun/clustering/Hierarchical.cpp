@@ -91,8 +91,6 @@ bool Hierarchical::train_machine(std::shared_ptr<Features> data)
 	int32_t num=lhs->get_num_vectors();
 	ASSERT(num>0)
 
-	const int32_t num_pairs=num*(num-1)/2;
-
 	SG_FREE(merge_distance);
 	merge_distance=SG_MALLOC(float64_t, num);
 	merge_distance_len=num;
@@ -107,30 +105,72 @@ bool Hierarchical::train_machine(std::shared_ptr<Features> data)
 	pairs=SG_MALLOC(int32_t, 2*num);
 	SGVector<int32_t>::fill_vector(pairs, 2*num, -1);
 
-	pair* index=SG_MALLOC(pair, num_pairs);
-	float64_t* distances=SG_MALLOC(float64_t, num_pairs);
+	/* single linkage agglomeration merges along the edges of the minimum
+	 * spanning tree, so instead of materializing and sorting all
+	 * n(n-1)/2 pairwise distances the tree is grown with Prim's
+	 * algorithm: O(n) memory, O(n^2) distance evaluations, and the
+	 * per-point update pass after each addition runs multithreaded */
+	const int32_t num_edges=num-1;
+
+	pair* index=SG_MALLOC(pair, num_edges);
+	float64_t* distances=SG_MALLOC(float64_t, num_edges);
+	float64_t* dist_to_tree=SG_MALLOC(float64_t, num);
+	int32_t* closest_in_tree=SG_MALLOC(int32_t, num);
+	bool* in_tree=SG_MALLOC(bool, num);
+
+	for (int32_t j=0; j<num; j++)
+	{
+		dist_to_tree[j]=distance->distance(0, j);
+		closest_in_tree[j]=0;
+		in_tree[j]=false;
+	}
+	in_tree[0]=true;
 
-	int32_t offs=0;
-	for (auto i : SG_PROGRESS(range(0, num)))
+	for (auto e : SG_PROGRESS(range(0, num_edges)))
 	{
-		for (int32_t j=i+1; j<num; j++)
+		int32_t nearest=-1;
+		for (int32_t j=0; j<num; j++)
 		{
-			distances[offs] = distance->distance(i, j);
-			index[offs].idx1 = i;
-			index[offs].idx2 = j;
-			offs++; // offs=i*(i+1)/2+j
+			if (in_tree[j])
+				continue;
+			if (nearest<0 || dist_to_tree[j]<dist_to_tree[nearest])
+				nearest=j;
+		}
+
+		index[e].idx1=closest_in_tree[nearest];
+		index[e].idx2=nearest;
+		distances[e]=dist_to_tree[nearest];
+		in_tree[nearest]=true;
+
+#pragma omp parallel for
+		for (int32_t j=0; j<num; j++)
+		{
+			if (in_tree[j])
+				continue;
+
+			float64_t dist=distance->distance(nearest, j);
+			if (dist<dist_to_tree[j])
+			{
+				dist_to_tree[j]=dist;
+				closest_in_tree[j]=nearest;
+			}
 		}
 	}
 
-	Math::qsort_index<float64_t,pair>(distances, index, (num-1)*num/2);
-	//Math::display_vector(distances, (num-1)*num/2, "dists");
+	SG_FREE(dist_to_tree);
+	SG_FREE(closest_in_tree);
+	SG_FREE(in_tree);
+
+	/* replaying the tree edges in sorted order yields the same merge
+	 * sequence the sorted full pair list produced */
+	Math::qsort_index<float64_t,pair>(distances, index, num_edges);
 
-	auto pb = SG_PROGRESS(range(0, num_pairs - 1));
+	auto pb = SG_PROGRESS(range(0, num_edges - 1));
 	int32_t k=-1;
 	int32_t l=0;
-	for (; l<num && (num-l)>=merges && k<num_pairs-1; l++)
+	for (; l<num && (num-l)>=merges && k<num_edges-1; l++)
 	{
-		while (k<num_pairs-1)
+		while (k<num_edges-1)
 		{
 			k++;
 
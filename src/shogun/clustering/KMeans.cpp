@@ -13,6 +13,7 @@
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/lib/observers/ObservedValueTemplated.h>
 #include <shogun/io/SGIO.h>
+#include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 #include <utility>
@@ -26,14 +27,26 @@ namespace shogun
 
 KMeans::KMeans():KMeansBase()
 {
+	init();
 }
 
 KMeans::KMeans(int32_t k_i, std::shared_ptr<Distance> d_i, bool use_kmpp_i):KMeansBase(k_i, std::move(d_i), use_kmpp_i)
 {
+	init();
 }
 
 KMeans::KMeans(int32_t k_i, std::shared_ptr<Distance> d_i, SGMatrix<float64_t> centers_i):KMeansBase(k_i, std::move(d_i), centers_i)
 {
+	init();
+}
+
+void KMeans::init()
+{
+	m_use_bound_pruning=false;
+	SG_ADD(
+	    &m_use_bound_pruning, "use_bound_pruning",
+	    "Whether to prune distance computations with triangle-inequality bounds",
+	    ParameterProperties::HYPER | ParameterProperties::SETTING);
 }
 
 KMeans::~KMeans()
@@ -179,10 +192,238 @@ void KMeans::Lloyd_KMeans(SGMatrix<float64_t> centers, int32_t num_centers)
 
 }
 
+void KMeans::hamerly_KMeans(SGMatrix<float64_t> centers, int32_t num_centers)
+{
+	auto lhs =
+		std::dynamic_pointer_cast<DenseFeatures<float64_t>>(distance->get_lhs());
+
+	int32_t lhs_size=lhs->get_num_vectors();
+	int32_t dim=lhs->get_num_features();
+
+	auto rhs_cache = distance->get_rhs();
+
+	SGVector<int32_t> cluster_assignments(lhs_size);
+	/* Upper bound on the distance of each point to its center and lower
+	 * bound on its distance to the second closest center */
+	SGVector<float64_t> upper(lhs_size);
+	SGVector<float64_t> lower(lhs_size);
+
+	/* Weights : Number of points in each cluster */
+	SGVector<int64_t> weights_set(num_centers);
+	weights_set.zero();
+
+	/* How far each center moved in the last update step and half the
+	 * distance of each center to its nearest other center */
+	SGVector<float64_t> movement(num_centers);
+	SGVector<float64_t> s(num_centers);
+	SGMatrix<float64_t> old_centers(dim, num_centers);
+
+	distance->precompute_lhs();
+
+	/* Initial assignment : one full scan initializes both bounds */
+	{
+		auto rhs_mus = std::make_shared<DenseFeatures<float64_t>>(centers.clone());
+		distance->replace_rhs(rhs_mus);
+
+#pragma omp parallel for firstprivate(lhs_size, num_centers) \
+		shared(cluster_assignments, upper, lower, weights_set)
+		for (int32_t i=0; i<lhs_size; i++)
+		{
+			int32_t min_cluster=0;
+			float64_t min_dist=distance->distance(i,0);
+			float64_t second_dist=Math::INFTY;
+			for (int32_t j=1; j<num_centers; j++)
+			{
+				float64_t dist=distance->distance(i,j);
+				if (dist<min_dist)
+				{
+					second_dist=min_dist;
+					min_dist=dist;
+					min_cluster=j;
+				}
+				else if (dist<second_dist)
+					second_dist=dist;
+			}
+
+			cluster_assignments[i]=min_cluster;
+			upper[i]=min_dist;
+			lower[i]=second_dist;
+#pragma omp atomic
+			++weights_set[min_cluster];
+		}
+	}
+
+	int32_t changed=1;
+
+	for (auto iter : SG_PROGRESS(range(max_iter)))
+	{
+		if (iter==max_iter-1)
+			io::warn("KMeans clustering has reached maximum number of ( {} ) iterations without having converged. \
+				   	Terminating. ", iter);
+
+		/* Update step : Calculate new means */
+		sg_memcpy(old_centers.matrix, centers.matrix,
+			dim*num_centers*sizeof(float64_t));
+		centers.zero();
+
+		for (int32_t i=0; i<lhs_size; i++)
+		{
+			int32_t cluster_i=cluster_assignments[i];
+
+			auto vec = lhs->get_feature_vector(i);
+			linalg::add_col_vec(centers, cluster_i, vec, centers);
+			lhs->free_feature_vector(vec, i);
+		}
+
+		for (int32_t i=0; i<num_centers; i++)
+		{
+			if (weights_set[i]!=0)
+			{
+				auto col = centers.get_column(i);
+				linalg::scale(col, col, 1.0 / weights_set[i]);
+			}
+		}
+
+		/* Loosen the bounds by how far the centers moved: the assigned
+		 * center's movement widens the upper bound, the largest movement
+		 * of any other center tightens the lower bound */
+		int32_t furthest=0;
+		float64_t max_movement=0;
+		float64_t second_movement=0;
+		for (int32_t j=0; j<num_centers; j++)
+		{
+			float64_t moved=0;
+			for (int32_t d=0; d<dim; d++)
+			{
+				float64_t diff=centers(d,j)-old_centers(d,j);
+				moved+=diff*diff;
+			}
+			movement[j]=std::sqrt(moved);
+
+			if (movement[j]>max_movement)
+			{
+				second_movement=max_movement;
+				max_movement=movement[j];
+				furthest=j;
+			}
+			else if (movement[j]>second_movement)
+				second_movement=movement[j];
+		}
+
+		for (int32_t i=0; i<lhs_size; i++)
+		{
+			upper[i]+=movement[cluster_assignments[i]];
+			lower[i]-=cluster_assignments[i]==furthest ? second_movement : max_movement;
+		}
+
+		/* Half the distance of each center to its nearest other center:
+		 * points closer to their center than this cannot change */
+#pragma omp parallel for firstprivate(num_centers, dim) shared(centers, s)
+		for (int32_t j=0; j<num_centers; j++)
+		{
+			float64_t min_dist=Math::INFTY;
+			for (int32_t j2=0; j2<num_centers; j2++)
+			{
+				if (j2==j)
+					continue;
+
+				float64_t dist=0;
+				for (int32_t d=0; d<dim; d++)
+				{
+					float64_t diff=centers(d,j)-centers(d,j2);
+					dist+=diff*diff;
+				}
+				min_dist=Math::min(min_dist, dist);
+			}
+			s[j]=0.5*std::sqrt(min_dist);
+		}
+
+		changed=0;
+		auto rhs_mus = std::make_shared<DenseFeatures<float64_t>>(centers.clone());
+		distance->replace_rhs(rhs_mus);
+
+#pragma omp parallel for firstprivate(lhs_size, num_centers) \
+		shared(cluster_assignments, upper, lower, s, weights_set) \
+		reduction(+:changed)
+		/* Assigment step : Assign each point to nearest cluster unless the
+		 * bounds prove the assignment unchanged */
+		for (int32_t i=0; i<lhs_size; i++)
+		{
+			const int32_t cluster_assignments_i=cluster_assignments[i];
+			float64_t bound=Math::max(s[cluster_assignments_i], lower[i]);
+
+			if (upper[i]<=bound)
+				continue;
+
+			/* tighten the upper bound before falling back to a full scan */
+			upper[i]=distance->distance(i,cluster_assignments_i);
+			if (upper[i]<=bound)
+				continue;
+
+			int32_t min_cluster=0;
+			float64_t min_dist=distance->distance(i,0);
+			float64_t second_dist=Math::INFTY;
+			for (int32_t j=1; j<num_centers; j++)
+			{
+				float64_t dist=distance->distance(i,j);
+				if (dist<min_dist)
+				{
+					second_dist=min_dist;
+					min_dist=dist;
+					min_cluster=j;
+				}
+				else if (dist<second_dist)
+					second_dist=dist;
+			}
+
+			upper[i]=min_dist;
+			lower[i]=second_dist;
+
+			if (min_cluster!=cluster_assignments_i)
+			{
+				changed++;
+#pragma omp atomic
+				++weights_set[min_cluster];
+#pragma omp atomic
+				--weights_set[cluster_assignments_i];
+
+				cluster_assignments[i] = min_cluster;
+			}
+		}
+
+		observe<SGMatrix<float64_t>>(iter, "cluster_centers");
+
+		if (iter%(max_iter/10) == 0)
+			io::info("Iteration[{}/{}]: Assignment of {} patterns changed.", iter, max_iter, changed);
+
+		if(changed==0)
+			break;
+	}
+	distance->reset_precompute();
+	distance->replace_rhs(rhs_cache);
+}
+
 bool KMeans::train_machine(std::shared_ptr<Features> data)
 {
 	initialize_training(data);
-	Lloyd_KMeans(cluster_centers, k);
+
+	bool bound_pruning=m_use_bound_pruning;
+	if (bound_pruning)
+	{
+		auto euclidean=std::dynamic_pointer_cast<EuclideanDistance>(distance);
+		if (fixed_centers || !euclidean || euclidean->get_disable_sqrt())
+		{
+			io::warn("Triangle-inequality bound pruning requires the Euclidean "
+				"distance (with sqrt enabled) and moving centers; using "
+				"standard Lloyd iterations.");
+			bound_pruning=false;
+		}
+	}
+
+	if (bound_pruning)
+		hamerly_KMeans(cluster_centers, k);
+	else
+		Lloyd_KMeans(cluster_centers, k);
 	compute_cluster_variances();
 	auto cluster_centres =
 		std::make_shared<DenseFeatures<float64_t>>(cluster_centers);
@@ -33,11 +33,17 @@ class KMeansBase;
  *
  * Beware that this algorithm obtains only a <em>local</em> optimum.
  *
- * To use mini-batch based training was see KMeansMiniBatch 
+ * To use mini-batch based training was see KMeansMiniBatch
+ *
+ * With set_use_bound_pruning(true) the Lloyd iterations maintain
+ * Hamerly-style per-point upper/lower distance bounds and skip the
+ * distance computations of points whose assignment provably cannot
+ * change. This requires the Euclidean distance and moving centers.
  *
  * cf. http://en.wikipedia.org/wiki/K-means_algorithm
  * cf. http://en.wikipedia.org/wiki/Lloyd's_algorithm
  *
+ * cf. Greg Hamerly. Making k-means even faster. SDM 2010.
  *
  */
 class KMeans : public KMeansBase
@@ -65,7 +71,27 @@ class KMeans : public KMeansBase
 		~KMeans() override;
 
 		/** @return object name */
-		const char* get_name() const override { return "KMeans"; }		
+		const char* get_name() const override { return "KMeans"; }
+
+		/** set whether to prune distance computations with
+		 * triangle-inequality bounds
+		 *
+		 * @param bound_pruning true to maintain per-point distance bounds
+		 */
+		void set_use_bound_pruning(bool bound_pruning)
+		{
+			m_use_bound_pruning = bound_pruning;
+		}
+
+		/** get whether distance computations are pruned with
+		 * triangle-inequality bounds
+		 *
+		 * @return whether per-point distance bounds are maintained
+		 */
+		bool get_use_bound_pruning() const
+		{
+			return m_use_bound_pruning;
+		}
 
 	private:
 
@@ -82,6 +108,22 @@ class KMeans : public KMeansBase
 		/** Lloyd's KMeans training method
 		 */
 		void Lloyd_KMeans(SGMatrix<float64_t> centers, int32_t num_centers);
+
+		/** Lloyd iterations with Hamerly's triangle-inequality bounds:
+		 * per point an upper bound on the distance to its center and a
+		 * lower bound on the distance to the second closest center are
+		 * maintained, and points whose bounds prove the assignment
+		 * unchanged skip all distance computations
+		 */
+		void hamerly_KMeans(SGMatrix<float64_t> centers, int32_t num_centers);
+
+		/** initialize parameters */
+		void init();
+
+	private:
+		/** whether to prune distance computations with triangle-inequality
+		 * bounds */
+		bool m_use_bound_pruning;
 };
 }
 #endif
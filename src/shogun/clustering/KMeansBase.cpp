@@ -16,6 +16,7 @@
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <utility>
+#include <vector>
 
 using namespace shogun;
 using namespace Eigen;
@@ -59,6 +60,123 @@ void KMeansBase::set_initial_centers(SGMatrix<float64_t> centers)
 	initial_centers = centers;
 }
 
+void KMeansBase::set_warm_start(bool warm_start_)
+{
+	warm_start=warm_start_;
+}
+
+bool KMeansBase::get_warm_start() const
+{
+	return warm_start;
+}
+
+void KMeansBase::count_cluster_assignments()
+{
+	auto lhs=distance->get_lhs()->as<DenseFeatures<float64_t>>();
+	require(lhs, "Lhs features of distance not provided");
+
+	auto rhs_mus=std::make_shared<DenseFeatures<float64_t>>(cluster_centers);
+	auto rhs_cache=distance->replace_rhs(rhs_mus);
+	int32_t num=lhs->get_num_vectors();
+
+	cluster_counts=SGVector<float64_t>(k);
+	cluster_counts.zero();
+
+	for (int32_t i=0; i<num; i++)
+	{
+		int32_t min_cluster=0;
+		float64_t min_dist=distance->distance(i, 0);
+		for (int32_t j=1; j<k; j++)
+		{
+			float64_t dist=distance->distance(i, j);
+			if (dist<min_dist)
+			{
+				min_dist=dist;
+				min_cluster=j;
+			}
+		}
+		cluster_counts[min_cluster]+=1;
+	}
+
+	distance->replace_rhs(rhs_cache);
+}
+
+void KMeansBase::apply_delta(const std::shared_ptr<Features>& delta, int32_t sign)
+{
+	auto feats=delta->as<DenseFeatures<float64_t>>();
+	require(feats, "Delta features must be DenseFeatures<float64_t>");
+	require(feats->get_num_features()==dimensions,
+		"Delta features have dimension {}, expected {}",
+		feats->get_num_features(), dimensions);
+
+	auto rhs_mus=std::make_shared<DenseFeatures<float64_t>>(cluster_centers);
+	auto lhs_cache=distance->replace_lhs(feats);
+	auto rhs_cache=distance->replace_rhs(rhs_mus);
+	int32_t num=feats->get_num_vectors();
+
+	for (int32_t i=0; i<num; i++)
+	{
+		int32_t min_cluster=0;
+		float64_t min_dist=distance->distance(i, 0);
+		for (int32_t j=1; j<k; j++)
+		{
+			float64_t dist=distance->distance(i, j);
+			if (dist<min_dist)
+			{
+				min_dist=dist;
+				min_cluster=j;
+			}
+		}
+
+		float64_t* c=cluster_centers.get_column_vector(min_cluster);
+		SGVector<float64_t> x=feats->get_feature_vector(i);
+
+		if (sign>0)
+		{
+			float64_t total=cluster_counts[min_cluster]+1;
+			for (int32_t d=0; d<dimensions; d++)
+				c[d]+=(x[d]-c[d])/total;
+			cluster_counts[min_cluster]=total;
+		}
+		else if (cluster_counts[min_cluster]>1)
+		{
+			float64_t v=cluster_counts[min_cluster];
+			for (int32_t d=0; d<dimensions; d++)
+				c[d]=(v*c[d]-x[d])/(v-1);
+			cluster_counts[min_cluster]=v-1;
+		}
+		else
+		{
+			io::warn("Cannot remove the last point of cluster {}, "
+				"leaving its center untouched", min_cluster);
+		}
+
+		feats->free_feature_vector(x, i);
+	}
+
+	distance->replace_lhs(lhs_cache);
+	distance->replace_rhs(rhs_cache);
+}
+
+void KMeansBase::refit_delta(const std::shared_ptr<Features>& added,
+	const std::shared_ptr<Features>& removed)
+{
+	require(cluster_centers.matrix && cluster_centers.num_cols==k,
+		"No trained cluster centers to refit, call train() first");
+	require(distance, "Distance is not provided");
+
+	/* bootstrap the per-center counts once after a batch fit */
+	if (cluster_counts.vlen!=k)
+		count_cluster_assignments();
+
+	if (removed)
+		apply_delta(removed, -1);
+	if (added)
+		apply_delta(added, +1);
+
+	compute_cluster_variances();
+}
+
 void KMeansBase::set_random_centers()
 {
 	cluster_centers.zero();
@@ -158,11 +276,26 @@ void KMeansBase::initialize_training(const std::shared_ptr<Features>& data)
 	require(lhs_size>0, "Lhs features should not be empty");
 	require(dimensions>0, "Lhs features should have more than zero dimensions");
 
-	/* if kmeans++ to be used */
-	if (use_kmeanspp)
+	/* warm start: the previous fit seeds this one; cloned since
+	 * training mutates the centers in place */
+	if (warm_start && cluster_centers.matrix &&
+		cluster_centers.num_rows==dimensions && cluster_centers.num_cols==k)
+	{
+		R=SGVector<float64_t>(k);
+		cluster_counts=SGVector<float64_t>();
+		cluster_centers=cluster_centers.clone();
+		observe<SGMatrix<float64_t>>(0, "cluster_centers");
+		return;
+	}
+
+	/* if k-means|| or kmeans++ to be used */
+	if (use_kmeans_parallel)
+		initial_centers = kmeans_parallel();
+	else if (use_kmeanspp)
 		initial_centers = kmeanspp();
 
 	R=SGVector<float64_t>(k);
+	cluster_counts=SGVector<float64_t>();
 
 	cluster_centers = SGMatrix<float64_t>(dimensions, k);
 
@@ -292,6 +425,182 @@ SGMatrix<float64_t> KMeansBase::kmeanspp()
 	return centers;
 }
 
+SGMatrix<float64_t> KMeansBase::kmeans_parallel()
+{
+	auto lhs=distance->get_lhs()->as<DenseFeatures<float64_t>>();
+	int32_t lhs_size=lhs->get_num_vectors();
+
+	distance->precompute_lhs();
+	distance->precompute_rhs();
+
+	UniformIntDistribution<int32_t> uniform_int_dist(0, lhs_size-1);
+	UniformRealDistribution<float64_t> uniform_real_dist(0.0, 1.0);
+
+	/* the candidate set starts from one uniformly drawn point; candidates
+	 * stay indices into the data throughout */
+	std::vector<int32_t> candidates;
+	candidates.push_back(uniform_int_dist(m_prng));
+
+	SGVector<float64_t> min_dist=SGVector<float64_t>(lhs_size);
+	SGVector<int32_t> nearest=SGVector<int32_t>(lhs_size);
+	nearest.zero();
+
+	const int32_t first=candidates[0];
+#pragma omp parallel for \
+	default(none) shared(min_dist, first, lhs_size) \
+	schedule(static, CPU_CACHE_LINE_SIZE_BYTES)
+	for(int32_t i=0; i<lhs_size; i++)
+		min_dist[i]=Math::sq(distance->distance(i, first));
+
+#ifdef HAVE_LINALG
+	float64_t sum=linalg::vector_sum(min_dist);
+#else //HAVE_LINALG
+	Eigen::Map<VectorXd> eigen_min_dist(min_dist.vector, min_dist.vlen);
+	float64_t sum=eigen_min_dist.sum();
+#endif //HAVE_LINALG
+
+	/* a handful of oversampling rounds replaces the k sequential passes:
+	 * each round samples points independently with probability
+	 * min(1, l*d^2/phi) and one parallel pass refreshes the distances */
+	const float64_t oversampling=2.0*k;
+	const int32_t rounds=5;
+
+	for (int32_t r=0; r<rounds && sum>0; r++)
+	{
+		std::vector<int32_t> sampled;
+		for (int32_t i=0; i<lhs_size; i++)
+		{
+			if (uniform_real_dist(m_prng)*sum < oversampling*min_dist[i])
+				sampled.push_back(i);
+		}
+
+		int32_t num_sampled=(int32_t)sampled.size();
+		if (num_sampled==0)
+			continue;
+
+		int32_t offset=(int32_t)candidates.size();
+#pragma omp parallel for \
+	default(none) shared(min_dist, nearest, sampled, num_sampled, offset, lhs_size) \
+	schedule(static, CPU_CACHE_LINE_SIZE_BYTES)
+		for(int32_t i=0; i<lhs_size; i++)
+		{
+			for (int32_t c=0; c<num_sampled; c++)
+			{
+				float64_t dist=Math::sq(distance->distance(i, sampled[c]));
+				if (dist<min_dist[i])
+				{
+					min_dist[i]=dist;
+					nearest[i]=offset+c;
+				}
+			}
+		}
+
+		candidates.insert(candidates.end(), sampled.begin(), sampled.end());
+
+#ifdef HAVE_LINALG
+		sum=linalg::vector_sum(min_dist);
+#else //HAVE_LINALG
+		Eigen::Map<VectorXd> eigen_sum(min_dist.vector, min_dist.vlen);
+		sum=eigen_sum.sum();
+#endif //HAVE_LINALG
+	}
+
+	int32_t num_candidates=(int32_t)candidates.size();
+
+	/* too few candidates: pad with uniformly drawn points and let the
+	 * reclustering sort out duplicates */
+	while (num_candidates<k)
+	{
+		candidates.push_back(uniform_int_dist(m_prng));
+		num_candidates++;
+	}
+
+	/* weight each candidate by the points it is closest to */
+	SGVector<float64_t> weights=SGVector<float64_t>(num_candidates);
+	weights.zero();
+	for (int32_t i=0; i<lhs_size; i++)
+		weights[nearest[i]]+=1.0;
+
+	/* recluster the weighted candidates to k centers with k-means++;
+	 * the candidate set is small, so this runs over candidates only */
+	SGVector<float64_t> cand_dist=SGVector<float64_t>(num_candidates);
+	SGVector<int32_t> chosen=SGVector<int32_t>(k);
+
+	float64_t weight_sum=0;
+	for (int32_t c=0; c<num_candidates; c++)
+		weight_sum+=weights[c];
+
+	float64_t prob=uniform_real_dist(m_prng)*weight_sum;
+	chosen[0]=num_candidates-1;
+	for (int32_t c=0; c<num_candidates; c++)
+	{
+		prob-=weights[c];
+		if (prob<=0)
+		{
+			chosen[0]=c;
+			break;
+		}
+	}
+
+	const int32_t chosen_first=candidates[chosen[0]];
+#pragma omp parallel for \
+	default(none) shared(cand_dist, candidates, chosen_first, num_candidates) \
+	schedule(static, CPU_CACHE_LINE_SIZE_BYTES)
+	for (int32_t c=0; c<num_candidates; c++)
+		cand_dist[c]=Math::sq(distance->distance(candidates[c], chosen_first));
+
+	for (int32_t i=1; i<k; i++)
+	{
+		float64_t potential=0;
+		for (int32_t c=0; c<num_candidates; c++)
+			potential+=weights[c]*cand_dist[c];
+
+		int32_t new_chosen;
+		if (potential>0)
+		{
+			prob=uniform_real_dist(m_prng)*potential;
+			new_chosen=num_candidates-1;
+			for (int32_t c=0; c<num_candidates; c++)
+			{
+				prob-=weights[c]*cand_dist[c];
+				if (prob<=0)
+				{
+					new_chosen=c;
+					break;
+				}
+			}
+		}
+		else
+			new_chosen=uniform_int_dist(m_prng)%num_candidates;
+
+		chosen[i]=new_chosen;
+
+		const int32_t chosen_idx=candidates[new_chosen];
+#pragma omp parallel for \
+	default(none) shared(cand_dist, candidates, chosen_idx, num_candidates) \
+	schedule(static, CPU_CACHE_LINE_SIZE_BYTES)
+		for (int32_t c=0; c<num_candidates; c++)
+		{
+			float64_t dist=Math::sq(distance->distance(candidates[c], chosen_idx));
+			if (dist<cand_dist[c])
+				cand_dist[c]=dist;
+		}
+	}
+
+	distance->reset_precompute();
+
+	SGMatrix<float64_t> centers=SGMatrix<float64_t>(dimensions, k);
+	for (int32_t i=0; i<k; i++)
+	{
+		SGVector<float64_t> vec=lhs->get_feature_vector(candidates[chosen[i]]);
+		for(int32_t j=0; j<dimensions; j++)
+			centers(j, i)=vec[j];
+		lhs->free_feature_vector(vec, candidates[chosen[i]]);
+	}
+
+	return centers;
+}
+
 void KMeansBase::init()
 {
 	max_iter = 300;
@@ -299,6 +608,8 @@ void KMeansBase::init()
 	dimensions = 0;
 	fixed_centers = false;
 	use_kmeanspp = false;
+	use_kmeans_parallel = false;
+	warm_start = false;
 	initial_centers = SGMatrix<float64_t>();
 	SG_ADD(
 	    &max_iter, "max_iter", "Maximum number of iterations",
@@ -317,6 +628,18 @@ void KMeansBase::init()
 	SG_ADD(
 	    &use_kmeanspp, "kmeanspp", "Whether to use kmeans++",
 	    ParameterProperties::HYPER | ParameterProperties::SETTING);
+	SG_ADD(
+	    &use_kmeans_parallel, "kmeans_parallel",
+	    "Whether to use k-means|| seeding",
+	    ParameterProperties::HYPER | ParameterProperties::SETTING);
+	SG_ADD(
+	    &warm_start, "warm_start",
+	    "Whether to seed training from the previous fit",
+	    ParameterProperties::HYPER | ParameterProperties::SETTING);
+	SG_ADD(
+	    &cluster_counts, "cluster_counts",
+	    "Number of points assigned per cluster",
+	    ParameterProperties::MODEL);
 	watch_method("cluster_centers", &KMeansBase::get_cluster_centers);
 	SG_ADD(
 	    &initial_centers, "initial_centers", "Initial centers",
@@ -85,6 +85,38 @@ class KMeansBase : public RandomMixin<DistanceMachine>
 		 */
 		virtual void set_initial_centers(SGMatrix<float64_t> centers);
 
+		/** set whether train() is warm-started: when enabled and the
+		 * machine already holds centers of matching shape from a
+		 * previous fit, those seed the next fit instead of a fresh
+		 * random/kmeans++ initialization, so periodic refits of slowly
+		 * drifting data converge in a few iterations
+		 *
+		 * @param warm_start true to seed training from the previous fit
+		 */
+		virtual void set_warm_start(bool warm_start);
+
+		/** @return whether training is warm-started from the previous fit */
+		virtual bool get_warm_start() const;
+
+		/** incrementally refit trained centers on a delta set of points
+		 * instead of retraining from scratch: each added point pulls its
+		 * nearest center towards it by a running-mean step, each removed
+		 * point is subtracted from the running mean of its nearest
+		 * center, and per-center assignment counts are kept up to date,
+		 * so the cost is bounded by the delta size instead of the full
+		 * data set
+		 *
+		 * the first call after a fresh fit pays one counting pass over
+		 * the training features still attached to the distance; callers
+		 * that need the exact batch optimum can follow up with a
+		 * warm-started train() on the full data
+		 *
+		 * @param added features with one column per added point, or NULL
+		 * @param removed features with one column per removed point, or NULL
+		 */
+		virtual void refit_delta(const std::shared_ptr<Features>& added,
+			const std::shared_ptr<Features>& removed=NULL);
+
 		bool train_require_labels() const override
 		{
 			return false;
@@ -100,6 +132,18 @@ class KMeansBase : public RandomMixin<DistanceMachine>
 		*/
 		SGMatrix<float64_t> kmeanspp();
 
+		/** k-means|| algorithm to initialize cluster centers: instead of
+		* k sequential full-data passes, a few rounds independently
+		* oversample candidates with probability proportional to their
+		* squared distance to the candidate set, then the weighted
+		* candidates are reclustered to k centers with k-means++
+		*
+		* cf. Bahmani et al. Scalable K-Means++. VLDB 2012.
+		*
+		* @return initial cluster centers: matrix (k columns, dim rows)
+		*/
+		SGMatrix<float64_t> kmeans_parallel();
+
 		/**
 		 * Init the model (register params)
 		 */
@@ -113,6 +157,19 @@ class KMeansBase : public RandomMixin<DistanceMachine>
 
 		void compute_cluster_variances();
 
+		/** count the nearest-center assignments of the features attached
+		* to the distance into cluster_counts; used to bootstrap delta
+		* refits after a batch fit
+		*/
+		void count_cluster_assignments();
+
+		/** apply one side of a delta refit
+		*
+		* @param delta points to fold in or out, one per column
+		* @param sign +1 for added points, -1 for removed points
+		*/
+		void apply_delta(const std::shared_ptr<Features>& delta, int32_t sign);
+
 	protected:
 		/** Maximum number of iterations */
 		int32_t max_iter;
@@ -135,8 +192,18 @@ class KMeansBase : public RandomMixin<DistanceMachine>
 		/** Flag to check if kmeans++ has to be used */
 		bool use_kmeanspp;
 
+		/** Flag to check if k-means|| seeding has to be used */
+		bool use_kmeans_parallel;
+
+		/** Flag to seed training from the previous fit */
+		bool warm_start;
+
 		/** Cluster centers */
 		SGMatrix<float64_t> cluster_centers;
+
+		/** Number of points assigned per cluster, maintained by delta
+		 * refits (size k) */
+		SGVector<float64_t> cluster_counts;
 };
 }
 #endif
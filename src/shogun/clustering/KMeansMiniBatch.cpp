@@ -7,7 +7,9 @@
 #include <shogun/base/progress.h>
 #include <shogun/clustering/KMeansMiniBatch.h>
 #include <shogun/distance/Distance.h>
+#include <shogun/distance/EuclideanDistance.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/lib/observers/ObservedValueTemplated.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
@@ -60,29 +62,52 @@ void KMeansMiniBatch::minibatch_KMeans()
 	int32_t XSize=lhs->get_num_vectors();
 	int32_t dims=lhs->get_num_features();
 
+	/* squared Euclidean distances decompose into norms and dot products,
+	 * so the whole minibatch is then assigned with one matrix product
+	 * against the centers instead of per-point per-center scalar loops */
+	bool blocked_assignment=
+		std::dynamic_pointer_cast<EuclideanDistance>(distance)!=nullptr;
+
 	SGVector<float64_t> v=SGVector<float64_t>(k);
 	v.zero();
 
+	SGMatrix<float64_t> batch_feats(dims, batch_size);
+
 	for (auto i : SG_PROGRESS(range(max_iter)))
 	{
 		SGVector<int32_t> M=mbchoose_rand(batch_size,XSize);
 		SGVector<int32_t> ncent=SGVector<int32_t>(batch_size);
+
+		/* gather the minibatch into one contiguous tile; assignment and
+		 * accumulation both run off it */
 		for (int32_t j=0; j<batch_size; j++)
 		{
-			SGVector<float64_t> dists=SGVector<float64_t>(k);
-			for (int32_t p=0; p<k; p++)
-				dists[p]=distance->distance(M[j],p);
-			ncent[j] = Math::arg_min(dists.vector, 1, dists.vlen);
+			SGVector<float64_t> x=lhs->get_feature_vector(M[j]);
+			sg_memcpy(batch_feats.get_column_vector(j), x.vector,
+				dims*sizeof(float64_t));
+			lhs->free_feature_vector(x, M[j]);
 		}
-		for (int32_t j=0; j<batch_size; j++)
+
+		SGMatrix<float64_t> centers=rhs_mus->get_feature_matrix();
+
+		if (blocked_assignment)
 		{
-			int32_t near=ncent[j];
-			SGVector<float64_t> c_alive=rhs_mus->get_feature_vector(near);
-			SGVector<float64_t> x=lhs->get_feature_vector(M[j]);
-			v[near]+=1.0;
-			float64_t eta=1.0/v[near];
-			linalg::add(c_alive, x, c_alive, 1.0 - eta, eta);
+			minibatch_assign(centers, batch_feats, batch_size, ncent);
 		}
+		else
+		{
+			#pragma omp parallel for
+			for (int32_t j=0; j<batch_size; j++)
+			{
+				SGVector<float64_t> dists=SGVector<float64_t>(k);
+				for (int32_t p=0; p<k; p++)
+					dists[p]=distance->distance(M[j],p);
+				ncent[j] = Math::arg_min(dists.vector, 1, dists.vlen);
+			}
+		}
+
+		minibatch_update(centers, batch_feats, batch_size, ncent, v);
+
 		cluster_centers = rhs_mus->get_feature_matrix();
 		observe<SGMatrix<float64_t>>(i, "cluster_centers");
 	}
@@ -90,6 +115,194 @@ void KMeansMiniBatch::minibatch_KMeans()
 	distance->replace_rhs(rhs_cache);
 }
 
+void KMeansMiniBatch::minibatch_assign(const SGMatrix<float64_t>& centers,
+	const SGMatrix<float64_t>& chunk, int32_t num, SGVector<int32_t>& ncent)
+{
+	int32_t dims=centers.num_rows;
+	SGVector<float64_t> center_norms(k);
+
+	#pragma omp parallel for
+	for (int32_t p=0; p<k; p++)
+	{
+		const float64_t* c=centers.get_column_vector(p);
+		float64_t norm=0;
+		for (int32_t d=0; d<dims; d++)
+			norm+=c[d]*c[d];
+		center_norms[p]=norm;
+	}
+
+	SGMatrix<float64_t> batch(chunk.matrix, dims, num, false);
+	SGMatrix<float64_t> scores=
+		linalg::matrix_prod(centers, batch, true, false);
+
+	/* ||x||^2 is constant per point and drops out of the argmin */
+	#pragma omp parallel for
+	for (int32_t j=0; j<num; j++)
+	{
+		int32_t near=0;
+		float64_t min_dist=center_norms[0]-2*scores(0,j);
+		for (int32_t p=1; p<k; p++)
+		{
+			float64_t dist=center_norms[p]-2*scores(p,j);
+			if (dist<min_dist)
+			{
+				min_dist=dist;
+				near=p;
+			}
+		}
+		ncent[j]=near;
+	}
+}
+
+void KMeansMiniBatch::minibatch_update(SGMatrix<float64_t>& centers,
+	const SGMatrix<float64_t>& chunk, int32_t num,
+	const SGVector<int32_t>& ncent, SGVector<float64_t>& v)
+{
+	int32_t dims=centers.num_rows;
+
+	/* the sequential running-mean updates of one center commute, so
+	 * per-thread partial sums and counts are accumulated and each
+	 * center is moved once per minibatch */
+	SGMatrix<float64_t> batch_sums(dims, k);
+	SGVector<int64_t> batch_counts(k);
+	batch_sums.zero();
+	batch_counts.zero();
+	#pragma omp parallel
+	{
+		SGMatrix<float64_t> local_sums(dims, k);
+		SGVector<int64_t> local_counts(k);
+		local_sums.zero();
+		local_counts.zero();
+
+		#pragma omp for nowait
+		for (int32_t j=0; j<num; j++)
+		{
+			const float64_t* src=chunk.get_column_vector(j);
+			float64_t* dst=local_sums.get_column_vector(ncent[j]);
+			for (int32_t d=0; d<dims; d++)
+				dst[d]+=src[d];
+			local_counts[ncent[j]]++;
+		}
+
+		#pragma omp critical(shogun_minibatch_kmeans_update)
+		{
+			for (int32_t p=0; p<k; p++)
+			{
+				if (local_counts[p]==0)
+					continue;
+
+				const float64_t* src=local_sums.get_column_vector(p);
+				float64_t* dst=batch_sums.get_column_vector(p);
+				for (int32_t d=0; d<dims; d++)
+					dst[d]+=src[d];
+				batch_counts[p]+=local_counts[p];
+			}
+		}
+	}
+
+	for (int32_t p=0; p<k; p++)
+	{
+		if (batch_counts[p]==0)
+			continue;
+
+		float64_t* c_alive=centers.get_column_vector(p);
+		float64_t total=v[p]+batch_counts[p];
+		for (int32_t d=0; d<dims; d++)
+			c_alive[d]=(v[p]*c_alive[d]+batch_sums(d,p))/total;
+		v[p]=total;
+	}
+}
+
+void KMeansMiniBatch::train_on_stream(const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream)
+{
+	require(stream, "No streaming features supplied");
+	require(batch_size>0,
+		"batch size not set to positive value. Current batch size {} ", batch_size);
+	require(std::dynamic_pointer_cast<EuclideanDistance>(distance),
+		"Streaming minibatch training assigns examples with Euclidean "
+		"distance; set an EuclideanDistance instance");
+	require(initial_centers.matrix || batch_size>=k,
+		"Without initial centers the first chunk seeds them, so batch size "
+		"({}) may not be smaller than k ({})", batch_size, k);
+
+	SGMatrix<float64_t> centers;
+	SGVector<float64_t> v(k);
+	v.zero();
+
+	int32_t dims=0;
+	if (initial_centers.matrix)
+	{
+		centers=initial_centers.clone();
+		dims=initial_centers.num_rows;
+	}
+
+	SGMatrix<float64_t> chunk;
+	SGVector<int32_t> ncent(batch_size);
+	int32_t filled=0;
+	int64_t num_seen=0;
+
+	stream->start_parser();
+	while (stream->get_next_example())
+	{
+		SGVector<float64_t> x=stream->get_vector();
+		if (dims==0)
+			dims=x.vlen;
+		require(x.vlen==dims,
+			"Streamed example has dimension {}, expected {}", x.vlen, dims);
+		if (!chunk.matrix)
+			chunk=SGMatrix<float64_t>(dims, batch_size);
+
+		sg_memcpy(chunk.get_column_vector(filled), x.vector,
+			dims*sizeof(float64_t));
+		filled++;
+		num_seen++;
+		stream->release_example();
+
+		if (filled<batch_size)
+			continue;
+
+		if (!centers.matrix)
+		{
+			/* no initial centers supplied: the first k streamed
+			 * examples seed them */
+			centers=SGMatrix<float64_t>(dims, k);
+			sg_memcpy(centers.matrix, chunk.matrix,
+				dims*k*sizeof(float64_t));
+		}
+
+		minibatch_assign(centers, chunk, filled, ncent);
+		minibatch_update(centers, chunk, filled, ncent, v);
+		filled=0;
+	}
+	stream->end_parser();
+
+	require(num_seen>0, "Stream contained no examples");
+
+	if (filled>0)
+	{
+		if (!centers.matrix)
+		{
+			require(filled>=k,
+				"Stream ended after {} examples, need at least k ({}) "
+				"to seed centers", filled, k);
+			centers=SGMatrix<float64_t>(dims, k);
+			sg_memcpy(centers.matrix, chunk.matrix,
+				dims*k*sizeof(float64_t));
+		}
+
+		minibatch_assign(centers, chunk, filled, ncent);
+		minibatch_update(centers, chunk, filled, ncent, v);
+	}
+
+	dimensions=dims;
+	cluster_centers=centers;
+
+	/* cluster radii would need a second pass over the data, which an
+	 * out-of-core stream cannot provide */
+	R=SGVector<float64_t>(k);
+	R.zero();
+}
+
 SGVector<int32_t> KMeansMiniBatch::mbchoose_rand(int32_t b, int32_t num)
 {
 	SGVector<int32_t> chosen=SGVector<int32_t>(num);
@@ -18,7 +18,8 @@
 namespace shogun
 {
 class KMeansBase;
-	
+template <class T> class StreamingDenseFeatures;
+
 /** Class for the mini batch KMeans */
 class KMeansMiniBatch : public KMeansBase
 {
@@ -49,6 +50,19 @@ class KMeansMiniBatch : public KMeansBase
 			return "KMeansMiniBatch";
 		}
 
+		/** out-of-core training over streaming features: one pass over
+		 * the stream, consuming batch_size examples at a time and moving
+		 * the centers with the usual minibatch running-mean update, so
+		 * the data never has to fit in memory at once
+		 *
+		 * assignment is done with Euclidean distance, so the configured
+		 * distance must be an EuclideanDistance instance; if no initial
+		 * centers were supplied, the first k streamed examples seed them
+		 *
+		 * @param stream streaming dense features to cluster
+		 */
+		void train_on_stream(const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream);
+
 	protected:
 
 		/** train k-means
@@ -65,6 +79,30 @@ class KMeansMiniBatch : public KMeansBase
 		 */
 		void minibatch_KMeans();
 
+		/** assign a chunk of examples to their nearest centers with the
+		 * blocked squared-Euclidean argmin
+		 *
+		 * @param centers current centers (dims rows, k columns)
+		 * @param chunk gathered examples, one per column
+		 * @param num number of valid columns in chunk
+		 * @param ncent nearest center index per example (output)
+		 */
+		void minibatch_assign(const SGMatrix<float64_t>& centers,
+			const SGMatrix<float64_t>& chunk, int32_t num,
+			SGVector<int32_t>& ncent);
+
+		/** move the centers by the running-mean minibatch update
+		 *
+		 * @param centers current centers, updated in place
+		 * @param chunk gathered examples, one per column
+		 * @param num number of valid columns in chunk
+		 * @param ncent nearest center index per example
+		 * @param v per-center example counts, updated in place
+		 */
+		void minibatch_update(SGMatrix<float64_t>& centers,
+			const SGMatrix<float64_t>& chunk, int32_t num,
+			const SGVector<int32_t>& ncent, SGVector<float64_t>& v);
+
 	private:
 
 		void init_mb_params();
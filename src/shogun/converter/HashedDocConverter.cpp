@@ -81,6 +81,9 @@ std::shared_ptr<Features> HashedDocConverter::transform(std::shared_ptr<Features
 
 	int32_t dim = Math::pow(2, num_bits);
 	SGSparseMatrix<float64_t> matrix(dim,features->get_num_vectors());
+	// documents are converted independently, each one writing its own
+	// sparse row; apply() only touches a local tokenizer copy
+#pragma omp parallel for
 	for (index_t vec_idx=0; vec_idx<s_features->get_num_vectors(); vec_idx++)
 	{
 		SGVector<char> doc = s_features->get_feature_vector(vec_idx);
@@ -94,10 +97,30 @@ std::shared_ptr<Features> HashedDocConverter::transform(std::shared_ptr<Features
 SGSparseVector<float64_t> HashedDocConverter::apply(SGVector<char> document)
 {
 	ASSERT(document.size()>0)
-	const int32_t array_size = 1024*1024;
-	/** the array will contain all the hashes generated from the tokens */
+
+	/** work on a local tokenizer copy, so that documents can be
+	 * converted concurrently */
+	std::shared_ptr<Tokenizer> local_tzer(tokenizer->get_copy());
+
+	/** first pass: count the tokens to reserve the exact number of
+	 * hashes up-front instead of growing the array while emitting */
+	local_tzer->set_text(document);
+	index_t token_start = 0;
+	int64_t num_tokens = 0;
+	while (local_tzer->has_next())
+	{
+		local_tzer->next_token_idx(token_start);
+		num_tokens++;
+	}
+
+	/** the combinations generated from the current active tokens will be
+	 * stored here to avoid creating new objects */
+	SGVector<index_t> ngram_indices((ngrams-1)*(tokens_to_skip+1) + 1);
+
+	/** the array will contain all the hashes generated from the tokens;
+	 * every token emits at most ngram_indices.vlen hashes */
 	std::vector<uint32_t> hashed_indices;
-	hashed_indices.reserve(array_size);
+	hashed_indices.reserve(num_tokens*ngram_indices.vlen);
 
 	/** this vector will maintain the current n+k active tokens
 	 * in a circular manner */
@@ -106,26 +129,21 @@ SGSparseVector<float64_t> HashedDocConverter::apply(SGVector<char> document)
 	index_t hashes_end = 0;
 	int32_t len = cached_hashes.vlen - 1;
 
-	/** the combinations generated from the current active tokens will be
-	 * stored here to avoid creating new objects */
-	SGVector<index_t> ngram_indices((ngrams-1)*(tokens_to_skip+1) + 1);
-
 	/** Reading n+s-1 tokens */
 	const int32_t seed = 0xdeadbeaf;
-	tokenizer->set_text(document);
-	index_t token_start = 0;
-	while (hashes_end<ngrams-1+tokens_to_skip && tokenizer->has_next())
+	local_tzer->set_text(document);
+	while (hashes_end<ngrams-1+tokens_to_skip && local_tzer->has_next())
 	{
-		index_t end = tokenizer->next_token_idx(token_start);
+		index_t end = local_tzer->next_token_idx(token_start);
 		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &document.vector[token_start],
 				end-token_start, seed);
 		cached_hashes[hashes_end++] = token_hash;
 	}
 
 	/** Reading token and storing index to hashed_indices */
-	while (tokenizer->has_next())
+	while (local_tzer->has_next())
 	{
-		index_t end = tokenizer->next_token_idx(token_start);
+		index_t end = local_tzer->next_token_idx(token_start);
 		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &document.vector[token_start],
 				end-token_start, seed);
 		cached_hashes[hashes_end] = token_hash;
@@ -22,7 +22,7 @@ TDistributedStochasticNeighborEmbedding::TDistributedStochasticNeighborEmbedding
 void TDistributedStochasticNeighborEmbedding::init()
 {
 	SG_ADD(&m_perplexity, "perplexity", "perplexity");
-	SG_ADD(&m_theta, "theta", "learning rate");
+	SG_ADD(&m_theta, "theta", "Barnes-Hut tradeoff parameter, 0 for exact t-SNE");
 }
 
 TDistributedStochasticNeighborEmbedding::~TDistributedStochasticNeighborEmbedding()
@@ -36,7 +36,8 @@ const char* TDistributedStochasticNeighborEmbedding::get_name() const
 
 void TDistributedStochasticNeighborEmbedding::set_theta(const float64_t theta)
 {
-
+	require(theta >= 0.0, "Theta must be non-negative, 0 selects the "
+			"exact algorithm");
 	m_theta = theta;
 }
 
@@ -18,7 +18,10 @@ namespace shogun
  * data using t-distributed stochastic neighbor embedding algorithm:
  * http://jmlr.csail.mit.edu/papers/volume9/vandermaaten08a/vandermaaten08a.pdf.
  *
- * Uses implementation from the Tapkee library.
+ * Uses implementation from the Tapkee library. With theta>0 (default
+ * 0.5) the gradient is approximated with the Barnes-Hut quadtree
+ * algorithm of van der Maaten, which scales to much larger sets than
+ * the exact O(n^2) computation selected by theta=0.
  *
  */
 class TDistributedStochasticNeighborEmbedding : public EmbeddingConverter
@@ -40,15 +43,18 @@ public:
 	 */
 	std::shared_ptr<Features> transform(std::shared_ptr<Features> features, bool inplace = true) override;
 
-	/** setter for the learning rate
+	/** setter for the Barnes-Hut tradeoff parameter. theta=0 runs the
+	 * exact O(n^2) algorithm; larger values summarize more distant
+	 * groups of points by their center of mass, trading accuracy for
+	 * speed (0.5 by default)
 	 *
-	 * @param theta the learning rate
+	 * @param theta the Barnes-Hut tradeoff parameter
 	 */
 	void set_theta(const float64_t theta);
 
-	/** getter for the learning rate
+	/** getter for the Barnes-Hut tradeoff parameter
 	 *
-	 * @return the learning rate theta
+	 * @return the tradeoff parameter theta
 	 */
 	float64_t get_theta() const;
 
@@ -71,7 +77,7 @@ private:
 
 private:
 
-	/** theta - learning rate */
+	/** theta - Barnes-Hut tradeoff parameter, 0 means exact t-SNE */
 	float64_t m_theta;
 
 	/** perplexity */
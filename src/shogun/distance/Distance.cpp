@@ -231,6 +231,16 @@ void Distance::run_distance_lhs(SGVector<float64_t>& result, const index_t idx_r
         result.vector[i] = this->distance(idx_start,idx_b);
 }
 
+void Distance::compute_block(int32_t row_start, int32_t num_rows,
+		int32_t col_start, int32_t num_cols, float64_t* block, int32_t ld)
+{
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		for (int32_t i=0; i<num_rows; i++)
+			block[i+int64_t(j)*ld]=distance(row_start+i, col_start+j);
+	}
+}
+
 void Distance::do_precompute_matrix()
 {
 	int32_t num_left=lhs->get_num_vectors();
@@ -285,59 +295,64 @@ SGMatrix<T> Distance::get_distance_matrix()
 
 	result=SG_MALLOC(T, total_num);
 
+	// tiled evaluation: the matrix is cut into cache-sized blocks which are
+	// handed out to threads dynamically, so threads stay balanced even when
+	// only the upper triangle of a symmetric matrix is computed. Distances
+	// with a block fast path fill whole tiles at once, all others fall back
+	// to one compute() call per element inside their tile.
+	const int32_t block_size=256;
+	int32_t num_row_blocks=(m+block_size-1)/block_size;
+	int32_t num_col_blocks=(n+block_size-1)/block_size;
+	int64_t num_blocks=int64_t(num_row_blocks)*num_col_blocks;
+
 	PRange<int64_t> pb = PRange<int64_t>(
-	    range(total_num), "PROGRESS: ", UTF8, []() { return true; });
-	int32_t num_threads;
-	int64_t step;
-	#pragma omp parallel shared(num_threads, step)
+	    range(num_blocks), "PROGRESS: ", UTF8, []() { return true; });
+
+	#pragma omp parallel
 	{
+		SGVector<float64_t> buffer(block_size*block_size);
 #ifdef HAVE_OPENMP
-		#pragma omp single
-		{
-			num_threads=omp_get_num_threads();
-			step=total_num/num_threads;
-			num_threads--;
-		}
-		int32_t thread_num=omp_get_thread_num();
+		bool verbose=(omp_get_thread_num() == 0);
 #else
-		num_threads=0;
-		step=total_num;
-		int32_t thread_num=0;
+		bool verbose=true;
 #endif
-		bool verbose=(thread_num == 0);
 
-		int32_t start=compute_row_start(thread_num*step, n, symmetric);
-		int32_t end=(thread_num==num_threads) ? m : compute_row_start((thread_num+1)*step, n, symmetric);
-
-		for (int32_t i=start; i<end; i++)
+		#pragma omp for schedule(dynamic)
+		for (int64_t b=0; b<num_blocks; b++)
 		{
-			int32_t j_start=0;
+			int32_t bi=b%num_row_blocks;
+			int32_t bj=b/num_row_blocks;
 
-			if (symmetric)
-				j_start=i;
+			// for symmetric matrices only the upper block triangle is
+			// computed, the lower one is mirrored below
+			if (symmetric && bj<bi)
+				continue;
 
-			for (int32_t j=j_start; j<n; j++)
-			{
-				float64_t v=this->distance(i,j);
-				result[i+j*m]=v;
+			int32_t row_start=bi*block_size;
+			int32_t col_start=bj*block_size;
+			int32_t rows=Math::min(block_size, m-row_start);
+			int32_t cols=Math::min(block_size, n-col_start);
 
-				if (symmetric && i!=j)
-					result[j+i*m]=v;
+			compute_block(
+				row_start, rows, col_start, cols, buffer.vector, rows);
 
-				if (verbose)
+			for (int32_t j=0; j<cols; j++)
+			{
+				for (int32_t i=0; i<rows; i++)
 				{
-					total++;
-
-					if (symmetric && i!=j)
-						total++;
+					T v=static_cast<T>(buffer[i+int64_t(j)*rows]);
+					result[(row_start+i)+int64_t(col_start+j)*m]=v;
 
-					pb.print_progress();
-
-					// TODO: replace with new signal
-					// if (Signal::cancel_computations())
-					//	break;
+					if (symmetric && bi!=bj)
+						result[(col_start+j)+int64_t(row_start+i)*m]=v;
 				}
 			}
+
+			if (verbose)
+			{
+				total++;
+				pb.print_progress();
+			}
 		}
 	}
 	pb.complete();
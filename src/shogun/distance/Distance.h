@@ -162,24 +162,31 @@ class Distance : public SGObject
 		 */
 		template <class T> SGMatrix<T> get_distance_matrix();
 
-		/** compute row start offset for parallel kernel matrix computation
+		/** check whether the distance can compute whole blocks of the
+		 * distance matrix at once, see compute_block()
 		 *
-		 * @param offs offset
-		 * @param n number of columns
-		 * @param symmetric whether matrix is symmetric
+		 * @return whether a fast block implementation is available
 		 */
-		int32_t compute_row_start(int64_t offs, int32_t n, bool symmetric)
-		{
-			int32_t i_start;
-
-			if (symmetric)
-				i_start = (int32_t)Math::floor(
-				    n - std::sqrt(Math::sq((float64_t)n) - offs));
-			else
-				i_start=(int32_t) (offs/int64_t(n));
+		virtual bool has_block_computation() { return false; }
 
-			return i_start;
-		}
+		/** compute a rectangular block of the distance matrix
+		 *
+		 * The target block is stored column-major with leading dimension
+		 * ld. The base implementation evaluates one pair at a time;
+		 * distances that can do better (e.g. via the squared-norm plus
+		 * matrix-product identity) should override this together with
+		 * has_block_computation().
+		 *
+		 * @param row_start first lhs index of the block
+		 * @param num_rows number of lhs vectors in the block
+		 * @param col_start first rhs index of the block
+		 * @param num_cols number of rhs vectors in the block
+		 * @param block target buffer of size num_rows*num_cols at least
+		 * @param ld leading dimension of the target buffer
+		 */
+		virtual void compute_block(int32_t row_start, int32_t num_rows,
+				int32_t col_start, int32_t num_cols, float64_t* block,
+				int32_t ld);
 
 		/** init distance
 		 *
@@ -11,6 +11,7 @@
 #include <shogun/features/DotFeatures.h>
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
 
@@ -76,6 +77,63 @@ float64_t EuclideanDistance::compute(int32_t idx_a, int32_t idx_b)
 	return std::sqrt(result);
 }
 
+bool EuclideanDistance::has_block_computation()
+{
+	if (!lhs || !rhs)
+		return false;
+
+	if (lhs->get_feature_class()!=C_DENSE || rhs->get_feature_class()!=C_DENSE)
+		return false;
+
+	if (lhs->get_feature_type()!=F_DREAL || rhs->get_feature_type()!=F_DREAL)
+		return false;
+
+	if (lhs->get_subset_stack()->has_subsets() ||
+			rhs->get_subset_stack()->has_subsets())
+		return false;
+
+	return m_lhs_squared_norms.vlen==lhs->get_num_vectors() &&
+			m_rhs_squared_norms.vlen==rhs->get_num_vectors();
+}
+
+void EuclideanDistance::compute_block(int32_t row_start, int32_t num_rows,
+		int32_t col_start, int32_t num_cols, float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Distance::compute_block(
+			row_start, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	auto dense_lhs=std::static_pointer_cast<DenseFeatures<float64_t>>(lhs);
+	auto dense_rhs=std::static_pointer_cast<DenseFeatures<float64_t>>(rhs);
+
+	int32_t num_feat, num_vec_l, num_vec_r;
+	const float64_t* lhs_matrix=dense_lhs->get_feature_matrix(num_feat, num_vec_l);
+	const float64_t* rhs_matrix=dense_rhs->get_feature_matrix(num_feat, num_vec_r);
+
+	Eigen::Map<const Eigen::MatrixXd> l_map(lhs_matrix, num_feat, num_vec_l);
+	Eigen::Map<const Eigen::MatrixXd> r_map(rhs_matrix, num_feat, num_vec_r);
+	Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<>> target(
+		block, num_rows, num_cols, Eigen::OuterStride<>(ld));
+
+	// cross terms of the whole tile with a single matrix-matrix product
+	target.noalias()=l_map.middleCols(row_start, num_rows).transpose()*
+		r_map.middleCols(col_start, num_cols);
+
+	// combine with the squared norms in the same order as compute()
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		for (int32_t i=0; i<num_rows; i++)
+		{
+			float64_t v=m_lhs_squared_norms[row_start+i]+
+				m_rhs_squared_norms[col_start+j]-2*target(i, j);
+			target(i, j)=disable_sqrt ? v : std::sqrt(v);
+		}
+	}
+}
+
 void EuclideanDistance::precompute_lhs()
 {
 	require(lhs, "Left hand side feature cannot be NULL!");
@@ -130,6 +130,27 @@ public:
 	 */
 	float64_t distance_upper_bounded(int32_t idx_a, int32_t idx_b, float64_t upper_bound) override;
 
+	/** whether the block fast path is usable: requires dense real-valued
+	 * features without subsets on both sides and precomputed squared norms
+	 *
+	 * @return whether compute_block() uses the matrix-product identity
+	 */
+	bool has_block_computation() override;
+
+	/** compute a block of the distance matrix with a single matrix-matrix
+	 * product per tile via ||x||^2+||y||^2-2x.y, see Distance::compute_block
+	 *
+	 * @param row_start first lhs index of the block
+	 * @param num_rows number of lhs vectors in the block
+	 * @param col_start first rhs index of the block
+	 * @param num_cols number of rhs vectors in the block
+	 * @param block target buffer of size num_rows*num_cols at least
+	 * @param ld leading dimension of the target buffer
+	 */
+	void compute_block(int32_t row_start, int32_t num_rows,
+			int32_t col_start, int32_t num_cols, float64_t* block,
+			int32_t ld) override;
+
 	/**
 	 * Precomputation of squared norms for features of right hand side
 	 * WARNING : Make sure to reset computations using reset_precompute()
@@ -6,11 +6,132 @@
  *
  */
 #include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <shogun/distance/LevenshteinDistance.h>
 #include <shogun/features/StringFeatures.h>
 
 using namespace shogun;
 
+namespace
+{
+
+/* bit-parallel computation after Myers (1999) for patterns of up to 64
+ * characters: one word of bit operations per text character */
+int32_t levenshtein_myers(
+    const char* pattern, int32_t m, const char* text, int32_t n)
+{
+	uint64_t peq[256] = {0};
+	for (int32_t i = 0; i < m; ++i)
+		peq[static_cast<uint8_t>(pattern[i])] |= uint64_t(1) << i;
+
+	uint64_t pv = ~uint64_t(0);
+	uint64_t mv = 0;
+	const uint64_t last = uint64_t(1) << (m - 1);
+	int32_t score = m;
+
+	for (int32_t j = 0; j < n; ++j)
+	{
+		uint64_t eq = peq[static_cast<uint8_t>(text[j])];
+		uint64_t xv = eq | mv;
+		uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+		uint64_t ph = mv | ~(xh | pv);
+		uint64_t mh = pv & xh;
+
+		if (ph & last)
+			++score;
+		if (mh & last)
+			--score;
+
+		ph = (ph << 1) | 1;
+		mh <<= 1;
+		pv = mh | ~(xv | ph);
+		mv = ph & xv;
+	}
+
+	return score;
+}
+
+/* two-row dynamic program restricted to a band of width 2*band+1 around
+ * the diagonal; returns band+1 as soon as the band proves that the
+ * distance exceeds band. Cells outside the band are saturated at band+1,
+ * so a full computation is obtained by passing band>=max(m,n). */
+int32_t levenshtein_banded(
+    const char* a, int32_t m, const char* b, int32_t n, int32_t band,
+    std::vector<int32_t>& prev, std::vector<int32_t>& curr)
+{
+	const int32_t exceeded = band + 1;
+
+	if (std::abs(m - n) > band)
+		return exceeded;
+
+	prev.assign(n + 1, exceeded);
+	curr.assign(n + 1, exceeded);
+	for (int32_t j = 0; j <= std::min(n, band); ++j)
+		prev[j] = j;
+
+	for (int32_t i = 1; i <= m; ++i)
+	{
+		int32_t j_lo = std::max(1, i - band);
+		int32_t j_hi = std::min(n, i + band);
+
+		curr[j_lo - 1] = (j_lo == 1) ? std::min(i, exceeded) : exceeded;
+		int32_t row_min = curr[j_lo - 1];
+
+		for (int32_t j = j_lo; j <= j_hi; ++j)
+		{
+			int32_t dist;
+			if (a[i - 1] == b[j - 1])
+				dist = prev[j - 1];
+			else
+				dist = std::min(
+				           prev[j - 1], std::min(prev[j], curr[j - 1])) +
+				       1;
+
+			curr[j] = std::min(dist, exceeded);
+			row_min = std::min(row_min, curr[j]);
+		}
+
+		if (j_hi < n)
+			curr[j_hi + 1] = exceeded;
+
+		if (row_min > band)
+			return exceeded;
+
+		std::swap(prev, curr);
+	}
+
+	return prev[n];
+}
+
+int32_t levenshtein_pair(
+    const SGVector<char>& lhs_str, const SGVector<char>& rhs_str,
+    std::vector<int32_t>& prev, std::vector<int32_t>& curr)
+{
+	// the pattern of the bit-parallel path must fit into one word; the
+	// distance is symmetric, so the shorter string can always be chosen
+	if (lhs_str.vlen == 0)
+		return rhs_str.vlen;
+	if (rhs_str.vlen == 0)
+		return lhs_str.vlen;
+
+	const SGVector<char>& shorter =
+	    (lhs_str.vlen <= rhs_str.vlen) ? lhs_str : rhs_str;
+	const SGVector<char>& longer =
+	    (lhs_str.vlen <= rhs_str.vlen) ? rhs_str : lhs_str;
+
+	if (shorter.vlen <= 64)
+		return levenshtein_myers(
+		    shorter.vector, shorter.vlen, longer.vector, longer.vlen);
+
+	return levenshtein_banded(
+	    shorter.vector, shorter.vlen, longer.vector, longer.vlen,
+	    longer.vlen, prev, curr);
+}
+
+}
+
 LevenshteinDistance::LevenshteinDistance() : Distance()
 {
 }
@@ -64,28 +185,57 @@ float64_t LevenshteinDistance::compute(int32_t idx_a, int32_t idx_b)
 float64_t LevenshteinDistance::compute_impl(
     const SGVector<char>& lhs_str, const SGVector<char>& rhs_str)
 {
-	int lhs_size = lhs_str.vlen, rhs_size = rhs_str.vlen;
-	SGMatrix<int> dist(lhs_size + 1, rhs_size + 1);
-	for (int i = 0; i <= lhs_size; ++i)
-		dist(i, 0) = i;
-	for (int i = 0; i <= rhs_size; ++i)
-		dist(0, i) = i;
-	for (int i = 1; i <= lhs_size; ++i)
+	std::vector<int32_t> prev;
+	std::vector<int32_t> curr;
+	return levenshtein_pair(lhs_str, rhs_str, prev, curr);
+}
+
+float64_t LevenshteinDistance::distance_upper_bounded(
+    int32_t idx_a, int32_t idx_b, float64_t upper_bound)
+{
+	auto casted_lhs = std::dynamic_pointer_cast<StringFeatures<char>>(lhs);
+	auto casted_rhs = std::dynamic_pointer_cast<StringFeatures<char>>(rhs);
+
+	SGVector<char> lhs_str = casted_lhs->get_feature_vector(idx_a);
+	SGVector<char> rhs_str = casted_rhs->get_feature_vector(idx_b);
+
+	int32_t band = static_cast<int32_t>(upper_bound);
+	std::vector<int32_t> prev;
+	std::vector<int32_t> curr;
+	return levenshtein_banded(
+	    lhs_str.vector, lhs_str.vlen, rhs_str.vector, rhs_str.vlen, band,
+	    prev, curr);
+}
+
+bool LevenshteinDistance::has_block_computation()
+{
+	return lhs && rhs;
+}
+
+void LevenshteinDistance::compute_block(
+    int32_t row_start, int32_t num_rows, int32_t col_start, int32_t num_cols,
+    float64_t* block, int32_t ld)
+{
+	auto casted_lhs = std::dynamic_pointer_cast<StringFeatures<char>>(lhs);
+	auto casted_rhs = std::dynamic_pointer_cast<StringFeatures<char>>(rhs);
+
+	// fetch the lhs strings of the block once instead of per pair
+	std::vector<SGVector<char>> lhs_strs(num_rows);
+	for (int32_t i = 0; i < num_rows; ++i)
+		lhs_strs[i] = casted_lhs->get_feature_vector(row_start + i);
+
+	std::vector<int32_t> prev;
+	std::vector<int32_t> curr;
+
+	for (int32_t j = 0; j < num_cols; ++j)
 	{
-		for (int j = 1; j <= rhs_size; ++j)
+		SGVector<char> rhs_str =
+		    casted_rhs->get_feature_vector(col_start + j);
+
+		for (int32_t i = 0; i < num_rows; ++i)
 		{
-			if (lhs_str[i - 1] == rhs_str[j - 1])
-			{
-				dist(i, j) = dist(i - 1, j - 1);
-			}
-			else
-			{
-				dist(i, j) = std::min(
-				                 dist(i - 1, j - 1),
-				                 std::min(dist(i - 1, j), dist(i, j - 1))) +
-				             1;
-			}
+			block[i + int64_t(j) * ld] =
+			    levenshtein_pair(lhs_strs[i], rhs_str, prev, curr);
 		}
 	}
-	return dist(lhs_size, rhs_size);
 }
\ No newline at end of file
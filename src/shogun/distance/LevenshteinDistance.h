@@ -115,6 +115,42 @@ namespace shogun
 		std::shared_ptr<Features>
 		replace_lhs(std::shared_ptr<Features> lhs) override;
 
+		/** compute the edit distance between lhs string a and rhs string b,
+		 * restricting the dynamic program to a band of width 2*upper_bound+1
+		 * around the diagonal. The computation aborts as soon as the band
+		 * proves that the distance exceeds upper_bound, which is a fraction
+		 * of the full cost when most pairs are farther apart than the
+		 * threshold (e.g. deduplication).
+		 *
+		 *  @param idx_a feature vector a at idx_a
+		 *  @param idx_b feature vector b at idx_b
+		 *  @param upper_bound value above which the computation halts
+		 *  @return distance value, or upper_bound+1 if it is exceeded
+		 */
+		float64_t distance_upper_bounded(int32_t idx_a, int32_t idx_b, float64_t upper_bound) override;
+
+		/** strings are always evaluated blockwise so that the dynamic
+		 * programming buffers are reused across a whole block of pairs
+		 *
+		 * @return true
+		 */
+		bool has_block_computation() override;
+
+		/** compute a block of edit distances, caching the lhs strings of the
+		 * block and reusing the row buffers across pairs, see
+		 * Distance::compute_block
+		 *
+		 * @param row_start first lhs index of the block
+		 * @param num_rows number of lhs vectors in the block
+		 * @param col_start first rhs index of the block
+		 * @param num_cols number of rhs vectors in the block
+		 * @param block target buffer of size num_rows*num_cols at least
+		 * @param ld leading dimension of the target buffer
+		 */
+		void compute_block(int32_t row_start, int32_t num_rows,
+				int32_t col_start, int32_t num_cols, float64_t* block,
+				int32_t ld) override;
+
 	protected:
 		/// compute distance function for features a and b
 		/// idx_{a,b} denote the index of the feature vectors
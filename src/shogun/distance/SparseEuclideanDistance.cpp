@@ -10,6 +10,8 @@
 #include <shogun/features/Features.h>
 #include <shogun/features/SparseFeatures.h>
 
+#include <algorithm>
+
 using namespace shogun;
 
 SparseEuclideanDistance::SparseEuclideanDistance()
@@ -48,9 +50,122 @@ bool SparseEuclideanDistance::init(std::shared_ptr<Features> l, std::shared_ptr<
 		sq_rhs=(std::static_pointer_cast<SparseFeatures<float64_t>>(rhs))->compute_squared(sq_rhs);
 	}
 
+	build_postings();
+
 	return true;
 }
 
+void SparseEuclideanDistance::build_postings()
+{
+	m_postings_values=SGVector<float64_t>();
+	m_postings_vec=SGVector<index_t>();
+	m_postings_offsets=SGVector<int64_t>();
+
+	auto sparse_lhs=std::static_pointer_cast<SparseFeatures<float64_t>>(lhs);
+	if (sparse_lhs->get_subset_stack()->has_subsets())
+		return;
+
+	index_t num_vec=sparse_lhs->get_num_vectors();
+	index_t num_feat=sparse_lhs->get_num_features();
+
+	SGVector<int64_t> offsets(num_feat+1);
+	offsets.zero();
+
+	// count the nonzeros of each feature, then prefix-sum into offsets
+	for (index_t i=0; i<num_vec; i++)
+	{
+		SGSparseVector<float64_t> vec=sparse_lhs->get_sparse_feature_vector(i);
+		for (index_t t=0; t<vec.num_feat_entries; t++)
+			offsets[vec.features[t].feat_index+1]++;
+		sparse_lhs->free_sparse_feature_vector(i);
+	}
+
+	for (index_t f=0; f<num_feat; f++)
+		offsets[f+1]+=offsets[f];
+
+	int64_t num_nonzero=offsets[num_feat];
+	m_postings_values=SGVector<float64_t>(num_nonzero);
+	m_postings_vec=SGVector<index_t>(num_nonzero);
+
+	// iterating vectors in order keeps every postings list sorted by
+	// vector id, which compute_block() relies on
+	SGVector<int64_t> cursor=offsets.clone();
+	for (index_t i=0; i<num_vec; i++)
+	{
+		SGSparseVector<float64_t> vec=sparse_lhs->get_sparse_feature_vector(i);
+		for (index_t t=0; t<vec.num_feat_entries; t++)
+		{
+			int64_t pos=cursor[vec.features[t].feat_index]++;
+			m_postings_values[pos]=vec.features[t].entry;
+			m_postings_vec[pos]=i;
+		}
+		sparse_lhs->free_sparse_feature_vector(i);
+	}
+
+	m_postings_offsets=offsets;
+}
+
+bool SparseEuclideanDistance::has_block_computation()
+{
+	if (!lhs || !rhs)
+		return false;
+
+	if (lhs->get_subset_stack()->has_subsets() ||
+			rhs->get_subset_stack()->has_subsets())
+		return false;
+
+	return m_postings_offsets.vlen>0 && sq_lhs && sq_rhs;
+}
+
+void SparseEuclideanDistance::compute_block(int32_t row_start, int32_t num_rows,
+		int32_t col_start, int32_t num_cols, float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Distance::compute_block(
+			row_start, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	auto sparse_rhs=std::static_pointer_cast<SparseFeatures<float64_t>>(rhs);
+	index_t num_feat=m_postings_offsets.vlen-1;
+	const index_t* vecs=m_postings_vec.vector;
+
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		float64_t* target=block+int64_t(j)*ld;
+		for (int32_t i=0; i<num_rows; i++)
+			target[i]=0;
+
+		// accumulate all nonzero inner products of the query against the
+		// block's lhs vectors by streaming the postings lists of its
+		// nonzero features
+		SGSparseVector<float64_t> vec=
+			sparse_rhs->get_sparse_feature_vector(col_start+j);
+		for (index_t t=0; t<vec.num_feat_entries; t++)
+		{
+			index_t feat=vec.features[t].feat_index;
+			if (feat>=num_feat)
+				continue;
+
+			float64_t val=vec.features[t].entry;
+			int64_t stop=m_postings_offsets[feat+1];
+			int64_t p=std::lower_bound(vecs+m_postings_offsets[feat],
+				vecs+stop, row_start)-vecs;
+
+			for (; p<stop && vecs[p]<row_start+num_rows; p++)
+				target[vecs[p]-row_start]+=m_postings_values[p]*val;
+		}
+		sparse_rhs->free_sparse_feature_vector(col_start+j);
+
+		for (int32_t i=0; i<num_rows; i++)
+		{
+			target[i]=std::sqrt(
+				sq_lhs[row_start+i]+sq_rhs[col_start+j]-2*target[i]);
+		}
+	}
+}
+
 void SparseEuclideanDistance::cleanup()
 {
 	if (sq_lhs != sq_rhs)
@@ -59,6 +174,10 @@ void SparseEuclideanDistance::cleanup()
 
 	SG_FREE(sq_lhs);
 	sq_lhs = NULL;
+
+	m_postings_values=SGVector<float64_t>();
+	m_postings_vec=SGVector<index_t>();
+	m_postings_offsets=SGVector<int64_t>();
 }
 
 float64_t SparseEuclideanDistance::compute(int32_t idx_a, int32_t idx_b)
@@ -61,6 +61,29 @@ class SparseEuclideanDistance: public SparseDistance<float64_t>
 		 */
 		const char* get_name() const override { return "SparseEuclideanDistance"; }
 
+		/** whether the inverted-index fast path is usable: requires the
+		 * postings index built over the left-hand side features and no
+		 * subsets on either side
+		 *
+		 * @return whether compute_block() streams the inverted index
+		 */
+		bool has_block_computation() override;
+
+		/** compute a block of the distance matrix by streaming the postings
+		 * lists of the query's nonzero features instead of intersecting
+		 * vector pairs one by one, see Distance::compute_block
+		 *
+		 * @param row_start first lhs index of the block
+		 * @param num_rows number of lhs vectors in the block
+		 * @param col_start first rhs index of the block
+		 * @param num_cols number of rhs vectors in the block
+		 * @param block target buffer of size num_rows*num_cols at least
+		 * @param ld leading dimension of the target buffer
+		 */
+		void compute_block(int32_t row_start, int32_t num_rows,
+				int32_t col_start, int32_t num_cols, float64_t* block,
+				int32_t ld) override;
+
 	protected:
 		/// compute kernel function for features a and b
 		/// idx_{a,b} denote the index of the feature vectors
@@ -71,12 +94,23 @@ class SparseEuclideanDistance: public SparseDistance<float64_t>
 	private:
 		void init();
 
+		/** group the nonzeros of the left-hand side features by feature
+		 * index into postings lists sorted by vector id */
+		void build_postings();
+
 	protected:
 		/** squared left-hand side */
 		float64_t* sq_lhs;
 		/** squared right-hand side */
 		float64_t* sq_rhs;
 
+		/** postings: lhs feature values grouped by feature index */
+		SGVector<float64_t> m_postings_values;
+		/** postings: lhs vector id of each stored value */
+		SGVector<index_t> m_postings_vec;
+		/** start offset of the postings list of each feature index */
+		SGVector<int64_t> m_postings_offsets;
+
 };
 
 } // namespace shogun
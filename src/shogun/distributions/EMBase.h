@@ -33,6 +33,7 @@
 
 #include <shogun/base/SGObject.h>
 #include <shogun/base/progress.h>
+#include <shogun/lib/SGVector.h>
 #include <shogun/lib/config.h>
 
 namespace shogun
@@ -63,6 +64,24 @@ template <class T> class EMBase : public SGObject
 		/** maximization step */
 		virtual void maximization_step()=0;
 
+		/** expectation step restricted to a minibatch of points: only
+		 * their entries of the persistent sufficient-statistic store are
+		 * refreshed; the default falls back to a full expectation step
+		 *
+		 * @param batch indices of the points in the minibatch
+		 * @return log likelihood of the minibatch
+		 */
+		virtual float64_t expectation_step_batch(const SGVector<int32_t>& batch)
+		{
+			return expectation_step();
+		}
+
+		/** @return number of points covered by the statistic store, 0 if unknown */
+		virtual int32_t get_num_points() const
+		{
+			return 0;
+		}
+
 		/** Expectation Maximization algorithm - runs expectation step and maximization step repeatedly as long as
 		 * max number of iterations is not reached or convergence does not take place.
 		 *
@@ -96,6 +115,70 @@ template <class T> class EMBase : public SGObject
 			return converge;
 		}
 
+		/** Minibatch (incremental) Expectation Maximization: after one
+		 * full expectation step has filled the sufficient-statistic
+		 * store, each iteration refreshes only one minibatch of points
+		 * and then maximizes, cycling through the data. Replacing a
+		 * minibatch's statistics in the persistent store is the exact
+		 * stepwise update, so the expensive per-point expectation cost
+		 * drops by the minibatch fraction while the updates stay
+		 * consistent. Convergence is checked on the log likelihood
+		 * accumulated over one full sweep.
+		 *
+		 * cf. Neal and Hinton. A view of the EM algorithm that justifies
+		 * incremental, sparse, and other variants. 1998.
+		 *
+		 * @param batch_size number of points per minibatch; values <=0 or
+		 * >= the number of points fall back to full-batch EM
+		 * @param max_iters max number of minibatch iterations
+		 * @param epsilon convergence tolerance per sweep
+		 * @return whether convergence is acheived
+		 */
+		bool iterate_em_minibatch(int32_t batch_size, int32_t max_iters=10000, float64_t epsilon=1e-8)
+		{
+			int32_t num=get_num_points();
+			if (batch_size<=0 || num<=0 || batch_size>=num)
+				return iterate_em(max_iters, epsilon);
+
+			/* one full expectation step so every point has statistics */
+			float64_t prev_sweep_ll=expectation_step();
+			maximization_step();
+
+			float64_t cur_sweep_ll=0;
+			int32_t seen=0;
+			int32_t start=0;
+			bool converge=false;
+			auto pb = SG_PROGRESS(range(max_iters));
+			for (int32_t i=1; i<max_iters; i++)
+			{
+				int32_t len=(start+batch_size<=num) ? batch_size : num-start;
+				SGVector<int32_t> batch(len);
+				for (int32_t j=0; j<len; j++)
+					batch[j]=start+j;
+
+				cur_sweep_ll+=expectation_step_batch(batch);
+				maximization_step();
+
+				seen+=len;
+				start=(start+len)%num;
+				pb.print_progress();
+
+				if (seen>=num)
+				{
+					if ((cur_sweep_ll-prev_sweep_ll)<epsilon)
+					{
+						converge=true;
+						break;
+					}
+					prev_sweep_ll=cur_sweep_ll;
+					cur_sweep_ll=0;
+					seen=0;
+				}
+			}
+			pb.complete();
+			return converge;
+		}
+
 	public:
 		/** data */
 		T data;
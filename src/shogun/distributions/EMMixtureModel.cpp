@@ -68,6 +68,39 @@ float64_t EMMixtureModel::expectation_step()
 	return log_likelihood;
 }
 
+float64_t EMMixtureModel::expectation_step_batch(const SGVector<int32_t>& batch)
+{
+	float64_t log_likelihood=0;
+	// for each data point of the minibatch
+	for (int32_t b=0;b<batch.vlen;b++)
+	{
+		int32_t i=batch[b];
+		SGVector<float64_t> alpha_ij(data.alpha.num_cols);
+		// for each component
+		for (int32_t j=0;j<data.alpha.num_cols;j++)
+		{
+			auto jth_component=data.components[j];
+			alpha_ij[j] = std::log(data.weights[j]) +
+			              jth_component->get_log_likelihood_example(i);
+
+		};
+
+		float64_t normalize=Math::log_sum_exp(alpha_ij);
+		log_likelihood+=normalize;
+
+		// fill row of alpha
+		for (int32_t j=0;j<data.alpha.num_cols;j++)
+			data.alpha(i, j) = std::exp(alpha_ij[j] - normalize);
+	}
+
+	return log_likelihood;
+}
+
+int32_t EMMixtureModel::get_num_points() const
+{
+	return data.alpha.num_rows;
+}
+
 void EMMixtureModel::maximization_step()
 {
 	// for each component
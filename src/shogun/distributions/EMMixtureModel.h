@@ -59,6 +59,17 @@ class EMMixtureModel : public EMBase<MixModelData>
 		 */
 		float64_t expectation_step() override;
 
+		/** expectation step over a minibatch: refreshes only the
+		 * belongingness rows of the given points
+		 *
+		 * @param batch indices of the points in the minibatch
+		 * @return log likelihood of the minibatch
+		 */
+		float64_t expectation_step_batch(const SGVector<int32_t>& batch) override;
+
+		/** @return number of points in the belongingness matrix */
+		int32_t get_num_points() const override;
+
 		/** maximization step */
 		void maximization_step() override;
 };
@@ -56,6 +56,10 @@ void Gaussian::init()
 		    m_constant += m_mean.vlen * std::log(m_d.vector[0]);
 		    break;
 	}
+
+	m_d_inv = SGVector<float64_t>(m_d.vlen);
+	for (int32_t i=0; i<m_d.vlen; i++)
+		m_d_inv.vector[i] = 1.0 / m_d.vector[i];
 }
 
 Gaussian::~Gaussian()
@@ -233,14 +237,14 @@ float64_t Gaussian::compute_log_PDF(SGVector<float64_t> point)
 {
 	ASSERT(m_mean.vector && m_d.vector)
 	ASSERT(point.vlen == m_mean.vlen)
-	SGVector<float64_t> difference = point.clone();
-
-	linalg::add(difference, m_mean, difference, -1.0, 1.0);
 
 	float64_t answer=m_constant;
 
 	if (m_cov_type==FULL)
 	{
+		SGVector<float64_t> difference = point.clone();
+		linalg::add(difference, m_mean, difference, -1.0, 1.0);
+
 		SGVector<float64_t> temp_holder(m_d.vlen);
 		temp_holder.zero();
 #ifdef HAVE_LAPACK
@@ -252,22 +256,108 @@ float64_t Gaussian::compute_log_PDF(SGVector<float64_t> point)
 #endif
 
 		for (int32_t i=0; i<m_d.vlen; i++)
-			answer+=temp_holder[i]*temp_holder[i]/m_d.vector[i];
+			answer+=temp_holder[i]*temp_holder[i]*m_d_inv.vector[i];
 	}
 	else if (m_cov_type==DIAG)
 	{
+		/* diagonal fast path: no temporary, one fused
+		 * multiply per dimension against the cached inverse variances */
 		for (int32_t i=0; i<m_mean.vlen; i++)
-			answer+=difference[i]*difference[i]/m_d.vector[i];
+		{
+			float64_t diff=point[i]-m_mean[i];
+			answer+=diff*diff*m_d_inv.vector[i];
+		}
 	}
 	else
 	{
 		for (int32_t i=0; i<m_mean.vlen; i++)
-			answer += difference[i] * difference[i] / m_d.vector[0];
+		{
+			float64_t diff=point[i]-m_mean[i];
+			answer+=diff*diff*m_d_inv.vector[0];
+		}
 	}
 
 	return -0.5 * answer;
 }
 
+SGVector<float64_t> Gaussian::compute_log_PDF(const SGMatrix<float64_t>& points)
+{
+	ASSERT(m_mean.vector && m_d.vector)
+	ASSERT(points.num_rows == m_mean.vlen)
+
+	int32_t num_dim=m_mean.vlen;
+	int32_t num_points=points.num_cols;
+
+	SGVector<float64_t> answers(num_points);
+	answers.set_const(m_constant);
+
+	if (m_cov_type==FULL)
+	{
+		SGMatrix<float64_t> difference(num_dim, num_points);
+		for (int32_t i=0; i<num_points; i++)
+		{
+			const float64_t* point=points.get_column_vector(i);
+			float64_t* diff=difference.get_column_vector(i);
+			for (int32_t j=0; j<num_dim; j++)
+				diff[j]=point[j]-m_mean[j];
+		}
+
+		SGMatrix<float64_t> temp_holder(num_dim, num_points);
+		temp_holder.zero();
+#ifdef HAVE_LAPACK
+		cblas_dgemm(
+		    CblasColMajor, CblasTrans, CblasNoTrans, num_dim, num_points,
+		    num_dim, 1, m_u.matrix, num_dim, difference.matrix, num_dim, 0,
+		    temp_holder.matrix, num_dim);
+#else
+		linalg::dgemm<float64_t>(
+		    1, m_u, difference, false, false, 0, temp_holder);
+#endif
+
+		for (int32_t i=0; i<num_points; i++)
+		{
+			const float64_t* temp=temp_holder.get_column_vector(i);
+			for (int32_t j=0; j<num_dim; j++)
+				answers[i]+=temp[j]*temp[j]*m_d_inv.vector[j];
+		}
+	}
+	else if (m_cov_type==DIAG)
+	{
+		/* diagonal fast path: the quadratic form is separable, so the
+		 * block is consumed in place without a difference matrix */
+		for (int32_t i=0; i<num_points; i++)
+		{
+			const float64_t* point=points.get_column_vector(i);
+			float64_t acc=0;
+			for (int32_t j=0; j<num_dim; j++)
+			{
+				float64_t diff=point[j]-m_mean[j];
+				acc+=diff*diff*m_d_inv.vector[j];
+			}
+			answers[i]+=acc;
+		}
+	}
+	else
+	{
+		for (int32_t i=0; i<num_points; i++)
+		{
+			const float64_t* point=points.get_column_vector(i);
+			float64_t acc=0;
+			for (int32_t j=0; j<num_dim; j++)
+			{
+				float64_t diff=point[j]-m_mean[j];
+				acc+=diff*diff;
+			}
+			answers[i]+=acc*m_d_inv.vector[0];
+		}
+	}
+
+	for (int32_t i=0; i<num_points; i++)
+		answers[i]*=-0.5;
+
+	return answers;
+}
+
 SGVector<float64_t> Gaussian::get_mean()
 {
 	return m_mean;
@@ -342,6 +432,7 @@ void Gaussian::register_params()
 	SG_ADD(&m_d, "m_d", "Diagonal.");
 	SG_ADD(&m_mean, "m_mean", "Mean.");
 	SG_ADD(&m_constant, "m_constant", "Constant part.");
+	SG_ADD(&m_d_inv, "m_d_inv", "Cached inverse variances.");
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_cov_type, "m_cov_type", "Covariance type.",
 	    ParameterProperties::NONE, SG_OPTIONS(FULL, DIAG, SPHERICAL));
@@ -55,7 +55,7 @@ class Gaussian : public RandomMixin<Distribution>
 		Gaussian(const SGVector<float64_t> mean, SGMatrix<float64_t> cov, ECovType cov_type=FULL);
 		~Gaussian() override;
 
-		/** Compute the constant part */
+		/** Compute the constant part and the cached inverse variances */
 		void init();
 
 		/** learn distribution
@@ -122,6 +122,15 @@ class Gaussian : public RandomMixin<Distribution>
 		 */
 		virtual float64_t compute_log_PDF(SGVector<float64_t> point);
 
+		/** compute log PDF of a batch of points at once: the quadratic
+		 * forms of all points are evaluated with matrix operations
+		 * instead of per-point loops
+		 *
+		 * @param points matrix with one point per column
+		 * @return vector of computed log PDFs, one per column
+		 */
+		virtual SGVector<float64_t> compute_log_PDF(const SGMatrix<float64_t>& points);
+
 		/** get mean
 		 *
 		 * @return mean
@@ -234,6 +243,9 @@ class Gaussian : public RandomMixin<Distribution>
 		float64_t m_constant;
 		/** diagonal */
 		SGVector<float64_t> m_d;
+		/** elementwise inverse of the diagonal, cached so the PDF
+		 * evaluation multiplies instead of dividing */
+		SGVector<float64_t> m_d_inv;
 		/** unitary matrix */
 		SGMatrix<float64_t> m_u;
 		/** mean */
@@ -8,6 +8,7 @@
 #include <shogun/distributions/HMM.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/eigen3.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/config.h>
 #include <shogun/lib/Signal.h>
@@ -29,6 +30,23 @@
 
 using namespace shogun;
 
+namespace
+{
+/* numerically stable log-sum-exp over a contiguous buffer of log-domain
+ * terms. One max pass followed by a vectorizable exp/sum reduction replaces
+ * a chain of pairwise Math::logarithmic_sum calls, each of which costs a
+ * scalar exp and log */
+inline float64_t log_sum_exp_buffer(const float64_t* buffer, int32_t len)
+{
+	ASSERT(len>0)
+	Eigen::Map<const Eigen::ArrayXd> terms(buffer, len);
+	const float64_t max_term=terms.maxCoeff();
+	if (!std::isfinite(max_term))
+		return max_term;
+	return max_term+std::log((terms-max_term).exp().sum());
+}
+}
+
 //////////////////////////////////////////////////////////////////////
 // Construction/Destruction
 //////////////////////////////////////////////////////////////////////
@@ -718,6 +736,8 @@ float64_t HMM::forward_comp(int32_t time, int32_t state, int32_t dimension)
 		for (int32_t i=0; i<N; i++)
 			alpha[i] = get_p(i) + get_b(i, p_observations->get_feature(dimension,0)) ;
 
+		SGVector<float64_t> buffer(N);
+
 		//induction		alpha_t+1(j) = (sum_i=1^N alpha_t(i)a_ij) b_j(O_t+1)
 		for (int32_t t=1; t<time && t < p_observations->get_vector_length(dimension); t++)
 		{
@@ -726,11 +746,26 @@ float64_t HMM::forward_comp(int32_t time, int32_t state, int32_t dimension)
 			{
 				int32_t i, num = trans_list_forward_cnt[j] ;
 				float64_t sum=-Math::INFTY;
-				for (i=0; i < num; i++)
+				if (num==N)
 				{
-					int32_t ii = trans_list_forward[j][i] ;
-					sum = Math::logarithmic_sum(sum, alpha[ii] + get_a(ii,j));
-				} ;
+					//dense transitions: the predecessor list is exactly
+					//0..N-1 and the j-th column of a is contiguous, so the
+					//per-timestep state update vectorizes
+					Eigen::Map<const Eigen::ArrayXd> alpha_map(alpha, N);
+					Eigen::Map<const Eigen::ArrayXd> a_col(&transition_matrix_a[int64_t(j)*N], N);
+					Eigen::Map<Eigen::ArrayXd> buf(buffer.vector, N);
+					buf=alpha_map+a_col;
+					sum=log_sum_exp_buffer(buffer.vector, N);
+				}
+				else if (num>0)
+				{
+					for (i=0; i < num; i++)
+					{
+						int32_t ii = trans_list_forward[j][i] ;
+						buffer[i]=alpha[ii] + get_a(ii,j);
+					} ;
+					sum=log_sum_exp_buffer(buffer.vector, num);
+				}
 
 				alpha_new[j]= sum + get_b(j, p_observations->get_feature(dimension,t));
 			}
@@ -955,6 +990,8 @@ float64_t HMM::backward_comp(int32_t time, int32_t state, int32_t dimension)
       for (int32_t i=0; i<N; i++)
 	beta[i]=get_q(i);
 
+      SGVector<float64_t> buffer(N);
+
       //induction		beta_t(i) = (sum_j=1^N a_ij*b_j(O_t+1)*beta_t+1(j)
       for (int32_t t=p_observations->get_vector_length(dimension)-1; t>time+1 && t>0; t--)
 	{
@@ -962,11 +999,15 @@ float64_t HMM::backward_comp(int32_t time, int32_t state, int32_t dimension)
 	    {
 	      int32_t j, num=trans_list_backward_cnt[i] ;
 	      float64_t sum=-Math::INFTY;
+	      //the successor terms are gathered into a contiguous buffer so
+	      //that the log-sum-exp reduction vectorizes
 	      for (j=0; j<num; j++)
 		{
 		  int32_t jj = trans_list_backward[i][j] ;
-		  sum= Math::logarithmic_sum(sum, get_a(i, jj) + get_b(jj, p_observations->get_feature(dimension,t)) + beta[jj]);
+		  buffer[j]=get_a(i, jj) + get_b(jj, p_observations->get_feature(dimension,t)) + beta[jj];
 		} ;
+	      if (num>0)
+		sum=log_sum_exp_buffer(buffer.vector, num);
 	      beta_new[i]=sum;
 	    }
 
@@ -1380,41 +1421,45 @@ void HMM::ab_buf_comp(
 	int32_t dim)
 {
 	int32_t i,j,t ;
-	float64_t a_sum;
-	float64_t b_sum;
 
 	float64_t dimmodprob=model_probability(dim);
+	const int32_t len=p_observations->get_vector_length(dim);
+	SGVector<float64_t> buffer(Math::max(len, 1));
+
+	//group the timesteps by observed symbol, so that the emission
+	//numerators only visit the matching timesteps instead of scanning the
+	//whole sequence once per symbol
+	std::vector<std::vector<int32_t>> times_by_symbol(M);
+	for (t=0; t<len; t++)
+		times_by_symbol[p_observations->get_feature(dim,t)].push_back(t);
 
 	for (i=0; i<N; i++)
 	{
 		//estimate initial+end state distribution numerator
 		p_buf[i]=get_p(i)+get_b(i,p_observations->get_feature(dim,0))+backward(0,i,dim) - dimmodprob;
-		q_buf[i]=forward(p_observations->get_vector_length(dim)-1, i, dim)+get_q(i) - dimmodprob;
+		q_buf[i]=forward(len-1, i, dim)+get_q(i) - dimmodprob;
 
 		//estimate a
 		for (j=0; j<N; j++)
 		{
-			a_sum=-Math::INFTY;
-
-			for (t=0; t<p_observations->get_vector_length(dim)-1; t++)
+			for (t=0; t<len-1; t++)
 			{
-				a_sum= Math::logarithmic_sum(a_sum, forward(t,i,dim)+
-						get_a(i,j)+get_b(j,p_observations->get_feature(dim,t+1))+backward(t+1,j,dim));
+				buffer[t]=forward(t,i,dim)+
+						get_a(i,j)+get_b(j,p_observations->get_feature(dim,t+1))+backward(t+1,j,dim);
 			}
+			float64_t a_sum=len>1 ? log_sum_exp_buffer(buffer.vector, len-1) : -Math::INFTY;
 			a_buf[N*i+j]=a_sum-dimmodprob ;
 		}
 
 		//estimate b
 		for (j=0; j<M; j++)
 		{
-			b_sum=-Math::INFTY;
-
-			for (t=0; t<p_observations->get_vector_length(dim); t++)
-			{
-				if (p_observations->get_feature(dim,t)==j)
-					b_sum=Math::logarithmic_sum(b_sum, forward(t,i,dim)+backward(t, i, dim));
-			}
+			const std::vector<int32_t>& times=times_by_symbol[j];
+			for (size_t k=0; k<times.size(); k++)
+				buffer[k]=forward(times[k],i,dim)+backward(times[k], i, dim);
 
+			float64_t b_sum=times.empty() ? -Math::INFTY :
+				log_sum_exp_buffer(buffer.vector, (int32_t)times.size());
 			b_buf[M*i+j]=b_sum-dimmodprob ;
 		}
 	}
@@ -1563,11 +1608,21 @@ void HMM::estimate_model_baum_welch(const std::shared_ptr<HMM>& estimate)
 		dimmodprob=estimate->model_probability(dim);
 		fullmodprob+=dimmodprob ;
 
+		const int32_t len=p_observations->get_vector_length(dim);
+		SGVector<float64_t> buffer(Math::max(len, 1));
+
+		//group the timesteps by observed symbol, so that the emission
+		//numerators only visit the matching timesteps instead of scanning
+		//the whole sequence once per symbol
+		std::vector<std::vector<int32_t>> times_by_symbol(M);
+		for (t=0; t<len; t++)
+			times_by_symbol[p_observations->get_feature(dim,t)].push_back(t);
+
 		for (i=0; i<N; i++)
 		{
 			//estimate initial+end state distribution numerator
 			set_p(i, Math::logarithmic_sum(get_p(i), estimate->get_p(i)+estimate->get_b(i,p_observations->get_feature(dim,0))+estimate->backward(0,i,dim) - dimmodprob));
-			set_q(i, Math::logarithmic_sum(get_q(i), estimate->forward(p_observations->get_vector_length(dim)-1, i, dim)+estimate->get_q(i) - dimmodprob ));
+			set_q(i, Math::logarithmic_sum(get_q(i), estimate->forward(len-1, i, dim)+estimate->get_q(i) - dimmodprob ));
 
 			int32_t num = trans_list_backward_cnt[i] ;
 
@@ -1575,27 +1630,25 @@ void HMM::estimate_model_baum_welch(const std::shared_ptr<HMM>& estimate)
 			for (j=0; j<num; j++)
 			{
 				int32_t jj = trans_list_backward[i][j] ;
-				a_sum=-Math::INFTY;
 
-				for (t=0; t<p_observations->get_vector_length(dim)-1; t++)
+				for (t=0; t<len-1; t++)
 				{
-					a_sum= Math::logarithmic_sum(a_sum, estimate->forward(t,i,dim)+
-							estimate->get_a(i,jj)+estimate->get_b(jj,p_observations->get_feature(dim,t+1))+estimate->backward(t+1,jj,dim));
+					buffer[t]=estimate->forward(t,i,dim)+
+							estimate->get_a(i,jj)+estimate->get_b(jj,p_observations->get_feature(dim,t+1))+estimate->backward(t+1,jj,dim);
 				}
+				a_sum=len>1 ? log_sum_exp_buffer(buffer.vector, len-1) : -Math::INFTY;
 				set_a(i,jj, Math::logarithmic_sum(get_a(i,jj), a_sum-dimmodprob));
 			}
 
 			//estimate b
 			for (j=0; j<M; j++)
 			{
-				b_sum=-Math::INFTY;
-
-				for (t=0; t<p_observations->get_vector_length(dim); t++)
-				{
-					if (p_observations->get_feature(dim,t)==j)
-						b_sum=Math::logarithmic_sum(b_sum, estimate->forward(t,i,dim)+estimate->backward(t, i, dim));
-				}
+				const std::vector<int32_t>& times=times_by_symbol[j];
+				for (size_t k=0; k<times.size(); k++)
+					buffer[k]=estimate->forward(times[k],i,dim)+estimate->backward(times[k], i, dim);
 
+				b_sum=times.empty() ? -Math::INFTY :
+					log_sum_exp_buffer(buffer.vector, (int32_t)times.size());
 				set_b(i,j, Math::logarithmic_sum(get_b(i,j), b_sum-dimmodprob));
 			}
 		}
@@ -172,6 +172,24 @@ float64_t LinearHMM::get_log_likelihood_example(uint16_t* vector, int32_t len)
 	return result;
 }
 
+void LinearHMM::get_log_likelihood_batch(
+	const uint16_t* const* vectors, int32_t num_sequences, int32_t len,
+	float64_t* result)
+{
+	ASSERT(len<=sequence_length)
+
+	for (int32_t j=0; j<num_sequences; j++)
+		result[j]=log_transition_probs[vectors[j][0]];
+
+	for (int32_t i=1; i<len; i++)
+	{
+		const float64_t* row=log_transition_probs.matrix+i*num_symbols;
+
+		for (int32_t j=0; j<num_sequences; j++)
+			result[j]+=row[vectors[j][i]];
+	}
+}
+
 float64_t LinearHMM::get_log_likelihood_example(int32_t num_example)
 {
 	int32_t len;
@@ -84,6 +84,22 @@ class LinearHMM : public Distribution
 		 */
 		float64_t get_log_likelihood_example(uint16_t* vector, int32_t len);
 
+		/** get log likelihoods of a block of equal-length sequences
+		 *
+		 * The block is traversed position-major: one row of the
+		 * log-probability table is streamed across the whole batch
+		 * before moving to the next position, so the row stays in
+		 * cache and the per-sequence accumulators are independent.
+		 *
+		 * @param vectors pointers to num_sequences sequences
+		 * @param num_sequences number of sequences in the block
+		 * @param len common length of the sequences
+		 * @param result buffer for num_sequences log likelihoods
+		 */
+		void get_log_likelihood_batch(
+			const uint16_t* const* vectors, int32_t num_sequences,
+			int32_t len, float64_t* result);
+
 		/** get one example's likelihood
 		 *
 		 * @param vector the example
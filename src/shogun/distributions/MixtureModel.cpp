@@ -91,7 +91,11 @@ bool MixtureModel::train(std::shared_ptr<Features> data)
 	em->data.weights=m_weights;
 
 	// run EM
-	bool is_converged=em->iterate_em(m_max_iters,m_conv_tol);
+	bool is_converged;
+	if (m_minibatch_size>0)
+		is_converged=em->iterate_em_minibatch(m_minibatch_size,m_max_iters,m_conv_tol);
+	else
+		is_converged=em->iterate_em(m_max_iters,m_conv_tol);
 	if (!is_converged)
 		io::warn("max iterations reached. No convergence yet!");
 
@@ -186,6 +190,16 @@ float64_t MixtureModel::get_convergence_tolerance() const
 	return m_conv_tol;
 }
 
+void MixtureModel::set_minibatch_size(int32_t batch_size)
+{
+	m_minibatch_size=batch_size;
+}
+
+int32_t MixtureModel::get_minibatch_size() const
+{
+	return m_minibatch_size;
+}
+
 SGVector<float64_t> MixtureModel::sample()
 {
 	// TBD
@@ -205,9 +219,11 @@ void MixtureModel::init()
 	m_weights=SGVector<float64_t>();
 	m_conv_tol=1e-8;
 	m_max_iters=1000;
+	m_minibatch_size=0;
 
 	SG_ADD(&m_components,"m_components","components of mixture");
 	SG_ADD(&m_weights,"m_weights","weights of components");
 	SG_ADD(&m_conv_tol,"m_conv_tol","convergence tolerance");
 	SG_ADD(&m_max_iters,"m_max_iters","max number of iterations");
+	SG_ADD(&m_minibatch_size,"m_minibatch_size","minibatch size for incremental EM");
 }
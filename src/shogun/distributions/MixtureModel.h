@@ -156,6 +156,20 @@ class MixtureModel : public Distribution
 		 */
 		float64_t get_convergence_tolerance() const;
 
+		/** set minibatch size for incremental EM: when positive, each EM
+		 * iteration refreshes the responsibilities of only that many
+		 * points instead of the full data set
+		 *
+		 * @param batch_size points per minibatch, 0 for full-batch EM
+		 */
+		void set_minibatch_size(int32_t batch_size);
+
+		/** get minibatch size for incremental EM
+		 *
+		 * @return points per minibatch, 0 for full-batch EM
+		 */
+		int32_t get_minibatch_size() const;
+
 		/** sample from model
 		 *
 		 * @return sample
@@ -185,6 +199,9 @@ class MixtureModel : public Distribution
 
 		/** convergence tolerance */
 		float64_t m_conv_tol;
+
+		/** minibatch size for incremental EM, 0 for full-batch */
+		int32_t m_minibatch_size;
 };
 }
 #endif /* _MIXTUREMODEL_H__ */
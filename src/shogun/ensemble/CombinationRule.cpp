@@ -5,6 +5,8 @@
  */
 
 #include <shogun/ensemble/CombinationRule.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
 
 using namespace shogun;
 
@@ -18,3 +20,16 @@ CombinationRule::~CombinationRule()
 {
 
 }
+
+void CombinationRule::accumulate(SGMatrix<float64_t>& accumulator,
+	const SGVector<float64_t>& member_outputs, float64_t weight) const
+{
+	error("{} does not support streamed combination", get_name());
+}
+
+SGVector<float64_t> CombinationRule::finalize(
+	const SGMatrix<float64_t>& accumulator, int32_t num_members) const
+{
+	error("{} does not support streamed combination", get_name());
+	return SGVector<float64_t>();
+}
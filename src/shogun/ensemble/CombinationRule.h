@@ -45,6 +45,66 @@ namespace shogun
 			 */
 			virtual float64_t combine(const SGVector<float64_t>& ensemble_result) const = 0;
 
+			/**
+			 * Whether this rule can reduce the ensemble incrementally via
+			 * accumulate()/finalize(), i.e. one member's outputs at a time,
+			 * without ever materializing the num_vectors x ensemble_size
+			 * output matrix.
+			 *
+			 * @return whether streamed combination is supported
+			 */
+			virtual bool supports_streamed_combine() const { return false; }
+
+			/**
+			 * Number of float64 accumulator slots the rule needs per feature
+			 * vector for streamed combination. The caller allocates a zeroed
+			 * num_slots x num_vectors matrix and passes it to accumulate().
+			 *
+			 * @return slots per vector, 0 if streaming is unsupported
+			 */
+			virtual int32_t get_num_accumulator_slots() const { return 0; }
+
+			/**
+			 * Weight of one ensemble member in streamed combination; the
+			 * caller passes it to accumulate() along with that member's
+			 * outputs.
+			 *
+			 * @param index index of the member in the ensemble
+			 * @return the member's weight, 1.0 unless the rule weights
+			 * its members
+			 */
+			virtual float64_t get_member_weight(int32_t index) const
+			{
+				return 1.0;
+			}
+
+			/**
+			 * Folds one ensemble member's outputs into the running
+			 * accumulator. Contributions must be additive: two accumulators
+			 * filled from disjoint member subsets merged by element-wise sum
+			 * are equivalent to one accumulator filled from all members,
+			 * which lets callers accumulate on per-thread partials.
+			 *
+			 * @param accumulator running aggregation state, one column per vector
+			 * @param member_outputs one Machine's output per feature vector
+			 * @param weight the member's weight in the ensemble
+			 */
+			virtual void accumulate(SGMatrix<float64_t>& accumulator,
+				const SGVector<float64_t>& member_outputs,
+				float64_t weight=1.0) const;
+
+			/**
+			 * Reduces the accumulator into the combined outputs once all
+			 * members have been folded in.
+			 *
+			 * @param accumulator the filled aggregation state
+			 * @param num_members number of members that were accumulated
+			 * @return the combined value per feature vector
+			 */
+			virtual SGVector<float64_t> finalize(
+				const SGMatrix<float64_t>& accumulator,
+				int32_t num_members) const;
+
 			/** name **/
 			const char* get_name() const override { return "CombinationRule"; }
 	};
@@ -43,6 +43,13 @@ namespace shogun
 			 */
 			float64_t combine(const SGVector<float64_t>& ensemble_result) const override;
 
+			/** every member votes with weight one, regardless of the
+			 * scratch weights the matrix path leaves in m_weights */
+			float64_t get_member_weight(int32_t index) const override
+			{
+				return 1.0;
+			}
+
 			/** name **/
 			const char* get_name() const override { return "MajorityVote"; }
 	};
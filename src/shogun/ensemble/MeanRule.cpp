@@ -42,3 +42,27 @@ float64_t MeanRule::combine(const SGVector<float64_t>& ensemble_result) const
 	combined /= (float64_t)ensemble_result.vlen;
 	return combined;
 }
+
+void MeanRule::accumulate(SGMatrix<float64_t>& accumulator,
+	const SGVector<float64_t>& member_outputs, float64_t weight) const
+{
+	require(accumulator.num_rows == get_num_accumulator_slots() &&
+		accumulator.num_cols == member_outputs.vlen,
+		"Accumulator dimension ({}, {}) does not match ({}, {})",
+		accumulator.num_rows, accumulator.num_cols,
+		get_num_accumulator_slots(), member_outputs.vlen);
+
+	for (index_t i = 0; i < member_outputs.vlen; ++i)
+		accumulator(0, i) += weight * member_outputs[i];
+}
+
+SGVector<float64_t> MeanRule::finalize(
+	const SGMatrix<float64_t>& accumulator, int32_t num_members) const
+{
+	SGVector<float64_t> mean_labels(accumulator.num_cols);
+	float64_t scale = 1 / (float64_t)num_members;
+	for (index_t i = 0; i < accumulator.num_cols; ++i)
+		mean_labels[i] = accumulator(0, i) * scale;
+
+	return mean_labels;
+}
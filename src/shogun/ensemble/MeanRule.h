@@ -42,6 +42,25 @@ namespace shogun
 			 */
 			float64_t combine(const SGVector<float64_t>& ensemble_result) const override;
 
+			/** averaging is a plain running sum, so streaming is always
+			 * available
+			 * @return true
+			 */
+			bool supports_streamed_combine() const override { return true; }
+
+			/** @return 1, the running sum per vector */
+			int32_t get_num_accumulator_slots() const override { return 1; }
+
+			/** adds one member's outputs to the running sums */
+			void accumulate(SGMatrix<float64_t>& accumulator,
+				const SGVector<float64_t>& member_outputs,
+				float64_t weight=1.0) const override;
+
+			/** divides the running sums by the number of members */
+			SGVector<float64_t> finalize(
+				const SGMatrix<float64_t>& accumulator,
+				int32_t num_members) const override;
+
 			/** name **/
 			const char* get_name() const override { return "MeanRule"; }
 	};
@@ -86,6 +86,109 @@ float64_t WeightedMajorityVote::weighted_combine(const SGVector<float64_t>& ense
 	return max_label;
 }
 
+void WeightedMajorityVote::set_num_vote_bins(int32_t num_bins)
+{
+	require(num_bins >= 0, "Number of vote bins ({}) must be non-negative",
+		num_bins);
+	m_num_vote_bins = num_bins;
+}
+
+int32_t WeightedMajorityVote::get_num_vote_bins() const
+{
+	return m_num_vote_bins;
+}
+
+bool WeightedMajorityVote::supports_streamed_combine() const
+{
+	return m_num_vote_bins > 0;
+}
+
+int32_t WeightedMajorityVote::get_num_accumulator_slots() const
+{
+	// one weight slot per bin plus one counting -1 votes, which share
+	// bin 0 with votes for label 0
+	return m_num_vote_bins > 0 ? m_num_vote_bins + 1 : 0;
+}
+
+float64_t WeightedMajorityVote::get_member_weight(int32_t index) const
+{
+	if (m_weights.vlen == 0)
+		return 1.0;
+
+	require(index >= 0 && index < m_weights.vlen,
+		"Member index {} is out of range for the {} weights",
+		index, m_weights.vlen);
+	return m_weights[index];
+}
+
+void WeightedMajorityVote::accumulate(SGMatrix<float64_t>& accumulator,
+	const SGVector<float64_t>& member_outputs, float64_t weight) const
+{
+	require(m_num_vote_bins > 0, "Vote bins are not set, streamed "
+		"combination needs set_num_vote_bins()");
+	require(accumulator.num_rows == get_num_accumulator_slots() &&
+		accumulator.num_cols == member_outputs.vlen,
+		"Accumulator dimension ({}, {}) does not match ({}, {})",
+		accumulator.num_rows, accumulator.num_cols,
+		get_num_accumulator_slots(), member_outputs.vlen);
+
+	for (index_t i = 0; i < member_outputs.vlen; ++i)
+	{
+		if (Math::is_nan(member_outputs[i]))
+			continue;
+
+		index_t bin = (index_t)member_outputs[i];
+		if (bin < 0)
+		{
+			require(bin == -1, "Label {:g} cannot be voted on, only -1 "
+				"and [0, {}) can", member_outputs[i], m_num_vote_bins);
+			accumulator(m_num_vote_bins, i) += 1;
+			bin = 0;
+		}
+		require(bin < m_num_vote_bins, "Label {:g} exceeds the configured "
+			"{} vote bins", member_outputs[i], m_num_vote_bins);
+
+		accumulator(bin, i) += weight;
+	}
+}
+
+SGVector<float64_t> WeightedMajorityVote::finalize(
+	const SGMatrix<float64_t>& accumulator, int32_t num_members) const
+{
+	require(m_num_vote_bins > 0, "Vote bins are not set, streamed "
+		"combination needs set_num_vote_bins()");
+
+	SGVector<float64_t> mv(accumulator.num_cols);
+	for (index_t i = 0; i < accumulator.num_cols; ++i)
+	{
+		index_t max_bin = -1;
+		float64_t max = 0;
+		for (index_t j = 0; j < m_num_vote_bins; ++j)
+		{
+			if (accumulator(j, i) > max)
+			{
+				max_bin = j;
+				max = accumulator(j, i);
+			}
+		}
+
+		if (max_bin < 0)
+		{
+			// no member cast a vote for this vector
+			mv[i] = -100;
+		}
+		else if (max_bin == 0 && accumulator(m_num_vote_bins, i) > 0)
+		{
+			// bin 0 holds the -1 votes of binary problems
+			mv[i] = -1;
+		}
+		else
+			mv[i] = max_bin;
+	}
+
+	return mv;
+}
+
 void WeightedMajorityVote::set_weights(SGVector<float64_t>& w)
 {
 	m_weights = w;
@@ -99,9 +202,12 @@ SGVector<float64_t> WeightedMajorityVote::get_weights() const
 void WeightedMajorityVote::init()
 {
 	m_weights = SGVector<float64_t>();
+	m_num_vote_bins = 0;
 }
 
 void WeightedMajorityVote::register_parameters()
 {
 	SG_ADD(&m_weights, kWeights, "Weights for the majority vote", ParameterProperties::HYPER);
+	SG_ADD(&m_num_vote_bins, kNumVoteBins,
+		"Number of vote bins for streamed combination");
 }
@@ -64,6 +64,44 @@ namespace shogun
 			 */
 			float64_t combine(const SGVector<float64_t>& ensemble_result) const override;
 
+			/**
+			 * Enables streamed combination by bounding the label range.
+			 *
+			 * Votes are then accumulated into one weight slot per label
+			 * instead of a per-vector map, which requires the members'
+			 * outputs to be integer labels in [0, num_bins), with -1 of
+			 * binary problems sharing the slot of label 0. Pass 0 to
+			 * disable streaming again.
+			 *
+			 * @param num_bins number of distinct labels the members emit
+			 */
+			void set_num_vote_bins(int32_t num_bins);
+
+			/** @return number of vote bins, 0 if streaming is disabled */
+			int32_t get_num_vote_bins() const;
+
+			/** @return whether vote bins have been configured */
+			bool supports_streamed_combine() const override;
+
+			/** @return one weight slot per vote bin, plus one slot
+			 * counting -1 votes so that finalize() can tell them apart
+			 * from votes for label 0 */
+			int32_t get_num_accumulator_slots() const override;
+
+			/** @return the member's weight, 1.0 when no weights are set */
+			float64_t get_member_weight(int32_t index) const override;
+
+			/** adds weight to the slot of each vector's voted label */
+			void accumulate(SGMatrix<float64_t>& accumulator,
+				const SGVector<float64_t>& member_outputs,
+				float64_t weight=1.0) const override;
+
+			/** picks the label with the highest accumulated weight per
+			 * vector; ties break toward the smaller label */
+			SGVector<float64_t> finalize(
+				const SGMatrix<float64_t>& accumulator,
+				int32_t num_members) const override;
+
 			/**
 			 * Set weight vector for the labels
 			 *
@@ -93,12 +131,16 @@ namespace shogun
 			/** the weight vector */
 			mutable SGVector<float64_t> m_weights;
 
+			/** number of vote bins for streamed combination, 0 disables */
+			int32_t m_num_vote_bins;
+
 		private:
 			void init();
 			void register_parameters();
 		#ifndef SWIG
 		public:
 			static constexpr std::string_view kWeights = "weights";
+			static constexpr std::string_view kNumVoteBins = "num_vote_bins";
 		#endif
 	};
 }
@@ -11,7 +11,7 @@
 
 #include <shogun/evaluation/ClusteringEvaluation.h>
 #include <shogun/labels/MulticlassLabels.h>
-#include <shogun/mathematics/munkres.h>
+#include <shogun/mathematics/JonkerVolgenant.h>
 
 using namespace shogun;
 using namespace std;
@@ -74,20 +74,22 @@ std::shared_ptr<Labels> ClusteringEvaluation::best_map(const std::shared_ptr<Lab
 		}
 	}
 
-	Munkres munkres_solver(G);
-	munkres_solver.solve();
+	/* Jonker-Volgenant is an order of magnitude faster than the previous
+	 * Munkres solver once the number of classes is large, and its
+	 * assignment vectors give the label map directly instead of scanning
+	 * the reduced cost matrix for zeros */
+	JonkerVolgenant lap_solver(G);
+	SGVector<int32_t> row_to_col;
+	SGVector<int32_t> col_to_row;
+	lap_solver.solve(row_to_col, col_to_row);
 
 	std::map<int32_t, int32_t> label_map;
 	for (int32_t i=0; i < label_p.vlen; ++i)
 	{
-		for (int32_t j=0; j < label_g.vlen; ++j)
+		if (col_to_row[i] < label_g.vlen)
 		{
-			if (G(j, i) == 0)
-			{
-				label_map.insert(make_pair(static_cast<int32_t>(label_p[i]),
-						static_cast<int32_t>(label_g[j])));
-				break;
-			}
+			label_map.insert(make_pair(static_cast<int32_t>(label_p[i]),
+					static_cast<int32_t>(label_g[col_to_row[i]])));
 		}
 	}
 
@@ -0,0 +1,126 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/evaluation/ConfusionMatrixAccumulator.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/mathematics/Math.h>
+
+#include <vector>
+
+using namespace shogun;
+
+ConfusionMatrixAccumulator::ConfusionMatrixAccumulator(
+		const std::shared_ptr<Labels>& predicted,
+		const std::shared_ptr<Labels>& ground_truth)
+{
+	require(predicted && ground_truth, "No labels provided.");
+	require(predicted->get_num_labels()==ground_truth->get_num_labels(),
+		"Number of predicted labels ({}) must match number of ground "
+		"truth labels ({})", predicted->get_num_labels(),
+		ground_truth->get_num_labels());
+
+	auto predicted_mc=multiclass_labels(predicted);
+	auto ground_truth_mc=multiclass_labels(ground_truth);
+
+	int32_t length=ground_truth_mc->get_num_labels();
+
+	/* predictions may contain classes the ground truth batch misses */
+	m_num_classes=Math::max(ground_truth_mc->get_num_classes(),
+			predicted_mc->get_num_classes());
+	m_total_count=length;
+	m_reject_count=0;
+	m_correct_count=0;
+
+	m_counts=SGVector<int64_t>(m_num_classes*m_num_classes);
+	m_counts.zero();
+
+	int64_t rejects=0;
+	#pragma omp parallel reduction(+:rejects)
+	{
+		/* per-thread count matrix, merged below */
+		std::vector<int64_t> local_counts(m_num_classes*m_num_classes, 0);
+
+		#pragma omp for nowait
+		for (int32_t i=0; i<length; i++)
+		{
+			int32_t predicted_label=predicted_mc->get_int_label(i);
+
+			if (predicted_label==MulticlassLabels::REJECTION_LABEL)
+			{
+				rejects++;
+				continue;
+			}
+
+			int32_t ground_truth_label=ground_truth_mc->get_int_label(i);
+			local_counts[predicted_label*m_num_classes+ground_truth_label]++;
+		}
+
+		#pragma omp critical
+		{
+			for (index_t j=0; j<m_counts.vlen; j++)
+				m_counts[j]+=local_counts[j];
+		}
+	}
+	m_reject_count=rejects;
+
+	for (int32_t c=0; c<m_num_classes; c++)
+		m_correct_count+=m_counts[c*m_num_classes+c];
+}
+
+SGMatrix<int32_t> ConfusionMatrixAccumulator::get_confusion_matrix() const
+{
+	SGMatrix<int32_t> confusion_matrix(m_num_classes, m_num_classes);
+	for (index_t i=0; i<m_counts.vlen; i++)
+		confusion_matrix[i]=static_cast<int32_t>(m_counts[i]);
+	return confusion_matrix;
+}
+
+float64_t ConfusionMatrixAccumulator::get_accuracy(bool ignore_rejects) const
+{
+	if (ignore_rejects)
+		return ((float64_t)m_correct_count)/m_total_count;
+
+	return ((float64_t)m_correct_count)/(m_total_count-m_reject_count);
+}
+
+int32_t ConfusionMatrixAccumulator::get_num_rejects() const
+{
+	return static_cast<int32_t>(m_reject_count);
+}
+
+int32_t ConfusionMatrixAccumulator::get_num_classes() const
+{
+	return m_num_classes;
+}
+
+SGVector<float64_t> ConfusionMatrixAccumulator::get_precision() const
+{
+	SGVector<float64_t> result(m_num_classes);
+	for (int32_t c=0; c<m_num_classes; c++)
+	{
+		int64_t predicted_as_c=0;
+		for (int32_t g=0; g<m_num_classes; g++)
+			predicted_as_c+=m_counts[c*m_num_classes+g];
+
+		result[c]=predicted_as_c>0 ?
+			((float64_t)m_counts[c*m_num_classes+c])/predicted_as_c : 0.0;
+	}
+	return result;
+}
+
+SGVector<float64_t> ConfusionMatrixAccumulator::get_recall() const
+{
+	SGVector<float64_t> result(m_num_classes);
+	for (int32_t g=0; g<m_num_classes; g++)
+	{
+		int64_t truly_g=0;
+		for (int32_t c=0; c<m_num_classes; c++)
+			truly_g+=m_counts[c*m_num_classes+g];
+
+		result[g]=truly_g>0 ?
+			((float64_t)m_counts[g*m_num_classes+g])/truly_g : 0.0;
+	}
+	return result;
+}
@@ -0,0 +1,87 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef CONFUSIONMATRIXACCUMULATOR_H_
+#define CONFUSIONMATRIXACCUMULATOR_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/common.h>
+
+#include <memory>
+
+namespace shogun
+{
+
+class Labels;
+
+/** @brief Single-pass confusion-count engine for multiclass evaluation.
+ *
+ * The constructor makes exactly one (thread-parallel) pass over the two
+ * label vectors and accumulates per-thread count matrices which are merged
+ * at the end. Accuracy, the confusion matrix, per-class precision/recall
+ * and derived metrics are then all read off the merged counts without
+ * touching the labels again, so evaluating several metrics on the same
+ * prediction batch costs one pass instead of one per metric.
+ *
+ * Counts are kept in 64 bit so very large batches do not overflow.
+ * Predictions equal to DenseLabels::REJECTION_LABEL are counted as rejects
+ * and excluded from the count matrix, matching MulticlassAccuracy.
+ */
+class ConfusionMatrixAccumulator
+{
+public:
+	/** Accumulates confusion counts in one parallel pass.
+	 *
+	 * @param predicted labels to be evaluated
+	 * @param ground_truth labels assumed to be correct
+	 */
+	ConfusionMatrixAccumulator(const std::shared_ptr<Labels>& predicted,
+			const std::shared_ptr<Labels>& ground_truth);
+
+	/** @return confusion matrix in the layout of
+	 * MulticlassAccuracy::get_confusion_matrix(), i.e. flat index
+	 * predicted_label*num_classes+ground_truth_label */
+	SGMatrix<int32_t> get_confusion_matrix() const;
+
+	/** @return fraction of correct non-rejected predictions; with
+	 * @p ignore_rejects, rejected predictions count into the total */
+	float64_t get_accuracy(bool ignore_rejects) const;
+
+	/** @return number of rejected predictions */
+	int32_t get_num_rejects() const;
+
+	/** @return number of classes the counts are accumulated over */
+	int32_t get_num_classes() const;
+
+	/** @return per-class precision, i.e. the fraction of predictions of
+	 * each class that were correct (0 for classes never predicted) */
+	SGVector<float64_t> get_precision() const;
+
+	/** @return per-class recall, i.e. the fraction of examples of each
+	 * class that were found (0 for classes without examples) */
+	SGVector<float64_t> get_recall() const;
+
+private:
+	/** merged confusion counts, flat predicted*num_classes+ground_truth */
+	SGVector<int64_t> m_counts;
+
+	/** number of classes */
+	int32_t m_num_classes;
+
+	/** number of label pairs seen */
+	int64_t m_total_count;
+
+	/** number of rejected predictions */
+	int64_t m_reject_count;
+
+	/** number of correct non-rejected predictions */
+	int64_t m_correct_count;
+};
+
+}
+
+#endif /* CONFUSIONMATRIXACCUMULATOR_H_ */
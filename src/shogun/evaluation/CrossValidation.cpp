@@ -11,7 +11,9 @@
 #include <shogun/evaluation/CrossValidationStorage.h>
 #include <shogun/evaluation/Evaluation.h>
 #include <shogun/evaluation/SplittingStrategy.h>
+#include <shogun/kernel/CustomKernel.h>
 #include <shogun/lib/observers/ObservedValueTemplated.h>
+#include <shogun/machine/KernelMachine.h>
 #include <shogun/machine/Machine.h>
 #include <shogun/mathematics/Statistics.h>
 #include <shogun/lib/View.h>
@@ -50,8 +52,11 @@ CrossValidation::~CrossValidation()
 void CrossValidation::init()
 {
 	m_num_runs = 1;
+	m_precompute_kernel = false;
 
 	SG_ADD(&m_num_runs, kNumRuns, "Number of repetitions");
+	SG_ADD(&m_precompute_kernel, kPrecomputeKernel,
+	    "Whether folds share one precomputed kernel matrix");
 }
 
 std::shared_ptr<EvaluationResult> CrossValidation::evaluate_impl() const
@@ -85,6 +90,11 @@ void CrossValidation::set_num_runs(int32_t num_runs)
 	m_num_runs = num_runs;
 }
 
+void CrossValidation::set_precompute_kernel(bool precompute)
+{
+	m_precompute_kernel = precompute;
+}
+
 float64_t CrossValidation::evaluate_one_run(int64_t index) const
 {
 	SG_TRACE("entering {}::evaluate_one_run()", get_name());
@@ -95,6 +105,26 @@ float64_t CrossValidation::evaluate_one_run(int64_t index) const
 
 	SGVector<float64_t> results(num_subsets);
 
+	/* with kernel precomputation enabled, the kernel is evaluated once on
+	 * the full data and every fold only takes subset views of the shared
+	 * read-only matrix */
+	SGMatrix<float32_t> precomputed;
+	if (m_precompute_kernel)
+	{
+		auto kernel_machine = m_machine->as<KernelMachine>();
+		require(kernel_machine,
+		    "Kernel precomputation requires a kernel machine, "
+		    "{} is not one", m_machine->get_name());
+
+		auto kernel = kernel_machine->get_kernel();
+		require(kernel, "Kernel precomputation requires the machine "
+			"to have a kernel set");
+		require(m_features, "Kernel precomputation requires features");
+
+		kernel->init(m_features, m_features);
+		precomputed = kernel->get_kernel_matrix<float32_t>();
+	}
+
 	#pragma omp parallel for shared(results)
 	for (auto i = 0; i<num_subsets; ++i)
 	{
@@ -109,17 +139,42 @@ float64_t CrossValidation::evaluate_one_run(int64_t index) const
 		SGVector<index_t> idx_test =
 			m_splitting_strategy->generate_subset_indices(i);
 
-		auto features_train = view(m_features, idx_train);
 		auto labels_train = view(m_labels, idx_train);
-		auto features_test = view(m_features, idx_test);
 		auto labels_test = view(m_labels, idx_test);
 
 		auto evaluation_criterion = make_clone(m_evaluation_criterion);
 
-		machine->set_labels(labels_train);
-		machine->train(features_train);
-
-		auto result_labels = machine->apply(features_test);
+		std::shared_ptr<Labels> result_labels;
+		if (m_precompute_kernel)
+		{
+			/* per-fold wrapper sharing the precomputed matrix; subsets
+			 * are per-wrapper, so folds do not interfere */
+			auto fold_kernel = std::make_shared<CustomKernel>(precomputed);
+			machine->as<KernelMachine>()->set_kernel(fold_kernel);
+
+			fold_kernel->add_row_subset(idx_train);
+			fold_kernel->add_col_subset(idx_train);
+			machine->set_labels(labels_train);
+			machine->train();
+			fold_kernel->remove_row_subset();
+			fold_kernel->remove_col_subset();
+
+			fold_kernel->add_row_subset(idx_train);
+			fold_kernel->add_col_subset(idx_test);
+			result_labels = machine->apply();
+			fold_kernel->remove_row_subset();
+			fold_kernel->remove_col_subset();
+		}
+		else
+		{
+			auto features_train = view(m_features, idx_train);
+			auto features_test = view(m_features, idx_test);
+
+			machine->set_labels(labels_train);
+			machine->train(features_train);
+
+			result_labels = machine->apply(features_test);
+		}
 
 		results[i] = evaluation_criterion->evaluate(result_labels, labels_test);
 		io::info("Result of cross-validation fold {}/{} is {}", i+1, num_subsets, results[i]);
@@ -159,6 +159,18 @@ namespace shogun
 		/** setter for the number of runs to use for evaluation */
 		void set_num_runs(int32_t num_runs);
 
+		/** Enable sharing one precomputed kernel matrix across folds.
+		 * Only valid for kernel machines. The kernel is evaluated once
+		 * per run on the full feature set and every fold trains and
+		 * tests through a lightweight CustomKernel view with the fold's
+		 * train/test index subsets, instead of re-computing kernel rows
+		 * per fold. Requires the full kernel matrix to fit in memory
+		 * (float32 storage).
+		 *
+		 * @param precompute whether to precompute the kernel matrix
+		 */
+		void set_precompute_kernel(bool precompute);
+
 		/** @return name of the SGSerializable */
 		const char* get_name() const override
 		{
@@ -189,9 +201,14 @@ namespace shogun
 		/** number of evaluation runs for one fold */
 		int32_t m_num_runs;
 
+		/** whether folds share one precomputed kernel matrix */
+		bool m_precompute_kernel;
+
 	#ifndef SWIG
 	public:
 		static constexpr std::string_view kNumRuns = "num_runs";
+		static constexpr std::string_view kPrecomputeKernel =
+		    "precompute_kernel";
 	#endif
 	};
 }
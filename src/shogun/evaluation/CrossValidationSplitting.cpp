@@ -56,4 +56,7 @@ void CrossValidationSplitting::build_subsets()
 	 * elements, which happens if the number of class labels is not equal to
 	 * the number of subsets (external random state important for threads) */
 	random::shuffle(m_subset_indices, m_prng);
+
+	/* compile the split into contiguous ranges shareable across folds */
+	compile_plan();
 }
@@ -90,6 +90,15 @@ CrossValidationStorage::CrossValidationStorage() : EvaluationResult()
 {
 	m_num_runs = 0;
 	m_num_folds = 0;
+	m_streaming_mode = false;
+	m_retain_machines = false;
+	m_retain_labels = false;
+	m_retain_indices = false;
+	m_aggregate_count = 0;
+	m_aggregate_mean = 0;
+	m_aggregate_m2 = 0;
+	m_confusion_counts = SGVector<int64_t>(4);
+	m_confusion_counts.zero();
 
 	SG_ADD(
 	    &m_num_runs, kNumRuns, "The total number of cross-validation runs",
@@ -101,8 +110,18 @@ CrossValidationStorage::CrossValidationStorage() : EvaluationResult()
 	    &m_original_labels, kOriginalLabels,
 	    "The labels used for this cross-validation",
 	    ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_streaming_mode, kStreamingMode,
+	    "Whether fold results are aggregated instead of retained");
 	this->watch_param(
 	    "folds", &m_folds_results, AnyParameterProperties("Fold results"));
+	watch_method(
+	    "aggregated_mean", &CrossValidationStorage::get_aggregated_mean);
+	watch_method(
+	    "aggregated_variance",
+	    &CrossValidationStorage::get_aggregated_variance);
+	watch_method(
+	    "confusion_counts", &CrossValidationStorage::get_confusion_counts);
 }
 
 CrossValidationStorage::~CrossValidationStorage() = default;
@@ -114,8 +133,131 @@ void CrossValidationStorage::post_init()
 void CrossValidationStorage::append_fold_result(
     std::shared_ptr<CrossValidationFoldStorage> result)
 {
-	auto cloned = result->clone()->as<CrossValidationFoldStorage>();
-	m_folds_results.push_back(cloned);
+	if (!m_streaming_mode)
+	{
+		auto cloned = result->clone()->as<CrossValidationFoldStorage>();
+		m_folds_results.push_back(cloned);
+		return;
+	}
+
+	/* fold the result into the running aggregates (Welford) instead of
+	 * retaining the whole fold object */
+	float64_t evaluation_result = result->get<float64_t>(
+	    CrossValidationFoldStorage::kEvalulationResult);
+	m_aggregate_count++;
+	float64_t delta = evaluation_result - m_aggregate_mean;
+	m_aggregate_mean += delta / m_aggregate_count;
+	m_aggregate_m2 += delta * (evaluation_result - m_aggregate_mean);
+
+	auto predicted =
+	    result->get<Labels>(CrossValidationFoldStorage::kTestResult);
+	auto ground_truth =
+	    result->get<Labels>(CrossValidationFoldStorage::kTestTrueResult);
+	if (predicted && ground_truth &&
+	    predicted->get_label_type() == LT_BINARY &&
+	    ground_truth->get_label_type() == LT_BINARY)
+	{
+		for (auto i : range(predicted->get_num_labels()))
+		{
+			bool p = predicted->get_label(i) > 0;
+			bool t = ground_truth->get_label(i) > 0;
+			if (p && t)
+				m_confusion_counts[0]++;
+			else if (p && !t)
+				m_confusion_counts[1]++;
+			else if (!p && !t)
+				m_confusion_counts[2]++;
+			else
+				m_confusion_counts[3]++;
+		}
+	}
+
+	/* opt-in retention of a slimmed-down fold holding only the
+	 * requested artifacts next to the cheap scalars */
+	if (m_retain_machines || m_retain_labels || m_retain_indices)
+	{
+		auto slim = std::make_shared<CrossValidationFoldStorage>();
+		slim->put(
+		    CrossValidationFoldStorage::kCurrentRunIndex,
+		    result->get<index_t>(
+		        CrossValidationFoldStorage::kCurrentRunIndex));
+		slim->put(
+		    CrossValidationFoldStorage::kCurrentFoldIndex,
+		    result->get<index_t>(
+		        CrossValidationFoldStorage::kCurrentFoldIndex));
+		slim->put(
+		    CrossValidationFoldStorage::kEvalulationResult,
+		    evaluation_result);
+		if (m_retain_machines)
+		{
+			slim->put(
+			    CrossValidationFoldStorage::kTrainedMachine,
+			    result->get<Machine>(
+			        CrossValidationFoldStorage::kTrainedMachine));
+		}
+		if (m_retain_labels)
+		{
+			slim->put(
+			    CrossValidationFoldStorage::kTestResult, predicted);
+			slim->put(
+			    CrossValidationFoldStorage::kTestTrueResult, ground_truth);
+		}
+		if (m_retain_indices)
+		{
+			slim->put(
+			    CrossValidationFoldStorage::kTrainIndices,
+			    result->get<SGVector<index_t>>(
+			        CrossValidationFoldStorage::kTrainIndices));
+			slim->put(
+			    CrossValidationFoldStorage::kTestIndices,
+			    result->get<SGVector<index_t>>(
+			        CrossValidationFoldStorage::kTestIndices));
+		}
+		m_folds_results.push_back(slim);
+	}
+}
+
+void CrossValidationStorage::set_streaming_mode(bool streaming)
+{
+	m_streaming_mode = streaming;
+}
+
+void CrossValidationStorage::set_retained_artifacts(
+    bool machines, bool labels, bool indices)
+{
+	m_retain_machines = machines;
+	m_retain_labels = labels;
+	m_retain_indices = indices;
+}
+
+float64_t CrossValidationStorage::get_aggregated_mean() const
+{
+	if (m_aggregate_count == 0)
+		error("No fold results were aggregated, enable streaming mode "
+		      "and append fold results first");
+
+	return m_aggregate_mean;
+}
+
+float64_t CrossValidationStorage::get_aggregated_variance() const
+{
+	if (m_aggregate_count == 0)
+		error("No fold results were aggregated, enable streaming mode "
+		      "and append fold results first");
+
+	if (m_aggregate_count < 2)
+		return 0;
+	return m_aggregate_m2 / (m_aggregate_count - 1);
+}
+
+SGVector<int64_t> CrossValidationStorage::get_confusion_counts() const
+{
+	return m_confusion_counts;
+}
+
+index_t CrossValidationStorage::get_num_retained_folds() const
+{
+	return static_cast<index_t>(m_folds_results.size());
 }
 
 void CrossValidationStorage::print_result()
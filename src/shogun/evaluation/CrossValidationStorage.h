@@ -149,6 +149,46 @@ namespace shogun
 		 */
 		virtual void append_fold_result(std::shared_ptr<CrossValidationFoldStorage> result);
 
+		/**
+		 * Enable or disable streaming aggregation. In streaming mode,
+		 * appended fold results are folded into running aggregates
+		 * (mean, variance and, for binary labels, confusion counts)
+		 * and the per-fold objects are discarded immediately instead of
+		 * being cloned and retained, so memory usage stays constant in
+		 * the number of runs and folds. Individual artifacts can still
+		 * be retained through set_retained_artifacts().
+		 * @param streaming whether to aggregate instead of retaining
+		 */
+		void set_streaming_mode(bool streaming);
+
+		/**
+		 * Choose which per-fold artifacts to retain while in streaming
+		 * mode. Retained folds are slimmed down to the run/fold indices,
+		 * the fold evaluation result and the requested artifacts only.
+		 * Has no effect outside streaming mode, where everything is
+		 * retained.
+		 * @param machines retain the trained machine of each fold
+		 * @param labels retain predicted and ground truth labels
+		 * @param indices retain train and test index sets
+		 */
+		void set_retained_artifacts(bool machines, bool labels, bool indices);
+
+		/** @return running mean of the fold evaluation results
+		 * aggregated in streaming mode */
+		float64_t get_aggregated_mean() const;
+
+		/** @return running (unbiased) variance of the fold evaluation
+		 * results aggregated in streaming mode */
+		float64_t get_aggregated_variance() const;
+
+		/** @return aggregated binary confusion counts in the order
+		 * [TP, FP, TN, FN], accumulated over all folds whose labels
+		 * were binary */
+		SGVector<int64_t> get_confusion_counts() const;
+
+		/** @return number of fold results currently retained */
+		index_t get_num_retained_folds() const;
+
 	protected:
 		/**
 		 * Overridden create_empty() since this class
@@ -168,12 +208,37 @@ namespace shogun
 
 		/** Vector with all the folds results */
 		std::vector<std::shared_ptr<EvaluationResult>> m_folds_results;
-	
+
+		/** Whether appended folds are aggregated instead of retained */
+		bool m_streaming_mode;
+
+		/** Whether trained machines are retained in streaming mode */
+		bool m_retain_machines;
+
+		/** Whether label vectors are retained in streaming mode */
+		bool m_retain_labels;
+
+		/** Whether index sets are retained in streaming mode */
+		bool m_retain_indices;
+
+		/** Number of folds aggregated so far */
+		index_t m_aggregate_count;
+
+		/** Running mean of fold evaluation results */
+		float64_t m_aggregate_mean;
+
+		/** Running sum of squared deviations (Welford) */
+		float64_t m_aggregate_m2;
+
+		/** Aggregated binary confusion counts [TP, FP, TN, FN] */
+		SGVector<int64_t> m_confusion_counts;
+
 	#ifndef SWIG
 	public:
 		static constexpr std::string_view kNumRuns = "num_runs";
 		static constexpr std::string_view kNumFold = "num_folds";
 		static constexpr std::string_view kOriginalLabels = "labels";
+		static constexpr std::string_view kStreamingMode = "streaming_mode";
 	#endif
 	};
 }
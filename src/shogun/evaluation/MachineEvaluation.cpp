@@ -60,6 +60,7 @@ void MachineEvaluation::init()
 	m_evaluation_criterion = NULL;
 	m_cancel_computation = false;
 	m_pause_computation_flag = false;
+	m_evaluating = false;
 
 	SG_ADD(&m_machine, kMachine, "Used learning machine");
 	SG_ADD(&m_features, kFeatures, "Used features");
@@ -95,6 +96,43 @@ std::shared_ptr<EvaluationResult> MachineEvaluation::evaluate() const
 	return result;
 };
 
+std::shared_future<std::shared_ptr<EvaluationResult>>
+MachineEvaluation::evaluate_async() const
+{
+	require(
+	    !m_evaluating.load(),
+	    "{}::evaluate_async() is only possible if no other evaluation "
+	    "is running on this instance, clone() it to run several "
+	    "evaluations concurrently",
+	    get_name());
+
+	m_evaluating = true;
+	auto self =
+	    std::static_pointer_cast<const MachineEvaluation>(shared_from_this());
+	return std::async(
+	           std::launch::async,
+	           [self]()
+	           {
+		           try
+		           {
+			           auto result = self->evaluate();
+			           self->m_evaluating = false;
+			           return result;
+		           }
+		           catch (...)
+		           {
+			           self->m_evaluating = false;
+			           throw;
+		           }
+	           })
+	    .share();
+}
+
+bool MachineEvaluation::is_evaluating() const
+{
+	return m_evaluating.load();
+}
+
 std::shared_ptr<Machine> MachineEvaluation::get_machine() const
 {
 	return m_machine;
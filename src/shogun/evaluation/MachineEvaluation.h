@@ -14,6 +14,9 @@
 #include <shogun/lib/StoppableSGObject.h>
 #include <shogun/lib/config.h>
 
+#include <atomic>
+#include <future>
+
 namespace shogun
 {
 	class Machine;
@@ -73,6 +76,32 @@ namespace shogun
 		 */
 		virtual std::shared_ptr<EvaluationResult> evaluate() const;
 
+#ifndef SWIG
+		/** Starts the evaluation on a background thread and returns
+		 * immediately. The returned future resolves to the same result
+		 * evaluate() would have produced (or rethrows its exception on
+		 * get()). This allows a model selection driver to keep several
+		 * evaluations in flight and overlap the setup of one candidate
+		 * with the compute of another.
+		 *
+		 * The instance is kept alive by the background thread until the
+		 * evaluation finishes. Only one asynchronous evaluation may run
+		 * per instance at a time; clone() the evaluation to run several
+		 * candidates concurrently. A running evaluation can be stopped
+		 * through the premature stopping mechanism inherited from
+		 * StoppableSGObject, and progress can be observed by subscribing
+		 * to the observable parameters the subclass emits.
+		 *
+		 * @return future holding the evaluation result
+		 */
+		virtual std::shared_future<std::shared_ptr<EvaluationResult>>
+		evaluate_async() const;
+
+		/** @return whether an evaluation started by evaluate_async() is
+		 * still running on this instance */
+		bool is_evaluating() const;
+#endif
+
 		/** @return underlying learning machine */
 		std::shared_ptr<Machine> get_machine() const;
 
@@ -104,6 +133,9 @@ namespace shogun
 
 		/** Criterion for evaluation */
 		std::shared_ptr<Evaluation> m_evaluation_criterion;
+
+		/** Whether an asynchronous evaluation is currently running */
+		mutable std::atomic<bool> m_evaluating;
 	#ifndef SWIG
 	public:
 		static constexpr std::string_view kMachine = "machine";
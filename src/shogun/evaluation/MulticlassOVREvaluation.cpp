@@ -7,6 +7,7 @@
 #include <shogun/evaluation/MulticlassOVREvaluation.h>
 #include <shogun/evaluation/ROCEvaluation.h>
 #include <shogun/evaluation/PRCEvaluation.h>
+#include <shogun/evaluation/ThresholdSweep.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Statistics.h>
 
@@ -53,13 +54,40 @@ float64_t MulticlassOVREvaluation::evaluate(std::shared_ptr<Labels> predicted, s
 			all(i,j) = confs[j];
 		}
 	}
-	if (std::dynamic_pointer_cast<ROCEvaluation>(m_binary_evaluation) || std::dynamic_pointer_cast<PRCEvaluation>(m_binary_evaluation))
+	bool is_roc = std::dynamic_pointer_cast<ROCEvaluation>(m_binary_evaluation) != nullptr;
+	bool is_prc = std::dynamic_pointer_cast<PRCEvaluation>(m_binary_evaluation) != nullptr;
+	if (is_roc || is_prc)
 	{
 		for (int32_t i=0; i<m_num_graph_results; i++)
 			m_graph_results[i].~SGMatrix<float64_t>();
 		SG_FREE(m_graph_results);
 		m_graph_results = SG_MALLOC(SGMatrix<float64_t>, n_classes);
 		m_num_graph_results = n_classes;
+
+		/* the shared sweep engine sorts each class once and the classes
+		 * are independent, so sweep them in parallel */
+		#pragma omp parallel for
+		for (int32_t c=0; c<n_classes; c++)
+		{
+			SGVector<float64_t> scores(all.get_column_vector(c),n_labels,false);
+			SGVector<float64_t> gt_vec(n_labels);
+			for (int32_t i=0; i<n_labels; i++)
+			{
+				if (ground_truth_mc->get_label(i)==c)
+					gt_vec[i] = +1.0;
+				else
+					gt_vec[i] = -1.0;
+			}
+			ThresholdSweep sweep(scores, gt_vec);
+			SGVector<float64_t> thresholds;
+
+			new (&m_graph_results[c]) SGMatrix<float64_t>();
+			if (is_roc)
+				m_last_results[c] = sweep.compute_ROC(m_graph_results[c], thresholds);
+			else
+				m_last_results[c] = sweep.compute_PRC(m_graph_results[c], thresholds);
+		}
+		return Statistics::mean(m_last_results);
 	}
 	for (int32_t c=0; c<n_classes; c++)
 	{
@@ -74,17 +102,6 @@ float64_t MulticlassOVREvaluation::evaluate(std::shared_ptr<Labels> predicted, s
 		}
 		auto gt = std::make_shared<BinaryLabels>(gt_vec);
 		m_last_results[c] = m_binary_evaluation->evaluate(pred, gt);
-
-		if (std::dynamic_pointer_cast<ROCEvaluation>(m_binary_evaluation))
-		{
-			new (&m_graph_results[c]) SGMatrix<float64_t>();
-			m_graph_results[c] = (std::static_pointer_cast<ROCEvaluation>(m_binary_evaluation))->get_ROC();
-		}
-		if (std::dynamic_pointer_cast<PRCEvaluation>(m_binary_evaluation))
-		{
-			new (&m_graph_results[c]) SGMatrix<float64_t>();
-			m_graph_results[c] = (std::static_pointer_cast<PRCEvaluation>(m_binary_evaluation))->get_PRC();
-		}
 	}
 	return Statistics::mean(m_last_results);
 }
@@ -6,6 +6,7 @@
  */
 
 #include <shogun/evaluation/ROCEvaluation.h>
+#include <shogun/evaluation/ThresholdSweep.h>
 #include <shogun/mathematics/Math.h>
 
 using namespace shogun;
@@ -45,102 +46,28 @@ float64_t ROCEvaluation::evaluate_roc(const std::shared_ptr<BinaryLabels>& predi
 	ASSERT(predicted->get_num_labels() == ground_truth->get_num_labels())
 	ground_truth->ensure_valid();
 
-	// assume threshold as negative infinity
-	float64_t threshold = Math::ALMOST_NEG_INFTY;
-	// false positive rate
-	float64_t fp = 0.0;
-	// true positive rate
-	float64_t tp = 0.0;
-
-	int32_t i;
-	// total number of positive labels in predicted
-	int32_t pos_count = 0;
-	int32_t neg_count = 0;
-
-	// initialize number of labels and labels
-	SGVector<float64_t> orig_labels(predicted->get_num_labels());
-	int32_t length = orig_labels.vlen;
-	for (i = 0; i < length; i++)
-		orig_labels[i] = predicted->get_value(i);
-	float64_t* labels =
-	    SGVector<float64_t>::clone_vector(orig_labels.vector, length);
-
-	// get sorted indexes
-	SGVector<int32_t> idxs(length);
-	for (i = 0; i < length; i++)
-		idxs[i] = i;
-
-	Math::qsort_backward_index(labels, idxs.vector, idxs.vlen);
-
-	// number of different predicted labels
-	int32_t diff_count = 1;
-
-	// get number of different labels
-	for (i = 0; i < length - 1; i++)
+	// one sort, all curves derived from the shared sweep engine
+	SGVector<float64_t> scores(predicted->get_num_labels());
+	SGVector<float64_t> truth(ground_truth->get_num_labels());
+	for (int32_t i = 0; i < scores.vlen; i++)
 	{
-		if (labels[i] != labels[i + 1])
-			diff_count++;
+		scores[i] = predicted->get_value(i);
+		truth[i] = ground_truth->get_label(i);
 	}
+	ThresholdSweep sweep(scores, truth);
 
-	SG_FREE(labels);
-
-	// initialize graph and auROC
-	m_ROC_graph = SGMatrix<float64_t>(2, diff_count + 1);
-	m_thresholds = SGVector<float64_t>(length);
-	m_auROC = 0.0;
-
-	// get total numbers of positive and negative labels
-	for (i = 0; i < length; i++)
-	{
-		if (ground_truth->get_label(i) >= 0)
-			pos_count++;
-		else
-			neg_count++;
-	}
-
-	// assure both number of positive and negative examples is >0
 	require(
-	    pos_count > 0,
+	    sweep.get_num_positives() > 0,
 	    "{}::evaluate_roc(): Number of positive labels is "
 	    "zero, ROC fails!",
 	    get_name());
 	require(
-	    neg_count > 0,
+	    sweep.get_num_negatives() > 0,
 	    "{}::evaluate_roc(): Number of negative labels is "
 	    "zero, ROC fails!",
 	    get_name());
 
-	int32_t j = 0;
-	float64_t label;
-
-	// create ROC curve and calculate auROC
-	for (i = 0; i < length; i++)
-	{
-		label = predicted->get_value(idxs[i]);
-
-		if (label != threshold)
-		{
-			threshold = label;
-			m_ROC_graph[2 * j] = fp / neg_count;
-			m_ROC_graph[2 * j + 1] = tp / pos_count;
-			j++;
-		}
-
-		m_thresholds[i] = threshold;
-
-		if (ground_truth->get_label(idxs[i]) > 0)
-			tp += 1.0;
-		else
-			fp += 1.0;
-	}
-
-	// add (1,1) to ROC curve
-	m_ROC_graph[2 * diff_count] = 1.0;
-	m_ROC_graph[2 * diff_count + 1] = 1.0;
-
-	// calc auROC using area under curve
-	m_auROC =
-	    Math::area_under_curve(m_ROC_graph.matrix, diff_count + 1, false);
+	m_auROC = sweep.compute_ROC(m_ROC_graph, m_thresholds);
 
 	m_computed = true;
 
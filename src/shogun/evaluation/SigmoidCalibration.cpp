@@ -7,8 +7,10 @@
 #include <shogun/evaluation/SigmoidCalibration.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
+#include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
+using namespace Eigen;
 using namespace shogun;
 
 SigmoidCalibration::SigmoidCalibration() : Calibration()
@@ -151,33 +153,38 @@ SigmoidCalibration::calibrate_multiclass(std::shared_ptr<MulticlassLabels> predi
 	SGMatrix<float64_t> confidence_values(num_samples, num_classes);
 
 	for (index_t i = 0; i < num_classes; ++i)
-	{
-		auto class_values = predictions->get_confidences_for_class(i);
-
-		Statistics::SigmoidParamters sigmoid_params;
-		sigmoid_params.a = m_sigmoid_as[i];
-		sigmoid_params.b = m_sigmoid_bs[i];
+		confidence_values.set_column(
+		    i, predictions->get_confidences_for_class(i));
+
+	/* blocked apply: sigmoid of the whole score matrix with per-class
+	 * parameters broadcast over columns, then row-wise normalization,
+	 * instead of one pass per class plus one per sample */
+	Map<MatrixXd> conf(confidence_values.matrix, num_samples, num_classes);
+	Map<VectorXd> a_vec(m_sigmoid_as.vector, num_classes);
+	Map<VectorXd> b_vec(m_sigmoid_bs.vector, num_classes);
+
+	MatrixXd fApB_mat = conf * a_vec.asDiagonal();
+	fApB_mat.rowwise() += b_vec.transpose();
+	ArrayXXd fApB = fApB_mat.array();
+	ArrayXXd expn = (-fApB.abs()).exp();
+	ArrayXXd denom = 1.0 + expn;
+	conf = ((fApB >= 0).select(expn / denom, 1.0 / denom)).matrix();
 
-		SGVector<float64_t> calibrated_values =
-		    calibrate_values(class_values, sigmoid_params);
-
-		confidence_values.set_column(i, calibrated_values);
-	}
+	/** Normalize the probabilities. */
+	ArrayXd sums = conf.array().rowwise().sum();
+	ArrayXd safe_sums = (sums == 0).select(1.0, sums);
+	conf.array().colwise() /= safe_sums;
 
 	auto result_labels = std::make_shared<MulticlassLabels>(num_samples);
 	result_labels->allocate_confidences_for(num_classes);
 
-	/** Normalize the probabilities. */
 	for (index_t i = 0; i < num_samples; ++i)
 	{
 		SGVector<float64_t> values = confidence_values.get_row_vector(i);
-		float64_t sum = SGVector<float64_t>::sum(values);
 
 		/** All classes have equal probability when sum is zero */
-		if (sum == 0)
+		if (sums[i] == 0)
 			linalg::add_scalar(values, 1. / (float64_t)num_classes);
-		else
-			linalg::scale(values, values, 1 / sum);
 		result_labels->set_multiclass_confidences(i, values);
 	}
 	return result_labels;
@@ -186,12 +193,12 @@ SigmoidCalibration::calibrate_multiclass(std::shared_ptr<MulticlassLabels> predi
 SGVector<float64_t> SigmoidCalibration::calibrate_values(
     SGVector<float64_t> values, Statistics::SigmoidParamters params)
 {
-	/** Calibrate values by passing them to a sigmoid function. */
-	for (index_t i = 0; i < values.vlen; ++i)
-	{
-		float64_t fApB = values[i] * params.a + params.b;
-		values[i] = fApB >= 0 ? std::exp(-fApB) / (1.0 + std::exp(-fApB))
-		                      : 1.0 / (1 + std::exp(fApB));
-	}
+	/** Calibrate values by passing them to a sigmoid function. Single
+	 * vectorized pass; exp(-|fApB|) serves both branches. */
+	Map<ArrayXd> values_arr(values.vector, values.vlen);
+	ArrayXd fApB = values_arr * params.a + params.b;
+	ArrayXd expn = (-fApB.abs()).exp();
+	ArrayXd denom = 1.0 + expn;
+	values_arr = (fApB >= 0).select(expn / denom, 1.0 / denom);
 	return values;
 }
@@ -39,9 +39,36 @@ void SplittingStrategy::reset_subsets()
 	m_subset_indices.clear();
 	m_subset_indices.resize(m_num_subsets);
 
+	/* invalidate any compiled plan */
+	m_plan_indices=SGVector<index_t>();
+	m_plan_offsets=SGVector<index_t>();
+	m_plan_subset_of=SGVector<index_t>();
+
 	m_is_filled=false;
 }
 
+void SplittingStrategy::compile_plan()
+{
+	index_t num_labels=m_labels->get_num_labels();
+
+	m_plan_indices=SGVector<index_t>(num_labels);
+	m_plan_offsets=SGVector<index_t>(m_num_subsets+1);
+	m_plan_subset_of=SGVector<index_t>(num_labels);
+
+	index_t offset=0;
+	for (index_t i=0; i<m_num_subsets; ++i)
+	{
+		auto& current=m_subset_indices[i];
+		m_plan_offsets[i]=offset;
+		for (auto idx : current)
+		{
+			m_plan_indices[offset++]=idx;
+			m_plan_subset_of[idx]=i;
+		}
+	}
+	m_plan_offsets[m_num_subsets]=offset;
+}
+
 void SplittingStrategy::init()
 {
 	m_labels=NULL;
@@ -74,6 +101,17 @@ SGVector<index_t> SplittingStrategy::generate_subset_indices(index_t subset_idx)
 				get_name(), get_name());
 	}
 
+	/* with a compiled plan, the subset is a contiguous range */
+	if (m_plan_offsets.vlen==m_num_subsets+1)
+	{
+		index_t start=m_plan_offsets[subset_idx];
+		index_t num_elements=m_plan_offsets[subset_idx+1]-start;
+		SGVector<index_t> result(num_elements, true);
+		sg_memcpy(result.vector, m_plan_indices.vector+start,
+				sizeof(index_t)*num_elements);
+		return result;
+	}
+
 	/* construct SGVector copy from index vector */
 	auto& to_copy = m_subset_indices.at(subset_idx);
 
@@ -97,6 +135,24 @@ SGVector<index_t> SplittingStrategy::generate_subset_inverse(index_t subset_idx)
 				get_name(), get_name());
 	}
 
+	/* with a compiled plan, the reverse map turns the quadratic
+	 * membership test into one linear scan */
+	if (m_plan_offsets.vlen==m_num_subsets+1)
+	{
+		index_t subset_size=
+				m_plan_offsets[subset_idx+1]-m_plan_offsets[subset_idx];
+		SGVector<index_t> result(
+				m_labels->get_num_labels()-subset_size, true);
+
+		index_t index=0;
+		for (index_t i=0; i<m_plan_subset_of.vlen; ++i)
+		{
+			if (m_plan_subset_of[i]!=subset_idx)
+				result.vector[index++]=i;
+		}
+		return result;
+	}
+
 	auto& to_invert = m_subset_indices.at(subset_idx);
 
 	SGVector<index_t> result(
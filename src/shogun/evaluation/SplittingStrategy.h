@@ -88,6 +88,17 @@ protected:
 	 * be empty again. To be called before build_subsets. */
 	void reset_subsets();
 
+	/** Compiles the filled m_subset_indices into a flat plan: one
+	 * contiguous index array with per-subset offsets plus a reverse
+	 * index-to-subset map. To be called at the end of build_subsets
+	 * implementations. With a compiled plan, generate_subset_indices()
+	 * becomes a single copy of a contiguous range and
+	 * generate_subset_inverse() a single linear scan, and since the plan
+	 * is read-only afterwards it can be shared by concurrent folds
+	 * without re-deriving the split. Implementations that do not call
+	 * this fall back to the uncompiled access paths. */
+	void compile_plan();
+
 private:
 	void init();
 
@@ -106,6 +117,16 @@ protected:
 	/** flag to check whether there is a set of index sets stored. If not,
 	 * call build_subsets() */
 	bool m_is_filled;
+
+	/** compiled plan: all subset indices concatenated contiguously */
+	SGVector<index_t> m_plan_indices;
+
+	/** compiled plan: start offset of every subset in m_plan_indices,
+	 * with one trailing end offset (empty if no plan is compiled) */
+	SGVector<index_t> m_plan_offsets;
+
+	/** compiled plan: subset index every element belongs to */
+	SGVector<index_t> m_plan_subset_of;
 #ifndef SWIG
 public:
 	static constexpr std::string_view kLabels = "labels";
@@ -26,64 +26,65 @@ StratifiedCrossValidationSplitting::StratifiedCrossValidationSplitting(
 {
 }
 
-void StratifiedCrossValidationSplitting::check_labels() const
+void StratifiedCrossValidationSplitting::ensure_class_cache()
 {
-	auto dense_labels = std::static_pointer_cast<DenseLabels>(m_labels);
-	auto classes = dense_labels->get_labels().unique();
+	/* class membership of indices does not change between runs, only
+	 * rebuild when the labels themselves changed */
+	if (m_cache_source == m_labels && !m_cached_class_indices.empty())
+		return;
 
-	SGVector<index_t> labels_per_class(classes.size());
+	auto dense_labels = m_labels->as<DenseLabels>();
+	m_cached_classes = dense_labels->get_labels().unique();
 
-	for (auto i : range(classes.size()))
+	m_cached_class_indices.clear();
+	m_cached_class_indices.resize(m_cached_classes.size());
+
+	/* single pass over the labels instead of one scan per class */
+	for (auto j : range(m_labels->get_num_labels()))
 	{
-		labels_per_class[i] = 0;
-		for (auto j : range(dense_labels->get_num_labels()))
+		float64_t label = dense_labels->get_label(j);
+		for (auto i : range(m_cached_classes.size()))
 		{
-			if (classes[i] == dense_labels->get_label(j))
-				labels_per_class[i]++;
+			if (label == m_cached_classes[i])
+			{
+				m_cached_class_indices[i].push_back(j);
+				break;
+			}
 		}
 	}
 
-	for (index_t i = 0; i < classes.size(); ++i)
+	m_cache_source = m_labels;
+}
+
+void StratifiedCrossValidationSplitting::check_labels() const
+{
+	for (index_t i = 0; i < m_cached_classes.size(); ++i)
 	{
-		if (labels_per_class[i] < m_num_subsets)
+		index_t labels_per_class = m_cached_class_indices[i].size();
+		if (labels_per_class < m_num_subsets)
 		{
 			io::warn(
 			    "There are only {} labels of class {:.18g}, but {} "
 			    "subsets. Labels of that class will not appear in every "
 			    "subset!",
-			    labels_per_class[i], classes[i], m_num_subsets);
+			    labels_per_class, m_cached_classes[i], m_num_subsets);
 		}
 	}
 }
 
 void StratifiedCrossValidationSplitting::build_subsets()
 {
+	ensure_class_cache();
 	check_labels();
 
 	/* ensure that subsets are empty and set flag to filled */
 	reset_subsets();
 	m_is_filled=true;
 
-	auto dense_labels = m_labels->as<DenseLabels>();
-	auto classes = dense_labels->get_labels().unique();
+	auto classes = m_cached_classes;
 
-	/* for every label, build set for indices */
-	std::vector<std::vector<index_t>> label_indices;
-	label_indices.resize(classes.size());
-
-	/* fill set with indices, for each label type ... */
-	for (auto i : range(classes.size()))
-	{
-		/* ... iterate over all labels and add indices with same label to set */
-		for (auto j : range(m_labels->get_num_labels()))
-		{
-			if (dense_labels->get_label(j) == classes[i])
-			{
-				label_indices[i].push_back(j);
-
-			}
-		}
-	}
+	/* shuffled working copy of the cached per-class index sets */
+	std::vector<std::vector<index_t>> label_indices = m_cached_class_indices;
 
 	/* shuffle created label sets */
 	for (index_t i=0; i<label_indices.size(); ++i)
@@ -118,4 +119,7 @@ void StratifiedCrossValidationSplitting::build_subsets()
 	 * elements, which happens if the number of class labels is not equal to
 	 * the number of subsets (external random state important for threads) */
 	random::shuffle(m_subset_indices, m_prng);
+
+	/* compile the split into contiguous ranges shareable across folds */
+	compile_plan();
 }
@@ -52,6 +52,21 @@ protected:
 	 * extreme case of a two class labeling. */
 
 	void check_labels() const;
+
+	/** (Re)builds the per-class index cache if the labels changed. The
+	 * class membership of every index does not change between runs, so
+	 * repeated build_subsets() calls only reshuffle the cached sets
+	 * instead of rescanning the labels once per class. */
+	void ensure_class_cache();
+
+	/** distinct classes of the cached labels */
+	SGVector<float64_t> m_cached_classes;
+
+	/** per-class index sets of the cached labels */
+	std::vector<std::vector<index_t>> m_cached_class_indices;
+
+	/** labels the cache was built from */
+	std::shared_ptr<Labels> m_cache_source;
 };
 }
 
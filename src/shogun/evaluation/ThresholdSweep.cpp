@@ -0,0 +1,194 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/evaluation/ThresholdSweep.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/mathematics/Math.h>
+
+using namespace shogun;
+
+ThresholdSweep::ThresholdSweep(const SGVector<float64_t>& scores,
+		const SGVector<float64_t>& truth)
+{
+	require(scores.vlen==truth.vlen,
+		"Number of scores ({}) must match number of labels ({})",
+		scores.vlen, truth.vlen);
+
+	int32_t length=scores.vlen;
+	m_sorted_scores=scores.clone();
+
+	SGVector<int32_t> order(length);
+	order.range_fill();
+	Math::qsort_backward_index(m_sorted_scores.vector, order.vector, length);
+
+	m_sorted_positive=SGVector<bool>(length);
+	m_pos_count=0;
+	m_neg_count=0;
+	for (int32_t i=0; i<length; i++)
+	{
+		bool positive=truth[order[i]]>0;
+		m_sorted_positive[i]=positive;
+		if (positive)
+			m_pos_count++;
+		else
+			m_neg_count++;
+	}
+}
+
+int32_t ThresholdSweep::count_distinct() const
+{
+	int32_t diff_count=1;
+	for (int32_t i=0; i<m_sorted_scores.vlen-1; i++)
+	{
+		if (m_sorted_scores[i]!=m_sorted_scores[i+1])
+			diff_count++;
+	}
+	return diff_count;
+}
+
+float64_t ThresholdSweep::compute_ROC(SGMatrix<float64_t>& graph,
+		SGVector<float64_t>& thresholds) const
+{
+	require(m_pos_count>0, "Number of positive labels is zero, ROC fails!");
+	require(m_neg_count>0, "Number of negative labels is zero, ROC fails!");
+
+	int32_t length=m_sorted_scores.vlen;
+	int32_t diff_count=count_distinct();
+
+	graph=SGMatrix<float64_t>(2, diff_count+1);
+	thresholds=SGVector<float64_t>(length);
+
+	float64_t threshold=Math::ALMOST_NEG_INFTY;
+	float64_t fp=0.0;
+	float64_t tp=0.0;
+	int32_t j=0;
+	for (int32_t i=0; i<length; i++)
+	{
+		if (m_sorted_scores[i]!=threshold)
+		{
+			threshold=m_sorted_scores[i];
+			graph[2*j]=fp/m_neg_count;
+			graph[2*j+1]=tp/m_pos_count;
+			j++;
+		}
+
+		thresholds[i]=threshold;
+
+		if (m_sorted_positive[i])
+			tp+=1.0;
+		else
+			fp+=1.0;
+	}
+
+	// add (1,1) to ROC curve
+	graph[2*diff_count]=1.0;
+	graph[2*diff_count+1]=1.0;
+
+	return Math::area_under_curve(graph.matrix, diff_count+1, false);
+}
+
+float64_t ThresholdSweep::compute_PRC(SGMatrix<float64_t>& graph,
+		SGVector<float64_t>& thresholds) const
+{
+	require(m_pos_count>0, "Number of positive labels is zero, PRC fails!");
+
+	int32_t length=m_sorted_scores.vlen;
+	graph=SGMatrix<float64_t>(2, length);
+	thresholds=SGVector<float64_t>(length);
+
+	float64_t tp=0.0;
+	for (int32_t i=0; i<length; i++)
+	{
+		if (m_sorted_positive[i])
+			tp+=1.0;
+
+		// precision (x)
+		graph[2*i]=tp/float64_t(i+1);
+		// recall (y)
+		graph[2*i+1]=tp/float64_t(m_pos_count);
+
+		thresholds[i]=m_sorted_scores[i];
+	}
+
+	return Math::area_under_curve(graph.matrix, length, true);
+}
+
+float64_t ThresholdSweep::get_auROC() const
+{
+	SGMatrix<float64_t> graph;
+	SGVector<float64_t> thresholds;
+	return compute_ROC(graph, thresholds);
+}
+
+float64_t ThresholdSweep::get_auPRC() const
+{
+	SGMatrix<float64_t> graph;
+	SGVector<float64_t> thresholds;
+	return compute_PRC(graph, thresholds);
+}
+
+SGVector<float64_t> ThresholdSweep::get_distinct_thresholds() const
+{
+	SGVector<float64_t> result(count_distinct());
+	int32_t j=0;
+	for (int32_t i=0; i<m_sorted_scores.vlen; i++)
+	{
+		if (i==m_sorted_scores.vlen-1 ||
+				m_sorted_scores[i]!=m_sorted_scores[i+1])
+			result[j++]=m_sorted_scores[i];
+	}
+	return result;
+}
+
+SGVector<float64_t> ThresholdSweep::sweep(
+		const std::function<float64_t(int32_t, int32_t, int32_t, int32_t)>&
+		metric) const
+{
+	SGVector<float64_t> result(count_distinct());
+	int32_t tp=0;
+	int32_t fp=0;
+	int32_t j=0;
+	for (int32_t i=0; i<m_sorted_scores.vlen; i++)
+	{
+		if (m_sorted_positive[i])
+			tp++;
+		else
+			fp++;
+
+		if (i==m_sorted_scores.vlen-1 ||
+				m_sorted_scores[i]!=m_sorted_scores[i+1])
+			result[j++]=metric(tp, fp, m_pos_count, m_neg_count);
+	}
+	return result;
+}
+
+SGVector<float64_t> ThresholdSweep::batch_auROC(
+		const std::vector<SGVector<float64_t>>& scores,
+		const std::vector<SGVector<float64_t>>& truths)
+{
+	require(scores.size()==truths.size(),
+		"Number of score vectors ({}) must match number of label vectors ({})",
+		scores.size(), truths.size());
+
+	SGVector<float64_t> result(static_cast<index_t>(scores.size()));
+	#pragma omp parallel for
+	for (index_t i=0; i<result.vlen; i++)
+		result[i]=ThresholdSweep(scores[i], truths[i]).get_auROC();
+	return result;
+}
+
+SGVector<float64_t> ThresholdSweep::batch_auPRC(
+		const std::vector<SGVector<float64_t>>& scores,
+		const std::vector<SGVector<float64_t>>& truths)
+{
+	require(scores.size()==truths.size(),
+		"Number of score vectors ({}) must match number of label vectors ({})",
+		scores.size(), truths.size());
+
+	SGVector<float64_t> result(static_cast<index_t>(scores.size()));
+	#pragma omp parallel for
+	for (index_t i=0; i<result.vlen; i++)
+		result[i]=ThresholdSweep(scores[i], truths[i]).get_auPRC();
+	return result;
+}
@@ -0,0 +1,135 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef THRESHOLDSWEEP_H_
+#define THRESHOLDSWEEP_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+
+#include <functional>
+#include <vector>
+
+namespace shogun
+{
+
+/** @brief Shared threshold-sweep engine for score-based binary metrics.
+ *
+ * Sorts the prediction scores once (descending) and derives ROC and PRC
+ * curves, their areas, and arbitrary confusion-matrix metrics at every
+ * distinct threshold from single cumulative passes over the sorted order,
+ * instead of each evaluation re-sorting the same scores. ROCEvaluation and
+ * PRCEvaluation are implemented on top of this engine; the static batch
+ * methods evaluate many score/label vectors (e.g. per-class one-vs-rest) in
+ * parallel.
+ *
+ * An example is counted as positive when its ground truth value is >0.
+ */
+class ThresholdSweep
+{
+public:
+	/** constructor; sorts the scores
+	 *
+	 * @param scores prediction scores
+	 * @param truth ground truth values, >0 means positive
+	 */
+	ThresholdSweep(const SGVector<float64_t>& scores,
+			const SGVector<float64_t>& truth);
+
+	/** @return number of positive examples */
+	int32_t get_num_positives() const
+	{
+		return m_pos_count;
+	}
+
+	/** @return number of negative examples */
+	int32_t get_num_negatives() const
+	{
+		return m_neg_count;
+	}
+
+	/** compute the ROC curve
+	 *
+	 * @param graph ROC graph matrix, returned
+	 * @param thresholds threshold per sorted example, returned
+	 * @return area under the ROC curve
+	 */
+	float64_t compute_ROC(SGMatrix<float64_t>& graph,
+			SGVector<float64_t>& thresholds) const;
+
+	/** compute the PRC curve
+	 *
+	 * @param graph PRC graph matrix, returned
+	 * @param thresholds threshold per sorted example, returned
+	 * @return area under the PRC curve
+	 */
+	float64_t compute_PRC(SGMatrix<float64_t>& graph,
+			SGVector<float64_t>& thresholds) const;
+
+	/** @return area under the ROC curve */
+	float64_t get_auROC() const;
+
+	/** @return area under the PRC curve */
+	float64_t get_auPRC() const;
+
+	/** @return the distinct thresholds in descending order */
+	SGVector<float64_t> get_distinct_thresholds() const;
+
+	/** evaluate an arbitrary confusion-matrix metric at every distinct
+	 * threshold, where examples with score >= threshold are predicted
+	 * positive; one cumulative pass, no re-sorting
+	 *
+	 * @param metric callable taking (tp, fp, num_positives, num_negatives)
+	 * @return metric value per distinct threshold, aligned with
+	 * get_distinct_thresholds()
+	 */
+	SGVector<float64_t> sweep(
+			const std::function<float64_t(int32_t, int32_t, int32_t, int32_t)>&
+			metric) const;
+
+	/** compute areas under the ROC curves of many score/label vectors in
+	 * parallel
+	 *
+	 * @param scores prediction scores per task
+	 * @param truths ground truth values per task
+	 * @return auROC per task
+	 */
+	static SGVector<float64_t> batch_auROC(
+			const std::vector<SGVector<float64_t>>& scores,
+			const std::vector<SGVector<float64_t>>& truths);
+
+	/** compute areas under the PRC curves of many score/label vectors in
+	 * parallel
+	 *
+	 * @param scores prediction scores per task
+	 * @param truths ground truth values per task
+	 * @return auPRC per task
+	 */
+	static SGVector<float64_t> batch_auPRC(
+			const std::vector<SGVector<float64_t>>& scores,
+			const std::vector<SGVector<float64_t>>& truths);
+
+private:
+	/** @return number of distinct score values */
+	int32_t count_distinct() const;
+
+private:
+	/** scores in descending order */
+	SGVector<float64_t> m_sorted_scores;
+
+	/** whether the example at each sorted position is positive */
+	SGVector<bool> m_sorted_positive;
+
+	/** number of positive examples */
+	int32_t m_pos_count;
+
+	/** number of negative examples */
+	int32_t m_neg_count;
+};
+
+}
+
+#endif /* THRESHOLDSWEEP_H_ */
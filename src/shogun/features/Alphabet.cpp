@@ -9,6 +9,10 @@
 #include <shogun/mathematics/Math.h>
 #include <ctype.h>
 
+#if defined(HAVE_SSE2) && defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 #include <shogun/features/Alphabet.h>
 #include <shogun/io/SGIO.h>
 
@@ -535,6 +539,52 @@ void Alphabet::init_map_table()
 		default:
 			break; //leave uninitialised
 	};
+
+	init_nibble_maptable();
+}
+
+void Alphabet::init_nibble_maptable()
+{
+	for (int32_t i=0; i<16; i++)
+		maptable_to_bin_nibble[i]=MAPTABLE_UNDEF;
+
+	/* the 16-entry table is usable iff every valid character's mapping
+	 * is a function of its low nibble alone; colliding nibbles with
+	 * different targets (e.g. the full protein alphabet) disable it */
+	nibble_maptable_valid=false;
+	for (int32_t i=0; i<(1<<(8*sizeof(uint8_t))); i++)
+	{
+		if (!valid_chars[i])
+			continue;
+
+		uint8_t nibble=i & 0x0f;
+		if (maptable_to_bin_nibble[nibble]!=MAPTABLE_UNDEF &&
+			maptable_to_bin_nibble[nibble]!=maptable_to_bin[i])
+			return;
+		maptable_to_bin_nibble[nibble]=maptable_to_bin[i];
+	}
+	nibble_maptable_valid=true;
+}
+
+void Alphabet::remap_to_bin(uint8_t* dst, const uint8_t* src, int64_t len)
+{
+	int64_t i=0;
+#if defined(HAVE_SSE2) && defined(__SSSE3__)
+	if (nibble_maptable_valid)
+	{
+		__m128i table=_mm_loadu_si128((const __m128i*) maptable_to_bin_nibble);
+		__m128i nibble_mask=_mm_set1_epi8(0x0f);
+		for (; i+16<=len; i+=16)
+		{
+			__m128i chars=_mm_loadu_si128((const __m128i*) (src+i));
+			__m128i remapped=
+				_mm_shuffle_epi8(table, _mm_and_si128(chars, nibble_mask));
+			_mm_storeu_si128((__m128i*) (dst+i), remapped);
+		}
+	}
+#endif
+	for (; i<len; i++)
+		dst[i]=maptable_to_bin[src[i]];
 }
 
 void Alphabet::clear_histogram()
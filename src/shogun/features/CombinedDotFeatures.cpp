@@ -9,6 +9,7 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/Math.h>
 
+#include <utility>
 #include <vector>
 
 using namespace shogun;
@@ -42,6 +43,10 @@ CombinedDotFeatures::~CombinedDotFeatures()
 
 void CombinedDotFeatures::update_dim_feature_space_and_num_vec()
 {
+	// rebuild before validating so the plan never outlives a changed
+	// sub-feature list, even when the mismatch check below throws
+	rebuild_dot_plan();
+
 	int32_t dim=0;
 	int32_t vec=-1;
 
@@ -97,16 +102,11 @@ float64_t CombinedDotFeatures::dot(
 {
 	float64_t result=0;
 
-	uint32_t offs=0;
-
-	for (index_t f_idx=0; f_idx<get_num_feature_obj(); f_idx++)
+	for (const auto& block : get_dot_plan())
 	{
-		auto f = get_feature_obj(f_idx);
-		int32_t dim = f->get_dim_feature_space();
-		result += f->dot(vec_idx1, vec2.slice(offs, offs+dim)) *
-		          get_subfeature_weight(f_idx);
-		offs += dim;
-
+		result += block.features->dot(vec_idx1,
+				vec2.slice(block.offset, block.offset+block.dim)) *
+				block.weight;
 	}
 
 	return result;
@@ -117,23 +117,16 @@ void CombinedDotFeatures::dense_dot_range(float64_t* output, int32_t start, int3
 	ASSERT(stop > start)
 	ASSERT(dim==num_dimensions)
 
-	uint32_t offs=0;
 	int32_t num=stop-start;
 	SGVector<float64_t> tmp(num);
 	std::fill(output, output + num, b);
 
-	for (index_t f_idx=0; f_idx<get_num_feature_obj(); f_idx++)
+	for (const auto& block : get_dot_plan())
 	{
-		auto f = get_feature_obj(f_idx);
-		int32_t f_dim = f->get_dim_feature_space();
-
-		f->dense_dot_range(
-		    tmp.vector, start, stop, alphas, vec + offs, f_dim, 0);
+		block.features->dense_dot_range(
+		    tmp.vector, start, stop, alphas, vec + block.offset, block.dim, 0);
 		for (int32_t i=0; i<num; i++)
-			output[i] += get_subfeature_weight(f_idx) * tmp[i];
-
-		offs += f_dim;
-
+			output[i] += block.weight * tmp[i];
 	}
 }
 
@@ -142,37 +135,24 @@ void CombinedDotFeatures::dense_dot_range_subset(int32_t* sub_index, int32_t num
 	ASSERT(num > 0)
 	ASSERT(dim==num_dimensions)
 
-	uint32_t offs=0;
-
 	SGVector<float64_t> tmp(num);
 	std::fill(output, output + num, b);
 
-	for (index_t f_idx=0; f_idx<get_num_feature_obj(); f_idx++)
+	for (const auto& block : get_dot_plan())
 	{
-		auto f = get_feature_obj(f_idx);
-		int32_t f_dim = f->get_dim_feature_space();
-
-		f->dense_dot_range_subset(
-			sub_index, num, tmp.vector, alphas, vec+offs, f_dim, 0);
+		block.features->dense_dot_range_subset(
+			sub_index, num, tmp.vector, alphas, vec+block.offset, block.dim, 0);
 		for (int32_t i=0; i<num; i++)
-			output[i] += get_subfeature_weight(f_idx) * tmp[i];
-
-		offs += f_dim;
-
+			output[i] += block.weight * tmp[i];
 	}
 }
 
 void CombinedDotFeatures::add_to_dense_vec(float64_t alpha, int32_t vec_idx1, float64_t* vec2, int32_t vec2_len, bool abs_val) const
 {
-	uint32_t offs=0;
-
-	for (index_t f_idx=0; f_idx<get_num_feature_obj(); f_idx++)
+	for (const auto& block : get_dot_plan())
 	{
-		auto f = get_feature_obj(f_idx);
-		int32_t dim = f->get_dim_feature_space();
-		f->add_to_dense_vec(alpha*get_subfeature_weight(f_idx), vec_idx1, vec2+offs, dim, abs_val);
-		offs += dim;
-
+		block.features->add_to_dense_vec(alpha*block.weight, vec_idx1,
+				vec2+block.offset, block.dim, abs_val);
 	}
 }
 
@@ -270,6 +250,41 @@ int32_t CombinedDotFeatures::get_num_feature_obj() const
 	return feature_array.size();
 }
 
+const std::vector<CombinedDotFeatures::DotPlanBlock>&
+CombinedDotFeatures::get_dot_plan() const
+{
+	// the plan is rebuilt whenever the sub-feature list or the weights
+	// change, never here: the scoring paths call this concurrently and
+	// a lazy build would race
+	return m_dot_plan;
+}
+
+void CombinedDotFeatures::rebuild_dot_plan()
+{
+	m_dot_plan.clear();
+	m_dot_plan.reserve(feature_array.size());
+
+	int32_t offs=0;
+	for (index_t f_idx=0; f_idx<get_num_feature_obj(); f_idx++)
+	{
+		DotPlanBlock block;
+		block.features=get_feature_obj(f_idx);
+		block.offset=offs;
+		block.dim=block.features->get_dim_feature_space();
+		block.weight=get_subfeature_weight(f_idx);
+		offs+=block.dim;
+
+		m_dot_plan.push_back(std::move(block));
+	}
+}
+
+void CombinedDotFeatures::load_serializable_post() noexcept(false)
+{
+	SGObject::load_serializable_post();
+
+	rebuild_dot_plan();
+}
+
 int32_t CombinedDotFeatures::get_nnz_features_for_vector(int32_t num) const
 {
 	int32_t result=0;
@@ -300,6 +315,7 @@ void CombinedDotFeatures::set_subfeature_weights(const SGVector<float64_t>& weig
 
 	std::copy(
 	    weights.vector, weights.vector + weights.vlen, feature_weights.begin());
+	rebuild_dot_plan();
 }
 
 float64_t CombinedDotFeatures::get_subfeature_weight(index_t idx) const
@@ -315,6 +331,7 @@ void CombinedDotFeatures::set_subfeature_weight(index_t idx, float64_t weight)
 	    "Index ({}) is out of bounds", idx);
 
 	feature_weights[idx] = weight;
+	rebuild_dot_plan();
 }
 
 void CombinedDotFeatures::init()
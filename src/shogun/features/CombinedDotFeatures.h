@@ -268,6 +268,36 @@ class CombinedDotFeatures : public DotFeatures
 		/** @return object name */
 		const char* get_name() const override { return "CombinedDotFeatures"; }
 
+		/** A resolved (sub-feature, slice, weight) entry of the scoring
+		 * plan, see get_dot_plan() */
+		struct DotPlanBlock
+		{
+			/** sub-feature, already cast to DotFeatures */
+			std::shared_ptr<DotFeatures> features;
+			/** offset of this block in the combined weight vector */
+			int32_t offset;
+			/** dimensionality of this block */
+			int32_t dim;
+			/** weight of this block */
+			float64_t weight;
+		};
+
+		/** Return the scoring plan: the sub-feature list resolved once into
+		 * flat (features, offset, dim, weight) blocks, so the per-example
+		 * dot-product loops iterate plain data instead of re-doing a cast,
+		 * a virtual dimensionality query and a weight lookup for every
+		 * block of every example. The plan is rebuilt eagerly whenever
+		 * the sub-feature list or the sub-feature weights change, so
+		 * this accessor never mutates state and stays safe to call from
+		 * concurrent scoring threads.
+		 *
+		 * @return the list of resolved blocks, in sub-feature order
+		 */
+		const std::vector<DotPlanBlock>& get_dot_plan() const;
+
+		/** rebuilds the scoring plan after deserialization */
+		void load_serializable_post() override;
+
 	protected:
 		/** update total number of dimensions and vectors */
 		void update_dim_feature_space_and_num_vec();
@@ -275,6 +305,7 @@ class CombinedDotFeatures : public DotFeatures
 	private:
 		void init();
 		void register_params();
+		void rebuild_dot_plan();
 
 	protected:
 		/** feature array */
@@ -285,6 +316,9 @@ class CombinedDotFeatures : public DotFeatures
 		int32_t num_vectors;
 		/// total number of dimensions
 		int32_t num_dimensions;
+		/// scoring plan, rebuilt eagerly on any structural change so
+		/// concurrent readers never race against a lazy build
+		std::vector<DotPlanBlock> m_dot_plan;
 };
 }
 #endif // _DOTFEATURES_H___
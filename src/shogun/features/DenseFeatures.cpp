@@ -114,10 +114,48 @@ template<class ST> void DenseFeatures<ST>::free_feature_matrix()
 {
 	m_subset_stack->remove_all_subsets();
 	feature_matrix=SGMatrix<ST>();
+	m_mapped_features=nullptr;
 	num_vectors = 0;
 	num_features = 0;
 }
 
+template<class ST> bool DenseFeatures<ST>::map_feature_matrix_from_binary(
+		const char* fname, int32_t num_feat, int32_t num_vec)
+{
+	require(num_feat>0 && num_vec>0, "Invalid matrix size {} x {}!",
+			num_feat, num_vec);
+
+	free_feature_matrix();
+
+	auto mapped=std::make_shared<MemoryMappedFile<ST>>(fname);
+	require(mapped->get_length()==uint64_t(int64_t(num_feat)*num_vec),
+			"File '{}' holds {} elements, but {} x {} = {} were expected!",
+			fname, mapped->get_length(), num_feat, num_vec,
+			int64_t(num_feat)*num_vec);
+
+	/* wrap the mapping without copying; pages are shared between all
+	 * processes mapping the same file */
+	feature_matrix=SGMatrix<ST>(mapped->get_map(), num_feat, num_vec, false);
+	num_features=num_feat;
+	num_vectors=num_vec;
+	m_mapped_features=mapped;
+	return true;
+}
+
+template<class ST> bool DenseFeatures<ST>::save_feature_matrix_to_binary(
+		const char* fname)
+{
+	require(feature_matrix.matrix, "No feature matrix set!");
+	require(!m_subset_stack->has_subsets(),
+			"Not possible with subset active!");
+
+	int64_t num_bytes=int64_t(num_features)*num_vectors*sizeof(ST);
+	MemoryMappedFile<ST> mapped(fname, 'w', num_bytes);
+	sg_memcpy(mapped.get_map(), feature_matrix.matrix, num_bytes);
+	mapped.set_truncate_size(num_bytes);
+	return true;
+}
+
 template<class ST> ST* DenseFeatures<ST>::get_feature_vector(int32_t num, int32_t& len, bool& dofree) const
 {
 	/* index conversion for subset, only for array access */
@@ -302,12 +340,21 @@ void DenseFeatures<ST>::copy_feature_matrix(SGMatrix<ST>& target, index_t column
 	}
 	else
 	{
-		for (int32_t i=0; i<num_vecs; ++i)
+		/* coalesce runs of consecutive source indices into single bulk
+		 * copies; cross-validation folds are mostly contiguous ranges, so
+		 * this usually degenerates to a handful of large memcpys */
+		SGVector<index_t> idx=m_subset_stack->get_flattened_indices();
+		for (int32_t i=0; i<num_vecs;)
 		{
-			auto real_i=m_subset_stack->subset_idx_conversion(i);
+			index_t real_i=idx.vector[i];
+			int32_t run=1;
+			while (i+run<num_vecs && idx.vector[i+run]==real_i+run)
+				++run;
+
 			auto src=feature_matrix.matrix+real_i*int64_t(num_features);
 			auto dest=target.matrix+int64_t(num_features)*(column_offset+i);
-			sg_memcpy(dest, src, num_features*sizeof(ST));
+			sg_memcpy(dest, src, int64_t(num_features)*run*sizeof(ST));
+			i+=run;
 		}
 	}
 }
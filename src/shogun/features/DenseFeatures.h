@@ -14,6 +14,7 @@
 #include <shogun/features/DotFeatures.h>
 #include <shogun/features/StringFeatures.h>
 #include <shogun/io/File.h>
+#include <shogun/io/MemoryMappedFile.h>
 #include <shogun/lib/Cache.h>
 #include <shogun/lib/DataType.h>
 #include <shogun/lib/SGMatrix.h>
@@ -530,6 +531,29 @@ protected:
 	 */
 	void set_feature_matrix(SGMatrix<ST> matrix);
 
+	/** back the feature matrix by a memory-mapped raw binary file
+	 * (column-major, no header) instead of heap memory. No data is parsed
+	 * or copied: the OS pages the file in on demand, and multiple
+	 * processes mapping the same file share a single physical copy.
+	 *
+	 * Any subset is removed.
+	 *
+	 * @param fname name of file to map
+	 * @param num_feat number of features (rows) of the stored matrix
+	 * @param num_vec number of vectors (columns) of the stored matrix
+	 * @return if mapping was successful
+	 */
+	bool map_feature_matrix_from_binary(const char* fname,
+			int32_t num_feat, int32_t num_vec);
+
+	/** write the feature matrix to a raw binary file (column-major, no
+	 * header), suitable for later use with map_feature_matrix_from_binary()
+	 *
+	 * @param fname name of file to write
+	 * @return if writing was successful
+	 */
+	bool save_feature_matrix_to_binary(const char* fname);
+
 private:
 	void init();
 
@@ -557,6 +581,10 @@ protected:
 
 	/** feature cache */
 	std::shared_ptr<Cache<ST>> feature_cache;
+
+	/** keeps the file mapping alive when the feature matrix is backed by
+	 * a memory-mapped file, see map_feature_matrix_from_binary() */
+	std::shared_ptr<MemoryMappedFile<ST>> m_mapped_features;
 };
 }
 #endif // _DENSEFEATURES__H__
@@ -15,11 +15,7 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
-#ifdef HAVE_OPENMP
-#include <omp.h>
-
 #include <utility>
-#endif
 
 using namespace shogun;
 
@@ -55,43 +51,28 @@ void DotFeatures::dense_dot_range(float64_t* output, int32_t start, int32_t stop
 	ASSERT(num_vectors>0)
 	SGVector<float64_t> sgvec(vec, dim, false);
 
-	int32_t num_threads;
-	int32_t step;
 	auto pb = SG_PROGRESS(range(num_vectors));
-#pragma omp parallel shared(num_threads, step)
+
+	/* dynamic chunks instead of a static partition: with skewed per-vector
+	 * cost (e.g. power-law sparse rows) a static split leaves threads idle
+	 * once their slice is done, while idle threads here keep pulling chunks
+	 * from the shared queue */
+	int32_t chunk_size=Math::max(1, Math::min(256, num_vectors/64));
+
+	// respect the global thread budget so that nested parallel callers
+	// (e.g. parallelized machines scoring through dense_dot_range) do
+	// not oversubscribe the machine
+	ThreadBudget budget(env());
+
+	// TODO: replace with the new signal
+#pragma omp parallel for schedule(dynamic, chunk_size) num_threads(budget.get_num_threads())
+	for (int32_t i=0; i<num_vectors; i++)
 	{
-#ifdef HAVE_OPENMP
-		#pragma omp single
-		{
-			num_threads=omp_get_num_threads();
-			step=num_vectors/num_threads;
-			num_threads--;
-		}
-		int32_t thread_num=omp_get_thread_num();
-#else
-		num_threads=0;
-		step=num_vectors;
-		int32_t thread_num=0;
-#endif
-
-		int32_t t_start=thread_num*step;
-		int32_t t_stop=(thread_num==num_threads) ? num_vectors : (thread_num+1)*step;
-
-#ifdef WIN32
-		for (int32_t i=t_start; i<t_stop; i++)
-#else
-		// TODO: replace with the new signal
-		// for (int32_t i=t_start; i<t_stop &&
-		//		!Signal::cancel_computations(); i++)
-		for (int32_t i = t_start; i < t_stop; i++)
-#endif
-		{
-			if (alphas)
-				output[i]=alphas[i]*this->dot(i + start, sgvec)+b;
-			else
-				output[i]=this->dot(i + start, sgvec)+b;
-			pb.print_progress();
-		}
+		if (alphas)
+			output[i]=alphas[i]*this->dot(i + start, sgvec)+b;
+		else
+			output[i]=this->dot(i + start, sgvec)+b;
+		pb.print_progress();
 	}
 	pb.complete();
 }
@@ -103,42 +84,22 @@ void DotFeatures::dense_dot_range_subset(int32_t* sub_index, int32_t num, float6
 
 	SGVector<float64_t> sgvec(vec, dim, false);
 	auto pb = SG_PROGRESS(range(num));
-	int32_t num_threads;
-	int32_t step;
-	#pragma omp parallel shared(num_threads, step)
+
+	/* see dense_dot_range(): dynamic chunks balance skewed per-vector cost */
+	int32_t chunk_size=Math::max(1, Math::min(256, num/64));
+
+	/* see dense_dot_range(): claim threads from the global budget */
+	ThreadBudget budget(env());
+
+	// TODO: replace with the new signal
+#pragma omp parallel for schedule(dynamic, chunk_size) num_threads(budget.get_num_threads())
+	for (int32_t i=0; i<num; i++)
 	{
-#ifdef HAVE_OPENMP
-		#pragma omp single
-		{
-			num_threads=omp_get_num_threads();
-			step=num/num_threads;
-			num_threads--;
-		}
-		int32_t thread_num=omp_get_thread_num();
-#else
-		num_threads=0;
-		step = num;
-		int32_t thread_num=0;
-#endif
-
-		int32_t t_start=thread_num*step;
-		int32_t t_stop=(thread_num==num_threads) ? num : (thread_num+1)*step;
-
-#ifdef WIN32
-		for (int32_t i=t_start; i<t_stop; i++)
-#else
-		// TODO: replace with the new signal
-		// for (int32_t i=t_start; i<t_stop &&
-		//		!Signal::cancel_computations(); i++)
-		for (int32_t i = t_start; i < t_stop; i++)
-#endif
-		{
-			if (alphas)
-				output[i]=alphas[sub_index[i]]*this->dot(sub_index[i], sgvec)+b;
-			else
-				output[i]=this->dot(sub_index[i], sgvec)+b;
-			pb.print_progress();
-		}
+		if (alphas)
+			output[i]=alphas[sub_index[i]]*this->dot(sub_index[i], sgvec)+b;
+		else
+			output[i]=this->dot(sub_index[i], sgvec)+b;
+		pb.print_progress();
 	}
 	pb.complete();
 }
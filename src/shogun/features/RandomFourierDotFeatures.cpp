@@ -6,7 +6,11 @@
 
 #include <shogun/mathematics/Math.h>
 #include <shogun/features/RandomFourierDotFeatures.h>
+#include <shogun/lib/memory.h>
 #include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/UniformRealDistribution.h>
 
 #include <utility>
@@ -36,6 +40,21 @@ RandomFourierDotFeatures::RandomFourierDotFeatures(std::shared_ptr<DotFeatures>
 	init(kernel_name, params);
 }
 
+RandomFourierDotFeatures::RandomFourierDotFeatures(std::shared_ptr<DotFeatures> features,
+	int32_t D, KernelName kernel_name, SGVector<float64_t> params,
+	bool use_fastfood)
+: RandomKitchenSinksDotFeatures(std::move(features), D)
+{
+	init(kernel_name, params);
+	if (use_fastfood)
+	{
+		m_use_fastfood = true;
+		generate_fastfood_params();
+	}
+	else
+		random_coeff = generate_random_coefficients();
+}
+
 RandomFourierDotFeatures::RandomFourierDotFeatures(const std::shared_ptr<File>& loader)
 {
 	not_implemented(SOURCE_LOCATION);;
@@ -45,6 +64,14 @@ RandomFourierDotFeatures::RandomFourierDotFeatures(const RandomFourierDotFeature
 : RandomKitchenSinksDotFeatures(orig)
 {
 	init(orig.kernel, orig.kernel_params);
+
+	m_use_fastfood = orig.m_use_fastfood;
+	m_pad_dim = orig.m_pad_dim;
+	m_ff_sign = orig.m_ff_sign;
+	m_ff_gauss = orig.m_ff_gauss;
+	m_ff_scale = orig.m_ff_scale;
+	m_ff_perm = orig.m_ff_perm;
+	m_ff_offset = orig.m_ff_offset;
 }
 
 RandomFourierDotFeatures::~RandomFourierDotFeatures()
@@ -58,15 +85,205 @@ RandomFourierDotFeatures::~RandomFourierDotFeatures()
 		kernel_params = params;
 
 		constant = num_samples > 0 ? std::sqrt(2.0 / num_samples) : 1;
+		m_use_fastfood = false;
+		m_pad_dim = 0;
+
 		SG_ADD(
 		    &kernel_params, "kernel_params",
 		    "The parameters of the kernel to approximate");
 		SG_ADD(&constant, "constant", "A constant needed");
+		SG_ADD(&m_use_fastfood, "use_fastfood",
+		    "Whether the structured Fastfood transform is used");
+		SG_ADD(&m_pad_dim, "pad_dim", "Input dimension padded to a power of two");
+		SG_ADD(&m_ff_sign, "ff_sign", "Fastfood binary scaling diagonals");
+		SG_ADD(&m_ff_gauss, "ff_gauss", "Fastfood Gaussian diagonals");
+		SG_ADD(&m_ff_scale, "ff_scale", "Fastfood scaling diagonals");
+		SG_ADD(&m_ff_perm, "ff_perm", "Fastfood permutations");
+		SG_ADD(&m_ff_offset, "ff_offset", "Fastfood phase offsets");
 		SG_ADD_OPTIONS(
 		    (machine_int_t*)&kernel, "kernel", "The kernel to approximate",
 		    ParameterProperties::NONE, SG_OPTIONS(GAUSSIAN, NOT_SPECIFIED));
 	}
 
+void RandomFourierDotFeatures::generate_fastfood_params()
+{
+	require(kernel == GAUSSIAN,
+	    "Fastfood mode supports only the Gaussian kernel");
+
+	int32_t dim = feats->get_dim_feature_space();
+	m_pad_dim = 1;
+	while (m_pad_dim < dim)
+		m_pad_dim *= 2;
+	int32_t num_blocks = (num_samples + m_pad_dim - 1) / m_pad_dim;
+
+	NormalDistribution<float64_t> normal_dist;
+	UniformRealDistribution<float64_t> uniform_real_dist(0.0, 2 * Math::PI);
+	UniformIntDistribution<int32_t> coin(0, 1);
+
+	m_ff_sign = SGMatrix<float64_t>(m_pad_dim, num_blocks);
+	m_ff_gauss = SGMatrix<float64_t>(m_pad_dim, num_blocks);
+	m_ff_scale = SGMatrix<float64_t>(m_pad_dim, num_blocks);
+	m_ff_perm = SGMatrix<index_t>(m_pad_dim, num_blocks);
+	m_ff_offset = SGVector<float64_t>(num_samples);
+
+	/* the unnormalized Hadamard transform and the Gaussian diagonal make
+	 * each block row behave like a N(0, m_pad_dim) projection; fold the
+	 * 1/sqrt(m_pad_dim) renormalization and the kernel bandwidth into S */
+	const float64_t target_std = std::sqrt(2.0 / kernel_params[0]);
+
+	SGVector<index_t> perm(m_pad_dim);
+	for (int32_t b = 0; b < num_blocks; b++)
+	{
+		float64_t* sign = m_ff_sign.get_column_vector(b);
+		float64_t* gauss = m_ff_gauss.get_column_vector(b);
+		float64_t* scale = m_ff_scale.get_column_vector(b);
+
+		float64_t gauss_sq_norm = 0;
+		for (int32_t i = 0; i < m_pad_dim; i++)
+		{
+			sign[i] = coin(m_prng) ? 1.0 : -1.0;
+			gauss[i] = normal_dist(m_prng);
+			gauss_sq_norm += gauss[i] * gauss[i];
+		}
+
+		perm.range_fill();
+		random::shuffle(perm, m_prng);
+		sg_memcpy(m_ff_perm.get_column_vector(b), perm.vector,
+		    m_pad_dim * sizeof(index_t));
+
+		/* draw row norms from the chi distribution so the block rows match
+		 * the length distribution of i.i.d. Gaussian rows */
+		for (int32_t i = 0; i < m_pad_dim; i++)
+		{
+			float64_t chi_sq = 0;
+			for (int32_t j = 0; j < m_pad_dim; j++)
+			{
+				float64_t g = normal_dist(m_prng);
+				chi_sq += g * g;
+			}
+			scale[i] = target_std * std::sqrt(chi_sq / gauss_sq_norm) /
+			           std::sqrt((float64_t)m_pad_dim);
+		}
+	}
+
+	for (index_t i = 0; i < num_samples; i++)
+		m_ff_offset[i] = uniform_real_dist(m_prng);
+}
+
+void RandomFourierDotFeatures::fast_walsh_hadamard(float64_t* vec, int32_t n)
+{
+	for (int32_t h = 1; h < n; h *= 2)
+	{
+		for (int32_t i = 0; i < n; i += 2 * h)
+		{
+			for (int32_t j = i; j < i + h; j++)
+			{
+				float64_t a = vec[j];
+				float64_t b = vec[j + h];
+				vec[j] = a + b;
+				vec[j + h] = a - b;
+			}
+		}
+	}
+}
+
+SGVector<float64_t> RandomFourierDotFeatures::compute_transformed_vector(
+    int32_t vec_idx) const
+{
+	SGVector<float64_t> result(num_samples);
+
+	if (!m_use_fastfood)
+	{
+		for (index_t i = 0; i < num_samples; i++)
+			result[i] = post_dot(RandomKitchenSinksDotFeatures::dot(vec_idx, i), i);
+		return result;
+	}
+
+	SGVector<float64_t> x = feats->get_computed_dot_feature_vector(vec_idx);
+	SGVector<float64_t> buf(m_pad_dim);
+	SGVector<float64_t> tmp(m_pad_dim);
+
+	int32_t num_blocks = m_ff_sign.num_cols;
+	for (int32_t b = 0; b < num_blocks; b++)
+	{
+		const float64_t* sign = m_ff_sign.get_column_vector(b);
+		const float64_t* gauss = m_ff_gauss.get_column_vector(b);
+		const float64_t* scale = m_ff_scale.get_column_vector(b);
+		const index_t* perm = m_ff_perm.get_column_vector(b);
+
+		buf.zero();
+		for (int32_t i = 0; i < x.vlen; i++)
+			buf[i] = sign[i] * x[i];
+		fast_walsh_hadamard(buf.vector, m_pad_dim);
+
+		for (int32_t i = 0; i < m_pad_dim; i++)
+			tmp[i] = gauss[i] * buf[perm[i]];
+		fast_walsh_hadamard(tmp.vector, m_pad_dim);
+
+		for (int32_t i = 0; i < m_pad_dim; i++)
+		{
+			int64_t par_idx = int64_t(b) * m_pad_dim + i;
+			if (par_idx < num_samples)
+			{
+				result[par_idx] = std::cos(scale[i] * tmp[i] +
+				                      m_ff_offset[par_idx]) * constant;
+			}
+		}
+	}
+
+	return result;
+}
+
+float64_t RandomFourierDotFeatures::dot(int32_t vec_idx1,
+	std::shared_ptr<DotFeatures> df, int32_t vec_idx2) const
+{
+	if (!m_use_fastfood)
+		return RandomKitchenSinksDotFeatures::dot(vec_idx1, df, vec_idx2);
+
+	ASSERT(typeid(*this) == typeid(*df));
+	auto other = std::static_pointer_cast<RandomFourierDotFeatures>(df);
+	ASSERT(get_dim_feature_space() == other->get_dim_feature_space());
+
+	SGVector<float64_t> z1 = compute_transformed_vector(vec_idx1);
+	SGVector<float64_t> z2 = other->compute_transformed_vector(vec_idx2);
+
+	return linalg::dot(z1, z2);
+}
+
+float64_t RandomFourierDotFeatures::dot(
+    int32_t vec_idx1, const SGVector<float64_t>& vec2) const
+{
+	if (!m_use_fastfood)
+		return RandomKitchenSinksDotFeatures::dot(vec_idx1, vec2);
+
+	ASSERT(vec2.size() == get_dim_feature_space());
+
+	SGVector<float64_t> z = compute_transformed_vector(vec_idx1);
+	return linalg::dot(z, vec2);
+}
+
+void RandomFourierDotFeatures::add_to_dense_vec(float64_t alpha,
+	int32_t vec_idx1, float64_t* vec2, int32_t vec2_len, bool abs_val) const
+{
+	if (!m_use_fastfood)
+	{
+		RandomKitchenSinksDotFeatures::add_to_dense_vec(
+		    alpha, vec_idx1, vec2, vec2_len, abs_val);
+		return;
+	}
+
+	ASSERT(vec2_len == get_dim_feature_space());
+
+	SGVector<float64_t> z = compute_transformed_vector(vec_idx1);
+	for (index_t i = 0; i < num_samples; i++)
+	{
+		if (abs_val)
+			vec2[i] += Math::abs(alpha * z[i]);
+		else
+			vec2[i] += alpha * z[i];
+	}
+}
+
 std::shared_ptr<Features> RandomFourierDotFeatures::duplicate() const
 {
 	return std::make_shared<RandomFourierDotFeatures>(*this);
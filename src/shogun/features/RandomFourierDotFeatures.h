@@ -69,6 +69,26 @@ public:
 	RandomFourierDotFeatures(std::shared_ptr<DotFeatures> features, int32_t D, KernelName kernel_name,
 			SGVector<float64_t> params, SGMatrix<float64_t> coeff);
 
+	/** constructor selecting between the explicit random matrix and the
+	 * structured Fastfood transform.
+	 *
+	 * In Fastfood mode the D x d random matrix is replaced by blocks of
+	 * the form S H G P H B (diagonal scalings/signs, a permutation and
+	 * Walsh-Hadamard transforms), so projecting a vector costs
+	 * O(D log d) instead of O(Dd) and only O(D) parameters are stored.
+	 * See "Fastfood - Approximating Kernel Expansions in Loglinear Time",
+	 * Le, Sarlos and Smola. Only the Gaussian kernel is supported in this
+	 * mode.
+	 *
+	 * @param features the dense features to use as a base
+	 * @param D the number of random fourier samples to draw / dimensionality of new feature space
+	 * @param kernel_name the name of the kernel to approximate
+	 * @param params kernel parameters (see kernel's description in KernelName to see what each kernel expects)
+	 * @param use_fastfood whether to use the structured transform
+	 */
+	RandomFourierDotFeatures(std::shared_ptr<DotFeatures> features, int32_t D, KernelName kernel_name,
+			SGVector<float64_t> params, bool use_fastfood);
+
 	/** constructor loading features from file
 	 *
 	 * @param loader File object via which to load data
@@ -86,6 +106,15 @@ public:
 		return "RandomFourierDotFeatures";
 	}
 
+	float64_t dot(int32_t vec_idx1, std::shared_ptr<DotFeatures> df,
+			int32_t vec_idx2) const override;
+
+	float64_t
+	dot(int32_t vec_idx1, const SGVector<float64_t>& vec2) const override;
+
+	void add_to_dense_vec(float64_t alpha, int32_t vec_idx1, float64_t* vec2,
+			int32_t vec2_len, bool abs_val = false) const override;
+
 protected:
 
 	float64_t post_dot(float64_t dot_result, index_t par_idx) const override;
@@ -97,6 +126,19 @@ protected:
 private:
 	void init(KernelName kernel_name, const SGVector<float64_t>& params);
 
+	/** draw the diagonals, permutations and phase offsets of the Fastfood
+	 * blocks */
+	void generate_fastfood_params();
+
+	/** compute all D transformed features of a vector at once, using the
+	 * Fastfood blocks when enabled and the explicit random matrix
+	 * otherwise */
+	SGVector<float64_t> compute_transformed_vector(int32_t vec_idx) const;
+
+	/** in-place unnormalized Walsh-Hadamard transform of a power-of-two
+	 * sized vector */
+	static void fast_walsh_hadamard(float64_t* vec, int32_t n);
+
 private:
 	/** the kernel to approximate */
 	KernelName kernel;
@@ -106,6 +148,29 @@ private:
 
 	/** norm const */
 	float64_t constant;
+
+	/** whether the structured Fastfood transform replaces the explicit
+	 * random matrix */
+	bool m_use_fastfood;
+
+	/** input dimension padded to the next power of two */
+	int32_t m_pad_dim;
+
+	/** binary scaling diagonals B, one column of +-1 entries per block */
+	SGMatrix<float64_t> m_ff_sign;
+
+	/** Gaussian diagonals G, one column per block */
+	SGMatrix<float64_t> m_ff_gauss;
+
+	/** scaling diagonals S (including the kernel scale), one column per
+	 * block */
+	SGMatrix<float64_t> m_ff_scale;
+
+	/** permutations P, one column per block */
+	SGMatrix<index_t> m_ff_perm;
+
+	/** per-projection phase offsets */
+	SGVector<float64_t> m_ff_offset;
 };
 }
 
@@ -9,6 +9,8 @@
 #include <shogun/features/Alphabet.h>
 #include <shogun/lib/memory.h>
 
+#include <bitset>
+
 using namespace shogun;
 
 SNPFeatures::SNPFeatures()
@@ -25,6 +27,9 @@ SNPFeatures::SNPFeatures()
 
 	m_str_min = NULL;
 	m_str_maj = NULL;
+
+	m_num_words = 0;
+	m_num_pad = 0;
 }
 
 SNPFeatures::SNPFeatures(const std::shared_ptr<StringFeatures<uint8_t>>& str) : DotFeatures(),
@@ -42,6 +47,9 @@ SNPFeatures::SNPFeatures(const std::shared_ptr<StringFeatures<uint8_t>>& str) :
 	auto alpha=str->get_alphabet();
 	ASSERT(alpha->get_alphabet()==SNP)
 
+	m_num_words=0;
+	m_num_pad=0;
+
 	obtain_base_strings();
 	set_normalization_const();
 
@@ -68,6 +76,9 @@ SNPFeatures::SNPFeatures(const SNPFeatures& orig)
 		num_strings = 0;
 	}
 
+	m_num_words=0;
+	m_num_pad=0;
+
 	obtain_base_strings();
 }
 
@@ -145,6 +156,30 @@ float64_t SNPFeatures::dot(int32_t idx_a, std::shared_ptr<DotFeatures> df, int32
 	ASSERT(m_str_min)
 	ASSERT(m_str_maj)
 
+	if (m_packed_codes.matrix && sf->m_packed_codes.matrix &&
+			!strings->get_subset_stack()->has_subsets() &&
+			!sf->strings->get_subset_stack()->has_subsets())
+	{
+		strings->free_feature_vector(avec, idx_a, free_avec);
+		sf->strings->free_feature_vector(bvec, idx_b, free_bvec);
+
+		const uint64_t* pa=m_packed_codes.get_column_vector(idx_a);
+		const uint64_t* pb=sf->m_packed_codes.get_column_vector(idx_b);
+
+		int64_t matches=0;
+		for (int32_t w=0; w<m_num_words; w++)
+		{
+			uint64_t x=pa[w]^pb[w];
+			/* a SNP contributes iff both codes agree, i.e. iff its 2-bit
+			 * field in the xor is zero */
+			uint64_t zero_fields=~(x | (x>>1)) & 0x5555555555555555ull;
+			matches+=std::bitset<64>(zero_fields).count();
+		}
+
+		/* padding fields are 3 in every packed vector and always agree */
+		return float64_t(matches-m_num_pad);
+	}
+
 	float64_t total=0;
 
 	for (int32_t i = 0; i<alen-1; i+=2)
@@ -316,6 +351,60 @@ void SNPFeatures::obtain_base_strings(const std::shared_ptr<SNPFeatures>& snp)
 	}
 }
 
+void SNPFeatures::precompute_packed_codes()
+{
+	require(m_str_min && m_str_maj, "Minor/major base strings required, "
+			"call obtain_base_strings() first");
+	require(!strings->get_subset_stack()->has_subsets(),
+			"Not possible with subset");
+
+	int32_t num_snps=string_length/2;
+	m_num_words=(num_snps+31)/32;
+	m_num_pad=m_num_words*32-num_snps;
+	m_packed_codes=SGMatrix<uint64_t>(m_num_words, num_strings);
+
+	for (int32_t j=0; j<num_strings; j++)
+	{
+		int32_t len;
+		bool free_vec;
+		uint8_t* vec=strings->get_feature_vector(j, len, free_vec);
+		ASSERT(string_length==len)
+
+		uint64_t* col=m_packed_codes.get_column_vector(j);
+		for (int32_t w=0; w<m_num_words; w++)
+		{
+			uint64_t word=0;
+			for (int32_t k=0; k<32; k++)
+			{
+				int32_t snp=w*32+k;
+				uint64_t code=3; // padding
+				if (snp<num_snps)
+				{
+					uint8_t a1=vec[2*snp];
+					uint8_t a2=vec[2*snp+1];
+
+					if (a1!=a2 || a1=='0' || a2=='0')
+						code=0;
+					else if (a1==m_str_min[2*snp])
+						code=1;
+					else if (a1==m_str_maj[2*snp])
+						code=2;
+					else
+					{
+						error("The impossible happened i={} a1={} a2={} "
+								"min={} maj={}", 2*snp, a1, a2,
+								m_str_min[2*snp], m_str_maj[2*snp]);
+					}
+				}
+				word|=code<<(2*k);
+			}
+			col[w]=word;
+		}
+
+		strings->free_feature_vector(vec, j, free_vec);
+	}
+}
+
 void SNPFeatures::set_normalization_const(float64_t n)
 {
 	if (n==0)
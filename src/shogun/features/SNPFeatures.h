@@ -11,6 +11,7 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/lib/common.h>
+#include <shogun/lib/SGMatrix.h>
 #include <shogun/features/DotFeatures.h>
 #include <shogun/features/StringFeatures.h>
 
@@ -198,6 +199,19 @@ class SNPFeatures : public DotFeatures
 		 */
 		void find_minor_major_strings(uint8_t* minor, uint8_t* major);
 
+		/** precompute 2-bit packed genotype codes for all vectors
+		 *
+		 * Packs every SNP into a 2-bit code (0: heterozygous or missing,
+		 * 1: homozygous minor, 2: homozygous major), 32 SNPs per 64-bit
+		 * word. dot() between two SNP vectors then reduces to an xor plus
+		 * a popcount per word and runs at memory bandwidth instead of
+		 * branching on every base pair.
+		 *
+		 * Requires the minor/major base strings to be known; not possible
+		 * with subset.
+		 */
+		void precompute_packed_codes();
+
 	protected:
 		/** stringfeatures the wdfeatures are based on*/
 		std::shared_ptr<StringFeatures<uint8_t>> strings;
@@ -216,6 +230,14 @@ class SNPFeatures : public DotFeatures
 		uint8_t* m_str_min;
 		/** allele B */
 		uint8_t* m_str_maj;
+
+		/** 2-bit packed genotype codes, one column of m_num_words words
+		 * per string; empty until precompute_packed_codes() is called */
+		SGMatrix<uint64_t> m_packed_codes;
+		/** number of 64-bit words per packed vector */
+		int32_t m_num_words;
+		/** number of unused 2-bit fields in the last packed word */
+		int32_t m_num_pad;
 };
 }
 #endif // _SNPFEATURES_H___
@@ -166,6 +166,19 @@ template<class ST> SGSparseVector<ST> SparseFeatures<ST>::get_sparse_feature_vec
 
 template<class ST> ST SparseFeatures<ST>::dense_dot(ST alpha, int32_t num, ST* vec, int32_t dim, ST b) const
 {
+	if (has_csr_layout())
+	{
+		int32_t real_num=m_subset_stack->subset_idx_conversion(num);
+		ST result=b;
+		for (int64_t k=m_csr_offsets[real_num];
+				k<m_csr_offsets[real_num+1]; k++)
+		{
+			if (m_csr_indices[k]<dim)
+				result+=alpha*vec[m_csr_indices[k]]*m_csr_values[k];
+		}
+		return result;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 	ST result = sv.dense_dot(alpha,vec,dim,b);
 	free_sparse_feature_vector(num);
@@ -180,6 +193,24 @@ template<class ST> void SparseFeatures<ST>::add_to_dense_vec(float64_t alpha, in
 		"add_to_dense_vec(num={},dim={}): dim should contain number of features {}",
 		num, dim, get_num_features());
 
+	if (has_csr_layout())
+	{
+		int32_t real_num=m_subset_stack->subset_idx_conversion(num);
+		if (abs_val)
+		{
+			for (int64_t k=m_csr_offsets[real_num];
+					k<m_csr_offsets[real_num+1]; k++)
+				vec[m_csr_indices[k]]+=alpha*Math::abs(m_csr_values[k]);
+		}
+		else
+		{
+			for (int64_t k=m_csr_offsets[real_num];
+					k<m_csr_offsets[real_num+1]; k++)
+				vec[m_csr_indices[k]]+=alpha*m_csr_values[k];
+		}
+		return;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(num);
 
 	if (sv.features)
@@ -241,6 +272,7 @@ template<class ST> void SparseFeatures<ST>::set_sparse_feature_matrix(SGSparseMa
 	if (m_subset_stack->has_subsets())
 		error("Not allowed with subset");
 
+	free_csr_layout();
 	sparse_feature_matrix=sm;
 
 	// TODO: check should be implemented in sparse matrix class
@@ -286,6 +318,50 @@ template<class ST> void SparseFeatures<ST>::free_sparse_features()
 template<class ST> void SparseFeatures<ST>::free_sparse_feature_matrix()
 {
 	sparse_feature_matrix=SGSparseMatrix<ST>();
+	free_csr_layout();
+}
+
+template<class ST> void SparseFeatures<ST>::convert_to_csr()
+{
+	int32_t num_vec=sparse_feature_matrix.num_vectors;
+	require(num_vec>0, "No sparse feature matrix set!");
+
+	m_csr_offsets=SGVector<int64_t>(num_vec+1);
+	m_csr_offsets[0]=0;
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		m_csr_offsets[i+1]=m_csr_offsets[i]
+			+sparse_feature_matrix[i].num_feat_entries;
+	}
+
+	int64_t num_entries=m_csr_offsets[num_vec];
+	m_csr_values=SGVector<ST>(num_entries);
+	m_csr_indices=SGVector<int32_t>(num_entries);
+
+	#pragma omp parallel for
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		const SGSparseVector<ST>& sv=sparse_feature_matrix[i];
+		int64_t offset=m_csr_offsets[i];
+		for (int32_t k=0; k<sv.num_feat_entries; k++)
+		{
+			m_csr_values[offset+k]=sv.features[k].entry;
+			m_csr_indices[offset+k]=sv.features[k].feat_index;
+		}
+	}
+}
+
+template<class ST> bool SparseFeatures<ST>::has_csr_layout() const
+{
+	return m_csr_offsets.vlen==sparse_feature_matrix.num_vectors+1 &&
+		get_num_preprocessors()==0;
+}
+
+template<class ST> void SparseFeatures<ST>::free_csr_layout()
+{
+	m_csr_values=SGVector<ST>();
+	m_csr_indices=SGVector<int32_t>();
+	m_csr_offsets=SGVector<int64_t>();
 }
 
 template<class ST> void SparseFeatures<ST>::set_full_feature_matrix(SGMatrix<ST> full)
@@ -462,6 +538,16 @@ SparseFeatures<ST>::dot(int32_t vec_idx1, const SGVector<float64_t>& vec2) const
 		vec_idx1, vec2.size(), get_num_features());
 
 	float64_t result=0;
+
+	if (has_csr_layout())
+	{
+		int32_t real_num=m_subset_stack->subset_idx_conversion(vec_idx1);
+		for (int64_t k=m_csr_offsets[real_num];
+				k<m_csr_offsets[real_num+1]; k++)
+			result+=vec2[m_csr_indices[k]]*m_csr_values[k];
+		return result;
+	}
+
 	SGSparseVector<ST> sv=get_sparse_feature_vector(vec_idx1);
 
 	if (sv.features)
@@ -90,6 +90,21 @@ template <class ST> class SparseFeatures : public DotFeatures
 		 */
 		void free_sparse_feature_matrix();
 
+		/** build a compressed-sparse-row (CSR) copy of the feature matrix:
+		 * one contiguous value array, one index array and one offsets
+		 * array. The per-example dot operations (dot(), dense_dot(),
+		 * add_to_dense_vec()) then read from the contiguous arrays instead
+		 * of chasing one separately allocated SGSparseVector per example.
+		 * Rebuild after the underlying matrix changed.
+		 */
+		void convert_to_csr();
+
+		/** @return whether the CSR layout is built and in use */
+		bool has_csr_layout() const;
+
+		/** drop the CSR arrays and return to per-vector storage only */
+		void free_csr_layout();
+
 		/** free sparse feature matrix and cache
 		 *
 		 * any subset is removed
@@ -480,6 +495,16 @@ template <class ST> class SparseFeatures : public DotFeatures
 		/// array of sparse vectors of size num_vectors
 		SGSparseMatrix<ST> sparse_feature_matrix;
 
+		/** CSR layout: values of all examples back to back */
+		SGVector<ST> m_csr_values;
+
+		/** CSR layout: feature indices of all examples back to back */
+		SGVector<int32_t> m_csr_indices;
+
+		/** CSR layout: per-example start offsets into the value/index
+		 * arrays, length num_vectors+1; empty when CSR is not built */
+		SGVector<int64_t> m_csr_offsets;
+
 		/** feature cache */
 		std::shared_ptr<Cache< SGSparseVectorEntry<ST> >> feature_cache;
 };
@@ -100,6 +100,7 @@ template<class ST> void StringFeatures<ST>::cleanup()
 	*/
 
 	features.clear();
+	free_arena();
 	symbol_mask_table = SGVector<ST>();
 
 	/* start with a fresh alphabet, but instead of emptying the histogram
@@ -134,6 +135,45 @@ template<class ST> void StringFeatures<ST>::cleanup_feature_vectors(int32_t star
 	}
 }
 
+template<class ST> void StringFeatures<ST>::pack_into_arena()
+{
+	if (m_subset_stack->has_subsets())
+		error("Cannot call pack_into_arena() with subset.");
+
+	int32_t num_vec=features.size();
+	if (num_vec==0 || has_arena_storage())
+		return;
+
+	m_arena_offsets=SGVector<int64_t>(num_vec+1);
+	m_arena_offsets[0]=0;
+	for (int32_t i=0; i<num_vec; i++)
+		m_arena_offsets[i+1]=m_arena_offsets[i]+features[i].vlen;
+
+	SG_DEBUG("packing {} strings ({} symbols) into a contiguous arena",
+			num_vec, m_arena_offsets[num_vec])
+
+	m_arena=SGVector<ST>(index_t(m_arena_offsets[num_vec]));
+
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		ST* dst=m_arena.vector+m_arena_offsets[i];
+		sg_memcpy(dst, features[i].vector, features[i].vlen*sizeof(ST));
+		features[i]=SGVector<ST>(dst, features[i].vlen, false);
+	}
+}
+
+template<class ST> bool StringFeatures<ST>::has_arena_storage() const
+{
+	return m_arena.vector &&
+		m_arena_offsets.vlen==index_t(features.size())+1;
+}
+
+template<class ST> void StringFeatures<ST>::free_arena()
+{
+	m_arena=SGVector<ST>();
+	m_arena_offsets=SGVector<int64_t>();
+}
+
 template<class ST> EFeatureClass StringFeatures<ST>::get_feature_class() const { return C_STRING; }
 
 template<class ST> EFeatureType StringFeatures<ST>::get_feature_type() const { return F_UNKNOWN; }
@@ -448,10 +488,11 @@ template<class ST> void StringFeatures<ST>::load_ascii_file(char* fname, bool re
 					features[lines] = SGVector<ST>(len);
 					if (remap_to_bin)
 					{
-						for (int32_t j=0; j<overflow_len; j++)
-							features[lines].vector[j]=alpha->remap_to_bin(overflow[j]);
-						for (int32_t j=0; j<len; j++)
-							features[lines].vector[j+overflow_len]=alpha->remap_to_bin(dummy[old_sz+j]);
+						alpha->remap_to_bin(
+							features[lines].vector, overflow, overflow_len);
+						alpha->remap_to_bin(
+							features[lines].vector+overflow_len,
+							&dummy[old_sz], len);
 						alpha->add_string_to_histogram(&dummy[old_sz], len);
 						alpha_bin->add_string_to_histogram(features[lines].vector, features[lines].vlen);
 					}
@@ -1759,7 +1800,8 @@ template<> void StringFeatures<sg_type>::load(std::shared_ptr<File> loader)		\
 	int32_t num_str;														\
 	int32_t max_len;														\
 	loader->f_load(strs, num_str, max_len);									\
-	set_features(strs, num_str);											\
+	if (set_features(strs, num_str))										\
+		pack_into_arena();													\
 	SG_FREE(strs);															\
 	SG_RESET_LOCALE;													\
 }
@@ -1834,8 +1876,14 @@ bool StringFeatures<ST>::obtain_from_char_features(std::shared_ptr<StringFeature
 
 		features.emplace_back(len);
 
-		for (int32_t j=0; j<len; j++)
-			features.back()[j]=(ST) alpha->remap_to_bin(c[j]);
+		if constexpr (sizeof(CT)==1)
+			alpha->remap_to_bin(
+				features.back().vector, (const uint8_t*) c, len);
+		else
+		{
+			for (int32_t j=0; j<len; j++)
+				features.back()[j]=(ST) alpha->remap_to_bin(c[j]);
+		}
 	}
 
 	original_num_symbols=alpha->get_num_symbols();
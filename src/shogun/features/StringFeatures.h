@@ -131,6 +131,30 @@ template <class ST> class StringFeatures : public Features
 		 */
 		virtual void cleanup_feature_vectors(int32_t start, int32_t stop);
 
+		/** pack all strings into a single contiguous arena
+		 *
+		 * Copies every string into one contiguous buffer and replaces the
+		 * per-string allocations by views into that buffer, which avoids
+		 * millions of small allocations and heap fragmentation when many
+		 * short strings are loaded. StringPreprocessor passes that rewrite
+		 * strings in place (without changing their length) operate directly
+		 * on the arena; passes that reallocate a string transparently fall
+		 * back to a private copy for that string.
+		 *
+		 * not possible with subset
+		 */
+		void pack_into_arena();
+
+		/** @return whether the strings are backed by a contiguous arena */
+		bool has_arena_storage() const;
+
+		/** drop the arena buffer and offset table
+		 *
+		 * The string views do not own the buffer, so this must only be
+		 * called when the string list itself is discarded or replaced.
+		 */
+		void free_arena();
+
 		/** get feature class
 		 *
 		 * @return feature class STRING
@@ -647,6 +671,12 @@ template <class ST> class StringFeatures : public Features
 		/** true when single string / created by sliding window */
 		SGVector<ST> single_string;
 
+		/** contiguous symbol buffer backing all strings when packed */
+		SGVector<ST> m_arena;
+
+		/** per-string start offsets into the arena (num_vectors+1 entries) */
+		SGVector<int64_t> m_arena_offsets;
+
 		/// number of used symbols
 		floatmax_t num_symbols;
 
@@ -95,6 +95,22 @@ public:
 	 */
 	std::shared_ptr<Subset> get_last_subset() const { return m_active_subset; }
 
+	/** returns the flattened index view of the whole stack
+	 *
+	 * Nested subsets are collapsed into a single index map when they are
+	 * added, so this returns the already maintained map from view indices
+	 * to original indices without materializing anything; bulk operations
+	 * can iterate it directly instead of calling subset_idx_conversion()
+	 * per element.
+	 *
+	 * @return collapsed index map, or an empty vector if no subset is active
+	 */
+	SGVector<index_t> get_flattened_indices() const
+	{
+		return m_active_subset ? m_active_subset->m_subset_idx
+				: SGVector<index_t>();
+	}
+
 	/** returns the corresponding real index of a subset index
 	 * Maps through all added subsets in stack.
 	 *
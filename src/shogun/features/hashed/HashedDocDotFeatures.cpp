@@ -11,6 +11,7 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
 using namespace shogun;
 
@@ -132,25 +133,17 @@ float64_t HashedDocDotFeatures::dot(
 	SGVector<index_t> hashed_indices((ngrams-1)*(tokens_to_skip+1) + 1);
 
 	float64_t result = 0;
-	auto local_tzer = tokenizer->get_copy();
+	SGVector<uint32_t> token_hashes = batch_hash_tokens(sv);
+	index_t token = 0;
 
 	/** Reading n+k-1 tokens */
-	const int32_t seed = 0xdeadbeaf;
-	local_tzer->set_text(sv);
-	index_t start = 0;
-	while (hashes_end<ngrams-1+tokens_to_skip && local_tzer->has_next())
-	{
-		index_t end = local_tzer->next_token_idx(start);
-		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &sv.vector[start], end-start, seed);
-		hashes[hashes_end++] = token_hash;
-	}
+	while (hashes_end<ngrams-1+tokens_to_skip && token<token_hashes.vlen)
+		hashes[hashes_end++] = token_hashes[token++];
 
 	/** Reading token and storing indices to hashed_indices */
-	while (local_tzer->has_next())
+	for (; token<token_hashes.vlen; token++)
 	{
-		index_t end = local_tzer->next_token_idx(start);
-		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &sv.vector[start], end-start, seed);
-		hashes[hashes_end] = token_hash;
+		hashes[hashes_end] = token_hashes[token];
 
 		HashedDocConverter::generate_ngram_hashes(hashes, hashes_start, len, hashed_indices,
 				num_bits, ngrams, tokens_to_skip);
@@ -210,24 +203,16 @@ void HashedDocDotFeatures::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 	 * stored here to avoid creating new objects */
 	SGVector<index_t> hashed_indices((ngrams-1)*(tokens_to_skip+1) + 1);
 
-	auto local_tzer = tokenizer->get_copy();
+	SGVector<uint32_t> token_hashes = batch_hash_tokens(sv);
+	index_t token = 0;
 
 	/** Reading n+k-1 tokens */
-	const int32_t seed = 0xdeadbeaf;
-	local_tzer->set_text(sv);
-	index_t start = 0;
-	while (hashes_end<ngrams-1+tokens_to_skip && local_tzer->has_next())
-	{
-		index_t end = local_tzer->next_token_idx(start);
-		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &sv.vector[start], end-start, seed);
-		hashes[hashes_end++] = token_hash;
-	}
+	while (hashes_end<ngrams-1+tokens_to_skip && token<token_hashes.vlen)
+		hashes[hashes_end++] = token_hashes[token++];
 
-	while (local_tzer->has_next())
+	for (; token<token_hashes.vlen; token++)
 	{
-		index_t end = local_tzer->next_token_idx(start);
-		uint32_t token_hash = Hash::MurmurHash3((uint8_t* ) &sv.vector[start], end-start, seed);
-		hashes[hashes_end] = token_hash;
+		hashes[hashes_end] = token_hashes[token];
 
 		HashedDocConverter::generate_ngram_hashes(hashes, hashes_start, len, hashed_indices,
 				num_bits, ngrams, tokens_to_skip);
@@ -263,6 +248,36 @@ void HashedDocDotFeatures::add_to_dense_vec(float64_t alpha, int32_t vec_idx1,
 	doc_collection->free_feature_vector(sv, vec_idx1);
 }
 
+SGVector<uint32_t> HashedDocDotFeatures::batch_hash_tokens(
+		const SGVector<char>& doc) const
+{
+	const int32_t seed = 0xdeadbeaf;
+
+	auto local_tzer = tokenizer->get_copy();
+	local_tzer->set_text(doc);
+
+	/** first pass: collect all token boundaries */
+	std::vector<index_t> starts;
+	std::vector<index_t> ends;
+	index_t start = 0;
+	while (local_tzer->has_next())
+	{
+		index_t end = local_tzer->next_token_idx(start);
+		starts.push_back(start);
+		ends.push_back(end);
+	}
+
+	/** second pass: hash all tokens in one tight loop */
+	SGVector<uint32_t> hashes(index_t(starts.size()));
+	for (index_t i=0; i<hashes.vlen; i++)
+	{
+		hashes[i] = Hash::MurmurHash3((uint8_t* ) &doc.vector[starts[i]],
+				ends[i]-starts[i], seed);
+	}
+
+	return hashes;
+}
+
 uint32_t HashedDocDotFeatures::calculate_token_hash(char* token,
 		int32_t length, int32_t num_bits, uint32_t seed)
 {
@@ -204,6 +204,16 @@ public:
 private:
 	void init();
 
+	/** Tokenize the whole document once and hash all tokens in a single
+	 * tight batch. Keeping the hash loop free of virtual tokenizer calls
+	 * lets it run over contiguous boundary arrays, which is considerably
+	 * faster on long documents.
+	 *
+	 * @param doc the document to tokenize
+	 * @return the hashes of all tokens, in document order
+	 */
+	SGVector<uint32_t> batch_hash_tokens(const SGVector<char>& doc) const;
+
 protected:
 	/** the document collection*/
 	std::shared_ptr<StringFeatures<char>> doc_collection;
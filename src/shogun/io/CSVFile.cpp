@@ -13,8 +13,75 @@
 #include <shogun/io/Parser.h>
 #include <shogun/lib/DelimiterTokenizer.h>
 
+#include <cstdlib>
+#include <vector>
+
 using namespace shogun;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+
+template <typename T>
+T strto_token(const char* buf);
+
+template <>
+float32_t strto_token<float32_t>(const char* buf)
+{
+	return strtof(buf, NULL);
+}
+
+template <>
+float64_t strto_token<float64_t>(const char* buf)
+{
+	return strtod(buf, NULL);
+}
+
+/** Converts the tokens of pre-read lines into the destination matrix
+ * concurrently. Reading the lines stays sequential; the float conversion,
+ * which dominates the load time of numeric data, is split across rows
+ * since every row writes a disjoint part of the matrix.
+ */
+template <typename T>
+void parse_real_matrix_parallel(
+	const std::vector<SGVector<char>>& lines, int32_t num_tokens,
+	char delimiter, T* matrix, bool transposed)
+{
+	const index_t num_lines=static_cast<index_t>(lines.size());
+
+	#pragma omp parallel for
+	for (index_t row=0; row<num_lines; ++row)
+	{
+		const SGVector<char>& line=lines[row];
+		char buf[64];
+		index_t pos=0;
+		for (int32_t i=0; i<num_tokens; ++i)
+		{
+			while (pos<line.vlen &&
+				(line.vector[pos]==delimiter || line.vector[pos]==' '))
+				pos++;
+			index_t start=pos;
+			while (pos<line.vlen && line.vector[pos]!=delimiter &&
+				line.vector[pos]!=' ')
+				pos++;
+			if (pos<=start)
+				break;
+			index_t len=pos-start;
+			if (len>static_cast<index_t>(sizeof(buf)-1))
+				len=static_cast<index_t>(sizeof(buf)-1);
+			sg_memcpy(buf, line.vector+start, len);
+			buf[len]='\0';
+			if (!transposed)
+				matrix[i+row*num_tokens]=strto_token<T>(buf);
+			else
+				matrix[row+i*num_tokens]=strto_token<T>(buf);
+		}
+	}
+}
+
+}
+#endif
+
 CSVFile::CSVFile()
 {
 	init();
@@ -220,8 +287,6 @@ GET_MATRIX(read_byte, uint8_t)
 GET_MATRIX(read_char, char)
 GET_MATRIX(read_int, int32_t)
 GET_MATRIX(read_uint, uint32_t)
-GET_MATRIX(read_short_real, float32_t)
-GET_MATRIX(read_real, float64_t)
 GET_MATRIX(read_long_real, floatmax_t)
 GET_MATRIX(read_short, int16_t)
 GET_MATRIX(read_word, uint16_t)
@@ -229,6 +294,44 @@ GET_MATRIX(read_long, int64_t)
 GET_MATRIX(read_ulong, uint64_t)
 #undef GET_MATRIX
 
+#define GET_MATRIX_PARALLEL(sg_type) \
+void CSVFile::get_matrix(sg_type*& matrix, int32_t& num_feat, int32_t& num_vec) \
+{ \
+	int32_t num_lines=0; \
+	int32_t num_tokens=-1; \
+	\
+	skip_lines(m_num_to_skip); \
+	num_lines=get_stats(num_tokens); \
+	\
+	SG_SET_LOCALE_C; \
+	\
+	matrix=SG_MALLOC(sg_type, num_lines*num_tokens); \
+	skip_lines(m_num_to_skip); \
+	\
+	SGVector<char> lines_storage; \
+	std::vector<SGVector<char>> lines=m_line_reader->read_lines(lines_storage); \
+	\
+	parse_real_matrix_parallel(lines, num_tokens, m_delimiter, matrix, \
+		is_data_transposed); \
+	\
+	SG_RESET_LOCALE; \
+	\
+	if (!is_data_transposed) \
+	{ \
+		num_feat=num_tokens; \
+		num_vec=num_lines; \
+	} \
+	else \
+	{ \
+		num_feat=num_lines; \
+		num_vec=num_tokens; \
+	} \
+}
+
+GET_MATRIX_PARALLEL(float32_t)
+GET_MATRIX_PARALLEL(float64_t)
+#undef GET_MATRIX_PARALLEL
+
 #define GET_NDARRAY(read_func, sg_type) \
 void CSVFile::get_ndarray(sg_type*& array, int32_t*& dims, int32_t& num_dims) \
 { \
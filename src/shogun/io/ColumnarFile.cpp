@@ -0,0 +1,423 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/io/ColumnarFile.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/io/MemoryMappedFile.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/labels/DenseLabels.h>
+#include <shogun/lib/Hash.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSparseMatrix.h>
+#include <shogun/lib/SGSparseVector.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace shogun;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+
+const char* COLUMNAR_MAGIC="SGC0";
+/* fourcc + number of sections + section table offset */
+const uint64_t COLUMNAR_HEADER_SIZE=4+2*sizeof(uint64_t);
+const uint64_t COLUMNAR_ALIGNMENT=64;
+
+/** folds crc32 over the block in chunks, since Hash::crc32 takes the
+ * length as int32_t */
+uint32_t block_checksum(const uint8_t* data, uint64_t size)
+{
+	const uint64_t chunk=1u<<30;
+	uint32_t result=0;
+	uint64_t done=0;
+	while (done<size)
+	{
+		int32_t len=static_cast<int32_t>(std::min(chunk, size-done));
+		result=result*31+Hash::crc32(const_cast<uint8_t*>(data+done), len);
+		done+=len;
+	}
+	return result;
+}
+
+/** pads the file with zeros up to the next aligned offset
+ *
+ * @return the aligned offset
+ */
+uint64_t write_padding(FILE* file, uint64_t offset)
+{
+	static const char zeros[COLUMNAR_ALIGNMENT]={0};
+	uint64_t aligned=
+		(offset+COLUMNAR_ALIGNMENT-1)/COLUMNAR_ALIGNMENT*COLUMNAR_ALIGNMENT;
+	if (aligned>offset)
+		fwrite(zeros, 1, aligned-offset, file);
+	return aligned;
+}
+
+}
+#endif
+
+ColumnarFile::ColumnarFile() : SGObject()
+{
+	init();
+}
+
+ColumnarFile::ColumnarFile(const char* fname, char rw,
+	E_COMPRESSION_TYPE compression) : SGObject()
+{
+	init();
+
+	require(rw=='r' || rw=='w', "Only 'r' and 'w' modes are allowed");
+	m_task=rw;
+	m_compression=compression;
+
+	if (rw=='w')
+	{
+		if (!(m_file=fopen(fname, "wb")))
+			error("Error opening file '{}'", fname);
+
+		fwrite(COLUMNAR_MAGIC, 1, 4, m_file);
+		uint64_t zero=0;
+		fwrite(&zero, sizeof(uint64_t), 1, m_file);
+		fwrite(&zero, sizeof(uint64_t), 1, m_file);
+		m_offset=write_padding(m_file, COLUMNAR_HEADER_SIZE);
+	}
+	else
+	{
+		m_mapped_file=std::make_shared<MemoryMappedFile<char>>(fname);
+
+		const uint8_t* base=
+			reinterpret_cast<const uint8_t*>(m_mapped_file->get_map());
+		const uint64_t size=m_mapped_file->get_size();
+
+		require(size>=COLUMNAR_HEADER_SIZE,
+			"File '{}' is too small to be a columnar file", fname);
+		require(memcmp(base, COLUMNAR_MAGIC, 4)==0,
+			"File '{}' is not a columnar file", fname);
+
+		uint64_t num_sections=0;
+		uint64_t table_offset=0;
+		sg_memcpy(&num_sections, base+4, sizeof(uint64_t));
+		sg_memcpy(&table_offset, base+4+sizeof(uint64_t), sizeof(uint64_t));
+
+		require(table_offset<=size &&
+			num_sections*sizeof(ColumnarSection)<=size-table_offset,
+			"Section table of file '{}' is out of bounds", fname);
+
+		m_sections.resize(num_sections);
+		if (num_sections)
+		{
+			sg_memcpy(m_sections.data(), base+table_offset,
+				num_sections*sizeof(ColumnarSection));
+		}
+
+		for (size_t i=0; i<m_sections.size(); i++)
+		{
+			require(m_sections[i].offset<=size &&
+				m_sections[i].stored_size<=size-m_sections[i].offset,
+				"Section '{}' of file '{}' is out of bounds",
+				m_sections[i].name, fname);
+		}
+	}
+}
+
+ColumnarFile::~ColumnarFile()
+{
+	close();
+}
+
+void ColumnarFile::init()
+{
+	m_file=NULL;
+	m_task=0;
+	m_compression=UNCOMPRESSED;
+	m_offset=0;
+}
+
+void ColumnarFile::close()
+{
+	if (m_task!='w' || !m_file)
+		return;
+
+	uint64_t table_offset=m_offset;
+	uint64_t num_sections=m_sections.size();
+
+	if (num_sections && fwrite(m_sections.data(), sizeof(ColumnarSection),
+		num_sections, m_file)!=num_sections)
+	{
+		error("Error writing section table");
+	}
+
+	fseek(m_file, 4, SEEK_SET);
+	fwrite(&num_sections, sizeof(uint64_t), 1, m_file);
+	fwrite(&table_offset, sizeof(uint64_t), 1, m_file);
+
+	fclose(m_file);
+	m_file=NULL;
+}
+
+void ColumnarFile::write_block(const char* name, int32_t content,
+	int64_t num_rows, int64_t num_cols, const uint8_t* data,
+	uint64_t raw_size)
+{
+	require(m_file && m_task=='w', "File is not opened for writing!");
+	require(name && strlen(name)<sizeof(ColumnarSection::name),
+		"Section name must have at most {} characters",
+		sizeof(ColumnarSection::name)-1);
+
+	ColumnarSection section;
+	memset(&section, 0, sizeof(section));
+	strncpy(section.name, name, sizeof(section.name)-1);
+	section.content=content;
+	section.compression=m_compression;
+	section.num_rows=num_rows;
+	section.num_cols=num_cols;
+	section.offset=m_offset;
+	section.raw_size=raw_size;
+
+	uint8_t* compressed=NULL;
+	const uint8_t* stored=data;
+	uint64_t stored_size=raw_size;
+	if (m_compression!=UNCOMPRESSED)
+	{
+		auto compressor=std::make_shared<Compressor>(m_compression);
+		compressor->compress(const_cast<uint8_t*>(data), raw_size,
+			compressed, stored_size);
+		stored=compressed;
+	}
+
+	section.stored_size=stored_size;
+	section.checksum=block_checksum(stored, stored_size);
+
+	if (stored_size && fwrite(stored, 1, stored_size, m_file)!=stored_size)
+		error("Error writing section '{}'", name);
+	SG_FREE(compressed);
+
+	m_offset=write_padding(m_file, m_offset+stored_size);
+	m_sections.push_back(section);
+}
+
+const ColumnarSection& ColumnarFile::find_section(const char* name,
+	int32_t content) const
+{
+	for (size_t i=0; i<m_sections.size(); i++)
+	{
+		if (strcmp(m_sections[i].name, name)==0)
+		{
+			require(m_sections[i].content==content,
+				"Section '{}' does not hold the requested content type",
+				name);
+			return m_sections[i];
+		}
+	}
+
+	error("File has no section '{}'", name);
+	return m_sections[0];
+}
+
+const uint8_t* ColumnarFile::load_block(const ColumnarSection& section,
+	SGVector<uint8_t>& buffer) const
+{
+	require(m_mapped_file, "File is not opened for reading!");
+
+	const uint8_t* stored=
+		reinterpret_cast<const uint8_t*>(m_mapped_file->get_map())+
+		section.offset;
+
+	require(block_checksum(stored, section.stored_size)==section.checksum,
+		"Checksum mismatch in section '{}'; the file is corrupted",
+		section.name);
+
+	if (section.compression==UNCOMPRESSED)
+	{
+		require(section.stored_size==section.raw_size,
+			"Uncompressed section '{}' has inconsistent sizes",
+			section.name);
+		return stored;
+	}
+
+	buffer=SGVector<uint8_t>(static_cast<index_t>(section.raw_size));
+	uint64_t uncompressed_size=section.raw_size;
+	auto compressor=std::make_shared<Compressor>(
+		(E_COMPRESSION_TYPE) section.compression);
+	compressor->decompress(const_cast<uint8_t*>(stored),
+		section.stored_size, buffer.vector, uncompressed_size);
+	require(uncompressed_size==section.raw_size,
+		"Section '{}' decompressed to {} instead of {} bytes",
+		section.name, uncompressed_size, section.raw_size);
+
+	return buffer.vector;
+}
+
+void ColumnarFile::write_dense(const char* name,
+	const std::shared_ptr<DenseFeatures<float64_t>>& features)
+{
+	require(features, "Features are NULL!");
+
+	SGMatrix<float64_t> mat=features->get_feature_matrix();
+	write_block(name, CF_DENSE_MATRIX, mat.num_rows, mat.num_cols,
+		reinterpret_cast<const uint8_t*>(mat.matrix),
+		uint64_t(mat.num_rows)*mat.num_cols*sizeof(float64_t));
+}
+
+void ColumnarFile::write_sparse(const char* name,
+	const std::shared_ptr<SparseFeatures<float64_t>>& features)
+{
+	require(features, "Features are NULL!");
+
+	int32_t num_feat=0;
+	int32_t num_vec=0;
+	SGSparseVector<float64_t>* vecs=
+		features->get_sparse_feature_matrix(num_feat, num_vec);
+
+	int64_t nnz=0;
+	for (int32_t i=0; i<num_vec; i++)
+		nnz+=vecs[i].num_feat_entries;
+
+	// CSR layout: vector offsets, feature indices, padding, values
+	uint64_t ptr_bytes=uint64_t(num_vec+1)*sizeof(int64_t);
+	uint64_t idx_bytes=uint64_t(nnz)*sizeof(int32_t);
+	uint64_t values_offset=(ptr_bytes+idx_bytes+7)/8*8;
+	uint64_t raw_size=values_offset+uint64_t(nnz)*sizeof(float64_t);
+
+	SGVector<uint8_t> buffer(static_cast<index_t>(raw_size));
+	buffer.zero();
+
+	int64_t* row_ptr=reinterpret_cast<int64_t*>(buffer.vector);
+	int32_t* indices=reinterpret_cast<int32_t*>(buffer.vector+ptr_bytes);
+	float64_t* values=
+		reinterpret_cast<float64_t*>(buffer.vector+values_offset);
+
+	int64_t k=0;
+	row_ptr[0]=0;
+	for (int32_t i=0; i<num_vec; i++)
+	{
+		for (int32_t j=0; j<vecs[i].num_feat_entries; j++)
+		{
+			indices[k]=vecs[i].features[j].feat_index;
+			values[k]=vecs[i].features[j].entry;
+			k++;
+		}
+		row_ptr[i+1]=k;
+	}
+
+	write_block(name, CF_SPARSE_MATRIX, num_feat, num_vec, buffer.vector,
+		raw_size);
+}
+
+void ColumnarFile::write_labels(const char* name,
+	const std::shared_ptr<DenseLabels>& labels)
+{
+	require(labels, "Labels are NULL!");
+
+	SGVector<float64_t> vec=labels->get_labels();
+	write_block(name, CF_VECTOR, vec.vlen, 1,
+		reinterpret_cast<const uint8_t*>(vec.vector),
+		uint64_t(vec.vlen)*sizeof(float64_t));
+}
+
+std::shared_ptr<DenseFeatures<float64_t>> ColumnarFile::read_dense(
+	const char* name)
+{
+	const ColumnarSection& section=find_section(name, CF_DENSE_MATRIX);
+	require(section.raw_size==
+		uint64_t(section.num_rows)*section.num_cols*sizeof(float64_t),
+		"Section '{}' has inconsistent size", name);
+
+	SGVector<uint8_t> buffer;
+	const uint8_t* data=load_block(section, buffer);
+
+	SGMatrix<float64_t> mat;
+	if (section.compression==UNCOMPRESSED)
+	{
+		// zero-copy view into the mapping; no data pages are touched here
+		mat=SGMatrix<float64_t>(
+			const_cast<float64_t*>(
+				reinterpret_cast<const float64_t*>(data)),
+			static_cast<index_t>(section.num_rows),
+			static_cast<index_t>(section.num_cols), false);
+	}
+	else
+	{
+		mat=SGMatrix<float64_t>(static_cast<index_t>(section.num_rows),
+			static_cast<index_t>(section.num_cols));
+		sg_memcpy(mat.matrix, data, section.raw_size);
+	}
+
+	return std::make_shared<DenseFeatures<float64_t>>(mat);
+}
+
+std::shared_ptr<SparseFeatures<float64_t>> ColumnarFile::read_sparse(
+	const char* name)
+{
+	const ColumnarSection& section=find_section(name, CF_SPARSE_MATRIX);
+
+	SGVector<uint8_t> buffer;
+	const uint8_t* data=load_block(section, buffer);
+
+	const index_t num_feat=static_cast<index_t>(section.num_rows);
+	const index_t num_vec=static_cast<index_t>(section.num_cols);
+
+	uint64_t ptr_bytes=uint64_t(num_vec+1)*sizeof(int64_t);
+	require(section.raw_size>=ptr_bytes,
+		"Section '{}' has inconsistent size", name);
+
+	const int64_t* row_ptr=reinterpret_cast<const int64_t*>(data);
+	const int64_t nnz=row_ptr[num_vec];
+
+	uint64_t values_offset=(ptr_bytes+uint64_t(nnz)*sizeof(int32_t)+7)/8*8;
+	require(section.raw_size==values_offset+uint64_t(nnz)*sizeof(float64_t),
+		"Section '{}' has inconsistent size", name);
+
+	const int32_t* indices=
+		reinterpret_cast<const int32_t*>(data+ptr_bytes);
+	const float64_t* values=
+		reinterpret_cast<const float64_t*>(data+values_offset);
+
+	SGSparseMatrix<float64_t> sm(num_feat, num_vec);
+	for (index_t i=0; i<num_vec; i++)
+	{
+		int32_t num_entries=static_cast<int32_t>(row_ptr[i+1]-row_ptr[i]);
+		sm.sparse_matrix[i]=SGSparseVector<float64_t>(num_entries);
+		for (int32_t j=0; j<num_entries; j++)
+		{
+			sm.sparse_matrix[i].features[j].feat_index=
+				indices[row_ptr[i]+j];
+			sm.sparse_matrix[i].features[j].entry=values[row_ptr[i]+j];
+		}
+	}
+
+	return std::make_shared<SparseFeatures<float64_t>>(sm);
+}
+
+SGVector<float64_t> ColumnarFile::read_labels(const char* name)
+{
+	const ColumnarSection& section=find_section(name, CF_VECTOR);
+	require(section.raw_size==uint64_t(section.num_rows)*sizeof(float64_t),
+		"Section '{}' has inconsistent size", name);
+
+	SGVector<uint8_t> buffer;
+	const uint8_t* data=load_block(section, buffer);
+
+	if (section.compression==UNCOMPRESSED)
+	{
+		// zero-copy view into the mapping
+		return SGVector<float64_t>(
+			const_cast<float64_t*>(
+				reinterpret_cast<const float64_t*>(data)),
+			static_cast<index_t>(section.num_rows), false);
+	}
+
+	SGVector<float64_t> result(static_cast<index_t>(section.num_rows));
+	sg_memcpy(result.vector, data, section.raw_size);
+	return result;
+}
+
+int32_t ColumnarFile::get_num_sections() const
+{
+	return static_cast<int32_t>(m_sections.size());
+}
@@ -0,0 +1,184 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __COLUMNAR_FILE_H__
+#define __COLUMNAR_FILE_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/base/SGObject.h>
+#include <shogun/lib/Compressor.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/common.h>
+
+#include <memory>
+#include <vector>
+
+#include <stdio.h>
+
+namespace shogun
+{
+template <class ST> class DenseFeatures;
+template <class ST> class SparseFeatures;
+template <class T> class MemoryMappedFile;
+class DenseLabels;
+
+/** content type of a columnar file section */
+enum EColumnarContent
+{
+	CF_DENSE_MATRIX,
+	CF_SPARSE_MATRIX,
+	CF_VECTOR
+};
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/** on-disk section table entry of a columnar file (stored verbatim) */
+struct ColumnarSection
+{
+	/** section name, zero terminated */
+	char name[32];
+	/** content type (EColumnarContent) */
+	int32_t content;
+	/** compression of the stored block (E_COMPRESSION_TYPE) */
+	int32_t compression;
+	/** number of features (rows) */
+	int64_t num_rows;
+	/** number of vectors (columns) */
+	int64_t num_cols;
+	/** byte offset of the stored block, 64 byte aligned */
+	uint64_t offset;
+	/** size of the stored (possibly compressed) block in bytes */
+	uint64_t stored_size;
+	/** uncompressed size of the block in bytes */
+	uint64_t raw_size;
+	/** checksum of the stored block */
+	uint32_t checksum;
+	/** unused, keeps the entry 8 byte aligned */
+	uint32_t pad;
+};
+#endif
+
+/** @brief A sectioned columnar container for datasets.
+ *
+ * A file consists of a SGC0 fourcc header, 64 byte aligned data blocks and a
+ * trailing section table. Each section is a named, checksummed block holding
+ * a dense feature matrix, a sparse feature matrix in CSR layout or a label
+ * vector, optionally compressed per block via Compressor.
+ *
+ * Readers memory-map the file: uncompressed float64 sections are returned as
+ * zero-copy views into the mapping, so opening a dataset touches no data
+ * pages and concurrent jobs reading the same file share its page cache
+ * residency. The ColumnarFile object must outlive any zero-copy container
+ * obtained from it, and such containers are read-only.
+ */
+class ColumnarFile : public SGObject
+{
+public:
+	/** default constructor */
+	ColumnarFile();
+
+	/** constructor
+	 *
+	 * @param fname filename to open
+	 * @param rw mode, 'r' or 'w'
+	 * @param compression compression applied to blocks written through this
+	 * object (ignored when reading; each section records its own compression)
+	 */
+	ColumnarFile(const char* fname, char rw='r',
+		E_COMPRESSION_TYPE compression=UNCOMPRESSED);
+
+	/** default destructor */
+	~ColumnarFile() override;
+
+	/** write a dense feature matrix section
+	 *
+	 * @param name section name (at most 31 characters)
+	 * @param features features to store
+	 */
+	void write_dense(const char* name,
+		const std::shared_ptr<DenseFeatures<float64_t>>& features);
+
+	/** write a sparse feature matrix section in CSR layout
+	 *
+	 * @param name section name (at most 31 characters)
+	 * @param features features to store
+	 */
+	void write_sparse(const char* name,
+		const std::shared_ptr<SparseFeatures<float64_t>>& features);
+
+	/** write a label vector section
+	 *
+	 * @param name section name (at most 31 characters)
+	 * @param labels labels to store
+	 */
+	void write_labels(const char* name,
+		const std::shared_ptr<DenseLabels>& labels);
+
+	/** finish writing, i.e. store the section table and close the file;
+	 * called automatically upon destruction
+	 */
+	void close();
+
+	/** load a dense feature matrix section; zero-copy when the section is
+	 * uncompressed
+	 *
+	 * @param name section name
+	 * @return features stored under name
+	 */
+	std::shared_ptr<DenseFeatures<float64_t>> read_dense(const char* name);
+
+	/** load a sparse feature matrix section
+	 *
+	 * @param name section name
+	 * @return features stored under name
+	 */
+	std::shared_ptr<SparseFeatures<float64_t>> read_sparse(const char* name);
+
+	/** load a label vector section; zero-copy when the section is
+	 * uncompressed
+	 *
+	 * @param name section name
+	 * @return labels stored under name
+	 */
+	SGVector<float64_t> read_labels(const char* name);
+
+	/** @return number of sections in the file */
+	int32_t get_num_sections() const;
+
+	/** @return object name */
+	const char* get_name() const override { return "ColumnarFile"; }
+
+private:
+	void init();
+
+	/** compress (if requested), checksum and append one aligned block */
+	void write_block(const char* name, int32_t content, int64_t num_rows,
+		int64_t num_cols, const uint8_t* data, uint64_t raw_size);
+
+	/** find a section by name, error if missing or of wrong content type */
+	const ColumnarSection& find_section(const char* name,
+		int32_t content) const;
+
+	/** verify the checksum of a stored block and make its raw bytes
+	 * accessible; points into the mapping for uncompressed sections and into
+	 * buffer otherwise
+	 */
+	const uint8_t* load_block(const ColumnarSection& section,
+		SGVector<uint8_t>& buffer) const;
+
+private:
+	/** file handle while writing */
+	FILE* m_file;
+	/** mode */
+	char m_task;
+	/** compression applied to written blocks */
+	E_COMPRESSION_TYPE m_compression;
+	/** byte offset of the next block while writing */
+	uint64_t m_offset;
+	/** section table */
+	std::vector<ColumnarSection> m_sections;
+	/** mapping while reading */
+	std::shared_ptr<MemoryMappedFile<char>> m_mapped_file;
+};
+}
+#endif //__COLUMNAR_FILE_H__
@@ -16,8 +16,79 @@
 #include <shogun/io/HDF5File.h>
 #include <shogun/io/SGIO.h>
 
+#include <algorithm>
+
 using namespace shogun;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+
+/** Reads a two-dimensional dataset in disjoint hyperslab blocks along the
+ * leading dimension, placing (and, where the stored type differs from the
+ * memory type, converting) each block directly into its slice of the
+ * destination buffer. The blocks are read concurrently when the HDF5
+ * library is built thread-safe; otherwise they are read sequentially,
+ * which still bounds the conversion buffer the library keeps per read.
+ */
+herr_t hdf5_read_matrix_chunked(hid_t h5file, const char* variable_name,
+	hid_t h5_type, int32_t dim0, int32_t dim1, size_t element_size,
+	void* matrix)
+{
+	if (dim0<=0 || dim1<=0)
+		return 0;
+
+	const int64_t max_chunk_bytes=64*1024*1024;
+	int64_t row_bytes=int64_t(dim1)*element_size;
+	int32_t rows_per_chunk=dim0;
+	if (max_chunk_bytes/row_bytes<dim0)
+	{
+		rows_per_chunk=int32_t(
+			std::max(int64_t(1), max_chunk_bytes/row_bytes));
+	}
+	int32_t num_chunks=(dim0+rows_per_chunk-1)/rows_per_chunk;
+
+	int32_t num_failed=0;
+
+#ifdef H5_HAVE_THREADSAFE
+	#pragma omp parallel for
+#endif
+	for (int32_t c=0; c<num_chunks; c++)
+	{
+		hsize_t offset[2]={hsize_t(c)*rows_per_chunk, 0};
+		hsize_t count[2]={
+			hsize_t(std::min(rows_per_chunk, dim0-c*rows_per_chunk)),
+			hsize_t(dim1)};
+
+		hid_t dataset=H5Dopen2(h5file, variable_name, H5P_DEFAULT);
+		hid_t filespace=H5Dget_space(dataset);
+		herr_t status=H5Sselect_hyperslab(filespace, H5S_SELECT_SET,
+			offset, NULL, count, NULL);
+		hid_t memspace=H5Screate_simple(2, count, NULL);
+		if (status>=0)
+		{
+			char* dest=static_cast<char*>(matrix)+
+				int64_t(offset[0])*row_bytes;
+			status=H5Dread(dataset, h5_type, memspace, filespace,
+				H5P_DEFAULT, dest);
+		}
+		H5Sclose(memspace);
+		H5Sclose(filespace);
+		H5Dclose(dataset);
+
+		if (status<0)
+		{
+			#pragma omp atomic
+			num_failed++;
+		}
+	}
+
+	return num_failed ? -1 : 0;
+}
+
+}
+#endif
+
 HDF5File::HDF5File()
 {
 	unstable(SOURCE_LOCATION);
@@ -140,8 +211,8 @@ void HDF5File::fname(sg_type*& matrix, int32_t& num_feat, int32_t& num_vec)		\
 	matrix=SG_MALLOC(sg_type, nelements);													\
 	num_feat=dims[0];																\
 	num_vec=dims[1];																\
-	herr_t status = H5Dread(dataset, h5_type, H5S_ALL,								\
-			H5S_ALL, H5P_DEFAULT, matrix);											\
+	herr_t status = hdf5_read_matrix_chunked(h5file, variable_name,					\
+			h5_type, dims[0], dims[1], sizeof(sg_type), matrix);					\
 	H5Dclose(dataset);																\
 	H5Tclose(dtype);																\
 	SG_FREE(dims);																	\
@@ -9,16 +9,241 @@
 
 #include <shogun/base/progress.h>
 #include <shogun/io/LineReader.h>
+#include <shogun/io/MemoryMappedFile.h>
 #include <shogun/io/Parser.h>
 #include <shogun/lib/DelimiterTokenizer.h>
 #include <shogun/lib/SGSparseVector.h>
 #include <shogun/lib/SGVector.h>
+#include <shogun/lib/exception/ShogunException.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
 #include <vector>
 
 using namespace shogun;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+
+template <typename T>
+T strto_entry(const char* buf);
+
+template <>
+float32_t strto_entry<float32_t>(const char* buf)
+{
+	return strtof(buf, NULL);
+}
+
+template <>
+float64_t strto_entry<float64_t>(const char* buf)
+{
+	return strtod(buf, NULL);
+}
+
+/** Parses a LibSVM file directly from a read-only memory mapping instead of
+ * streaming it through LineReader/Parser. Line boundaries are located with
+ * memchr (vectorized in libc) and the index:value conversion -- the dominant
+ * cost on large files -- runs over the rows concurrently; every row owns a
+ * disjoint slot of the output arrays. Only enabled for real-valued element
+ * types; returns false (leaving the outputs untouched) when the file cannot
+ * be mapped so that the caller can fall back to the streamed reader.
+ */
+template <typename T>
+bool parse_sparse_matrix_mmap(const char* fname, char delimiter_feat,
+	SGSparseVector<T>*& mat_feat, int32_t& num_feat, int32_t& num_vec,
+	SGVector<float64_t>*& multilabel, int32_t& num_classes, bool load_labels)
+{
+	if constexpr (!std::is_same_v<T, float32_t> && !std::is_same_v<T, float64_t>)
+	{
+		return false;
+	}
+	else
+	{
+		std::shared_ptr<MemoryMappedFile<char>> mapped_file;
+		try
+		{
+			mapped_file=std::make_shared<MemoryMappedFile<char>>(fname);
+		}
+		catch (const ShogunException& e)
+		{
+			return false;
+		}
+
+		const char* data=mapped_file->get_map();
+		const uint64_t size=mapped_file->get_size();
+
+		std::vector<std::pair<uint64_t, uint64_t>> line_bounds;
+		uint64_t pos=0;
+		while (pos<size)
+		{
+			const char* eol=static_cast<const char*>(
+				memchr(data+pos, '\n', size-pos));
+			uint64_t end=eol!=NULL ? static_cast<uint64_t>(eol-data) : size;
+			line_bounds.emplace_back(pos, end);
+			pos=end+1;
+		}
+
+		num_vec=static_cast<int32_t>(line_bounds.size());
+		num_feat=0;
+
+		mat_feat=SG_MALLOC(SGSparseVector<T>, num_vec);
+		multilabel=SG_MALLOC(SGVector<float64_t>, num_vec);
+
+		std::vector<float64_t> classes;
+
+		#pragma omp parallel
+		{
+			int32_t num_feat_thread=0;
+			std::vector<float64_t> classes_thread;
+
+			#pragma omp for nowait
+			for (int32_t i=0; i<num_vec; i++)
+			{
+				const char* begin=data+line_bounds[i].first;
+				const char* end=data+line_bounds[i].second;
+
+				// first pass: locate the label token and count feature entries
+				const char* label_tok=NULL;
+				const char* label_end=NULL;
+				int32_t num_feat_entries=0;
+				bool first=true;
+				for (const char* p=begin; p<end; )
+				{
+					while (p<end && *p==' ')
+						p++;
+					const char* tok=p;
+					while (p<end && *p!=' ')
+						p++;
+					if (p<=tok)
+						break;
+					if (first && load_labels &&
+						memchr(tok, delimiter_feat, p-tok)==NULL)
+					{
+						label_tok=tok;
+						label_end=p;
+					}
+					else
+						num_feat_entries++;
+					first=false;
+				}
+
+				mat_feat[i]=SGSparseVector<T>(num_feat_entries);
+
+				// second pass: convert index:value pairs in place
+				int32_t k=0;
+				for (const char* p=begin; p<end; )
+				{
+					while (p<end && *p==' ')
+						p++;
+					const char* tok=p;
+					while (p<end && *p!=' ')
+						p++;
+					if (p<=tok)
+						break;
+					if (tok==label_tok)
+						continue;
+
+					char buf[128];
+					index_t len=static_cast<index_t>(p-tok);
+					if (len>static_cast<index_t>(sizeof(buf)-1))
+						len=static_cast<index_t>(sizeof(buf)-1);
+					sg_memcpy(buf, tok, len);
+					buf[len]='\0';
+
+					char* value_str=NULL;
+					int32_t feat_index=
+						static_cast<int32_t>(strtol(buf, &value_str, 10));
+					T entry=0;
+					if (value_str!=NULL && *value_str==delimiter_feat)
+						entry=strto_entry<T>(value_str+1);
+
+					if (feat_index>num_feat_thread)
+						num_feat_thread=feat_index;
+
+					mat_feat[i].features[k].feat_index=feat_index-1;
+					mat_feat[i].features[k].entry=entry;
+					k++;
+				}
+
+				if (load_labels)
+				{
+					int32_t num_label_entries=0;
+					if (label_tok!=NULL)
+					{
+						for (const char* p=label_tok; p<label_end; )
+						{
+							while (p<label_end && *p==',')
+								p++;
+							const char* tok=p;
+							while (p<label_end && *p!=',')
+								p++;
+							if (p>tok)
+								num_label_entries++;
+						}
+					}
+
+					multilabel[i]=SGVector<float64_t>(num_label_entries);
+
+					int32_t j=0;
+					if (label_tok!=NULL)
+					{
+						for (const char* p=label_tok; p<label_end; )
+						{
+							while (p<label_end && *p==',')
+								p++;
+							const char* tok=p;
+							while (p<label_end && *p!=',')
+								p++;
+							if (p<=tok)
+								break;
+
+							char buf[64];
+							index_t len=static_cast<index_t>(p-tok);
+							if (len>static_cast<index_t>(sizeof(buf)-1))
+								len=static_cast<index_t>(sizeof(buf)-1);
+							sg_memcpy(buf, tok, len);
+							buf[len]='\0';
+
+							float64_t label_val=strtod(buf, NULL);
+							if (std::find(classes_thread.begin(),
+								classes_thread.end(), label_val)==
+								classes_thread.end())
+							{
+								classes_thread.push_back(label_val);
+							}
+							multilabel[i][j++]=label_val;
+						}
+					}
+				}
+			}
+
+			#pragma omp critical
+			{
+				if (num_feat_thread>num_feat)
+					num_feat=num_feat_thread;
+				for (size_t c=0; c<classes_thread.size(); c++)
+				{
+					if (std::find(classes.begin(), classes.end(),
+						classes_thread[c])==classes.end())
+					{
+						classes.push_back(classes_thread[c]);
+					}
+				}
+			}
+		}
+
+		num_classes=static_cast<int32_t>(classes.size());
+
+		return true;
+	}
+}
+
+}
+#endif
+
 LibSVMFile::LibSVMFile()
 {
 	init();
@@ -152,6 +377,22 @@ GET_LABELED_SPARSE_MATRIX(read_ulong, uint64_t)
 	{                                                                          \
 		num_feat = 0;                                                          \
                                                                                \
+		if (filename && task == 'r')                                           \
+		{                                                                      \
+			SG_SET_LOCALE_C;                                                   \
+			bool mapped = parse_sparse_matrix_mmap<sg_type>(                   \
+			    filename, m_delimiter_feat, mat_feat, num_feat, num_vec,       \
+			    multilabel, num_classes, load_labels);                         \
+			SG_RESET_LOCALE;                                                   \
+			if (mapped)                                                        \
+			{                                                                  \
+				io::info(                                                      \
+				    "memory mapped file {} ({} lines) successfully read.",     \
+				    filename, num_vec);                                        \
+				return;                                                        \
+			}                                                                  \
+		}                                                                      \
+                                                                               \
 		io::info("counting line numbers in file {}.", filename);               \
 		num_vec = get_num_lines();                                             \
 		io::info("File {} has {} lines.", filename, num_vec);                  \
@@ -6,6 +6,7 @@
  */
 
 #include <cstdio>
+#include <cstring>
 #include <shogun/io/LineReader.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/CircularBuffer.h>
@@ -102,6 +103,64 @@ SGVector<char> LineReader::read_line()
 	return line;
 }
 
+std::vector<SGVector<char>> LineReader::read_lines(SGVector<char>& storage)
+{
+	if (m_stream==NULL || m_max_token_length==0 || m_tokenizer==NULL)
+	{
+		error("LineReader::read_lines():: Class is not initialized");
+		return std::vector<SGVector<char>>();
+	}
+
+	const int32_t chunk_size=1024*1024;
+
+	int32_t capacity=chunk_size;
+	int32_t size=0;
+	char* data=SG_MALLOC(char, capacity);
+
+	// bytes already pulled into the circular buffer come first
+	int32_t num_buffered=m_buffer->num_bytes_contained();
+	if (num_buffered>0)
+	{
+		SGVector<char> buffered=m_buffer->pop(num_buffered);
+		sg_memcpy(data, buffered.vector, num_buffered);
+		size=num_buffered;
+	}
+
+	while (!feof(m_stream) && !ferror(m_stream))
+	{
+		if (capacity-size<chunk_size)
+		{
+			data=SG_REALLOC(char, data, capacity, 2*capacity);
+			capacity*=2;
+		}
+		size+=fread(data+size, sizeof(char), chunk_size, m_stream);
+	}
+
+	if (ferror(m_stream))
+		error("LineReader::read_lines():: Error reading file");
+
+	storage=SGVector<char>(data, size);
+
+	std::vector<SGVector<char>> lines;
+	char* line_begin=storage.vector;
+	char* storage_end=storage.vector+storage.vlen;
+	while (line_begin<storage_end)
+	{
+		char* line_end=static_cast<char*>(
+			memchr(line_begin, '\n', storage_end-line_begin));
+		if (line_end==NULL)
+			line_end=storage_end;
+		if (line_end>line_begin)
+		{
+			lines.push_back(SGVector<char>(line_begin,
+				static_cast<index_t>(line_end-line_begin), false));
+		}
+		line_begin=line_end+1;
+	}
+
+	return lines;
+}
+
 void LineReader::reset()
 {
 	rewind(m_stream);
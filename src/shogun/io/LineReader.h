@@ -13,6 +13,8 @@
 #include <shogun/lib/SGVector.h>
 #include <shogun/base/SGObject.h>
 
+#include <vector>
+
 namespace shogun
 {
 class CircularBuffer;
@@ -56,6 +58,21 @@ public:
 	/** read string	*/
 	virtual SGVector<char> read_line();
 
+	/** read all remaining lines of the stream at once
+	 *
+	 * The remainder of the stream is pulled into one contiguous block
+	 * and split at '\n' with a single large-window scan per line,
+	 * instead of the byte-at-a-time delimiter search done by
+	 * read_line(). The returned vectors are zero-copy views into
+	 * storage and stay valid only as long as storage is alive. Empty
+	 * lines are skipped, matching a tokenizer with
+	 * skip_consecutive_delimiters.
+	 *
+	 * @param storage vector that owns the bytes backing the views
+	 * @return views into storage, one per non-empty line
+	 */
+	virtual std::vector<SGVector<char>> read_lines(SGVector<char>& storage);
+
 	/** set position of stream to the beginning and clear buffer */
 	void reset();
 
@@ -22,8 +22,30 @@ template<class S>
 class BitseryReaderVisitor: public detail::BitseryVisitor<S, BitseryReaderVisitor<S>>
 {
 public:
-	BitseryReaderVisitor(S& s):
-		detail::BitseryVisitor<S,BitseryReaderVisitor<S>>(s) {}
+	BitseryReaderVisitor(S& s, shared_ptr<InputStream> stream):
+		detail::BitseryVisitor<S,BitseryReaderVisitor<S>>(s),
+		m_stream(std::move(stream)), m_fast_profile(false) {}
+
+	void set_fast_profile(bool fast_profile)
+	{
+		m_fast_profile = fast_profile;
+	}
+
+	bool on_buffer(void* buffer, int64_t num_elements,
+		size_t element_size) override
+	{
+		if (!m_fast_profile)
+			return false;
+
+		// raw block written by the fast-load profile; a single read
+		// replaces the per-element visitor dispatch
+		int64_t bytes = num_elements * element_size;
+		auto ec = m_stream->read(&m_buffer, bytes);
+		if (ec)
+			throw io::to_system_error(ec);
+		copy_n(m_buffer.begin(), bytes, reinterpret_cast<char*>(buffer));
+		return true;
+	}
 
 	void on_complex(S& s, complex128_t* v)
 	{
@@ -75,6 +97,10 @@ public:
 	std::optional<float64_t> m_auto_value;
 
 private:
+	shared_ptr<InputStream> m_stream;
+	string m_buffer;
+	bool m_fast_profile;
+
 	SG_DELETE_COPY_AND_ASSIGN(BitseryReaderVisitor);
 };
 
@@ -119,6 +145,12 @@ std::shared_ptr<SGObject> object_reader(Reader& reader, BitseryReaderVisitor<Rea
 {
 	size_t obj_magic;
 	reader.value8b(obj_magic);
+	if (obj_magic == detail::kFastProfileMagic)
+	{
+		// stream was written with the fast-load profile
+		visitor->set_fast_profile(true);
+		reader.value8b(obj_magic);
+	}
 	if (obj_magic == detail::kNullObjectMagic)
 		return nullptr;
 
@@ -180,7 +212,7 @@ std::shared_ptr<SGObject> BitseryDeserializer::read_object()
 {
 	InputStreamAdapter adapter { stream() };
 	BitseryDeser deser {std::move(adapter)};
-	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser);
+	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser, stream());
 	return object_reader(deser, addressof(reader_visitor));
 }
 
@@ -188,6 +220,6 @@ void BitseryDeserializer::read(std::shared_ptr<SGObject> _this)
 {
 	InputStreamAdapter adapter { stream() };
 	BitseryDeser deser {std::move(adapter)};
-	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser);
+	BitseryReaderVisitor<BitseryDeser> reader_visitor(deser, stream());
 	object_reader(deser, addressof(reader_visitor), _this);
 }
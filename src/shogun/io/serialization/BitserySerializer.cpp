@@ -21,8 +21,24 @@ template<class Writer>
 class BitseryWriterVisitor : public detail::BitseryVisitor<Writer, BitseryWriterVisitor<Writer>>
 {
 public:
-	BitseryWriterVisitor(Writer& w):
-		detail::BitseryVisitor<Writer,BitseryWriterVisitor<Writer>>(w) {}
+	BitseryWriterVisitor(Writer& w, shared_ptr<OutputStream> stream,
+		bool fast_profile):
+		detail::BitseryVisitor<Writer,BitseryWriterVisitor<Writer>>(w),
+		m_stream(std::move(stream)), m_fast_profile(fast_profile) {}
+
+	bool on_buffer(void* buffer, int64_t num_elements,
+		size_t element_size) override
+	{
+		if (!m_fast_profile)
+			return false;
+
+		// raw block: the adapter writes values through unbuffered, so the
+		// block can go straight to the underlying stream
+		auto ec = m_stream->write(buffer, num_elements * element_size);
+		if (ec)
+			throw io::to_system_error(ec);
+		return true;
+	}
 
 	void on_complex(Writer& writer, complex128_t* v)
 	{
@@ -74,6 +90,10 @@ public:
 	}
 
 	std::optional<float64_t> m_auto_value;
+
+private:
+	shared_ptr<OutputStream> m_stream;
+	bool m_fast_profile;
 };
 
 struct OutputStreamAdapter
@@ -131,7 +151,13 @@ void write_object(Writer& writer, BitseryWriterVisitor<Writer>* visitor, const s
 using OutputAdapter = AdapterWriter<OutputStreamAdapter, bitsery::DefaultConfig>;
 using BitserySer = BasicSerializer<OutputAdapter>;
 
-BitserySerializer::BitserySerializer() : Serializer()
+BitserySerializer::BitserySerializer() : Serializer(),
+	m_fast_profile(false)
+{
+}
+
+BitserySerializer::BitserySerializer(bool fast_profile) : Serializer(),
+	m_fast_profile(fast_profile)
 {
 }
 
@@ -143,6 +169,9 @@ void BitserySerializer::write(const shared_ptr<SGObject>& object) noexcept(false
 {
 	OutputStreamAdapter adapter { stream() };
  	BitserySer serializer {std::move(adapter)};
- 	BitseryWriterVisitor<BitserySer> writer_visitor(serializer);
+ 	BitseryWriterVisitor<BitserySer> writer_visitor(
+ 		serializer, stream(), m_fast_profile);
+ 	if (m_fast_profile)
+ 		serializer.value8b(*const_cast<size_t*>(&detail::kFastProfileMagic));
  	write_object(serializer, addressof(writer_visitor), object);
 }
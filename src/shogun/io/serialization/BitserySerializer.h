@@ -15,6 +15,16 @@ namespace shogun
 		{
 		public:
 			BitserySerializer();
+
+			/** constructor
+			 *
+			 * @param fast_profile when true, contiguous primitive buffers
+			 * (vector and matrix parameters) are written as raw blocks that
+			 * the deserializer reads back in a single call instead of
+			 * element-by-element; such streams are native-endian and are
+			 * detected automatically by BitseryDeserializer
+			 */
+			explicit BitserySerializer(bool fast_profile);
 			~BitserySerializer() override;
 			void write(const std::shared_ptr<SGObject>& object) override;
 
@@ -22,6 +32,9 @@ namespace shogun
 			{
 				return "BitserySerializer";
 			}
+
+		private:
+			bool m_fast_profile;
 		};
 	}
 }
@@ -15,6 +15,9 @@ namespace shogun
 		namespace detail
 		{
 			static const size_t kNullObjectMagic = std::numeric_limits<size_t>::max();
+			/** stream head marker of the fast-load profile, in which
+			 * contiguous primitive buffers are stored as raw blocks */
+			static const size_t kFastProfileMagic = 0xF457F457F457F457ull;
 
 			template <class S, class T>
 			class BitseryVisitor : public AnyVisitor
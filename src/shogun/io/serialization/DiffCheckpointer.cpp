@@ -0,0 +1,707 @@
+/** This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/io/ShogunErrc.h>
+#include <shogun/io/fs/FileSystem.h>
+#include <shogun/io/serialization/DiffCheckpointer.h>
+#include <shogun/io/stream/FileInputStream.h>
+#include <shogun/io/stream/FileOutputStream.h>
+#include <shogun/lib/Hash.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace shogun;
+using namespace shogun::io;
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace
+{
+	const char* const kDeltaMagic = "SGDF";
+
+	/** Folds every visited value into a single crc32-based content hash.
+	 * Nested objects are hashed recursively so that a change anywhere
+	 * below a parameter changes the parameter's hash.
+	 */
+	class HashingVisitor : public AnyVisitor
+	{
+	public:
+		HashingVisitor() : AnyVisitor(), m_hash(0)
+		{
+		}
+
+		uint32_t hash() const
+		{
+			return m_hash;
+		}
+
+		void on(bool* v) override
+		{
+			fold_scalar<uint8_t>(*v ? 1 : 0);
+		}
+		void on(std::vector<bool>::reference* v) override
+		{
+			fold_scalar<uint8_t>(*v ? 1 : 0);
+		}
+		void on(char* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(int8_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(uint8_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(int16_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(uint16_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(int32_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(uint32_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(int64_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(uint64_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(float32_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(float64_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(floatmax_t* v) override
+		{
+			fold_scalar(*v);
+		}
+		void on(complex128_t* v) override
+		{
+			fold_bytes(v, sizeof(*v));
+		}
+		void on(std::shared_ptr<SGObject>* v) override
+		{
+			if (!*v)
+			{
+				fold_scalar<uint8_t>(0);
+				return;
+			}
+
+			for (const auto& p : (*v)->get_params())
+			{
+				const Any& value = p.second->get_value();
+				if (!value.visitable() || !value.cloneable())
+					continue;
+				fold_bytes(p.first.c_str(), p.first.size());
+				(*v)->visit_parameter(BaseTag(p.first), this);
+			}
+		}
+		void on(std::string* v) override
+		{
+			fold_bytes(v->c_str(), v->size());
+		}
+		void on(AutoValueEmpty* v) override
+		{
+			fold_scalar<uint8_t>(0xA5);
+		}
+		void enter_matrix(index_t* rows, index_t* cols) override
+		{
+			fold_scalar(*rows);
+			fold_scalar(*cols);
+		}
+		void enter_vector(index_t* size) override
+		{
+			fold_scalar(*size);
+		}
+		void enter_std_vector(size_t* size) override
+		{
+			fold_scalar(static_cast<uint64_t>(*size));
+		}
+		void enter_map(size_t* size) override
+		{
+			fold_scalar(static_cast<uint64_t>(*size));
+		}
+		void enter_auto_value(bool* is_empty) override
+		{
+			fold_scalar<uint8_t>(*is_empty ? 1 : 0);
+		}
+		void enter_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_vector(index_t* size) override
+		{
+		}
+		void exit_std_vector(size_t* size) override
+		{
+		}
+		void exit_map(size_t* size) override
+		{
+		}
+		bool on_buffer(
+			void* buffer, int64_t num_elements, size_t element_size) override
+		{
+			fold_bytes(buffer, num_elements*element_size);
+			return true;
+		}
+
+	private:
+		template <typename T>
+		void fold_scalar(T v)
+		{
+			fold_bytes(&v, sizeof(v));
+		}
+
+		void fold_bytes(const void* data, uint64_t num_bytes)
+		{
+			// Hash::crc32 takes int32 lengths; fold large buffers chunkwise
+			const uint64_t max_chunk = 1u<<30;
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			for (uint64_t done = 0; done < num_bytes; done += max_chunk)
+			{
+				int32_t chunk = static_cast<int32_t>(
+					std::min(max_chunk, num_bytes-done));
+				m_hash = m_hash*31 + Hash::crc32(
+					const_cast<uint8_t*>(bytes+done), chunk);
+			}
+			if (!num_bytes)
+				m_hash = m_hash*31;
+		}
+
+		uint32_t m_hash;
+	};
+
+	/** Serializes one parameter into a flat, self-contained byte string:
+	 * scalars and buffers as native-endian raw bytes, container sizes
+	 * inline so that applying the payload can resize the destination.
+	 * Parameters whose traversal reaches an unsupported node (nested
+	 * objects, maps, std::vectors) are flagged so the caller can fall
+	 * back to a full keyframe.
+	 */
+	class DeltaWriteVisitor : public AnyVisitor
+	{
+	public:
+		DeltaWriteVisitor() : AnyVisitor(), m_supported(true)
+		{
+		}
+
+		bool supported() const
+		{
+			return m_supported;
+		}
+
+		const std::string& payload() const
+		{
+			return m_payload;
+		}
+
+		void on(bool* v) override
+		{
+			put_scalar<uint8_t>(*v ? 1 : 0);
+		}
+		void on(std::vector<bool>::reference* v) override
+		{
+			put_scalar<uint8_t>(*v ? 1 : 0);
+		}
+		void on(char* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(int8_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(uint8_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(int16_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(uint16_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(int32_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(uint32_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(int64_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(uint64_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(float32_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(float64_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(floatmax_t* v) override
+		{
+			put_scalar(*v);
+		}
+		void on(complex128_t* v) override
+		{
+			put_bytes(v, sizeof(*v));
+		}
+		void on(std::shared_ptr<SGObject>* v) override
+		{
+			m_supported = false;
+		}
+		void on(std::string* v) override
+		{
+			put_scalar<uint64_t>(v->size());
+			put_bytes(v->c_str(), v->size());
+		}
+		void on(AutoValueEmpty* v) override
+		{
+		}
+		void enter_matrix(index_t* rows, index_t* cols) override
+		{
+			put_scalar(*rows);
+			put_scalar(*cols);
+		}
+		void enter_vector(index_t* size) override
+		{
+			put_scalar(*size);
+		}
+		void enter_std_vector(size_t* size) override
+		{
+			m_supported = false;
+		}
+		void enter_map(size_t* size) override
+		{
+			m_supported = false;
+		}
+		void enter_auto_value(bool* is_empty) override
+		{
+			put_scalar<uint8_t>(*is_empty ? 1 : 0);
+		}
+		void enter_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_vector(index_t* size) override
+		{
+		}
+		void exit_std_vector(size_t* size) override
+		{
+		}
+		void exit_map(size_t* size) override
+		{
+		}
+		bool on_buffer(
+			void* buffer, int64_t num_elements, size_t element_size) override
+		{
+			put_bytes(buffer, num_elements*element_size);
+			return true;
+		}
+
+	private:
+		template <typename T>
+		void put_scalar(T v)
+		{
+			put_bytes(&v, sizeof(v));
+		}
+
+		void put_bytes(const void* data, uint64_t num_bytes)
+		{
+			m_payload.append(static_cast<const char*>(data), num_bytes);
+		}
+
+		std::string m_payload;
+		bool m_supported;
+	};
+
+	/** Replays a DeltaWriteVisitor payload onto the destination
+	 * parameter; container sizes stored in the payload resize the
+	 * destination through the enter_* size pointers.
+	 */
+	class DeltaApplyVisitor : public AnyVisitor
+	{
+	public:
+		DeltaApplyVisitor(const char* payload, uint64_t num_bytes) :
+			AnyVisitor(), m_cursor(payload), m_end(payload+num_bytes)
+		{
+		}
+
+		bool exhausted() const
+		{
+			return m_cursor == m_end;
+		}
+
+		void on(bool* v) override
+		{
+			*v = get_scalar<uint8_t>() != 0;
+		}
+		void on(std::vector<bool>::reference* v) override
+		{
+			*v = get_scalar<uint8_t>() != 0;
+		}
+		void on(char* v) override
+		{
+			*v = get_scalar<char>();
+		}
+		void on(int8_t* v) override
+		{
+			*v = get_scalar<int8_t>();
+		}
+		void on(uint8_t* v) override
+		{
+			*v = get_scalar<uint8_t>();
+		}
+		void on(int16_t* v) override
+		{
+			*v = get_scalar<int16_t>();
+		}
+		void on(uint16_t* v) override
+		{
+			*v = get_scalar<uint16_t>();
+		}
+		void on(int32_t* v) override
+		{
+			*v = get_scalar<int32_t>();
+		}
+		void on(uint32_t* v) override
+		{
+			*v = get_scalar<uint32_t>();
+		}
+		void on(int64_t* v) override
+		{
+			*v = get_scalar<int64_t>();
+		}
+		void on(uint64_t* v) override
+		{
+			*v = get_scalar<uint64_t>();
+		}
+		void on(float32_t* v) override
+		{
+			*v = get_scalar<float32_t>();
+		}
+		void on(float64_t* v) override
+		{
+			*v = get_scalar<float64_t>();
+		}
+		void on(floatmax_t* v) override
+		{
+			*v = get_scalar<floatmax_t>();
+		}
+		void on(complex128_t* v) override
+		{
+			get_bytes(v, sizeof(*v));
+		}
+		void on(std::shared_ptr<SGObject>* v) override
+		{
+			error("DiffCheckpointer: delta payload reached a nested "
+				"object, the delta file is corrupted");
+		}
+		void on(std::string* v) override
+		{
+			uint64_t length = get_scalar<uint64_t>();
+			v->resize(length);
+			get_bytes(length ? &(*v)[0] : NULL, length);
+		}
+		void on(AutoValueEmpty* v) override
+		{
+		}
+		void enter_matrix(index_t* rows, index_t* cols) override
+		{
+			*rows = get_scalar<index_t>();
+			*cols = get_scalar<index_t>();
+		}
+		void enter_vector(index_t* size) override
+		{
+			*size = get_scalar<index_t>();
+		}
+		void enter_std_vector(size_t* size) override
+		{
+			error("DiffCheckpointer: delta payload reached a std::vector, "
+				"the delta file is corrupted");
+		}
+		void enter_map(size_t* size) override
+		{
+			error("DiffCheckpointer: delta payload reached a map, "
+				"the delta file is corrupted");
+		}
+		void enter_auto_value(bool* is_empty) override
+		{
+			*is_empty = get_scalar<uint8_t>() != 0;
+		}
+		void enter_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix_row(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_matrix(index_t* rows, index_t* cols) override
+		{
+		}
+		void exit_vector(index_t* size) override
+		{
+		}
+		void exit_std_vector(size_t* size) override
+		{
+		}
+		void exit_map(size_t* size) override
+		{
+		}
+		bool on_buffer(
+			void* buffer, int64_t num_elements, size_t element_size) override
+		{
+			get_bytes(buffer, num_elements*element_size);
+			return true;
+		}
+
+	private:
+		template <typename T>
+		T get_scalar()
+		{
+			T v;
+			get_bytes(&v, sizeof(v));
+			return v;
+		}
+
+		void get_bytes(void* dest, uint64_t num_bytes)
+		{
+			require(static_cast<uint64_t>(m_end-m_cursor)>=num_bytes,
+				"DiffCheckpointer: delta payload is truncated");
+			if (num_bytes)
+				sg_memcpy(dest, m_cursor, num_bytes);
+			m_cursor += num_bytes;
+		}
+
+		const char* m_cursor;
+		const char* m_end;
+	};
+
+	void write_raw(const std::shared_ptr<OutputStream>& stream,
+		const void* data, uint64_t num_bytes)
+	{
+		if (auto ec = stream->write(data, num_bytes))
+			throw to_system_error(ec);
+	}
+
+	template <typename T>
+	void write_value(const std::shared_ptr<OutputStream>& stream, T value)
+	{
+		write_raw(stream, &value, sizeof(value));
+	}
+}
+#endif
+
+DiffCheckpointer::DiffCheckpointer() : SGObject()
+{
+	init();
+}
+
+DiffCheckpointer::DiffCheckpointer(std::shared_ptr<Serializer> serializer,
+	const std::string& path_prefix, int32_t keyframe_interval) : SGObject()
+{
+	init();
+
+	require(serializer!=NULL, "Serializer is not set");
+	require(keyframe_interval>0, "Keyframe interval ({}) must be positive",
+		keyframe_interval);
+
+	m_serializer=std::move(serializer);
+	m_path_prefix=path_prefix;
+	m_keyframe_interval=keyframe_interval;
+}
+
+DiffCheckpointer::~DiffCheckpointer()
+{
+}
+
+void DiffCheckpointer::init()
+{
+	m_serializer=NULL;
+	m_keyframe_interval=16;
+	m_num_snapshots=0;
+}
+
+int64_t DiffCheckpointer::get_num_snapshots() const
+{
+	return m_num_snapshots;
+}
+
+std::string DiffCheckpointer::snapshot(const std::shared_ptr<SGObject>& object)
+{
+	require(object!=NULL, "Object is not set");
+	require(m_serializer!=NULL, "Serializer is not set");
+
+	auto params=object->get_params();
+
+	// hash every registered parameter and collect the changed ones
+	std::map<std::string, uint32_t> hashes;
+	std::vector<std::string> changed;
+	for (const auto& p : params)
+	{
+		const Any& value=p.second->get_value();
+		if (!value.visitable() || !value.cloneable())
+			continue;
+
+		HashingVisitor hasher;
+		object->visit_parameter(BaseTag(p.first), &hasher);
+		hashes[p.first]=hasher.hash();
+
+		auto it=m_hashes.find(p.first);
+		if (it==m_hashes.end() || it->second!=hasher.hash())
+			changed.push_back(p.first);
+	}
+
+	bool keyframe=(m_num_snapshots%m_keyframe_interval==0);
+
+	// build the delta payloads; unsupported parameters force a keyframe
+	std::vector<std::pair<std::string, std::string>> entries;
+	if (!keyframe)
+	{
+		for (const auto& name : changed)
+		{
+			DeltaWriteVisitor writer;
+			object->visit_parameter(BaseTag(name), &writer);
+			if (!writer.supported())
+			{
+				io::info("Parameter {} cannot be written as a delta, "
+					"writing a full keyframe instead", name.c_str());
+				keyframe=true;
+				break;
+			}
+			entries.emplace_back(name, writer.payload());
+		}
+	}
+
+	std::string path=m_path_prefix+"."+std::to_string(m_num_snapshots);
+	if (keyframe)
+	{
+		path+=".keyframe";
+		serialize(path, object, m_serializer);
+	}
+	else
+	{
+		path+=".delta";
+
+		auto fs=env();
+		std::error_condition ec;
+		std::unique_ptr<WritableFile> file;
+		if ((ec=fs->new_writable_file(path, &file)))
+			throw to_system_error(ec);
+
+		auto stream=std::make_shared<FileOutputStream>(file.get());
+		write_raw(stream, kDeltaMagic, 4);
+		write_value<uint64_t>(stream, m_num_snapshots);
+		write_value<uint64_t>(stream, entries.size());
+		for (const auto& entry : entries)
+		{
+			write_value<uint64_t>(stream, entry.first.size());
+			write_raw(stream, entry.first.c_str(), entry.first.size());
+			write_value<uint64_t>(stream, entry.second.size());
+			write_raw(stream, entry.second.c_str(), entry.second.size());
+		}
+		stream->flush();
+	}
+
+	m_hashes=std::move(hashes);
+	m_num_snapshots++;
+
+	return path;
+}
+
+void DiffCheckpointer::apply_delta(const std::shared_ptr<SGObject>& object,
+	const std::string& path)
+{
+	require(object!=NULL, "Object is not set");
+
+	auto fs=env();
+	std::error_condition ec;
+	std::unique_ptr<RandomAccessFile> file;
+	if ((ec=fs->new_random_access_file(path, &file)))
+		throw to_system_error(ec);
+
+	auto stream=std::make_shared<FileInputStream>(file.get());
+
+	std::string content;
+	std::string chunk;
+	while (!(ec=stream->read(&chunk, 1024*1024)))
+		content+=chunk;
+	content+=chunk;
+	if (!is_out_of_range(ec))
+		throw to_system_error(ec);
+
+	DeltaApplyVisitor header(content.c_str(), content.size());
+	char magic[4];
+	header.on_buffer(magic, 4, 1);
+	require(memcmp(magic, kDeltaMagic, 4)==0,
+		"File {} is not a delta checkpoint", path.c_str());
+
+	uint64_t snapshot_idx=0;
+	uint64_t num_entries=0;
+	header.on_buffer(&snapshot_idx, 1, sizeof(snapshot_idx));
+	header.on_buffer(&num_entries, 1, sizeof(num_entries));
+
+	auto params=object->get_params();
+	for (uint64_t i=0; i<num_entries; i++)
+	{
+		uint64_t name_length=0;
+		header.on_buffer(&name_length, 1, sizeof(name_length));
+		std::string name(name_length, '\0');
+		header.on_buffer(name_length ? &name[0] : NULL, name_length, 1);
+
+		uint64_t payload_length=0;
+		header.on_buffer(&payload_length, 1, sizeof(payload_length));
+
+		require(params.count(name)>0,
+			"Delta file {} contains parameter {} which {} does not have",
+			path.c_str(), name.c_str(), object->get_name());
+
+		SGVector<char> payload(static_cast<index_t>(payload_length));
+		header.on_buffer(payload.vector, payload_length, 1);
+
+		DeltaApplyVisitor applier(payload.vector, payload_length);
+		object->visit_parameter(BaseTag(name), &applier);
+		require(applier.exhausted(),
+			"Parameter {} did not consume its delta payload in {}",
+			name.c_str(), path.c_str());
+	}
+
+	SG_DEBUG("applied {} parameters from delta snapshot {} in {}",
+		num_entries, snapshot_idx, path.c_str());
+}
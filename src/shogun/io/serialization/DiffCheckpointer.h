@@ -0,0 +1,100 @@
+/** This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __DIFF_CHECKPOINTER_H__
+#define __DIFF_CHECKPOINTER_H__
+
+#include <shogun/base/SGObject.h>
+#include <shogun/io/serialization/Serializer.h>
+
+#include <map>
+#include <string>
+
+namespace shogun
+{
+	namespace io
+	{
+		/** @brief Differential checkpointing of SGObject state.
+		 *
+		 * Periodic snapshots of a model during long training runs usually
+		 * rewrite the whole object even though only a few tensors changed
+		 * since the last snapshot. DiffCheckpointer tracks a content hash
+		 * per registered parameter and writes, for most snapshots, a small
+		 * binary delta file containing only the parameters whose hash
+		 * changed. Every keyframe_interval-th snapshot (and whenever a
+		 * changed parameter cannot be expressed as a flat delta, e.g. a
+		 * nested SGObject) a full keyframe is written through the attached
+		 * Serializer instead.
+		 *
+		 * To restore, deserialize the latest keyframe with the matching
+		 * Deserializer and then apply_delta() the subsequent delta files
+		 * in snapshot order.
+		 */
+		class DiffCheckpointer : public SGObject
+		{
+		public:
+			/** default constructor */
+			DiffCheckpointer();
+
+			/** constructor
+			 *
+			 * @param serializer serializer used for full keyframes
+			 * @param path_prefix prefix of checkpoint file names; snapshot
+			 * i is written to "<prefix>.<i>.keyframe" or "<prefix>.<i>.delta"
+			 * @param keyframe_interval every keyframe_interval-th snapshot
+			 * is a full keyframe
+			 */
+			DiffCheckpointer(std::shared_ptr<Serializer> serializer,
+				const std::string& path_prefix,
+				int32_t keyframe_interval=16);
+
+			~DiffCheckpointer() override;
+
+			/** write the next checkpoint of an object
+			 *
+			 * @param object object to snapshot
+			 * @return path of the file that was written
+			 */
+			std::string snapshot(const std::shared_ptr<SGObject>& object);
+
+			/** apply a delta file on top of the current state of an object
+			 *
+			 * @param object object to patch; must hold the state the delta
+			 * was computed against
+			 * @param path path of a delta file written by snapshot()
+			 */
+			void apply_delta(const std::shared_ptr<SGObject>& object,
+				const std::string& path);
+
+			/** @return number of snapshots written so far */
+			int64_t get_num_snapshots() const;
+
+			/** @return object name */
+			const char* get_name() const override
+			{
+				return "DiffCheckpointer";
+			}
+
+		private:
+			/** class initialization */
+			void init();
+
+		private:
+			/** serializer for full keyframes */
+			std::shared_ptr<Serializer> m_serializer;
+
+			/** prefix of checkpoint file names */
+			std::string m_path_prefix;
+
+			/** interval between full keyframes */
+			int32_t m_keyframe_interval;
+
+			/** number of snapshots written */
+			int64_t m_num_snapshots;
+
+			/** content hash per parameter at the last snapshot */
+			std::map<std::string, uint32_t> m_hashes;
+		};
+	}
+}
+
+#endif /* __DIFF_CHECKPOINTER_H__ */
@@ -0,0 +1,169 @@
+#include <shogun/io/ShogunErrc.h>
+#include <shogun/io/stream/PrefetchInputStream.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace shogun::io;
+
+PrefetchInputStream::PrefetchInputStream(InputStream* is, size_t buffer_bytes,
+	size_t num_buffers):
+	InputStream(),
+	m_is(is),
+	m_size(buffer_bytes),
+	m_num_buffers(std::max<size_t>(1, num_buffers))
+{
+	start();
+}
+
+PrefetchInputStream::~PrefetchInputStream()
+{
+	stop();
+}
+
+void PrefetchInputStream::start()
+{
+	m_thread = std::thread(&PrefetchInputStream::prefetch_loop, this);
+}
+
+void PrefetchInputStream::stop()
+{
+	{
+		unique_lock<mutex> lock(m_lock);
+		m_shutdown = true;
+	}
+	m_not_full.notify_all();
+	m_not_empty.notify_all();
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+void PrefetchInputStream::prefetch_loop()
+{
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(m_lock);
+			m_not_full.wait(lock, [this]
+			{
+				return m_queue.size() < m_num_buffers || m_shutdown;
+			});
+			if (m_shutdown)
+				return;
+		}
+
+		// the actual blocking read happens without the lock held
+		Chunk chunk;
+		chunk.status = m_is->read(&chunk.data, m_size);
+
+		unique_lock<mutex> lock(m_lock);
+		const bool final_chunk = bool(chunk.status);
+		if (final_chunk)
+		{
+			m_done = true;
+			m_status = chunk.status;
+		}
+		m_queue.push_back(std::move(chunk));
+		m_not_empty.notify_one();
+		if (final_chunk)
+			return;
+	}
+}
+
+bool PrefetchInputStream::next_chunk(error_condition& r)
+{
+	unique_lock<mutex> lock(m_lock);
+	m_not_empty.wait(lock, [this]
+	{
+		return !m_queue.empty() || m_done || m_shutdown;
+	});
+
+	if (m_queue.empty())
+	{
+		r = m_status;
+		return false;
+	}
+
+	m_current = std::move(m_queue.front());
+	m_queue.pop_front();
+	m_pos = 0;
+	r = m_current.status;
+	m_not_full.notify_one();
+	return !m_current.data.empty();
+}
+
+error_condition PrefetchInputStream::read(string* buffer, int64_t size)
+{
+	if (size < 0)
+		return make_error_condition(errc::invalid_argument);
+
+	buffer->clear();
+	buffer->reserve(size);
+
+	error_condition r;
+	while (buffer->size() < static_cast<size_t>(size))
+	{
+		if (m_pos == m_current.data.size())
+		{
+			if (!next_chunk(r))
+				break;
+		}
+
+		const int64_t bytes_to_copy = std::min<int64_t>(
+			m_current.data.size() - m_pos, size - buffer->size());
+		buffer->insert(buffer->size(), m_current.data, m_pos, bytes_to_copy);
+		m_pos += bytes_to_copy;
+		m_consumed += bytes_to_copy;
+	}
+
+	if (io::is_out_of_range(r) &&
+		(buffer->size() == static_cast<size_t>(size)))
+		return {};
+
+	return r;
+}
+
+error_condition PrefetchInputStream::skip(int64_t bytes)
+{
+	if (bytes < 0)
+		return make_error_condition(errc::invalid_argument);
+
+	error_condition r;
+	while (bytes > 0)
+	{
+		if (m_pos == m_current.data.size())
+		{
+			if (!next_chunk(r))
+				return r;
+		}
+
+		const int64_t n = std::min<int64_t>(
+			m_current.data.size() - m_pos, bytes);
+		m_pos += n;
+		m_consumed += n;
+		bytes -= n;
+	}
+
+	return {};
+}
+
+int64_t PrefetchInputStream::tell() const
+{
+	return m_consumed;
+}
+
+void PrefetchInputStream::reset()
+{
+	stop();
+	m_is->reset();
+
+	m_queue.clear();
+	m_current = Chunk();
+	m_pos = 0;
+	m_consumed = 0;
+	m_shutdown = false;
+	m_done = false;
+	m_status = {};
+
+	start();
+}
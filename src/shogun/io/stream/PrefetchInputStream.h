@@ -0,0 +1,96 @@
+/** This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __PREFETCH_INPUT_STREAM_H__
+#define __PREFETCH_INPUT_STREAM_H__
+
+#include <shogun/base/macros.h>
+#include <shogun/io/stream/InputStream.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace shogun
+{
+	namespace io
+	{
+#define IGNORE_IN_CLASSLIST
+		/** An input stream that reads ahead of its consumer.
+		 *
+		 * A background thread keeps up to num_buffers chunks of
+		 * buffer_bytes each in flight on the wrapped stream, so sequential
+		 * consumers overlap their processing with disk reads instead of
+		 * stalling on them. Reads, skips and positions observed through
+		 * this stream behave exactly as on BufferedInputStream.
+		 *
+		 * The wrapped stream must not be accessed by anyone else while a
+		 * PrefetchInputStream is attached to it, since the background
+		 * thread advances its position ahead of the consumer.
+		 */
+		IGNORE_IN_CLASSLIST class PrefetchInputStream : public InputStream
+		{
+		public:
+			/**
+			 * Construct a prefetching input stream
+			 *
+			 * @param is stream to read ahead on; must outlive this object
+			 * @param buffer_bytes size of one prefetched chunk
+			 * @param num_buffers number of chunks kept in flight
+			 */
+			PrefetchInputStream(InputStream* is,
+				size_t buffer_bytes = 1 << 20, size_t num_buffers = 4);
+
+			~PrefetchInputStream() override;
+
+			std::error_condition read(std::string* buffer, int64_t size) override;
+			std::error_condition skip(int64_t bytes) override;
+			int64_t tell() const override;
+			void reset() override;
+
+			const char* get_name() const override
+			{
+				return "PrefetchInputStream";
+			}
+
+		private:
+			struct Chunk
+			{
+				std::string data;
+				std::error_condition status;
+			};
+
+			void start();
+			void stop();
+			void prefetch_loop();
+
+			/** make the next prefetched chunk current, blocking until one
+			 * is available; returns false when the stream is exhausted,
+			 * with r holding the terminal status
+			 */
+			bool next_chunk(std::error_condition& r);
+
+		private:
+			InputStream* m_is;
+			size_t m_size;
+			size_t m_num_buffers;
+
+			std::deque<Chunk> m_queue;
+			std::mutex m_lock;
+			std::condition_variable m_not_empty;
+			std::condition_variable m_not_full;
+			std::thread m_thread;
+			bool m_shutdown = false;
+			bool m_done = false;
+			std::error_condition m_status;
+
+			Chunk m_current;
+			size_t m_pos = 0;
+			int64_t m_consumed = 0;
+
+			SG_DELETE_COPY_AND_ASSIGN(PrefetchInputStream);
+		};
+	}
+}
+
+#endif /* __PREFETCH_INPUT_STREAM_H__ */
@@ -14,12 +14,16 @@
 #include <shogun/io/SGIO.h>
 #include <shogun/io/streaming/StreamingFile.h>
 #include <shogun/io/streaming/ParseBuffer.h>
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <thread>
 
-#define PARSER_DEFAULT_BUFFSIZE 100
+/** Default depth of the examples ring. A deep ring lets the parse thread run
+ * far ahead of the learner, so short learner stalls do not drain the buffer
+ * and short parser stalls (e.g. slow reads) do not starve the learner. */
+#define PARSER_DEFAULT_BUFFSIZE 1024
 
 namespace shogun
 {
@@ -289,8 +293,8 @@ private:
     static void* parse_loop_entry_point(void* params);
 
 public:
-    bool parsing_done;	/**< true if all input is parsed */
-    bool reading_done;	/**< true if all examples are fetched */
+    std::atomic_bool parsing_done;	/**< true if all input is parsed */
+    std::atomic_bool reading_done;	/**< true if all examples are fetched */
 
     E_EXAMPLE_TYPE example_type; /**< LABELLED or UNLABELLED */
 
@@ -356,6 +360,10 @@ protected:
 	/// Flag that indicate that the parsing thread should continue reading
 	alignas(CPU_CACHE_LINE_SIZE) std::atomic_bool keep_running;
 
+	/// Whether the learner is blocked in get_next_example() waiting for an
+	/// example; lets the parse thread skip the wakeup syscall otherwise
+	alignas(CPU_CACHE_LINE_SIZE) std::atomic_bool learner_waiting;
+
 };
 
 template <class T>
@@ -379,6 +387,7 @@ template <class T>
 	parsing_done=true;
 	reading_done=true;
 	keep_running.store(false, std::memory_order_release);
+	learner_waiting.store(false, std::memory_order_release);
 }
 
 template <class T>
@@ -509,13 +518,10 @@ template <class T> void* InputParser<T>::main_parse_loop(void* params)
 
     while (keep_running.load(std::memory_order_acquire))
 	{
-		std::unique_lock<std::mutex> lock(examples_state_lock);
-
 		if (parsing_done)
 		{
 			return NULL;
 		}
-		lock.unlock();
 
 		current_example = examples_ring->get_free_example();
 		current_feature_vector = current_example->fv;
@@ -529,7 +535,7 @@ template <class T> void* InputParser<T>::main_parse_loop(void* params)
 
 		if (current_len < 0)
 		{
-			lock.lock();
+			std::lock_guard<std::mutex> lock(examples_state_lock);
 			parsing_done = true;
 			examples_state_changed.notify_one();
 			return NULL;
@@ -540,9 +546,14 @@ template <class T> void* InputParser<T>::main_parse_loop(void* params)
 		current_example->length = current_len;
 
 		examples_ring->copy_example(current_example);
-		lock.lock();
+		std::lock_guard<std::mutex> lock(examples_state_lock);
 		number_of_vectors_parsed++;
-		examples_state_changed.notify_one();
+
+		/* only pay for a wakeup when the learner has actually drained the
+		 * ring and is blocked; while both sides are busy the parser stays
+		 * ahead without any syscalls */
+		if (learner_waiting.load(std::memory_order_acquire))
+			examples_state_changed.notify_one();
 	}
     return NULL;
 }
@@ -605,7 +616,9 @@ template <class T> int32_t InputParser<T>::get_next_example(T* &fv,
             else
             {
                 /* Examples left, wait for one to become ready */
+				learner_waiting.store(true, std::memory_order_release);
 				examples_state_changed.wait(lock);
+				learner_waiting.store(false, std::memory_order_release);
                 continue;
             }
         }
@@ -18,16 +18,79 @@ StreamingAsciiFile::StreamingAsciiFile()
 {
 	unstable(SOURCE_LOCATION);
 	m_delimiter = ' ';
+	m_cache_file = NULL;
+	m_cache_reading = false;
+	m_cache_complete = false;
 }
 
 StreamingAsciiFile::StreamingAsciiFile(const char* fname, char rw)
 		: StreamingFile(fname, rw)
 {
 	m_delimiter = ' ';
+	m_cache_file = NULL;
+	m_cache_reading = false;
+	m_cache_complete = false;
 }
 
 StreamingAsciiFile::~StreamingAsciiFile()
 {
+	if (m_cache_file)
+	{
+		fclose(m_cache_file);
+		remove(m_cache_fname.c_str());
+	}
+}
+
+void StreamingAsciiFile::set_binary_cache(const char* cache_fname)
+{
+	require(task=='r', "Binary cache is only supported when reading");
+	require(!m_cache_file, "Binary cache is already enabled");
+
+	if (cache_fname)
+		m_cache_fname=cache_fname;
+	else
+	{
+		require(filename, "Binary cache needs a cache file name when the "
+			"input is not read from a named file");
+		m_cache_fname=std::string(filename)+".bin_cache";
+	}
+
+	m_cache_file=fopen(m_cache_fname.c_str(), "w+b");
+	if (!m_cache_file)
+		error("Could not open binary cache file {}", m_cache_fname.c_str());
+}
+
+bool StreamingAsciiFile::is_seekable()
+{
+	return m_cache_file!=NULL && m_cache_complete;
+}
+
+void StreamingAsciiFile::reset_stream()
+{
+	require(m_cache_file!=NULL && m_cache_complete,
+		"Unable to reset the input stream: the binary cache must be "
+		"enabled with set_binary_cache() and a full pass over the input "
+		"must have completed");
+
+	if (!m_cache_reading)
+	{
+		fflush(m_cache_file);
+		m_cache_reading=true;
+	}
+	rewind(m_cache_file);
+}
+
+void StreamingAsciiFile::cache_mark_end()
+{
+	if (!m_cache_file || m_cache_reading || m_cache_complete)
+		return;
+
+	int32_t end_marker=-1;
+	if (fwrite(&end_marker, sizeof(int32_t), 1, m_cache_file)!=1)
+		error("Could not write to binary cache file {}", m_cache_fname.c_str());
+
+	fflush(m_cache_file);
+	m_cache_complete=true;
 }
 
 /* Methods for reading dense vectors from an ascii file */
@@ -39,11 +102,18 @@ void StreamingAsciiFile::get_vector(sg_type*& vector, int32_t& num_feat)	\
 		ssize_t bytes_read;													\
 		int32_t old_len = num_feat;											\
 																			\
+		if (m_cache_reading)												\
+		{																	\
+				cache_read_dense(vector, num_feat, (float64_t*) NULL);		\
+				return;														\
+		}																	\
+																			\
 		SG_SET_LOCALE_C;													\
 		bytes_read = buf->read_line(buffer);								\
 																			\
 		if (bytes_read<=0)													\
 		{																	\
+				cache_mark_end();											\
 				vector=NULL;												\
 				num_feat=-1;												\
 				SG_RESET_LOCALE;											\
@@ -99,6 +169,7 @@ void StreamingAsciiFile::get_vector(sg_type*& vector, int32_t& num_feat)	\
 				vector[i]=conv(item);										\
 				SG_FREE(item);												\
 		}																	\
+		cache_write_dense(vector, num_feat, (const float64_t*) NULL);		\
 		SG_RESET_LOCALE;													\
 }
 
@@ -119,12 +190,18 @@ GET_VECTOR(get_longreal_vector, atoi, floatmax_t)
 		void StreamingAsciiFile::get_vector(sg_type*& vector, int32_t& len)\
 		{																	\
 				char *line=NULL;											\
+				if (m_cache_reading)										\
+				{															\
+						cache_read_dense(vector, len, (float64_t*) NULL);	\
+						return;												\
+				}															\
 				SG_SET_LOCALE_C;											\
 				int32_t num_chars = buf->read_line(line);					\
 				int32_t old_len = len;										\
 																			\
 				if (num_chars == 0)											\
 				{															\
+						cache_mark_end();									\
 						len = -1;											\
 						SG_RESET_LOCALE;									\
 						return;												\
@@ -145,6 +222,7 @@ GET_VECTOR(get_longreal_vector, atoi, floatmax_t)
 				{															\
 						vector[j++] = io::SGIO::float_of_substring(*i);		\
 				}															\
+				cache_write_dense(vector, len, (const float64_t*) NULL);	\
 				SG_RESET_LOCALE;											\
 		}
 
@@ -160,12 +238,18 @@ GET_FLOAT_VECTOR(float64_t)
 				char* buffer = NULL;									\
 				ssize_t bytes_read;										\
 				int32_t old_len = num_feat;								\
+				if (m_cache_reading)									\
+				{														\
+						cache_read_dense(vector, num_feat, &label);		\
+						return;											\
+				}														\
 				SG_SET_LOCALE_C;										\
 																		\
 				bytes_read = buf->read_line(buffer);					\
 																		\
 				if (bytes_read<=0)										\
 				{														\
+						cache_mark_end();								\
 						vector=NULL;									\
 						num_feat=-1;									\
 						SG_RESET_LOCALE;								\
@@ -223,6 +307,7 @@ GET_FLOAT_VECTOR(float64_t)
 						SG_FREE(item);									\
 				}														\
 				num_feat--;												\
+				cache_write_dense(vector, num_feat, &label);			\
 				SG_RESET_LOCALE;										\
 		}
 
@@ -243,12 +328,18 @@ GET_VECTOR_AND_LABEL(get_longreal_vector_and_label, atoi, floatmax_t)
 		void StreamingAsciiFile::get_vector_and_label(sg_type*& vector, int32_t& len, float64_t& label) \
 		{																\
 				char *line=NULL;										\
+				if (m_cache_reading)									\
+				{														\
+						cache_read_dense(vector, len, &label);			\
+						return;											\
+				}														\
 				SG_SET_LOCALE_C;										\
 				int32_t num_chars = buf->read_line(line);				\
 				int32_t old_len = len;									\
 																		\
 				if (num_chars == 0)										\
 				{														\
+						cache_mark_end();								\
 						len = -1;										\
 						SG_RESET_LOCALE;								\
 						return;											\
@@ -271,6 +362,7 @@ GET_VECTOR_AND_LABEL(get_longreal_vector_and_label, atoi, floatmax_t)
 				{														\
 						vector[j++] = io::SGIO::float_of_substring(*i);		\
 				}														\
+				cache_write_dense(vector, len, &label);					\
 				SG_RESET_LOCALE;										\
 		}
 
@@ -399,12 +491,18 @@ void StreamingAsciiFile::get_sparse_vector(SGSparseVectorEntry<sg_type>*& vector
 {																		\
 		char* buffer = NULL;											\
 		ssize_t bytes_read;												\
+		if (m_cache_reading)											\
+		{																\
+				cache_read_sparse(vector, len, (float64_t*) NULL);		\
+				return;													\
+		}																\
 		SG_SET_LOCALE_C;												\
 																		\
 		bytes_read = buf->read_line(buffer);							\
 																		\
 		if (bytes_read<=1)												\
 		{																\
+				cache_mark_end();										\
 				vector=NULL;											\
 				len=-1;													\
 				SG_RESET_LOCALE;										\
@@ -468,6 +566,7 @@ void StreamingAsciiFile::get_sparse_vector(SGSparseVectorEntry<sg_type>*& vector
 		}																\
 																		\
 		len=current_feat;												\
+		cache_write_sparse(vector, len, (const float64_t*) NULL);		\
 		SG_RESET_LOCALE;												\
 }
 
@@ -493,12 +592,18 @@ void StreamingAsciiFile::get_sparse_vector_and_label(SGSparseVectorEntry<sg_type
 {																		\
 		char* buffer = NULL;											\
 		ssize_t bytes_read;												\
+		if (m_cache_reading)											\
+		{																\
+				cache_read_sparse(vector, len, &label);					\
+				return;													\
+		}																\
 		SG_SET_LOCALE_C;												\
 																		\
 		bytes_read = buf->read_line(buffer);							\
 																		\
 		if (bytes_read<=1)												\
 		{																\
+				cache_mark_end();										\
 				vector=NULL;											\
 				len=-1;													\
 				SG_RESET_LOCALE;										\
@@ -584,6 +689,7 @@ void StreamingAsciiFile::get_sparse_vector_and_label(SGSparseVectorEntry<sg_type
 		}																\
 																		\
 		len=current_feat;												\
+		cache_write_sparse(vector, len, &label);						\
 		SG_RESET_LOCALE;												\
 }
 
@@ -617,6 +723,119 @@ void StreamingAsciiFile::append_item(
 		items.push_back(item);
 }
 
+template <class T>
+void StreamingAsciiFile::cache_read_dense(T*& vector, int32_t& len,
+		float64_t* label)
+{
+		int32_t old_len=len;
+		int32_t stored_len=0;
+		if (fread(&stored_len, sizeof(int32_t), 1, m_cache_file)!=1 ||
+				stored_len<0)
+		{
+				len=-1;
+				return;
+		}
+
+		uint8_t has_label=0;
+		if (fread(&has_label, sizeof(uint8_t), 1, m_cache_file)!=1)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		require((has_label!=0)==(label!=NULL),
+				"Binary cache file {} mixes labelled and unlabelled examples",
+				m_cache_fname.c_str());
+
+		if (has_label && fread(label, sizeof(float64_t), 1, m_cache_file)!=1)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		if (stored_len>old_len)
+				vector=SG_REALLOC(T, vector, old_len, stored_len);
+
+		if (stored_len>0 &&
+				fread(vector, sizeof(T), stored_len, m_cache_file)!=
+				(size_t) stored_len)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		len=stored_len;
+}
+
+template <class T>
+void StreamingAsciiFile::cache_write_dense(T* vector, int32_t len,
+		const float64_t* label)
+{
+		if (!m_cache_file || m_cache_reading || m_cache_complete)
+				return;
+
+		uint8_t has_label=label ? 1 : 0;
+		if (fwrite(&len, sizeof(int32_t), 1, m_cache_file)!=1 ||
+				fwrite(&has_label, sizeof(uint8_t), 1, m_cache_file)!=1 ||
+				(has_label &&
+				fwrite(label, sizeof(float64_t), 1, m_cache_file)!=1) ||
+				(len>0 &&
+				fwrite(vector, sizeof(T), len, m_cache_file)!=(size_t) len))
+		{
+				error("Could not write to binary cache file {}",
+						m_cache_fname.c_str());
+		}
+}
+
+template <class T>
+void StreamingAsciiFile::cache_read_sparse(SGSparseVectorEntry<T>*& vector,
+		int32_t& len, float64_t* label)
+{
+		int32_t old_len=len;
+		int32_t stored_len=0;
+		if (fread(&stored_len, sizeof(int32_t), 1, m_cache_file)!=1 ||
+				stored_len<0)
+		{
+				vector=NULL;
+				len=-1;
+				return;
+		}
+
+		uint8_t has_label=0;
+		if (fread(&has_label, sizeof(uint8_t), 1, m_cache_file)!=1)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		require((has_label!=0)==(label!=NULL),
+				"Binary cache file {} mixes labelled and unlabelled examples",
+				m_cache_fname.c_str());
+
+		if (has_label && fread(label, sizeof(float64_t), 1, m_cache_file)!=1)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		if (stored_len>old_len)
+				vector=SG_REALLOC(SGSparseVectorEntry<T>, vector, old_len,
+						stored_len);
+
+		if (stored_len>0 &&
+				fread(vector, sizeof(SGSparseVectorEntry<T>), stored_len,
+				m_cache_file)!=(size_t) stored_len)
+				error("Binary cache file {} is truncated", m_cache_fname.c_str());
+
+		len=stored_len;
+}
+
+template <class T>
+void StreamingAsciiFile::cache_write_sparse(SGSparseVectorEntry<T>* vector,
+		int32_t len, const float64_t* label)
+{
+		if (!m_cache_file || m_cache_reading || m_cache_complete)
+				return;
+
+		uint8_t has_label=label ? 1 : 0;
+		if (fwrite(&len, sizeof(int32_t), 1, m_cache_file)!=1 ||
+				fwrite(&has_label, sizeof(uint8_t), 1, m_cache_file)!=1 ||
+				(has_label &&
+				fwrite(label, sizeof(float64_t), 1, m_cache_file)!=1) ||
+				(len>0 &&
+				fwrite(vector, sizeof(SGSparseVectorEntry<T>), len,
+				m_cache_file)!=(size_t) len))
+		{
+				error("Could not write to binary cache file {}",
+						m_cache_fname.c_str());
+		}
+}
+
 void StreamingAsciiFile::set_delimiter(char delimiter)
 {
 	m_delimiter = delimiter;
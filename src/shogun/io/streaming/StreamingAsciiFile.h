@@ -12,6 +12,9 @@
 #include <shogun/io/streaming/StreamingFile.h>
 #include <shogun/lib/v_array.h>
 
+#include <cstdio>
+#include <string>
+
 namespace shogun
 {
 
@@ -51,6 +54,29 @@ public:
 	 */
 	void set_delimiter(char delimiter);
 
+	/** enable a transparent binary conversion cache
+	 *
+	 * During the first pass every parsed dense or sparse example is
+	 * spilled to a compact binary side file. Once the ascii stream has
+	 * been consumed completely, reset_stream() switches reading over to
+	 * that file, so later epochs stream pre-parsed examples at near
+	 * disk bandwidth instead of re-tokenizing the same text. String
+	 * examples are not cached. The cache file is removed when this
+	 * object is destroyed.
+	 *
+	 * @param cache_fname name of the cache file; if NULL, the input
+	 * file name with a ".bin_cache" suffix is used
+	 */
+	void set_binary_cache(const char* cache_fname=NULL);
+
+	/** @return true when the stream can be reset, i.e. once the binary
+	 * cache holds a complete pass over the input */
+	bool is_seekable() override;
+
+	/** restart reading from the first example; only supported once the
+	 * binary cache has seen a full pass over the ascii input */
+	void reset_stream() override;
+
 #ifndef SWIG // SWIG should skip this
 	/**
 	 * Utility function to convert a string to a boolean value
@@ -126,12 +152,45 @@ private:
 	 */
 	void tokenize(char delim, substring s, v_array<substring> &ret);
 
+	/** read the next dense example from the binary cache */
+	template <class T>
+	void cache_read_dense(T*& vector, int32_t& len, float64_t* label);
+
+	/** append a parsed dense example to the binary cache */
+	template <class T>
+	void cache_write_dense(T* vector, int32_t len, const float64_t* label);
+
+	/** read the next sparse example from the binary cache */
+	template <class T>
+	void cache_read_sparse(SGSparseVectorEntry<T>*& vector, int32_t& len,
+			float64_t* label);
+
+	/** append a parsed sparse example to the binary cache */
+	template <class T>
+	void cache_write_sparse(SGSparseVectorEntry<T>* vector, int32_t len,
+			const float64_t* label);
+
+	/** record end of the first pass in the binary cache */
+	void cache_mark_end();
+
 private:
 	/// Helper for parsing
 	v_array<substring> words;
 
 	/** delimiter */
 	char m_delimiter;
+
+	/** binary conversion cache, NULL if disabled */
+	FILE* m_cache_file;
+
+	/** name of the binary cache file */
+	std::string m_cache_fname;
+
+	/** whether examples are currently served from the cache */
+	bool m_cache_reading;
+
+	/** whether the cache holds a complete pass over the input */
+	bool m_cache_complete;
 };
 }
 #endif //__STREAMING_ASCIIFILE_H__
@@ -13,6 +13,10 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/kernel/CombinedKernel.h>
 #include <shogun/kernel/CustomKernel.h>
+#include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
 #include <shogun/features/CombinedFeatures.h>
 #include <string.h>
 #include <shogun/mathematics/Math.h>
@@ -336,6 +340,79 @@ void CombinedKernel::list_kernels()
 	io::info("END COMBINED KERNEL LIST - ");
 }
 
+bool CombinedKernel::has_block_computation()
+{
+	if (get_num_kernels()==0)
+		return false;
+
+	/* compute_block() produces normalized values of the sub-kernels only,
+	 * so the combined kernel itself must not normalize on top */
+	return std::dynamic_pointer_cast<IdentityKernelNormalizer>(normalizer)!=nullptr;
+}
+
+void CombinedKernel::compute_block(
+	int32_t row_start, int32_t num_rows, int32_t col_start, int32_t num_cols,
+	float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Kernel::compute_block(
+			row_start, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	for (int32_t j=0; j<num_cols; j++)
+		memset(&block[int64_t(j)*ld], 0, num_rows*sizeof(float64_t));
+
+	int32_t num_kernels=get_num_kernels();
+
+	/* sub-kernels are evaluated in parallel (unless we already run inside
+	 * a parallel tile loop) and their weighted tiles are fused into the
+	 * target in one accumulation per thread */
+#ifdef HAVE_OPENMP
+	#pragma omp parallel if (!omp_in_parallel())
+#endif
+	{
+		SGMatrix<float64_t> local(num_rows, num_cols);
+		SGMatrix<float64_t> buffer(num_rows, num_cols);
+		memset(local.matrix, 0,
+			int64_t(num_rows)*num_cols*sizeof(float64_t));
+		bool touched=false;
+
+#ifdef HAVE_OPENMP
+		#pragma omp for schedule(dynamic)
+#endif
+		for (int32_t k_idx=0; k_idx<num_kernels; k_idx++)
+		{
+			auto k=get_kernel(k_idx);
+			float64_t weight=k->get_combined_kernel_weight();
+			if (weight==0)
+				continue;
+
+			k->compute_block(row_start, num_rows, col_start, num_cols,
+				buffer.matrix, num_rows);
+
+			for (int64_t i=0; i<int64_t(num_rows)*num_cols; i++)
+				local.matrix[i]+=weight*buffer.matrix[i];
+			touched=true;
+		}
+
+		if (touched)
+		{
+#ifdef HAVE_OPENMP
+			#pragma omp critical
+#endif
+			{
+				for (int32_t j=0; j<num_cols; j++)
+				{
+					for (int32_t i=0; i<num_rows; i++)
+						block[i+int64_t(j)*ld]+=local(i, j);
+				}
+			}
+		}
+	}
+}
+
 float64_t CombinedKernel::compute(int32_t x, int32_t y)
 {
 	float64_t result=0;
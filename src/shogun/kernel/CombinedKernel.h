@@ -103,6 +103,29 @@ class CombinedKernel : public Kernel
 		 */
 		const char* get_name() const override { return "CombinedKernel"; }
 
+		/** whether the fused blocked evaluation path is available, i.e.
+		 * there are sub-kernels and the combined kernel itself does not
+		 * normalize on top of them
+		 *
+		 * @return whether compute_block() uses the fused path
+		 */
+		bool has_block_computation() override;
+
+		/** compute a tile of the combined kernel matrix by evaluating the
+		 * sub-kernels in parallel and fusing their weighted tiles into the
+		 * target with one accumulation per thread
+		 *
+		 * @param row_start first row (lhs index) of the block
+		 * @param num_rows number of rows of the block
+		 * @param col_start first column (rhs index) of the block
+		 * @param num_cols number of columns of the block
+		 * @param block column-major target buffer
+		 * @param ld leading dimension of the target buffer
+		 */
+		void compute_block(
+			int32_t row_start, int32_t num_rows, int32_t col_start,
+			int32_t num_cols, float64_t* block, int32_t ld) override;
+
 		/** list kernels */
 		void list_kernels();
 
@@ -355,6 +355,54 @@ SGVector<float64_t> CustomKernel::row_col_wise_sum_block(index_t
 	return sum;
 }
 
+bool CustomKernel::save_kernel_matrix_to_binary(const char* fname)
+{
+	require(kmatrix.matrix, "{}::save_kernel_matrix_to_binary(): No kernel "
+			"matrix set!", get_name());
+	require(!upper_diagonal, "{}::save_kernel_matrix_to_binary(): Not "
+			"possible with triangular storage!", get_name());
+
+	int64_t num_bytes=int64_t(kmatrix.num_rows)*kmatrix.num_cols
+		*sizeof(float32_t);
+
+	MemoryMappedFile<float32_t> mapped(fname, 'w', num_bytes);
+	sg_memcpy(mapped.get_map(), kmatrix.matrix, num_bytes);
+	mapped.set_truncate_size(num_bytes);
+
+	io::info("wrote {} x {} kernel matrix ({} bytes) to '{}'",
+			kmatrix.num_rows, kmatrix.num_cols, num_bytes, fname);
+	return true;
+}
+
+bool CustomKernel::map_kernel_matrix_from_binary(const char* fname,
+		index_t rows, index_t cols, bool check_symmetry)
+{
+	require(rows>0 && cols>0, "{}::map_kernel_matrix_from_binary(): "
+			"Invalid matrix size {} x {}!", get_name(), rows, cols);
+
+	cleanup_custom();
+
+	m_mapped_kmatrix=std::make_shared<MemoryMappedFile<float32_t>>(fname);
+	require(m_mapped_kmatrix->get_length()==uint64_t(int64_t(rows)*cols),
+			"{}::map_kernel_matrix_from_binary(): File '{}' holds {} "
+			"elements, but {} x {} = {} were expected!", get_name(), fname,
+			m_mapped_kmatrix->get_length(), rows, cols, int64_t(rows)*cols);
+
+	/* wrap the mapping without copying; the pages are faulted in on
+	 * demand, so matrices larger than RAM work transparently */
+	kmatrix=SGMatrix<float32_t>(m_mapped_kmatrix->get_map(), rows, cols,
+			false);
+	m_free_km=false;
+
+	if (check_symmetry)
+		m_is_symmetric=kmatrix.is_symmetric();
+	else
+		m_is_symmetric=(rows==cols);
+
+	dummy_init(rows, cols);
+	return true;
+}
+
 void CustomKernel::cleanup_custom()
 {
 	SG_TRACE("Entering");
@@ -363,6 +411,7 @@ void CustomKernel::cleanup_custom()
 
 	kmatrix=SGMatrix<float32_t>();
 	upper_diagonal=false;
+	m_mapped_kmatrix=nullptr;
 
 	SG_TRACE("Leaving");
 }
@@ -14,6 +14,7 @@
 #include <shogun/lib/common.h>
 #include <shogun/kernel/Kernel.h>
 #include <shogun/features/Features.h>
+#include <shogun/io/MemoryMappedFile.h>
 
 namespace shogun
 {
@@ -97,6 +98,30 @@ class CustomKernel: public Kernel
 		/** only cleanup stuff specific to Custom kernel */
 		void cleanup_custom();
 
+		/** write the full kernel matrix to a raw binary file (column-major
+		 * float32, no header), suitable for later use with
+		 * map_kernel_matrix_from_binary()
+		 *
+		 * @param fname name of file to write
+		 * @return if writing was successful
+		 */
+		bool save_kernel_matrix_to_binary(const char* fname);
+
+		/** back the kernel matrix by a memory-mapped raw binary file
+		 * (column-major float32, no header) instead of RAM, so matrices
+		 * larger than main memory can be used; pages are faulted in on
+		 * demand by the OS
+		 *
+		 * @param fname name of file to map
+		 * @param rows number of rows of the stored matrix
+		 * @param cols number of columns of the stored matrix
+		 * @param check_symmetry whether the mapped matrix should be checked
+		 * for symmetry (reads the whole file once)
+		 * @return if mapping was successful
+		 */
+		bool map_kernel_matrix_from_binary(const char* fname,
+				index_t rows, index_t cols, bool check_symmetry=false);
+
 		/** return what type of kernel we are
 		 *
 		 * @return kernel type CUSTOM
@@ -614,6 +639,10 @@ class CustomKernel: public Kernel
 
 		/** indicates whether kernel matrix is to be freed in destructor */
 		bool m_free_km;
+
+		/** keeps the file mapping alive when the kernel matrix is backed
+		 * by a memory-mapped file, see map_kernel_matrix_from_binary() */
+		std::shared_ptr<MemoryMappedFile<float32_t>> m_mapped_kmatrix;
 };
 
 }
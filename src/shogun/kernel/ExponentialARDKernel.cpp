@@ -249,6 +249,24 @@ SGMatrix<float64_t> ExponentialARDKernel::compute_right_product(SGVector<float64
 	return right;
 }
 
+std::vector<SGMatrix<float64_t>> ExponentialARDKernel::get_parameter_gradient_batch(
+		Parameters::const_reference param)
+{
+	require(param.first == "log_weights",
+		"Can't compute derivative wrt {} parameter", param.first);
+
+	std::vector<SGMatrix<float64_t>> derivatives;
+	if (m_ARD_type==KT_SCALAR)
+		derivatives.push_back(get_parameter_gradient(param));
+	else
+	{
+		derivatives.reserve(m_log_weights.vlen);
+		for (index_t i=0; i<m_log_weights.vlen; i++)
+			derivatives.push_back(get_parameter_gradient(param, i));
+	}
+	return derivatives;
+}
+
 void ExponentialARDKernel::check_weight_gradient_index(index_t index)
 {
 	require(lhs, "Left features not set!");
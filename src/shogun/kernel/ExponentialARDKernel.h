@@ -11,6 +11,8 @@
 #include <shogun/lib/common.h>
 #include <shogun/kernel/DotKernel.h>
 
+#include <vector>
+
 namespace shogun
 {
 
@@ -190,6 +192,24 @@ public:
 	SGMatrix<float64_t> get_parameter_gradient(Parameters::const_reference param,
 			index_t index=-1) override =0;
 
+	/** return derivatives with respect to all elements of the weight
+	 * parameter in one pass
+	 *
+	 * The per-element get_parameter_gradient() re-derives the intermediates
+	 * shared by all weight derivatives (feature differences, kernel values)
+	 * on every call; subclasses can override this batched variant to compute
+	 * them once per kernel entry and fill all weight derivatives from them.
+	 * The default implementation falls back to one get_parameter_gradient()
+	 * call per element.
+	 *
+	 * @param param the parameter, must be the weight parameter "log_weights"
+	 *
+	 * @return one gradient matrix per element of the weight parameter, in the
+	 * linearized (column-major) element order used by get_parameter_gradient()
+	 */
+	virtual std::vector<SGMatrix<float64_t>> get_parameter_gradient_batch(
+			Parameters::const_reference param);
+
 	/** setter for feature/dimension weight (scalar kernel)
 	 * @param weight positive scalar weight
 	 */
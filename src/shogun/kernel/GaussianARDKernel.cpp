@@ -261,6 +261,47 @@ float64_t GaussianARDKernel::get_parameter_gradient_helper(
 	}
 }
 
+std::vector<SGMatrix<float64_t>> GaussianARDKernel::get_parameter_gradient_batch(
+		Parameters::const_reference param)
+{
+	require(lhs , "Left features not set!");
+	require(rhs, "Right features not set!");
+	require(param.first == "log_weights",
+		"Can't compute derivative wrt {} parameter", param.first);
+
+	const index_t num_params=(m_ARD_type==KT_SCALAR) ? 1 : m_log_weights.vlen;
+
+	std::vector<SGMatrix<float64_t>> derivatives;
+	derivatives.reserve(num_params);
+	for (index_t i=0; i<num_params; i++)
+		derivatives.emplace_back(num_lhs, num_rhs);
+
+	for (index_t j=0; j<num_lhs; j++)
+	{
+		SGVector<float64_t> avec=get_feature_vector(j, lhs);
+		for (index_t k=0; k<num_rhs; k++)
+		{
+			if (m_ARD_type==KT_SCALAR)
+			{
+				float64_t dist=distance(j,k);
+				derivatives[0](j, k) = std::exp(-dist) * (-dist * 2.0);
+			}
+			else
+			{
+				// the difference vector and the kernel value are shared by
+				// all weight derivatives of this entry
+				SGVector<float64_t> bvec=get_feature_vector(k, rhs);
+				bvec=linalg::add(avec, bvec, 1.0, -1.0);
+				float64_t scale=-kernel(j,k)/2.0;
+				for (index_t i=0; i<num_params; i++)
+					derivatives[i](j, k)=compute_gradient_helper(bvec, bvec,
+						scale, i);
+			}
+		}
+	}
+	return derivatives;
+}
+
 SGMatrix<float64_t> GaussianARDKernel::get_parameter_gradient(
 		Parameters::const_reference param, index_t index)
 {
@@ -132,6 +132,21 @@ public:
 	SGMatrix<float64_t> get_parameter_gradient(Parameters::const_reference param,
 			index_t index=-1) override;
 
+	/** return derivatives with respect to all elements of the weight
+	 * parameter in one pass
+	 *
+	 * The difference vector and the kernel value of every entry are shared
+	 * by all weight derivatives and are computed once per entry instead of
+	 * once per element as in get_parameter_gradient()
+	 *
+	 * @param param the parameter, must be the weight parameter "log_weights"
+	 *
+	 * @return one gradient matrix per element of the weight parameter, in the
+	 * linearized (column-major) element order used by get_parameter_gradient()
+	 */
+	std::vector<SGMatrix<float64_t>> get_parameter_gradient_batch(
+			Parameters::const_reference param) override;
+
 	/** return diagonal part of derivative with respect to specified parameter
 	 *
 	 * @param param the parameter
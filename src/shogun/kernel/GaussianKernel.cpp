@@ -7,11 +7,14 @@
  */
 
 #include <shogun/distance/EuclideanDistance.h>
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/features/DotFeatures.h>
 #include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
 #include <shogun/lib/auto_initialiser.h>
 #include <shogun/lib/common.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
 
@@ -64,12 +67,43 @@ void GaussianKernel::cleanup()
 {
 	Kernel::cleanup();
 	m_distance->cleanup();
+	m_lhs_squared_norms=SGVector<float64_t>();
+	m_rhs_squared_norms=SGVector<float64_t>();
 }
 
 bool GaussianKernel::init(std::shared_ptr<Features> l, std::shared_ptr<Features> r)
 {
 	cleanup();
-	return ShiftInvariantKernel::init(l, r);
+	bool result=ShiftInvariantKernel::init(l, r);
+
+	m_lhs_squared_norms=SGVector<float64_t>();
+	m_rhs_squared_norms=SGVector<float64_t>();
+	if (result && has_block_computation())
+		precompute_squared_norms();
+
+	return result;
+}
+
+void GaussianKernel::precompute_squared_norms()
+{
+	auto dot_lhs=std::static_pointer_cast<DotFeatures>(lhs);
+	auto dot_rhs=std::static_pointer_cast<DotFeatures>(rhs);
+
+	m_lhs_squared_norms=SGVector<float64_t>(num_lhs);
+#pragma omp parallel for
+	for (int32_t i=0; i<num_lhs; i++)
+		m_lhs_squared_norms[i]=dot_lhs->dot(i, dot_lhs, i);
+
+	if (lhs_equals_rhs)
+	{
+		m_rhs_squared_norms=m_lhs_squared_norms;
+		return;
+	}
+
+	m_rhs_squared_norms=SGVector<float64_t>(num_rhs);
+#pragma omp parallel for
+	for (int32_t i=0; i<num_rhs; i++)
+		m_rhs_squared_norms[i]=dot_rhs->dot(i, dot_rhs, i);
 }
 
 void GaussianKernel::set_width(float64_t w)
@@ -106,6 +140,146 @@ SGMatrix<float64_t> GaussianKernel::get_parameter_gradient(Parameters::const_ref
 	}
 }
 
+bool GaussianKernel::has_block_computation()
+{
+	if (!lhs || !rhs)
+		return false;
+
+	if (m_precomputed_distance)
+		return false;
+
+	if (lhs->get_feature_class()!=C_DENSE || lhs->get_feature_type()!=F_DREAL ||
+		rhs->get_feature_class()!=C_DENSE || rhs->get_feature_type()!=F_DREAL)
+		return false;
+
+	if (lhs->get_subset_stack()->has_subsets() ||
+		rhs->get_subset_stack()->has_subsets())
+		return false;
+
+	return std::dynamic_pointer_cast<IdentityKernelNormalizer>(normalizer)!=nullptr;
+}
+
+void GaussianKernel::compute_block(
+	int32_t row_start, int32_t num_rows, int32_t col_start, int32_t num_cols,
+	float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Kernel::compute_block(
+			row_start, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	SGMatrix<float64_t> l_feats=
+		std::static_pointer_cast<DenseFeatures<float64_t>>(lhs)
+			->get_feature_matrix();
+	SGMatrix<float64_t> r_feats=
+		std::static_pointer_cast<DenseFeatures<float64_t>>(rhs)
+			->get_feature_matrix();
+
+	typedef Eigen::Map<const Eigen::MatrixXd> MapMat;
+	MapMat l_map(l_feats.matrix, l_feats.num_rows, l_feats.num_cols);
+	MapMat r_map(r_feats.matrix, r_feats.num_rows, r_feats.num_cols);
+
+	auto l_block=l_map.middleCols(row_start, num_rows);
+	auto r_block=r_map.middleCols(col_start, num_cols);
+
+	Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<>> target(
+		block, num_rows, num_cols, Eigen::OuterStride<>(ld));
+
+	// cross terms of the whole tile in one matrix-matrix product
+	target.noalias()=l_block.transpose()*r_block*(-2.0);
+
+	// squared norms are precomputed once in init(); fall back to a local
+	// computation in case the fast path became available only afterwards
+	Eigen::VectorXd l_norms, r_norms;
+	bool cached=m_lhs_squared_norms.vlen==num_lhs &&
+		m_rhs_squared_norms.vlen==num_rhs;
+	if (!cached)
+	{
+		l_norms=l_block.colwise().squaredNorm();
+		r_norms=r_block.colwise().squaredNorm();
+	}
+
+	const float64_t width=get_width();
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		float64_t r_norm=cached ?
+			m_rhs_squared_norms[col_start+j] : r_norms[j];
+		for (int32_t i=0; i<num_rows; i++)
+		{
+			float64_t l_norm=cached ?
+				m_lhs_squared_norms[row_start+i] : l_norms[i];
+			float64_t dist=l_norm+r_norm+block[i+int64_t(j)*ld];
+			block[i+int64_t(j)*ld]=std::exp(-CMath::max(0.0, dist)/width);
+		}
+	}
+}
+
+void GaussianKernel::compute_rows(
+	const int32_t* rows, int32_t num_rows, int32_t col_start, int32_t num_cols,
+	float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Kernel::compute_rows(
+			rows, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	SGMatrix<float64_t> l_feats=
+		std::static_pointer_cast<DenseFeatures<float64_t>>(lhs)
+			->get_feature_matrix();
+	SGMatrix<float64_t> r_feats=
+		std::static_pointer_cast<DenseFeatures<float64_t>>(rhs)
+			->get_feature_matrix();
+
+	// gather the requested lhs vectors so the cross terms of the whole
+	// batch reduce to one matrix-matrix product
+	Eigen::MatrixXd gathered(l_feats.num_rows, num_rows);
+	for (int32_t i=0; i<num_rows; i++)
+	{
+		sg_memcpy(gathered.col(i).data(),
+			l_feats.get_column_vector(rows[i]),
+			l_feats.num_rows*sizeof(float64_t));
+	}
+
+	Eigen::Map<const Eigen::MatrixXd> r_map(
+		r_feats.matrix, r_feats.num_rows, r_feats.num_cols);
+	auto r_block=r_map.middleCols(col_start, num_cols);
+
+	Eigen::Map<Eigen::MatrixXd, 0, Eigen::OuterStride<>> target(
+		block, num_rows, num_cols, Eigen::OuterStride<>(ld));
+	target.noalias()=gathered.transpose()*r_block*(-2.0);
+
+	Eigen::VectorXd l_norms, r_norms;
+	bool cached=m_lhs_squared_norms.vlen==l_feats.num_cols &&
+		m_rhs_squared_norms.vlen==r_feats.num_cols;
+	if (cached)
+	{
+		l_norms.resize(num_rows);
+		for (int32_t i=0; i<num_rows; i++)
+			l_norms[i]=m_lhs_squared_norms[rows[i]];
+	}
+	else
+	{
+		l_norms=gathered.colwise().squaredNorm();
+		r_norms=r_block.colwise().squaredNorm();
+	}
+
+	const float64_t width=get_width();
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		float64_t r_norm=cached ?
+			m_rhs_squared_norms[col_start+j] : r_norms[j];
+		for (int32_t i=0; i<num_rows; i++)
+		{
+			float64_t dist=l_norms[i]+r_norm+block[i+int64_t(j)*ld];
+			block[i+int64_t(j)*ld]=std::exp(-CMath::max(0.0, dist)/width);
+		}
+	}
+}
+
 float64_t GaussianKernel::compute(int32_t idx_a, int32_t idx_b)
 {
     float64_t result=distance(idx_a, idx_b);
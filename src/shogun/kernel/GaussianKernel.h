@@ -112,6 +112,44 @@ public:
 	 */
 	const char* get_name() const override { return "GaussianKernel"; }
 
+	/** whether the blocked evaluation path is available, i.e. both sides
+	 * are dense real features without subsets and the normalizer is the
+	 * identity
+	 *
+	 * @return whether compute_block() uses the fast matrix-product path
+	 */
+	bool has_block_computation() override;
+
+	/** compute a tile of the kernel matrix at once via
+	 * \f$||x-y||^2 = ||x||^2 + ||y||^2 - 2 x^\top y\f$, where the cross
+	 * terms of the whole tile are a single matrix-matrix product
+	 *
+	 * @param row_start first row (lhs index) of the block
+	 * @param num_rows number of rows of the block
+	 * @param col_start first column (rhs index) of the block
+	 * @param num_cols number of columns of the block
+	 * @param block column-major target buffer
+	 * @param ld leading dimension of the target buffer
+	 */
+	void compute_block(
+		int32_t row_start, int32_t num_rows, int32_t col_start,
+		int32_t num_cols, float64_t* block, int32_t ld) override;
+
+	/** compute a batch of arbitrary kernel matrix rows against a
+	 * contiguous column range, gathering the requested lhs vectors so
+	 * the cross terms reduce to a single matrix-matrix product
+	 *
+	 * @param rows lhs indices of the rows to compute
+	 * @param num_rows number of entries in rows
+	 * @param col_start first column (rhs index) of the block
+	 * @param num_cols number of columns of the block
+	 * @param block column-major target buffer
+	 * @param ld leading dimension of the target buffer
+	 */
+	void compute_rows(
+		const int32_t* rows, int32_t num_rows, int32_t col_start,
+		int32_t num_cols, float64_t* block, int32_t ld) override;
+
 	/** set the kernel's width
 	 *
 	 * @param w kernel width
@@ -171,9 +209,21 @@ protected:
 	 */
 	float64_t distance(int32_t idx_a, int32_t idx_b) const override;
 
+protected:
+	/** precompute the squared norms of all lhs/rhs vectors used by the
+	 * blocked evaluation paths, so tiles do not recompute them */
+	void precompute_squared_norms();
+
 protected:
 	/** width */
 	AutoValue<float64_t> m_width = AutoValueEmpty{};
+
+	/** cached squared norms of the lhs vectors, valid while the blocked
+	 * evaluation path is available */
+	SGVector<float64_t> m_lhs_squared_norms;
+
+	/** cached squared norms of the rhs vectors */
+	SGVector<float64_t> m_rhs_squared_norms;
 };
 
 }
@@ -19,6 +19,8 @@
 #include <shogun/base/Parallel.h>
 
 #include <shogun/kernel/Kernel.h>
+#include <shogun/kernel/NystromApproximation.h>
+#include <shogun/kernel/ShardedKernelRowCache.h>
 #include <shogun/kernel/normalizer/KernelNormalizer.h>
 #include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
 #include <shogun/features/Features.h>
@@ -137,10 +139,40 @@ bool Kernel::init(std::shared_ptr<Features> l, std::shared_ptr<Features> r)
 	num_lhs=l->get_num_vectors();
 	num_rhs=r->get_num_vectors();
 
+	if (m_row_cache)
+		m_row_cache->invalidate();
+
 	SG_TRACE("leaving Kernel::init({}, {})", fmt::ptr(l.get()), fmt::ptr(r.get()));
 	return true;
 }
 
+void Kernel::enable_concurrent_row_cache(int32_t num_shards)
+{
+	int64_t max_bytes=int64_t(cache_size)*1024*1024;
+	m_row_cache=std::make_shared<ShardedKernelRowCache>(
+		this, max_bytes, num_shards,
+		m_precision==KERNEL_PRECISION_SINGLE);
+}
+
+void Kernel::disable_concurrent_row_cache()
+{
+	m_row_cache=nullptr;
+}
+
+SGVector<KERNELCACHE_ELEM> Kernel::get_row_concurrent(int32_t row)
+{
+	require(m_row_cache, "Concurrent row cache is not enabled, "
+		"call enable_concurrent_row_cache() first.");
+	return m_row_cache->get_row(row);
+}
+
+std::shared_ptr<NystromApproximation> Kernel::get_nystrom_approximation(
+	int32_t num_landmarks)
+{
+	return std::make_shared<NystromApproximation>(
+		std::static_pointer_cast<Kernel>(shared_from_this()), num_landmarks);
+}
+
 bool Kernel::set_normalizer(std::shared_ptr<KernelNormalizer> n)
 {
 	if (lhs && rhs)
@@ -366,9 +398,10 @@ void* Kernel::cache_multiple_kernel_row_helper(void* p)
 // Fills cache for the rows in key
 void Kernel::cache_multiple_kernel_rows(int32_t* rows, int32_t num_rows)
 {
-	int32_t nthreads=env()->get_num_threads();
+	ThreadBudget budget(env());
+	int32_t nthreads=budget.get_num_threads();
 
-	if (nthreads<2)
+	if (nthreads<2 && !has_block_computation())
 	{
 		for(int32_t i=0;i<num_rows;i++)
 			cache_kernel_row(rows[i]);
@@ -408,6 +441,41 @@ void Kernel::cache_multiple_kernel_rows(int32_t* rows, int32_t num_rows)
 			num++;
 		}
 
+		if (num>0 && has_block_computation())
+		{
+			// batched working-set evaluation: each row is one blockwise
+			// kernel evaluation (a single matrix-vector product for dot
+			// kernels) instead of one virtual call per entry; the rows are
+			// independent and are filled in parallel
+			#pragma omp parallel num_threads(nthreads)
+			{
+				SGVector<float64_t> row(num_vec);
+
+				#pragma omp for schedule(dynamic)
+				for (int32_t i=0; i<num; i++)
+				{
+					int32_t m=uncached_rows[i];
+					compute_block(m, 1, 0, num_vec, row.vector, 1);
+
+					KERNELCACHE_ELEM* target=cache[i];
+					for (int32_t j=0; j<kernel_cache.activenum; j++)
+					{
+						int32_t k=kernel_cache.active2totdoc[j];
+						if (k>=num_vec)
+							k=2*num_vec-1-k;
+						target[j]=row[k];
+					}
+
+					needs_computation[m]=0;
+				}
+			}
+
+			SG_FREE(needs_computation);
+			SG_FREE(cache);
+			SG_FREE(uncached_rows);
+			return;
+		}
+
 		if (num>0)
 		{
 			step = num/nthreads;
@@ -418,7 +486,7 @@ void Kernel::cache_multiple_kernel_rows(int32_t* rows, int32_t num_rows)
 				step=1;
 			}
 
-			#pragma omp parallel for private(params)
+			#pragma omp parallel for private(params) num_threads(nthreads)
 			for (int32_t t=0; t<num_threads; t++)
 			{
 				params.kernel = this;
@@ -945,6 +1013,11 @@ void Kernel::register_params()
 	    (machine_int_t*)&opt_type, "opt_type", "Optimization type.",
 	    ParameterProperties::NONE,
 	    SG_OPTIONS(FASTBUTMEMHUNGRY, SLOWBUTMEMEFFICIENT));
+	SG_ADD_OPTIONS(
+	    (machine_int_t*)&m_precision, "precision",
+	    "Numerical precision for computation and caching.",
+	    ParameterProperties::NONE,
+	    SG_OPTIONS(KERNEL_PRECISION_DOUBLE, KERNEL_PRECISION_SINGLE));
 }
 
 
@@ -962,6 +1035,7 @@ void Kernel::init()
 	opt_type=FASTBUTMEMHUNGRY;
 	properties=KP_NONE;
 	normalizer=NULL;
+	m_precision=KERNEL_PRECISION_DOUBLE;
 
 #ifdef USE_SVMLIGHT
 	memset(&kernel_cache, 0x0, sizeof(KERNEL_CACHE));
@@ -1261,6 +1335,28 @@ SGVector<float64_t> Kernel::row_col_wise_sum_block(index_t block_begin_row,
 	return sum;
 }
 
+void Kernel::compute_block(
+	int32_t row_start, int32_t num_rows, int32_t col_start, int32_t num_cols,
+	float64_t* block, int32_t ld)
+{
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		for (int32_t i=0; i<num_rows; i++)
+			block[i+int64_t(j)*ld]=kernel(row_start+i, col_start+j);
+	}
+}
+
+void Kernel::compute_rows(
+	const int32_t* rows, int32_t num_rows, int32_t col_start,
+	int32_t num_cols, float64_t* block, int32_t ld)
+{
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		for (int32_t i=0; i<num_rows; i++)
+			block[i+int64_t(j)*ld]=kernel(rows[i], col_start+j);
+	}
+}
+
 template <class T> void* Kernel::get_kernel_matrix_helper(void* p)
 {
 	K_THREAD_PARAM<T>* params= (K_THREAD_PARAM<T>*) p;
@@ -1330,12 +1426,66 @@ SGMatrix<T> Kernel::get_kernel_matrix()
 
 	result=SG_MALLOC(T, total_num);
 
-	int32_t num_threads=env()->get_num_threads();
+	// claim threads from the global budget so that full matrix
+	// evaluations nested inside other parallel regions (e.g.
+	// cross-validation folds) do not oversubscribe the machine
+	ThreadBudget budget(env());
+
+	if (has_block_computation())
+	{
+		// tiled evaluation: let the kernel fill whole cache-sized blocks
+		// at once instead of one virtual compute() call per element
+		const int32_t block_size=256;
+		int32_t num_row_blocks=(m+block_size-1)/block_size;
+		int32_t num_col_blocks=(n+block_size-1)/block_size;
+		int64_t num_blocks=int64_t(num_row_blocks)*num_col_blocks;
+
+		#pragma omp parallel num_threads(budget.get_num_threads())
+		{
+			SGVector<float64_t> buffer(block_size*block_size);
+
+			#pragma omp for schedule(dynamic)
+			for (int64_t b=0; b<num_blocks; b++)
+			{
+				int32_t bi=b%num_row_blocks;
+				int32_t bj=b/num_row_blocks;
+
+				// for symmetric matrices only the upper block triangle is
+				// computed, the lower one is mirrored below
+				if (symmetric && bj<bi)
+					continue;
+
+				int32_t row_start=bi*block_size;
+				int32_t col_start=bj*block_size;
+				int32_t rows=CMath::min(block_size, m-row_start);
+				int32_t cols=CMath::min(block_size, n-col_start);
+
+				compute_block(
+					row_start, rows, col_start, cols, buffer.vector, rows);
+
+				for (int32_t j=0; j<cols; j++)
+				{
+					for (int32_t i=0; i<rows; i++)
+					{
+						T v=static_cast<T>(buffer[i+int64_t(j)*rows]);
+						result[(row_start+i)+int64_t(col_start+j)*m]=v;
+
+						if (symmetric && bi!=bj)
+							result[(col_start+j)+int64_t(row_start+i)*m]=v;
+					}
+				}
+			}
+		}
+
+		return SGMatrix<T>(result,m,n,true);
+	}
+
+	int32_t num_threads=budget.get_num_threads();
 	K_THREAD_PARAM<T> params;
 	int64_t step = total_num/num_threads;
 	index_t t = 0;
 	auto pb = SG_PROGRESS(range(total_num));
-#pragma omp parallel for lastprivate(t) private(params)
+#pragma omp parallel for lastprivate(t) private(params) num_threads(num_threads)
 	for (t = 0; t < num_threads; ++t)
 	{
 		params.kernel = this;
@@ -27,6 +27,8 @@ namespace shogun
 	class File;
 	class Features;
 	class KernelNormalizer;
+	class NystromApproximation;
+	class ShardedKernelRowCache;
 
 #ifdef USE_SHORTREAL_KERNELCACHE
 	/** kernel cache element */
@@ -47,6 +49,15 @@ enum EOptimizationType
 	SLOWBUTMEMEFFICIENT
 };
 
+/** numerical precision used for kernel computation and caching. Solvers
+ * that tolerate float32 kernel values can halve the cache footprint and
+ * memory bandwidth; accumulation stays in float64 where needed. */
+enum EKernelPrecision
+{
+	KERNEL_PRECISION_DOUBLE,
+	KERNEL_PRECISION_SINGLE
+};
+
 /** kernel type */
 enum EKernelType
 {
@@ -208,6 +219,64 @@ class Kernel : public SGObject
 			return get_kernel_matrix<float64_t>();
 		}
 
+		/** whether this kernel provides a blocked evaluation path via
+		 * compute_block(). Kernels that can evaluate a whole tile of the
+		 * kernel matrix at once (e.g. via matrix-matrix products on dense
+		 * features) should override this together with compute_block(), so
+		 * that get_kernel_matrix() uses cache-blocked tiles instead of one
+		 * virtual compute() call per element.
+		 *
+		 * @return whether compute_block() is faster than elementwise
+		 * evaluation
+		 */
+		virtual bool has_block_computation() { return false; }
+
+		/** compute a rectangular block of the kernel matrix in one call
+		 *
+		 * The default implementation evaluates the block elementwise via
+		 * kernel(), so overriding has_block_computation() alone is
+		 * sufficient for correctness but not for speed.
+		 *
+		 * @param row_start first row (lhs index) of the block
+		 * @param num_rows number of rows of the block
+		 * @param col_start first column (rhs index) of the block
+		 * @param num_cols number of columns of the block
+		 * @param block column-major target buffer
+		 * @param ld leading dimension (column stride) of the target buffer
+		 */
+		virtual void compute_block(
+			int32_t row_start, int32_t num_rows, int32_t col_start,
+			int32_t num_cols, float64_t* block, int32_t ld);
+
+		/** compute a batch of (not necessarily contiguous) kernel matrix
+		 * rows against a contiguous column range in one call. Used by
+		 * KernelMachine::apply() to score whole blocks of test examples
+		 * against the support vectors at once.
+		 *
+		 * The default implementation evaluates elementwise via kernel();
+		 * kernels with has_block_computation() provide faster versions.
+		 *
+		 * @param rows lhs indices of the rows to compute
+		 * @param num_rows number of entries in rows
+		 * @param col_start first column (rhs index) of the block
+		 * @param num_cols number of columns of the block
+		 * @param block column-major target buffer
+		 * @param ld leading dimension (column stride) of the target buffer
+		 */
+		virtual void compute_rows(
+			const int32_t* rows, int32_t num_rows, int32_t col_start,
+			int32_t num_cols, float64_t* block, int32_t ld);
+
+		/** create a Nystrom low-rank approximation of this kernel's matrix,
+		 * for problems where get_kernel_matrix() cannot be materialized.
+		 * Requires the kernel to be initialized symmetrically (lhs==rhs).
+		 *
+		 * @param num_landmarks number of landmark points to sample
+		 * @return approximation object exposing a factor L with K ~= LL^T
+		 */
+		std::shared_ptr<NystromApproximation> get_nystrom_approximation(
+			int32_t num_landmarks);
+
 		/** @return Vector with diagonal elements of the kernel matrix.
 		 * Note that left- and right-handside features must be set and of equal
 		 * size
@@ -584,6 +653,51 @@ class Kernel : public SGObject
 		 */
 		inline int32_t get_cache_size() { return cache_size; }
 
+		/** set the numerical precision used for kernel computation and
+		 * caching. With KERNEL_PRECISION_SINGLE, the concurrent row cache
+		 * stores float32 rows (halving its footprint and doubling the
+		 * effective hit rate for a given budget) and consumers assembling
+		 * full matrices should request get_kernel_matrix<float32_t>().
+		 * Accumulation (e.g. scoring against support vectors) stays in
+		 * float64.
+		 *
+		 * @param precision precision policy
+		 */
+		inline void set_precision(EKernelPrecision precision)
+		{
+			m_precision=precision;
+		}
+
+		/** @return the numerical precision policy of this kernel */
+		inline EKernelPrecision get_precision() const { return m_precision; }
+
+		/** enable the thread-safe sharded row cache. Unlike the legacy
+		 * KERNEL_CACHE below, multiple training threads and multiple
+		 * machines sharing this kernel may look up rows concurrently.
+		 *
+		 * @param num_shards number of independent cache shards, 0 chooses
+		 * automatically based on the number of threads
+		 */
+		void enable_concurrent_row_cache(int32_t num_shards=0);
+
+		/** free the concurrent row cache and all rows it holds */
+		void disable_concurrent_row_cache();
+
+		/** @return whether the concurrent row cache is enabled */
+		inline bool has_concurrent_row_cache() const
+		{
+			return m_row_cache!=nullptr;
+		}
+
+		/** get a full kernel row through the concurrent row cache, which
+		 * computes and caches it on a miss. Requires
+		 * enable_concurrent_row_cache() to have been called. Thread-safe.
+		 *
+		 * @param row row index on lhs
+		 * @return vector of length get_num_vec_rhs() holding the row
+		 */
+		SGVector<KERNELCACHE_ELEM> get_row_concurrent(int32_t row);
+
 #ifdef USE_SVMLIGHT
 		/** cache reset */
 		inline void cache_reset() { resize_kernel_cache(cache_size); }
@@ -1078,6 +1192,13 @@ class Kernel : public SGObject
 		/** normalize the kernel(i,j) function based on this normalization
 		 * function */
 		std::shared_ptr<KernelNormalizer> normalizer;
+
+		/** optional thread-safe sharded row cache, see
+		 * enable_concurrent_row_cache() */
+		std::shared_ptr<ShardedKernelRowCache> m_row_cache;
+
+		/** numerical precision used for computation and caching */
+		EKernelPrecision m_precision;
 };
 
 }
@@ -0,0 +1,164 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/kernel/Kernel.h>
+#include <shogun/kernel/NystromApproximation.h>
+#include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/eigen3.h>
+
+#include <numeric>
+
+using namespace shogun;
+
+NystromApproximation::NystromApproximation()
+    : RandomMixin<SGObject>(), m_kernel(nullptr), m_num_landmarks(0),
+      m_tolerance(1e-10)
+{
+	register_params();
+}
+
+NystromApproximation::NystromApproximation(
+    std::shared_ptr<Kernel> kernel, int32_t num_landmarks)
+    : NystromApproximation()
+{
+	require(kernel, "No kernel given.");
+	require(
+	    num_landmarks > 0, "Number of landmarks ({}) must be positive.",
+	    num_landmarks);
+
+	m_kernel = std::move(kernel);
+	m_num_landmarks = num_landmarks;
+}
+
+NystromApproximation::~NystromApproximation()
+{
+}
+
+void NystromApproximation::register_params()
+{
+	SG_ADD(
+	    (std::shared_ptr<SGObject>*)&m_kernel, "kernel",
+	    "Kernel to approximate.");
+	SG_ADD(
+	    &m_num_landmarks, "num_landmarks", "Number of landmark points.",
+	    ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_tolerance, "tolerance",
+	    "Eigenvalue truncation threshold of the pseudo-inverse.");
+}
+
+void NystromApproximation::fit()
+{
+	require(m_kernel, "No kernel set.");
+	require(m_kernel->has_features(), "Kernel has no features assigned.");
+
+	int32_t n = m_kernel->get_num_vec_lhs();
+	require(
+	    n == m_kernel->get_num_vec_rhs(),
+	    "Kernel matrix must be symmetric ({} x {} given).", n,
+	    m_kernel->get_num_vec_rhs());
+
+	int32_t m = CMath::min(m_num_landmarks, n);
+
+	/* uniform landmark sample without replacement */
+	SGVector<index_t> permutation(n);
+	std::iota(permutation.begin(), permutation.end(), 0);
+	random::shuffle(permutation, m_prng);
+	m_landmarks = SGVector<index_t>(m);
+	sg_memcpy(m_landmarks.vector, permutation.vector, m * sizeof(index_t));
+	CMath::qsort(m_landmarks.vector, m);
+
+	/* kernel between all points and the landmarks, and among landmarks */
+	SGMatrix<float64_t> k_nm(n, m);
+#pragma omp parallel for
+	for (int32_t j = 0; j < m; j++)
+	{
+		index_t landmark = m_landmarks[j];
+		for (int32_t i = 0; i < n; i++)
+			k_nm(i, j) = m_kernel->kernel(i, landmark);
+	}
+
+	SGMatrix<float64_t> k_mm(m, m);
+	for (int32_t j = 0; j < m; j++)
+	{
+		for (int32_t i = 0; i < m; i++)
+			k_mm(i, j) = k_nm(m_landmarks[i], j);
+	}
+
+	/* pseudo-inverse square root of K_mm via eigendecomposition */
+	Eigen::Map<Eigen::MatrixXd> k_mm_map(k_mm.matrix, m, m);
+	Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(k_mm_map);
+	const Eigen::VectorXd& eigenvalues = solver.eigenvalues();
+
+	float64_t threshold =
+	    m_tolerance * CMath::max(1.0, eigenvalues.cwiseAbs().maxCoeff());
+	int32_t rank = 0;
+	for (int32_t i = 0; i < m; i++)
+	{
+		if (eigenvalues[i] > threshold)
+			rank++;
+	}
+	require(
+	    rank > 0, "Landmark kernel matrix is numerically zero, "
+	              "cannot factorize.");
+
+	/* largest eigenvalues are at the back for SelfAdjointEigenSolver */
+	Eigen::MatrixXd isqrt(m, rank);
+	for (int32_t r = 0; r < rank; r++)
+	{
+		int32_t src = m - rank + r;
+		isqrt.col(r) =
+		    solver.eigenvectors().col(src) / std::sqrt(eigenvalues[src]);
+	}
+
+	m_factor = SGMatrix<float64_t>(n, rank);
+	Eigen::Map<Eigen::MatrixXd> factor_map(m_factor.matrix, n, rank);
+	Eigen::Map<Eigen::MatrixXd> k_nm_map(k_nm.matrix, n, m);
+	factor_map.noalias() = k_nm_map * isqrt;
+}
+
+SGMatrix<float64_t> NystromApproximation::get_factor()
+{
+	if (!m_factor.matrix)
+		fit();
+	return m_factor;
+}
+
+SGVector<index_t> NystromApproximation::get_landmark_indices()
+{
+	if (!m_factor.matrix)
+		fit();
+	return m_landmarks;
+}
+
+int32_t NystromApproximation::get_rank() const
+{
+	return m_factor.num_cols;
+}
+
+SGVector<float64_t> NystromApproximation::apply(SGVector<float64_t> vec)
+{
+	if (!m_factor.matrix)
+		fit();
+
+	require(
+	    vec.vlen == m_factor.num_rows,
+	    "Vector length ({}) must match the number of vectors ({}).", vec.vlen,
+	    m_factor.num_rows);
+
+	SGVector<float64_t> result(m_factor.num_rows);
+	Eigen::Map<Eigen::MatrixXd> factor_map(
+	    m_factor.matrix, m_factor.num_rows, m_factor.num_cols);
+	Eigen::Map<Eigen::VectorXd> vec_map(vec.vector, vec.vlen);
+	Eigen::Map<Eigen::VectorXd> result_map(result.vector, result.vlen);
+
+	result_map.noalias() = factor_map * (factor_map.transpose() * vec_map);
+	return result;
+}
+
+void NystromApproximation::set_tolerance(float64_t tolerance)
+{
+	require(tolerance > 0, "Tolerance ({}) must be positive.", tolerance);
+	m_tolerance = tolerance;
+}
@@ -0,0 +1,112 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef NYSTROMAPPROXIMATION_H
+#define NYSTROMAPPROXIMATION_H
+
+#include <shogun/lib/config.h>
+
+#include <shogun/base/SGObject.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/RandomMixin.h>
+
+namespace shogun
+{
+	class Kernel;
+
+	/** @brief Nystrom low-rank approximation of a kernel matrix.
+	 *
+	 * For kernel matrices that cannot be materialized (n in the hundreds of
+	 * thousands), the Nystrom method samples \f$m \ll n\f$ landmark points
+	 * and approximates
+	 *
+	 * \f[
+	 * K \approx K_{nm} K_{mm}^{+} K_{nm}^\top = LL^\top
+	 * \f]
+	 *
+	 * where \f$K_{nm}\f$ holds the kernel between all points and the
+	 * landmarks, \f$K_{mm}\f$ the kernel among the landmarks and
+	 * \f$L = K_{nm} K_{mm}^{-1/2}\f$ via the pseudo-inverse square root.
+	 * Only \f$O(nm)\f$ memory and \f$O(nm^2)\f$ time are needed instead of
+	 * \f$O(n^2)\f$.
+	 *
+	 * The factor \f$L\f$ is exposed so that kernel machines, KernelPCA and
+	 * GP inference can work with the implicit factorization, e.g. compute
+	 * \f$Kv \approx L(L^\top v)\f$ without ever forming \f$K\f$.
+	 *
+	 * Instances are typically obtained via
+	 * Kernel::get_nystrom_approximation().
+	 */
+	class NystromApproximation : public RandomMixin<SGObject>
+	{
+	public:
+		/** default constructor */
+		NystromApproximation();
+
+		/** constructor
+		 *
+		 * @param kernel symmetrically initialized kernel to approximate
+		 * @param num_landmarks number of landmark points \f$m\f$
+		 */
+		NystromApproximation(
+		    std::shared_ptr<Kernel> kernel, int32_t num_landmarks);
+
+		~NystromApproximation() override;
+
+		/** sample the landmarks and compute the factor \f$L\f$ */
+		void fit();
+
+		/** @return factor \f$L\f$ of size n x rank with
+		 * \f$K \approx LL^\top\f$ */
+		SGMatrix<float64_t> get_factor();
+
+		/** @return indices of the sampled landmark points */
+		SGVector<index_t> get_landmark_indices();
+
+		/** multiply the approximate kernel matrix with a vector without
+		 * forming it, i.e. compute \f$L(L^\top v)\f$
+		 *
+		 * @param vec vector of length n
+		 * @return product of length n
+		 */
+		SGVector<float64_t> apply(SGVector<float64_t> vec);
+
+		/** @return effective rank of the factorization, at most
+		 * the number of landmarks */
+		int32_t get_rank() const;
+
+		/** set the eigenvalue threshold below which directions of
+		 * \f$K_{mm}\f$ are truncated from the pseudo-inverse
+		 *
+		 * @param tolerance truncation threshold
+		 */
+		void set_tolerance(float64_t tolerance);
+
+		const char* get_name() const override
+		{
+			return "NystromApproximation";
+		}
+
+	private:
+		void register_params();
+
+	private:
+		/** kernel to approximate */
+		std::shared_ptr<Kernel> m_kernel;
+
+		/** number of landmarks to sample */
+		int32_t m_num_landmarks;
+
+		/** eigenvalue truncation threshold for the pseudo-inverse */
+		float64_t m_tolerance;
+
+		/** sampled landmark indices */
+		SGVector<index_t> m_landmarks;
+
+		/** factor L with K ~= L L^T */
+		SGMatrix<float64_t> m_factor;
+	};
+}
+#endif // NYSTROMAPPROXIMATION_H
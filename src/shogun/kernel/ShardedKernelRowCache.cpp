@@ -0,0 +1,164 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/base/Parallel.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/kernel/Kernel.h>
+#include <shogun/kernel/ShardedKernelRowCache.h>
+
+using namespace shogun;
+
+ShardedKernelRowCache::ShardedKernelRowCache()
+    : SGObject(), m_kernel(nullptr), m_single_precision(false),
+      m_bytes_per_shard(0), m_epoch(0), m_num_hits(0), m_num_misses(0)
+{
+}
+
+ShardedKernelRowCache::ShardedKernelRowCache(
+    Kernel* kernel, int64_t max_bytes, int32_t num_shards,
+    bool single_precision)
+    : SGObject(), m_kernel(kernel), m_single_precision(single_precision),
+      m_epoch(0), m_num_hits(0), m_num_misses(0)
+{
+	require(kernel, "No kernel given.");
+	require(max_bytes > 0, "Cache size must be positive, got {}.", max_bytes);
+
+	if (num_shards <= 0)
+		num_shards = 4 * env()->get_num_threads();
+
+	m_bytes_per_shard = std::max<int64_t>(1, max_bytes / num_shards);
+	m_shards.reserve(num_shards);
+	for (int32_t i = 0; i < num_shards; i++)
+		m_shards.emplace_back(std::make_unique<Shard>());
+}
+
+ShardedKernelRowCache::~ShardedKernelRowCache()
+{
+}
+
+ShardedKernelRowCache::Shard& ShardedKernelRowCache::shard_of(int32_t row)
+{
+	return *m_shards[static_cast<size_t>(row) % m_shards.size()];
+}
+
+SGVector<KERNELCACHE_ELEM>
+ShardedKernelRowCache::compute_row(int32_t row) const
+{
+	int32_t num_rhs = m_kernel->get_num_vec_rhs();
+	SGVector<KERNELCACHE_ELEM> result(num_rhs);
+	for (int32_t j = 0; j < num_rhs; j++)
+		result[j] = static_cast<KERNELCACHE_ELEM>(m_kernel->kernel(row, j));
+	return result;
+}
+
+void ShardedKernelRowCache::evict_lru(Shard& shard)
+{
+	while (shard.bytes > m_bytes_per_shard && shard.rows.size() > 1)
+	{
+		auto victim = shard.rows.begin();
+		for (auto it = shard.rows.begin(); it != shard.rows.end(); ++it)
+		{
+			if (it->second.last_used < victim->second.last_used)
+				victim = it;
+		}
+		if (victim->second.elems32.vlen)
+			shard.bytes -= victim->second.elems32.vlen * sizeof(float32_t);
+		else
+			shard.bytes -=
+			    victim->second.elems.vlen * sizeof(KERNELCACHE_ELEM);
+		shard.rows.erase(victim);
+	}
+}
+
+SGVector<KERNELCACHE_ELEM> ShardedKernelRowCache::get_row(int32_t row)
+{
+	require(m_kernel, "No kernel set.");
+	require(
+	    row >= 0 && row < m_kernel->get_num_vec_lhs(),
+	    "Row index {} out of bounds [0, {}).", row,
+	    m_kernel->get_num_vec_lhs());
+
+	uint64_t now = m_epoch.fetch_add(1, std::memory_order_relaxed);
+	Shard& shard = shard_of(row);
+
+	{
+		std::lock_guard<std::mutex> guard(shard.lock);
+		auto it = shard.rows.find(row);
+		if (it != shard.rows.end())
+		{
+			it->second.last_used = now;
+			m_num_hits.fetch_add(1, std::memory_order_relaxed);
+			return widen_row(it->second);
+		}
+	}
+
+	/* compute outside the lock so concurrent misses in the same shard do
+	 * not serialize on the (potentially expensive) kernel evaluation */
+	SGVector<KERNELCACHE_ELEM> computed = compute_row(row);
+	m_num_misses.fetch_add(1, std::memory_order_relaxed);
+
+	CachedRow entry;
+	entry.last_used = now;
+	if (m_single_precision)
+	{
+		/* round-trip through float32 so hits and misses return
+		 * identical values */
+		entry.elems32 = SGVector<float32_t>(computed.vlen);
+		for (index_t i = 0; i < computed.vlen; i++)
+			entry.elems32[i] = static_cast<float32_t>(computed[i]);
+	}
+	else
+		entry.elems = computed;
+
+	std::lock_guard<std::mutex> guard(shard.lock);
+	auto it = shard.rows.find(row);
+	if (it != shard.rows.end())
+	{
+		/* another thread raced us, keep its copy */
+		it->second.last_used = now;
+		return widen_row(it->second);
+	}
+
+	if (m_single_precision)
+		shard.bytes += entry.elems32.vlen * sizeof(float32_t);
+	else
+		shard.bytes += entry.elems.vlen * sizeof(KERNELCACHE_ELEM);
+
+	SGVector<KERNELCACHE_ELEM> result = widen_row(entry);
+	shard.rows[row] = std::move(entry);
+	evict_lru(shard);
+	return result;
+}
+
+SGVector<KERNELCACHE_ELEM>
+ShardedKernelRowCache::widen_row(const CachedRow& entry) const
+{
+	if (!m_single_precision)
+		return entry.elems;
+
+	SGVector<KERNELCACHE_ELEM> widened(entry.elems32.vlen);
+	for (index_t i = 0; i < entry.elems32.vlen; i++)
+		widened[i] = static_cast<KERNELCACHE_ELEM>(entry.elems32[i]);
+	return widened;
+}
+
+void ShardedKernelRowCache::invalidate()
+{
+	for (auto& shard : m_shards)
+	{
+		std::lock_guard<std::mutex> guard(shard->lock);
+		shard->rows.clear();
+		shard->bytes = 0;
+	}
+}
+
+int64_t ShardedKernelRowCache::get_num_hits() const
+{
+	return m_num_hits.load(std::memory_order_relaxed);
+}
+
+int64_t ShardedKernelRowCache::get_num_misses() const
+{
+	return m_num_misses.load(std::memory_order_relaxed);
+}
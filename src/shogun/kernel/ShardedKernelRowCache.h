@@ -0,0 +1,140 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef SHARDEDKERNELROWCACHE_H
+#define SHARDEDKERNELROWCACHE_H
+
+#include <shogun/lib/config.h>
+
+#include <shogun/base/SGObject.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/common.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace shogun
+{
+	class Kernel;
+
+	/** @brief Thread-safe sharded cache of kernel matrix rows.
+	 *
+	 * The legacy KERNEL_CACHE in Kernel is single-threaded and therefore
+	 * serializes every cached row lookup when multiple training threads (or
+	 * multiple machines sharing one Kernel instance) request rows
+	 * concurrently. This cache distributes rows over a set of independent
+	 * shards, each guarded by its own mutex, so lookups of rows that map to
+	 * different shards never contend.
+	 *
+	 * Eviction is least-recently-used, driven by a global atomic epoch
+	 * counter that is bumped on every lookup: each cached row stores the
+	 * epoch of its last access and the oldest row of a shard is dropped once
+	 * the shard exceeds its share of the memory budget. On a miss the row is
+	 * computed outside any lock, so concurrent misses on the same row may
+	 * compute it twice; only one copy is kept.
+	 *
+	 * Rows are handed out as reference counted SGVector copies of the cache
+	 * entries, so a returned row stays valid even if it is evicted
+	 * concurrently.
+	 */
+	class ShardedKernelRowCache : public SGObject
+	{
+	public:
+		/** default constructor */
+		ShardedKernelRowCache();
+
+		/** constructor
+		 *
+		 * @param kernel kernel to cache rows of (non-owning back-pointer,
+		 * the kernel owns this cache)
+		 * @param max_bytes overall memory budget of the cache in bytes
+		 * @param num_shards number of independent shards, 0 chooses a
+		 * multiple of the number of threads
+		 * @param single_precision store cached rows as float32, halving
+		 * the cache footprint at the cost of a widening copy per lookup
+		 */
+		ShardedKernelRowCache(
+		    Kernel* kernel, int64_t max_bytes, int32_t num_shards = 0,
+		    bool single_precision = false);
+
+		~ShardedKernelRowCache() override;
+
+		/** get a full kernel row, computing and caching it on a miss.
+		 * Safe to call from multiple threads simultaneously.
+		 *
+		 * @param row row index on lhs
+		 * @return vector of length get_num_vec_rhs() holding the row
+		 */
+		SGVector<KERNELCACHE_ELEM> get_row(int32_t row);
+
+		/** drop all cached rows, e.g. after the kernel was re-initialized
+		 * with different features */
+		void invalidate();
+
+		/** @return number of lookups served from the cache */
+		int64_t get_num_hits() const;
+
+		/** @return number of lookups that had to compute the row */
+		int64_t get_num_misses() const;
+
+		const char* get_name() const override
+		{
+			return "ShardedKernelRowCache";
+		}
+
+	private:
+		/** a cached row together with the epoch of its last access; only
+		 * one of the element vectors is in use, depending on the precision
+		 * the cache was created with */
+		struct CachedRow
+		{
+			SGVector<KERNELCACHE_ELEM> elems;
+			SGVector<float32_t> elems32;
+			uint64_t last_used;
+		};
+
+		/** an independently locked part of the cache */
+		struct Shard
+		{
+			std::mutex lock;
+			std::unordered_map<int32_t, CachedRow> rows;
+			int64_t bytes = 0;
+		};
+
+		Shard& shard_of(int32_t row);
+
+		/** compute one row of the kernel matrix without touching any lock */
+		SGVector<KERNELCACHE_ELEM> compute_row(int32_t row) const;
+
+		/** return a cached row in the cache's external element type,
+		 * widening from float32 storage if necessary */
+		SGVector<KERNELCACHE_ELEM> widen_row(const CachedRow& entry) const;
+
+		/** evict least recently used rows of a shard until it fits its
+		 * budget, must be called with the shard lock held */
+		void evict_lru(Shard& shard);
+
+	private:
+		/** kernel whose rows are cached, not owned */
+		Kernel* m_kernel;
+
+		/** whether rows are stored as float32 */
+		bool m_single_precision;
+
+		/** memory budget of a single shard in bytes */
+		int64_t m_bytes_per_shard;
+
+		std::vector<std::unique_ptr<Shard>> m_shards;
+
+		/** global logical clock for LRU ordering */
+		std::atomic<uint64_t> m_epoch;
+
+		std::atomic<int64_t> m_num_hits;
+		std::atomic<int64_t> m_num_misses;
+	};
+}
+#endif // SHARDEDKERNELROWCACHE_H
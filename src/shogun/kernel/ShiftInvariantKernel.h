@@ -42,6 +42,7 @@ namespace shogun
 namespace internal
 {
 	class KernelManager;
+	class SelfAdjointPrecomputedKernel;
 }
 
 /** @brief Base class for the family of kernel functions that only depend on
@@ -56,6 +57,7 @@ class ShiftInvariantKernel: public Kernel
 {
 
 	friend class internal::KernelManager;
+	friend class internal::SelfAdjointPrecomputedKernel;
 
 public:
 	/** Default constructor.  */
@@ -18,6 +18,7 @@
 #include <shogun/features/StringFeatures.h>
 
 #include <thread>
+#include <vector>
 
 using namespace shogun;
 
@@ -323,6 +324,64 @@ float64_t WeightedDegreeStringKernel::compute_without_mismatch_matrix(
 }
 
 
+bool WeightedDegreeStringKernel::has_block_computation()
+{
+	return lhs && rhs && max_mismatch==0 && length==0 && block_computation &&
+		block_weights;
+}
+
+void WeightedDegreeStringKernel::compute_block(
+	int32_t row_start, int32_t num_rows, int32_t col_start, int32_t num_cols,
+	float64_t* block, int32_t ld)
+{
+	if (!has_block_computation())
+	{
+		Kernel::compute_block(
+			row_start, num_rows, col_start, num_cols, block, ld);
+		return;
+	}
+
+	auto sf_lhs=lhs->as<StringFeatures<char>>();
+	auto sf_rhs=rhs->as<StringFeatures<char>>();
+
+	/* fetch every string of the tile once instead of once per pair */
+	std::vector<char*> avecs(num_rows);
+	std::vector<int32_t> alens(num_rows);
+	std::vector<bool> afree(num_rows);
+	for (int32_t i=0; i<num_rows; i++)
+	{
+		bool free_vec;
+		avecs[i]=sf_lhs->get_feature_vector(row_start+i, alens[i], free_vec);
+		afree[i]=free_vec;
+	}
+
+	std::vector<char*> bvecs(num_cols);
+	std::vector<int32_t> blens(num_cols);
+	std::vector<bool> bfree(num_cols);
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		bool free_vec;
+		bvecs[j]=sf_rhs->get_feature_vector(col_start+j, blens[j], free_vec);
+		bfree[j]=free_vec;
+	}
+
+	for (int32_t j=0; j<num_cols; j++)
+	{
+		for (int32_t i=0; i<num_rows; i++)
+		{
+			float64_t value=compute_using_block(
+				avecs[i], alens[i], bvecs[j], blens[j]);
+			block[i+int64_t(j)*ld]=normalizer->normalize(
+				value, row_start+i, col_start+j);
+		}
+	}
+
+	for (int32_t i=0; i<num_rows; i++)
+		sf_lhs->free_feature_vector(avecs[i], row_start+i, afree[i]);
+	for (int32_t j=0; j<num_cols; j++)
+		sf_rhs->free_feature_vector(bvecs[j], col_start+j, bfree[j]);
+}
+
 float64_t WeightedDegreeStringKernel::compute(int32_t idx_a, int32_t idx_b)
 {
 	int32_t alen, blen;
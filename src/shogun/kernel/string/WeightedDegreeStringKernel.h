@@ -118,6 +118,29 @@ class WeightedDegreeStringKernel: public StringKernel<char>
 			return "WeightedDegreeStringKernel";
 		}
 
+		/** whether the blocked evaluation path is available, i.e. the
+		 * fast run-length based per-pair computation applies (no
+		 * mismatches, no per-position weight matrix)
+		 *
+		 * @return whether compute_block() uses the shared-fetch path
+		 */
+		bool has_block_computation() override;
+
+		/** compute a tile of the kernel matrix, fetching every involved
+		 * string only once per tile instead of once per pair and sharing
+		 * the run-length matching statistics across the tile's pairs
+		 *
+		 * @param row_start first row (lhs index) of the block
+		 * @param num_rows number of rows of the block
+		 * @param col_start first column (rhs index) of the block
+		 * @param num_cols number of columns of the block
+		 * @param block column-major target buffer
+		 * @param ld leading dimension of the target buffer
+		 */
+		void compute_block(
+			int32_t row_start, int32_t num_rows, int32_t col_start,
+			int32_t num_cols, float64_t* block, int32_t ld) override;
+
 		/** initialize optimization
 		 *
 		 * @param count count
@@ -72,7 +72,7 @@ bool BinaryLabels::is_valid() const
 	for (int32_t i = 0; i < subset_size; i++)
 	{
 		int32_t real_i = m_subset_stack->subset_idx_conversion(i);
-		if (m_labels[real_i] != +1.0 && m_labels[real_i] != -1.0)
+		if (load_label(real_i) != +1.0 && load_label(real_i) != -1.0)
 			return false;
 	}
 	return true;
@@ -119,8 +119,9 @@ void BinaryLabels::scores_to_probabilities(float64_t a, float64_t b)
 
 std::shared_ptr<Labels> BinaryLabels::shallow_subset_copy()
 {
-	SGVector<float64_t> shallow_copy_vector(m_labels);
-	auto shallow_copy_labels=std::make_shared<BinaryLabels>(m_labels.size());
+	SGVector<float64_t> shallow_copy_vector(
+		m_storage_mode==LSM_FLOAT64 ? m_labels : materialize_labels());
+	auto shallow_copy_labels=std::make_shared<BinaryLabels>(shallow_copy_vector.size());
 
 
 	shallow_copy_labels->set_labels(shallow_copy_vector);
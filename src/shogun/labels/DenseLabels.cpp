@@ -35,6 +35,11 @@ DenseLabels::DenseLabels(const DenseLabels& orig)
     : Labels(orig), m_labels(orig.m_labels)
 {
 	init();
+	m_storage_mode = orig.m_storage_mode;
+	m_num_packed_labels = orig.m_num_packed_labels;
+	m_labels_bits = orig.m_labels_bits;
+	m_labels_uint8 = orig.m_labels_uint8;
+	m_labels_uint16 = orig.m_labels_uint16;
 }
 
 DenseLabels::DenseLabels(std::shared_ptr<File> loader)
@@ -50,7 +55,21 @@ DenseLabels::~DenseLabels()
 
 void DenseLabels::init()
 {
+	m_storage_mode = LSM_FLOAT64;
+	m_num_packed_labels = 0;
+
 	SG_ADD(&m_labels, "labels", "The labels.");
+	SG_ADD_OPTIONS(
+	    (machine_int_t*)&m_storage_mode, "storage_mode",
+	    "Active storage mode of the labels.", ParameterProperties::NONE,
+	    SG_OPTIONS(LSM_FLOAT64, LSM_BITPACK_BINARY, LSM_UINT8, LSM_UINT16));
+	SG_ADD(
+	    &m_num_packed_labels, "num_packed_labels",
+	    "Number of labels when bit-packed.");
+	SG_ADD(&m_labels_bits, "labels_bits", "Bit-packed binary labels.");
+	SG_ADD(&m_labels_uint8, "labels_uint8", "Byte-sized multiclass labels.");
+	SG_ADD(
+	    &m_labels_uint16, "labels_uint16", "Two-byte multiclass labels.");
 	watch_method("num_labels", &DenseLabels::get_num_labels);
 }
 
@@ -66,11 +85,11 @@ void DenseLabels::zero()
 
 void DenseLabels::set_to_const(float64_t c)
 {
-	ASSERT(m_labels.vector)
+	ASSERT(has_labels())
 	index_t subset_size=get_num_labels();
 	for (int32_t i=0; i<subset_size; i++)
 	{
-		m_labels.vector[m_subset_stack->subset_idx_conversion(i)]=c;
+		store_label(m_subset_stack->subset_idx_conversion(i), c);
 		m_current_values.vector[m_subset_stack->subset_idx_conversion(i)]=c;
 	}
 }
@@ -80,6 +99,11 @@ void DenseLabels::set_labels(SGVector<float64_t> v)
 	if (m_subset_stack->has_subsets())
 		error("A subset is set, cannot set labels");
 
+	m_storage_mode = LSM_FLOAT64;
+	m_num_packed_labels = 0;
+	m_labels_bits = SGVector<uint64_t>();
+	m_labels_uint8 = SGVector<uint8_t>();
+	m_labels_uint16 = SGVector<uint16_t>();
 	m_labels = v;
 }
 
@@ -88,13 +112,21 @@ SGVector<float64_t> DenseLabels::get_labels() const
 	if (m_subset_stack->has_subsets())
 		return get_labels_copy();
 
+	if (m_storage_mode != LSM_FLOAT64)
+		return materialize_labels();
+
 	return m_labels;
 }
 
 SGVector<float64_t> DenseLabels::get_labels_copy() const
 {
 	if (!m_subset_stack->has_subsets())
+	{
+		if (m_storage_mode != LSM_FLOAT64)
+			return materialize_labels();
+
 		return m_labels.clone();
+	}
 
 	index_t num_labels = get_num_labels();
 	SGVector<float64_t> result(num_labels);
@@ -142,7 +174,7 @@ void DenseLabels::set_int_labels(SGVector<int64_t> lab)
 
 bool DenseLabels::is_valid() const
 {
-	return (m_labels.data() != nullptr) && (m_labels.size() > 0);
+	return has_labels() && (stored_num_labels() > 0);
 }
 
 void DenseLabels::ensure_valid(const char* context)
@@ -153,7 +185,7 @@ void DenseLabels::ensure_valid(const char* context)
 void DenseLabels::load(std::shared_ptr<File> loader)
 {
 	remove_subset();
-	m_labels = SGVector<float64_t>();
+	set_labels(SGVector<float64_t>());
 	m_labels.load(std::move(loader));
 }
 
@@ -162,15 +194,21 @@ void DenseLabels::save(std::shared_ptr<File> writer)
 	if (m_subset_stack->has_subsets())
 		error("save() is not possible on subset");
 
+	if (m_storage_mode != LSM_FLOAT64)
+	{
+		materialize_labels().save(std::move(writer));
+		return;
+	}
+
 	m_labels.save(std::move(writer));
 }
 
 bool DenseLabels::set_label(int32_t idx, float64_t label)
 {
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
-	if (m_labels.vector && real_num<get_num_labels())
+	if (has_labels() && real_num<get_num_labels())
 	{
-		m_labels.vector[real_num]=label;
+		store_label(real_num, label);
 		return true;
 	}
 	else
@@ -180,9 +218,9 @@ bool DenseLabels::set_label(int32_t idx, float64_t label)
 bool DenseLabels::set_int_label(int32_t idx, int32_t label)
 {
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
-	if (m_labels.vector && real_num<get_num_labels())
+	if (has_labels() && real_num<get_num_labels())
 	{
-		m_labels.vector[real_num] = (float64_t)label;
+		store_label(real_num, (float64_t)label);
 		return true;
 	}
 	else
@@ -192,22 +230,121 @@ bool DenseLabels::set_int_label(int32_t idx, int32_t label)
 float64_t DenseLabels::get_label(int32_t idx) const
 {
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
-	ASSERT(m_labels.vector && idx<get_num_labels())
-	return m_labels.vector[real_num];
+	ASSERT(has_labels() && idx<get_num_labels())
+	return load_label(real_num);
 }
 
 int32_t DenseLabels::get_int_label(int32_t idx) const
 {
 	int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
-	ASSERT(m_labels.vector && idx<get_num_labels())
-	if (m_labels.vector[real_num] != float64_t((int32_t(m_labels.vector[real_num]))))
-		error("label[{}]={:g} is not an integer", m_labels.vector[real_num]);
+	ASSERT(has_labels() && idx<get_num_labels())
+	float64_t label=load_label(real_num);
+	if (label != float64_t(int32_t(label)))
+		error("label[{}]={:g} is not an integer", idx, label);
 
-	return int32_t(m_labels.vector[real_num]);
+	return int32_t(label);
 }
 
 int32_t DenseLabels::get_num_labels() const
 {
 	return m_subset_stack->has_subsets()
-			? m_subset_stack->get_size() : m_labels.vlen;
+			? m_subset_stack->get_size() : stored_num_labels();
+}
+
+void DenseLabels::store_label(int32_t real_num, float64_t label)
+{
+	switch (m_storage_mode)
+	{
+		case LSM_BITPACK_BINARY:
+		{
+			require(label==1.0 || label==-1.0,
+				"Label {:g} cannot be stored bit-packed, only -1/+1 can",
+				label);
+			uint64_t bit=(uint64_t)1<<(real_num%64);
+			if (label>0)
+				m_labels_bits[real_num/64] |= bit;
+			else
+				m_labels_bits[real_num/64] &= ~bit;
+			break;
+		}
+		case LSM_UINT8:
+			require(label>=0 && label<=255 &&
+				label==float64_t(int32_t(label)),
+				"Label {:g} cannot be stored as uint8", label);
+			m_labels_uint8[real_num]=(uint8_t)label;
+			break;
+		case LSM_UINT16:
+			require(label>=0 && label<=65535 &&
+				label==float64_t(int32_t(label)),
+				"Label {:g} cannot be stored as uint16", label);
+			m_labels_uint16[real_num]=(uint16_t)label;
+			break;
+		default:
+			m_labels.vector[real_num]=label;
+			break;
+	}
+}
+
+int32_t DenseLabels::stored_num_labels() const
+{
+	switch (m_storage_mode)
+	{
+		case LSM_BITPACK_BINARY:
+			return m_num_packed_labels;
+		case LSM_UINT8:
+			return m_labels_uint8.vlen;
+		case LSM_UINT16:
+			return m_labels_uint16.vlen;
+		default:
+			return m_labels.vlen;
+	}
+}
+
+SGVector<float64_t> DenseLabels::materialize_labels() const
+{
+	if (m_storage_mode == LSM_FLOAT64)
+		return m_labels.clone();
+
+	int32_t num_labels=stored_num_labels();
+	SGVector<float64_t> result(num_labels);
+	for (int32_t i=0; i<num_labels; i++)
+		result[i]=load_label(i);
+
+	return result;
+}
+
+void DenseLabels::compact_labels(ELabelStorageMode mode)
+{
+	if (m_subset_stack->has_subsets())
+		error("compact_labels() is not possible on subset");
+
+	if (mode == m_storage_mode)
+		return;
+
+	SGVector<float64_t> current=materialize_labels();
+	int32_t num_labels=current.vlen;
+
+	set_labels(SGVector<float64_t>());
+	m_storage_mode=mode;
+
+	switch (mode)
+	{
+		case LSM_BITPACK_BINARY:
+			m_num_packed_labels=num_labels;
+			m_labels_bits=SGVector<uint64_t>((num_labels+63)/64);
+			m_labels_bits.zero();
+			break;
+		case LSM_UINT8:
+			m_labels_uint8=SGVector<uint8_t>(num_labels);
+			break;
+		case LSM_UINT16:
+			m_labels_uint16=SGVector<uint16_t>(num_labels);
+			break;
+		default:
+			m_labels=SGVector<float64_t>(num_labels);
+			break;
+	}
+
+	for (int32_t i=0; i<num_labels; i++)
+		store_label(i, current[i]);
 }
@@ -22,6 +22,22 @@ namespace shogun
 	class File;
 	class BinaryLabels;
 
+	/// storage mode of a DenseLabels vector
+	enum ELabelStorageMode
+	{
+		/// plain float64 vector (default)
+		LSM_FLOAT64=0,
+
+		/// -1/+1 labels packed one bit each
+		LSM_BITPACK_BINARY=1,
+
+		/// integer labels in [0, 255], one byte each
+		LSM_UINT8=2,
+
+		/// integer labels in [0, 65535], two bytes each
+		LSM_UINT16=3
+	};
+
 	/** @brief Dense integer or floating point labels
 	 *
 	 * DenseLabels here are always real-valued and thus applicable to
@@ -132,10 +148,10 @@ namespace shogun
 		{
 			require(idx<get_num_labels(), "The provided index ({}) is out of bounds (the last label has index ({})).  "
 				"Please ensure that you're using a valid index number.", idx, get_num_labels());
-			require(m_labels.vector, "You're attempting to get a label when there are in fact none!  "
+			require(has_labels(), "You're attempting to get a label when there are in fact none!  "
 				"Please ensure that you initialized the labels correctly.");
 			int32_t real_num=m_subset_stack->subset_idx_conversion(idx);
-			return m_labels.vector[real_num];
+			return (ST) load_label(real_num);
 		}
 
 		/** get INT label
@@ -163,7 +179,7 @@ namespace shogun
 		template<typename ST>
 		SGVector<ST> get_labels_t()
 		{
-			if (m_subset_stack->has_subsets())
+			if (m_subset_stack->has_subsets() || m_storage_mode!=LSM_FLOAT64)
 				return get_labels_copy_t<ST>();
 
 			SGVector<ST> labels_copy(m_labels.vlen);
@@ -182,7 +198,7 @@ namespace shogun
 		template<typename ST>
 		SGVector<ST> get_labels_copy_t()
 		{
-			if (!m_subset_stack->has_subsets())
+			if (!m_subset_stack->has_subsets() && m_storage_mode==LSM_FLOAT64)
 			{
 				SGVector<ST> labels_copy(m_labels.vlen);
 				for(index_t i = 0; i < m_labels.vlen; ++i)
@@ -209,6 +225,27 @@ namespace shogun
 		 */
 		void set_labels(SGVector<float64_t> v);
 
+		/** convert the labels to a compact storage mode
+		 *
+		 * The float64 vector is replaced by bit-packed (binary) or
+		 * uint8/uint16 (multiclass) storage, cutting label memory by
+		 * 8-64x; all accessors keep working and convert on the fly,
+		 * bulk getters materialize a float64 copy. Values the target
+		 * encoding cannot represent raise an error. Converting to
+		 * LSM_FLOAT64 restores plain storage.
+		 *
+		 * not possible with subset
+		 *
+		 * @param mode storage mode to convert to
+		 */
+		void compact_labels(ELabelStorageMode mode);
+
+		/** @return active storage mode of the labels */
+		inline ELabelStorageMode get_storage_mode() const
+		{
+			return m_storage_mode;
+		}
+
 		/**
 		 * set all labels to +1
 		 *
@@ -273,9 +310,71 @@ namespace shogun
 	private:
 		void init();
 
+	protected:
+		/** read a label from the active storage at an already
+		 * subset-resolved index */
+		inline float64_t load_label(int32_t real_num) const
+		{
+			switch (m_storage_mode)
+			{
+				case LSM_BITPACK_BINARY:
+					return (m_labels_bits[real_num/64]>>(real_num%64))&1
+						? 1.0 : -1.0;
+				case LSM_UINT8:
+					return m_labels_uint8[real_num];
+				case LSM_UINT16:
+					return m_labels_uint16[real_num];
+				default:
+					return m_labels.vector[real_num];
+			}
+		}
+
+		/** write a label to the active storage at an already
+		 * subset-resolved index; compact modes raise an error on
+		 * values their encoding cannot represent */
+		void store_label(int32_t real_num, float64_t label);
+
+		/** @return whether the active storage holds labels */
+		inline bool has_labels() const
+		{
+			switch (m_storage_mode)
+			{
+				case LSM_BITPACK_BINARY:
+					return m_labels_bits.vector!=NULL;
+				case LSM_UINT8:
+					return m_labels_uint8.vector!=NULL;
+				case LSM_UINT16:
+					return m_labels_uint16.vector!=NULL;
+				default:
+					return m_labels.vector!=NULL;
+			}
+		}
+
+		/** @return number of labels in the active storage */
+		int32_t stored_num_labels() const;
+
+		/** materialize the full label vector (ignoring subsets) as
+		 * float64, regardless of storage mode */
+		SGVector<float64_t> materialize_labels() const;
+
 	protected:
 		/** the label vector */
 		SGVector<float64_t> m_labels;
+
+		/** active storage mode */
+		ELabelStorageMode m_storage_mode;
+
+		/** number of labels when bit-packed */
+		int32_t m_num_packed_labels;
+
+		/** bit-packed binary labels, 64 per word */
+		SGVector<uint64_t> m_labels_bits;
+
+		/** byte-sized multiclass labels */
+		SGVector<uint8_t> m_labels_uint8;
+
+		/** two-byte multiclass labels */
+		SGVector<uint16_t> m_labels_uint16;
 };
 
 /**
@@ -286,7 +385,7 @@ namespace shogun
 template <>
 inline SGVector<float64_t> DenseLabels::get_labels_t<float64_t>()
 {
-	if (m_subset_stack->has_subsets())
+	if (m_subset_stack->has_subsets() || m_storage_mode!=LSM_FLOAT64)
 		return get_labels_copy_t<float64_t>();
 
 	return m_labels;
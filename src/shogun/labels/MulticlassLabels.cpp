@@ -74,7 +74,7 @@ SGVector<float64_t> MulticlassLabels::get_multiclass_confidences(int32_t i)
 
 void MulticlassLabels::allocate_confidences_for(int32_t n_classes)
 {
-	int32_t n_labels = m_labels.size();
+	int32_t n_labels = stored_num_labels();
 	require(n_labels!=0,"{}::allocate_confidences_for(): There should be "
 			"labels to store confidences", get_name());
 
@@ -104,9 +104,9 @@ bool MulticlassLabels::is_valid() const
     for (int32_t i=0; i<subset_size; i++)
     {
         int32_t real_i = m_subset_stack->subset_idx_conversion(i);
-		int32_t label = int64_t(m_labels[real_i]);
+		int32_t label = int64_t(load_label(real_i));
 
-		if (label<0 || float64_t(label)!=m_labels[real_i])
+		if (label<0 || float64_t(label)!=load_label(real_i))
 		{
 			return false;
 		}
@@ -176,8 +176,9 @@ int32_t MulticlassLabels::get_num_classes()
 
 std::shared_ptr<Labels> MulticlassLabels::shallow_subset_copy()
 {
-	SGVector<float64_t> shallow_copy_vector(m_labels);
-	auto shallow_copy_labels=std::make_shared<MulticlassLabels>(m_labels.size());
+	SGVector<float64_t> shallow_copy_vector(
+		m_storage_mode==LSM_FLOAT64 ? m_labels : materialize_labels());
+	auto shallow_copy_labels=std::make_shared<MulticlassLabels>(shallow_copy_vector.size());
 
 	shallow_copy_labels->set_labels(shallow_copy_vector);
 	if (m_subset_stack->has_subsets())
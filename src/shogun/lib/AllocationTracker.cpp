@@ -0,0 +1,135 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/lib/AllocationTracker.h>
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace shogun;
+
+namespace
+{
+	constexpr const char* UNTAGGED = "untagged";
+
+	/* All state lives behind one lock: this is an opt-in diagnosis tool
+	 * and correctness of attribution matters more than recording speed.
+	 * The containers use the default allocator, which does not route
+	 * through sg_malloc, so recording cannot recurse into itself. */
+	struct TrackerState
+	{
+		std::mutex lock;
+		std::map<std::string, AllocationTracker::SiteStats> stats;
+		/* live pointer -> (size, owning tag) so frees can be returned to
+		 * the tag that allocated them */
+		std::unordered_map<const void*, std::pair<size_t, std::string>>
+		    live;
+	};
+
+	TrackerState& state()
+	{
+		static TrackerState instance;
+		return instance;
+	}
+
+	thread_local std::vector<const char*> tag_stack;
+
+	const char* current_tag()
+	{
+		return tag_stack.empty() ? UNTAGGED : tag_stack.back();
+	}
+}
+
+void AllocationTracker::record_alloc(const void* ptr, size_t bytes)
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	const char* tag = current_tag();
+	auto& site = s.stats[tag];
+	site.allocs++;
+	site.bytes_allocated += bytes;
+	site.current_bytes += bytes;
+	site.peak_bytes = std::max(site.peak_bytes, site.current_bytes);
+	s.live[ptr] = {bytes, tag};
+}
+
+void AllocationTracker::record_free(const void* ptr)
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	auto found = s.live.find(ptr);
+	/* pointers allocated before tracking started (or outside sg_malloc)
+	 * are simply unknown */
+	if (found == s.live.end())
+		return;
+	auto& site = s.stats[found->second.second];
+	site.frees++;
+	site.current_bytes -= found->second.first;
+	s.live.erase(found);
+}
+
+void AllocationTracker::record_copy()
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	s.stats[current_tag()].copies++;
+}
+
+void AllocationTracker::record_shared_ref()
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	s.stats[current_tag()].shared_refs++;
+}
+
+std::map<std::string, AllocationTracker::SiteStats>
+AllocationTracker::snapshot()
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	return s.stats;
+}
+
+std::string AllocationTracker::report()
+{
+	auto stats = snapshot();
+
+	std::vector<std::pair<std::string, SiteStats>> sorted(
+	    stats.begin(), stats.end());
+	std::sort(
+	    sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+		    return a.second.bytes_allocated > b.second.bytes_allocated;
+	    });
+
+	std::ostringstream out;
+	out << "tag\tallocs\tfrees\tcopies\tshared_refs\tbytes\tpeak_bytes\n";
+	for (const auto& [tag, site] : sorted)
+	{
+		out << tag << '\t' << site.allocs << '\t' << site.frees << '\t'
+		    << site.copies << '\t' << site.shared_refs << '\t'
+		    << site.bytes_allocated << '\t' << site.peak_bytes << '\n';
+	}
+	return out.str();
+}
+
+void AllocationTracker::reset()
+{
+	auto& s = state();
+	std::lock_guard<std::mutex> guard(s.lock);
+	s.stats.clear();
+	s.live.clear();
+}
+
+AllocationScope::AllocationScope(const char* tag)
+{
+	tag_stack.push_back(tag);
+}
+
+AllocationScope::~AllocationScope()
+{
+	tag_stack.pop_back();
+}
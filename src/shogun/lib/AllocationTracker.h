@@ -0,0 +1,123 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef __ALLOCATIONTRACKER_H__
+#define __ALLOCATIONTRACKER_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+
+#include <map>
+#include <string>
+
+namespace shogun
+{
+	/** @brief Opt-in instrumentation that attributes SG container
+	 * allocation traffic to call-site tags.
+	 *
+	 * When the library is configured with USE_ALLOC_TRACKING, sg_malloc
+	 * and friends report every allocation and free here, and
+	 * SGReferencedData reports refcounted copies and refcount operations
+	 * on already-shared data. Each record is charged to the innermost
+	 * active @ref AllocationScope of the calling thread (or "untagged"),
+	 * so wrapping a suspect code path in a scope shows exactly how many
+	 * hidden copies and bytes it causes.
+	 *
+	 * This is a diagnosis tool, not production telemetry: the recording
+	 * functions take a global lock and maintain a pointer-size side table,
+	 * which costs real time. Default builds compile all hooks out and pay
+	 * nothing.
+	 */
+	class AllocationTracker
+	{
+	public:
+		/** Per-tag statistics */
+		struct SiteStats
+		{
+			/** number of allocations */
+			uint64_t allocs = 0;
+			/** number of frees */
+			uint64_t frees = 0;
+			/** refcounted copies of SG containers */
+			uint64_t copies = 0;
+			/** ref/unref operations on counters already shared between
+			 * owners, a proxy for refcount cache-line contention */
+			uint64_t shared_refs = 0;
+			/** total bytes allocated */
+			uint64_t bytes_allocated = 0;
+			/** bytes currently live */
+			uint64_t current_bytes = 0;
+			/** peak of current_bytes */
+			uint64_t peak_bytes = 0;
+		};
+
+		/** Record an allocation of the given size, charged to the calling
+		 * thread's innermost scope.
+		 *
+		 * @param ptr the allocated pointer
+		 * @param bytes allocation size
+		 */
+		static void record_alloc(const void* ptr, size_t bytes);
+
+		/** Record that a tracked pointer was freed; the bytes are
+		 * returned to the tag that allocated them.
+		 *
+		 * @param ptr the pointer being freed
+		 */
+		static void record_free(const void* ptr);
+
+		/** Record a refcounted copy of an SG container */
+		static void record_copy();
+
+		/** Record a ref/unref on an already-shared refcount */
+		static void record_shared_ref();
+
+		/** Snapshot of the per-tag statistics gathered so far
+		 *
+		 * @return map from tag to its statistics
+		 */
+		static std::map<std::string, SiteStats> snapshot();
+
+		/** Formatted per-tag report, one line per tag, sorted by total
+		 * bytes allocated.
+		 *
+		 * @return human-readable report
+		 */
+		static std::string report();
+
+		/** Drop all gathered statistics and the pointer side table */
+		static void reset();
+	};
+
+	/** @brief RAII call-site tag: allocation traffic of the calling
+	 * thread is charged to the innermost live scope. Use through
+	 * SG_ALLOC_SCOPE so the object disappears from untracked builds.
+	 */
+	class AllocationScope
+	{
+	public:
+		/** Push @p tag for the calling thread
+		 *
+		 * @param tag call-site tag, must outlive the scope
+		 */
+		explicit AllocationScope(const char* tag);
+
+		/** Pop the tag */
+		~AllocationScope();
+
+		AllocationScope(const AllocationScope&) = delete;
+		AllocationScope& operator=(const AllocationScope&) = delete;
+	};
+
+#ifdef USE_ALLOC_TRACKING
+#define SG_ALLOC_SCOPE_NAME_IMPL(line) sg_alloc_scope_##line
+#define SG_ALLOC_SCOPE_NAME(line) SG_ALLOC_SCOPE_NAME_IMPL(line)
+#define SG_ALLOC_SCOPE(tag)                                                    \
+	shogun::AllocationScope SG_ALLOC_SCOPE_NAME(__LINE__)(tag)
+#else
+#define SG_ALLOC_SCOPE(tag)
+#endif
+}
+#endif /* __ALLOCATIONTRACKER_H__ */
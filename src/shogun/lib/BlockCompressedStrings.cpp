@@ -0,0 +1,185 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/BlockCompressedStrings.h>
+
+#include <algorithm>
+
+namespace shogun
+{
+
+template <class ST>
+BlockCompressedStrings<ST>::BlockCompressedStrings() : SGObject()
+{
+	init();
+	SGObject::set_generic<ST>();
+}
+
+template <class ST>
+BlockCompressedStrings<ST>::BlockCompressedStrings(
+	const std::vector<SGVector<ST>>& strings,
+	E_COMPRESSION_TYPE compression, int32_t strings_per_block,
+	int32_t num_cached_blocks, int32_t level) : SGObject()
+{
+	init();
+	SGObject::set_generic<ST>();
+
+	require(strings_per_block>0,
+		"Number of strings per block ({}) must be positive",
+		strings_per_block);
+	require(num_cached_blocks>0,
+		"Number of cached blocks ({}) must be positive", num_cached_blocks);
+
+	m_strings_per_block=strings_per_block;
+	m_num_cached_blocks=num_cached_blocks;
+	m_compressor=std::make_shared<Compressor>(compression);
+
+	const index_t num_strings=static_cast<index_t>(strings.size());
+	m_offsets.resize(num_strings);
+	m_lengths.resize(num_strings);
+
+	for (index_t begin=0; begin<num_strings; begin+=m_strings_per_block)
+	{
+		index_t end=std::min(begin+m_strings_per_block, num_strings);
+
+		int64_t block_len=0;
+		for (index_t i=begin; i<end; i++)
+		{
+			m_offsets[i]=block_len;
+			m_lengths[i]=strings[i].vlen;
+			block_len+=strings[i].vlen;
+		}
+
+		SGVector<ST> concat(static_cast<index_t>(block_len));
+		for (index_t i=begin; i<end; i++)
+		{
+			sg_memcpy(concat.vector+m_offsets[i], strings[i].vector,
+				strings[i].vlen*sizeof(ST));
+		}
+
+		Block block;
+		block.uncompressed_size=uint64_t(block_len)*sizeof(ST);
+		if (block.uncompressed_size)
+		{
+			uint8_t* compressed=NULL;
+			uint64_t compressed_size=0;
+			m_compressor->compress(
+				reinterpret_cast<uint8_t*>(concat.vector),
+				block.uncompressed_size, compressed, compressed_size,
+				level);
+			block.compressed=SGVector<uint8_t>(compressed,
+				static_cast<index_t>(compressed_size));
+		}
+		m_blocks.push_back(block);
+	}
+}
+
+template <class ST>
+BlockCompressedStrings<ST>::~BlockCompressedStrings()
+{
+}
+
+template <class ST>
+void BlockCompressedStrings<ST>::init()
+{
+	m_strings_per_block=256;
+	m_num_cached_blocks=4;
+	m_compressor=NULL;
+}
+
+template <class ST>
+index_t BlockCompressedStrings<ST>::get_num_strings() const
+{
+	return static_cast<index_t>(m_lengths.size());
+}
+
+template <class ST>
+const SGVector<ST>& BlockCompressedStrings<ST>::get_block(int32_t block_idx)
+{
+	for (auto it=m_cache.begin(); it!=m_cache.end(); ++it)
+	{
+		if (it->first==block_idx)
+		{
+			// move to front, i.e. most recently used
+			m_cache.splice(m_cache.begin(), m_cache, it);
+			return m_cache.front().second;
+		}
+	}
+
+	const Block& block=m_blocks[block_idx];
+	SGVector<ST> data(
+		static_cast<index_t>(block.uncompressed_size/sizeof(ST)));
+	if (block.uncompressed_size)
+	{
+		uint64_t uncompressed_size=block.uncompressed_size;
+		m_compressor->decompress(block.compressed.vector,
+			block.compressed.vlen,
+			reinterpret_cast<uint8_t*>(data.vector), uncompressed_size);
+		require(uncompressed_size==block.uncompressed_size,
+			"Block {} decompressed to {} instead of {} bytes", block_idx,
+			uncompressed_size, block.uncompressed_size);
+	}
+
+	m_cache.emplace_front(block_idx, data);
+	while (static_cast<int32_t>(m_cache.size())>m_num_cached_blocks)
+		m_cache.pop_back();
+
+	return m_cache.front().second;
+}
+
+template <class ST>
+SGVector<ST> BlockCompressedStrings<ST>::get_string(index_t idx)
+{
+	require(idx>=0 && idx<get_num_strings(),
+		"Index {} is out of range [0, {})", idx, get_num_strings());
+
+	const SGVector<ST>& block=get_block(idx/m_strings_per_block);
+
+	SGVector<ST> result(m_lengths[idx]);
+	sg_memcpy(result.vector, block.vector+m_offsets[idx],
+		m_lengths[idx]*sizeof(ST));
+	return result;
+}
+
+template <class ST>
+std::vector<SGVector<ST>> BlockCompressedStrings<ST>::get_strings()
+{
+	std::vector<SGVector<ST>> result;
+	result.reserve(get_num_strings());
+	for (index_t i=0; i<get_num_strings(); i++)
+		result.push_back(get_string(i));
+	return result;
+}
+
+template <class ST>
+float64_t BlockCompressedStrings<ST>::get_compression_ratio() const
+{
+	uint64_t compressed_size=0;
+	uint64_t uncompressed_size=0;
+	for (size_t i=0; i<m_blocks.size(); i++)
+	{
+		compressed_size+=m_blocks[i].compressed.vlen;
+		uncompressed_size+=m_blocks[i].uncompressed_size;
+	}
+
+	if (!uncompressed_size)
+		return 1.0;
+	return float64_t(compressed_size)/uncompressed_size;
+}
+
+template class BlockCompressedStrings<bool>;
+template class BlockCompressedStrings<char>;
+template class BlockCompressedStrings<int8_t>;
+template class BlockCompressedStrings<uint8_t>;
+template class BlockCompressedStrings<int16_t>;
+template class BlockCompressedStrings<uint16_t>;
+template class BlockCompressedStrings<int32_t>;
+template class BlockCompressedStrings<uint32_t>;
+template class BlockCompressedStrings<int64_t>;
+template class BlockCompressedStrings<uint64_t>;
+template class BlockCompressedStrings<float32_t>;
+template class BlockCompressedStrings<float64_t>;
+template class BlockCompressedStrings<floatmax_t>;
+}
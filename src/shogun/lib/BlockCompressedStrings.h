@@ -0,0 +1,111 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef __BLOCK_COMPRESSED_STRINGS_H__
+#define __BLOCK_COMPRESSED_STRINGS_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/base/SGObject.h>
+#include <shogun/lib/Compressor.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/lib/common.h>
+
+#include <list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace shogun
+{
+/** @brief Block-compressed storage for string lists.
+ *
+ * Strings are concatenated into fixed-count blocks and every block is
+ * compressed as one buffer via Compressor. Small strings therefore share the
+ * codec's window with their block neighbours, which restores the compression
+ * ratio that per-string compression (cf. StringFeatures::save_compressed and
+ * DecompressString) loses on short sequences.
+ *
+ * Access is lazy: a string lookup decompresses only the block holding it,
+ * and a small LRU cache of hot blocks makes sequential and clustered access
+ * patterns pay the decompression once per block instead of once per string.
+ */
+template <class ST>
+class BlockCompressedStrings : public SGObject
+{
+public:
+	/** default constructor */
+	BlockCompressedStrings();
+
+	/** constructor
+	 *
+	 * @param strings strings to store
+	 * @param compression compression to use, one of E_COMPRESSION_TYPE
+	 * @param strings_per_block number of strings concatenated per block
+	 * @param num_cached_blocks number of decompressed blocks kept hot
+	 * @param level compression level between 1 and 9
+	 */
+	BlockCompressedStrings(const std::vector<SGVector<ST>>& strings,
+		E_COMPRESSION_TYPE compression, int32_t strings_per_block=256,
+		int32_t num_cached_blocks=4, int32_t level=1);
+
+	/** default destructor */
+	~BlockCompressedStrings() override;
+
+	/** @return number of stored strings */
+	index_t get_num_strings() const;
+
+	/** get a string, decompressing its block if it is not cached
+	 *
+	 * @param idx index of the string
+	 * @return copy of the stored string
+	 */
+	SGVector<ST> get_string(index_t idx);
+
+	/** @return all strings, decompressed */
+	std::vector<SGVector<ST>> get_strings();
+
+	/** @return compressed size divided by uncompressed size */
+	float64_t get_compression_ratio() const;
+
+	/** @return object name */
+	const char* get_name() const override
+	{
+		return "BlockCompressedStrings";
+	}
+
+private:
+	void init();
+
+	/** get a decompressed block, serving it from the LRU cache when hot */
+	const SGVector<ST>& get_block(int32_t block_idx);
+
+private:
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+	/** one compressed block of concatenated strings */
+	struct Block
+	{
+		/** compressed bytes */
+		SGVector<uint8_t> compressed;
+		/** uncompressed size in bytes */
+		uint64_t uncompressed_size;
+	};
+#endif
+
+	/** compressed blocks */
+	std::vector<Block> m_blocks;
+	/** per-string offset within its block, in elements */
+	std::vector<int64_t> m_offsets;
+	/** per-string length in elements */
+	std::vector<index_t> m_lengths;
+	/** number of strings concatenated per block */
+	int32_t m_strings_per_block;
+	/** capacity of the hot-block cache */
+	int32_t m_num_cached_blocks;
+	/** decompressed hot blocks, most recently used first */
+	std::list<std::pair<int32_t, SGVector<ST>>> m_cache;
+	/** compressor used for all blocks */
+	std::shared_ptr<Compressor> m_compressor;
+};
+}
+#endif //__BLOCK_COMPRESSED_STRINGS_H__
@@ -0,0 +1,319 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef _CONCURRENT_CACHE_H__
+#define _CONCURRENT_CACHE_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/base/SGObject.h>
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/common.h>
+#include <shogun/mathematics/Math.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace shogun
+{
+/** @brief Concurrent segmented replacement for @ref Cache.
+ *
+ * The classic Cache serializes every access through its caller, which
+ * makes parallel kernel matrix assembly over cached rows a sequential
+ * bottleneck. ConcurrentCache splits entries and cache lines into
+ * power-of-two segments, each with its own lock, so insertions and
+ * evictions in different segments never contend. Cached objects are
+ * immutable between insertion and eviction, and a hit takes no lock at
+ * all: readers pin the entry with one atomic increment, validate the
+ * object pointer, and unpin when done. Eviction only recycles lines
+ * whose entries are unpinned, so a pinned pointer stays valid for as
+ * long as the caller holds it.
+ *
+ * The API follows Cache: set_entry() hands out a line to fill (pinned
+ * until unlock_entry()), lock_entry() pins and returns a cached object
+ * or NULL, unlock_entry() releases the pin. Within a segment, the
+ * least-used unpinned entry is evicted first.
+ */
+template<class T> class ConcurrentCache : public SGObject
+{
+	/** per-entry bookkeeping; obj/pins carry the lock-free read
+	 * protocol, usage is only a victim-selection heuristic */
+	struct TEntry
+	{
+		/** cached object, NULL when not resident; only published once
+		 * the writer finished filling the line */
+		std::atomic<T*> obj{nullptr};
+		/** line being filled, published to obj on unlock_entry() */
+		std::atomic<T*> pending{nullptr};
+		/** pin count of current readers/writer */
+		std::atomic<int32_t> pins{0};
+		/** usage count, approximate under concurrency */
+		std::atomic<int64_t> usage_count{0};
+	};
+
+	/** one independently locked segment of the cache */
+	struct Segment
+	{
+		/** serializes insertion and eviction in this segment */
+		std::mutex lock;
+		/** entry number resident in each cache line, -1 when free */
+		std::vector<int64_t> line_owner;
+	};
+
+	public:
+	/** default constructor */
+	ConcurrentCache() : SGObject()
+	{
+		unstable(SOURCE_LOCATION);
+
+		entry_size=0;
+		nr_cache_lines=0;
+		num_segments=0;
+
+		set_generic<T>();
+	}
+
+	/** constructor
+	 *
+	 * create a cache in which num_entries objects can be cached
+	 * whose lookup table of sizeof(TEntry)*num_entries
+	 * must fit into memory
+	 *
+	 * @param cache_size cache size in Megabytes
+	 * @param obj_size object size
+	 * @param num_entries number of cacheable objects
+	 */
+	ConcurrentCache(int64_t cache_size, int64_t obj_size, int64_t num_entries)
+	: SGObject()
+	{
+		entry_size=0;
+		nr_cache_lines=0;
+		num_segments=0;
+
+		if (cache_size==0 || obj_size==0 || num_entries==0)
+		{
+			SG_DEBUG("doing without cache.");
+			set_generic<T>();
+			return;
+		}
+
+		entry_size=obj_size;
+		nr_cache_lines=Math::min(
+			(int64_t) (cache_size*1024*1024/obj_size/sizeof(T)),
+			num_entries+1);
+
+		/* enough segments that one worker per core rarely collides,
+		 * but at least one line per segment */
+		num_segments=1;
+		while (num_segments*2<=MAX_SEGMENTS &&
+			num_segments*2<=nr_cache_lines)
+			num_segments*=2;
+
+		io::info("creating {} cache lines in {} segments (total size: {} byte)",
+			nr_cache_lines, num_segments, nr_cache_lines*obj_size*sizeof(T));
+
+		cache_block.resize(entry_size*nr_cache_lines);
+		lookup_table=std::vector<TEntry>(num_entries);
+		segments=std::vector<Segment>(num_segments);
+
+		for (int64_t s=0; s<num_segments; s++)
+		{
+			int64_t lines=lines_of_segment(s);
+			segments[s].line_owner.assign(lines, -1);
+		}
+
+		set_generic<T>();
+	}
+
+	~ConcurrentCache() override
+	{
+	}
+
+	/** checks if an object is cached
+	 *
+	 * @param number number of object to check for
+	 * @return if an object is cached
+	 */
+	inline bool is_cached(int64_t number)
+	{
+		return !lookup_table.empty() &&
+			lookup_table[number].obj.load(std::memory_order_acquire);
+	}
+
+	/** pin and get a cache entry; lock-free on a hit
+	 *
+	 * @param number number of object to pin and get
+	 * @return cache entry or NULL when not cached
+	 */
+	inline T* lock_entry(int64_t number)
+	{
+		if (lookup_table.empty())
+			return NULL;
+
+		TEntry& entry=lookup_table[number];
+		/* pin first, then validate: eviction clears obj before it
+		 * checks for pins, so a non-NULL load here proves the line
+		 * cannot be recycled while we hold the pin. This handshake is
+		 * a store-buffering pattern (pin-then-load-obj here versus
+		 * clear-obj-then-load-pins in evict()), so both sides need the
+		 * seq_cst total order; anything weaker lets both sides read
+		 * the pre-update values on weakly-ordered hardware */
+		entry.pins.fetch_add(1, std::memory_order_seq_cst);
+		T* obj=entry.obj.load(std::memory_order_seq_cst);
+		if (!obj)
+		{
+			entry.pins.fetch_sub(1, std::memory_order_release);
+			return NULL;
+		}
+		entry.usage_count.fetch_add(1, std::memory_order_relaxed);
+		return obj;
+	}
+
+	/** unpin a cache entry obtained from lock_entry() or set_entry();
+	 * for a freshly filled entry this is also the point where the
+	 * object becomes visible to other threads
+	 *
+	 * @param number number of object to unpin
+	 */
+	inline void unlock_entry(int64_t number)
+	{
+		if (lookup_table.empty())
+			return;
+
+		TEntry& entry=lookup_table[number];
+		T* pending=entry.pending.exchange(nullptr, std::memory_order_acq_rel);
+		if (pending)
+			entry.obj.store(pending, std::memory_order_release);
+		entry.pins.fetch_sub(1, std::memory_order_release);
+	}
+
+	/** returns the address of a cache line to where the data of size
+	 * obj_size has to be written; the entry stays pinned until
+	 * unlock_entry() is called
+	 *
+	 * @param number number of object to cache
+	 * @return address of the entry's cache line, or NULL when the
+	 * object is already resident or being filled (retry lock_entry()
+	 * then), or when all lines of the segment are pinned
+	 */
+	T* set_entry(int64_t number)
+	{
+		if (lookup_table.empty())
+			return NULL;
+
+		int64_t s=number%num_segments;
+		Segment& segment=segments[s];
+		std::lock_guard<std::mutex> guard(segment.lock);
+
+		/* someone else may have claimed the entry while we waited */
+		if (lookup_table[number].obj.load(std::memory_order_acquire) ||
+			lookup_table[number].pending.load(std::memory_order_acquire))
+			return NULL;
+
+		int64_t victim=-1;
+		int64_t min_usage=0;
+		for (size_t line=0; line<segment.line_owner.size(); line++)
+		{
+			int64_t owner=segment.line_owner[line];
+			if (owner<0)
+			{
+				victim=line;
+				break;
+			}
+			if (!evictable(owner))
+				continue;
+			int64_t usage=
+				lookup_table[owner].usage_count.load(std::memory_order_relaxed);
+			if (victim<0 || usage<min_usage)
+			{
+				victim=line;
+				min_usage=usage;
+			}
+		}
+
+		if (victim<0)
+			return NULL;
+
+		int64_t owner=segment.line_owner[victim];
+		if (owner>=0 && !evict(owner))
+			return NULL;
+
+		T* line_ptr=line_address(s, victim);
+		TEntry& entry=lookup_table[number];
+		segment.line_owner[victim]=number;
+		entry.usage_count.store(0, std::memory_order_relaxed);
+		/* stay invisible to lock_entry() until the caller finished
+		 * filling the line and called unlock_entry() */
+		entry.pins.fetch_add(1, std::memory_order_acq_rel);
+		entry.pending.store(line_ptr, std::memory_order_release);
+		return line_ptr;
+	}
+
+	/** @return object name */
+	const char* get_name() const override { return "ConcurrentCache"; }
+
+	protected:
+	/** whether the entry may be evicted right now */
+	bool evictable(int64_t owner)
+	{
+		return lookup_table[owner].pins.load(std::memory_order_acquire)==0;
+	}
+
+	/** detach an entry from its line; fails when a reader pinned the
+	 * entry between victim selection and here
+	 *
+	 * @param owner entry number to evict
+	 * @return whether the line may be reused
+	 */
+	bool evict(int64_t owner)
+	{
+		TEntry& entry=lookup_table[owner];
+		/* counterpart of the pin-then-validate handshake in
+		 * lock_entry(): clear obj, then check for pins, both seq_cst
+		 * so that at least one side observes the other's update */
+		T* obj=entry.obj.exchange(nullptr, std::memory_order_seq_cst);
+		if (entry.pins.load(std::memory_order_seq_cst)>0)
+		{
+			/* a reader won the race: give the object back and report
+			 * the line as unusable for now */
+			entry.obj.store(obj, std::memory_order_release);
+			return false;
+		}
+		return true;
+	}
+
+	/** number of cache lines assigned to a segment */
+	int64_t lines_of_segment(int64_t s) const
+	{
+		return nr_cache_lines/num_segments +
+			(s<nr_cache_lines%num_segments ? 1 : 0);
+	}
+
+	/** address of a line within a segment */
+	T* line_address(int64_t s, int64_t line)
+	{
+		/* segment s owns every num_segments-th line starting at s, so
+		 * segments interleave over the one contiguous block */
+		return cache_block.data()+entry_size*(line*num_segments+s);
+	}
+
+	/** hard upper bound on the number of segments */
+	static constexpr int64_t MAX_SEGMENTS=64;
+
+	/** size of one entry */
+	int64_t entry_size;
+	/** number of cache lines */
+	int64_t nr_cache_lines;
+	/** number of segments */
+	int64_t num_segments;
+	/** per-entry bookkeeping */
+	std::vector<TEntry> lookup_table;
+	/** independently locked segments */
+	std::vector<Segment> segments;
+	/** cache block */
+	std::vector<T> cache_block;
+};
+}
+#endif
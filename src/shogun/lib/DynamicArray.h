@@ -14,6 +14,7 @@
 #include <shogun/base/SGObject.h>
 
 #include <random>
+#include <utility>
 #include <vector>
 
 namespace shogun
@@ -336,7 +337,34 @@ template <class T> class DynamicArray :public SGObject
 		 */
 		inline bool append_element(T e)
 		{
-			m_array.push_back(e);
+			m_array.push_back(std::move(e));
+			return true;
+		}
+
+		/** append a contiguous range of elements to the end of array:
+		 * one growth decision and one copy instead of per-element
+		 * push_back bookkeeping
+		 *
+		 * @param p pointer to the first element to append
+		 * @param len number of elements to append
+		 * @return if appending was successful
+		 */
+		inline bool append_range(const T* p, int32_t len)
+		{
+			m_array.insert(m_array.end(), p, p + len);
+			return true;
+		}
+
+		/** append the elements of an iterator range to the end of array
+		 *
+		 * @param begin_it start of the range
+		 * @param end_it end of the range (exclusive)
+		 * @return if appending was successful
+		 */
+		template <class InputIt>
+		inline bool append_range(InputIt begin_it, InputIt end_it)
+		{
+			m_array.insert(m_array.end(), begin_it, end_it);
 			return true;
 		}
 
@@ -346,7 +374,7 @@ template <class T> class DynamicArray :public SGObject
 		 * @param e element to append
 		 */
 		inline void push_back(T e)
-		{ m_array.push_back(e); }
+		{ m_array.push_back(std::move(e)); }
 
 		/** STD VECTOR compatible. Delete array element at the end
 		 *  of array.
@@ -225,7 +225,20 @@ class DynamicObjectArray : public SGObject
 		 */
 		inline bool append_element(std::shared_ptr<SGObject> e)
 		{
-			m_array.push_back(e);
+			m_array.push_back(std::move(e));
+			return true;
+		}
+
+		/** append a range of elements to the end of array in one go
+		 *
+		 * @param begin_it start of the range
+		 * @param end_it end of the range (exclusive)
+		 * @return if appending was successful
+		 */
+		template <class InputIt>
+		inline bool append_range(InputIt begin_it, InputIt end_it)
+		{
+			m_array.insert(m_array.end(), begin_it, end_it);
 			return true;
 		}
 
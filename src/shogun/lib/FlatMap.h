@@ -0,0 +1,305 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef _FLATMAP_H_
+#define _FLATMAP_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/Hash.h>
+#include <shogun/lib/Lock.h>
+#include <shogun/lib/common.h>
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace shogun
+{
+
+/** @brief Open-addressing hash map with robin-hood probing, the
+ * replacement for the chained @ref CMap in hot paths.
+ *
+ * All entries live in one contiguous array, so a lookup walks a short
+ * probe sequence in cache-resident memory instead of chasing a
+ * per-node allocation per chain link. Robin-hood displacement keeps
+ * probe lengths short and nearly uniform, and lookups can terminate as
+ * soon as they see an entry poorer than the probe distance.
+ *
+ * Keys must be trivially copyable, the same restriction CMap's
+ * byte-wise MurmurHash imposes. The map is unsynchronized by default;
+ * pass synchronized=true to serialize mutations and lookups through a
+ * lock when several threads share one map.
+ */
+template <class K, class T>
+class FlatMap
+{
+	static_assert(
+	    std::is_trivially_copyable<K>::value,
+	    "FlatMap keys are hashed byte-wise and must be trivially copyable");
+
+public:
+	/** map entry, exposed for iteration */
+	struct Entry
+	{
+		/** key */
+		K key;
+		/** value */
+		T data;
+	};
+
+	/** Custom constructor
+	 *
+	 * @param reserved number of elements to pre-allocate space for
+	 * @param synchronized serialize all operations through a lock
+	 */
+	explicit FlatMap(int32_t reserved = 16, bool synchronized = false)
+	    : m_synchronized(synchronized)
+	{
+		index_t capacity = MIN_CAPACITY;
+		while (capacity * MAX_LOAD_NUM < reserved * MAX_LOAD_DEN)
+			capacity *= 2;
+		m_entries.resize(capacity);
+		m_distances.assign(capacity, EMPTY);
+	}
+
+	/** Add an element; an existing element with the same key keeps its
+	 * data, matching CMap::add.
+	 *
+	 * @param key key to be added
+	 * @param data data to be added
+	 * @return true if the element was inserted
+	 */
+	bool add(const K& key, const T& data)
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		if (find_index(key) >= 0)
+			return false;
+		insert(key, data);
+		return true;
+	}
+
+	/** Add an element, overwriting the data of an existing key
+	 *
+	 * @param key key to be set
+	 * @param data data to be set
+	 */
+	void set(const K& key, const T& data)
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		index_t slot = find_index(key);
+		if (slot >= 0)
+			m_entries[slot].data = data;
+		else
+			insert(key, data);
+	}
+
+	/** Check for an element in the map
+	 *
+	 * @param key key to be looked for
+	 * @return true if the map contains the key
+	 */
+	bool contains(const K& key) const
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		return find_index(key) >= 0;
+	}
+
+	/** Get the data for a key
+	 *
+	 * @param key key to be looked for
+	 * @return the stored data; errors if the key is absent
+	 */
+	T get_element(const K& key) const
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		index_t slot = find_index(key);
+		require(slot >= 0, "Key not found in map");
+		return m_entries[slot].data;
+	}
+
+	/** Get the data for a key, inserting a default-constructed value
+	 * for absent keys
+	 *
+	 * @param key key to be looked for
+	 * @return reference to the stored data
+	 */
+	T& operator[](const K& key)
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		index_t slot = find_index(key);
+		if (slot < 0)
+			slot = insert(key, T());
+		return m_entries[slot].data;
+	}
+
+	/** Remove an element from the map
+	 *
+	 * @param key key to be removed
+	 * @return true if an element was removed
+	 */
+	bool remove(const K& key)
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		index_t slot = find_index(key);
+		if (slot < 0)
+			return false;
+
+		/* backward-shift deletion: pull successors one slot closer
+		 * instead of leaving tombstones that degrade probing */
+		index_t next = (slot + 1) & (capacity() - 1);
+		while (m_distances[next] > 0 && m_distances[next] != EMPTY)
+		{
+			m_entries[slot] = std::move(m_entries[next]);
+			m_distances[slot] = m_distances[next] - 1;
+			slot = next;
+			next = (next + 1) & (capacity() - 1);
+		}
+		m_distances[slot] = EMPTY;
+		m_num_elements--;
+		return true;
+	}
+
+	/** @return number of elements in the map */
+	int32_t get_num_elements() const
+	{
+		return m_num_elements;
+	}
+
+	/** Apply a functor to every entry, in unspecified order
+	 *
+	 * @param functor callable taking (const K&, T&)
+	 */
+	template <class Functor>
+	void for_each(Functor&& functor)
+	{
+		ScopedLock guard(m_lock, m_synchronized);
+		for (index_t i = 0; i < capacity(); i++)
+		{
+			if (m_distances[i] != EMPTY)
+				functor(
+				    const_cast<const K&>(m_entries[i].key),
+				    m_entries[i].data);
+		}
+	}
+
+private:
+	/** probe distance marking an empty slot */
+	static constexpr uint8_t EMPTY = 0xff;
+	static constexpr index_t MIN_CAPACITY = 16;
+	/** grow beyond 7/8 load */
+	static constexpr index_t MAX_LOAD_NUM = 7;
+	static constexpr index_t MAX_LOAD_DEN = 8;
+
+	/** lock guard that is a no-op for unsynchronized maps */
+	struct ScopedLock
+	{
+		ScopedLock(Lock& lock, bool enabled) : m_lock(lock), m_enabled(enabled)
+		{
+			if (m_enabled)
+				m_lock.lock();
+		}
+		~ScopedLock()
+		{
+			if (m_enabled)
+				m_lock.unlock();
+		}
+		Lock& m_lock;
+		bool m_enabled;
+	};
+
+	index_t capacity() const
+	{
+		return static_cast<index_t>(m_entries.size());
+	}
+
+	index_t home_slot(const K& key) const
+	{
+		uint32_t h = Hash::MurmurHash3(
+		    (uint8_t*)&key, sizeof(K), 0xDEADBEAF);
+		return h & (capacity() - 1);
+	}
+
+	/** @return slot of the key or -1 */
+	index_t find_index(const K& key) const
+	{
+		index_t slot = home_slot(key);
+		for (uint8_t dist = 0;; dist++)
+		{
+			/* an empty slot, or an entry closer to its home than we
+			 * are to ours, proves the key is absent */
+			if (m_distances[slot] == EMPTY || m_distances[slot] < dist)
+				return -1;
+			if (m_distances[slot] == dist &&
+			    !memcmp(&m_entries[slot].key, &key, sizeof(K)))
+				return slot;
+			slot = (slot + 1) & (capacity() - 1);
+		}
+	}
+
+	/** insert a key known to be absent, @return its final slot */
+	index_t insert(K key, T data)
+	{
+		if ((m_num_elements + 1) * MAX_LOAD_DEN > capacity() * MAX_LOAD_NUM)
+			grow();
+
+		index_t slot = home_slot(key);
+		uint8_t dist = 0;
+		index_t result = -1;
+		while (m_distances[slot] != EMPTY)
+		{
+			/* robin hood: displace richer entries so probe lengths
+			 * stay uniform */
+			if (m_distances[slot] < dist)
+			{
+				std::swap(key, m_entries[slot].key);
+				std::swap(data, m_entries[slot].data);
+				std::swap(dist, m_distances[slot]);
+				if (result < 0)
+					result = slot;
+			}
+			slot = (slot + 1) & (capacity() - 1);
+			dist++;
+			require(
+			    dist < EMPTY, "Probe sequence too long, hash quality "
+			                  "degenerated");
+		}
+		m_entries[slot] = {key, data};
+		m_distances[slot] = dist;
+		m_num_elements++;
+		return result < 0 ? slot : result;
+	}
+
+	void grow()
+	{
+		std::vector<Entry> old_entries(capacity() * 2);
+		std::vector<uint8_t> old_distances(capacity() * 2, EMPTY);
+		old_entries.swap(m_entries);
+		old_distances.swap(m_distances);
+		m_num_elements = 0;
+
+		for (size_t i = 0; i < old_entries.size(); i++)
+		{
+			if (old_distances[i] != EMPTY)
+				insert(old_entries[i].key, old_entries[i].data);
+		}
+	}
+
+	/** entry storage, one contiguous allocation */
+	std::vector<Entry> m_entries;
+	/** per-slot probe distance, EMPTY for free slots */
+	std::vector<uint8_t> m_distances;
+	/** number of elements */
+	int32_t m_num_elements = 0;
+	/** whether operations take the lock */
+	bool m_synchronized;
+	/** lock for synchronized maps */
+	mutable Lock m_lock;
+};
+
+}
+
+#endif /* _FLATMAP_H_ */
@@ -29,12 +29,20 @@ public:
 	}
 
 	/** Decrease reference count
+	 *
+	 * The decrement only needs release order; the acquire fence on the
+	 * final decrement makes all writes of other owners visible to the
+	 * thread that will free the data, without imposing acquire cost on
+	 * every non-final unref.
 	 *
 	 * @return the new reference count
 	 */
 	SG_FORCED_INLINE int32_t unref()
 	{
-		return rc.fetch_sub(1, std::memory_order_acquire)-1;
+		int32_t c = rc.fetch_sub(1, std::memory_order_release)-1;
+		if (c <= 0)
+			std::atomic_thread_fence(std::memory_order_acquire);
+		return c;
 	}
 
 	/** Get the reference count
@@ -145,7 +145,9 @@ SGMatrix<T>::SGMatrix(const std::initializer_list<std::initializer_list<T>>& lis
 	num_cols(list.size()),
 	gpu_ptr(nullptr)
 {
-	matrix = SG_CALLOC(T, ((int64_t) num_rows)*num_cols);
+	matrix = SG_ALIGNED_MALLOC(
+	    T, ((int64_t)num_rows) * num_cols, alignment::container_alignment);
+	memset(matrix, 0, ((int64_t)num_rows) * num_cols * sizeof(T));
 #ifdef HAVE_VIENNACL
 	m_on_gpu.store(false, std::memory_order_release);
 #endif
@@ -437,6 +439,13 @@ SGMatrix<T> SGMatrix<T>::slice(index_t col_start, index_t col_end) const
 		get_column_vector(col_start), num_rows, col_end - col_start, false);
 }
 
+template <class T>
+SGMatrix<T> SGMatrix<T>::view() const
+{
+	assert_on_cpu();
+	return SGMatrix<T>(matrix, num_rows, num_cols, false);
+}
+
 template <class T>
 SGVector<T> SGMatrix<T>::get_column(index_t col) const
 {
@@ -182,6 +182,15 @@ template<class T> class SGMatrix : public SGReferencedData
 		 */
 		SGMatrix<T> slice(index_t col_start, index_t col_end) const;
 
+		/** Borrowed view of the whole matrix: aliases this matrix'
+		 * memory without touching the reference count, so copying and
+		 * destroying the view costs no atomic operations.
+		 * \warning The returned SGMatrix is non-owning and must not
+		 * outlive this matrix!
+		 * @return non-owning matrix aliasing the same memory
+		 */
+		SGMatrix<T> view() const;
+
 		/** Map a column to a SGVector
 		 * \warning The returned SGVector is non-owning!
 		 * @param col column index
@@ -52,7 +52,21 @@ void BM_SGMatrix_inverse(benchmark::State& state)
 	}
 }
 
+void BM_SGMatrix_allocation(benchmark::State& state)
+{
+	/* allocation churn of small matrices; storage is 64-byte aligned */
+	for (auto _ : state)
+	{
+		for (index_t i = 0; i < 256; ++i)
+		{
+			SGMatrix<float64_t> mat(state.range(0), state.range(0));
+			benchmark::DoNotOptimize(mat.matrix);
+		}
+	}
+}
+
 BENCHMARK(BM_SGMatrix_eigenvectors)->Range(8, 2048);
 BENCHMARK(BM_SGMatrix_inverse)->Range(8, 2048);
+BENCHMARK(BM_SGMatrix_allocation)->Range(8, 128);
 
 }
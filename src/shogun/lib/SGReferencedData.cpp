@@ -2,6 +2,10 @@
 #include <shogun/lib/RefCount.h>
 #include <shogun/io/SGIO.h>
 
+#ifdef USE_ALLOC_TRACKING
+#include <shogun/lib/AllocationTracker.h>
+#endif
+
 #include <utility>
 
 using namespace shogun;
@@ -20,6 +24,9 @@ SGReferencedData::SGReferencedData(bool ref_counting) : m_refcount(NULL)
 
 SGReferencedData::SGReferencedData(const SGReferencedData &orig)
 {
+#ifdef USE_ALLOC_TRACKING
+	AllocationTracker::record_copy();
+#endif
 	copy_refcount(orig);
 	ref();
 }
@@ -33,6 +40,9 @@ SGReferencedData& SGReferencedData::operator= (const SGReferencedData &orig)
 	if (this == &orig)
 		return *this;
 
+#ifdef USE_ALLOC_TRACKING
+	AllocationTracker::record_copy();
+#endif
 	unref();
 	copy_data(orig);
 	copy_refcount(orig);
@@ -75,6 +85,12 @@ int32_t SGReferencedData::ref()
 
 	int32_t c = m_refcount->ref();
 
+#ifdef USE_ALLOC_TRACKING
+	// the counter was already owned by someone else, so this ref
+	// touched a potentially contended cache line
+	if (c > 1)
+		AllocationTracker::record_shared_ref();
+#endif
 	SG_TRACE("ref() refcount {} data {} increased", c, fmt::ptr(this));
 	return c;
 }
@@ -88,6 +88,34 @@ const SGVector<float64_t> SGSparseMatrix<float64_t>::operator*(
 	return result;
 }
 
+template <class T>
+const SGMatrix<T> SGSparseMatrix<T>::operator*(SGMatrix<T> m) const
+{
+	require(m.num_rows==num_features,
+		"Dimension mismatch! {} vs {}",
+		m.num_rows, num_features);
+	SGMatrix<T> result(num_vectors, m.num_cols);
+
+	// each thread owns a contiguous range of result rows; the entries of a
+	// sparse row are traversed once per dense column, so both the dense
+	// operand and the result are walked column by column
+	#pragma omp parallel for
+	for (index_t i=0; i<num_vectors; ++i)
+	{
+		const SGSparseVector<T>& row=sparse_matrix[i];
+		for (index_t c=0; c<m.num_cols; ++c)
+		{
+			const T* dense_col=m.matrix+int64_t(c)*m.num_rows;
+			T acc=0;
+			for (index_t k=0; k<row.num_feat_entries; ++k)
+				acc+=row.features[k].entry*dense_col[row.features[k].feat_index];
+			result(i, c)=acc;
+		}
+	}
+
+	return result;
+}
+
 template<class T>
 void SGSparseMatrix<T>::load(const std::shared_ptr<File>& loader)
 {
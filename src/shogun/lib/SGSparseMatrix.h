@@ -95,6 +95,18 @@ template <class T> class SGSparseMatrix : public SGReferencedData
 		 */
 		template<class ST> const SGVector<T> operator*(SGVector<ST> v) const;
 
+		/** compute sparse-matrix dense-matrix multiplication
+		 *
+		 * The rows of the result are partitioned across threads and the
+		 * entries of each sparse row are traversed once per dense column,
+		 * walking the dense columns contiguously
+		 *
+		 * @param m the dense matrix to be multiplied with, one row per
+		 * feature dimension
+		 * @return the result matrix \f$Q*M\f$, Q being this sparse matrix
+		 */
+		const SGMatrix<T> operator*(SGMatrix<T> m) const;
+
 		/** operator overload for sparse-matrix read only access
 		 * @param i_row
 		 * @param i_col
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <limits>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/lapack.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
@@ -328,7 +329,15 @@ template<class T>
 void SGVector<T>::resize_vector(int32_t n)
 {
 	assert_on_cpu();
-	vector=SG_REALLOC(T, vector, vlen, n);
+
+	// SG_REALLOC would drop the alignment of the storage, so grow by hand
+	T* resized=SG_ALIGNED_MALLOC(T, n, alignment::container_alignment);
+	if (vector)
+	{
+		sg_memcpy(resized, vector, (n<vlen ? n : vlen)*sizeof(T));
+		SG_FREE(vector);
+	}
+	vector=resized;
 
 	if (n > vlen)
 		memset(&vector[vlen], 0, (n-vlen)*sizeof(T));
@@ -344,6 +353,13 @@ SGVector<T> SGVector<T>::slice(index_t l, index_t h) const
 	return SGVector<T>(vector, h - l, l);
 }
 
+template <class T>
+SGVector<T> SGVector<T>::view() const
+{
+	assert_on_cpu();
+	return SGVector<T>(vector, vlen, false);
+}
+
 template<class T>
 void SGVector<T>::add(const T x)
 {
@@ -628,11 +644,9 @@ uint64_t SGVector<uint64_t>::twonorm(const uint64_t* x, int32_t len)
 template <>
 float32_t SGVector<float32_t>::twonorm(const float32_t* x, int32_t len)
 {
-	float64_t result=0;
-	for (int32_t i=0; i<len; i++)
-		result+=x[i]*x[i];
-
-	return std::sqrt(result);
+	// vectorized squared norm, accumulated in float64 as before
+	Eigen::Map<const Eigen::VectorXf> map_x(x, len);
+	return std::sqrt(map_x.cast<float64_t>().squaredNorm());
 }
 
 template <>
@@ -676,6 +690,13 @@ float64_t SGVector<T>::onenorm(T* x, int32_t len)
 	return result;
 }
 
+template <>
+float64_t SGVector<float64_t>::onenorm(float64_t* x, int32_t len)
+{
+	Eigen::Map<const Eigen::VectorXd> map_x(x, len);
+	return map_x.cwiseAbs().sum();
+}
+
 /// || x ||_q^q
 template <class T>
 T SGVector<T>::qsq(T* x, int32_t len, float64_t q)
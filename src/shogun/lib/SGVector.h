@@ -288,6 +288,15 @@ template<class T> class SGVector : public SGReferencedData
 		 */
 		SGVector<T> slice(index_t l, index_t h) const;
 
+		/** Borrowed view of the whole vector: aliases this vector's
+		 * memory without touching the reference count, so copying and
+		 * destroying the view costs no atomic operations.
+		 * \warning The returned SGVector is non-owning and must not
+		 * outlive this vector!
+		 * @return non-owning vector aliasing the same memory
+		 */
+		SGVector<T> view() const;
+
 		/** Operator overload for vector read only access
 		 *
 		 * @param index dimension to access
@@ -23,6 +23,38 @@ void BM_SGVector_calculation(benchmark::State& state)
 	}
 }
 
+void BM_SGVector_allocation(benchmark::State& state)
+{
+	/* allocation churn of many tiny vectors, as in tree training */
+	for (auto _ : state)
+	{
+		for (index_t i = 0; i < 1024; ++i)
+		{
+			SGVector<float64_t> a(state.range(0));
+			benchmark::DoNotOptimize(a.vector);
+		}
+	}
+}
+
+void BM_SGVector_aligned_traversal(benchmark::State& state)
+{
+	/* with 64-byte aligned storage the compiler can issue aligned SIMD
+	 * loads over the whole range */
+	SGVector<float64_t> a(state.range(0)), b(state.range(0));
+	a.random(0.0, 1.0);
+	b.random(0.0, 1.0);
+
+	for (auto _ : state)
+	{
+		float64_t sum = 0;
+		for (index_t i = 0; i < a.size(); ++i)
+			sum += a[i] * b[i];
+		benchmark::DoNotOptimize(sum);
+	}
+}
+
 BENCHMARK(BM_SGVector_calculation)->Range(8, 2048);
+BENCHMARK(BM_SGVector_allocation)->Range(8, 256);
+BENCHMARK(BM_SGVector_aligned_traversal)->Range(64, 65536);
 
 }
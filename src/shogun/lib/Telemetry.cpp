@@ -0,0 +1,125 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/lib/Telemetry.h>
+
+#include <atomic>
+
+using namespace shogun;
+
+namespace
+{
+	constexpr auto NUM_TAGS =
+	    static_cast<size_t>(TelemetryTag::NUM_TAGS);
+
+	/** Single-writer ring owned by one emitting thread. Only head and the
+	 * counters are ever touched by other threads, both with relaxed or
+	 * acquire loads; the slots themselves are validated against head after
+	 * reading so a concurrent overwrite is detected and the record dropped.
+	 */
+	struct ThreadRing
+	{
+		/** next sequence number; stored with release order after the slot
+		 * is filled so the drainer sees complete records */
+		std::atomic<uint64_t> head{0};
+		/** drain cursor, owned by the draining thread */
+		uint64_t tail = 0;
+		/** per-tag event totals; single writer, so plain load/store pairs
+		 * with relaxed order avoid the locked read-modify-write */
+		std::atomic<uint64_t> counters[NUM_TAGS] = {};
+		/** record storage */
+		TelemetryRecord slots[TelemetryChannel::RING_CAPACITY];
+		/** intrusive registration list */
+		ThreadRing* next = nullptr;
+	};
+
+	/* Rings are pushed once per thread and never removed: a ring outliving
+	 * its thread only costs its fixed footprint and lets drain() walk the
+	 * list without coordinating with thread exit. */
+	std::atomic<ThreadRing*> rings_head{nullptr};
+
+	ThreadRing* local_ring()
+	{
+		thread_local ThreadRing* ring = []() {
+			auto* r = new ThreadRing();
+			r->next = rings_head.load(std::memory_order_relaxed);
+			while (!rings_head.compare_exchange_weak(
+			    r->next, r, std::memory_order_release,
+			    std::memory_order_relaxed))
+				;
+			return r;
+		}();
+		return ring;
+	}
+}
+
+void TelemetryChannel::emit(TelemetryTag tag, int64_t value)
+{
+	ThreadRing* ring = local_ring();
+	const uint64_t seq = ring->head.load(std::memory_order_relaxed);
+	TelemetryRecord& slot = ring->slots[seq & (RING_CAPACITY - 1)];
+	slot.sequence = seq;
+	slot.value = value;
+	slot.tag = tag;
+
+	auto& counter = ring->counters[static_cast<size_t>(tag)];
+	counter.store(
+	    counter.load(std::memory_order_relaxed) + 1,
+	    std::memory_order_relaxed);
+
+	ring->head.store(seq + 1, std::memory_order_release);
+}
+
+uint64_t TelemetryChannel::total(TelemetryTag tag)
+{
+	uint64_t sum = 0;
+	for (ThreadRing* ring = rings_head.load(std::memory_order_acquire);
+	     ring; ring = ring->next)
+		sum += ring->counters[static_cast<size_t>(tag)].load(
+		    std::memory_order_relaxed);
+	return sum;
+}
+
+uint64_t TelemetryChannel::drain(
+    const std::function<void(const TelemetryRecord&)>& sink)
+{
+	uint64_t delivered = 0;
+	for (ThreadRing* ring = rings_head.load(std::memory_order_acquire);
+	     ring; ring = ring->next)
+	{
+		const uint64_t head = ring->head.load(std::memory_order_acquire);
+		uint64_t seq = ring->tail;
+		/* the slot of seq is rewritten before head advances to
+		 * seq+RING_CAPACITY, so a lag of RING_CAPACITY already means
+		 * the slot may be mid-overwrite */
+		if (head - seq >= RING_CAPACITY)
+			seq = head - RING_CAPACITY + 1;
+
+		for (; seq < head; seq++)
+		{
+			TelemetryRecord record =
+			    ring->slots[seq & (RING_CAPACITY - 1)];
+			/* the writer may have lapped us while we copied the slot;
+			 * a reloaded head tells us whether the copy was torn */
+			if (ring->head.load(std::memory_order_acquire) - seq >=
+			    RING_CAPACITY)
+				continue;
+			sink(record);
+			delivered++;
+		}
+		ring->tail = head;
+	}
+	return delivered;
+}
+
+void TelemetryChannel::reset()
+{
+	for (ThreadRing* ring = rings_head.load(std::memory_order_acquire);
+	     ring; ring = ring->next)
+	{
+		ring->tail = ring->head.load(std::memory_order_acquire);
+		for (size_t tag = 0; tag < NUM_TAGS; tag++)
+			ring->counters[tag].store(0, std::memory_order_relaxed);
+	}
+}
@@ -0,0 +1,119 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+
+#include <functional>
+
+namespace shogun
+{
+	/** Typed events the training hot paths may emit. Adding a tag is
+	 * backwards compatible as long as NUM_TAGS stays last.
+	 */
+	enum class TelemetryTag : uint8_t
+	{
+		/** one iteration of an iterative training loop */
+		TRAIN_ITERATION = 0,
+		/** one full pass over the training data */
+		TRAIN_PASS,
+		/** one stochastic gradient update */
+		GRADIENT_STEP,
+		/** training loop reported convergence; value is the iteration */
+		CONVERGED,
+		/** a full cost/objective evaluation */
+		COST_EVALUATION,
+		/** number of tags, keep last */
+		NUM_TAGS
+	};
+
+	/** One fixed-size telemetry record. No wall-clock time is captured on
+	 * the emitting thread; the per-thread sequence number orders records
+	 * and the drainer may attach its own timestamps at sampling frequency.
+	 */
+	struct TelemetryRecord
+	{
+		/** per-thread monotonic sequence number */
+		uint64_t sequence;
+		/** event payload, e.g. iteration index or sample count */
+		int64_t value;
+		/** event type */
+		TelemetryTag tag;
+	};
+
+	/** @brief Lock-free telemetry channel for training hot paths.
+	 *
+	 * Unlike @ref ProgressPrinter and the SGIO logging macros, which format
+	 * strings and serialize through stdio on every call, emit() writes one
+	 * fixed-size record into a per-thread ring buffer: a handful of plain
+	 * stores and one release store of the sequence counter, no locks, no
+	 * allocation, no time lookup. A monitoring thread samples the rings via
+	 * drain() at whatever frequency it likes; records that are overwritten
+	 * between drains are dropped (the per-tag counters remain exact), which
+	 * is the intended behavior for sampled telemetry.
+	 *
+	 * Call sites should go through the SG_TELEMETRY() macro, which compiles
+	 * to nothing unless the library is configured with USE_TELEMETRY, so
+	 * instrumented loops pay zero cost in default builds.
+	 *
+	 * Rings are registered on first emit from a thread and stay allocated
+	 * for the lifetime of the process so drain() never races thread exit.
+	 */
+	class TelemetryChannel
+	{
+	public:
+		/** Ring capacity per thread, must be a power of two */
+		static constexpr uint64_t RING_CAPACITY = 1024;
+
+		/** Record one event from the calling thread.
+		 *
+		 * Wait-free: never blocks the emitting thread, the oldest
+		 * undrained record is overwritten when the ring is full.
+		 *
+		 * @param tag event type
+		 * @param value event payload
+		 */
+		static void emit(TelemetryTag tag, int64_t value);
+
+		/** Total number of events of the given type emitted so far,
+		 * summed over all threads. Exact even when records are dropped.
+		 *
+		 * @param tag event type
+		 * @return number of events emitted
+		 */
+		static uint64_t total(TelemetryTag tag);
+
+		/** Drain undrained records from all per-thread rings into the
+		 * given sink. Intended to be called from a single monitoring
+		 * thread; records overwritten since the previous drain are
+		 * skipped.
+		 *
+		 * @param sink callback invoked once per record
+		 * @return number of records delivered to the sink
+		 */
+		static uint64_t
+		drain(const std::function<void(const TelemetryRecord&)>& sink);
+
+		/** Discard all undrained records and zero the per-tag totals.
+		 * Only safe while no thread is emitting; meant for tests.
+		 */
+		static void reset();
+	};
+
+/** Emit a telemetry event. Compiles to nothing unless the library was
+ * configured with -DUSE_TELEMETRY=ON, so hot loops can be instrumented
+ * unconditionally.
+ */
+#ifdef USE_TELEMETRY
+#define SG_TELEMETRY(tag, value)                                               \
+	shogun::TelemetryChannel::emit(shogun::TelemetryTag::tag, (value))
+#else
+#define SG_TELEMETRY(tag, value) ((void)0)
+#endif
+}
+#endif /* __TELEMETRY_H__ */
@@ -200,6 +200,17 @@ namespace shogun
 		virtual void exit_std_vector(size_t* size) = 0;
 		virtual void exit_map(size_t* size) = 0;
 
+		/** Bulk hook for contiguous buffers of primitive type. Visitors that
+		 * can consume or produce such a buffer in a single call override this
+		 * and return true; the default returns false, in which case the
+		 * buffer is visited element-wise as before.
+		 */
+		virtual bool on_buffer(
+		    void* buffer, int64_t num_elements, size_t element_size)
+		{
+			return false;
+		}
+
 		template <typename T>
 		void on(std::atomic<T>* val)
 		{
@@ -244,6 +255,14 @@ namespace shogun
 			enter_vector(std::addressof(size));
 			if (size != _v->vlen)
 				_v->resize_vector(size);
+			if constexpr (std::is_arithmetic<T>::value)
+			{
+				if (size && on_buffer(_v->vector, size, sizeof(T)))
+				{
+					exit_vector(std::addressof(size));
+					return;
+				}
+			}
 			for (auto&& _value : *_v)
 				on(std::addressof(_value));
 			exit_vector(std::addressof(size));
@@ -323,6 +342,15 @@ namespace shogun
 			enter_matrix(std::addressof(rows), std::addressof(cols));
 			if ((rows != _matrix->num_rows) || (cols != _matrix->num_cols))
 				*_matrix = SGMatrix<T>(rows, cols);
+			if constexpr (std::is_arithmetic<T>::value)
+			{
+				int64_t length = ((int64_t)rows) * cols;
+				if (length && on_buffer(_matrix->matrix, length, sizeof(T)))
+				{
+					exit_matrix(std::addressof(rows), std::addressof(cols));
+					return;
+				}
+			}
 			for (auto index = 0; index < cols; index++)
 			{
 				on_matrix_row(
@@ -1185,6 +1213,29 @@ namespace shogun
 			}
 		}
 
+		/** Returns a typed pointer to the underlying value. Fails if the
+		 * type does not match or the value is functional. The pointer
+		 * stays valid as long as this Any keeps its storage, so it can be
+		 * resolved once and dereferenced repeatedly without re-checking
+		 * the type.
+		 * @return typed pointer to the value
+		 */
+		template <typename T>
+		T* pointer()
+		{
+			if (!has_type<T>())
+			{
+				throw TypeMismatchException(
+				    demangled_type<T>(), policy->type());
+			}
+			if (policy->is_functional())
+			{
+				throw std::logic_error{
+				    "Functional Any has no addressable value"};
+			}
+			return static_cast<T*>(storage);
+		}
+
 		/** @return true if type is same. */
 		template <typename T>
 		inline bool has_type() const
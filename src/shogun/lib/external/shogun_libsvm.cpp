@@ -232,22 +232,40 @@ public:
 
 	void compute_Q_parallel(Qfloat* data, float64_t* lab, int32_t i, int32_t start, int32_t len) const
 	{
+		// resolve the persistent row once; the parallel loop then only
+		// touches disjoint entries of it
+		float32_t* row = rowstore ? rowstore->row(orig_idx[x[i]->index]) : NULL;
+
 		if (lab) // two class
 		{
 			#pragma omp parallel for
 			for(int32_t j=start;j<len;j++)
-				data[j] = (Qfloat) lab[i]*lab[j]*this->kernel_function(i,j);
+				data[j] = (Qfloat) lab[i]*lab[j]*this->kernel_row_function(i,j,row);
 		}
 		else // one class, eps svr
 		{
 			#pragma omp parallel for
 			for(int32_t j=start;j<len;j++)
-				data[j] = (Qfloat) this->kernel_function(i,j);
+				data[j] = (Qfloat) this->kernel_row_function(i,j,row);
 		}
 	}
 
+	inline float64_t kernel_row_function(int32_t i, int32_t j, float32_t* row) const
+	{
+		if (row)
+		{
+			float32_t& entry = row[orig_idx[x[j]->index]];
+			if (entry != entry) // NaN marks a not yet computed entry
+				entry = (float32_t) kernel->kernel(x[i]->index,x[j]->index);
+			return entry;
+		}
+		return kernel->kernel(x[i]->index,x[j]->index);
+	}
+
 	inline float64_t kernel_function(int32_t i, int32_t j) const
 	{
+		if (rowstore)
+			return kernel_row_function(i, j, rowstore->row(orig_idx[x[i]->index]));
 		return kernel->kernel(x[i]->index,x[j]->index);
 	}
 
@@ -255,6 +273,8 @@ private:
 	Kernel* kernel;
 	const svm_node **x;
 	float64_t *x_square;
+	svm_kernel_rowstore* rowstore;
+	const int32_t* orig_idx;
 };
 
 LibSVMKernel::LibSVMKernel(int32_t l, svm_node * const * x_, const svm_parameter& param)
@@ -263,6 +283,8 @@ LibSVMKernel::LibSVMKernel(int32_t l, svm_node * const * x_, const svm_parameter
 	x_square = 0;
 	kernel=param.kernel;
 	max_train_time=param.max_train_time;
+	rowstore=param.orig_idx ? param.rowstore : NULL;
+	orig_idx=param.orig_idx;
 }
 
 LibSVMKernel::~LibSVMKernel()
@@ -1844,6 +1866,33 @@ static void solve_c_svc(
 		if(prob->y[i] > 0) y[i] = +1; else y[i]=-1;
 	}
 
+	if (prob->init_alpha)
+	{
+		// warm start from a previous (similar) solution: clip the seed to
+		// the box and restore the equality constraint y^T alpha = 0 by
+		// scaling down the heavier side; the solver only needs kernel rows
+		// for the seeded examples to initialize its gradient
+		float64_t sum_pos=0;
+		float64_t sum_neg=0;
+		for(i=0;i<l;i++)
+		{
+			float64_t a = y[i]*prob->init_alpha[i];
+			alpha[i] = Math::min(Math::max(a, 0.0), (y[i]>0) ? Cp : Cn);
+			if (y[i]>0)
+				sum_pos += alpha[i];
+			else
+				sum_neg += alpha[i];
+		}
+		float64_t target = Math::min(sum_pos, sum_neg);
+		for(i=0;i<l;i++)
+		{
+			if (y[i]>0 && sum_pos>target)
+				alpha[i] *= target/sum_pos;
+			else if (y[i]<0 && sum_neg>target)
+				alpha[i] *= target/sum_neg;
+		}
+	}
+
 	Solver s;
 	s.Solve(l, SVC_Q(*prob,*param,y), prob->pv, y,
 		alpha, Cp, Cn, param->eps, si, param->shrinking, param->use_bias);
@@ -2357,6 +2406,10 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 		float64_t *pv = SG_MALLOC(float64_t,l);
 
 
+		float64_t *ia = NULL;
+		if (prob->init_alpha)
+			ia = SG_MALLOC(float64_t, l);
+
 		int32_t i;
 		for(i=0;i<l;i++) {
 			x[i] = prob->x[perm[i]];
@@ -2372,6 +2425,9 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 	pv[i] = -1.0;
             }
 
+            if (ia)
+	ia[i] = prob->init_alpha[perm[i]];
+
 		}
 
 
@@ -2411,6 +2467,19 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 				sub_prob.C = SG_MALLOC(float64_t,sub_prob.l+1);
 				sub_prob.pv = SG_MALLOC(float64_t,sub_prob.l+1);
 
+				if (ia)
+				{
+					// re-sign the label-signed seeds to the +1/-1
+					// convention of this sub-problem
+					sub_prob.init_alpha = SG_MALLOC(float64_t, sub_prob.l);
+					float64_t si_sign = (label[i] > 0) ? 1.0 : -1.0;
+					float64_t sj_sign = (label[j] > 0) ? 1.0 : -1.0;
+					for(int32_t k=0;k<ci;k++)
+						sub_prob.init_alpha[k] = si_sign*ia[si+k];
+					for(int32_t k=0;k<cj;k++)
+						sub_prob.init_alpha[ci+k] = -sj_sign*ia[sj+k];
+				}
+
 				int32_t k;
 				for(k=0;k<ci;k++)
 				{
@@ -2442,6 +2511,7 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 				SG_FREE(sub_prob.y);
 				SG_FREE(sub_prob.C);
 				SG_FREE(sub_prob.pv);
+				SG_FREE(sub_prob.init_alpha);
 				++p;
 			}
 
@@ -2523,6 +2593,7 @@ svm_model *svm_train(const svm_problem *prob, const svm_parameter *param)
 		SG_FREE(x);
 		SG_FREE(C);
 		SG_FREE(pv);
+		SG_FREE(ia);
 		SG_FREE(weighted_C);
 		SG_FREE(nonzero);
 		for(i=0;i<nr_class*(nr_class-1)/2;i++)
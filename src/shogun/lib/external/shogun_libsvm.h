@@ -42,6 +42,11 @@
 
 #include <shogun/kernel/Kernel.h>
 
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace shogun
 {
 /** SVM node */
@@ -51,6 +56,59 @@ struct svm_node
 	int32_t index;
 };
 
+/** Persistent store of kernel rows that can be shared across consecutive
+ * svm_train calls, e.g. cross-validation folds over subsets of one dataset.
+ * Rows are keyed on indices into the full dataset underneath any active
+ * subsets, so folds that revisit the same examples reuse the entries that
+ * earlier folds already computed. Entries not computed yet hold NaN. The
+ * store must be reset whenever the underlying features or the kernel
+ * parameters change. */
+struct svm_kernel_rowstore
+{
+	svm_kernel_rowstore() : num_total(0), max_rows(0)
+	{
+	}
+
+	/** make full-dataset indices up to num-1 addressable and derive the
+	 * row budget from the cache size in MB */
+	void ensure_size(int32_t num, float64_t cache_mb)
+	{
+		std::lock_guard<std::mutex> lock(lck);
+		if (num>num_total)
+		{
+			for (auto& r : rows)
+				r.second.resize(num, std::numeric_limits<float32_t>::quiet_NaN());
+			num_total=num;
+		}
+		max_rows=(int32_t) Math::max(1.0,
+			cache_mb*(1l<<20)/(num_total*sizeof(float32_t)));
+	}
+
+	/** row for full-dataset index i, created on demand; NULL once the row
+	 * budget is exhausted */
+	float32_t* row(int32_t i)
+	{
+		std::lock_guard<std::mutex> lock(lck);
+		auto it=rows.find(i);
+		if (it!=rows.end())
+			return it->second.data();
+		if ((int32_t) rows.size()>=max_rows)
+			return NULL;
+		auto& r=rows[i];
+		r.assign(num_total, std::numeric_limits<float32_t>::quiet_NaN());
+		return r.data();
+	}
+
+	/** cached rows, full-dataset row index -> row over the full dataset */
+	std::unordered_map<int32_t, std::vector<float32_t>> rows;
+	/** number of vectors in the full dataset */
+	int32_t num_total;
+	/** maximal number of rows kept */
+	int32_t max_rows;
+	/** guards row creation; entries themselves are written lock-free */
+	std::mutex lck;
+};
+
 /** SVM problem */
 struct svm_problem
 {
@@ -64,6 +122,7 @@ public:
 		x = NULL;
 		C = NULL;
 		pv = NULL;
+		init_alpha = NULL;
 	}
 
 
@@ -77,6 +136,10 @@ public:
     float64_t *C;
     /** precomputed p */
 	float64_t *pv;
+	/** optional warm-start alphas, signed by the example's label; the seed
+	 * is clipped to the box constraints and projected back onto the
+	 * equality constraint before solving (C-SVC only) */
+	float64_t *init_alpha;
 
 };
 
@@ -124,6 +187,11 @@ struct svm_parameter
 	int32_t shrinking;
 	/** compute bias */
 	bool use_bias;
+	/** optional kernel row store shared across train calls */
+	struct svm_kernel_rowstore* rowstore = NULL;
+	/** maps training example index -> full-dataset index, required when
+	 * rowstore is set */
+	int32_t* orig_idx = NULL;
 };
 
 /** svm_model */
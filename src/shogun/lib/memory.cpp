@@ -12,6 +12,15 @@
 #include <shogun/lib/config.h>
 #include <shogun/lib/exception/ShogunException.h>
 
+#ifdef USE_ALLOC_TRACKING
+#include <shogun/lib/AllocationTracker.h>
+#define SG_TRACK_ALLOC(ptr, size) AllocationTracker::record_alloc(ptr, size)
+#define SG_TRACK_FREE(ptr) AllocationTracker::record_free(ptr)
+#else
+#define SG_TRACK_ALLOC(ptr, size)
+#define SG_TRACK_FREE(ptr)
+#endif
+
 #include <string.h>
 #include <stdio.h>
 #include <cstdlib>
@@ -121,6 +130,7 @@ void* sg_malloc(size_t size)
 	if (!p)
 		allocation_error(p, size, "malloc");
 
+	SG_TRACK_ALLOC(p, size);
 	return p;
 }
 
@@ -155,6 +165,7 @@ void* sg_aligned_malloc(size_t size, size_t al)
 	if (!p)
 		allocation_error(p, size, "aligned_malloc");
 
+	SG_TRACK_ALLOC(p, size);
 	return p;
 }
 #endif // HAVE_ALIGNED_MALLOC
@@ -171,11 +182,13 @@ void* sg_calloc(size_t num, size_t size)
 
 	if (!p)
 		allocation_error(p, size, "calloc");
+	SG_TRACK_ALLOC(p, num * size);
 	return p;
 }
 
 void  sg_free(void* ptr)
 {
+	SG_TRACK_FREE(ptr);
 #if defined(USE_JEMALLOC)
 	je_free(ptr);
 #elif defined(USE_TCMALLOC)
@@ -198,6 +211,8 @@ void* sg_realloc(void* ptr, size_t size)
 	if (!p && (size || !ptr))
 		allocation_error(p, size, "realloc");
 
+	SG_TRACK_FREE(ptr);
+	SG_TRACK_ALLOC(p, size);
 	return p;
 }
 }
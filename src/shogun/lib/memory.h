@@ -140,7 +140,9 @@ T* sg_aligned_malloc(size_t len, size_t al)
 
 namespace alignment
 {
-	static constexpr index_t container_alignment = 16;
+	/** cache line sized so container storage supports aligned loads of the
+	 * widest SIMD registers and never straddles a line at the start */
+	static constexpr index_t container_alignment = 64;
 }
 
 void* get_copy(void* src, size_t len);
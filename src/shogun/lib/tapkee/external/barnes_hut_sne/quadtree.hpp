@@ -72,9 +72,6 @@ class QuadTree
 	static const int QT_NO_DIMS = 2;
 	static const int QT_NODE_CAPACITY = 1;
 
-	// A buffer we use when doing force computations
-	ScalarType buff[QT_NO_DIMS];
-
 	// Properties of this node in the tree
 	QuadTree* parent;
 	bool is_leaf;
@@ -315,6 +312,8 @@ public:
 	}
 
 	// Compute non-edge forces using Barnes-Hut algorithm
+	// NOTE: uses a local buffer only, so concurrent calls for different
+	// points on the same (read-only) tree are safe
 	void computeNonEdgeForces(int point_index, ScalarType theta, ScalarType neg_f[], ScalarType* sum_Q)
 	{
 
@@ -322,6 +321,7 @@ public:
 		if(cum_size == 0 || (is_leaf && size == 1 && index[0] == point_index)) return;
 
 		// Compute distance between point and center-of-mass
+		ScalarType buff[QT_NO_DIMS];
 		ScalarType D = .0;
 		int ind = point_index * QT_NO_DIMS;
 		for(int d = 0; d < QT_NO_DIMS; d++) buff[d]  = data[ind + d];
@@ -350,16 +350,17 @@ public:
 	// Computes edge forces
 	void computeEdgeForces(int* row_P, int* col_P, ScalarType* val_P, int N, ScalarType* pos_f)
 	{
-		// Loop over all edges in the graph
-		int ind1, ind2;
-		ScalarType D;
+		// Loop over all edges in the graph; rows write disjoint slices of
+		// pos_f, so they can be processed in parallel
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
-			ind1 = n * QT_NO_DIMS;
+			ScalarType buff[QT_NO_DIMS];
+			int ind1 = n * QT_NO_DIMS;
 			for(int i = row_P[n]; i < row_P[n + 1]; i++) {
 
 				// Compute pairwise distance and Q-value
-				D = .0;
-				ind2 = col_P[i] * QT_NO_DIMS;
+				ScalarType D = .0;
+				int ind2 = col_P[i] * QT_NO_DIMS;
 				for(int d = 0; d < QT_NO_DIMS; d++) buff[d]  = data[ind1 + d];
 				for(int d = 0; d < QT_NO_DIMS; d++) buff[d] -= data[ind2 + d];
 				for(int d = 0; d < QT_NO_DIMS; d++) D += buff[d] * buff[d];
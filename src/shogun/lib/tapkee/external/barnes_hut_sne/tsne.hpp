@@ -276,6 +276,9 @@ private:
 		ScalarType* neg_f = (ScalarType*) calloc(N * D, sizeof(ScalarType));
 		if(pos_f == NULL || neg_f == NULL) { printf("Memory allocation failed!\n"); exit(1); }
 		tree->computeEdgeForces(inp_row_P, inp_col_P, inp_val_P, N, pos_f);
+		// the tree is read-only here and each point writes its own slice
+		// of neg_f, so the Barnes-Hut traversals run in parallel
+#pragma omp parallel for reduction(+:sum_Q)
 		for(int n = 0; n < N; n++) tree->computeNonEdgeForces(n, theta, neg_f + n * D, &sum_Q);
 
 		// Compute final t-SNE gradient
@@ -301,6 +304,7 @@ private:
 		ScalarType* Q    = (ScalarType*) malloc(N * N * sizeof(ScalarType));
 		if(Q == NULL) { printf("Memory allocation failed!\n"); exit(1); }
 		ScalarType sum_Q = .0;
+#pragma omp parallel for reduction(+:sum_Q)
 		for(int n = 0; n < N; n++) {
 			for(int m = 0; m < N; m++) {
 				if(n != m) {
@@ -310,7 +314,9 @@ private:
 			}
 		}
 
-		// Perform the computation of the gradient
+		// Perform the computation of the gradient; each row of dC is
+		// written by exactly one iteration
+#pragma omp parallel for
 		for(int n = 0; n < N; n++) {
 			for(int m = 0; m < N; m++) {
 				if(n != m) {
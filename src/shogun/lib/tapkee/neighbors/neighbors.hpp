@@ -125,9 +125,12 @@ Neighbors find_neighbors_bruteforce_impl(const RandomAccessIterator& begin, cons
 	typedef std::vector<DistanceRecord> Distances;
 
 	Neighbors neighbors;
-	neighbors.reserve(end-begin);
-	for (RandomAccessIterator iter=begin; iter!=end; ++iter)
+	neighbors.resize(end-begin);
+	// each point's neighbor list is computed independently
+#pragma omp parallel for
+	for (IndexType i=0; i<static_cast<IndexType>(end-begin); ++i)
 	{
+		RandomAccessIterator iter = begin+i;
 		Distances distances;
 		for (RandomAccessIterator around_iter=begin; around_iter!=end; ++around_iter)
 			distances.push_back(std::make_pair(around_iter, callback.distance(iter,around_iter)));
@@ -143,7 +146,7 @@ Neighbors find_neighbors_bruteforce_impl(const RandomAccessIterator& begin, cons
 			if (neighbors_iter->first != iter)
 				local_neighbors.push_back(neighbors_iter->first - begin);
 		}
-		neighbors.push_back(local_neighbors);
+		neighbors[i] = local_neighbors;
 	}
 	return neighbors;
 }
@@ -155,15 +158,17 @@ Neighbors find_neighbors_vptree_impl(const RandomAccessIterator& begin, const Ra
 	timed_context context("VP-Tree based neighbors search");
 
 	Neighbors neighbors;
-	neighbors.reserve(end-begin);
+	neighbors.resize(end-begin);
 
 	VantagePointTree<RandomAccessIterator,Callback> tree(begin,end,callback);
 
-	for (RandomAccessIterator i=begin; i!=end; ++i)
+	// the tree is read-only during queries, so they run in parallel
+#pragma omp parallel for
+	for (IndexType i=0; i<static_cast<IndexType>(end-begin); ++i)
 	{
-		LocalNeighbors local_neighbors = tree.search(i,k+1);
-		std::remove(local_neighbors.begin(),local_neighbors.end(),i-begin);
-		neighbors.push_back(local_neighbors);
+		LocalNeighbors local_neighbors = tree.search(begin+i,k+1);
+		std::remove(local_neighbors.begin(),local_neighbors.end(),i);
+		neighbors[i] = local_neighbors;
 	}
 
 	return neighbors;
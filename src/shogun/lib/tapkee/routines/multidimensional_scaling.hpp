@@ -11,6 +11,9 @@
 #include <shogun/lib/tapkee/utils/time.hpp>
 /* End of Tapkee includes */
 
+#include <algorithm>
+#include <vector>
+
 namespace tapkee
 {
 namespace tapkee_internal
@@ -83,31 +86,50 @@ DenseMatrix triangulate(RandomAccessIterator begin, RandomAccessIterator end, Pa
 	for (IndexType i=0; i<target_dimension; ++i)
 		landmarks_embedding.first.col(i).array() /= landmarks_embedding.second(i);
 
+	// gather non-landmark points so they can be processed in dense blocks
+	std::vector<IndexType> queries;
+	queries.reserve(n_vectors);
+	for (IndexType index_iter=0; index_iter<n_vectors; ++index_iter)
+	{
+		if (to_process[index_iter])
+			queries.push_back(index_iter);
+	}
+	const IndexType n_queries = queries.size();
+	const IndexType block_size = 64;
+
 #ifdef TAPKEE_NO_OMP_SHARED_CONSTANTS_
-# pragma omp parallel shared(begin,end,to_process,distance_callback,landmarks, \
+# pragma omp parallel shared(begin,end,queries,distance_callback,landmarks, \
 		landmarks_embedding,landmark_distances_squared,embedding) default(none)
 #else
-# pragma omp parallel shared(begin,end,to_process,distance_callback,landmarks, \
-		landmarks_embedding,landmark_distances_squared,embedding,n_landmarks,n_vectors) default(none)
+# pragma omp parallel shared(begin,end,queries,distance_callback,landmarks, \
+		landmarks_embedding,landmark_distances_squared,embedding,n_landmarks,n_queries,block_size) default(none)
 #endif
 	{
-		DenseVector distances_to_landmarks(n_landmarks);
-		IndexType index_iter;
+		DenseMatrix distances_to_landmarks(n_landmarks,block_size);
+		IndexType block_start;
 #pragma omp for nowait
-		for (index_iter=0; index_iter<n_vectors; ++index_iter)
+		for (block_start=0; block_start<n_queries; block_start+=block_size)
 		{
-			if (!to_process[index_iter])
-				continue;
+			const IndexType block_end = std::min(block_start+block_size,n_queries);
+			const IndexType current_block_size = block_end-block_start;
 
-			for (IndexType i=0; i<n_landmarks; ++i)
+			for (IndexType b=0; b<current_block_size; ++b)
 			{
-				ScalarType d = distance_callback.distance(begin[index_iter],begin[landmarks[i]]);
-				distances_to_landmarks(i) = d*d;
+				const IndexType index_iter = queries[block_start+b];
+				for (IndexType i=0; i<n_landmarks; ++i)
+				{
+					ScalarType d = distance_callback.distance(begin[index_iter],begin[landmarks[i]]);
+					distances_to_landmarks(i,b) = d*d;
+				}
+				distances_to_landmarks.col(b) -= landmark_distances_squared;
 			}
-			//distances_to_landmarks.array().square();
 
-			distances_to_landmarks -= landmark_distances_squared;
-			embedding.row(index_iter).noalias() = -0.5*landmarks_embedding.first.transpose()*distances_to_landmarks;
+			// one matrix-matrix product per block instead of a
+			// matrix-vector product per point
+			DenseMatrix embedded_block =
+				-0.5*(landmarks_embedding.first.transpose()*distances_to_landmarks.leftCols(current_block_size));
+			for (IndexType b=0; b<current_block_size; ++b)
+				embedding.row(queries[block_start+b]).noalias() = embedded_block.col(b).transpose();
 		}
 	}
 
@@ -34,11 +34,12 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 
 	// Look for the maximum distance
 	ScalarType max = 0.0;
-	for (RandomAccessIterator i_iter=begin; i_iter!=end; ++i_iter)
+#pragma omp parallel for reduction(max:max)
+	for (int i=0; i<N; ++i)
 	{
-		for (RandomAccessIterator j_iter=i_iter+1; j_iter!=end; ++j_iter)
+		for (int j=i+1; j<N; ++j)
 		{
-			max = std::max(max, callback.distance(*i_iter,*j_iter));
+			max = std::max(max, callback.distance(*(begin+i),*(begin+j)));
 		}
 	}
 
@@ -56,7 +57,6 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 	// SPE's main loop
 
 	typedef std::vector<int> Indices;
-	typedef std::vector<int>::iterator IndexIterator;
 
 	// Maximum number of iterations
 	if (max_iter == 0)
@@ -76,9 +76,6 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 	DenseVector Rt(nupdates);
 	DenseVector scale(nupdates);
 	DenseVector D(nupdates);
-	// Pointers to the indices of the elements to update
-	IndexIterator ind1;
-	IndexIterator ind2;
 	// Helper used in local strategy
 	Indices ind1Neighbors;
 	if (!global_strategy)
@@ -86,12 +83,11 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 
 	for (IndexType i=0; i<max_iter; ++i)
 	{
-		// Shuffle to select the vectors to update in this iteration
+		// Shuffle to select the vectors to update in this iteration.
+		// The first nupdates entries form the first set of indices, the
+		// next nupdates entries the second set.
 		tapkee::random_shuffle(indices.begin(),indices.end());
 
-		ind1 = indices.begin();
-		ind2 = indices.begin()+nupdates;
-
 		// With local strategy, the seecond set of indices is selected among
 		// neighbors of the first set
 		if (!global_strategy)
@@ -100,13 +96,11 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 			for(int j=0; j<nupdates; ++j)
 			{
 				const LocalNeighbors& current_neighbors =
-					neighbors[*ind1++];
+					neighbors[indices[j]];
 
 				for(IndexType kk=0; kk<k; ++kk)
 					ind1Neighbors[kk + j*k] = current_neighbors[kk];
 			}
-			// Restore ind1
-			ind1 = indices.begin();
 
 			// Generate pseudo-random indices and select final indices
 			for(int j=0; j<nupdates; ++j)
@@ -118,11 +112,11 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 
 
 		// Compute distances between the selected points in the embedded space
+#pragma omp parallel for
 		for(int j=0; j<nupdates; ++j)
 		{
 			//FIXME it seems that here Euclidean distance is forced
-			D[j] = (Y.col(*ind1) - Y.col(*ind2)).norm();
-			++ind1, ++ind2;
+			D[j] = (Y.col(indices[j]) - Y.col(indices[nupdates+j])).norm();
 		}
 
 		// Get the corresponding distances in the original space
@@ -131,10 +125,9 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 		else // local_strategy
 			Rt.fill(1);
 
-		ind1 = indices.begin();
-		ind2 = indices.begin()+nupdates;
+#pragma omp parallel for
 		for (int j=0; j<nupdates; ++j)
-			Rt[j] *= callback.distance(*(begin + *ind1++), *(begin + *ind2++));
+			Rt[j] *= callback.distance(*(begin + indices[j]), *(begin + indices[nupdates+j]));
 
 		// Compute some terms for update
 
@@ -142,25 +135,24 @@ DenseMatrix spe_embedding(RandomAccessIterator begin, RandomAccessIterator end,
 		D.array() += tolerance;
 		scale = (Rt-D).cwiseQuotient(D);
 
-		ind1 = indices.begin();
-		ind2 = indices.begin()+nupdates;
 		// Difference matrix
+#pragma omp parallel for
 		for (int j=0; j<nupdates; ++j)
 		{
-			Yd.col(j).noalias() = Y.col(*ind1) - Y.col(*ind2);
-
-			++ind1, ++ind2;
+			Yd.col(j).noalias() = Y.col(indices[j]) - Y.col(indices[nupdates+j]);
 		}
 
-		ind1 = indices.begin();
-		ind2 = indices.begin()+nupdates;
-		// Update the location of the vectors in the embedded space
+		// Update the location of the vectors in the embedded space.
+		// With the global strategy all 2*nupdates indices come from a
+		// shuffled permutation and are distinct, so the updates are
+		// race-free; with the local strategy the second set may repeat,
+		// which SPE's sparse stochastic updates tolerate (lock-free,
+		// Hogwild-style).
+#pragma omp parallel for
 		for (int j=0; j<nupdates; ++j)
 		{
-			Y.col(*ind1) += lambda / 2 * scale[j] * Yd.col(j);
-			Y.col(*ind2) -= lambda / 2 * scale[j] * Yd.col(j);
-
-			++ind1, ++ind2;
+			Y.col(indices[j]) += lambda / 2 * scale[j] * Yd.col(j);
+			Y.col(indices[nupdates+j]) -= lambda / 2 * scale[j] * Yd.col(j);
 		}
 
 		// Update the learning parameter
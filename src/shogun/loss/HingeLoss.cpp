@@ -6,8 +6,10 @@
 
 #include <shogun/loss/HingeLoss.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 float64_t HingeLoss::loss(float64_t prediction, float64_t label)
 {
@@ -21,6 +23,16 @@ float64_t HingeLoss::loss(float64_t z)
 	return Math::max(0.0, z);
 }
 
+void HingeLoss::loss(const SGVector<float64_t>& z, SGVector<float64_t>& result)
+{
+	require(result.vlen==z.vlen,
+		"The length of the result vector ({}) does not match the number of evaluation points ({})",
+		result.vlen, z.vlen);
+	Map<const ArrayXd> eigen_z(z.vector, z.vlen);
+	Map<ArrayXd> eigen_result(result.vector, result.vlen);
+	eigen_result=eigen_z.max(0.0);
+}
+
 float64_t HingeLoss::first_derivative(float64_t prediction, float64_t label)
 {
 	return (label * prediction >= label * label) ? 0 : -label;
@@ -31,6 +43,17 @@ float64_t HingeLoss::first_derivative(float64_t z)
 	return z > 0.0 ? 1.0 : 0.0;
 }
 
+void HingeLoss::first_derivative(const SGVector<float64_t>& z,
+	SGVector<float64_t>& result)
+{
+	require(result.vlen==z.vlen,
+		"The length of the result vector ({}) does not match the number of evaluation points ({})",
+		result.vlen, z.vlen);
+	Map<const ArrayXd> eigen_z(z.vector, z.vlen);
+	Map<ArrayXd> eigen_result(result.vector, result.vlen);
+	eigen_result=(eigen_z>0.0).cast<float64_t>();
+}
+
 float64_t HingeLoss::second_derivative(float64_t prediction, float64_t label)
 {
 	return 0.;
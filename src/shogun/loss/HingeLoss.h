@@ -49,6 +49,14 @@ public:
 	 */
 	float64_t loss(float64_t z) override;
 
+	/**
+	 * Get loss for a vector of examples, evaluated with a batch kernel
+	 *
+	 * @param z where to evaluate the loss
+	 * @param result vector the losses are written into
+	 */
+	void loss(const SGVector<float64_t>& z, SGVector<float64_t>& result) override;
+
 	/**
 	 * Get first derivative of the loss function
 	 *
@@ -68,6 +76,16 @@ public:
 	 */
 	float64_t first_derivative(float64_t z) override;
 
+	/**
+	 * Get first derivative of the loss function for a vector of examples,
+	 * evaluated with a batch kernel
+	 *
+	 * @param z where to evaluate the derivative of the loss
+	 * @param result vector the derivatives are written into
+	 */
+	void first_derivative(const SGVector<float64_t>& z,
+		SGVector<float64_t>& result) override;
+
 	/**
 	 * Get second derivative of the loss function
 	 *
@@ -5,14 +5,29 @@
  */
 
 #include <shogun/loss/LogLoss.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
+using namespace Eigen;
 
 float64_t LogLoss::loss(float64_t z)
 {
 	return (z >= 0) ? log(1 + exp(-z)) : -z + log(1 + exp(z));
 }
 
+void LogLoss::loss(const SGVector<float64_t>& z, SGVector<float64_t>& result)
+{
+	require(result.vlen==z.vlen,
+		"The length of the result vector ({}) does not match the number of evaluation points ({})",
+		result.vlen, z.vlen);
+	Map<const ArrayXd> eigen_z(z.vector, z.vlen);
+	Map<ArrayXd> eigen_result(result.vector, result.vlen);
+	/* log(1+exp(-z)) evaluated as max(-z,0)+log(1+exp(-|z|)), which matches
+	 * both branches of the scalar version and stays stable for large |z|
+	 */
+	eigen_result=(-eigen_z).max(0.0)+(1.0+(-eigen_z.abs()).exp()).log();
+}
+
 float64_t LogLoss::first_derivative(float64_t z)
 {
 	if (z < 0)
@@ -22,6 +37,18 @@ float64_t LogLoss::first_derivative(float64_t z)
 	return -ez / (ez + 1);
 }
 
+void LogLoss::first_derivative(const SGVector<float64_t>& z,
+	SGVector<float64_t>& result)
+{
+	require(result.vlen==z.vlen,
+		"The length of the result vector ({}) does not match the number of evaluation points ({})",
+		result.vlen, z.vlen);
+	Map<const ArrayXd> eigen_z(z.vector, z.vlen);
+	Map<ArrayXd> eigen_result(result.vector, result.vlen);
+	ArrayXd ez=(-eigen_z.abs()).exp();
+	eigen_result=(eigen_z>=0.0).select(-ez/(ez+1.0), -1.0/(ez+1.0));
+}
+
 float64_t LogLoss::second_derivative(float64_t z)
 {
 	float64_t ez = exp(z);
@@ -38,6 +38,17 @@ public:
 	 */
 	float64_t loss(float64_t z) override;
 
+	/**
+	 * Get loss for a vector of examples
+	 *
+	 * Evaluated with vectorized kernels, so batch consumers avoid the
+	 * per-element transcendental calls of the scalar version.
+	 *
+	 * @param z where to evaluate the loss
+	 * @param result vector the losses are written into
+	 */
+	void loss(const SGVector<float64_t>& z, SGVector<float64_t>& result) override;
+
 	/**
 	 * Get first derivative of the loss function
 	 *
@@ -47,6 +58,15 @@ public:
 	 */
 	float64_t first_derivative(float64_t z) override;
 
+	/**
+	 * Get first derivative of the loss function for a vector of examples
+	 *
+	 * @param z where to evaluate the derivative of the loss
+	 * @param result vector the derivatives are written into
+	 */
+	void first_derivative(const SGVector<float64_t>& z,
+		SGVector<float64_t>& result) override;
+
 	/**
 	 * Get second derivative of the loss function
 	 *
@@ -12,6 +12,7 @@
 
 #include <shogun/base/SGObject.h>
 #include <shogun/lib/common.h>
+#include <shogun/lib/SGVector.h>
 
 namespace shogun
 {
@@ -81,6 +82,25 @@ public:
 	 */
 	virtual float64_t loss(float64_t z) = 0;
 
+	/**
+	 * Get loss for a vector of examples
+	 *
+	 * The default implementation evaluates the scalar loss per element.
+	 * Subclasses whose loss vectorizes well should override this with a
+	 * batch kernel.
+	 *
+	 * @param z where to evaluate the loss
+	 * @param result vector the losses are written into
+	 */
+	virtual void loss(const SGVector<float64_t>& z, SGVector<float64_t>& result)
+	{
+		require(result.vlen==z.vlen,
+			"The length of the result vector ({}) does not match the number of evaluation points ({})",
+			result.vlen, z.vlen);
+		for (index_t i=0; i<z.vlen; i++)
+			result[i]=loss(z[i]);
+	}
+
 	/**
 	 * Get first derivative of the loss function
 	 *
@@ -103,6 +123,46 @@ public:
 	 */
 	virtual float64_t first_derivative(float64_t z) = 0;
 
+	/**
+	 * Get first derivative of the loss function for a vector of examples
+	 *
+	 * The default implementation evaluates the scalar derivative per
+	 * element. Subclasses whose derivative vectorizes well should override
+	 * this with a batch kernel.
+	 *
+	 * @param z where to evaluate the derivative of the loss
+	 * @param result vector the derivatives are written into
+	 */
+	virtual void first_derivative(const SGVector<float64_t>& z,
+		SGVector<float64_t>& result)
+	{
+		require(result.vlen==z.vlen,
+			"The length of the result vector ({}) does not match the number of evaluation points ({})",
+			result.vlen, z.vlen);
+		for (index_t i=0; i<z.vlen; i++)
+			result[i]=first_derivative(z[i]);
+	}
+
+	/**
+	 * Get first derivative of the loss function for a vector of examples
+	 *
+	 * @param predictions predictions
+	 * @param labels labels
+	 * @param result vector the derivatives are written into
+	 */
+	virtual void first_derivative(const SGVector<float64_t>& predictions,
+		const SGVector<float64_t>& labels, SGVector<float64_t>& result)
+	{
+		require(predictions.vlen==labels.vlen,
+			"The number of predictions ({}) does not match the number of labels ({})",
+			predictions.vlen, labels.vlen);
+		require(result.vlen==predictions.vlen,
+			"The length of the result vector ({}) does not match the number of predictions ({})",
+			result.vlen, predictions.vlen);
+		for (index_t i=0; i<predictions.vlen; i++)
+			result[i]=first_derivative(predictions[i], labels[i]);
+	}
+
 	/**
 	 * Get second derivative of the loss function
 	 *
@@ -8,7 +8,9 @@
 #include <shogun/base/ShogunEnv.h>
 #include <shogun/base/progress.h>
 #include <shogun/ensemble/CombinationRule.h>
+#include <shogun/ensemble/MajorityVote.h>
 #include <shogun/ensemble/MeanRule.h>
+#include <shogun/ensemble/WeightedMajorityVote.h>
 #include <shogun/machine/BaggingMachine.h>
 #include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
@@ -33,12 +35,13 @@ BaggingMachine::BaggingMachine(std::shared_ptr<Features> features, std::shared_p
 
 std::shared_ptr<BinaryLabels> BaggingMachine::apply_binary(std::shared_ptr<Features> data)
 {
-	SGMatrix<float64_t> output = apply_outputs_without_combination(data);
+	require(m_combination_rule != NULL, "Combination rule is not set!");
 
+	// the returned labels are thresholded means, so a streamed MeanRule
+	// is all that is needed; no per-bag output matrix is materialized
 	auto mean_rule = std::make_shared<MeanRule>();
-
-	SGVector<float64_t> labels = m_combination_rule->combine(output);
-	SGVector<float64_t> probabilities = mean_rule->combine(output);
+	SGVector<float64_t> probabilities =
+	    apply_get_outputs_streamed(data, mean_rule);
 
 	float64_t threshold = 0.5;
 	return std::make_shared<BinaryLabels>(probabilities, threshold);
@@ -46,32 +49,65 @@ std::shared_ptr<BinaryLabels> BaggingMachine::apply_binary(std::shared_ptr<Featu
 
 std::shared_ptr<MulticlassLabels> BaggingMachine::apply_multiclass(std::shared_ptr<Features> data)
 {
-	SGMatrix<float64_t> bagged_outputs =
-	    apply_outputs_without_combination(data);
-
 	require(m_labels, "Labels not set.");
 	require(
 	    m_labels->get_label_type() == LT_MULTICLASS,
 	    "Labels ({}) are not compatible with multiclass.",
 	    m_labels->get_name());
+	require(m_combination_rule != NULL, "Combination rule is not set!");
 
 	auto labels_multiclass = std::dynamic_pointer_cast<MulticlassLabels>(m_labels);
-	auto num_samples = bagged_outputs.size() / m_num_bags;
+	auto num_samples = data->get_num_vectors();
 	auto num_classes = labels_multiclass->get_num_classes();
 
 	auto pred = std::make_shared<MulticlassLabels>(num_samples);
 	pred->allocate_confidences_for(num_classes);
 
 	SGMatrix<float64_t> class_probabilities(num_classes, num_samples);
-	class_probabilities.zero();
+	SGVector<float64_t> combined;
+
+	// a uniform majority vote over num_classes bins accumulates exactly
+	// the per-class counts the confidences need, so one streamed pass
+	// over the bags yields both labels and confidences without the
+	// num_samples x num_bags output matrix. Weighted votes stay on the
+	// matrix path: their confidences are plain per-bag counts while the
+	// labels honor the weights, and one accumulator cannot hold both.
+	auto vote =
+	    std::dynamic_pointer_cast<WeightedMajorityVote>(m_combination_rule);
+	bool uniform_vote = vote &&
+	    (std::dynamic_pointer_cast<MajorityVote>(m_combination_rule) ||
+	     vote->get_weights().vlen == 0);
+	if (uniform_vote)
+	{
+		int32_t previous_bins = vote->get_num_vote_bins();
+		vote->set_num_vote_bins(num_classes);
+		SGMatrix<float64_t> accumulator = accumulate_bag_outputs(data, vote);
 
-	for (auto i = 0; i < num_samples; ++i)
+		for (auto i = 0; i < num_samples; ++i)
+		{
+			for (auto j = 0; j < num_classes; ++j)
+				class_probabilities(j, i) = accumulator(j, i);
+		}
+
+		combined = vote->finalize(accumulator, m_num_bags);
+		vote->set_num_vote_bins(previous_bins);
+	}
+	else
 	{
-		for (auto j = 0; j < m_num_bags; ++j)
+		SGMatrix<float64_t> bagged_outputs =
+		    apply_outputs_without_combination(data);
+
+		class_probabilities.zero();
+		for (auto i = 0; i < num_samples; ++i)
 		{
-			int32_t class_idx = bagged_outputs(i, j);
-			class_probabilities(class_idx, i) += 1;
+			for (auto j = 0; j < m_num_bags; ++j)
+			{
+				int32_t class_idx = bagged_outputs(i, j);
+				class_probabilities(class_idx, i) += 1;
+			}
 		}
+
+		combined = m_combination_rule->combine(bagged_outputs);
 	}
 
 	linalg::scale(class_probabilities, class_probabilities, 1.0 / m_num_bags);
@@ -79,7 +115,6 @@ std::shared_ptr<MulticlassLabels> BaggingMachine::apply_multiclass(std::shared_p
 	for (auto i = 0; i < num_samples; ++i)
 		pred->set_multiclass_confidences(i, class_probabilities.get_column(i));
 
-	SGVector<float64_t> combined = m_combination_rule->combine(bagged_outputs);
 	pred->set_labels(combined);
 
 	return pred;
@@ -95,6 +130,9 @@ SGVector<float64_t> BaggingMachine::apply_get_outputs(const std::shared_ptr<Feat
 	ASSERT(data != NULL);
 	require(m_combination_rule != NULL, "Combination rule is not set!");
 
+	if (m_combination_rule->supports_streamed_combine())
+		return apply_get_outputs_streamed(data, m_combination_rule);
+
 	auto output = apply_outputs_without_combination(data);
 	return m_combination_rule->combine(output);
 }
@@ -125,6 +163,62 @@ BaggingMachine::apply_outputs_without_combination(std::shared_ptr<Features> data
 	return output;
 }
 
+SGMatrix<float64_t> BaggingMachine::accumulate_bag_outputs(
+    const std::shared_ptr<Features>& data,
+    const std::shared_ptr<CombinationRule>& rule)
+{
+	ASSERT(data != NULL);
+	ASSERT(m_num_bags == m_bags.size());
+	require(rule != NULL, "Combination rule is not set!");
+	require(
+	    rule->supports_streamed_combine(),
+	    "{} does not support streamed combination", rule->get_name());
+
+	int32_t num_vectors = data->get_num_vectors();
+	SGMatrix<float64_t> accumulator(
+	    rule->get_num_accumulator_slots(), num_vectors);
+	accumulator.zero();
+
+#pragma omp parallel
+	{
+		// each thread reduces its bags into a private partial and merges
+		// it once at the end; accumulate() contributions are additive,
+		// so the merged result equals a serial accumulation
+		SGMatrix<float64_t> partial(
+		    rule->get_num_accumulator_slots(), num_vectors);
+		partial.zero();
+
+#pragma omp for nowait
+		for (int32_t i = 0; i < m_num_bags; ++i)
+		{
+			auto m = m_bags.at(i);
+			auto l = m->apply(data);
+			SGVector<float64_t> lv;
+			if (l != NULL)
+				lv = l->as<DenseLabels>()->get_labels();
+			else
+				error("NULL returned by apply method");
+
+			rule->accumulate(partial, lv, rule->get_member_weight(i));
+		}
+
+#pragma omp critical(shogun_bagging_streamed_combine)
+		{
+			for (int64_t k = 0; k < accumulator.size(); ++k)
+				accumulator.matrix[k] += partial.matrix[k];
+		}
+	}
+
+	return accumulator;
+}
+
+SGVector<float64_t> BaggingMachine::apply_get_outputs_streamed(
+    const std::shared_ptr<Features>& data,
+    const std::shared_ptr<CombinationRule>& rule)
+{
+	return rule->finalize(accumulate_bag_outputs(data, rule), m_num_bags);
+}
+
 bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 {
 	require(m_machine != NULL, "Machine is not set!");
@@ -143,6 +237,7 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 
 	// clear the array, if previously trained
 	m_bags.clear();
+	m_bags.resize(m_num_bags);
 
 	// reset the oob index vector
 	m_all_oob_idx = SGVector<bool>(m_features->get_num_vectors());
@@ -150,16 +245,36 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 
 
 	m_oob_indices.clear();
+	m_oob_indices.resize(m_num_bags);
+
+	// per-bag OOB predictions are scored as soon as a bag finishes
+	// training, so get_oob_error() never has to re-apply the ensemble
+	m_oob_outputs =
+	    SGMatrix<float64_t>(m_features->get_num_vectors(), m_num_bags);
+	if (m_labels->get_label_type() == LT_REGRESSION)
+		m_oob_outputs.zero();
+	else
+		m_oob_outputs.set_const(NAN);
 
 	SGMatrix<index_t> rnd_indicies(m_bag_size, m_num_bags);
 	random::fill_array(rnd_indicies, 0, m_bag_size - 1, m_prng);
 
+	// one seed per bag, drawn up front: clone() copies the prototype's
+	// generator state, so without reseeding every bag would sample the
+	// same random streams (e.g. identical feature subsets in a random
+	// forest) and grow correlated machines
+	SGVector<int32_t> bag_seeds(m_num_bags);
+	for (int32_t i = 0; i < m_num_bags; ++i)
+		bag_seeds[i] = (int32_t)m_prng();
+
 	auto pb = SG_PROGRESS(range(m_num_bags));
 #pragma omp parallel for
 	for (int32_t i = 0; i < m_num_bags; ++i)
 	{
 		auto c=std::dynamic_pointer_cast<Machine>(m_machine->clone());
 		ASSERT(c != NULL);
+		if (c->has(random::kSeed))
+			c->put(random::kSeed, bag_seeds[i]);
 		SGVector<index_t> idx(
 		    rnd_indicies.get_column_vector(i), m_bag_size, false);
 
@@ -201,16 +316,38 @@ bool BaggingMachine::train_machine(std::shared_ptr<Features> data)
 		features->remove_subset();
 		labels->remove_subset();
 
-#pragma omp critical
+		// get out of bag indexes; the critical section protects the
+		// shared m_all_oob_idx bookkeeping inside get_oob_indices
+#pragma omp critical(shogun_bagging_oob)
+		m_oob_indices[i] = get_oob_indices(idx);
+
+		// score this bag's OOB rows right away into the bag's own
+		// column; columns are disjoint across bags, so no further
+		// synchronisation is needed
+		auto& current_oob = m_oob_indices[i];
+		if (!current_oob.empty())
 		{
-		// get out of bag indexes
-		auto oob = get_oob_indices(idx);
-		m_oob_indices.push_back(oob);
+			SGVector<index_t> oob(
+			    current_oob.data(), current_oob.size(), false);
+			features->add_subset(oob);
+
+			auto l = c->apply(features);
+			SGVector<float64_t> lv;
+			if (l!=NULL)
+				lv = l->as<DenseLabels>()->get_labels();
+			else
+				error("NULL returned by apply method");
+
+			for (index_t j = 0; j < oob.vlen; j++)
+				m_oob_outputs(oob[j], i) = lv[j];
 
-		// add trained machine to bag array
-		m_bags.push_back(c);
+			features->remove_subset();
 		}
 
+		// bags are stored at their own index so that the ensemble is
+		// identical no matter in which order the threads finish
+		m_bags[i] = c;
+
 		pb.print_progress();
 	}
 	pb.complete();
@@ -236,6 +373,8 @@ void BaggingMachine::register_parameters()
 	    "Combination rule to use for aggregating", ParameterProperties::HYPER);
 	SG_ADD(&m_all_oob_idx, kAllOobIdx, "Indices of all oob vectors");
 	SG_ADD(&m_oob_indices, kOobIndices, "OOB indices for each machine");
+	SG_ADD(&m_oob_outputs, kOobOutputs,
+	    "Per-bag OOB predictions accumulated during training");
 	SG_ADD(&m_machine, kMachine, "machine to use for bagging");
 	SG_ADD(&m_oob_evaluation_metric, kOobEvaluationMetric,
 	    "metric to calculate the oob error");
@@ -282,6 +421,7 @@ void BaggingMachine::init()
 	m_bag_size = 0;
 	m_all_oob_idx = SGVector<bool>();
 	m_oob_evaluation_metric = nullptr;
+	m_oob_outputs = SGMatrix<float64_t>();
 }
 
 void BaggingMachine::set_combination_rule(std::shared_ptr<CombinationRule> rule)
@@ -301,26 +441,39 @@ float64_t BaggingMachine::get_oob_error() const
 	require(m_combination_rule, "Combination rule is not set!");
 	require(m_bags.size() > 0, "BaggingMachine is not trained!");
 
-	SGMatrix<float64_t> output(
+	// predictions were accumulated bag-by-bag during training; only a
+	// model restored without them has to re-apply the ensemble here
+	SGMatrix<float64_t> output = m_oob_outputs;
+	if (output.num_rows == m_features->get_num_vectors() &&
+	    output.num_cols == (index_t)m_bags.size())
+		return evaluate_oob_outputs(output);
+
+	output = SGMatrix<float64_t>(
 	    m_features->get_num_vectors(), m_bags.size());
 	if (m_labels->get_label_type() == LT_REGRESSION)
 		output.zero();
 	else
 		output.set_const(NAN);
 
-	/* TODO: add parallel support of applying the OOBs
-	  only possible when add_subset is thread-safe
-	#pragma omp parallel for num_threads(env()->get_num_threads())
-	*/
-	for (index_t i = 0; i < m_bags.size(); i++)
+#pragma omp parallel for
+	for (index_t i = 0; i < (index_t)m_bags.size(); i++)
 	{
 		auto m = m_bags.at(i);
 		auto current_oob = m_oob_indices[i];
 
 		SGVector<index_t> oob(current_oob.data(), current_oob.size(), false);
-		m_features->add_subset(oob);
 
-		auto l = m->apply(m_features);
+		// subsets are per-bag state: apply each bag on its own shallow
+		// copy so that add_subset does not race on the shared features
+		std::shared_ptr<Features> features;
+		if (env()->get_num_threads() == 1)
+			features = m_features;
+		else
+			features = m_features->shallow_subset_copy();
+
+		features->add_subset(oob);
+
+		auto l = m->apply(features);
 		SGVector<float64_t> lv;
 		if (l!=NULL)
 			lv = std::dynamic_pointer_cast<DenseLabels>(l)->get_labels();
@@ -331,12 +484,15 @@ float64_t BaggingMachine::get_oob_error() const
 		for (index_t j = 0; j < oob.vlen; j++)
 			output(oob[j], i) = lv[j];
 
-		m_features->remove_subset();
-
-
-
+		features->remove_subset();
 	}
 
+	return evaluate_oob_outputs(output);
+}
+
+float64_t BaggingMachine::evaluate_oob_outputs(
+    const SGMatrix<float64_t>& output) const
+{
 	std::vector<index_t> idx;
 	for (index_t i = 0; i < m_features->get_num_vectors(); i++)
 	{
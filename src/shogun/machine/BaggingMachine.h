@@ -154,6 +154,29 @@ namespace shogun
 		SGMatrix<float64_t>
 			apply_outputs_without_combination(std::shared_ptr<Features> data);
 
+		/** folds each bag's outputs into the rule's running accumulator
+		 * as they are produced, in parallel on per-thread partials, so
+		 * the num_vectors x num_bags output matrix is never materialized
+		 *
+		 * @param data the data to compute the output for
+		 * @param rule streaming-capable combination rule
+		 * @return the filled accumulator, ready for CombinationRule::finalize()
+		 */
+		SGMatrix<float64_t> accumulate_bag_outputs(
+			const std::shared_ptr<Features>& data,
+			const std::shared_ptr<CombinationRule>& rule);
+
+		/** streamed counterpart of apply_get_outputs(): accumulates and
+		 * finalizes via the given rule without the full output matrix
+		 *
+		 * @param data the data to compute the output for
+		 * @param rule streaming-capable combination rule
+		 * @return predictions
+		 */
+		SGVector<float64_t> apply_get_outputs_streamed(
+			const std::shared_ptr<Features>& data,
+			const std::shared_ptr<CombinationRule>& rule);
+
 		/** Register paramaters */
 		void register_parameters();
 
@@ -170,6 +193,16 @@ namespace shogun
 		std::vector<index_t>
 		get_oob_indices(const SGVector<index_t>& in_bag);
 
+		/**
+		 * combine per-bag OOB predictions and score them with the oob
+		 * evaluation metric
+		 *
+		 * @param output per-bag predictions, one column per bag, with
+		 * in-bag entries set to NAN (zero for regression)
+		 * @return out-of-bag error
+		 */
+		float64_t evaluate_oob_outputs(const SGMatrix<float64_t>& output) const;
+
 	protected:
 		/** bags array */
 		std::vector<std::shared_ptr<Machine>> m_bags;
@@ -198,6 +231,11 @@ namespace shogun
 		/** metric to calculate the oob error */
 		std::shared_ptr<Evaluation> m_oob_evaluation_metric;
 
+		/** per-bag out-of-bag predictions, one column per bag, filled
+		 * incrementally as each bag finishes training; in-bag entries
+		 * hold NAN (zero for regression) */
+		SGMatrix<float64_t> m_oob_outputs;
+
 #ifndef SWIG
 	public:
 		static constexpr std::string_view kFeatures = "features";
@@ -209,6 +247,7 @@ namespace shogun
 		static constexpr std::string_view kOobIndices = "oob_indices";
 		static constexpr std::string_view kMachine = "machine";
 		static constexpr std::string_view kOobError = "oob_error";
+		static constexpr std::string_view kOobOutputs = "oob_outputs";
 		static constexpr std::string_view kOobEvaluationMetric = "oob_evaluation_metric";
 #endif	
 	};
@@ -13,6 +13,7 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/lib/config.h>
 #include <shogun/machine/GaussianProcess.h>
+#include <shogun/machine/gp/ExactInferenceMethod.h>
 #include <shogun/machine/gp/LikelihoodModel.h>
 #include <shogun/machine/gp/SingleFITCInference.h>
 #include <shogun/mathematics/Math.h>
@@ -37,6 +38,9 @@ GaussianProcess::GaussianProcess(std::shared_ptr<Inference> method)
 void GaussianProcess::init()
 {
 	m_compute_variance = false;
+	m_posterior_compiled = false;
+	m_compiled_scale2 = 1.0;
+	m_compiled_sparse = false;
 	SG_ADD(
 	    &m_method, "inference_method", "Inference method",
 	    ParameterProperties::HYPER);
@@ -59,12 +63,36 @@ GaussianProcess::~GaussianProcess()
 {
 }
 
-SGVector<float64_t>
-GaussianProcess::get_posterior_means(const std::shared_ptr<Features>& data)
+void GaussianProcess::update_with_new_points(
+	const std::shared_ptr<Features>& data, const std::shared_ptr<Labels>& lab)
 {
 	require(m_method, "Inference method should not be NULL");
 
-	std::shared_ptr<Features> feat;
+	auto exact = std::dynamic_pointer_cast<ExactInferenceMethod>(m_method);
+	require(exact, "Incremental updates are only supported with "
+		"ExactInferenceMethod");
+
+	exact->update_with_new_points(data, lab);
+	Machine::set_labels(exact->get_labels());
+	m_posterior_compiled = false;
+}
+
+void GaussianProcess::remove_oldest_points(int32_t num_points)
+{
+	require(m_method, "Inference method should not be NULL");
+
+	auto exact = std::dynamic_pointer_cast<ExactInferenceMethod>(m_method);
+	require(exact, "Incremental updates are only supported with "
+		"ExactInferenceMethod");
+
+	exact->remove_oldest_points(num_points);
+	Machine::set_labels(exact->get_labels());
+	m_posterior_compiled = false;
+}
+
+void GaussianProcess::compile_posterior()
+{
+	require(m_method, "Inference method should not be NULL");
 
 	auto sparse_method =
 	    std::dynamic_pointer_cast<SingleSparseInference>(m_method);
@@ -72,39 +100,76 @@ GaussianProcess::get_posterior_means(const std::shared_ptr<Features>& data)
 	if (sparse_method)
 	{
 		sparse_method->optimize_inducing_features();
-		feat = sparse_method->get_inducing_features();
+		m_compiled_feat = sparse_method->get_inducing_features();
+		m_compiled_sparse = true;
 	}
 	else
-		feat = m_method->get_features();
+	{
+		m_compiled_feat = m_method->get_features();
+		m_compiled_sparse = false;
+	}
+
+	// the getters trigger an update of the inference method if needed
+	m_compiled_alpha = m_method->get_alpha();
+	m_compiled_L = m_method->get_cholesky();
+	m_compiled_mean = m_method->get_mean();
+	m_compiled_scale2 = Math::sq(m_method->get_scale());
 
-	// get kernel and compute kernel matrix: K(feat, data)*scale^2
 	auto training_kernel = m_method->get_kernel();
-	auto kernel = std::dynamic_pointer_cast<Kernel>(training_kernel->clone());
+	m_compiled_kernel = std::dynamic_pointer_cast<Kernel>(training_kernel->clone());
 
-	kernel->init(feat, data);
+	// the quantities below are only needed in the branches of the variance
+	// computation matching the shape of the factorization
+	m_compiled_sW = SGVector<float64_t>();
+	m_compiled_E = SGMatrix<float64_t>();
 
-	// get kernel matrix and create eigen representation of it
-	SGMatrix<float64_t> k_trts = kernel->get_kernel_matrix();
-	Map<MatrixXd> eigen_Ks(k_trts.matrix, k_trts.num_rows, k_trts.num_cols);
+	Map<MatrixXd> eigen_L(
+	    m_compiled_L.matrix, m_compiled_L.num_rows, m_compiled_L.num_cols);
+	if (eigen_L.isUpperTriangular() && !m_compiled_sparse)
+	{
+		if (m_compiled_alpha.vlen == m_compiled_L.num_rows)
+			m_compiled_sW = m_method->get_diagonal_vector();
+		else if (m_method->supports_multiclass())
+			m_compiled_E = m_method->get_multiclass_E();
+	}
 
-	// compute Ks=Ks*scale^2
-	eigen_Ks *= Math::sq(m_method->get_scale());
+	m_posterior_compiled = true;
+}
 
-	// get alpha and create eigen representation of it
-	SGVector<float64_t> alpha = m_method->get_alpha();
-	Map<VectorXd> eigen_alpha(alpha.vector, alpha.vlen);
+void GaussianProcess::compute_posterior_stats(
+    const std::shared_ptr<Features>& data, SGVector<float64_t>& mu,
+    SGVector<float64_t>& s2)
+{
+	require(m_method, "Inference method should not be NULL");
+
+	if (!m_posterior_compiled || m_method->parameter_hash_changed())
+		compile_posterior();
+
+	// compute kernel diagonal: K(data, data)*scale^2
+	m_compiled_kernel->init(data, data);
+	SGVector<float64_t> k_tsts = m_compiled_kernel->get_kernel_diagonal();
+	Map<VectorXd> eigen_Kss_diag(k_tsts.vector, k_tsts.vlen);
+	eigen_Kss_diag *= m_compiled_scale2;
+
+	// compute kernel matrix: K(feat, data)*scale^2, shared between the mean
+	// and the variance
+	m_compiled_kernel->init(m_compiled_feat, data);
+	SGMatrix<float64_t> k_trts = m_compiled_kernel->get_kernel_matrix();
+	Map<MatrixXd> eigen_Ks(k_trts.matrix, k_trts.num_rows, k_trts.num_cols);
+	eigen_Ks *= m_compiled_scale2;
+
+	Map<VectorXd> eigen_alpha(m_compiled_alpha.vector, m_compiled_alpha.vlen);
 
 	// get mean and create eigen representation of it
-	auto mean_function = m_method->get_mean();
-	SGVector<float64_t> mean = mean_function->get_mean_vector(data);
+	SGVector<float64_t> mean = m_compiled_mean->get_mean_vector(data);
 	Map<VectorXd> eigen_mean(mean.vector, mean.vlen);
 
-	const index_t C = alpha.vlen / k_trts.num_rows;
 	const index_t n = k_trts.num_rows;
 	const index_t m = k_trts.num_cols;
+	const index_t C = m_compiled_alpha.vlen / n;
 
 	// compute mean: mu=Ks'*alpha+m
-	SGVector<float64_t> mu(C * m);
+	mu = SGVector<float64_t>(C * m);
 	Map<MatrixXd> eigen_mu_matrix(mu.vector, C, m);
 
 	for (index_t bl = 0; bl < C; bl++)
@@ -113,73 +178,19 @@ GaussianProcess::get_posterior_means(const std::shared_ptr<Features>& data)
 		     eigen_mean)
 		        .transpose();
 
-	return mu;
-}
+	Map<MatrixXd> eigen_L(
+	    m_compiled_L.matrix, m_compiled_L.num_rows, m_compiled_L.num_cols);
 
-SGVector<float64_t>
-GaussianProcess::get_posterior_variances(const std::shared_ptr<Features>& data)
-{
-	require(m_method, "Inference method should not be NULL");
-
-	std::shared_ptr<Features> feat;
-
-	bool is_sparse = false;
-	auto sparse_method =
-	    std::dynamic_pointer_cast<SingleSparseInference>(m_method);
-	// use inducing features for sparse inference method
-	if (sparse_method)
-	{
-		sparse_method->optimize_inducing_features();
-		feat = sparse_method->get_inducing_features();
-		is_sparse = true;
-	}
-	else
-		feat = m_method->get_features();
-
-	// get kernel and compute kernel matrix: K(data, data)*scale^2
-	auto training_kernel = m_method->get_kernel();
-	auto kernel = std::dynamic_pointer_cast<Kernel>(training_kernel->clone());
-
-	kernel->init(data, data);
-
-	// get kernel matrix and create eigen representation of it
-	SGVector<float64_t> k_tsts = kernel->get_kernel_diagonal();
-	Map<VectorXd> eigen_Kss_diag(k_tsts.vector, k_tsts.vlen);
-
-	// compute Kss=Kss*scale^2
-	eigen_Kss_diag *= Math::sq(m_method->get_scale());
-
-	// compute kernel matrix: K(feat, data)*scale^2
-	kernel->init(feat, data);
-
-	// get kernel matrix and create eigen representation of it
-	SGMatrix<float64_t> k_trts = kernel->get_kernel_matrix();
-	Map<MatrixXd> eigen_Ks(k_trts.matrix, k_trts.num_rows, k_trts.num_cols);
-
-	// compute Ks=Ks*scale^2
-	eigen_Ks *= Math::sq(m_method->get_scale());
-
-	// get shogun representation of cholesky and create eigen representation
-	SGMatrix<float64_t> L = m_method->get_cholesky();
-	Map<MatrixXd> eigen_L(L.matrix, L.num_rows, L.num_cols);
-
-	SGVector<float64_t> alpha = m_method->get_alpha();
-	const index_t n = k_trts.num_rows;
-	const index_t m = k_tsts.vlen;
-	const index_t C = alpha.vlen / n;
 	// result variance vector
-	SGVector<float64_t> s2(m * C * C);
+	s2 = SGVector<float64_t>(m * C * C);
 	Map<VectorXd> eigen_s2(s2.vector, s2.vlen);
 
-	if (eigen_L.isUpperTriangular() && !is_sparse)
+	if (eigen_L.isUpperTriangular() && !m_compiled_sparse)
 	{
-		if (alpha.vlen == L.num_rows)
+		if (m_compiled_alpha.vlen == m_compiled_L.num_rows)
 		{
 			// binary case
-			// get shogun of diagonal sigma vector and create eigen
-			// representation
-			SGVector<float64_t> sW = m_method->get_diagonal_vector();
-			Map<VectorXd> eigen_sW(sW.vector, sW.vlen);
+			Map<VectorXd> eigen_sW(m_compiled_sW.vector, m_compiled_sW.vlen);
 			// solve L' * V = sW * Ks and compute V.^2
 			MatrixXd eigen_V = eigen_L.triangularView<Upper>().adjoint().solve(
 			    eigen_sW.asDiagonal() * eigen_Ks);
@@ -197,9 +208,10 @@ GaussianProcess::get_posterior_variances(const std::shared_ptr<Features>& data)
 				Map<MatrixXd>& eigen_M = eigen_L;
 				eigen_s2.fill(0);
 
-				SGMatrix<float64_t> E = m_method->get_multiclass_E();
-				Map<MatrixXd> eigen_E(E.matrix, E.num_rows, E.num_cols);
-				ASSERT(E.num_cols == alpha.vlen);
+				Map<MatrixXd> eigen_E(
+				    m_compiled_E.matrix, m_compiled_E.num_rows,
+				    m_compiled_E.num_cols);
+				ASSERT(m_compiled_E.num_cols == m_compiled_alpha.vlen);
 				for (index_t bl_i = 0; bl_i < C; bl_i++)
 				{
 					// n by m
@@ -229,7 +241,7 @@ GaussianProcess::get_posterior_variances(const std::shared_ptr<Features>& data)
 			else
 			{
 				error("Unsupported inference method!");
-				return s2;
+				return;
 			}
 		}
 	}
@@ -239,6 +251,20 @@ GaussianProcess::get_posterior_variances(const std::shared_ptr<Features>& data)
 		MatrixXd eigen_M = eigen_Ks.cwiseProduct(eigen_L * eigen_Ks);
 		eigen_s2 = eigen_Kss_diag + eigen_M.colwise().sum().adjoint();
 	}
+}
+
+SGVector<float64_t>
+GaussianProcess::get_posterior_means(const std::shared_ptr<Features>& data)
+{
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
+	return mu;
+}
 
+SGVector<float64_t>
+GaussianProcess::get_posterior_variances(const std::shared_ptr<Features>& data)
+{
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 	return s2;
 }
@@ -96,6 +96,7 @@ namespace shogun
 		{
 
 			m_method = method;
+			m_posterior_compiled = false;
 		}
 
 		/** set training labels
@@ -131,10 +132,59 @@ namespace shogun
 			return false;
 		}
 
+		/** Incrementally updates a trained GP with new observations. The
+		 * inference method appends the points to its training set and
+		 * extends its Cholesky factorization instead of refactorizing, so
+		 * the update costs \f$O(n^2)\f$ per point instead of \f$O(n^3)\f$.
+		 * Only supported with ExactInferenceMethod
+		 *
+		 * @param data features of the new observations
+		 * @param lab labels of the new observations
+		 */
+		virtual void update_with_new_points(
+		    const std::shared_ptr<Features>& data,
+		    const std::shared_ptr<Labels>& lab);
+
+		/** Removes the oldest observations from a trained GP, downdating
+		 * the inference method's Cholesky factorization instead of
+		 * refactorizing. Together with update_with_new_points() this allows
+		 * cheap retraining on rolling windows. Only supported with
+		 * ExactInferenceMethod
+		 *
+		 * @param num_points number of observations to remove from the
+		 * beginning of the training set
+		 */
+		virtual void remove_oldest_points(int32_t num_points);
+
+		/** Precomputes and caches the quantities needed for prediction:
+		 * the alpha vector, the Cholesky factorization and related
+		 * matrices of the inference method, the prediction basis features
+		 * and a clone of the trained kernel. Subsequent predictions reuse
+		 * the cache instead of re-fetching and re-cloning per apply call.
+		 * Called automatically after training and whenever the
+		 * hyperparameters of the inference method have changed since the
+		 * last compilation
+		 */
+		virtual void compile_posterior();
+
 	private:
 		void init();
 
 	protected:
+		/** Computes posterior means and variances of a whole test feature
+		 * matrix in a single pass, sharing the kernel evaluations between
+		 * the mean and the variance instead of recomputing them per
+		 * quantity. Uses the compiled posterior cache, compiling it first
+		 * if needed
+		 *
+		 * @param data testing features
+		 * @param mu returned posterior means
+		 * @param s2 returned posterior variances
+		 */
+		void compute_posterior_stats(
+		    const std::shared_ptr<Features>& data, SGVector<float64_t>& mu,
+		    SGVector<float64_t>& s2);
+
 		/** inference method */
 		std::shared_ptr<Inference> m_method;
 		/** Whether predictive variance is computed in predictions. If true, the
@@ -144,6 +194,27 @@ namespace shogun
 		bool m_compute_variance;
 		/**use in inference method*/
 		std::shared_ptr<Features> m_inducing_features;
+
+		/** whether the compiled posterior cache is valid */
+		bool m_posterior_compiled;
+		/** cached alpha vector of the inference method */
+		SGVector<float64_t> m_compiled_alpha;
+		/** cached Cholesky decomposition of the inference method */
+		SGMatrix<float64_t> m_compiled_L;
+		/** cached diagonal vector of the inference method */
+		SGVector<float64_t> m_compiled_sW;
+		/** cached multiclass E matrix of the inference method */
+		SGMatrix<float64_t> m_compiled_E;
+		/** cached prediction basis (training or inducing) features */
+		std::shared_ptr<Features> m_compiled_feat;
+		/** cached clone of the trained kernel */
+		std::shared_ptr<Kernel> m_compiled_kernel;
+		/** cached mean function */
+		std::shared_ptr<MeanFunction> m_compiled_mean;
+		/** cached squared kernel scale */
+		float64_t m_compiled_scale2;
+		/** whether the cache was compiled for sparse inference */
+		bool m_compiled_sparse;
 	};
 } // namespace shogun
 #endif /* _GAUSSIANPROCESSMACHINE_H_ */
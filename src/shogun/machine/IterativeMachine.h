@@ -11,6 +11,7 @@
 
 #include <shogun/base/progress.h>
 #include <shogun/lib/SGVector.h>
+#include <shogun/lib/Telemetry.h>
 #include <shogun/lib/common.h>
 #include <shogun/machine/LinearMachine.h>
 
@@ -67,12 +68,14 @@ namespace shogun
 				COMPUTATION_CONTROLLERS
 				iteration();
 				m_current_iteration++;
+				SG_TELEMETRY(TRAIN_ITERATION, m_current_iteration);
 				pb.print_progress();
 			}
 			pb.complete();
 
 			if (m_complete)
 			{
+				SG_TELEMETRY(CONVERGED, m_current_iteration);
 				io::info(
 				    "{} converged after {} iterations.", this->get_name(),
 				    m_current_iteration);
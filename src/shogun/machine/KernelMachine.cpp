@@ -14,6 +14,7 @@
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/machine/KernelMachine.h>
+#include <shogun/mathematics/eigen3.h>
 #include <utility>
 
 #ifdef HAVE_OPENMP
@@ -327,6 +328,61 @@ SGVector<float64_t> KernelMachine::apply_get_outputs(const std::shared_ptr<Featu
 				output[i] = get_bias() + output[i];
 
 		}
+		else if (kernel->has_block_computation() &&
+				get_num_support_vectors()>0 &&
+				!(kernel->has_property(KP_LINADD) &&
+					kernel->get_is_initialized()))
+		{
+			SG_DEBUG("Blocked evaluation enabled")
+
+			int32_t num_sv=get_num_support_vectors();
+			SGVector<int32_t> sv_idx(num_sv);
+			SGVector<float64_t> sv_weight(num_sv);
+			bool packed_svs=true;
+			for (int32_t i=0; i<num_sv; i++)
+			{
+				sv_idx[i]=get_support_vector(i);
+				sv_weight[i]=get_alpha(i);
+				packed_svs&=(sv_idx[i]==i);
+			}
+
+			// score whole blocks of test examples against all support
+			// vectors at once instead of one kernel call per pair. After
+			// store_model_features() the support vectors form a packed
+			// contiguous block, so the tiles need no gather at all and
+			// scoring reduces to one matrix-vector product per tile.
+			const int32_t block_size=1024;
+			int32_t num_blocks=(num_vectors+block_size-1)/block_size;
+
+			Eigen::Map<Eigen::VectorXd> weight_map(sv_weight.vector, num_sv);
+
+			#pragma omp parallel
+			{
+				SGMatrix<float64_t> buffer(num_sv, block_size);
+
+				#pragma omp for schedule(dynamic)
+				for (int32_t b=0; b<num_blocks; b++)
+				{
+					int32_t col_start=b*block_size;
+					int32_t cols=CMath::min(block_size,
+							num_vectors-col_start);
+
+					if (packed_svs)
+						kernel->compute_block(0, num_sv, col_start, cols,
+								buffer.matrix, num_sv);
+					else
+						kernel->compute_rows(sv_idx.vector, num_sv,
+								col_start, cols, buffer.matrix, num_sv);
+
+					Eigen::Map<Eigen::MatrixXd> buffer_map(
+							buffer.matrix, num_sv, cols);
+					Eigen::Map<Eigen::VectorXd> out_map(
+							&output.vector[col_start], cols);
+					out_map.noalias()=buffer_map.transpose()*weight_map;
+					out_map.array()+=get_bias();
+				}
+			}
+		}
 		else
 		{
 			auto pb = SG_PROGRESS(range(num_vectors));
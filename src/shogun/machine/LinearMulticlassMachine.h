@@ -11,11 +11,17 @@
 
 #include <shogun/lib/config.h>
 
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/lib/common.h>
 #include <shogun/features/DotFeatures.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/lib/View.h>
 #include <shogun/machine/LinearMachine.h>
 #include <shogun/machine/MulticlassMachine.h>
 
+#include <vector>
+
 namespace shogun
 {
 
@@ -82,6 +88,77 @@ class LinearMulticlassMachine : public MulticlassMachine
 
 	protected:
 
+		/** train machine; with more than one thread the per-machine
+		 * binary problems of the multiclass strategy (one-vs-rest
+		 * classes, ECOC codeword columns) are trained concurrently on
+		 * independent clones sharing the read-only feature object,
+		 * otherwise the sequential base implementation is used */
+		bool train_machine(std::shared_ptr<Features> data = NULL) override
+		{
+			if (env()->get_num_threads() < 2)
+				return MulticlassMachine::train_machine(data);
+
+			init_strategy();
+
+			if (!data && !is_ready())
+				error("Please provide training data.");
+			else
+				init_machine_for_train(data);
+
+			int32_t num_vectors = get_num_rhs_vectors();
+			auto train_labels = std::make_shared<BinaryLabels>(num_vectors);
+
+			/* clone the prototype without its features so the clones share
+			 * the feature object instead of deep-copying it per machine */
+			auto prototype = m_machine->as<LinearMachine>();
+			prototype->set_features(NULL);
+
+			/* the strategy rewrites shared label and subset state per
+			 * machine, so the per-machine problems are snapshotted
+			 * sequentially (cheap label scans) and only the training
+			 * itself runs concurrently */
+			std::vector<std::shared_ptr<Machine>> machines;
+			m_multiclass_strategy->train_start(
+			    multiclass_labels(m_labels), train_labels);
+			while (m_multiclass_strategy->train_has_more())
+			{
+				SGVector<index_t> subset =
+				    m_multiclass_strategy->train_prepare_next();
+
+				auto machine = prototype->clone()->as<LinearMachine>();
+				if (subset.vlen)
+				{
+					SGVector<float64_t> labels(subset.vlen);
+					for (index_t i = 0; i < subset.vlen; i++)
+						labels[i] = train_labels->get_label(subset[i]);
+
+					machine->set_labels(std::make_shared<BinaryLabels>(labels));
+					machine->set_features(view(m_features, subset));
+				}
+				else
+				{
+					machine->set_labels(std::make_shared<BinaryLabels>(
+					    train_labels->get_labels().clone()));
+					machine->set_features(m_features);
+				}
+				machines.push_back(machine);
+			}
+			m_multiclass_strategy->train_stop();
+
+			prototype->set_features(m_features);
+
+			int32_t num_machines = (int32_t)machines.size();
+			#pragma omp parallel for
+			for (int32_t c = 0; c < num_machines; c++)
+				machines[c]->train();
+
+			m_machines.clear();
+			for (int32_t c = 0; c < num_machines; c++)
+				m_machines.push_back(get_machine_from_trained(machines[c]));
+
+			return true;
+		}
+
 		/** init machine for train with setting features */
 		bool init_machine_for_train(std::shared_ptr<Features> data) override
 		{
@@ -7,8 +7,10 @@
  */
 
 #include <rxcpp/rx-lite.hpp>
+#include <shogun/base/progress.h>
 #include <shogun/lib/Signal.h>
 #include <shogun/machine/Machine.h>
+#include <shogun/mathematics/Math.h>
 
 using namespace shogun;
 
@@ -147,6 +149,39 @@ std::shared_ptr<Labels> Machine::apply(std::shared_ptr<Features> data)
 	return result;
 }
 
+SGVector<float64_t> Machine::apply_get_outputs_chunked(int32_t num_vectors)
+{
+	require(num_vectors>=0, "Number of vectors ({}) must be non-negative",
+		num_vectors);
+
+	SGVector<float64_t> outputs(num_vectors);
+	if (supports_parallel_apply())
+	{
+		// contiguous chunks keep each thread on a cache-friendly index
+		// range while dynamic scheduling balances machines whose
+		// per-vector cost varies
+		const int32_t chunk_size=256;
+		int32_t num_chunks=(num_vectors+chunk_size-1)/chunk_size;
+#pragma omp parallel for schedule(dynamic)
+		for (int32_t c=0; c<num_chunks; c++)
+		{
+			int32_t start=c*chunk_size;
+			int32_t end=Math::min(start+chunk_size, num_vectors);
+			for (int32_t i=start; i<end; i++)
+				outputs[i]=apply_one(i);
+		}
+	}
+	else
+	{
+		for (auto i : SG_PROGRESS(range(num_vectors)))
+		{
+			COMPUTATION_CONTROLLERS
+			outputs[i]=apply_one(i);
+		}
+	}
+	return outputs;
+}
+
 std::shared_ptr<BinaryLabels> Machine::apply_binary(std::shared_ptr<Features> data)
 {
 	error("This machine does not support apply_binary()");
@@ -282,6 +282,32 @@ class Machine : public StoppableSGObject
 			return false;
 		}
 
+		/** Whether apply_one() may be evaluated concurrently for different
+		 * indices.
+		 *
+		 * Machines whose apply_one() only reads the model and the features
+		 * can opt in, which lets apply_get_outputs_chunked() spread the
+		 * prediction of a test set across the available threads. The
+		 * default is false since apply_one() implementations commonly
+		 * score into shared scratch buffers.
+		 */
+		virtual bool supports_parallel_apply() const
+		{
+			return false;
+		}
+
+		/** Compute apply_one() for all indices in [0, num_vectors).
+		 *
+		 * When the machine opts in via supports_parallel_apply(), the index
+		 * range is split into contiguous chunks which are predicted across
+		 * the available threads; otherwise a serial loop is used. The
+		 * outputs are returned in index order either way.
+		 *
+		 * @param num_vectors number of vectors to apply the machine to
+		 * @return the outputs of apply_one() per index
+		 */
+		SGVector<float64_t> apply_get_outputs_chunked(int32_t num_vectors);
+
 		/** Continue Training
 		 *
 		 * This method can be used to continue a prematurely stopped
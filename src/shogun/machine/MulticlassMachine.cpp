@@ -123,22 +123,41 @@ std::shared_ptr<MulticlassLabels> MulticlassMachine::apply_multiclass(std::share
 				outputs[i]->scores_to_probabilities(0,0);
 		}
 
-		SGVector<float64_t> output_for_i(num_machines);
-		SGVector<float64_t> r_output_for_i(num_machines);
-		if (heuris!=PROB_HEURIS_NONE)
-			r_output_for_i.resize_vector(num_classes);
-
-		for (int32_t i=0; i<num_vectors; i++)
+		if (heuris==PROB_HEURIS_NONE)
 		{
+			/* without rescaling the samples are independent, so the
+			 * machines x samples output matrix is assembled once and the
+			 * strategy decodes all samples in one pass; ECOC strategies
+			 * decode such blocks with dense matrix products */
+			SGMatrix<float64_t> output_matrix(num_machines, num_vectors);
 			for (int32_t j=0; j<num_machines; j++)
-				output_for_i[j] = outputs[j]->get_value(i);
+			{
+				for (int32_t i=0; i<num_vectors; i++)
+					output_matrix(j,i) = outputs[j]->get_value(i);
+			}
+
+			SGVector<int32_t> decided=m_multiclass_strategy->decide_labels(output_matrix);
 
-			if (heuris==PROB_HEURIS_NONE)
+			SGVector<float64_t> output_for_i(num_machines);
+			for (int32_t i=0; i<num_vectors; i++)
 			{
-				r_output_for_i = output_for_i;
+				for (int32_t j=0; j<num_machines; j++)
+					output_for_i[j] = output_matrix(j,i);
+
+				result->set_label(i, decided[i]);
+				result->set_multiclass_confidences(i, output_for_i);
 			}
-			else
+		}
+		else
+		{
+			SGVector<float64_t> output_for_i(num_machines);
+			SGVector<float64_t> r_output_for_i(num_classes);
+
+			for (int32_t i=0; i<num_vectors; i++)
 			{
+				for (int32_t j=0; j<num_machines; j++)
+					output_for_i[j] = outputs[j]->get_value(i);
+
 				if (heuris==OVA_SOFTMAX)
 					m_multiclass_strategy->rescale_outputs(output_for_i,As,Bs);
 				else
@@ -150,11 +169,11 @@ std::shared_ptr<MulticlassLabels> MulticlassMachine::apply_multiclass(std::share
 
 				SG_DEBUG("{}::apply_multiclass(): sum(r_output_for_i) = {}",
 					get_name(), SGVector<float64_t>::sum(r_output_for_i.vector,num_classes));
-			}
 
-			// use rescaled outputs for label decision
-			result->set_label(i, m_multiclass_strategy->decide_label(r_output_for_i));
-			result->set_multiclass_confidences(i, r_output_for_i);
+				// use rescaled outputs for label decision
+				result->set_label(i, m_multiclass_strategy->decide_label(r_output_for_i));
+				result->set_multiclass_confidences(i, r_output_for_i);
+			}
 		}
 		outputs.clear();
 
@@ -4,6 +4,10 @@
  * Authors: Wuwei Lin
  */
 
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/io/fs/FileSystem.h>
+#include <shogun/io/serialization/BitseryDeserializer.h>
+#include <shogun/io/serialization/BitserySerializer.h>
 #include <shogun/lib/exception/InvalidStateException.h>
 #include <shogun/machine/Pipeline.h>
 #include <sstream>
@@ -107,10 +111,106 @@ namespace shogun
 
 	Pipeline::Pipeline() : Machine()
 	{
+		m_cache_enabled = false;
+		m_max_cached_in_memory = 8;
 	}
 
 	Pipeline::~Pipeline()
 	{
+		clear_cache();
+	}
+
+	void Pipeline::set_cache_enabled(bool enabled)
+	{
+		m_cache_enabled = enabled;
+		if (!enabled)
+			clear_cache();
+	}
+
+	void Pipeline::set_cache_path(
+	    const std::string& path_prefix, index_t max_in_memory_entries)
+	{
+		require(
+		    max_in_memory_entries > 0,
+		    "At least one cache entry must be kept in memory, got {}",
+		    max_in_memory_entries);
+		m_cache_path = path_prefix;
+		m_max_cached_in_memory = max_in_memory_entries;
+	}
+
+	void Pipeline::clear_cache()
+	{
+		auto fs = env();
+		for (auto&& entry : m_feature_cache)
+		{
+			if (!entry.second.spill_file.empty())
+				fs->delete_file(entry.second.spill_file);
+		}
+		m_feature_cache.clear();
+	}
+
+	size_t Pipeline::cache_key(
+	    const std::shared_ptr<Transformer>& transformer,
+	    const std::shared_ptr<Features>& input)
+	{
+		/* content-addressed: parameter hash of the stage combined with
+		 * the parameter hash of its input features */
+		size_t key = transformer->hash();
+		key ^= input->hash() + 0x9e3779b9 + (key << 6) + (key >> 2);
+		return key;
+	}
+
+	std::shared_ptr<Features> Pipeline::cache_lookup(
+	    size_t key, std::shared_ptr<Transformer>* fitted_transformer)
+	{
+		auto it = m_feature_cache.find(key);
+		if (it == m_feature_cache.end())
+			return nullptr;
+
+		if (fitted_transformer)
+			*fitted_transformer = it->second.fitted_transformer;
+
+		if (it->second.features)
+			return it->second.features;
+
+		SG_DEBUG("reloading spilled cache entry {}", it->second.spill_file)
+		return io::deserialize(
+		           it->second.spill_file,
+		           std::make_shared<io::BitseryDeserializer>())
+		    ->as<Features>();
+	}
+
+	void Pipeline::cache_store(
+	    size_t key, const std::shared_ptr<Transformer>& fitted_transformer,
+	    const std::shared_ptr<Features>& features)
+	{
+		CacheEntry entry;
+		entry.fitted_transformer = fitted_transformer;
+
+		index_t in_memory = 0;
+		for (auto&& cached : m_feature_cache)
+		{
+			if (cached.second.features)
+				in_memory++;
+		}
+
+		if (in_memory < m_max_cached_in_memory || m_cache_path.empty())
+		{
+			entry.features = features;
+		}
+		else
+		{
+			/* over budget: spill the features to disk, the (small)
+			 * fitted transformer stays in memory */
+			entry.spill_file =
+			    m_cache_path + "." + std::to_string(key) + ".cache";
+			io::serialize(
+			    entry.spill_file, features,
+			    std::make_shared<io::BitserySerializer>());
+			SG_DEBUG("spilled cache entry to {}", entry.spill_file)
+		}
+
+		m_feature_cache[key] = entry;
 	}
 
 	bool Pipeline::train_machine(std::shared_ptr<Features> data)
@@ -125,11 +225,31 @@ namespace shogun
 			if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
 			{
 				auto transformer = shogun::get<std::shared_ptr<Transformer>>(stage.second);
+
+				size_t key = 0;
+				if (m_cache_enabled && current_data)
+				{
+					key = cache_key(transformer, current_data);
+					std::shared_ptr<Transformer> fitted;
+					auto cached = cache_lookup(key, &fitted);
+					if (cached && fitted)
+					{
+						/* reuse the fitted transformer so apply()
+						 * stays consistent with the cached features */
+						stage.second = fitted;
+						current_data = cached;
+						continue;
+					}
+				}
+
 				transformer->train_require_labels()
 				    ? transformer->fit(current_data, m_labels)
 				    : transformer->fit(current_data);
 
 				current_data = transformer->transform(current_data);
+
+				if (m_cache_enabled && key != 0 && current_data)
+					cache_store(key, transformer, current_data);
 			}
 			else
 			{
@@ -150,7 +270,23 @@ namespace shogun
 			if (holds_alternative<std::shared_ptr<Transformer>>(stage.second))
 			{
 				auto transformer = shogun::get<std::shared_ptr<Transformer>>(stage.second);
+
+				size_t key = 0;
+				if (m_cache_enabled && current_data)
+				{
+					key = cache_key(transformer, current_data);
+					auto cached = cache_lookup(key, nullptr);
+					if (cached)
+					{
+						current_data = cached;
+						continue;
+					}
+				}
+
 				current_data = transformer->transform(current_data);
+
+				if (m_cache_enabled && key != 0 && current_data)
+					cache_store(key, nullptr, current_data);
 			}
 			else
 			{
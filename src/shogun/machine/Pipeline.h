@@ -10,6 +10,7 @@
 #include <shogun/base/variant.h>
 #include <shogun/machine/Machine.h>
 #include <shogun/transformer/Transformer.h>
+#include <map>
 #include <utility>
 
 namespace shogun
@@ -119,12 +120,81 @@ namespace shogun
 
 		EProblemType get_machine_problem_type() const override;
 
+		/** Enable caching of intermediate transformed features. Cache
+		 * entries are content-addressed on the parameter hash of the
+		 * stage and of its input features, so retraining the pipeline
+		 * with only the final machine's hyperparameters changed reuses
+		 * the transformer front instead of refitting and re-applying
+		 * it. On a hit during training, the cached fitted transformer
+		 * replaces the stage, keeping apply() consistent with the
+		 * reused features. The cache is not part of the pipeline's
+		 * parameters and is not carried over by clone().
+		 * @param enabled whether to cache intermediate features
+		 */
+		void set_cache_enabled(bool enabled);
+
+		/** Set an optional disk spill location for the feature cache.
+		 * When more than @p max_in_memory_entries feature sets are
+		 * cached, further entries are serialized to
+		 * "<path_prefix>.<key>.cache" and reloaded on demand. Fitted
+		 * transformers always stay in memory; only the (large)
+		 * transformed features are spilled.
+		 * @param path_prefix prefix of spill files
+		 * @param max_in_memory_entries entries kept in memory
+		 */
+		void set_cache_path(
+		    const std::string& path_prefix,
+		    index_t max_in_memory_entries = 8);
+
+		/** Drop all cached entries. Spill files are deleted. */
+		void clear_cache();
+
 	protected:
 		bool train_machine(std::shared_ptr<Features> data = NULL) override;
 
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+		/** one cached stage result */
+		struct CacheEntry
+		{
+			/** fitted transformer (only for entries cached during
+			 * training) */
+			std::shared_ptr<Transformer> fitted_transformer;
+			/** transformed features, empty when spilled to disk */
+			std::shared_ptr<Features> features;
+			/** spill file holding the features, empty when in memory */
+			std::string spill_file;
+		};
+#endif
+
+		/** content-addressed key of one stage application */
+		static size_t cache_key(
+		    const std::shared_ptr<Transformer>& transformer,
+		    const std::shared_ptr<Features>& input);
+
+		/** looks up a cache entry, reloading spilled features */
+		std::shared_ptr<Features> cache_lookup(
+		    size_t key, std::shared_ptr<Transformer>* fitted_transformer);
+
+		/** stores a stage result, spilling to disk when over budget */
+		void cache_store(
+		    size_t key, const std::shared_ptr<Transformer>& fitted_transformer,
+		    const std::shared_ptr<Features>& features);
+
 		std::vector<std::pair<std::string, variant<std::shared_ptr<Transformer>, std::shared_ptr<Machine>>>>
 		    m_stages;
 		bool train_require_labels() const override;
+
+		/** whether intermediate features are cached */
+		bool m_cache_enabled;
+
+		/** cached stage results by content key */
+		std::map<size_t, CacheEntry> m_feature_cache;
+
+		/** prefix of spill files, disk spill disabled when empty */
+		std::string m_cache_path;
+
+		/** number of feature sets kept in memory before spilling */
+		index_t m_max_cached_in_memory;
 	};
 }
 
@@ -32,6 +32,8 @@
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/multiclass/tree/RandomCARTree.h>
 
+#include <cstring>
+#include <fstream>
 #include <utility>
 
 using namespace shogun;
@@ -199,6 +201,102 @@ SGVector<float64_t> RandomForest::get_feature_importances() const
 	return feat_importances;
 }
 
+namespace
+{
+	const char kCompactForestMagic[4]={'S','G','R','F'};
+	const int32_t kCompactForestVersion=1;
+}
+
+void RandomForest::save_compact(const std::string& filename) const
+{
+	require(m_bags.size()>0, "Forest not trained");
+
+	std::ofstream f(filename, std::ios::binary);
+	require(f.is_open(), "Could not open '{}' for writing", filename.c_str());
+
+	int32_t num_trees=(int32_t)m_bags.size();
+	int32_t mode=(int32_t)get_machine_problem_type();
+	f.write(kCompactForestMagic, sizeof(kCompactForestMagic));
+	f.write((const char*)&kCompactForestVersion, sizeof(int32_t));
+	f.write((const char*)&num_trees, sizeof(int32_t));
+	f.write((const char*)&mode, sizeof(int32_t));
+
+	for (int32_t t=0; t<num_trees; t++)
+	{
+		SGVector<int32_t> attributes;
+		SGVector<float64_t> thresholds;
+		SGVector<int32_t> left_children;
+		SGVector<float64_t> labels;
+		require(
+		    m_bags[t]->as<CARTree>()->export_compiled(
+		        attributes, thresholds, left_children, labels),
+		    "Tree {} contains nominal splits and cannot be packed; use "
+		    "the generic serializers for forests over nominal features",
+		    t);
+
+		int32_t num_nodes=attributes.vlen;
+		f.write((const char*)&num_nodes, sizeof(int32_t));
+		f.write((const char*)attributes.vector, num_nodes*sizeof(int32_t));
+		f.write((const char*)thresholds.vector, num_nodes*sizeof(float64_t));
+		f.write((const char*)left_children.vector, num_nodes*sizeof(int32_t));
+		f.write((const char*)labels.vector, num_nodes*sizeof(float64_t));
+	}
+
+	require(f.good(), "Writing '{}' failed", filename.c_str());
+}
+
+void RandomForest::load_compact(const std::string& filename)
+{
+	std::ifstream f(filename, std::ios::binary);
+	require(f.is_open(), "Could not open '{}' for reading", filename.c_str());
+
+	char magic[4];
+	int32_t version, num_trees, mode;
+	f.read(magic, sizeof(magic));
+	f.read((char*)&version, sizeof(int32_t));
+	f.read((char*)&num_trees, sizeof(int32_t));
+	f.read((char*)&mode, sizeof(int32_t));
+	require(
+	    f.good() && memcmp(magic, kCompactForestMagic, sizeof(magic))==0,
+	    "'{}' is not a packed forest", filename.c_str());
+	require(
+	    version==kCompactForestVersion,
+	    "Unsupported packed forest version {}", version);
+	require(num_trees>0, "Packed forest holds no trees");
+
+	m_bags.clear();
+	m_bags.reserve(num_trees);
+	for (int32_t t=0; t<num_trees; t++)
+	{
+		int32_t num_nodes=0;
+		f.read((char*)&num_nodes, sizeof(int32_t));
+		require(f.good() && num_nodes>0, "Truncated packed forest '{}'", filename.c_str());
+
+		SGVector<int32_t> attributes(num_nodes);
+		SGVector<float64_t> thresholds(num_nodes);
+		SGVector<int32_t> left_children(num_nodes);
+		SGVector<float64_t> labels(num_nodes);
+		f.read((char*)attributes.vector, num_nodes*sizeof(int32_t));
+		f.read((char*)thresholds.vector, num_nodes*sizeof(float64_t));
+		f.read((char*)left_children.vector, num_nodes*sizeof(int32_t));
+		f.read((char*)labels.vector, num_nodes*sizeof(float64_t));
+		require(f.good(), "Truncated packed forest '{}'", filename.c_str());
+
+		auto tree=std::make_shared<RandomCARTree>();
+		tree->set_machine_problem_type((EProblemType)mode);
+		tree->import_compiled(attributes, thresholds, left_children, labels);
+		m_bags.push_back(tree);
+	}
+
+	m_num_bags=num_trees;
+	set_machine_problem_type((EProblemType)mode);
+
+	// out-of-bag state belongs to a training run, not to a restored model
+	m_oob_indices.clear();
+	m_all_oob_idx=SGVector<bool>();
+	m_oob_outputs=SGMatrix<float64_t>();
+}
+
 void RandomForest::init()
 {
 	m_machine=std::make_shared<RandomCARTree>();
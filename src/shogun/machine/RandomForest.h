@@ -144,6 +144,27 @@ public:
 	 */
 	SGVector<float64_t> get_feature_importances() const;
 
+	/** save the trained forest as one packed binary blob: per tree the
+	 * flattened (attribute, threshold, child, label) arrays, written
+	 * back-to-back. Orders of magnitude smaller and faster than walking
+	 * the TreeMachineNode object graph through the generic serializers.
+	 * Only forests over continuous features can be packed, since nominal
+	 * split value sets have no flat layout.
+	 *
+	 * @param filename file to write the blob to
+	 */
+	void save_compact(const std::string& filename) const;
+
+	/** restore a forest saved with save_compact(). The flat arrays are
+	 * bulk-read straight into the flattened prediction layout, so no
+	 * node graph is rebuilt and load time is dominated by the read
+	 * itself. Only prediction state is restored: labels, combination
+	 * rule and training-time settings stay as configured on this object.
+	 *
+	 * @param filename file to read the blob from
+	 */
+	void load_compact(const std::string& filename);
+
 protected:
 
 	bool train_machine(std::shared_ptr<Features> data=NULL) override;
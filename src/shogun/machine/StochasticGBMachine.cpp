@@ -33,6 +33,7 @@
 #include <shogun/machine/StochasticGBMachine.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/multiclass/tree/CARTree.h>
 #include <shogun/optimization/lbfgs/lbfgs.h>
 
 using namespace shogun;
@@ -134,6 +135,20 @@ float64_t StochasticGBMachine::get_learning_rate() const
 	return m_learning_rate;
 }
 
+void StochasticGBMachine::set_histogram_bins(int32_t num_bins)
+{
+	require(num_bins==0 || (num_bins>=2 && num_bins<=256),
+		"Number of bins should be 0 (disabled) or in [2,256]. "
+		"Supplied value is {}",num_bins);
+
+	m_num_bins=num_bins;
+}
+
+int32_t StochasticGBMachine::get_histogram_bins() const
+{
+	return m_num_bins;
+}
+
 std::shared_ptr<RegressionLabels> StochasticGBMachine::apply_regression(std::shared_ptr<Features> data)
 {
 	require(data,"test data supplied is NULL");
@@ -170,6 +185,20 @@ bool StochasticGBMachine::train_machine(std::shared_ptr<Features> data)
 
 	auto feats=data->as<DenseFeatures<float64_t>>();
 
+	if (m_num_bins>0)
+	{
+		auto tree=std::dynamic_pointer_cast<CARTree>(m_machine);
+		require(
+		    tree, "Quantized-feature boosting requires a CARTree base "
+		    "machine, {} supplied", m_machine->get_name());
+
+		// quantize the full training data once; every boosted tree
+		// reuses these edges instead of re-quantizing (or sorting) its
+		// random subset each iteration
+		tree->set_histogram_bins(m_num_bins);
+		m_bin_edges=tree->pre_compute_bin_edges(feats);
+	}
+
 	// initialize weak learners array and gamma array
 	initialize_learners();
 
@@ -236,6 +265,11 @@ std::shared_ptr<Machine> StochasticGBMachine::fit_model(const std::shared_ptr<De
 {
 	// clone base machine
 	auto c=m_machine->clone()->as<Machine>();
+
+	// histogram trees share the bin edges computed up front
+	if (m_num_bins>0)
+		c->as<CARTree>()->set_bin_edges(m_bin_edges);
+
 	// train cloned machine
 	c->set_labels(labels);
 	c->train(feats);
@@ -249,11 +283,15 @@ std::shared_ptr<RegressionLabels> StochasticGBMachine::compute_pseudo_residuals(
 	auto labels = labs->as<DenseLabels>()->get_labels();
 	SGVector<float64_t> f=inter_f->get_labels();
 
-	SGVector<float64_t> residuals(f.vlen);
-	for (int32_t i=0;i<residuals.vlen;i++)
-		residuals[i]=-m_loss->first_derivative(f[i],labels[i]);
+	// the gradient buffer is reused across iterations; the weak learner
+	// fitted on it does not keep the labels around after training
+	if (m_pseudo_residuals.vlen!=f.vlen)
+		m_pseudo_residuals=SGVector<float64_t>(f.vlen);
+	m_loss->first_derivative(f,labels,m_pseudo_residuals);
+	for (int32_t i=0;i<m_pseudo_residuals.vlen;i++)
+		m_pseudo_residuals[i]=-m_pseudo_residuals[i];
 
-	return std::make_shared<RegressionLabels>(residuals);
+	return std::make_shared<RegressionLabels>(m_pseudo_residuals);
 }
 
 std::tuple<std::shared_ptr<DenseFeatures<float64_t>>, std::shared_ptr<RegressionLabels>,
@@ -373,6 +411,7 @@ void StochasticGBMachine::init()
 	m_num_iter=0;
 	m_subset_frac=0;
 	m_learning_rate=0;
+	m_num_bins=0;
 
 	m_weak_learners.clear();
 	m_gamma.clear();
@@ -384,4 +423,6 @@ void StochasticGBMachine::init()
 	SG_ADD(&m_learning_rate, kLearningRate, "learning rate");
 	SG_ADD(&m_weak_learners, kWeakLearners, "array of weak learners");
 	SG_ADD(&m_gamma, kGamma, "array of learner weights");
+	SG_ADD(&m_num_bins, kNumBins,
+		"number of quantile bins for quantized-feature boosting");
 }
@@ -135,6 +135,23 @@ public:
 	 */
 	float64_t get_learning_rate() const;
 
+	/** enable quantized-feature boosting: the training data is binned
+	 * into per-feature quantile histograms once up front and every
+	 * boosted tree reuses the shared bin edges instead of sorting (or
+	 * re-quantizing) its random subset each iteration. Requires the base
+	 * machine to be a CARTree. See CARTree::set_histogram_bins() for the
+	 * thresholds-at-bin-edges trade-off.
+	 *
+	 * @param num_bins number of quantile bins (2..256), 0 disables
+	 */
+	void set_histogram_bins(int32_t num_bins);
+
+	/** get number of histogram bins
+	 *
+	 * @return number of bins, 0 if quantized-feature mode is disabled
+	 */
+	int32_t get_histogram_bins() const;
+
 	/** apply_regression
 	 *
 	 * @param data test data
@@ -231,6 +248,15 @@ protected:
 
 	/** gamma - weak learner weights */
 	std::vector<float64_t> m_gamma;
+
+	/** number of quantile bins for quantized-feature boosting, 0 disables */
+	int32_t m_num_bins;
+
+	/** bin edges shared by all boosted trees, computed once per train */
+	SGMatrix<float64_t> m_bin_edges;
+
+	/** persistent pseudo-residual buffer reused across iterations */
+	SGVector<float64_t> m_pseudo_residuals;
 #ifndef SWIG
 public:
 	static constexpr std::string_view kMachine = "machine";
@@ -240,6 +266,7 @@ public:
 	static constexpr std::string_view kLearningRate = "learning_rate";
 	static constexpr std::string_view kWeakLearners = "weak_learners";
 	static constexpr std::string_view kGamma = "gamma";
+	static constexpr std::string_view kNumBins = "num_bins";
 #endif
 };
 }/* shogun */
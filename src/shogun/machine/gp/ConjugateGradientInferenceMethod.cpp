@@ -0,0 +1,591 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/machine/gp/ConjugateGradientInferenceMethod.h>
+
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/machine/visitors/ShapeVisitor.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
+#include <shogun/mathematics/linalg/linsolver/ConjugateGradientSolver.h>
+#include <shogun/mathematics/linalg/ratapprox/tracesampler/NormalSampler.h>
+#ifdef HAVE_LAPACK
+#include <shogun/mathematics/linalg/eigsolver/LanczosEigenSolver.h>
+#include <shogun/mathematics/linalg/linsolver/CGMShiftedFamilySolver.h>
+#include <shogun/mathematics/linalg/ratapprox/logdet/LogDetEstimator.h>
+#include <shogun/mathematics/linalg/ratapprox/logdet/opfunc/LogRationalApproximationCGM.h>
+#endif //HAVE_LAPACK
+
+#include <utility>
+
+using namespace shogun;
+using namespace Eigen;
+
+namespace shogun
+{
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+/** Dense operator that stores the matrix in single precision and applies it
+ * with float64 accumulation, halving the memory of the solve working set */
+class SinglePrecisionDenseOperator : public LinearOperator<float64_t>
+{
+public:
+	SinglePrecisionDenseOperator() : LinearOperator<float64_t>()
+	{
+	}
+
+	explicit SinglePrecisionDenseOperator(SGMatrix<float32_t> op)
+		: LinearOperator<float64_t>(op.num_rows), m_operator(op)
+	{
+	}
+
+	const char* get_name() const override
+	{
+		return "SinglePrecisionDenseOperator";
+	}
+
+	SGVector<float64_t> apply(SGVector<float64_t> b) const override
+	{
+		require(b.vlen==m_dimension, "Dimension mismatch! {} vs {}",
+			b.vlen, m_dimension);
+
+		SGVector<float64_t> result(m_dimension);
+		Map<VectorXd> eigen_result(result.vector, result.vlen);
+		Map<VectorXd> eigen_b(b.vector, b.vlen);
+		Map<MatrixXf> eigen_op(m_operator.matrix, m_operator.num_rows,
+			m_operator.num_cols);
+
+		eigen_result=eigen_op.cast<float64_t>()*eigen_b;
+
+		return result;
+	}
+
+private:
+	/** the single precision matrix */
+	SGMatrix<float32_t> m_operator;
+};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+}
+
+ConjugateGradientInferenceMethod::ConjugateGradientInferenceMethod() : Inference()
+{
+	init();
+}
+
+ConjugateGradientInferenceMethod::ConjugateGradientInferenceMethod(
+		std::shared_ptr<Kernel> kern, std::shared_ptr<Features> feat,
+		std::shared_ptr<MeanFunction> m, std::shared_ptr<Labels> lab,
+		std::shared_ptr<LikelihoodModel> mod) :
+		Inference(std::move(kern), std::move(feat), std::move(m), std::move(lab),
+			std::move(mod))
+{
+	init();
+}
+
+void ConjugateGradientInferenceMethod::init()
+{
+	m_log_det=0;
+	m_num_logdet_estimates=20;
+	m_num_probes=20;
+	m_logdet_accuracy=1e-5;
+	m_use_single_precision=false;
+	m_refine_tolerance=1e-10;
+	m_max_refine_iter=5;
+	m_linear_solver=std::make_shared<ConjugateGradientSolver>();
+
+	SG_ADD(&m_use_single_precision, "use_single_precision",
+		"Whether the system matrix is stored in single precision");
+	SG_ADD(&m_refine_tolerance, "refine_tolerance",
+		"Relative residual tolerance of the iterative refinement");
+	SG_ADD(&m_max_refine_iter, "max_refine_iter",
+		"Maximum number of iterative refinement steps");
+	SG_ADD(&m_num_logdet_estimates, "num_logdet_estimates",
+		"Number of log-determinant estimates averaged in the likelihood");
+	SG_ADD(&m_num_probes, "num_probes",
+		"Number of probe vectors for the derivative trace estimates");
+	SG_ADD(&m_logdet_accuracy, "logdet_accuracy",
+		"Accuracy of the rational approximation of the log function");
+	SG_ADD((std::shared_ptr<SGObject>*)&m_linear_solver, "linear_solver",
+		"Iterative solver for the linear systems");
+}
+
+ConjugateGradientInferenceMethod::~ConjugateGradientInferenceMethod()
+{
+}
+
+void ConjugateGradientInferenceMethod::register_minimizer(std::shared_ptr<Minimizer> minimizer)
+{
+	io::warn("The method does not require a minimizer. The provided minimizer will not be used.");
+}
+
+void ConjugateGradientInferenceMethod::set_linear_solver(
+		std::shared_ptr<IterativeLinearSolver<float64_t, float64_t>> solver)
+{
+	require(solver, "Given linear solver should not be NULL");
+	m_linear_solver=std::move(solver);
+}
+
+void ConjugateGradientInferenceMethod::set_num_logdet_estimates(index_t num_estimates)
+{
+	require(num_estimates>0, "The number ({}) of log-determinant estimates "
+		"should be positive", num_estimates);
+	m_num_logdet_estimates=num_estimates;
+}
+
+void ConjugateGradientInferenceMethod::set_num_probe_vectors(index_t num_probes)
+{
+	require(num_probes>0, "The number ({}) of probe vectors should be positive",
+		num_probes);
+	m_num_probes=num_probes;
+}
+
+void ConjugateGradientInferenceMethod::set_single_precision_storage(bool enable)
+{
+	m_use_single_precision=enable;
+}
+
+std::shared_ptr<ConjugateGradientInferenceMethod> ConjugateGradientInferenceMethod::obtain_from_generic(
+		const std::shared_ptr<Inference>& inference)
+{
+	if (inference==NULL)
+		return NULL;
+
+	if (inference->get_inference_type()!=INF_CG_REGRESSION)
+		error("Provided inference is not of type ConjugateGradientInferenceMethod!");
+
+	return inference->as<ConjugateGradientInferenceMethod>();
+}
+
+void ConjugateGradientInferenceMethod::check_members() const
+{
+	Inference::check_members();
+
+	require(m_model->get_model_type()==LT_GAUSSIAN,
+		"CG inference method can only use Gaussian likelihood function");
+	require(m_labels->get_label_type()==LT_REGRESSION,
+		"Labels must be type of CRegressionLabels");
+}
+
+void ConjugateGradientInferenceMethod::update()
+{
+	SG_TRACE("entering");
+
+	Inference::update();
+	update_chol();
+	update_alpha();
+	m_gradient_update=false;
+	update_parameter_hash();
+
+	SG_TRACE("leaving");
+}
+
+void ConjugateGradientInferenceMethod::compute_gradient()
+{
+	Inference::compute_gradient();
+
+	if (!m_gradient_update)
+	{
+		update_deriv();
+		update_mean();
+		m_gradient_update=true;
+		update_parameter_hash();
+	}
+}
+
+void ConjugateGradientInferenceMethod::update_chol()
+{
+	// get the sigma variable from the Gaussian likelihood model
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+
+	const index_t n=m_ktrtr.num_rows;
+
+	// form the system matrix A=K*scale^2+sigma^2*I once; all solves and the
+	// log-determinant estimate run against it as a linear operator
+	Map<MatrixXd> eigen_K(m_ktrtr.matrix, n, n);
+	if (m_use_single_precision)
+	{
+		m_A=SGMatrix<float64_t>();
+		m_A_single=SGMatrix<float32_t>(n, n);
+		Map<MatrixXf> eigen_A(m_A_single.matrix, n, n);
+		eigen_A = (eigen_K * std::exp(m_log_scale * 2.0) +
+		    Math::sq(sigma) * MatrixXd::Identity(n, n)).cast<float32_t>();
+	}
+	else
+	{
+		m_A_single=SGMatrix<float32_t>();
+		m_A=SGMatrix<float64_t>(n, n);
+		Map<MatrixXd> eigen_A(m_A.matrix, n, n);
+		eigen_A = eigen_K * std::exp(m_log_scale * 2.0) +
+		    Math::sq(sigma) * MatrixXd::Identity(n, n);
+	}
+
+	// the dense Cholesky factor is only needed by the predictive covariance
+	// paths and is recomputed on demand
+	m_L=SGMatrix<float64_t>();
+
+#ifdef HAVE_LAPACK
+	// estimate log|A| with the rational approximation of log applied to
+	// Gaussian trace samples, solved with the shifted family CG solver
+	auto op=create_system_operator();
+	auto eig_solver=std::make_shared<LanczosEigenSolver>(op);
+	auto shifted_solver=std::make_shared<CGMShiftedFamilySolver>();
+	auto op_log=std::make_shared<LogRationalApproximationCGM>(op, eig_solver,
+		shifted_solver, m_logdet_accuracy);
+	auto sampler=std::make_shared<NormalSampler>(n);
+	auto estimator=std::make_shared<LogDetEstimator>(sampler, op_log);
+
+	SGVector<float64_t> estimates=estimator->sample(m_num_logdet_estimates);
+	m_log_det=SGVector<float64_t>::sum(estimates)/estimates.vlen;
+#else
+	// without LAPACK there is no Lanczos solver for the rational
+	// approximation, so fall back to the dense factorization
+	compute_dense_cholesky();
+	Map<MatrixXd> eigen_L(m_L.matrix, m_L.num_rows, m_L.num_cols);
+	m_log_det = 2.0 * eigen_L.diagonal().array().log().sum() +
+	    n * std::log(Math::sq(sigma));
+#endif //HAVE_LAPACK
+}
+
+void ConjugateGradientInferenceMethod::compute_dense_cholesky()
+{
+	// get the sigma variable from the Gaussian likelihood model
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+
+	m_L=SGMatrix<float64_t>(m_ktrtr.num_rows, m_ktrtr.num_cols);
+
+	// same factor as in ExactInferenceMethod, so the prediction paths of
+	// GaussianProcess can be shared
+	Map<MatrixXd> K(m_ktrtr.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+	Map<MatrixXd> L(m_L.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+	LLT<MatrixXd> llt(
+	    K * (std::exp(m_log_scale * 2.0) / Math::sq(sigma)) +
+	    MatrixXd::Identity(m_ktrtr.num_rows, m_ktrtr.num_cols));
+	L=llt.matrixU();
+}
+
+std::shared_ptr<LinearOperator<float64_t>>
+ConjugateGradientInferenceMethod::create_system_operator() const
+{
+	if (m_use_single_precision)
+		return std::make_shared<SinglePrecisionDenseOperator>(m_A_single);
+
+	return std::make_shared<DenseMatrixOperator<float64_t>>(m_A);
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::solve_system(
+		SGVector<float64_t> b)
+{
+	auto op=create_system_operator();
+	SGVector<float64_t> x=m_linear_solver->solve(op, b);
+
+	if (m_use_single_precision)
+	{
+		// correct the single precision solve with iterative refinement: the
+		// residual is computed exactly from the double precision kernel matrix
+		// and only the correction is solved against the float32 operator
+		auto lik=m_model->as<GaussianLikelihood>();
+		const float64_t sigma2=Math::sq(lik->get_sigma());
+		const float64_t scale2=std::exp(m_log_scale*2.0);
+
+		Map<MatrixXd> eigen_K(m_ktrtr.matrix, m_ktrtr.num_rows,
+			m_ktrtr.num_cols);
+		Map<VectorXd> eigen_b(b.vector, b.vlen);
+		Map<VectorXd> eigen_x(x.vector, x.vlen);
+
+		const float64_t b_norm=eigen_b.norm();
+
+		for (index_t iter=0; iter<m_max_refine_iter; iter++)
+		{
+			SGVector<float64_t> r(b.vlen);
+			Map<VectorXd> eigen_r(r.vector, r.vlen);
+			eigen_r=eigen_b-(eigen_K*(scale2*eigen_x)+sigma2*eigen_x);
+
+			if (eigen_r.norm()<=m_refine_tolerance*b_norm)
+				break;
+
+			SGVector<float64_t> correction=m_linear_solver->solve(op, r);
+			Map<VectorXd> eigen_correction(correction.vector, correction.vlen);
+			eigen_x+=eigen_correction;
+		}
+	}
+
+	return x;
+}
+
+void ConjugateGradientInferenceMethod::update_alpha()
+{
+	// get labels and mean vector and create eigen representation
+	SGVector<float64_t> y=regression_labels(m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+
+	SGVector<float64_t> r(y.vlen);
+	Map<VectorXd> eigen_r(r.vector, r.vlen);
+	eigen_r=eigen_y-eigen_m;
+
+	// solve A*alpha=y-m iteratively
+	m_alpha=solve_system(r);
+}
+
+void ConjugateGradientInferenceMethod::update_mean()
+{
+	// create eigen representataion of kernel matrix and alpha
+	Map<MatrixXd> eigen_K(m_ktrtr.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	m_mu=SGVector<float64_t>(m_alpha.vlen);
+	Map<VectorXd> eigen_mu(m_mu.vector, m_mu.vlen);
+
+	eigen_mu = eigen_K * std::exp(m_log_scale * 2.0) * eigen_alpha;
+}
+
+void ConjugateGradientInferenceMethod::update_deriv()
+{
+	const index_t n=m_ktrtr.num_rows;
+
+	// draw Gaussian probe vectors and solve A*u=z for each of them: the
+	// trace terms trace(A^(-1)*dK) of the derivatives are then estimated as
+	// the average of u'*dK*z over the probes
+	auto sampler=std::make_shared<NormalSampler>(n);
+	sampler->precompute();
+
+	m_probe_Z=SGMatrix<float64_t>(n, m_num_probes);
+	m_probe_U=SGMatrix<float64_t>(n, m_num_probes);
+	Map<MatrixXd> eigen_Z(m_probe_Z.matrix, n, m_num_probes);
+	Map<MatrixXd> eigen_U(m_probe_U.matrix, n, m_num_probes);
+
+	for (index_t j=0; j<m_num_probes; j++)
+	{
+		SGVector<float64_t> z=sampler->sample(0);
+		Map<VectorXd> eigen_z(z.vector, z.vlen);
+		eigen_Z.col(j)=eigen_z;
+
+		SGVector<float64_t> u=solve_system(z);
+		Map<VectorXd> eigen_u(u.vector, u.vlen);
+		eigen_U.col(j)=eigen_u;
+	}
+}
+
+float64_t ConjugateGradientInferenceMethod::get_negative_log_marginal_likelihood()
+{
+	if (parameter_hash_changed())
+		update();
+
+	// create eigen representation of alpha
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	// get labels and mean vectors and create eigen representation
+	SGVector<float64_t> y=regression_labels(m_labels)->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> m=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_m(m.vector, m.vlen);
+
+	// compute negative log of the marginal likelihood:
+	// nlZ=(y-m)'*alpha/2+log|A|/2+n*log(2*pi)/2
+	float64_t result =
+	    (eigen_y - eigen_m).dot(eigen_alpha) / 2.0 + m_log_det / 2.0 +
+	    m_alpha.vlen * std::log(2 * Math::PI) / 2.0;
+
+	return result;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_alpha()
+{
+	if (parameter_hash_changed())
+		update();
+
+	return SGVector<float64_t>(m_alpha);
+}
+
+SGMatrix<float64_t> ConjugateGradientInferenceMethod::get_cholesky()
+{
+	if (parameter_hash_changed())
+		update();
+
+	if (!m_L.matrix)
+	{
+		io::warn("{}: the predictive covariance requires the dense Cholesky "
+			"factor, falling back to an O(n^3) factorization", get_name());
+		compute_dense_cholesky();
+	}
+
+	return SGMatrix<float64_t>(m_L);
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_diagonal_vector()
+{
+	if (parameter_hash_changed())
+		update();
+
+	// get the sigma variable from the Gaussian likelihood model
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+
+	// compute diagonal vector: sW=1/sigma
+	SGVector<float64_t> result(m_features->get_num_vectors());
+	result.fill_vector(result.vector, m_features->get_num_vectors(), 1.0/sigma);
+
+	return result;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_posterior_mean()
+{
+	compute_gradient();
+
+	return SGVector<float64_t>(m_mu);
+}
+
+SGMatrix<float64_t> ConjugateGradientInferenceMethod::get_posterior_covariance()
+{
+	if (parameter_hash_changed())
+		update();
+
+	if (!m_L.matrix)
+		compute_dense_cholesky();
+
+	// create eigen representataion of upper triangular factor L^T and kernel
+	// matrix
+	Map<MatrixXd> eigen_L(m_L.matrix, m_L.num_rows, m_L.num_cols);
+	Map<MatrixXd> eigen_K(m_ktrtr.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+
+	SGMatrix<float64_t> Sigma(m_ktrtr.num_rows, m_ktrtr.num_cols);
+	Map<MatrixXd> eigen_Sigma(Sigma.matrix, Sigma.num_rows, Sigma.num_cols);
+
+	// compute V = L^(-1) * K, using upper triangular factor L^T
+	MatrixXd eigen_V = eigen_L.triangularView<Upper>().adjoint().solve(
+	    eigen_K * std::exp(m_log_scale * 2.0));
+
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+	eigen_V = eigen_V/sigma;
+
+	// compute covariance matrix of the posterior: Sigma = K - V^T * V
+	eigen_Sigma =
+	    eigen_K * std::exp(m_log_scale * 2.0) - eigen_V.adjoint() * eigen_V;
+
+	return Sigma;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_derivative_wrt_inference_method(
+		Parameters::const_reference param)
+{
+	require(param.first == "log_scale", "Can't compute derivative of "
+			"the nagative log marginal likelihood wrt {}.{} parameter",
+			get_name(), param.first);
+
+	Map<MatrixXd> eigen_K(m_ktrtr.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+	Map<MatrixXd> eigen_Z(m_probe_Z.matrix, m_probe_Z.num_rows, m_probe_Z.num_cols);
+	Map<MatrixXd> eigen_U(m_probe_U.matrix, m_probe_U.num_rows, m_probe_U.num_cols);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	SGVector<float64_t> result(1);
+
+	// compute derivative wrt kernel scale:
+	// dnlZ=(trace(A^(-1)*K)-alpha'*K*alpha)*scale^2, with the trace estimated
+	// from the probe vectors
+	float64_t trace_est=
+		eigen_U.cwiseProduct(eigen_K*eigen_Z).sum()/m_num_probes;
+	result[0]=trace_est-(eigen_K*eigen_alpha).dot(eigen_alpha);
+	result[0] *= std::exp(m_log_scale * 2.0);
+
+	return result;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_derivative_wrt_likelihood_model(
+		Parameters::const_reference param)
+{
+	require(param.first == "log_sigma", "Can't compute derivative of "
+			"the nagative log marginal likelihood wrt {}.{} parameter",
+			m_model->get_name(), param.first);
+
+	// get the sigma variable from the Gaussian likelihood model
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+
+	Map<MatrixXd> eigen_Z(m_probe_Z.matrix, m_probe_Z.num_rows, m_probe_Z.num_cols);
+	Map<MatrixXd> eigen_U(m_probe_U.matrix, m_probe_U.num_rows, m_probe_U.num_cols);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	SGVector<float64_t> result(1);
+
+	// compute derivative wrt likelihood model parameter sigma:
+	// dnlZ=sigma^2*(trace(A^(-1))-alpha'*alpha), with the trace estimated
+	// from the probe vectors
+	float64_t trace_est=eigen_U.cwiseProduct(eigen_Z).sum()/m_num_probes;
+	result[0]=Math::sq(sigma)*(trace_est-eigen_alpha.squaredNorm());
+
+	return result;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_derivative_wrt_kernel(
+		Parameters::const_reference param)
+{
+	Map<MatrixXd> eigen_Z(m_probe_Z.matrix, m_probe_Z.num_rows, m_probe_Z.num_cols);
+	Map<MatrixXd> eigen_U(m_probe_U.matrix, m_probe_U.num_rows, m_probe_U.num_cols);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	SGVector<float64_t> result;
+	auto visitor = std::make_unique<ShapeVisitor>();
+	param.second->get_value().visit(visitor.get());
+	int64_t len= visitor->get_size();
+	result=SGVector<float64_t>(len);
+
+	for (index_t i=0; i<result.vlen; i++)
+	{
+		SGMatrix<float64_t> dK;
+
+		if (result.vlen==1)
+			dK=get_kernel_derivative(param);
+		else
+			dK=get_kernel_derivative(param, i);
+
+		Map<MatrixXd> eigen_dK(dK.matrix, dK.num_rows, dK.num_cols);
+
+		// compute derivative wrt kernel parameter:
+		// dnlZ=(trace(A^(-1)*dK)-alpha'*dK*alpha)*scale^2/2.0, with the trace
+		// estimated from the probe vectors
+		float64_t trace_est=
+			eigen_U.cwiseProduct(eigen_dK*eigen_Z).sum()/m_num_probes;
+		result[i]=trace_est-(eigen_dK*eigen_alpha).dot(eigen_alpha);
+		result[i] *= std::exp(m_log_scale * 2.0) / 2.0;
+	}
+
+	return result;
+}
+
+SGVector<float64_t> ConjugateGradientInferenceMethod::get_derivative_wrt_mean(
+		Parameters::const_reference param)
+{
+	// create eigen representation of alpha vector
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+
+	SGVector<float64_t> result;
+	auto visitor = std::make_unique<ShapeVisitor>();
+	param.second->get_value().visit(visitor.get());
+	int64_t len= visitor->get_size();
+	result=SGVector<float64_t>(len);
+
+	for (index_t i=0; i<result.vlen; i++)
+	{
+		SGVector<float64_t> dmu;
+
+		if (result.vlen==1)
+			dmu=m_mean->get_parameter_derivative(m_features, param);
+		else
+			dmu=m_mean->get_parameter_derivative(m_features, param, i);
+
+		Map<VectorXd> eigen_dmu(dmu.vector, dmu.vlen);
+
+		// compute derivative wrt mean parameter: dnlZ=-dmu'*alpha
+		result[i]=-eigen_dmu.dot(eigen_alpha);
+	}
+
+	return result;
+}
@@ -0,0 +1,337 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#ifndef CCONJUGATEGRADIENTINFERENCEMETHOD_H_
+#define CCONJUGATEGRADIENTINFERENCEMETHOD_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/machine/gp/Inference.h>
+
+namespace shogun
+{
+template<class T> class LinearOperator;
+template<class T, class ST> class IterativeLinearSolver;
+
+/** @brief The iterative Gaussian exact form inference method class.
+ *
+ * This inference method computes the same posterior as ExactInferenceMethod,
+ * but replaces the Cholesky factorization of the system matrix
+ *
+ * \f[
+ * A = K+\sigma^{2}I
+ * \f]
+ *
+ * with iterative solvers built on the linear operator framework: the vector
+ *
+ * \f[
+ * \boldsymbol{\alpha} = A^{-1}(\boldsymbol{y}-\boldsymbol{m})
+ * \f]
+ *
+ * is obtained with the conjugate gradient method, the log-determinant in the
+ * marginal likelihood is estimated with the rational approximation machinery
+ * (LogDetEstimator) and the trace terms in the hyperparameter derivatives are
+ * estimated stochastically from Gaussian probe vectors. Training therefore
+ * avoids the \f$O(n^3)\f$ factorization; a dense Cholesky factor is only
+ * computed lazily when the predictive covariance is explicitly requested.
+ *
+ * Note that the marginal likelihood and its derivatives are randomized
+ * estimates whose accuracy is controlled by the number of log-determinant
+ * estimates and probe vectors.
+ *
+ * NOTE: The Gaussian Likelihood Function must be used for this inference
+ * method.
+ */
+class ConjugateGradientInferenceMethod: public Inference
+{
+public:
+	/** default constructor */
+	ConjugateGradientInferenceMethod();
+
+	/** constructor
+	 *
+	 * @param kernel covariance function
+	 * @param features features to use in inference
+	 * @param mean mean function to use
+	 * @param labels labels of the features
+	 * @param model likelihood model to use
+	 */
+	ConjugateGradientInferenceMethod(std::shared_ptr<Kernel> kernel,
+			std::shared_ptr<Features> features, std::shared_ptr<MeanFunction> mean,
+			std::shared_ptr<Labels> labels, std::shared_ptr<LikelihoodModel> model);
+
+	~ConjugateGradientInferenceMethod() override;
+
+	/** return what type of inference we are
+	 *
+	 * @return inference type CG_REGRESSION
+	 */
+	EInferenceType get_inference_type() const override { return INF_CG_REGRESSION; }
+
+	/** returns the name of the inference method
+	 *
+	 * @return name ConjugateGradientInferenceMethod
+	 */
+	const char* get_name() const override { return "ConjugateGradientInferenceMethod"; }
+
+	/** helper method used to specialize a base class instance
+	 *
+	 * @param inference inference method
+	 * @return casted ConjugateGradientInferenceMethod object
+	 */
+	static std::shared_ptr<ConjugateGradientInferenceMethod> obtain_from_generic(
+			const std::shared_ptr<Inference>& inference);
+
+	/** get negative log marginal likelihood
+	 *
+	 * @return the negative log of the marginal likelihood function:
+	 *
+	 * \f[
+	 * -log(p(y|X, \theta))
+	 * \f]
+	 *
+	 * where \f$y\f$ are the labels, \f$X\f$ are the features, and \f$\theta\f$
+	 * represent hyperparameters. The log-determinant term is a stochastic
+	 * estimate
+	 */
+	float64_t get_negative_log_marginal_likelihood() override;
+
+	/** get alpha vector
+	 *
+	 * @return vector to compute posterior mean of Gaussian Process:
+	 *
+	 * \f[
+	 * \mu = K\alpha
+	 * \f]
+	 *
+	 * where \f$\mu\f$ is the mean and \f$K\f$ is the prior covariance matrix.
+	 */
+	SGVector<float64_t> get_alpha() override;
+
+	/** get Cholesky decomposition matrix
+	 *
+	 * The factor is not needed for training and is computed lazily on the
+	 * first call after an update, falling back to a dense factorization for
+	 * the predictive covariance
+	 *
+	 * @return Cholesky decomposition of matrix:
+	 *
+	 * \f[
+	 * L = Cholesky(sW*K*sW+I)
+	 * \f]
+	 *
+	 * where \f$K\f$ is the prior covariance matrix, \f$sW\f$ is the vector
+	 * returned by get_diagonal_vector(), and \f$I\f$ is the identity matrix.
+	 */
+	SGMatrix<float64_t> get_cholesky() override;
+
+	/** get diagonal vector
+	 *
+	 * @return diagonal of matrix used to calculate posterior covariance matrix
+	 *
+	 * \f[
+	 * Cov = (K^{-1}+sW^{2})^{-1}
+	 * \f]
+	 *
+	 * where \f$Cov\f$ is the posterior covariance matrix, \f$K\f$ is the prior
+	 * covariance matrix, and \f$sW\f$ is the diagonal vector.
+	 */
+	SGVector<float64_t> get_diagonal_vector() override;
+
+	/** returns mean vector \f$\mu\f$ of the posterior Gaussian distribution
+	 * \f$\mathcal{N}(\mu,\Sigma)\f$
+	 *
+	 * \f[
+	 * p(f|y) = \mathcal{N}(\mu,\Sigma)
+	 * \f]
+	 *
+	 * @return mean vector
+	 */
+	SGVector<float64_t> get_posterior_mean() override;
+
+	/** returns covariance matrix \f$\Sigma\f$ of the posterior Gaussian
+	 * distribution \f$\mathcal{N}(\mu,\Sigma)\f$
+	 *
+	 * Requires the lazily computed dense factor, so the first call after an
+	 * update costs a full factorization
+	 *
+	 * @return covariance matrix
+	 */
+	SGMatrix<float64_t> get_posterior_covariance() override;
+
+	/**
+	 * @return whether combination of iterative exact inference method and
+	 * given likelihood function supports regression
+	 */
+	bool supports_regression() const override
+	{
+		check_members();
+		return m_model->supports_regression();
+	}
+
+	/** update matrices except gradients*/
+	void update() override;
+
+	/** set the linear solver used for the systems \f$Ax=b\f$
+	 *
+	 * @param solver iterative solver, e.g. ConjugateGradientSolver
+	 */
+	virtual void set_linear_solver(
+			std::shared_ptr<IterativeLinearSolver<float64_t, float64_t>> solver);
+
+	/** set the number of log-determinant estimates averaged in the negative
+	 * log marginal likelihood
+	 *
+	 * @param num_estimates number of estimates
+	 *
+	 * The default value is 20.
+	 */
+	virtual void set_num_logdet_estimates(index_t num_estimates);
+
+	/** set the number of Gaussian probe vectors used to estimate the trace
+	 * terms of the hyperparameter derivatives
+	 *
+	 * @param num_probes number of probe vectors
+	 *
+	 * The default value is 20.
+	 */
+	virtual void set_num_probe_vectors(index_t num_probes);
+
+	/** whether the system matrix is stored in single precision
+	 *
+	 * When enabled, the solves run against a float32 copy of
+	 * \f$A=K+\sigma^2 I\f$, halving the memory of the solve working set,
+	 * and the solutions are corrected with float64 iterative refinement
+	 * against the double precision kernel matrix
+	 *
+	 * @param enable whether to store the system matrix in single precision
+	 *
+	 * The default value is false.
+	 */
+	virtual void set_single_precision_storage(bool enable);
+
+	/** Set a minimizer
+	 *
+	 * @param minimizer minimizer used in inference method
+	 */
+	void register_minimizer(std::shared_ptr<Minimizer> minimizer) override;
+protected:
+	/** check if members of object are valid for inference */
+	void check_members() const override;
+
+	/** update alpha vector by solving \f$A\alpha=y-m\f$ with the linear
+	 * solver */
+	void update_alpha() override;
+
+	/** forms the system matrix and estimates its log-determinant; the dense
+	 * Cholesky factor is invalidated and only recomputed on demand */
+	void update_chol() override;
+
+	/** update mean vector of the posterior Gaussian */
+	virtual void update_mean();
+
+	/** update probe vectors and their solves, which are required to compute
+	 * negative log marginal likelihood derivatives wrt hyperparameter
+	 */
+	void update_deriv() override;
+
+	/** returns derivative of negative log marginal likelihood wrt parameter of
+	 * CInference class
+	 *
+	 * @param param parameter of CInference class
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_inference_method(
+			Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt parameter of
+	 * likelihood model
+	 *
+	 * @param param parameter of given likelihood model
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_likelihood_model(
+			Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt kernel's
+	 * parameter
+	 *
+	 * @param param parameter of given kernel
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_kernel(
+			Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt mean
+	 * function's parameter
+	 *
+	 * @param param parameter of given mean function
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_mean(
+			Parameters::const_reference param) override;
+
+	/** update gradients */
+	void compute_gradient() override;
+private:
+	/** initialize members of this class */
+	void init();
+
+	/** computes the dense upper Cholesky factor of \f$K/\sigma^2+I\f$ used
+	 * by the predictive covariance paths */
+	void compute_dense_cholesky();
+
+	/** wraps the stored system matrix in a linear operator, respecting the
+	 * storage precision */
+	std::shared_ptr<LinearOperator<float64_t>> create_system_operator() const;
+
+	/** solves \f$Ax=b\f$ with the linear solver; in single precision mode
+	 * the solution is corrected with float64 iterative refinement */
+	SGVector<float64_t> solve_system(SGVector<float64_t> b);
+
+	/** system matrix \f$A=K+\sigma^2 I\f$ wrapped by the linear operator */
+	SGMatrix<float64_t> m_A;
+
+	/** single precision storage of the system matrix, used instead of m_A
+	 * when enabled */
+	SGMatrix<float32_t> m_A_single;
+
+	/** whether the system matrix is stored in single precision */
+	bool m_use_single_precision;
+
+	/** relative residual tolerance of the iterative refinement */
+	float64_t m_refine_tolerance;
+
+	/** maximum number of iterative refinement steps */
+	index_t m_max_refine_iter;
+
+	/** mean vector of the the posterior Gaussian distribution */
+	SGVector<float64_t> m_mu;
+
+	/** Gaussian probe vectors for the stochastic trace estimates */
+	SGMatrix<float64_t> m_probe_Z;
+
+	/** solves \f$A^{-1}z\f$ of the probe vectors */
+	SGMatrix<float64_t> m_probe_U;
+
+	/** stochastic estimate of \f$\log\left|A\right|\f$ */
+	float64_t m_log_det;
+
+	/** number of log-determinant estimates averaged in the likelihood */
+	index_t m_num_logdet_estimates;
+
+	/** number of probe vectors for the derivative trace estimates */
+	index_t m_num_probes;
+
+	/** accuracy of the rational approximation of the log function */
+	float64_t m_logdet_accuracy;
+
+	/** iterative solver for the linear systems */
+	std::shared_ptr<IterativeLinearSolver<float64_t, float64_t>> m_linear_solver;
+};
+}
+#endif /* CCONJUGATEGRADIENTINFERENCEMETHOD_H_ */
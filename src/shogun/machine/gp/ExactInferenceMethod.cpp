@@ -33,6 +33,7 @@
  */
 #include <shogun/machine/gp/ExactInferenceMethod.h>
 
+#include <shogun/features/DenseFeatures.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/machine/gp/GaussianLikelihood.h>
 #include <shogun/machine/visitors/ShapeVisitor.h>
@@ -90,6 +91,147 @@ void ExactInferenceMethod::update()
 	SG_TRACE("leaving");
 }
 
+void ExactInferenceMethod::update_with_new_points(
+	const std::shared_ptr<Features>& feats, const std::shared_ptr<Labels>& labs)
+{
+	require(feats, "Invalid (NULL) feature pointer");
+	require(labs, "Invalid (NULL) labels pointer");
+	require(labs->get_label_type()==LT_REGRESSION,
+		"Labels must be type of CRegressionLabels");
+
+	int32_t n_new=feats->get_num_vectors();
+	require(labs->get_num_labels()==n_new,
+		"Number of labels ({}) must match number of new points ({})",
+		labs->get_num_labels(), n_new);
+
+	// the factorization being extended must correspond to the current
+	// hyperparameters
+	if (parameter_hash_changed())
+		update();
+
+	int32_t n_old=m_L.num_rows;
+	int32_t n=n_old+n_new;
+
+	// append the new observations
+	SGVector<float64_t> y_old=regression_labels(m_labels)->get_labels();
+	SGVector<float64_t> y_new=regression_labels(labs)->get_labels();
+	SGVector<float64_t> y(n);
+	sg_memcpy(y.vector, y_old.vector, n_old*sizeof(float64_t));
+	sg_memcpy(y.vector+n_old, y_new.vector, n_new*sizeof(float64_t));
+	m_labels=std::make_shared<RegressionLabels>(y);
+
+	m_features=m_features->create_merged_copy(feats);
+
+	// recompute the kernel matrix: O(n^2) kernel evaluations, but no
+	// refactorization
+	update_train_kernel();
+
+	auto lik = m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+	float64_t coeff = std::exp(m_log_scale * 2.0) / Math::sq(sigma);
+
+	// extend the upper factor U of A=K*scale^2/sigma^2+I by the new block:
+	// for A=[A11 A12; A12' A22] the new factor is [U11 U12; 0 U22] with
+	// U12=U11^(-T)*A12 and U22'*U22=A22-U12'*U12
+	SGMatrix<float64_t> L_new(n, n);
+	L_new.zero();
+
+	Map<MatrixXd> U(L_new.matrix, n, n);
+	Map<MatrixXd> U_old(m_L.matrix, n_old, n_old);
+	Map<MatrixXd> K(m_ktrtr.matrix, n, n);
+
+	U.topLeftCorner(n_old, n_old)=U_old;
+	U.topRightCorner(n_old, n_new)=
+		U_old.triangularView<Upper>().adjoint().solve(
+			K.topRightCorner(n_old, n_new)*coeff);
+
+	MatrixXd S22=K.bottomRightCorner(n_new, n_new)*coeff
+		+MatrixXd::Identity(n_new, n_new)
+		-U.topRightCorner(n_old, n_new).adjoint()
+			*U.topRightCorner(n_old, n_new);
+
+	LLT<MatrixXd> llt(S22);
+	U.bottomRightCorner(n_new, n_new)=llt.matrixU();
+
+	m_L=L_new;
+
+	update_alpha();
+	m_gradient_update=false;
+	update_parameter_hash();
+}
+
+void ExactInferenceMethod::remove_oldest_points(int32_t num_points)
+{
+	require(num_points>0, "Number of points to remove ({}) must be > 0",
+		num_points);
+
+	if (parameter_hash_changed())
+		update();
+
+	int32_t n_old=m_L.num_rows;
+	require(num_points<n_old, "Number of points to remove ({}) must be less "
+		"than the number of training points ({})", num_points, n_old);
+
+	int32_t n=n_old-num_points;
+
+	// for U=[U11 U12; 0 U22] the removed block contributes
+	// A22=U12'*U12+U22'*U22, so the factor of the remaining points is U22
+	// rank-1 updated with each row of U12
+	SGMatrix<float64_t> L_new(n, n);
+	Map<MatrixXd> U(L_new.matrix, n, n);
+	Map<MatrixXd> U_old(m_L.matrix, n_old, n_old);
+
+	U=U_old.bottomRightCorner(n, n);
+
+	for (int32_t i=0; i<num_points; i++)
+	{
+		VectorXd v=U_old.row(i).tail(n);
+
+		// rank-1 Cholesky update U'*U += v*v' on the upper factor
+		for (int32_t k=0; k<n; k++)
+		{
+			float64_t u_kk=U(k,k);
+			float64_t r=std::sqrt(u_kk*u_kk+v[k]*v[k]);
+			float64_t c=r/u_kk;
+			float64_t s=v[k]/u_kk;
+			U(k,k)=r;
+
+			if (k<n-1)
+			{
+				U.row(k).tail(n-1-k)=
+					(U.row(k).tail(n-1-k)+s*v.tail(n-1-k).transpose())/c;
+				v.tail(n-1-k)=c*v.tail(n-1-k)
+					-s*U.row(k).tail(n-1-k).transpose();
+			}
+		}
+	}
+
+	// slice the observations
+	SGVector<float64_t> y_old=regression_labels(m_labels)->get_labels();
+	SGVector<float64_t> y(n);
+	sg_memcpy(y.vector, y_old.vector+num_points, n*sizeof(float64_t));
+	m_labels=std::make_shared<RegressionLabels>(y);
+
+	auto dense=std::dynamic_pointer_cast<DenseFeatures<float64_t>>(m_features);
+	require(dense, "Removing points requires features of type "
+		"DenseFeatures<float64_t>");
+
+	SGMatrix<float64_t> x_old=dense->get_feature_matrix();
+	SGMatrix<float64_t> x(x_old.num_rows, n);
+	sg_memcpy(x.matrix, x_old.matrix+num_points*x_old.num_rows,
+		x_old.num_rows*n*sizeof(float64_t));
+	m_features=std::make_shared<DenseFeatures<float64_t>>(x);
+
+	// O(n^2) kernel evaluations, no refactorization
+	update_train_kernel();
+
+	m_L=L_new;
+
+	update_alpha();
+	m_gradient_update=false;
+	update_parameter_hash();
+}
+
 void ExactInferenceMethod::check_members() const
 {
 	Inference::check_members();
@@ -355,9 +497,9 @@ SGVector<float64_t> ExactInferenceMethod::get_derivative_wrt_kernel(
 		SGMatrix<float64_t> dK;
 
 		if (result.vlen==1)
-			dK=m_kernel->get_parameter_gradient(param);
+			dK=get_kernel_derivative(param);
 		else
-			dK=m_kernel->get_parameter_gradient(param, i);
+			dK=get_kernel_derivative(param, i);
 
 		Map<MatrixXd> eigen_dK(dK.matrix, dK.num_rows, dK.num_cols);
 
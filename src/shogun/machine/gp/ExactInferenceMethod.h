@@ -187,6 +187,31 @@ public:
 	/** update matrices except gradients*/
 	void update() override;
 
+	/** Appends new observations to the training set and extends the current
+	 * Cholesky factorization by the corresponding block instead of
+	 * refactorizing the full kernel matrix, so the update costs
+	 * \f$O(n^2 m)\f$ for \f$m\f$ new points instead of \f$O(n^3)\f$.
+	 * The hyperparameters must not have changed since the last update,
+	 * otherwise a full update is performed first
+	 *
+	 * @param feats features of the new observations
+	 * @param labs labels of the new observations
+	 */
+	virtual void update_with_new_points(const std::shared_ptr<Features>& feats,
+			const std::shared_ptr<Labels>& labs);
+
+	/** Removes the oldest observations from the training set and downdates
+	 * the current Cholesky factorization with a sequence of rank-1 updates
+	 * instead of refactorizing, so the removal costs \f$O(n^2 m)\f$ for
+	 * \f$m\f$ removed points instead of \f$O(n^3)\f$. Together with
+	 * update_with_new_points() this allows cheap retraining on rolling
+	 * windows. Requires features of type DenseFeatures<float64_t>
+	 *
+	 * @param num_points number of observations to remove from the beginning
+	 * of the training set
+	 */
+	virtual void remove_oldest_points(int32_t num_points);
+
         /** Set a minimizer
          *
          * @param minimizer minimizer used in inference method
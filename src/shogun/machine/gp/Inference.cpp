@@ -35,6 +35,7 @@
 
 #include <shogun/machine/gp/Inference.h>
 #include <shogun/distributions/classical/GaussianDistribution.h>
+#include <shogun/kernel/ExponentialARDKernel.h>
 #include <shogun/mathematics/Statistics.h>
 #include <shogun/mathematics/Math.h>
 
@@ -248,6 +249,51 @@ void Inference::update_train_kernel()
 	m_ktrtr=m_kernel->get_kernel_matrix();
 }
 
+SGMatrix<float64_t> Inference::get_kernel_derivative(
+		Parameters::const_reference param, index_t index)
+{
+	std::lock_guard<std::mutex> guard(m_kernel_deriv_lock);
+
+	// the kernel hash covers its parameters and features, so a stale cache
+	// is detected no matter which part of the model the optimizer moved
+	const size_t kernel_hash=m_kernel->hash();
+	if (kernel_hash!=m_kernel_deriv_hash)
+	{
+		m_kernel_deriv_cache.clear();
+		m_kernel_deriv_hash=kernel_hash;
+	}
+
+	auto key=std::make_pair(std::string(param.first), index);
+	auto it=m_kernel_deriv_cache.find(key);
+	if (it!=m_kernel_deriv_cache.end())
+		return it->second;
+
+	SGMatrix<float64_t> dK;
+	if (index<0)
+		dK=m_kernel->get_parameter_gradient(param);
+	else
+	{
+		// ARD kernels can fill all weight derivatives in one pass over their
+		// shared intermediates, so a miss on one element caches the whole batch
+		auto ard_kernel=std::dynamic_pointer_cast<ExponentialARDKernel>(m_kernel);
+		if (ard_kernel && param.first=="log_weights")
+		{
+			std::vector<SGMatrix<float64_t>> batch=
+				ard_kernel->get_parameter_gradient_batch(param);
+			for (index_t i=0; i<(index_t)batch.size(); i++)
+			{
+				m_kernel_deriv_cache.emplace(
+					std::make_pair(std::string(param.first), i), batch[i]);
+			}
+			return m_kernel_deriv_cache[key];
+		}
+		dK=m_kernel->get_parameter_gradient(param, index);
+	}
+	m_kernel_deriv_cache.emplace(key, dK);
+
+	return dK;
+}
+
 void Inference::compute_gradient()
 {
 	if (parameter_hash_changed())
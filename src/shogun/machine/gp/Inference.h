@@ -46,6 +46,11 @@
 #include <shogun/evaluation/DifferentiableFunction.h>
 #include <shogun/optimization/Minimizer.h>
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
 namespace shogun
 {
 
@@ -54,6 +59,7 @@ enum EInferenceType
 {
 	INF_NONE=0,
 	INF_EXACT=10,
+	INF_CG_REGRESSION=11,
 	INF_SPARSE=20,
 	INF_FITC_REGRESSION=21,
 	INF_FITC_LAPLACE_SINGLE=22,
@@ -66,7 +72,8 @@ enum EInferenceType
 	INF_KL_CHOLESKY=52,
 	INF_KL_COVARIANCE=53,
 	INF_KL_DUAL=54,
-	INF_KL_SPARSE_REGRESSION=55
+	INF_KL_SPARSE_REGRESSION=55,
+	INF_SVGP_REGRESSION=56
 };
 
 /** @brief The Inference Method base class.
@@ -410,6 +417,22 @@ protected:
 	/** update train kernel matrix */
 	virtual void update_train_kernel();
 
+	/** returns the derivative of the training kernel matrix wrt the given
+	 * kernel parameter, memoized between gradient evaluations
+	 *
+	 * The cache is keyed on the kernel's parameter hash (which covers its
+	 * features), so derivative matrices are reused while the optimizer only
+	 * moves other hyperparameters (e.g. likelihood, mean or scale
+	 * parameters) and recomputed as soon as the kernel itself changes.
+	 *
+	 * @param param parameter of the kernel
+	 * @param index the index of the element if parameter is a vector
+	 *
+	 * @return derivative of the kernel matrix wrt the parameter
+	 */
+	SGMatrix<float64_t> get_kernel_derivative(
+			Parameters::const_reference param, index_t index=-1);
+
 	/** returns derivative of negative log marginal likelihood wrt parameter of
 	 * CInference class
 	 *
@@ -491,6 +514,18 @@ protected:
 
 	/** Whether gradients are updated */
 	bool m_gradient_update = false;
+
+	/** cached kernel derivative matrices keyed on parameter name and index
+	 * (derived quantity, not serialized) */
+	std::map<std::pair<std::string, index_t>, SGMatrix<float64_t>>
+		m_kernel_deriv_cache;
+
+	/** kernel parameter hash the derivative cache was computed for */
+	size_t m_kernel_deriv_hash = 0;
+
+	/** guards the derivative cache, since derivatives wrt different
+	 * parameters are computed in parallel */
+	std::mutex m_kernel_deriv_lock;
 };
 }
 #endif /* CINFERENCE_H_ */
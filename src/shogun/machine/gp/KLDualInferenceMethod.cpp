@@ -156,7 +156,8 @@ float64_t KLDualInferenceMethodMinimizer::minimize()
 	float64_t cost=0.0;
 	int error_code=lbfgs(m_target_variable.vlen, m_target_variable.vector,
 		&cost, KLDualInferenceMethodMinimizer::evaluate,
-		NULL, this, &lbfgs_param, KLDualInferenceMethodMinimizer::adjust_step);
+		NULL, this, &lbfgs_param, KLDualInferenceMethodMinimizer::adjust_step,
+		&m_workspace);
 
 	if(error_code!=0 && error_code!=LBFGS_ALREADY_MINIMIZED)
 	{
@@ -378,9 +378,9 @@ SGVector<float64_t> KLInference::get_derivative_wrt_kernel(Parameters::const_ref
 
 		//dK = feval(covfunc{:},hyper,x,j);
 		if (result.vlen==1)
-			dK=m_kernel->get_parameter_gradient(param);
+			dK=get_kernel_derivative(param);
 		else
-			dK=m_kernel->get_parameter_gradient(param, i);
+			dK=get_kernel_derivative(param, i);
 
 		result[i]=get_derivative_related_cov(dK);
 		result[i] *= std::exp(m_log_scale * 2.0);
@@ -200,14 +200,18 @@ void MultiLaplaceInferenceMethod::update_approx_cov()
 	Map<MatrixXd> eigen_Sigma(m_Sigma.matrix, m_Sigma.num_rows,	m_Sigma.num_cols);
 	eigen_Sigma.fill(0);
 
+	const MatrixXd eigen_K_scaled = eigen_K * std::exp(m_log_scale * 2.0);
 	MatrixXd eigen_U(C*n,n);
+	// the classes are independent given E, so the per-class products can run
+	// in parallel, each writing its own block
+	#pragma omp parallel for
 	for(index_t bl=0; bl<C; bl++)
 	{
-		eigen_U.block(bl * n, 0, n, n) = eigen_K * std::exp(m_log_scale * 2.0) *
-			                             eigen_E.block(0, bl * n, n, n);
+		eigen_U.block(bl * n, 0, n, n) =
+			eigen_K_scaled * eigen_E.block(0, bl * n, n, n);
 		eigen_Sigma.block(bl * n, bl * n, n, n) =
 			(MatrixXd::Identity(n, n) - eigen_U.block(bl * n, 0, n, n)) *
-			(eigen_K * std::exp(m_log_scale * 2.0));
+			eigen_K_scaled;
 	}
 	MatrixXd eigen_V=eigen_M.triangularView<Upper>().adjoint().solve(eigen_U.transpose());
 	eigen_Sigma+=eigen_V.transpose()*eigen_V;
@@ -251,8 +255,10 @@ void MultiLaplaceInferenceMethod::update_alpha()
 	Map<VectorXd> eigen_mean_bl(mean.vector, mean.vlen);
 	VectorXd eigen_mean=eigen_mean_bl.replicate(C,1);
 
-	// create eigen representation of kernel matrix
+	// create eigen representation of kernel matrix and scale it once instead
+	// of once per class inside the Newton iterations
 	Map<MatrixXd> eigen_ktrtr(m_ktrtr.matrix, m_ktrtr.num_rows, m_ktrtr.num_cols);
+	const MatrixXd eigen_K_scaled = eigen_ktrtr * std::exp(m_log_scale * 2.0);
 
 	// create shogun and eigen representation of function vector
 	m_mu=SGVector<float64_t>(mean.vlen*C);
@@ -278,9 +284,8 @@ void MultiLaplaceInferenceMethod::update_alpha()
 	{
 		Map<VectorXd> alpha(m_alpha.vector, m_alpha.vlen);
 		for(index_t bl=0; bl<C; bl++)
-			eigen_mu.block(bl * n, 0, n, 1) = eigen_ktrtr *
-				                              std::exp(m_log_scale * 2.0) *
-				                              alpha.block(bl * n, 0, n, 1);
+			eigen_mu.block(bl * n, 0, n, 1) =
+				eigen_K_scaled * alpha.block(bl * n, 0, n, 1);
 
 		//alpha'*(f-m)/2.0
 		Psi_New=alpha.dot(eigen_mu)/2.0;
@@ -322,24 +327,29 @@ void MultiLaplaceInferenceMethod::update_alpha()
 
 		m_nlz=0;
 
+		// the per-class Cholesky factorizations are independent of each
+		// other, so they can run in parallel: each class writes its own
+		// block of E and its own log-determinant entry, and the cheap
+		// O(C*n^2) accumulation of M is done afterwards
+		VectorXd eigen_nlz_bl(C);
+		#pragma omp parallel for
 		for(index_t bl=0; bl<C; bl++)
 		{
 			VectorXd eigen_sD=eigen_dpi.block(bl*n,0,n,1).cwiseSqrt();
 			LLT<MatrixXd> chol_tmp(
-				(eigen_sD * eigen_sD.transpose())
-				    .cwiseProduct(eigen_ktrtr * std::exp(m_log_scale * 2.0)) +
+				(eigen_sD * eigen_sD.transpose()).cwiseProduct(eigen_K_scaled) +
 				MatrixXd::Identity(m_ktrtr.num_rows, m_ktrtr.num_cols));
 			MatrixXd eigen_L_tmp=chol_tmp.matrixU();
 			MatrixXd eigen_E_bl=eigen_L_tmp.triangularView<Upper>().adjoint().solve(MatrixXd(eigen_sD.asDiagonal()));
-			eigen_E_bl=eigen_E_bl.transpose()*eigen_E_bl;
-			eigen_E.block(0,bl*n,n,n)=eigen_E_bl;
-			if (bl==0)
-				eigen_M=eigen_E_bl;
-			else
-				eigen_M+=eigen_E_bl;
-			m_nlz+=eigen_L_tmp.diagonal().array().log().sum();
+			eigen_E.block(0,bl*n,n,n)=eigen_E_bl.transpose()*eigen_E_bl;
+			eigen_nlz_bl[bl]=eigen_L_tmp.diagonal().array().log().sum();
 		}
 
+		eigen_M=eigen_E.block(0,0,n,n);
+		for(index_t bl=1; bl<C; bl++)
+			eigen_M+=eigen_E.block(0,bl*n,n,n);
+		m_nlz+=eigen_nlz_bl.sum();
+
 		LLT<MatrixXd> chol_tmp(eigen_M);
 		eigen_M = chol_tmp.matrixU();
 		m_nlz+=eigen_M.diagonal().array().log().sum();
@@ -354,11 +364,11 @@ void MultiLaplaceInferenceMethod::update_alpha()
 			eigen_b.block(bl*n,0,n,1)+=eigen_dpi.block(bl*n,0,n,1).cwiseProduct(eigen_mu.block(bl*n,0,n,1)-eigen_mean_bl-tmp2);
 
 		Map<VectorXd> &eigen_c=eigen_W;
+		#pragma omp parallel for
 		for(index_t bl=0; bl<C; bl++)
 			eigen_c.block(bl * n, 0, n, 1) =
 				eigen_E.block(0, bl * n, n, n) *
-				(eigen_ktrtr * std::exp(m_log_scale * 2.0) *
-				 eigen_b.block(bl * n, 0, n, 1));
+				(eigen_K_scaled * eigen_b.block(bl * n, 0, n, 1));
 
 		Map<MatrixXd> c_tmp(eigen_c.data(),n,C);
 
@@ -418,6 +428,7 @@ float64_t MultiLaplaceInferenceMethod::get_derivative_helper(SGMatrix<float64_t>
 	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
 	float64_t result=0;
 	//currently only explicit term is computed
+	#pragma omp parallel for reduction(+:result)
 	for(index_t bl=0; bl<C; bl++)
 	{
 		result+=((eigen_E.block(0,bl*n,n,n)-eigen_U.block(0,bl*n,n,n).transpose()*eigen_U.block(0,bl*n,n,n)).array()
@@ -464,9 +475,9 @@ SGVector<float64_t> MultiLaplaceInferenceMethod::get_derivative_wrt_kernel(
 		SGMatrix<float64_t> dK;
 
 		if (result.vlen==1)
-			dK=m_kernel->get_parameter_gradient(param);
+			dK=get_kernel_derivative(param);
 		else
-			dK=m_kernel->get_parameter_gradient(param, i);
+			dK=get_kernel_derivative(param, i);
 
 		result[i]=get_derivative_helper(dK);
 		result[i] *= std::exp(m_log_scale * 2.0);
@@ -79,6 +79,9 @@ void NumericalVGLikelihood::init()
 
 	SG_ADD(&m_is_init_GHQ, "is_init_GHQ",
 		"Whether Gaussian-Hermite quadrature points are initialized or not\n");
+
+	SG_ADD(&m_lab_tiled, "lab_tiled",
+		"Labels tiled across the quadrature columns\n");
 	m_GHQ_N=20;
 	m_is_init_GHQ=false;
 
@@ -94,6 +97,16 @@ void NumericalVGLikelihood::set_GHQ_number(index_t n)
 	}
 }
 
+std::shared_ptr<Labels> NumericalVGLikelihood::get_quadrature_labels() const
+{
+	if (supports_binary())
+		return std::make_shared<BinaryLabels>(m_lab_tiled);
+	else if (supports_regression())
+		return std::make_shared<RegressionLabels>(m_lab_tiled);
+
+	return NULL;
+}
+
 SGVector<float64_t> NumericalVGLikelihood::get_first_derivative_wrt_hyperparameter(
 	Parameters::const_reference param) const
 {
@@ -101,26 +114,19 @@ SGVector<float64_t> NumericalVGLikelihood::get_first_derivative_wrt_hyperparamet
 		return SGVector<float64_t> ();
 
 	SGVector<float64_t> res(m_lab.vlen);
-	res.zero();
 	Map<VectorXd> eigen_res(res.vector, res.vlen);
 
-	//ll  = ll  + w(i)*lp;
-	std::shared_ptr<Labels> lab=NULL;
-
-	if (supports_binary())
-		lab=std::make_shared<BinaryLabels>(m_lab);
-	else if (supports_regression())
-		lab=std::make_shared<RegressionLabels>(m_lab);
-
-	for (index_t cidx = 0; cidx < m_log_lam.num_cols; cidx++)
-	{
-		SGVector<float64_t> tmp(m_log_lam.get_column_vector(cidx), m_log_lam.num_rows, false);
-		SGVector<float64_t> lp=get_first_derivative(lab, tmp, param);
-		Map<VectorXd> eigen_lp(lp.vector, lp.vlen);
-		eigen_res+=eigen_lp*m_wgh[cidx];
-	}
-
+	auto lab=get_quadrature_labels();
 
+	//evaluate the derivative on all quadrature nodes in one call and fuse
+	//the weight reduction into a matrix-vector product
+	//ll  = ll  + w(i)*lp;
+	SGVector<float64_t> nodes(m_log_lam.matrix,
+		m_log_lam.num_rows*m_log_lam.num_cols, false);
+	SGVector<float64_t> lp=get_first_derivative(lab, nodes, param);
+	Map<MatrixXd> eigen_lp(lp.vector, m_log_lam.num_rows, m_log_lam.num_cols);
+	Map<VectorXd> eigen_wgh(m_wgh.vector, m_wgh.vlen);
+	eigen_res=eigen_lp*eigen_wgh;
 
 	return res;
 }
@@ -128,26 +134,19 @@ SGVector<float64_t> NumericalVGLikelihood::get_first_derivative_wrt_hyperparamet
 SGVector<float64_t> NumericalVGLikelihood::get_variational_expection()
 {
 	SGVector<float64_t> res(m_lab.vlen);
-	res.zero();
 	Map<VectorXd> eigen_res(res.vector, res.vlen);
 
-	//ll  = ll  + w(i)*lp;
-	std::shared_ptr<Labels> lab=NULL;
-
-	if (supports_binary())
-		lab=std::make_shared<BinaryLabels>(m_lab);
-	else if (supports_regression())
-		lab=std::make_shared<RegressionLabels>(m_lab);
-
-	for (index_t cidx = 0; cidx < m_log_lam.num_cols; cidx++)
-	{
-		SGVector<float64_t> tmp(m_log_lam.get_column_vector(cidx), m_log_lam.num_rows, false);
-		SGVector<float64_t> lp=get_log_probability_f(lab, tmp);
-		Map<VectorXd> eigen_lp(lp.vector, lp.vlen);
-		eigen_res+=eigen_lp*m_wgh[cidx];
-	}
-
+	auto lab=get_quadrature_labels();
 
+	//evaluate the log likelihood on all quadrature nodes in one call and
+	//fuse the weight reduction into a matrix-vector product
+	//ll  = ll  + w(i)*lp;
+	SGVector<float64_t> nodes(m_log_lam.matrix,
+		m_log_lam.num_rows*m_log_lam.num_cols, false);
+	SGVector<float64_t> lp=get_log_probability_f(lab, nodes);
+	Map<MatrixXd> eigen_lp(lp.vector, m_log_lam.num_rows, m_log_lam.num_cols);
+	Map<VectorXd> eigen_wgh(m_wgh.vector, m_wgh.vlen);
+	eigen_res=eigen_lp*eigen_wgh;
 
 	return res;
 }
@@ -166,30 +165,26 @@ SGVector<float64_t> NumericalVGLikelihood::get_variational_first_derivative(
 		get_name(), param.first);
 
 	SGVector<float64_t> res(m_mu.vlen);
-	res.zero();
 	Map<VectorXd> eigen_res(res.vector, res.vlen);
 
 	Map<VectorXd> eigen_v(m_s2.vector, m_s2.vlen);
 
-	std::shared_ptr<Labels> lab=NULL;
+	auto lab=get_quadrature_labels();
 
-	if (supports_binary())
-		lab=std::make_shared<BinaryLabels>(m_lab);
-	else if (supports_regression())
-		lab=std::make_shared<RegressionLabels>(m_lab);
+	//evaluate the derivative on all quadrature nodes in one call
+	SGVector<float64_t> nodes(m_log_lam.matrix,
+		m_log_lam.num_rows*m_log_lam.num_cols, false);
+	SGVector<float64_t> dlp=get_log_probability_derivative_f(lab, nodes, 1);
+	Map<MatrixXd> eigen_dlp(dlp.vector, m_log_lam.num_rows, m_log_lam.num_cols);
+	Map<VectorXd> eigen_wgh(m_wgh.vector, m_wgh.vlen);
+	Map<VectorXd> eigen_xgh(m_xgh.vector, m_xgh.vlen);
 
 	if (param.first == "mu")
 	{
 		//Compute the derivative wrt mu
 
 		//df  = df  + w(i)*(dlp);
-		for (index_t cidx=0; cidx<m_log_lam.num_cols; cidx++)
-		{
-			SGVector<float64_t> tmp(m_log_lam.get_column_vector(cidx), m_log_lam.num_rows, false);
-			SGVector<float64_t> dlp=get_log_probability_derivative_f(lab, tmp, 1);
-			Map<VectorXd> eigen_dlp(dlp.vector, dlp.vlen);
-			eigen_res+=eigen_dlp*m_wgh[cidx];
-		}
+		eigen_res=eigen_dlp*eigen_wgh;
 	}
 	else
 	{
@@ -199,13 +194,8 @@ SGVector<float64_t> NumericalVGLikelihood::get_variational_first_derivative(
 		VectorXd eigen_sv=eigen_v.array().sqrt().matrix();
 		const float64_t EPS=2.2204e-16;
 
-		for (index_t cidx=0; cidx<m_log_lam.num_cols; cidx++)
-		{
-			SGVector<float64_t> tmp(m_log_lam.get_column_vector(cidx), m_log_lam.num_rows, false);
-			SGVector<float64_t> dlp=get_log_probability_derivative_f(lab, tmp, 1);
-			Map<VectorXd> eigen_dlp(dlp.vector, dlp.vlen);
-			eigen_res+=((m_wgh[cidx]*0.5*m_xgh[cidx])*eigen_dlp.array()/(eigen_sv.array()+EPS)).matrix();
-		}
+		eigen_res=(eigen_dlp*(0.5*eigen_wgh.cwiseProduct(eigen_xgh))).array()
+			/(eigen_sv.array()+EPS);
 	}
 	return res;
 }
@@ -275,6 +265,13 @@ void NumericalVGLikelihood::precompute()
 		(eigen_t.replicate(1, eigen_v.rows()).array().transpose().colwise()
 		 *eigen_sv.array()).colwise()+eigen_f.array()
 		).matrix();
+
+	//tile the labels across the quadrature columns so the likelihood can be
+	//evaluated on the flattened node matrix in a single call
+	m_lab_tiled=SGVector<float64_t>(m_lab.vlen*m_xgh.vlen);
+	Map<MatrixXd> eigen_lab_tiled(m_lab_tiled.vector, m_lab.vlen, m_xgh.vlen);
+	Map<VectorXd> eigen_lab(m_lab.vector, m_lab.vlen);
+	eigen_lab_tiled=eigen_lab.replicate(1, m_xgh.vlen);
 }
 
 } /* namespace shogun */
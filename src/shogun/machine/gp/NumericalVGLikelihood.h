@@ -158,6 +158,16 @@ private:
 
 	/** The result of used for computing variational expection */
 	SGMatrix<float64_t> m_log_lam;
+
+	/** labels tiled across the quadrature columns of m_log_lam so the
+	 * likelihood can be evaluated on all quadrature nodes in one call */
+	SGVector<float64_t> m_lab_tiled;
+
+	/** wraps the tiled labels in a labels object matching the likelihood
+	 *
+	 * @return labels of the type the likelihood supports
+	 */
+	std::shared_ptr<Labels> get_quadrature_labels() const;
 };
 }
 #endif /* _NUMERICALVGLIKELIHOOD_H_ */
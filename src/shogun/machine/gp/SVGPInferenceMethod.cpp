@@ -0,0 +1,489 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * The reference paper is
+ * Hensman, James, Nicolo Fusi, and Neil D. Lawrence.
+ * "Gaussian processes for big data."
+ * Conference on Uncertainty in Artificial Intelligence. 2013.
+ */
+
+#include <shogun/machine/gp/SVGPInferenceMethod.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/machine/visitors/ShapeVisitor.h>
+#include <shogun/mathematics/Math.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/optimization/SGDMinimizer.h>
+#include <shogun/optimization/GradientDescendUpdater.h>
+#include <shogun/optimization/ConstLearningRate.h>
+
+#include <utility>
+
+using namespace Eigen;
+
+namespace shogun
+{
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+class SVGPInferenceMethodCostFunction: public FirstOrderStochasticCostFunction
+{
+public:
+	SVGPInferenceMethodCostFunction():FirstOrderStochasticCostFunction() { init(); }
+	~SVGPInferenceMethodCostFunction() override { }
+	void set_target(const std::shared_ptr<SVGPInferenceMethod>& obj)
+	{
+		require(obj, "Obj must set");
+		if(m_obj != obj)
+			m_obj=obj;
+	}
+	void unset_target(bool is_unref)
+	{
+		m_obj=NULL;
+	}
+	void begin_sample() override
+	{
+		require(m_obj,"Object not set");
+		m_batch_idx=-1;
+	}
+	bool next_sample() override
+	{
+		require(m_obj,"Object not set");
+		m_batch_idx++;
+		return m_batch_idx*m_obj->get_minibatch_size()<get_num_points();
+	}
+	SGVector<float64_t> get_gradient() override
+	{
+		require(m_obj,"Object not set");
+		index_t start=m_batch_idx*m_obj->get_minibatch_size();
+		index_t len=Math::min(m_obj->get_minibatch_size(), get_num_points()-start);
+		return m_obj->get_minibatch_gradient(start, len);
+	}
+	float64_t get_cost() override
+	{
+		require(m_obj,"Object not set");
+		return m_obj->get_negative_elbo();
+	}
+	SGVector<float64_t> obtain_variable_reference() override
+	{
+		require(m_obj,"Object not set");
+		return m_obj->m_variational_params;
+	}
+	const char* get_name() const override { return "SVGPInferenceMethodCostFunction"; }
+private:
+	void init()
+	{
+		m_obj=NULL;
+		m_batch_idx=-1;
+		SG_ADD((std::shared_ptr<SGObject>*)&m_obj, "SVGPInferenceMethodCostFunction__m_obj",
+			"obj in SVGPInferenceMethodCostFunction");
+		SG_ADD(&m_batch_idx, "SVGPInferenceMethodCostFunction__m_batch_idx",
+			"batch_idx in SVGPInferenceMethodCostFunction");
+	}
+	index_t get_num_points() const
+	{
+		return m_obj->m_ycor.vlen;
+	}
+	std::shared_ptr<SVGPInferenceMethod> m_obj;
+	index_t m_batch_idx;
+};
+#endif /* DOXYGEN_SHOULD_SKIP_THIS */
+
+SVGPInferenceMethod::SVGPInferenceMethod() : SingleSparseInference()
+{
+	init();
+}
+
+SVGPInferenceMethod::SVGPInferenceMethod(std::shared_ptr<Kernel> kern, std::shared_ptr<Features> feat,
+		std::shared_ptr<MeanFunction> m, std::shared_ptr<Labels> lab, std::shared_ptr<LikelihoodModel> mod, std::shared_ptr<Features> lat)
+		: SingleSparseInference(std::move(kern), std::move(feat), std::move(m), std::move(lab), std::move(mod), std::move(lat))
+{
+	init();
+}
+
+void SVGPInferenceMethod::init()
+{
+	m_minibatch_size=100;
+	m_sigma2=0.0;
+	m_chol_kuu=SGMatrix<float64_t>();
+	m_variational_params=SGVector<float64_t>();
+	m_ycor=SGVector<float64_t>();
+
+	SG_ADD(&m_minibatch_size, "minibatch_size",
+		"number of training points per minibatch");
+	SG_ADD(&m_sigma2, "sigma2", "sigma2");
+	SG_ADD(&m_chol_kuu, "chol_kuu", "chol_kuu");
+	SG_ADD(&m_variational_params, "variational_params",
+		"packed mean and cholesky factor of the variational distribution");
+	SG_ADD(&m_ycor, "ycor", "labels minus mean function values");
+
+	auto minimizer=std::make_shared<SGDMinimizer>();
+	minimizer->set_gradient_updater(std::make_shared<GradientDescendUpdater>());
+	auto rate=std::make_shared<ConstLearningRate>();
+	rate->set_const_learning_rate(1e-3);
+	minimizer->set_learning_rate(rate);
+	minimizer->set_number_passes(10);
+	register_minimizer(minimizer);
+}
+
+SVGPInferenceMethod::~SVGPInferenceMethod()
+{
+}
+
+std::shared_ptr<SVGPInferenceMethod> SVGPInferenceMethod::obtain_from_generic(
+		const std::shared_ptr<Inference>& inference)
+{
+	if (inference==NULL)
+		return NULL;
+
+	if (inference->get_inference_type()!=INF_SVGP_REGRESSION)
+		error("Provided inference is not of type SVGPInferenceMethod!");
+
+	return inference->as<SVGPInferenceMethod>();
+}
+
+void SVGPInferenceMethod::check_members() const
+{
+	SingleSparseInference::check_members();
+
+	require(m_model->get_model_type()==LT_GAUSSIAN,
+			"SVGP inference method can only use Gaussian likelihood function");
+	require(m_labels->get_label_type()==LT_REGRESSION, "Labels must be type "
+			"of RegressionLabels");
+}
+
+void SVGPInferenceMethod::register_minimizer(std::shared_ptr<Minimizer> minimizer)
+{
+	auto opt=std::dynamic_pointer_cast<FirstOrderStochasticMinimizer>(minimizer);
+	require(opt, "The minimizer must be an instance of FirstOrderStochasticMinimizer");
+	Inference::register_minimizer(minimizer);
+}
+
+void SVGPInferenceMethod::set_minibatch_size(index_t minibatch_size)
+{
+	require(minibatch_size>0, "Minibatch size ({}) must be positive",
+		minibatch_size);
+	m_minibatch_size=minibatch_size;
+}
+
+void SVGPInferenceMethod::update()
+{
+	SG_TRACE("entering");
+
+	Inference::update();
+	update_chol();
+	optimize_variational_parameters();
+	update_alpha();
+	m_gradient_update=false;
+	update_parameter_hash();
+
+	SG_TRACE("leaving");
+}
+
+void SVGPInferenceMethod::update_chol()
+{
+	// get the sigma variable from the Gaussian likelihood model
+	auto lik=m_model->as<GaussianLikelihood>();
+	float64_t sigma=lik->get_sigma();
+	m_sigma2=sigma*sigma;
+
+	//m-by-m matrix
+	Map<MatrixXd> eigen_kuu(m_kuu.matrix, m_kuu.num_rows, m_kuu.num_cols);
+
+	//Lm = chol(model.Kmm + model.jitter*eye(model.m))
+	LLT<MatrixXd> Luu(
+	    eigen_kuu * std::exp(m_log_scale * 2.0) +
+	    std::exp(m_log_ind_noise) *
+	        MatrixXd::Identity(m_kuu.num_rows, m_kuu.num_cols));
+	m_chol_kuu=SGMatrix<float64_t>(m_kuu.num_rows, m_kuu.num_cols);
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	eigen_chol_kuu=Luu.matrixL();
+
+	SGVector<float64_t> y=m_labels->as<RegressionLabels>()->get_labels();
+	Map<VectorXd> eigen_y(y.vector, y.vlen);
+	SGVector<float64_t> mean=m_mean->get_mean_vector(m_features);
+	Map<VectorXd> eigen_mean(mean.vector, mean.vlen);
+
+	m_ycor=SGVector<float64_t>(y.vlen);
+	Map<VectorXd> eigen_ycor(m_ycor.vector, m_ycor.vlen);
+	eigen_ycor=eigen_y-eigen_mean;
+
+	const index_t m=m_kuu.num_rows;
+
+	// initialize the variational distribution at the prior, q(u)=p(u), so
+	// the KL term vanishes and optimization starts from the unconstrained
+	// model. Kept across updates when the number of inducing points is
+	// unchanged so subsequent calls warm-start from the previous solution
+	if (m_variational_params.vlen!=m+m*m)
+	{
+		m_variational_params=SGVector<float64_t>(m+m*m);
+		m_variational_params.zero();
+		Map<MatrixXd> eigen_L(m_variational_params.vector+m, m, m);
+		eigen_L=eigen_chol_kuu;
+	}
+}
+
+void SVGPInferenceMethod::optimize_variational_parameters()
+{
+	auto minimizer=m_minimizer->as<FirstOrderStochasticMinimizer>();
+	require(minimizer, "The minimizer must be an instance of "
+		"FirstOrderStochasticMinimizer");
+	auto cost_fun=std::make_shared<SVGPInferenceMethodCostFunction>();
+	cost_fun->set_target(shared_from_this()->as<SVGPInferenceMethod>());
+
+	minimizer->set_cost_function(cost_fun);
+	minimizer->minimize();
+	minimizer->unset_cost_function(false);
+	cost_fun->unset_target(false);
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_minibatch_gradient(index_t start,
+	index_t len)
+{
+	const index_t m=m_kuu.num_rows;
+	const index_t n=m_ycor.vlen;
+
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	Map<VectorXd> eigen_mu(m_variational_params.vector, m);
+	Map<MatrixXd> eigen_L(m_variational_params.vector+m, m, m);
+	Map<MatrixXd> eigen_ktru(m_ktru.matrix, m_ktru.num_rows, m_ktru.num_cols);
+	Map<VectorXd> eigen_ycor(m_ycor.vector, m_ycor.vlen);
+
+	//Kmb = Kmn(:,batch)*scale^2, A = Kmm\Kmb
+	MatrixXd Kmb =
+	    eigen_ktru.block(0, start, m, len) * std::exp(m_log_scale * 2.0);
+	MatrixXd A=eigen_chol_kuu.triangularView<Lower>().solve(Kmb);
+	A=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(A);
+
+	//r = y(batch) - mean(batch) - A'*mu
+	VectorXd r=eigen_ycor.segment(start, len)-A.adjoint()*eigen_mu;
+
+	float64_t kl_weight=((float64_t) len)/n;
+
+	SGVector<float64_t> gradient(m+m*m);
+	Map<VectorXd> eigen_grad_mu(gradient.vector, m);
+	Map<MatrixXd> eigen_grad_L(gradient.vector+m, m, m);
+
+	//dF/dmu = -A*r/sigma2 + (b/n)*(Kmm\mu)
+	VectorXd invKuu_mu=eigen_chol_kuu.triangularView<Lower>().solve(eigen_mu);
+	invKuu_mu=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(invKuu_mu);
+	eigen_grad_mu=-A*r/m_sigma2+kl_weight*invKuu_mu;
+
+	//dF/dL = A*(A'*L)/sigma2 + (b/n)*(Kmm\L - L^-T), lower triangle only,
+	//where the lower-triangular projection of L^-T is diag(1./diag(L))
+	MatrixXd invKuu_L=eigen_chol_kuu.triangularView<Lower>().solve(eigen_L);
+	invKuu_L=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(invKuu_L);
+	eigen_grad_L=A*(A.adjoint()*eigen_L)/m_sigma2+kl_weight*invKuu_L;
+	eigen_grad_L.diagonal()-=kl_weight*eigen_L.diagonal().cwiseInverse();
+	eigen_grad_L.triangularView<StrictlyUpper>().setZero();
+
+	return gradient;
+}
+
+float64_t SVGPInferenceMethod::get_negative_elbo()
+{
+	const index_t m=m_kuu.num_rows;
+	const index_t n=m_ycor.vlen;
+
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	Map<VectorXd> eigen_mu(m_variational_params.vector, m);
+	Map<MatrixXd> eigen_L(m_variational_params.vector+m, m, m);
+	Map<MatrixXd> eigen_ktru(m_ktru.matrix, m_ktru.num_rows, m_ktru.num_cols);
+	Map<VectorXd> eigen_ktrtr_diag(m_ktrtr_diag.vector, m_ktrtr_diag.vlen);
+	Map<VectorXd> eigen_ycor(m_ycor.vector, m_ycor.vlen);
+
+	//Kmn = Kmn*scale^2, A = Kmm\Kmn
+	MatrixXd Kmn=eigen_ktru*std::exp(m_log_scale*2.0);
+	MatrixXd A=eigen_chol_kuu.triangularView<Lower>().solve(Kmn);
+	A=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(A);
+
+	//r = y - mean - A'*mu
+	VectorXd r=eigen_ycor-A.adjoint()*eigen_mu;
+
+	//qdiag_i = k_ii - k_i'*(Kmm\k_i), the variance not explained by u
+	VectorXd qdiag=eigen_ktrtr_diag*std::exp(m_log_scale*2.0)
+		-Kmn.cwiseProduct(A).colwise().sum().adjoint();
+
+	//t_i = a_i'*S*a_i = |L'*a_i|^2
+	MatrixXd W=eigen_L.adjoint()*A;
+	float64_t trace_term=W.cwiseAbs2().sum();
+
+	//expected log likelihood part of the negative bound
+	float64_t neg_bound =
+	    0.5 * n * std::log(2 * Math::PI * m_sigma2) +
+	    0.5 * (r.dot(r) + qdiag.array().sum() + trace_term) / m_sigma2;
+
+	//KL(q(u)||p(u)) = 0.5*(tr(Kmm\S) + mu'*(Kmm\mu) - m + log|Kmm| - log|S|)
+	MatrixXd half_solved_L=eigen_chol_kuu.triangularView<Lower>().solve(eigen_L);
+	VectorXd half_solved_mu=eigen_chol_kuu.triangularView<Lower>().solve(eigen_mu);
+	float64_t kl=0.5*(half_solved_L.cwiseAbs2().sum()
+		+half_solved_mu.dot(half_solved_mu)-m)
+		+eigen_chol_kuu.diagonal().array().log().sum()
+		-eigen_L.diagonal().array().abs().log().sum();
+
+	return neg_bound+kl;
+}
+
+void SVGPInferenceMethod::update_alpha()
+{
+	const index_t m=m_kuu.num_rows;
+
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	Map<VectorXd> eigen_vmu(m_variational_params.vector, m);
+	Map<MatrixXd> eigen_vL(m_variational_params.vector+m, m, m);
+
+	//alpha = Kmm\mu so that the predictive mean is k*'*alpha
+	m_alpha=SGVector<float64_t>(m);
+	Map<VectorXd> eigen_alpha(m_alpha.vector, m_alpha.vlen);
+	eigen_alpha=eigen_chol_kuu.triangularView<Lower>().solve(eigen_vmu);
+	eigen_alpha=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(eigen_alpha);
+
+	//L = Kmm\S/Kmm - inv(Kmm) so that the predictive variance is
+	//k** + k*'*L*k*
+	MatrixXd B=eigen_chol_kuu.triangularView<Lower>().solve(eigen_vL);
+	B=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(B);
+	MatrixXd inv_kuu=eigen_chol_kuu.triangularView<Lower>().solve(
+		MatrixXd::Identity(m, m));
+	inv_kuu=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(inv_kuu);
+	m_L=SGMatrix<float64_t>(m, m);
+	Map<MatrixXd> eigen_l(m_L.matrix, m_L.num_rows, m_L.num_cols);
+	eigen_l=B*B.adjoint()-inv_kuu;
+
+	//the variational distribution q(u)=N(mu,L*L') approximates the
+	//posterior over the inducing outputs
+	m_mu=SGVector<float64_t>(m);
+	Map<VectorXd> eigen_mu(m_mu.vector, m_mu.vlen);
+	eigen_mu=eigen_vmu;
+
+	m_Sigma=SGMatrix<float64_t>(m, m);
+	Map<MatrixXd> eigen_Sigma(m_Sigma.matrix, m_Sigma.num_rows,
+		m_Sigma.num_cols);
+	eigen_Sigma=eigen_vL*eigen_vL.adjoint();
+}
+
+void SVGPInferenceMethod::update_deriv()
+{
+	// the quantities needed by the implemented derivatives are computed on
+	// the fly since they require a full pass over the training data
+}
+
+float64_t SVGPInferenceMethod::get_negative_log_marginal_likelihood()
+{
+	if (parameter_hash_changed())
+		update();
+
+	return get_negative_elbo();
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_diagonal_vector()
+{
+	not_implemented(SOURCE_LOCATION);
+	return SGVector<float64_t>();
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_posterior_mean()
+{
+	if (parameter_hash_changed())
+		update();
+
+	return m_mu;
+}
+
+SGMatrix<float64_t> SVGPInferenceMethod::get_posterior_covariance()
+{
+	if (parameter_hash_changed())
+		update();
+
+	return m_Sigma;
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_derivative_wrt_likelihood_model(
+		Parameters::const_reference param)
+{
+	require(param.first == "log_sigma", "Can't compute derivative of "
+			"the nagative log marginal likelihood wrt {}.{} parameter",
+			m_model->get_name(), param.first);
+
+	const index_t m=m_kuu.num_rows;
+	const index_t n=m_ycor.vlen;
+
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	Map<VectorXd> eigen_mu(m_variational_params.vector, m);
+	Map<MatrixXd> eigen_L(m_variational_params.vector+m, m, m);
+	Map<MatrixXd> eigen_ktru(m_ktru.matrix, m_ktru.num_rows, m_ktru.num_cols);
+	Map<VectorXd> eigen_ktrtr_diag(m_ktrtr_diag.vector, m_ktrtr_diag.vlen);
+	Map<VectorXd> eigen_ycor(m_ycor.vector, m_ycor.vlen);
+
+	MatrixXd Kmn=eigen_ktru*std::exp(m_log_scale*2.0);
+	MatrixXd A=eigen_chol_kuu.triangularView<Lower>().solve(Kmn);
+	A=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(A);
+
+	VectorXd r=eigen_ycor-A.adjoint()*eigen_mu;
+	VectorXd qdiag=eigen_ktrtr_diag*std::exp(m_log_scale*2.0)
+		-Kmn.cwiseProduct(A).colwise().sum().adjoint();
+	float64_t trace_term=(eigen_L.adjoint()*A).cwiseAbs2().sum();
+
+	//dF/dlog(sigma) = n - (r'*r + sum(qdiag) + trace_term)/sigma2
+	SGVector<float64_t> dlik(1);
+	dlik[0]=n-(r.dot(r)+qdiag.array().sum()+trace_term)/m_sigma2;
+	return dlik;
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_derivative_wrt_mean(
+	Parameters::const_reference param)
+{
+	SGVector<float64_t> result;
+	auto visitor = std::make_unique<ShapeVisitor>();
+	param.second->get_value().visit(visitor.get());
+	int64_t len= visitor->get_size();
+	result=SGVector<float64_t>(len);
+
+	const index_t m=m_kuu.num_rows;
+
+	Map<MatrixXd> eigen_chol_kuu(m_chol_kuu.matrix, m_chol_kuu.num_rows,
+		m_chol_kuu.num_cols);
+	Map<VectorXd> eigen_mu(m_variational_params.vector, m);
+	Map<MatrixXd> eigen_ktru(m_ktru.matrix, m_ktru.num_rows, m_ktru.num_cols);
+	Map<VectorXd> eigen_ycor(m_ycor.vector, m_ycor.vlen);
+
+	MatrixXd Kmn=eigen_ktru*std::exp(m_log_scale*2.0);
+	MatrixXd A=eigen_chol_kuu.triangularView<Lower>().solve(Kmn);
+	A=eigen_chol_kuu.triangularView<Lower>().adjoint().solve(A);
+
+	VectorXd r=eigen_ycor-A.adjoint()*eigen_mu;
+
+	for (index_t i=0; i<result.vlen; i++)
+	{
+		SGVector<float64_t> dmu=m_mean->get_parameter_derivative(m_features, param, i);
+		Map<VectorXd> eigen_dmu(dmu.vector, dmu.vlen);
+
+		result[i]=-eigen_dmu.dot(r)/m_sigma2;
+	}
+	return result;
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_derivative_wrt_inducing_features(
+	Parameters::const_reference param)
+{
+	not_implemented(SOURCE_LOCATION);
+	return SGVector<float64_t>();
+}
+
+SGVector<float64_t> SVGPInferenceMethod::get_derivative_wrt_inducing_noise(
+	Parameters::const_reference param)
+{
+	not_implemented(SOURCE_LOCATION);
+	return SGVector<float64_t>();
+}
+
+float64_t SVGPInferenceMethod::get_derivative_related_cov(SGVector<float64_t> ddiagKi,
+	SGMatrix<float64_t> dKuui, SGMatrix<float64_t> dKui)
+{
+	not_implemented(SOURCE_LOCATION);
+	return 0.0;
+}
+
+}
@@ -0,0 +1,258 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * The reference paper is
+ * Hensman, James, Nicolo Fusi, and Neil D. Lawrence.
+ * "Gaussian processes for big data."
+ * Conference on Uncertainty in Artificial Intelligence. 2013.
+ */
+
+#ifndef CSVGPINFERENCEMETHOD_H
+#define CSVGPINFERENCEMETHOD_H
+
+#include <shogun/lib/config.h>
+#include <shogun/machine/gp/SingleSparseInference.h>
+
+namespace shogun
+{
+/** @brief The stochastic variational Gaussian process (SVGP) inference method
+ * class.
+ *
+ * Unlike the collapsed bound used in VarDTCInferenceMethod, the variational
+ * distribution over the inducing outputs, \f$q(u)=\mathcal{N}(m,S)\f$ with
+ * \f$S=LL^T\f$, is kept explicit. The evidence lower bound then factorizes
+ * over training points,
+ *
+ * \f[
+ * \mathcal{L}=\sum_{i=1}^{n}\mathbb{E}_{q(f_i)}[\log p(y_i|f_i)]
+ * -KL[q(u)||p(u)],
+ * \f]
+ *
+ * so the variational parameters \f$(m,L)\f$ can be optimized with minibatch
+ * stochastic gradients via the FirstOrderStochasticMinimizer framework. Per
+ * iteration only a minibatch of kernel columns is touched, which makes the
+ * method applicable to training sets far larger than full-batch sparse
+ * inference can handle.
+ *
+ * NOTE: The Gaussian Likelihood Function must be used for this inference
+ * method.
+ */
+class SVGPInferenceMethod: public SingleSparseInference
+{
+friend class SVGPInferenceMethodCostFunction;
+public:
+	/** default constructor */
+	SVGPInferenceMethod();
+
+	/** constructor
+	 *
+	 * @param kernel covariance function
+	 * @param features features to use in inference
+	 * @param mean mean function
+	 * @param labels labels of the features
+	 * @param model likelihood model to use
+	 * @param inducing_features features to use
+	 */
+	SVGPInferenceMethod(std::shared_ptr<Kernel> kernel, std::shared_ptr<Features> features,
+			std::shared_ptr<MeanFunction> mean, std::shared_ptr<Labels> labels, std::shared_ptr<LikelihoodModel> model,
+			std::shared_ptr<Features> inducing_features);
+
+	~SVGPInferenceMethod() override;
+
+	/** returns the name of the inference method
+	 *
+	 * @return name SVGP
+	 */
+	const char* get_name() const override { return "SVGPInferenceMethod"; }
+
+	/** return what type of inference we are
+	 *
+	 * @return inference type SVGP_REGRESSION
+	 */
+	EInferenceType get_inference_type() const override { return INF_SVGP_REGRESSION; }
+
+	/** helper method used to specialize a base class instance
+	 *
+	 * @param inference inference method
+	 * @return casted SVGPInferenceMethod object
+	 */
+	static std::shared_ptr<SVGPInferenceMethod> obtain_from_generic(const std::shared_ptr<Inference>& inference);
+
+	/** get negative log marginal likelihood
+	 *
+	 * @return the negative evidence lower bound, which upper bounds
+	 *
+	 * \f[
+	 * -log(p(y|X, \theta))
+	 * \f]
+	 *
+	 * where \f$y\f$ are the labels, \f$X\f$ are the features, and \f$\theta\f$
+	 * represent hyperparameters.
+	 */
+	float64_t get_negative_log_marginal_likelihood() override;
+
+	/** get diagonal vector
+	 *
+	 * @return diagonal of matrix used to calculate posterior covariance matrix
+	 */
+	SGVector<float64_t> get_diagonal_vector() override;
+
+	/**
+	 * @return whether combination of sparse inference method and given likelihood
+	 * function supports regression
+	 */
+	bool supports_regression() const override
+	{
+		check_members();
+		return m_model->supports_regression();
+	}
+
+	/** returns mean vector \f$m\f$ of the variational Gaussian distribution
+	 * \f$q(u)=\mathcal{N}(m,S)\f$ over the inducing outputs
+	 *
+	 * @return mean vector
+	 */
+	SGVector<float64_t> get_posterior_mean() override;
+
+	/** returns covariance matrix \f$S\f$ of the variational Gaussian
+	 * distribution \f$q(u)=\mathcal{N}(m,S)\f$ over the inducing outputs
+	 *
+	 * @return covariance matrix
+	 */
+	SGMatrix<float64_t> get_posterior_covariance() override;
+
+	/** update all matrices */
+	void update() override;
+
+	/** Set a minimizer
+	 *
+	 * @param minimizer minimizer used in inference method, which must be an
+	 * instance of FirstOrderStochasticMinimizer
+	 */
+	void register_minimizer(std::shared_ptr<Minimizer> minimizer) override;
+
+	/** set the size of the minibatches used for stochastic gradients
+	 *
+	 * @param minibatch_size number of training points per minibatch
+	 */
+	virtual void set_minibatch_size(index_t minibatch_size);
+
+	/** get the size of the minibatches used for stochastic gradients
+	 *
+	 * @return number of training points per minibatch
+	 */
+	virtual index_t get_minibatch_size() { return m_minibatch_size; }
+
+protected:
+	/** check if members of object are valid for inference */
+	void check_members() const override;
+
+	/** update alpha matrix */
+	void update_alpha() override;
+
+	/** update cholesky matrix */
+	void update_chol() override;
+
+	/** update matrices which are required to compute negative log marginal
+	 * likelihood derivatives wrt hyperparameter
+	 */
+	void update_deriv() override;
+
+	/** optimize the variational parameters \f$(m,L)\f$ of \f$q(u)\f$ with the
+	 * registered stochastic minimizer
+	 */
+	virtual void optimize_variational_parameters();
+
+	/** compute the negative evidence lower bound over the full training set
+	 * given the current variational parameters
+	 *
+	 * @return negative evidence lower bound
+	 */
+	virtual float64_t get_negative_elbo();
+
+	/** compute the stochastic gradient of the negative evidence lower bound
+	 * wrt the packed variational parameters on a minibatch. The KL term is
+	 * rescaled by the minibatch fraction so that the gradients of all
+	 * minibatches sum to the full-batch gradient
+	 *
+	 * @param start index of the first point of the minibatch
+	 * @param len number of points in the minibatch
+	 *
+	 * @return packed gradient wrt \f$(m,L)\f$
+	 */
+	virtual SGVector<float64_t> get_minibatch_gradient(index_t start, index_t len);
+
+	/** returns derivative of negative log marginal likelihood wrt parameter of
+	 * likelihood model
+	 *
+	 * @param param parameter of given likelihood model
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_likelihood_model(
+			Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt inducing
+	 * features (input)
+	 *
+	 * @param param parameter of given kernel
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_inducing_features(
+		Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt inducing noise
+	 *
+	 * @param param parameter of given inference class
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_inducing_noise(
+		Parameters::const_reference param) override;
+
+	/** returns derivative of negative log marginal likelihood wrt mean
+	 * function's parameter
+	 *
+	 * @param param parameter of given mean function
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	SGVector<float64_t> get_derivative_wrt_mean(
+			Parameters::const_reference param) override;
+
+	/** compute variables which are required to compute negative log marginal
+	 * likelihood full derivatives wrt cov-like hyperparameter \f$\theta\f$
+	 *
+	 * @param ddiagKi \f$\textbf{diag}(\frac{\partial {\Sigma_{n}}}{\partial {\theta}})\f$
+	 * @param dKuui \f$\frac{\partial {\Sigma_{m}}}{\partial {\theta}}\f$
+	 * @param dKui \f$\frac{\partial {\Sigma_{m,n}}}{\partial {\theta}}\f$
+	 *
+	 * @return derivative of negative log marginal likelihood
+	 */
+	float64_t get_derivative_related_cov(SGVector<float64_t> ddiagKi,
+		SGMatrix<float64_t> dKuui, SGMatrix<float64_t> dKui) override;
+
+protected:
+	/** Lm, where Lm*Lm'=Kmm+ind_noise*eye(m) */
+	SGMatrix<float64_t> m_chol_kuu;
+
+	/** packed variational parameters: the first m entries hold the mean
+	 * \f$m\f$ of \f$q(u)\f$, the remaining m*m entries hold the
+	 * lower-triangular factor \f$L\f$ of \f$S=LL^T\f$ in column-major order
+	 */
+	SGVector<float64_t> m_variational_params;
+
+	/** number of training points per minibatch */
+	index_t m_minibatch_size;
+
+	/** labels minus mean function values, cached for minibatch gradients */
+	SGVector<float64_t> m_ycor;
+
+	/** square of sigma from Gaussian likelihood */
+	float64_t m_sigma2;
+private:
+	/** init */
+	void init();
+};
+}
+#endif /* CSVGPINFERENCEMETHOD_H */
@@ -226,20 +226,34 @@ SGVector<float64_t> SingleFITCInference::get_derivative_related_inducing_feature
 	SGVector<float64_t>deriv_lat(dim*num_samples);
 	deriv_lat.zero();
 
+	//each inducing point owns its own slice of the gradient, so the row
+	//gradients of the kernel can be assembled in parallel
+	auto accumulate_row=[&, dim](int32_t lat_idx, const MatrixXd& coeff)
+	{
+		Map<VectorXd> deriv_lat_col_vec(deriv_lat.vector+lat_idx*dim,dim);
+		SGMatrix<float64_t> deriv_mat=m_kernel->get_parameter_gradient(param, lat_idx);
+		Map<MatrixXd> eigen_deriv_mat(deriv_mat.matrix, deriv_mat.num_rows, deriv_mat.num_cols);
+		deriv_lat_col_vec+=eigen_deriv_mat*coeff.row(lat_idx).transpose();
+	};
+	auto accumulate_rows=[&](const MatrixXd& coeff)
+	{
+		//the first row is computed outside the parallel region so the
+		//kernel's lazily updated ARD weights are in place before the
+		//remaining rows are computed concurrently
+		accumulate_row(0, coeff);
+		#pragma omp parallel for
+		for(int32_t lat_idx=1; lat_idx<coeff.rows(); lat_idx++)
+			accumulate_row(lat_idx, coeff);
+	};
+
 	m_lock.lock();
 	auto inducing_features=get_inducing_features();
 	//asymtric part (related to xu and x)
 	m_kernel->init(inducing_features, m_features);
 	//A = (Kpu.*BdK)*diag(e);
 	//Kpu=1 in our setting
-	MatrixXd A = std::exp(m_log_scale * 2.0) * eigen_BdK;
-	for(int32_t lat_idx=0; lat_idx<A.rows(); lat_idx++)
-	{
-		Map<VectorXd> deriv_lat_col_vec(deriv_lat.vector+lat_idx*dim,dim);
-		SGMatrix<float64_t> deriv_mat=m_kernel->get_parameter_gradient(param, lat_idx);
-		Map<MatrixXd> eigen_deriv_mat(deriv_mat.matrix, deriv_mat.num_rows, deriv_mat.num_cols);
-		deriv_lat_col_vec+=eigen_deriv_mat*(-A.row(lat_idx).transpose());
-	}
+	MatrixXd A = -std::exp(m_log_scale * 2.0) * eigen_BdK;
+	accumulate_rows(A);
 
 	//symtric part (related to xu and xu)
 	m_kernel->init(inducing_features, inducing_features);
@@ -247,13 +261,7 @@ SGVector<float64_t> SingleFITCInference::get_derivative_related_inducing_feature
 	//Kpuu=1 in our setting
 	MatrixXd C =
 	    std::exp(m_log_scale * 2.0) * (eigen_BdK * eigen_B.transpose());
-	for(int32_t lat_lidx=0; lat_lidx<C.rows(); lat_lidx++)
-	{
-		Map<VectorXd> deriv_lat_col_vec(deriv_lat.vector+lat_lidx*dim,dim);
-		SGMatrix<float64_t> deriv_mat=m_kernel->get_parameter_gradient(param, lat_lidx);
-		Map<MatrixXd> eigen_deriv_mat(deriv_mat.matrix, deriv_mat.num_rows, deriv_mat.num_cols);
-		deriv_lat_col_vec+=eigen_deriv_mat*(C.row(lat_lidx).transpose());
-	}
+	accumulate_rows(C);
 
 	m_lock.unlock();
 	return deriv_lat;
@@ -689,9 +689,9 @@ SGVector<float64_t> SingleLaplaceInferenceMethod::get_derivative_wrt_kernel(
 		SGMatrix<float64_t> dK;
 
 		if (result.vlen==1)
-			dK=m_kernel->get_parameter_gradient(param);
+			dK=get_kernel_derivative(param);
 		else
-			dK=m_kernel->get_parameter_gradient(param, i);
+			dK=get_kernel_derivative(param, i);
 
 		Map<MatrixXd> eigen_dK(dK.matrix, dK.num_rows, dK.num_cols);
 
@@ -0,0 +1,240 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/io/SGIO.h>
+#include <shogun/mathematics/JonkerVolgenant.h>
+#include <shogun/mathematics/Math.h>
+
+using namespace shogun;
+
+float64_t JonkerVolgenant::solve(SGVector<int32_t>& row_to_col, SGVector<int32_t>& col_to_row)
+{
+	require(ref_m.num_rows == ref_m.num_cols,
+		"Cost matrix must be square, got {} x {}", ref_m.num_rows, ref_m.num_cols);
+
+	const int32_t dim=ref_m.num_rows;
+	const SGMatrix<float64_t>& cost=ref_m;
+
+	row_to_col=SGVector<int32_t>(dim);
+	col_to_row=SGVector<int32_t>(dim);
+
+	SGVector<float64_t> v(dim);
+	SGVector<int32_t> free_rows(dim);
+	SGVector<int32_t> collist(dim);
+	SGVector<int32_t> matches(dim);
+	SGVector<int32_t> pred(dim);
+	SGVector<float64_t> d(dim);
+
+	matches.zero();
+
+	/* column reduction: assign each column's cheapest row once */
+	for (int32_t j=dim-1; j>=0; j--)
+	{
+		float64_t min=cost(0,j);
+		int32_t imin=0;
+		for (int32_t i=1; i<dim; i++)
+		{
+			if (cost(i,j)<min)
+			{
+				min=cost(i,j);
+				imin=i;
+			}
+		}
+		v[j]=min;
+		if (++matches[imin]==1)
+		{
+			row_to_col[imin]=j;
+			col_to_row[j]=imin;
+		}
+		else
+			col_to_row[j]=-1;
+	}
+
+	/* reduction transfer from rows assigned exactly once */
+	int32_t numfree=0;
+	for (int32_t i=0; i<dim; i++)
+	{
+		if (matches[i]==0)
+			free_rows[numfree++]=i;
+		else if (matches[i]==1)
+		{
+			int32_t j1=row_to_col[i];
+			float64_t min=Math::INFTY;
+			for (int32_t j=0; j<dim; j++)
+			{
+				if (j!=j1 && cost(i,j)-v[j]<min)
+					min=cost(i,j)-v[j];
+			}
+			v[j1]-=min;
+		}
+	}
+
+	/* augmenting row reduction: two sweeps over the still free rows */
+	for (int32_t loopcnt=0; loopcnt<2; loopcnt++)
+	{
+		int32_t k=0;
+		int32_t prvnumfree=numfree;
+		numfree=0;
+		while (k<prvnumfree)
+		{
+			int32_t i=free_rows[k];
+			k++;
+
+			/* smallest and second smallest reduced cost in row i */
+			float64_t umin=cost(i,0)-v[0];
+			float64_t usubmin=Math::INFTY;
+			int32_t j1=0;
+			int32_t j2=-1;
+			for (int32_t j=1; j<dim; j++)
+			{
+				float64_t h=cost(i,j)-v[j];
+				if (h<usubmin)
+				{
+					if (h>=umin)
+					{
+						usubmin=h;
+						j2=j;
+					}
+					else
+					{
+						usubmin=umin;
+						umin=h;
+						j2=j1;
+						j1=j;
+					}
+				}
+			}
+
+			int32_t i0=col_to_row[j1];
+			if (umin<usubmin)
+			{
+				v[j1]-=usubmin-umin;
+			}
+			else if (i0>=0)
+			{
+				j1=j2;
+				i0=col_to_row[j1];
+			}
+
+			row_to_col[i]=j1;
+			col_to_row[j1]=i;
+
+			if (i0>=0)
+			{
+				if (umin<usubmin)
+					free_rows[--k]=i0;
+				else
+					free_rows[numfree++]=i0;
+			}
+		}
+	}
+
+	/* augment along a shortest alternating path for each remaining row */
+	for (int32_t f=0; f<numfree; f++)
+	{
+		int32_t freerow=free_rows[f];
+
+		for (int32_t j=0; j<dim; j++)
+		{
+			d[j]=cost(freerow,j)-v[j];
+			pred[j]=freerow;
+			collist[j]=j;
+		}
+
+		int32_t low=0;
+		int32_t up=0;
+		int32_t last=-1;
+		int32_t endofpath=-1;
+		float64_t min=0;
+		bool unassignedfound=false;
+
+		do
+		{
+			if (up==low)
+			{
+				/* scan the untouched columns for the next frontier */
+				last=low-1;
+				min=d[collist[up++]];
+				for (int32_t k=up; k<dim; k++)
+				{
+					int32_t j=collist[k];
+					float64_t h=d[j];
+					if (h<=min)
+					{
+						if (h<min)
+						{
+							up=low;
+							min=h;
+						}
+						collist[k]=collist[up];
+						collist[up++]=j;
+					}
+				}
+				for (int32_t k=low; k<up; k++)
+				{
+					if (col_to_row[collist[k]]<0)
+					{
+						endofpath=collist[k];
+						unassignedfound=true;
+						break;
+					}
+				}
+			}
+
+			if (!unassignedfound)
+			{
+				int32_t j1=collist[low];
+				low++;
+				int32_t i=col_to_row[j1];
+				float64_t h=cost(i,j1)-v[j1]-min;
+
+				for (int32_t k=up; k<dim; k++)
+				{
+					int32_t j=collist[k];
+					float64_t v2=cost(i,j)-v[j]-h;
+					if (v2<d[j])
+					{
+						pred[j]=i;
+						if (v2==min)
+						{
+							if (col_to_row[j]<0)
+							{
+								endofpath=j;
+								unassignedfound=true;
+								break;
+							}
+							collist[k]=collist[up];
+							collist[up++]=j;
+						}
+						d[j]=v2;
+					}
+				}
+			}
+		} while (!unassignedfound);
+
+		/* update duals of the scanned columns */
+		for (int32_t k=0; k<=last; k++)
+		{
+			int32_t j1=collist[k];
+			v[j1]+=d[j1]-min;
+		}
+
+		/* flip the alternating path back to the free row */
+		int32_t i;
+		do
+		{
+			i=pred[endofpath];
+			col_to_row[endofpath]=i;
+			int32_t j1=endofpath;
+			endofpath=row_to_col[i];
+			row_to_col[i]=j1;
+		} while (i!=freerow);
+	}
+
+	float64_t total=0;
+	for (int32_t i=0; i<dim; i++)
+		total+=cost(i,row_to_col[i]);
+
+	return total;
+}
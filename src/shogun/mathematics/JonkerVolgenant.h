@@ -0,0 +1,57 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#if !defined(_JONKERVOLGENANT_H_)
+#define _JONKERVOLGENANT_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+
+namespace shogun
+{
+
+/** @brief Jonker-Volgenant solver for the linear assignment problem.
+ *
+ * Finds a minimum cost perfect matching of a square cost matrix with the
+ * shortest augmenting path algorithm: column reduction and augmenting row
+ * reduction assign most rows in two sweeps, and only the remaining free
+ * rows need a Dijkstra-style augmentation. In practice this is an order
+ * of magnitude faster than the Munkres/Hungarian method on dense costs.
+ *
+ * cf. R. Jonker and A. Volgenant. A shortest augmenting path algorithm
+ * for dense and sparse linear assignment problems. Computing 38, 1987.
+ */
+class JonkerVolgenant
+{
+public:
+	/** constructor
+	 *
+	 * @param m square cost matrix, left untouched
+	 */
+	JonkerVolgenant(const SGMatrix<float64_t>& m) : ref_m(m)
+	{
+	}
+
+	/** destructor */
+	~JonkerVolgenant()
+	{
+	}
+
+	/** solve the assignment problem
+	 *
+	 * @param row_to_col column assigned to each row (output, resized)
+	 * @param col_to_row row assigned to each column (output, resized)
+	 * @return total cost of the optimal assignment
+	 */
+	float64_t solve(SGVector<int32_t>& row_to_col, SGVector<int32_t>& col_to_row);
+
+private:
+	const SGMatrix<float64_t>& ref_m;
+};
+
+} // namespace shogun
+
+#endif /* !defined(_JONKERVOLGENANT_H_) */
@@ -917,7 +917,9 @@ class Math : public SGObject
 		template <class T>
 			static void radix_sort_helper(T* array, int32_t size, uint16_t i)
 			{
-				static size_t count[256], nc, cmin;
+				/* per-thread histogram state, so that independent arrays
+				 * can be sorted concurrently */
+				static thread_local size_t count[256], nc, cmin;
 				T *ak;
 				uint8_t c=0;
 				radix_stack_t<T> s[RADIX_STACK_SIZE], *sp, *olds, *bigs;
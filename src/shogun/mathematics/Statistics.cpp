@@ -863,16 +863,23 @@ Statistics::SigmoidParamters Statistics::fit_sigmoid(
 	/* result parameters of sigmoid */
 	float64_t a = 0;
 	float64_t b = std::log((prior0 + 1.0) / (prior1 + 1.0));
-	float64_t fval = 0.0;
 
-	for (index_t i = 0; i < length; ++i)
-	{
-		float64_t fApB = scores[i] * a + b;
-		if (fApB >= 0)
-			fval += t[i] * fApB + std::log(1 + std::exp(-fApB));
-		else
-			fval += (t[i] - 1) * fApB + std::log(1 + std::exp(fApB));
-	}
+	/* vectorized over the full score vector; note exp(-|fApB|) equals
+	 * exp(-fApB) on the positive branch and exp(fApB) on the negative
+	 * one, so both branches of the original scalar code share it */
+	Map<ArrayXd> scores_arr(scores.vector, length);
+	Map<ArrayXd> t_arr(t.vector, length);
+
+	auto objective = [&scores_arr, &t_arr](float64_t a_, float64_t b_) {
+		ArrayXd fApB = scores_arr * a_ + b_;
+		ArrayXd log_term = (1.0 + (-fApB.abs()).exp()).log();
+		return ((fApB >= 0)
+		            .select(t_arr * fApB, (t_arr - 1.0) * fApB) +
+		        log_term)
+		    .sum();
+	};
+
+	float64_t fval = objective(a, b);
 
 	index_t it;
 	float64_t g1;
@@ -882,36 +889,19 @@ Statistics::SigmoidParamters Statistics::fit_sigmoid(
 		SG_DEBUG("Iteration {}, a={}, b={}, fval={}", it, a, b, fval)
 
 		/* Update Gradient and Hessian (use H' = H + sigma I) */
-		float64_t h11 = sigma; // Numerically ensures strict PD
-		float64_t h22 = h11;
-		float64_t h21 = 0;
-		g1 = 0;
-		g2 = 0;
-
-		for (index_t i = 0; i < length; ++i)
-		{
-			float64_t fApB = scores[i] * a + b;
-			float64_t p;
-			float64_t q;
-			if (fApB >= 0)
-			{
-				p = std::exp(-fApB) / (1.0 + std::exp(-fApB));
-				q = 1.0 / (1.0 + std::exp(-fApB));
-			}
-			else
-			{
-				p = 1.0 / (1.0 + std::exp(fApB));
-				q = std::exp(fApB) / (1.0 + std::exp(fApB));
-			}
-
-			float64_t d2 = p * q;
-			h11 += scores[i] * scores[i] * d2;
-			h22 += d2;
-			h21 += scores[i] * d2;
-			float64_t d1 = t[i] - p;
-			g1 += scores[i] * d1;
-			g2 += d1;
-		}
+		ArrayXd fApB = scores_arr * a + b;
+		ArrayXd expn = (-fApB.abs()).exp();
+		ArrayXd denom = 1.0 + expn;
+		ArrayXd p = (fApB >= 0).select(expn / denom, 1.0 / denom);
+		ArrayXd q = (fApB >= 0).select(1.0 / denom, expn / denom);
+
+		ArrayXd d2 = p * q;
+		float64_t h11 = sigma + (scores_arr.square() * d2).sum();
+		float64_t h22 = sigma + d2.sum();
+		float64_t h21 = (scores_arr * d2).sum();
+		ArrayXd d1 = t_arr - p;
+		g1 = (scores_arr * d1).sum();
+		g2 = d1.sum();
 
 		/* Stopping Criteria */
 		if (Math::abs(g1) < epsilon && Math::abs(g2) < epsilon)
@@ -932,15 +922,7 @@ Statistics::SigmoidParamters Statistics::fit_sigmoid(
 			float64_t newB = b + stepsize * dB;
 
 			/* New function value */
-			float64_t newf = 0.0;
-			for (index_t i = 0; i < length; ++i)
-			{
-				float64_t fApB = scores[i] * newA + newB;
-				if (fApB >= 0)
-					newf += t[i] * fApB + std::log(1 + std::exp(-fApB));
-				else
-					newf += (t[i] - 1) * fApB + std::log(1 + std::exp(fApB));
-			}
+			float64_t newf = objective(newA, newB);
 
 			/* Check sufficient decrease */
 			if (newf < fval + 0.0001 * stepsize * gd)
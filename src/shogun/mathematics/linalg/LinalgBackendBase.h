@@ -34,6 +34,7 @@
 #define LINALG_BACKEND_BASE_H__
 
 #include <memory>
+#include <vector>
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGVector.h>
@@ -540,6 +541,23 @@ namespace shogun
 		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_IN_PLACE_MATRIX_PROD, SGMatrix)
 #undef BACKEND_GENERIC_IN_PLACE_MATRIX_PROD
 
+/**
+ * Wrapper method of batched matrix product method.
+ *
+ * @see linalg::matrix_prod_batched
+ */
+#define BACKEND_GENERIC_BATCHED_MATRIX_PROD(Type, Container)                   \
+	virtual void matrix_prod_batched(                                          \
+	    const std::vector<SGMatrix<Type>>& a,                                  \
+	    const std::vector<SGMatrix<Type>>& b,                                  \
+	    std::vector<SGMatrix<Type>>& result, bool transpose_A,                 \
+	    bool transpose_B) const                                                \
+	{                                                                          \
+		not_implemented(SOURCE_LOCATION);;                                                    \
+	}
+		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_BATCHED_MATRIX_PROD, SGMatrix)
+#undef BACKEND_GENERIC_BATCHED_MATRIX_PROD
+
 /**
  * Wrapper method of max method. Return the largest element in a vector or
  * matrix.
@@ -556,6 +574,20 @@ namespace shogun
 		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_MAX, SGMatrix)
 #undef BACKEND_GENERIC_MAX
 
+/**
+ * Wrapper method that returns the index of the largest element in a vector.
+ *
+ * @see linalg::arg_max
+ */
+#define BACKEND_GENERIC_ARG_MAX(Type, Container)                               \
+	virtual index_t arg_max(const Container<Type>& a) const                    \
+	{                                                                          \
+		not_implemented(SOURCE_LOCATION);;                                                    \
+		return 0;                                                              \
+	}
+		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_ARG_MAX, SGVector)
+#undef BACKEND_GENERIC_ARG_MAX
+
 /**
  * Wrapper method that computes mean of SGVectors and SGMatrices
  * that are composed of real numbers.
@@ -301,6 +301,16 @@ namespace shogun
 		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_IN_PLACE_MATRIX_PROD, SGMatrix)
 #undef BACKEND_GENERIC_IN_PLACE_MATRIX_PROD
 
+/** Implementation of @see LinalgBackendBase::matrix_prod_batched */
+#define BACKEND_GENERIC_BATCHED_MATRIX_PROD(Type, Container)                   \
+	virtual void matrix_prod_batched(                                          \
+	    const std::vector<SGMatrix<Type>>& a,                                  \
+	    const std::vector<SGMatrix<Type>>& b,                                  \
+	    std::vector<SGMatrix<Type>>& result, bool transpose_A,                 \
+	    bool transpose_B) const;
+		DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_BATCHED_MATRIX_PROD, SGMatrix)
+#undef BACKEND_GENERIC_BATCHED_MATRIX_PROD
+
 /** Implementation of @see LinalgBackendBase::max */
 #define BACKEND_GENERIC_MAX(Type, Container)                                   \
 	virtual Type max(const Container<Type>& a) const;
@@ -308,6 +318,12 @@ namespace shogun
 		DEFINE_FOR_NON_COMPLEX_PTYPE(BACKEND_GENERIC_MAX, SGMatrix)
 #undef BACKEND_GENERIC_MAX
 
+/** Implementation of @see LinalgBackendBase::arg_max */
+#define BACKEND_GENERIC_ARG_MAX(Type, Container)                               \
+	virtual index_t arg_max(const Container<Type>& a) const;
+		DEFINE_FOR_NON_COMPLEX_PTYPE(BACKEND_GENERIC_ARG_MAX, SGVector)
+#undef BACKEND_GENERIC_ARG_MAX
+
 /** Implementation of @see LinalgBackendBase::mean */
 #define BACKEND_GENERIC_REAL_MEAN(Type, Container)                             \
 	virtual float64_t mean(const Container<Type>& a) const;
@@ -777,6 +793,14 @@ namespace shogun
 		    const SGMatrix<T>& a, const SGMatrix<T>& b, SGMatrix<T>& result,
 		    bool transpose_A, bool transpose_B) const;
 
+		/** Eigen3 batched matrix in-place product method */
+		template <typename T>
+		void matrix_prod_batched_impl(
+		    const std::vector<SGMatrix<T>>& a,
+		    const std::vector<SGMatrix<T>>& b,
+		    std::vector<SGMatrix<T>>& result, bool transpose_A,
+		    bool transpose_B) const;
+
 		/** Return the largest element in the vector with Eigen3 library */
 		template <typename T>
 		T max_impl(const SGVector<T>& vec) const;
@@ -785,6 +809,11 @@ namespace shogun
 		template <typename T>
 		T max_impl(const SGMatrix<T>& mat) const;
 
+		/** Return the index of the largest element in the vector with Eigen3
+		 * library */
+		template <typename T>
+		index_t arg_max_impl(const SGVector<T>& vec) const;
+
 		/** Real eigen3 vector and matrix mean method */
 		template <typename T, template <typename> class Container>
 		typename std::enable_if<!std::is_same<T, complex128_t>::value,
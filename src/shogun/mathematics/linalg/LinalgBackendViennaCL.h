@@ -38,6 +38,8 @@
 
 #ifdef HAVE_VIENNACL
 
+#include <memory>
+
 #include <shogun/mathematics/linalg/GPUMemoryViennaCL.h>
 #include <viennacl/linalg/inner_prod.hpp>
 #include <viennacl/linalg/prod.hpp>
@@ -332,7 +334,8 @@ namespace shogun
 
 			GPUMemoryViennaCL<T>* p_gpu = cast_to_viennacl(p);
 			GPUMemoryViennaCL<T>* q_gpu = cast_to_viennacl(q);
-			GPUMemoryViennaCL<T>* result_gpu = new GPUMemoryViennaCL<T>(1);
+			std::unique_ptr<GPUMemoryViennaCL<T>> result_gpu(
+			    new GPUMemoryViennaCL<T>(1));
 
 			viennacl::ocl::kernel& kernel = generate_cross_entropy_kernel<T>();
 			viennacl::ocl::enqueue(
@@ -342,7 +345,8 @@ namespace shogun
 			        q_gpu->data_matrix(q.num_rows, q.num_cols),
 			        cl_int(q_gpu->m_offset), result_gpu->data_vector(1)));
 
-			T* result = reinterpret_cast<T*>(SG_MALLOC(aligned_t, 1));
+			aligned_t result_storage;
+			T* result = reinterpret_cast<T*>(&result_storage);
 			viennacl::backend::memory_read(
 			    *(result_gpu->m_data), result_gpu->m_offset * sizeof(T),
 			    sizeof(T), result);
@@ -497,7 +501,8 @@ namespace shogun
 			    aligned_t;
 
 			GPUMemoryViennaCL<T>* a_gpu = cast_to_viennacl(a);
-			GPUMemoryViennaCL<T>* result_gpu = new GPUMemoryViennaCL<T>(1);
+			std::unique_ptr<GPUMemoryViennaCL<T>> result_gpu(
+			    new GPUMemoryViennaCL<T>(1));
 
 			viennacl::ocl::kernel& kernel = generate_max_kernel<T>();
 			viennacl::ocl::enqueue(
@@ -505,7 +510,8 @@ namespace shogun
 			        a_gpu->data_vector(a.size()), cl_int(a.size()),
 			        cl_int(a_gpu->m_offset), result_gpu->data_vector(1)));
 
-			T* result = reinterpret_cast<T*>(SG_MALLOC(aligned_t, 1));
+			aligned_t result_storage;
+			T* result = reinterpret_cast<T*>(&result_storage);
 			viennacl::backend::memory_read(
 			    *(result_gpu->m_data), result_gpu->m_offset * sizeof(T),
 			    sizeof(T), result);
@@ -692,7 +698,8 @@ namespace shogun
 
 			GPUMemoryViennaCL<T>* p_gpu = cast_to_viennacl(p);
 			GPUMemoryViennaCL<T>* q_gpu = cast_to_viennacl(q);
-			GPUMemoryViennaCL<T>* result_gpu = new GPUMemoryViennaCL<T>(1);
+			std::unique_ptr<GPUMemoryViennaCL<T>> result_gpu(
+			    new GPUMemoryViennaCL<T>(1));
 
 			viennacl::ocl::kernel& kernel = generate_squared_error_kernel<T>();
 			viennacl::ocl::enqueue(
@@ -702,7 +709,8 @@ namespace shogun
 			        q_gpu->data_matrix(q.num_rows, q.num_cols),
 			        cl_int(q_gpu->m_offset), result_gpu->data_vector(1)));
 
-			T* result = reinterpret_cast<T*>(SG_MALLOC(aligned_t, 1));
+			aligned_t result_storage;
+			T* result = reinterpret_cast<T*>(&result_storage);
 			viennacl::backend::memory_read(
 			    *(result_gpu->m_data), result_gpu->m_offset * sizeof(T),
 			    sizeof(T), result);
@@ -718,7 +726,8 @@ namespace shogun
 			    aligned_t;
 
 			GPUMemoryViennaCL<T>* mat_gpu = cast_to_viennacl(mat);
-			GPUMemoryViennaCL<T>* result_gpu = new GPUMemoryViennaCL<T>(1);
+			std::unique_ptr<GPUMemoryViennaCL<T>> result_gpu(
+			    new GPUMemoryViennaCL<T>(1));
 
 			viennacl::ocl::kernel& kernel = generate_sum_kernel<T>(no_diag);
 			viennacl::ocl::enqueue(
@@ -727,8 +736,8 @@ namespace shogun
 			        cl_int(mat.num_rows), cl_int(mat.num_cols),
 			        cl_int(mat_gpu->m_offset), result_gpu->data_vector(1)));
 
-			T* result;
-			result = reinterpret_cast<T*>(SG_MALLOC(aligned_t, 1));
+			aligned_t result_storage;
+			T* result = reinterpret_cast<T*>(&result_storage);
 			viennacl::backend::memory_read(
 			    *(result_gpu->m_data), result_gpu->m_offset * sizeof(T),
 			    sizeof(T), result);
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2016, Shogun-Toolbox e.V. <shogun-team@shogun-toolbox.org>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LINALG_LAZY_H__
+#define LINALG_LAZY_H__
+
+#include <shogun/io/SGIO.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/linalg/internal/ParallelDispatch.h>
+
+#include <cmath>
+#include <utility>
+
+namespace shogun
+{
+	namespace linalg
+	{
+		/** @name Lazy expressions
+		 *
+		 * Chained eager calls like add(element_prod(a, b), c) materialize a
+		 * temporary per call; the lazy front end instead builds an expression
+		 * tree and evaluates the whole chain in one traversal when eval() is
+		 * called:
+		 *
+		 * \code
+		 * auto r = add(element_prod(lazy(a), lazy(b)), lazy(c)).eval();
+		 * \endcode
+		 *
+		 * Leaves hold the operand containers by value, which only copies the
+		 * refcounted handle and keeps the data alive for the lifetime of the
+		 * expression. Evaluation of large expressions is threaded through the
+		 * shared parallel dispatch helper.
+		 */
+		///@{
+
+		/** Leaf of a lazy expression, wrapping a container by handle */
+		template <typename ContainerType>
+		class LazyLeaf
+		{
+		public:
+			using Scalar = typename ContainerType::Scalar;
+
+			explicit LazyLeaf(ContainerType operand)
+			    : m_operand(std::move(operand))
+			{
+			}
+
+			index_t size() const
+			{
+				return static_cast<index_t>(m_operand.size());
+			}
+
+			Scalar operator[](index_t i) const
+			{
+				return m_operand[i];
+			}
+
+			/** allocates an uninitialized container of the operand's shape */
+			ContainerType empty_like() const
+			{
+				return empty_like_impl(m_operand);
+			}
+
+		private:
+			static SGVector<Scalar> empty_like_impl(const SGVector<Scalar>& v)
+			{
+				return SGVector<Scalar>(v.vlen);
+			}
+
+			static SGMatrix<Scalar> empty_like_impl(const SGMatrix<Scalar>& m)
+			{
+				return SGMatrix<Scalar>(m.num_rows, m.num_cols);
+			}
+
+			ContainerType m_operand;
+		};
+
+		/** Weighted elementwise sum of two lazy expressions */
+		template <typename LHS, typename RHS>
+		class LazyAdd
+		{
+		public:
+			using Scalar = typename LHS::Scalar;
+
+			LazyAdd(LHS lhs, RHS rhs, Scalar alpha, Scalar beta)
+			    : m_lhs(std::move(lhs)), m_rhs(std::move(rhs)),
+			      m_alpha(alpha), m_beta(beta)
+			{
+			}
+
+			index_t size() const
+			{
+				return m_lhs.size();
+			}
+
+			Scalar operator[](index_t i) const
+			{
+				return m_alpha * m_lhs[i] + m_beta * m_rhs[i];
+			}
+
+			auto empty_like() const
+			{
+				return m_lhs.empty_like();
+			}
+
+		private:
+			LHS m_lhs;
+			RHS m_rhs;
+			Scalar m_alpha;
+			Scalar m_beta;
+		};
+
+		/** Elementwise product of two lazy expressions */
+		template <typename LHS, typename RHS>
+		class LazyElementProd
+		{
+		public:
+			using Scalar = typename LHS::Scalar;
+
+			LazyElementProd(LHS lhs, RHS rhs)
+			    : m_lhs(std::move(lhs)), m_rhs(std::move(rhs))
+			{
+			}
+
+			index_t size() const
+			{
+				return m_lhs.size();
+			}
+
+			Scalar operator[](index_t i) const
+			{
+				return m_lhs[i] * m_rhs[i];
+			}
+
+			auto empty_like() const
+			{
+				return m_lhs.empty_like();
+			}
+
+		private:
+			LHS m_lhs;
+			RHS m_rhs;
+		};
+
+		/** Elementwise quotient of two lazy expressions */
+		template <typename LHS, typename RHS>
+		class LazyElementDiv
+		{
+		public:
+			using Scalar = typename LHS::Scalar;
+
+			LazyElementDiv(LHS lhs, RHS rhs)
+			    : m_lhs(std::move(lhs)), m_rhs(std::move(rhs))
+			{
+			}
+
+			index_t size() const
+			{
+				return m_lhs.size();
+			}
+
+			Scalar operator[](index_t i) const
+			{
+				return m_lhs[i] / m_rhs[i];
+			}
+
+			auto empty_like() const
+			{
+				return m_lhs.empty_like();
+			}
+
+		private:
+			LHS m_lhs;
+			RHS m_rhs;
+		};
+
+		/** Elementwise exponential of a lazy expression */
+		template <typename Operand>
+		class LazyExponent
+		{
+		public:
+			using Scalar = typename Operand::Scalar;
+
+			explicit LazyExponent(Operand operand)
+			    : m_operand(std::move(operand))
+			{
+			}
+
+			index_t size() const
+			{
+				return m_operand.size();
+			}
+
+			Scalar operator[](index_t i) const
+			{
+				return std::exp(m_operand[i]);
+			}
+
+			auto empty_like() const
+			{
+				return m_operand.empty_like();
+			}
+
+		private:
+			Operand m_operand;
+		};
+
+		/** Handle of a lazy expression tree, materialized with eval() */
+		template <typename Expr>
+		class LazyExpression
+		{
+		public:
+			using Scalar = typename Expr::Scalar;
+
+			explicit LazyExpression(Expr expr) : m_expr(std::move(expr))
+			{
+			}
+
+			/** @return number of elements of the expression */
+			index_t size() const
+			{
+				return m_expr.size();
+			}
+
+			/** @return value of the expression at the given flat index */
+			Scalar operator[](index_t i) const
+			{
+				return m_expr[i];
+			}
+
+			/** @return wrapped expression node */
+			const Expr& expression() const
+			{
+				return m_expr;
+			}
+
+			/** evaluates the whole expression chain in one traversal
+			 *
+			 * @return newly allocated container with the result
+			 */
+			auto eval() const
+			{
+				auto result = m_expr.empty_like();
+				parallel_elementwise(
+				    size(), [&](index_t offset, index_t len) {
+					    for (index_t i = offset; i < offset + len; i++)
+						    result[i] = m_expr[i];
+				    });
+				return result;
+			}
+
+		private:
+			Expr m_expr;
+		};
+
+		/** wraps a vector as a lazy expression leaf
+		 *
+		 * @param vec operand vector
+		 * @return lazy expression evaluating to the vector
+		 */
+		template <typename T>
+		LazyExpression<LazyLeaf<SGVector<T>>> lazy(SGVector<T> vec)
+		{
+			return LazyExpression<LazyLeaf<SGVector<T>>>(
+			    LazyLeaf<SGVector<T>>(std::move(vec)));
+		}
+
+		/** wraps a matrix as a lazy expression leaf
+		 *
+		 * @param mat operand matrix
+		 * @return lazy expression evaluating to the matrix
+		 */
+		template <typename T>
+		LazyExpression<LazyLeaf<SGMatrix<T>>> lazy(SGMatrix<T> mat)
+		{
+			return LazyExpression<LazyLeaf<SGMatrix<T>>>(
+			    LazyLeaf<SGMatrix<T>>(std::move(mat)));
+		}
+
+		/** Performs the operation \f$\alpha a + \beta b\f$ lazily
+		 *
+		 * @param a first expression
+		 * @param b second expression
+		 * @param alpha constant to be multiplied by the first expression
+		 * @param beta constant to be multiplied by the second expression
+		 * @return lazy expression of the result
+		 */
+		template <typename E1, typename E2>
+		LazyExpression<LazyAdd<E1, E2>> add(
+		    const LazyExpression<E1>& a, const LazyExpression<E2>& b,
+		    typename E1::Scalar alpha = 1, typename E1::Scalar beta = 1)
+		{
+			require(
+			    a.size() == b.size(),
+			    "Dimension mismatch! {} vs {}", a.size(), b.size());
+			return LazyExpression<LazyAdd<E1, E2>>(LazyAdd<E1, E2>(
+			    a.expression(), b.expression(), alpha, beta));
+		}
+
+		/** Performs the operation \f$a \odot b\f$ lazily
+		 *
+		 * @param a first expression
+		 * @param b second expression
+		 * @return lazy expression of the result
+		 */
+		template <typename E1, typename E2>
+		LazyExpression<LazyElementProd<E1, E2>> element_prod(
+		    const LazyExpression<E1>& a, const LazyExpression<E2>& b)
+		{
+			require(
+			    a.size() == b.size(),
+			    "Dimension mismatch! {} vs {}", a.size(), b.size());
+			return LazyExpression<LazyElementProd<E1, E2>>(
+			    LazyElementProd<E1, E2>(a.expression(), b.expression()));
+		}
+
+		/** Performs the operation \f$a \oslash b\f$ lazily
+		 *
+		 * @param a first expression
+		 * @param b second expression
+		 * @return lazy expression of the result
+		 */
+		template <typename E1, typename E2>
+		LazyExpression<LazyElementDiv<E1, E2>> element_div(
+		    const LazyExpression<E1>& a, const LazyExpression<E2>& b)
+		{
+			require(
+			    a.size() == b.size(),
+			    "Dimension mismatch! {} vs {}", a.size(), b.size());
+			return LazyExpression<LazyElementDiv<E1, E2>>(
+			    LazyElementDiv<E1, E2>(a.expression(), b.expression()));
+		}
+
+		/** Performs the operation \f$\exp(a)\f$ lazily
+		 *
+		 * @param a expression
+		 * @return lazy expression of the result
+		 */
+		template <typename E>
+		LazyExpression<LazyExponent<E>> exponent(const LazyExpression<E>& a)
+		{
+			return LazyExpression<LazyExponent<E>>(
+			    LazyExponent<E>(a.expression()));
+		}
+
+		///@}
+	}
+}
+#endif // LINALG_LAZY_H__
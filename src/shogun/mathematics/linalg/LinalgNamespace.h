@@ -36,6 +36,7 @@
 #include <shogun/base/ShogunEnv.h>
 #include <shogun/mathematics/linalg/LinalgBackendBase.h>
 #include <shogun/mathematics/linalg/LinalgEnums.h>
+#include <shogun/mathematics/linalg/LinalgLazy.h>
 #include <shogun/mathematics/linalg/SGLinalg.h>
 
 namespace shogun
@@ -1629,6 +1630,87 @@ namespace shogun
 			return result;
 		}
 
+		/** Performs matrix multiplication for a batch of independent operand
+		 * pairs in one backend call.
+		 *
+		 * The batch is handed to the backend as a whole, which keeps the
+		 * per-call dispatch overhead off the critical path and lets the
+		 * backend spread the products across threads; per-node tree math and
+		 * per-component model updates issue thousands of tiny products that
+		 * are too small to parallelize individually.
+		 *
+		 * @param A First matrices, one per batch entry
+		 * @param B Second matrices, one per batch entry
+		 * @param result Result matrices of matching shapes, one per entry
+		 * @param transpose_A whether to transpose the first matrices
+		 * @param transpose_B whether to transpose the second matrices
+		 */
+		template <typename T>
+		void matrix_prod_batched(
+		    const std::vector<SGMatrix<T>>& A, const std::vector<SGMatrix<T>>& B,
+		    std::vector<SGMatrix<T>>& result, bool transpose_A = false,
+		    bool transpose_B = false)
+		{
+			require(
+			    A.size() == B.size() && A.size() == result.size(),
+			    "Number of matrices in batches A ({}), B ({}) and "
+			    "result ({}) should be equal!",
+			    A.size(), B.size(), result.size());
+			require(!A.empty(), "Given batch should not be empty!");
+
+			for (size_t i = 0; i < A.size(); ++i)
+			{
+				const index_t inner_A =
+				    transpose_A ? A[i].num_rows : A[i].num_cols;
+				const index_t inner_B =
+				    transpose_B ? B[i].num_cols : B[i].num_rows;
+				require(
+				    inner_A == inner_B,
+				    "Dimension mismatch in batch entry {}: {} vs {}!", i,
+				    inner_A, inner_B);
+			}
+
+			infer_backend(A[0], B[0])->matrix_prod_batched(
+			    A, B, result, transpose_A, transpose_B);
+		}
+
+		/** Performs matrix multiplication for a batch of independent operand
+		 * pairs in one backend call.
+		 *
+		 * This version returns the results in newly created matrices.
+		 *
+		 * @param A First matrices, one per batch entry
+		 * @param B Second matrices, one per batch entry
+		 * @param transpose_A whether to transpose the first matrices
+		 * @param transpose_B whether to transpose the second matrices
+		 * @return The results of the operation, one matrix per entry
+		 */
+		template <typename T>
+		std::vector<SGMatrix<T>> matrix_prod_batched(
+		    const std::vector<SGMatrix<T>>& A, const std::vector<SGMatrix<T>>& B,
+		    bool transpose_A = false, bool transpose_B = false)
+		{
+			require(
+			    A.size() == B.size(),
+			    "Number of matrices in batches A ({}) and B ({}) should "
+			    "be equal!",
+			    A.size(), B.size());
+			require(!A.empty(), "Given batch should not be empty!");
+
+			std::vector<SGMatrix<T>> result;
+			result.reserve(A.size());
+			for (size_t i = 0; i < A.size(); ++i)
+			{
+				result.emplace_back(
+				    transpose_A ? A[i].num_cols : A[i].num_rows,
+				    transpose_B ? B[i].num_rows : B[i].num_cols);
+			}
+
+			matrix_prod_batched(A, B, result, transpose_A, transpose_B);
+
+			return result;
+		}
+
 		/**
 		 * Performs the operation y = \alpha ax + \beta y
 		 * This function multiplies a * x (after transposing a, if needed)
@@ -1688,6 +1770,19 @@ namespace shogun
 			return infer_backend(a)->max(a);
 		}
 
+		/**
+		 * Returns the index of the largest element in a vector
+		 *
+		 * @param a Input vector
+		 * @return The index of the largest value in the vector
+		 */
+		template <typename T>
+		index_t arg_max(const SGVector<T>& a)
+		{
+			require(a.size() > 0, "Vector cannot be empty!");
+			return infer_backend(a)->arg_max(a);
+		}
+
 		/**
 		 * Method that computes the mean of vectors or matrices composed of real
 		 * numbers.
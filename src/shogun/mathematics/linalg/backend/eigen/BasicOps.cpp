@@ -33,6 +33,7 @@
 #include <shogun/base/range.h>
 #include <shogun/mathematics/linalg/LinalgBackendEigen.h>
 #include <shogun/mathematics/linalg/LinalgMacros.h>
+#include <shogun/mathematics/linalg/internal/ParallelDispatch.h>
 
 using namespace shogun;
 
@@ -244,6 +245,18 @@ DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_IN_PLACE_MATRIX_PROD, SGVector)
 DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_IN_PLACE_MATRIX_PROD, SGMatrix)
 #undef BACKEND_GENERIC_IN_PLACE_MATRIX_PROD
 
+#define BACKEND_GENERIC_BATCHED_MATRIX_PROD(Type, Container)                   \
+	void LinalgBackendEigen::matrix_prod_batched(                              \
+	    const std::vector<SGMatrix<Type>>& a,                                  \
+	    const std::vector<SGMatrix<Type>>& b,                                  \
+	    std::vector<SGMatrix<Type>>& result, bool transpose_A,                 \
+	    bool transpose_B) const                                                \
+	{                                                                          \
+		matrix_prod_batched_impl(a, b, result, transpose_A, transpose_B);      \
+	}
+DEFINE_FOR_ALL_PTYPE(BACKEND_GENERIC_BATCHED_MATRIX_PROD, SGMatrix)
+#undef BACKEND_GENERIC_BATCHED_MATRIX_PROD
+
 #define BACKEND_GENERIC_IN_PLACE_SCALE(Type, Container)                        \
 	void LinalgBackendEigen::scale(                                            \
 	    const Container<Type>& a, Type alpha, Container<Type>& result) const   \
@@ -285,11 +298,14 @@ void LinalgBackendEigen::add_impl(
     const SGVector<T>& a, const SGVector<T>& b, T alpha, T beta,
     SGVector<T>& result) const
 {
-	typename SGVector<T>::EigenVectorXtMap a_eig = a;
-	typename SGVector<T>::EigenVectorXtMap b_eig = b;
-	typename SGVector<T>::EigenVectorXtMap result_eig = result;
+	linalg::parallel_elementwise(a.vlen, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap b_eig(b.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.vector + offset, len);
 
-	result_eig = alpha * a_eig + beta * b_eig;
+		result_eig = alpha * a_eig + beta * b_eig;
+	});
 }
 
 template <typename T>
@@ -297,11 +313,17 @@ void LinalgBackendEigen::add_impl(
     const SGMatrix<T>& a, const SGMatrix<T>& b, T alpha, T beta,
     SGMatrix<T>& result) const
 {
-	typename SGMatrix<T>::EigenMatrixXtMap a_eig = a;
-	typename SGMatrix<T>::EigenMatrixXtMap b_eig = b;
-	typename SGMatrix<T>::EigenMatrixXtMap result_eig = result;
+	// the dense storage is contiguous, so the matrices can be processed as
+	// flat ranges
+	const index_t size = a.num_rows * a.num_cols;
+	linalg::parallel_elementwise(size, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.matrix + offset, len);
+		typename SGVector<T>::EigenVectorXtMap b_eig(b.matrix + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.matrix + offset, len);
 
-	result_eig = alpha * a_eig + beta * b_eig;
+		result_eig = alpha * a_eig + beta * b_eig;
+	});
 }
 
 template <typename T>
@@ -489,11 +511,14 @@ template <typename T>
 void LinalgBackendEigen::element_prod_impl(
     const SGVector<T>& a, const SGVector<T>& b, SGVector<T>& result) const
 {
-	typename SGVector<T>::EigenVectorXtMap a_eig = a;
-	typename SGVector<T>::EigenVectorXtMap b_eig = b;
-	typename SGVector<T>::EigenVectorXtMap result_eig = result;
+	linalg::parallel_elementwise(a.vlen, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap b_eig(b.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.vector + offset, len);
 
-	result_eig = a_eig.array() * b_eig.array();
+		result_eig = a_eig.array() * b_eig.array();
+	});
 }
 
 /* Helper method to compute elementwise division with Eigen */
@@ -520,29 +545,41 @@ template <typename T>
 void LinalgBackendEigen::element_div_impl(
     const SGVector<T>& a, const SGVector<T>& b, SGVector<T>& result) const
 {
-	typename SGVector<T>::EigenVectorXtMap a_eig = a;
-	typename SGVector<T>::EigenVectorXtMap b_eig = b;
-	typename SGVector<T>::EigenVectorXtMap result_eig = result;
+	linalg::parallel_elementwise(a.vlen, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap b_eig(b.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.vector + offset, len);
 
-	result_eig = a_eig.array() / b_eig.array();
+		result_eig = a_eig.array() / b_eig.array();
+	});
 }
 
 template <typename T>
 void LinalgBackendEigen::exponent_impl(
     const SGVector<T>& a, SGVector<T>& result) const
 {
-	typename SGVector<T>::EigenVectorXtMap a_eig = a;
-	typename SGVector<T>::EigenVectorXtMap result_eig = result;
-	result_eig = a_eig.array().exp();
+	linalg::parallel_elementwise(a.vlen, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.vector + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.vector + offset, len);
+
+		result_eig = a_eig.array().exp();
+	});
 }
 
 template <typename T>
 void LinalgBackendEigen::exponent_impl(
     const SGMatrix<T>& a, SGMatrix<T>& result) const
 {
-	typename SGMatrix<T>::EigenMatrixXtMap a_eig = a;
-	typename SGMatrix<T>::EigenMatrixXtMap result_eig = result;
-	result_eig = a_eig.array().exp();
+	const index_t size = a.num_rows * a.num_cols;
+	linalg::parallel_elementwise(size, [&](index_t offset, index_t len) {
+		typename SGVector<T>::EigenVectorXtMap a_eig(a.matrix + offset, len);
+		typename SGVector<T>::EigenVectorXtMap result_eig(
+		    result.matrix + offset, len);
+
+		result_eig = a_eig.array().exp();
+	});
 }
 
 template <typename T>
@@ -636,6 +673,20 @@ void LinalgBackendEigen::matrix_prod_impl(
 		result_eig = a_eig * b_eig;
 }
 
+template <typename T>
+void LinalgBackendEigen::matrix_prod_batched_impl(
+    const std::vector<SGMatrix<T>>& a, const std::vector<SGMatrix<T>>& b,
+    std::vector<SGMatrix<T>>& result, bool transpose_A, bool transpose_B) const
+{
+	const index_t batch_size = static_cast<index_t>(a.size());
+
+	// the products are independent and typically tiny, so the batch is
+	// split across threads instead of threading inside each product
+	#pragma omp parallel for
+	for (index_t i = 0; i < batch_size; i++)
+		matrix_prod_impl(a[i], b[i], result[i], transpose_A, transpose_B);
+}
+
 template <typename T>
 void LinalgBackendEigen::scale_impl(
     const SGVector<T>& a, T alpha, SGVector<T>& result) const
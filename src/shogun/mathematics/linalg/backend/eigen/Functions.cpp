@@ -32,6 +32,7 @@
 
 #include <shogun/mathematics/linalg/LinalgBackendEigen.h>
 #include <shogun/mathematics/linalg/LinalgMacros.h>
+#include <shogun/mathematics/linalg/internal/ParallelDispatch.h>
 
 using namespace shogun;
 
@@ -44,6 +45,14 @@ DEFINE_FOR_NON_COMPLEX_PTYPE(BACKEND_GENERIC_MAX, SGVector)
 DEFINE_FOR_NON_COMPLEX_PTYPE(BACKEND_GENERIC_MAX, SGMatrix)
 #undef BACKEND_GENERIC_MAX
 
+#define BACKEND_GENERIC_ARG_MAX(Type, Container)                               \
+	index_t LinalgBackendEigen::arg_max(const Container<Type>& a) const        \
+	{                                                                          \
+		return arg_max_impl(a);                                                \
+	}
+DEFINE_FOR_NON_COMPLEX_PTYPE(BACKEND_GENERIC_ARG_MAX, SGVector)
+#undef BACKEND_GENERIC_ARG_MAX
+
 #define BACKEND_GENERIC_REAL_MEAN(Type, Container)                             \
 	float64_t LinalgBackendEigen::mean(const Container<Type>& a) const         \
 	{                                                                          \
@@ -170,6 +179,14 @@ T LinalgBackendEigen::max_impl(const SGMatrix<T>& mat) const
 	return (typename SGMatrix<T>::EigenMatrixXtMap(mat)).maxCoeff();
 }
 
+template <typename T>
+index_t LinalgBackendEigen::arg_max_impl(const SGVector<T>& vec) const
+{
+	Eigen::Index idx;
+	(typename SGVector<T>::EigenVectorXtMap(vec)).maxCoeff(&idx);
+	return static_cast<index_t>(idx);
+}
+
 template <typename T, template <typename> class Container>
 typename std::enable_if<!std::is_same<T, complex128_t>::value, float64_t>::type
 LinalgBackendEigen::mean_impl(const Container<T>& a) const
@@ -219,16 +236,31 @@ LinalgBackendEigen::std_deviation_impl(
 template <typename T>
 T LinalgBackendEigen::sum_impl(const SGVector<T>& vec, bool no_diag) const
 {
-	return (typename SGVector<T>::EigenVectorXtMap(vec)).sum();
+	return linalg::parallel_reduce_sum<T>(
+	    vec.vlen, [&](index_t offset, index_t len) {
+		    return (typename SGVector<T>::EigenVectorXtMap(
+		                vec.vector + offset, len))
+		        .sum();
+	    });
 }
 
 template <typename T>
 T LinalgBackendEigen::sum_impl(const SGMatrix<T>& mat, bool no_diag) const
 {
-	typename SGMatrix<T>::EigenMatrixXtMap m = mat;
-	T result = m.sum();
+	// the dense storage is contiguous, so the matrix can be reduced as a
+	// flat range
+	const index_t size = mat.num_rows * mat.num_cols;
+	T result = linalg::parallel_reduce_sum<T>(
+	    size, [&](index_t offset, index_t len) {
+		    return (typename SGVector<T>::EigenVectorXtMap(
+		                mat.matrix + offset, len))
+		        .sum();
+	    });
 	if (no_diag)
+	{
+		typename SGMatrix<T>::EigenMatrixXtMap m = mat;
 		result -= m.diagonal().sum();
+	}
 
 	return result;
 }
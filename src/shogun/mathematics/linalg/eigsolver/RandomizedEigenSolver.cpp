@@ -0,0 +1,144 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/mathematics/NormalDistribution.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
+
+using namespace Eigen;
+
+namespace shogun
+{
+
+RandomizedEigenSolver::RandomizedEigenSolver()
+	: RandomMixin<EigenSolver>()
+{
+	init();
+	SG_TRACE("{} created ({})", this->get_name(), fmt::ptr(this));
+}
+
+RandomizedEigenSolver::RandomizedEigenSolver(
+	const std::shared_ptr<DenseMatrixOperator<float64_t>>& linear_operator,
+	index_t num_components, index_t num_oversampling,
+	index_t num_power_iterations)
+	: RandomMixin<EigenSolver>(linear_operator->as<LinearOperator<float64_t>>())
+{
+	init();
+
+	require(num_components>0, "Number of components ({}) must be positive!",
+		num_components);
+	require(num_oversampling>=0, "Number of oversampling columns ({}) must "
+		"be non-negative!", num_oversampling);
+	require(num_power_iterations>=0, "Number of power iterations ({}) must "
+		"be non-negative!", num_power_iterations);
+
+	m_num_components=num_components;
+	m_num_oversampling=num_oversampling;
+	m_num_power_iterations=num_power_iterations;
+
+	SG_TRACE("{} created ({})", this->get_name(), fmt::ptr(this));
+}
+
+RandomizedEigenSolver::~RandomizedEigenSolver()
+{
+	SG_TRACE("{} destroyed ({})", this->get_name(), fmt::ptr(this));
+}
+
+void RandomizedEigenSolver::init()
+{
+	m_num_components=1;
+	m_num_oversampling=10;
+	m_num_power_iterations=2;
+	m_eigenvalues=SGVector<float64_t>();
+	m_eigenvectors=SGMatrix<float64_t>();
+
+	SG_ADD(&m_num_components, "num_components",
+		"Number of top eigenpairs to compute");
+
+	SG_ADD(&m_num_oversampling, "num_oversampling",
+		"Number of extra sketch columns beyond num_components");
+
+	SG_ADD(&m_num_power_iterations, "num_power_iterations",
+		"Number of power iterations used to sharpen the sketch");
+
+	SG_ADD(&m_eigenvalues, "eigenvalues",
+		"Computed top eigenvalues, in increasing order");
+
+	SG_ADD(&m_eigenvectors, "eigenvectors",
+		"Computed eigenvectors belonging to the top eigenvalues");
+}
+
+void RandomizedEigenSolver::compute()
+{
+	auto op=m_linear_operator->as<DenseMatrixOperator<float64_t>>();
+	require(op, "Linear operator is not of CDenseMatrixOperator type!");
+
+	SGMatrix<float64_t> m=op->get_matrix_operator();
+	Map<MatrixXd> map_m(m.matrix, m.num_rows, m.num_cols);
+
+	const index_t n=op->get_dimension();
+	const index_t k=m_num_components;
+	require(k<=n, "Number of components ({}) must not exceed the operator "
+		"dimension ({})!", k, n);
+
+	const index_t l=std::min(n, k+m_num_oversampling);
+
+	// Gaussian sketch of the range of the operator
+	NormalDistribution<float64_t> normal_dist;
+	MatrixXd sketch(n, l);
+	for (index_t i=0; i<sketch.size(); ++i)
+		sketch.data()[i]=normal_dist(m_prng);
+	sketch=map_m*sketch;
+
+	// power iterations sharpen the spectrum seen by the sketch; the basis
+	// is re-orthonormalized after each application to avoid all columns
+	// collapsing onto the dominant eigenvector
+	for (index_t i=0; i<m_num_power_iterations; ++i)
+	{
+		HouseholderQR<MatrixXd> qr(sketch);
+		sketch=qr.householderQ()*MatrixXd::Identity(n, l);
+		sketch=map_m*sketch;
+	}
+
+	HouseholderQR<MatrixXd> qr(sketch);
+	MatrixXd Q=qr.householderQ()*MatrixXd::Identity(n, l);
+
+	// eigendecomposition of the small projected operator
+	MatrixXd B=Q.transpose()*(map_m*Q);
+	SelfAdjointEigenSolver<MatrixXd> eig_solver((B+B.transpose())/2.0);
+
+	m_eigenvalues=SGVector<float64_t>(k);
+	m_eigenvectors=SGMatrix<float64_t>(n, k);
+	Map<VectorXd> map_eigenvalues(m_eigenvalues.vector, k);
+	Map<MatrixXd> map_eigenvectors(m_eigenvectors.matrix, n, k);
+
+	map_eigenvalues=eig_solver.eigenvalues().tail(k);
+	map_eigenvectors=Q*eig_solver.eigenvectors().rightCols(k);
+
+	m_max_eigenvalue=map_eigenvalues[k-1];
+	m_is_computed_max=true;
+}
+
+SGVector<float64_t> RandomizedEigenSolver::get_eigenvalues() const
+{
+	return m_eigenvalues;
+}
+
+SGMatrix<float64_t> RandomizedEigenSolver::get_eigenvectors() const
+{
+	return m_eigenvectors;
+}
+
+bool RandomizedEigenSolver::is_preferred(index_t size, index_t num_components)
+{
+	// the sketch must be thin relative to the operator for the range finder
+	// to beat a full decomposition; small problems are cheap either way
+	return size>=512 && num_components*10<=size;
+}
+
+}
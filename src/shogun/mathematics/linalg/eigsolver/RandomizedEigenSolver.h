@@ -0,0 +1,113 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef RANDOMIZED_EIGEN_SOLVER_H_
+#define RANDOMIZED_EIGEN_SOLVER_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/RandomMixin.h>
+#include <shogun/mathematics/linalg/eigsolver/EigenSolver.h>
+
+namespace shogun
+{
+template<class T> class DenseMatrixOperator;
+
+/** @brief Class that computes the top-k eigenpairs of a real valued,
+ * self-adjoint dense matrix linear operator using the randomized
+ * range finder of Halko et. al. (see Halko, N., Martinsson, P.G. and
+ * Tropp, J.A., 2011. Finding structure with randomness: Probabilistic
+ * algorithms for constructing approximate matrix decompositions).
+ *
+ * The operator is sketched with a Gaussian test matrix of
+ * k+oversampling columns, the sketch is sharpened with a few power
+ * iterations (re-orthonormalized after each application to keep the
+ * basis well conditioned), and the eigendecomposition is computed on
+ * the small projected matrix. The cost is dominated by a handful of
+ * dense matrix products with k+oversampling columns, which is much
+ * cheaper than a full decomposition when k is small relative to the
+ * operator dimension.
+ */
+class RandomizedEigenSolver : public RandomMixin<EigenSolver>
+{
+public:
+	/** default constructor */
+	RandomizedEigenSolver();
+
+	/**
+	 * constructor
+	 *
+	 * @param linear_operator self-adjoint dense-matrix linear operator whose
+	 * top eigenpairs have to be found
+	 * @param num_components number of top eigenpairs to compute
+	 * @param num_oversampling number of extra sketch columns beyond
+	 * num_components (default 10)
+	 * @param num_power_iterations number of power iterations used to sharpen
+	 * the sketch (default 2)
+	 */
+	RandomizedEigenSolver(
+		const std::shared_ptr<DenseMatrixOperator<float64_t>>& linear_operator,
+		index_t num_components, index_t num_oversampling=10,
+		index_t num_power_iterations=2);
+
+	/** destructor */
+	~RandomizedEigenSolver() override;
+
+	/**
+	 * compute method for computing the top eigenpairs of a real valued
+	 * self-adjoint dense matrix linear operator
+	 */
+	void compute() override;
+
+	/** @return the top num_components eigenvalues, in increasing order to
+	 * match the convention of linalg::eigen_solver_symmetric
+	 */
+	SGVector<float64_t> get_eigenvalues() const;
+
+	/** @return the eigenvectors belonging to the top num_components
+	 * eigenvalues, one per column, ordered as the eigenvalues
+	 */
+	SGMatrix<float64_t> get_eigenvectors() const;
+
+	/** heuristic that tells whether the randomized solver is expected to be
+	 * faster than a full dense decomposition
+	 *
+	 * @param size dimension of the operator
+	 * @param num_components number of requested eigenpairs
+	 * @return true if the sketch is small enough relative to the operator
+	 * for the randomized solver to pay off
+	 */
+	static bool is_preferred(index_t size, index_t num_components);
+
+	/** @return object name */
+	const char* get_name() const override
+	{
+		return "RandomizedEigenSolver";
+	}
+
+private:
+	/** initialize with default values and register params */
+	void init();
+
+	/** number of top eigenpairs to compute */
+	index_t m_num_components;
+
+	/** number of extra sketch columns */
+	index_t m_num_oversampling;
+
+	/** number of power iterations */
+	index_t m_num_power_iterations;
+
+	/** computed eigenvalues, in increasing order */
+	SGVector<float64_t> m_eigenvalues;
+
+	/** computed eigenvectors, one per column */
+	SGMatrix<float64_t> m_eigenvectors;
+};
+
+}
+
+#endif // RANDOMIZED_EIGEN_SOLVER_H_
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2016, Shogun-Toolbox e.V. <shogun-team@shogun-toolbox.org>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  1. Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *
+ *  3. Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef LINALG_PARALLEL_DISPATCH_H__
+#define LINALG_PARALLEL_DISPATCH_H__
+
+#include <shogun/lib/common.h>
+
+#include <algorithm>
+
+namespace shogun
+{
+	namespace linalg
+	{
+		/** minimum number of elements before an elementwise or reduction
+		 * kernel is split across threads; below it the threading overhead
+		 * dominates the work */
+		constexpr index_t PARALLEL_DISPATCH_MIN_SIZE = 1 << 16;
+
+		/** size of the contiguous slice each thread processes at a time;
+		 * large enough for the backend to vectorize within a slice */
+		constexpr index_t PARALLEL_DISPATCH_BLOCK_SIZE = 1 << 14;
+
+		/** Applies an elementwise operation to a flat range, splitting it
+		 * into contiguous blocks processed in parallel once the range is
+		 * large enough to amortize the threading overhead.
+		 *
+		 * @param size number of elements in the range
+		 * @param op callable invoked as op(offset, len) on disjoint slices
+		 */
+		template <typename Operation>
+		void parallel_elementwise(index_t size, const Operation& op)
+		{
+			if (size < PARALLEL_DISPATCH_MIN_SIZE)
+			{
+				op(0, size);
+				return;
+			}
+
+			const index_t num_blocks =
+			    (size + PARALLEL_DISPATCH_BLOCK_SIZE - 1) /
+			    PARALLEL_DISPATCH_BLOCK_SIZE;
+
+			#pragma omp parallel for
+			for (index_t block = 0; block < num_blocks; block++)
+			{
+				const index_t offset = block * PARALLEL_DISPATCH_BLOCK_SIZE;
+				op(offset,
+				   std::min(PARALLEL_DISPATCH_BLOCK_SIZE, size - offset));
+			}
+		}
+
+		/** Reduces a flat range by summing the partial results of disjoint
+		 * slices, which are computed in parallel once the range is large
+		 * enough to amortize the threading overhead.
+		 *
+		 * @param size number of elements in the range
+		 * @param op callable invoked as op(offset, len), returning the
+		 * partial sum of the slice
+		 * @return sum of the partial results
+		 */
+		template <typename T, typename Operation>
+		T parallel_reduce_sum(index_t size, const Operation& op)
+		{
+			if (size < PARALLEL_DISPATCH_MIN_SIZE)
+				return op(0, size);
+
+			const index_t num_blocks =
+			    (size + PARALLEL_DISPATCH_BLOCK_SIZE - 1) /
+			    PARALLEL_DISPATCH_BLOCK_SIZE;
+
+			T result = 0;
+			#pragma omp parallel
+			{
+				T partial = 0;
+				#pragma omp for nowait
+				for (index_t block = 0; block < num_blocks; block++)
+				{
+					const index_t offset =
+					    block * PARALLEL_DISPATCH_BLOCK_SIZE;
+					partial += op(offset,
+					    std::min(
+					        PARALLEL_DISPATCH_BLOCK_SIZE, size - offset));
+				}
+				#pragma omp critical
+				result += partial;
+			}
+			return result;
+		}
+	}
+}
+#endif // LINALG_PARALLEL_DISPATCH_H__
@@ -0,0 +1,86 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
+#include <shogun/mathematics/linalg/linsolver/MixedPrecisionDirectLinearSolver.h>
+
+using namespace Eigen;
+
+namespace shogun
+{
+
+MixedPrecisionDirectLinearSolver::MixedPrecisionDirectLinearSolver()
+	: LinearSolver<float64_t, float64_t>()
+{
+	init();
+}
+
+MixedPrecisionDirectLinearSolver::~MixedPrecisionDirectLinearSolver()
+{
+}
+
+void MixedPrecisionDirectLinearSolver::init()
+{
+	m_refine_tolerance=1E-12;
+	m_max_refine_iter=10;
+
+	SG_ADD(&m_refine_tolerance, "refine_tolerance",
+		"Relative residual tolerance of the iterative refinement");
+
+	SG_ADD(&m_max_refine_iter, "max_refine_iter",
+		"Maximum number of refinement iterations");
+}
+
+SGVector<float64_t> MixedPrecisionDirectLinearSolver::solve(
+		std::shared_ptr<LinearOperator<float64_t>> A, SGVector<float64_t> b)
+{
+	require(A, "Operator is NULL!");
+	require(A->get_dimension()==b.vlen, "Dimension mismatch!");
+	auto op=A->as<DenseMatrixOperator<float64_t>>();
+	require(op, "Operator is not DenseMatrixOperator type!");
+
+	SGMatrix<float64_t> m=op->get_matrix_operator();
+	Map<MatrixXd> map_m(m.matrix, m.num_rows, m.num_cols);
+	Map<VectorXd> map_b(b.vector, b.vlen);
+
+	SGVector<float64_t> x(b.vlen);
+	Map<VectorXd> map_x(x.vector, x.vlen);
+
+	// factorize in float32; the factorization dominates the cost of a
+	// direct solve and the narrow type halves its memory traffic
+	MatrixXf m_single=map_m.cast<float32_t>();
+	LLT<MatrixXf> llt(m_single);
+
+	if (llt.info()==NumericalIssue)
+	{
+		// strongly ill-conditioned systems can lose positive definiteness
+		// in the narrow type; solve in the operand precision instead
+		io::warn("Single precision Cholesky factorization failed, "
+			"falling back to float64!");
+		map_x=map_m.llt().solve(map_b);
+		return x;
+	}
+
+	map_x=llt.solve(map_b.cast<float32_t>().eval()).cast<float64_t>();
+
+	// iterative refinement against the float64 operand recovers float64
+	// accuracy from the float32 factor
+	const float64_t b_norm=map_b.norm();
+	for (index_t i=0; i<m_max_refine_iter; ++i)
+	{
+		VectorXd r=map_b-map_m*map_x;
+		if (r.norm()<=m_refine_tolerance*b_norm)
+			break;
+		map_x+=llt.solve(r.cast<float32_t>().eval()).cast<float64_t>();
+	}
+
+	return x;
+}
+
+}
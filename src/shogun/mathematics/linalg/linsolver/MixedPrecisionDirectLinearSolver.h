@@ -0,0 +1,65 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#ifndef MIXED_PRECISION_DIRECT_LINEAR_SOLVER_H_
+#define MIXED_PRECISION_DIRECT_LINEAR_SOLVER_H_
+
+#include <shogun/lib/config.h>
+
+#include <shogun/mathematics/linalg/linsolver/LinearSolver.h>
+
+namespace shogun
+{
+
+/** @brief Class that provides a solve method for real symmetric positive
+ * definite dense-matrix linear systems, factorizing in float32 and refining
+ * the solution to float64 accuracy with iterative refinement.
+ *
+ * The Cholesky factorization dominates the cost of a direct solve and is
+ * bandwidth-bound, so performing it in the narrow type roughly halves the
+ * memory traffic. Residuals are computed against the float64 operand and a
+ * few correction solves with the float32 factor recover float64 accuracy.
+ * If the float32 factorization fails (strongly ill-conditioned systems),
+ * the solver falls back to a float64 factorization.
+ */
+class MixedPrecisionDirectLinearSolver : public LinearSolver<float64_t, float64_t>
+{
+public:
+	/** default constructor */
+	MixedPrecisionDirectLinearSolver();
+
+	/** destructor */
+	~MixedPrecisionDirectLinearSolver() override;
+
+	/**
+	 * solve method for solving real-valued symmetric positive definite
+	 * dense linear systems
+	 *
+	 * @param A the dense linear operator of the system
+	 * @param b the vector of the system
+	 * @return the solution vector
+	 */
+	SGVector<float64_t> solve(std::shared_ptr<LinearOperator<float64_t>> A,
+		SGVector<float64_t> b) override;
+
+	/** @return object name */
+	const char* get_name() const override
+	{
+		return "MixedPrecisionDirectLinearSolver";
+	}
+
+private:
+	/** initialize with default values and register params */
+	void init();
+
+	/** relative residual tolerance of the iterative refinement */
+	float64_t m_refine_tolerance;
+
+	/** maximum number of refinement iterations */
+	index_t m_max_refine_iter;
+};
+
+}
+
+#endif // MIXED_PRECISION_DIRECT_LINEAR_SOLVER_H_
@@ -127,23 +127,26 @@ SGVector<float64_t> LogDetEstimator::sample(index_t num_estimates)
 	index_t num_trace_samples=m_trace_sampler->get_num_samples();
 	SGVector<float64_t> samples(num_estimates);
 	samples.zero();
-	float64_t result = 0.0;
 
-#pragma omp parallel for reduction(+ : result)
-	for (index_t i = 0; i < num_estimates; ++i)
+	// every estimate/probe-vector pair is an independent job with its own
+	// workspace; flattening the two loops keeps all threads busy even when
+	// a single estimate is requested
+	const index_t num_jobs = num_estimates * num_trace_samples;
+
+#pragma omp parallel for
+	for (index_t job = 0; job < num_jobs; ++job)
 	{
-		result = 0.0;
-		for (index_t j = 0; j < num_trace_samples; ++j)
-		{
-			io::info(
-				"Computing log-determinant trace sample {}/{}", j,
-				num_trace_samples);
-			// get the trace sampler vector
-			SGVector<float64_t> s = m_trace_sampler->sample(j);
-			// calculate the result for sample s and add it to previous
-			result += m_operator_log->compute(s);
-		}
-		samples[i] = result;
+		const index_t i = job / num_trace_samples;
+		const index_t j = job % num_trace_samples;
+		io::info(
+			"Computing log-determinant trace sample {}/{}", j,
+			num_trace_samples);
+		// get the trace sampler vector
+		SGVector<float64_t> s = m_trace_sampler->sample(j);
+		// calculate the result for sample s and add it to the estimate
+		float64_t result = m_operator_log->compute(s);
+#pragma omp atomic
+		samples.vector[i] += result;
 	}
 
 	io::info("Finished computing {} log-det estimates", num_estimates);
@@ -168,22 +171,22 @@ SGMatrix<float64_t> LogDetEstimator::sample_without_averaging(
 	index_t num_trace_samples = m_trace_sampler->get_num_samples();
 	SGMatrix<float64_t> samples(num_trace_samples, num_estimates);
 
+	// independent jobs, flattened as in sample() so that the probe vectors
+	// of a single estimate are also computed concurrently
+	const index_t num_jobs = num_estimates * num_trace_samples;
+
 #pragma omp parallel for
-	for (index_t i = 0; i < num_estimates; ++i)
+	for (index_t job = 0; job < num_jobs; ++job)
 	{
-		for (index_t j = 0; j < num_trace_samples; ++j)
-		{
-			io::info(
-				"Computing log-determinant trace sample {}/{}", j,
-				num_trace_samples);
-			// get the trace sampler vector
-			SGVector<float64_t> s = m_trace_sampler->sample(j);
-			// solve the result for s
-			float64_t result = m_operator_log->compute(s);
-			{
-				samples(i, j) = result;
-			}
-		}
+		const index_t i = job / num_trace_samples;
+		const index_t j = job % num_trace_samples;
+		io::info(
+			"Computing log-determinant trace sample {}/{}", j,
+			num_trace_samples);
+		// get the trace sampler vector
+		SGVector<float64_t> s = m_trace_sampler->sample(j);
+		// solve the result for s
+		samples(i, j) = m_operator_log->compute(s);
 	}
 
 	SG_TRACE("Leaving");
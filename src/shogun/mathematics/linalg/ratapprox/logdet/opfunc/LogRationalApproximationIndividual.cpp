@@ -95,39 +95,52 @@ LogRationalApproximationIndividual::compute(SGVector<float64_t> sample) const
 	}
 
 	SGVector<complex128_t> agg(sample.vlen);
-	// create num_shifts number of jobs for current sample vector
-	for (index_t i=0; i<m_num_shifts; ++i)
+	agg.zero();
+	// the shifted systems are independent jobs; each one works on its own
+	// deep copy of the operator, so the shifts are solved concurrently with
+	// a per-thread aggregate combined at the end
+	#pragma omp parallel
 	{
-		// create a deep copy of the operator
-		std::shared_ptr<MatrixOperator<complex128_t>> shifted_op=NULL;
+		SGVector<complex128_t> agg_thread(sample.vlen);
+		agg_thread.zero();
 
-		switch(operator_type)
+		#pragma omp for nowait
+		for (index_t i=0; i<m_num_shifts; ++i)
 		{
-		case DENSE:
-			shifted_op=std::make_shared<DenseMatrixOperator<complex128_t>>
-				(*(complex_op->as<DenseMatrixOperator<complex128_t>>()));
-			break;
-		case SPARSE:
-			shifted_op=std::make_shared<SparseMatrixOperator<complex128_t>>
-				(*(complex_op->as<SparseMatrixOperator<complex128_t>>()));
-			break;
-		default:
-			break;
+			// create a deep copy of the operator
+			std::shared_ptr<MatrixOperator<complex128_t>> shifted_op=NULL;
+
+			switch(operator_type)
+			{
+			case DENSE:
+				shifted_op=std::make_shared<DenseMatrixOperator<complex128_t>>
+					(*(complex_op->as<DenseMatrixOperator<complex128_t>>()));
+				break;
+			case SPARSE:
+				shifted_op=std::make_shared<SparseMatrixOperator<complex128_t>>
+					(*(complex_op->as<SparseMatrixOperator<complex128_t>>()));
+				break;
+			default:
+				break;
+			}
+
+			SGVector<complex128_t> diag=shifted_op->get_diagonal();
+			for (index_t j=0; j<diag.vlen; ++j)
+				diag[j]-=m_shifts[i];
+			shifted_op->set_diagonal(diag);
+
+			SGVector<complex128_t> vec = m_linear_solver->solve(shifted_op, sample);
+			// multiply with the weight using Eigen3 and take negative
+			// (see RationalApproximation for the formula)
+			Map<VectorXcd> v(vec.vector, vec.vlen);
+			v *= m_weights[i];
+			v = -v;
+			// aggregate the result
+			linalg::add(agg_thread, vec, agg_thread);
 		}
 
-		SGVector<complex128_t> diag=shifted_op->get_diagonal();
-		for (index_t j=0; j<diag.vlen; ++j)
-			diag[j]-=m_shifts[i];
-		shifted_op->set_diagonal(diag);
-
-		SGVector<complex128_t> vec = m_linear_solver->solve(shifted_op, sample);
-		// multiply with the weight using Eigen3 and take negative
-		// (see RationalApproximation for the formula)
-		Map<VectorXcd> v(vec.vector, vec.vlen);
-		v *= m_weights[i];
-		v = -v;
-		// aggregate the result
-		linalg::add(agg, vec, agg);
+		#pragma omp critical
+		linalg::add(agg, agg_thread, agg);
 	}
 	float64_t result =
 		linalg::dot(sample, m_linear_operator->apply(agg.get_imag()));
@@ -7,6 +7,7 @@
 
 #include <shogun/base/progress.h>
 #include <shogun/features/Features.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/labels/Labels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/labels/RegressionLabels.h>
@@ -16,6 +17,9 @@
 
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
+#include <map>
+#include <vector>
+
 using namespace shogun;
 
 GaussianNaiveBayes::GaussianNaiveBayes() : NativeMulticlassMachine(), m_features(NULL),
@@ -102,56 +106,157 @@ bool GaussianNaiveBayes::train_machine(std::shared_ptr<Features> data)
 	m_label_prob.zero();
 	m_rates.zero();
 
-	// number of iterations in all cycles
-	int32_t max_progress = 2 * train_labels.vlen + 2 * m_num_classes;
-
 	// Progress bar
-	auto pb = SG_PROGRESS(range(max_progress));
-
-	// get sum of features among labels
-	for (i=0; i<train_labels.vlen; i++)
+	auto pb = SG_PROGRESS(range(train_labels.vlen));
+
+	// single pass over the data: per-thread Welford accumulators
+	// (count, mean and sum of squared deviations per class), merged
+	// pairwise at the end. m_label_prob holds the raw class counts and
+	// m_variances the merged squared deviations until the finalization
+	// below.
+#pragma omp parallel
 	{
-		SGVector<float64_t> fea = m_features->get_computed_dot_feature_vector(i);
-		for (j=0; j<m_dim; j++)
-			m_means(j, train_labels.vector[i]) += fea.vector[j];
-
-		m_label_prob.vector[train_labels.vector[i]]+=1.0;
+		SGMatrix<float64_t> local_mean(m_dim, m_num_classes);
+		SGMatrix<float64_t> local_m2(m_dim, m_num_classes);
+		SGVector<float64_t> local_count(m_num_classes);
+		local_mean.zero();
+		local_m2.zero();
+		local_count.zero();
+
+#pragma omp for schedule(dynamic, 256) nowait
+		for (int32_t v=0; v<train_labels.vlen; v++)
+		{
+			SGVector<float64_t> fea =
+			    m_features->get_computed_dot_feature_vector(v);
+			int32_t c = train_labels.vector[v];
+
+			local_count[c] += 1.0;
+			float64_t inv_count = 1.0/local_count[c];
+			for (int32_t k=0; k<m_dim; k++)
+			{
+				float64_t delta = fea.vector[k]-local_mean(k, c);
+				local_mean(k, c) += delta*inv_count;
+				local_m2(k, c) += delta*(fea.vector[k]-local_mean(k, c));
+			}
+
+			pb.print_progress();
+		}
 
-		pb.print_progress();
+#pragma omp critical(shogun_gnb_merge)
+		for (int32_t c=0; c<m_num_classes; c++)
+		{
+			if (local_count[c] == 0.0)
+				continue;
+
+			float64_t n_a = m_label_prob.vector[c];
+			float64_t n_b = local_count[c];
+			float64_t n_ab = n_a+n_b;
+			for (int32_t k=0; k<m_dim; k++)
+			{
+				float64_t delta = local_mean(k, c)-m_means(k, c);
+				m_means(k, c) += delta*n_b/n_ab;
+				m_variances(k, c) +=
+					local_m2(k, c) + delta*delta*n_a*n_b/n_ab;
+			}
+			m_label_prob.vector[c] = n_ab;
+		}
 	}
+	pb.complete();
 
-	// get means of features of labels
+	// get variance of features of labels
 	for (i=0; i<m_num_classes; i++)
 	{
 		for (j=0; j<m_dim; j++)
-			m_means(j, i) /= m_label_prob.vector[i];
-		pb.print_progress();
+			m_variances(j, i) /= m_label_prob.vector[i] > 1 ? m_label_prob.vector[i]-1 : 1;
+
+		// get a priori probabilities of labels
+		m_label_prob.vector[i]/= m_num_classes;
 	}
 
-	// compute squared residuals with means available
-	for (i=0; i<train_labels.vlen; i++)
+	return true;
+}
+
+bool GaussianNaiveBayes::train_streamed(const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream)
+{
+	require(stream, "No streaming features given");
+	require(
+	    stream->get_has_labels(),
+	    "Streamed examples must carry labels to fit naive Bayes");
+
+	// label value -> position in the accumulators below; the class range
+	// is only known once the stream is exhausted
+	std::map<int32_t, int32_t> slot;
+	std::vector<SGVector<float64_t>> mean;
+	std::vector<SGVector<float64_t>> m2;
+	std::vector<float64_t> count;
+	int32_t dim = -1;
+
+	stream->start_parser();
+	while (stream->get_next_example())
 	{
-		SGVector<float64_t> fea = m_features->get_computed_dot_feature_vector(i);
-		for (j=0; j<m_dim; j++)
+		SGVector<float64_t> vec = stream->get_vector();
+		int32_t label = (int32_t)stream->get_label();
+
+		if (dim < 0)
+			dim = vec.vlen;
+		require(
+		    vec.vlen == dim, "Dimension mismatch in stream ({} vs. {})",
+		    vec.vlen, dim);
+
+		auto it = slot.find(label);
+		if (it == slot.end())
 		{
-			m_variances(j, train_labels.vector[i]) +=
-				Math::sq(fea[j]-m_means(j, train_labels.vector[i]));
+			it = slot.emplace(label, (int32_t)count.size()).first;
+			mean.emplace_back(dim);
+			mean.back().zero();
+			m2.emplace_back(dim);
+			m2.back().zero();
+			count.push_back(0.0);
 		}
-		pb.print_progress();
+
+		int32_t c = it->second;
+		count[c] += 1.0;
+		float64_t inv_count = 1.0/count[c];
+		for (int32_t j=0; j<dim; j++)
+		{
+			float64_t delta = vec.vector[j]-mean[c][j];
+			mean[c][j] += delta*inv_count;
+			m2[c][j] += delta*(vec.vector[j]-mean[c][j]);
+		}
+
+		stream->release_example();
 	}
+	stream->end_parser();
 
-	// get variance of features of labels
-	for (i=0; i<m_num_classes; i++)
-	{
-		for (j=0; j<m_dim; j++)
-			m_variances(j, i) /= m_label_prob.vector[i] > 1 ? m_label_prob.vector[i]-1 : 1;
+	require(!slot.empty(), "Stream did not provide any examples");
 
-		// get a priori probabilities of labels
-		m_label_prob.vector[i]/= m_num_classes;
+	// lay classes out as the contiguous [min_label, max_label] range,
+	// exactly like the in-memory path; unseen labels in between keep a
+	// zero prior and are never predicted
+	m_min_label = slot.begin()->first;
+	m_num_classes = slot.rbegin()->first-m_min_label+1;
+	m_dim = dim;
+
+	m_means = SGMatrix<float64_t>(m_dim, m_num_classes);
+	m_variances = SGMatrix<float64_t>(m_dim, m_num_classes);
+	m_label_prob = SGVector<float64_t>(m_num_classes);
+	m_rates = SGVector<float64_t>(m_num_classes);
+	m_means.zero();
+	m_variances.zero();
+	m_label_prob.zero();
+	m_rates.zero();
 
-		pb.print_progress();
+	for (const auto& [label, c] : slot)
+	{
+		int32_t k = label-m_min_label;
+		for (int32_t j=0; j<m_dim; j++)
+		{
+			m_means(j, k) = mean[c][j];
+			m_variances(j, k) =
+				m2[c][j]/(count[c] > 1 ? count[c]-1 : 1);
+		}
+		m_label_prob[k] = count[c]/m_num_classes;
 	}
-	pb.complete();
 
 	return true;
 }
@@ -170,10 +275,9 @@ std::shared_ptr<MulticlassLabels> GaussianNaiveBayes::apply_multiclass(std::shar
 	auto result = std::make_shared<MulticlassLabels>(num_vectors);
 
 	// classify each example of data
-	for (auto i : SG_PROGRESS(range(num_vectors)))
-	{
-		result->set_label(i,apply_one(i));
-	}
+	SGVector<float64_t> outputs=apply_get_outputs_chunked(num_vectors);
+	for (int32_t i=0; i<num_vectors; i++)
+		result->set_label(i,outputs[i]);
 
 	return result;
 };
@@ -186,22 +290,26 @@ float64_t GaussianNaiveBayes::apply_one(int32_t idx)
 	// init loop variables
 	int i,k;
 
+	// rates are computed into a local buffer so that examples can be
+	// classified concurrently
+	SGVector<float64_t> rates(m_num_classes);
+
 	// rate all labels
 	for (i=0; i<m_num_classes; i++)
 	{
 		// set rate to 0.0 if a priori probability is 0.0 and continue
 		if (m_label_prob.vector[i]==0.0)
 		{
-			m_rates.vector[i] = 0.0;
+			rates.vector[i] = 0.0;
 			continue;
 		}
 		else
-			m_rates.vector[i] = std::log(m_label_prob.vector[i]);
+			rates.vector[i] = std::log(m_label_prob.vector[i]);
 
 		// product all conditional gaussian probabilities
 		for (k=0; k<m_dim; k++)
 			if (m_variances(k,i)!=0.0)
-				m_rates.vector[i] +=
+				rates.vector[i] +=
 				    std::log(0.39894228 / std::sqrt(m_variances(k, i))) -
 				    0.5 * Math::sq(feature_vector.vector[k] - m_means(k, i)) /
 				        (m_variances(k, i));
@@ -212,7 +320,7 @@ float64_t GaussianNaiveBayes::apply_one(int32_t idx)
 
 	for (i=0; i<m_num_classes; i++)
 	{
-		if (m_rates.vector[i]>m_rates.vector[max_label_idx])
+		if (rates.vector[i]>rates.vector[max_label_idx])
 			max_label_idx = i;
 	}
 
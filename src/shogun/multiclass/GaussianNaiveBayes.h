@@ -19,6 +19,7 @@ namespace shogun {
 class Labels;
 class DotFeatures;
 class Features;
+template <class T> class StreamingDenseFeatures;
 
 /** @brief Class GaussianNaiveBayes, a Gaussian Naive Bayes classifier
  *
@@ -63,6 +64,17 @@ public:
 	 */
 	virtual std::shared_ptr<Features> get_features();
 
+	/** fit the model from a labelled example stream in a single pass,
+	 * so datasets never have to reside in memory. Per-class means and
+	 * variances are accumulated with Welford updates while the parser
+	 * thread keeps reading; the trained model is identical in layout to
+	 * one fitted with train() on in-memory features.
+	 *
+	 * @param stream labelled streaming examples
+	 * @return whether fitting was successful
+	 */
+	bool train_streamed(const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream);
+
 	/** classify specified examples
 	 * @param data examples to be classified
 	 * @return labels corresponding to data
@@ -75,6 +87,12 @@ public:
 	 */
 	float64_t apply_one(int32_t idx) override;
 
+	/** apply_one() only reads the model, so examples can be classified
+	 * concurrently
+	 * @return true
+	 */
+	bool supports_parallel_apply() const override { return true; }
+
 	/** get name
 	 * @return classifier name
 	 */
@@ -12,12 +12,12 @@
 #include <shogun/lib/Time.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/multiclass/KNN.h>
+#include <shogun/multiclass/tree/KNNHeap.h>
 
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 #include <utility>
-
-//#define DEBUG_KNN
+#include <vector>
 
 using namespace shogun;
 
@@ -53,6 +53,8 @@ void KNN::init()
 	solver=NULL;
 	m_lsh_l = 0;
 	m_lsh_t = 0;
+	m_nsw_degree = 0;
+	m_nsw_ef = 0;
 
 	/* use the method classify_multiply_k to experiment with different values
 	 * of k */
@@ -63,7 +65,8 @@ void KNN::init()
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_knn_solver, "knn_solver", "Algorithm to solve knn",
 	    ParameterProperties::NONE,
-	    SG_OPTIONS(KNN_BRUTE, KNN_KDTREE, KNN_COVER_TREE, KNN_LSH));
+	    SG_OPTIONS(KNN_BRUTE, KNN_KDTREE, KNN_COVER_TREE, KNN_LSH,
+	    KNN_NSW_GRAPH));
 	watch_method("nearest_neighbors", &KNN::nearest_neighbors);
 	watch_method("classify_for_multiple_k", &KNN::classify_for_multiple_k);
 }
@@ -115,40 +118,58 @@ SGMatrix<index_t> KNN::nearest_neighbors()
 	    n >= m_k,
 	    "K ({}) must not be larger than the number of examples ({}).", m_k, n);
 
-	//distances to train data
-	SGVector<float64_t> dists(m_train_labels.vlen);
-	//indices to train data
-	SGVector<index_t> train_idxs(m_train_labels.vlen);
+	int32_t num_train=m_train_labels.vlen;
+
 	//pre-allocation of the nearest neighbors
 	SGMatrix<index_t> NN(m_k, n);
 
 	distance->precompute_lhs();
 	distance->precompute_rhs();
 
-	//for each test example
-	for (auto i : SG_PROGRESS(range(n)))
+	//queries are processed in blocks so that one pass over the training data
+	//serves a whole tile of queries, and the k nearest neighbors of each
+	//query are selected with a bounded max-heap instead of a full sort
+	const int32_t query_block=256;
+	const int32_t train_block=256;
+	int32_t num_query_blocks=(n+query_block-1)/query_block;
+
+	SGVector<float64_t> buffer(int64_t(train_block)*query_block);
+
+	for (auto b : SG_PROGRESS(range(num_query_blocks)))
 	{
 		COMPUTATION_CONTROLLERS
-		//lhs idx 0..num train examples-1 (i.e., all train examples) and rhs idx i
-		distances_lhs(dists,0,m_train_labels.vlen-1,i);
+		int32_t query_start=b*query_block;
+		int32_t num_queries=Math::min(query_block, n-query_start);
 
-		//fill in an array with 0..num train examples-1
-		for (int32_t j=0; j<m_train_labels.vlen; j++)
-			train_idxs[j]=j;
+		std::vector<KNNHeap> heaps;
+		heaps.reserve(num_queries);
+		for (int32_t q=0; q<num_queries; q++)
+			heaps.emplace_back(m_k);
 
-		//sort the distance vector between test example i and all train examples
-		Math::qsort_index(dists.vector, train_idxs.vector, m_train_labels.vlen);
+		for (int32_t train_start=0; train_start<num_train;
+				train_start+=train_block)
+		{
+			int32_t num_rows=Math::min(train_block, num_train-train_start);
 
-#ifdef DEBUG_KNN
-		io::print("\nQuick sort query {}\n", i);
-		for (int32_t j=0; j<m_k; j++)
-			io::print("{} ", train_idxs[j]);
-		io::print("\n");
-#endif
+			//lhs are the train examples, rhs the queries
+			distance->compute_block(train_start, num_rows, query_start,
+				num_queries, buffer.vector, num_rows);
+
+			for (int32_t q=0; q<num_queries; q++)
+			{
+				for (int32_t j=0; j<num_rows; j++)
+					heaps[q].push(
+						train_start+j, buffer[j+int64_t(q)*num_rows]);
+			}
+		}
 
 		//fill in the output the indices of the nearest neighbors
-		for (int32_t j=0; j<m_k; j++)
-			NN(j,i) = train_idxs[j];
+		for (int32_t q=0; q<num_queries; q++)
+		{
+			SGVector<index_t> train_idxs=heaps[q].get_indices();
+			for (int32_t j=0; j<m_k; j++)
+				NN(j, query_start+q)=train_idxs[j];
+		}
 	}
 
 	distance->reset_precompute();
@@ -316,5 +337,11 @@ void KNN::init_solver(KNN_SOLVER knn_solver)
 
 		break;
 	}
+	case KNN_NSW_GRAPH:
+	{
+		solver = std::make_shared<NSWKNNSolver>(m_k, m_q, m_num_classes, m_min_label, m_train_labels, m_nsw_degree, m_nsw_ef);
+
+		break;
+	}
 	}
 }
@@ -24,6 +24,7 @@
 #include <shogun/multiclass/CoverTreeKNNSolver.h>
 #endif
 #include <shogun/multiclass/LSHKNNSolver.h>
+#include <shogun/multiclass/NSWKNNSolver.h>
 
 namespace shogun
 {
@@ -32,7 +33,8 @@ namespace shogun
 		KNN_BRUTE,
 		KNN_KDTREE,
 		KNN_COVER_TREE,
-		KNN_LSH
+		KNN_LSH,
+		KNN_NSW_GRAPH
 	};
 
 class DistanceMachine;
@@ -210,6 +212,16 @@ class KNN : public DistanceMachine
 			m_lsh_t = t;
 		}
 
+		/** set parameters for the small world graph solver
+		  * @param degree number of outgoing edges added per vertex
+		  * @param ef beam width of the graph search
+		  */
+		inline void set_nsw_parameters(int32_t degree, int32_t ef)
+		{
+			m_nsw_degree = degree;
+			m_nsw_ef = ef;
+		}
+
 	protected:
 		/** classify all examples with nearest neighbor (k=1)
 		 * @return classified labels
@@ -295,6 +307,12 @@ class KNN : public DistanceMachine
 
 		/* Number of probes per query for LSH */
 		int32_t m_lsh_t;
+
+		/* Number of outgoing edges per vertex for the small world graph */
+		int32_t m_nsw_degree;
+
+		/* Beam width of the small world graph search */
+		int32_t m_nsw_ef;
 };
 
 }
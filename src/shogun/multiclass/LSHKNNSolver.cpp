@@ -9,6 +9,9 @@
 #include <shogun/lib/Signal.h>
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/multiclass/LSHKNNSolver.h>
+#include <shogun/multiclass/tree/KNNHeap.h>
+
+#include <vector>
 
 using namespace shogun;
 using namespace Eigen;
@@ -47,6 +50,49 @@ falconn::SparseVector<double> get_falconn_point(SparseFeatures<float64_t>* f, in
 	return mapped;
 }
 
+template<typename PointType>
+float64_t get_falconn_sqdist(const PointType& a, const PointType& b);
+
+template<>
+float64_t get_falconn_sqdist(const falconn::DenseVector<double>& a, const falconn::DenseVector<double>& b)
+{
+	return (a-b).squaredNorm();
+}
+
+template<>
+float64_t get_falconn_sqdist(const falconn::SparseVector<double>& a, const falconn::SparseVector<double>& b)
+{
+	float64_t dist = 0;
+	size_t i = 0;
+	size_t j = 0;
+	while (i < a.size() && j < b.size())
+	{
+		if (a[i].first == b[j].first)
+		{
+			float64_t d = a[i].second - b[j].second;
+			dist += d*d;
+			++i;
+			++j;
+		}
+		else if (a[i].first < b[j].first)
+		{
+			dist += a[i].second*a[i].second;
+			++i;
+		}
+		else
+		{
+			dist += b[j].second*b[j].second;
+			++j;
+		}
+	}
+	for (; i < a.size(); ++i)
+		dist += a[i].second*a[i].second;
+	for (; j < b.size(); ++j)
+		dist += b[j].second*b[j].second;
+
+	return dist;
+}
+
 template<typename PointType, typename FeatureType>
 std::shared_ptr<MulticlassLabels> LSHKNNSolver::classify_objects(FeatureType* lhs, FeatureType* query_features, const int32_t num_lab, SGVector<int32_t>& train_lab, SGVector<float64_t>& classes) const
 {
@@ -61,20 +107,39 @@ std::shared_ptr<MulticlassLabels> LSHKNNSolver::classify_objects(FeatureType* lh
                            falconn::DistanceFunction::EuclideanSquared,
                            true);
 
-	if (m_lsh_l && m_lsh_t)
+	// fewer tables combined with more probes than tables enables FALCONN's
+	// multi-probe perturbation sequences, trading table memory for probes
+	if (m_lsh_l)
 		params.l = m_lsh_l;
 
 	auto lsh_table = falconn::construct_table<PointType>(feats, params);
 	if (m_lsh_t)
 		lsh_table->set_num_probes(m_lsh_t);
 
-	SGMatrix<index_t> NN (m_k, query_features->get_num_vectors());
-	for(index_t i = 0; i < query_features->get_num_vectors(); ++i)
+	const index_t num_queries = query_features->get_num_vectors();
+	std::vector<PointType> queries(num_queries);
+	for (index_t i = 0; i < num_queries; ++i)
+		queries[i] = get_falconn_point<PointType>(query_features, i);
+
+	// the vendored table keeps per-query probing state, so the cheap hash
+	// probing stays serial; get_unique_candidates also deduplicates keys
+	// found in several tables
+	std::vector<std::vector<index_t>> candidates(num_queries);
+	for (index_t i = 0; i < num_queries; ++i)
+		lsh_table->get_unique_candidates(queries[i], &candidates[i]);
+
+	// exact re-ranking of the candidates dominates and is embarrassingly
+	// parallel across queries
+	SGMatrix<index_t> NN (m_k, num_queries);
+	#pragma omp parallel for schedule(dynamic, 16)
+	for (index_t i = 0; i < num_queries; ++i)
 	{
-		auto indices = new std::vector<index_t> ();
-		lsh_table->find_k_nearest_neighbors(get_falconn_point<PointType>(query_features, i), (int_fast64_t)m_k, indices);
-		sg_memcpy(NN.get_column_vector(i), indices->data(), sizeof(index_t)*m_k);
-		delete indices;
+		KNNHeap heap(m_k);
+		for (index_t candidate : candidates[i])
+			heap.push(candidate, get_falconn_sqdist(feats[candidate], queries[i]));
+
+		SGVector<index_t> indices = heap.get_indices();
+		sg_memcpy(NN.get_column_vector(i), indices.vector, sizeof(index_t)*m_k);
 	}
 	for (auto i : SG_PROGRESS(range(num_lab)))
 	{
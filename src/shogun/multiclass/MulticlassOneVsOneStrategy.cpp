@@ -9,6 +9,7 @@
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 using namespace shogun;
 
@@ -88,7 +89,7 @@ int32_t MulticlassOneVsOneStrategy::decide_label(SGVector<float64_t> outputs)
 {
 	// if OVO with prob outputs, find max posterior
 	if (outputs.vlen==m_num_classes)
-		return Math::arg_max(outputs.vector, 1, outputs.vlen);
+		return linalg::arg_max(outputs);
 
 	int32_t s=0;
 	SGVector<int32_t> votes(m_num_classes);
@@ -9,6 +9,7 @@
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
 
 using namespace shogun;
 
@@ -45,7 +46,7 @@ int32_t MulticlassOneVsRestStrategy::decide_label(SGVector<float64_t> outputs)
 	if (m_rejection_strategy && m_rejection_strategy->reject(outputs))
 		return DenseLabels::REJECTION_LABEL;
 
-	return Math::arg_max(outputs.vector, 1, outputs.vlen);
+	return linalg::arg_max(outputs);
 }
 
 SGVector<index_t> MulticlassOneVsRestStrategy::decide_label_multiple_output(SGVector<float64_t> outputs, int32_t n_outputs)
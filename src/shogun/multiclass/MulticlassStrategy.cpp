@@ -70,3 +70,14 @@ void MulticlassStrategy::train_stop()
     m_train_labels = NULL;
     m_orig_labels = NULL;
 }
+
+SGVector<int32_t> MulticlassStrategy::decide_labels(SGMatrix<float64_t> outputs)
+{
+	SGVector<int32_t> labels(outputs.num_cols);
+	for (int32_t i=0; i < outputs.num_cols; ++i)
+	{
+		SGVector<float64_t> output(outputs.get_column_vector(i), outputs.num_rows, false);
+		labels[i]=decide_label(output);
+	}
+	return labels;
+}
@@ -108,6 +108,15 @@ public:
 	 */
 	virtual int32_t decide_label(SGVector<float64_t> outputs)=0;
 
+	/** decide the final labels of a batch of samples. The default
+	 * implementation decides sample by sample via decide_label;
+	 * strategies that can decode a whole block at once (e.g. ECOC)
+	 * override this.
+	 *
+	 * @param outputs machine outputs, one column per sample
+	 */
+	virtual SGVector<int32_t> decide_labels(SGMatrix<float64_t> outputs);
+
 	/** decide the final label.
 	 * @param outputs a vector of output from each machine (in that order)
 	 * @param n_outputs number of outputs
@@ -0,0 +1,249 @@
+/* This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * Copyright (c) 2012-2013 Sergey Lisitsyn
+ */
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/lib/Signal.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/multiclass/NSWKNNSolver.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+using namespace shogun;
+
+namespace
+{
+
+/* file-local navigable small world graph over the columns of a dense
+ * column-major feature matrix */
+struct NSWGraph
+{
+	const float64_t* feats;
+	int32_t dim;
+	int32_t num_vec;
+	int32_t degree;
+	int32_t max_degree;
+	int32_t ef;
+	std::vector<std::vector<index_t>> edges;
+
+	float64_t sqdist(index_t vec, const float64_t* query) const
+	{
+		Eigen::Map<const Eigen::VectorXd> a(feats+int64_t(vec)*dim, dim);
+		Eigen::Map<const Eigen::VectorXd> b(query, dim);
+		return (a-b).squaredNorm();
+	}
+
+	/** best-first beam search from vertex 0, returns up to num_results
+	 * (distance, index) pairs in order of increasing distance */
+	std::vector<std::pair<float64_t, index_t>> search(const float64_t* query, int32_t beam, int32_t num_results) const
+	{
+		typedef std::pair<float64_t, index_t> entry_t;
+
+		std::vector<entry_t> output;
+		if (num_vec==0)
+			return output;
+
+		std::vector<bool> visited(num_vec, false);
+		// vertices still to be expanded, nearest first
+		std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> frontier;
+		// best vertices seen so far, farthest on top
+		std::priority_queue<entry_t> best;
+
+		float64_t dist=sqdist(0, query);
+		frontier.push(entry_t(dist, 0));
+		best.push(entry_t(dist, 0));
+		visited[0]=true;
+
+		while (!frontier.empty())
+		{
+			entry_t current=frontier.top();
+			if (current.first>best.top().first && int32_t(best.size())>=beam)
+				break;
+			frontier.pop();
+
+			for (index_t neighbor : edges[current.second])
+			{
+				if (visited[neighbor])
+					continue;
+				visited[neighbor]=true;
+
+				float64_t neighbor_dist=sqdist(neighbor, query);
+				if (int32_t(best.size())<beam || neighbor_dist<best.top().first)
+				{
+					frontier.push(entry_t(neighbor_dist, neighbor));
+					best.push(entry_t(neighbor_dist, neighbor));
+					if (int32_t(best.size())>beam)
+						best.pop();
+				}
+			}
+		}
+
+		while (!best.empty())
+		{
+			output.push_back(best.top());
+			best.pop();
+		}
+		std::reverse(output.begin(), output.end());
+		if (int32_t(output.size())>num_results)
+			output.resize(num_results);
+
+		return output;
+	}
+
+	/** cap the neighbor list of a vertex at max_degree, keeping the
+	 * closest neighbors */
+	void prune(index_t vertex)
+	{
+		if (int32_t(edges[vertex].size())<=max_degree)
+			return;
+
+		std::vector<std::pair<float64_t, index_t>> scored;
+		scored.reserve(edges[vertex].size());
+		for (index_t neighbor : edges[vertex])
+			scored.emplace_back(sqdist(neighbor, feats+int64_t(vertex)*dim), neighbor);
+
+		std::partial_sort(scored.begin(), scored.begin()+max_degree, scored.end());
+		edges[vertex].clear();
+		for (int32_t j=0; j<max_degree; j++)
+			edges[vertex].push_back(scored[j].second);
+	}
+
+	/** link a new vertex bidirectionally to its nearest candidates */
+	void connect(index_t vertex, const std::vector<std::pair<float64_t, index_t>>& candidates)
+	{
+		for (auto& candidate : candidates)
+		{
+			if (candidate.second==vertex)
+				continue;
+			if (int32_t(edges[vertex].size())>=degree)
+				break;
+
+			edges[vertex].push_back(candidate.second);
+			edges[candidate.second].push_back(vertex);
+			prune(candidate.second);
+		}
+	}
+
+	void build()
+	{
+		edges.assign(num_vec, std::vector<index_t>());
+
+		// vertices are inserted in chunks: candidate neighbors of a whole
+		// chunk are searched in parallel against the frozen graph of the
+		// previous chunks, then the edges are added serially. The first
+		// chunk is inserted one by one to bootstrap the graph.
+		const int32_t chunk_size=256;
+		int32_t bootstrap=Math::min(chunk_size, num_vec);
+
+		for (index_t i=0; i<bootstrap; i++)
+			connect(i, search(feats+int64_t(i)*dim, ef, degree+1));
+
+		std::vector<std::vector<std::pair<float64_t, index_t>>> candidates(chunk_size);
+		for (int32_t start=bootstrap; start<num_vec; start+=chunk_size)
+		{
+			int32_t num_inserts=Math::min(chunk_size, num_vec-start);
+
+			#pragma omp parallel for schedule(dynamic)
+			for (int32_t i=0; i<num_inserts; i++)
+				candidates[i]=search(feats+int64_t(start+i)*dim, ef, degree);
+
+			for (int32_t i=0; i<num_inserts; i++)
+				connect(start+i, candidates[i]);
+		}
+	}
+};
+
+}
+
+NSWKNNSolver::NSWKNNSolver(const int32_t k, const float64_t q, const int32_t num_classes, const int32_t min_label, const SGVector<int32_t> train_labels, const int32_t degree, const int32_t ef):
+KNNSolver(k, q, num_classes, min_label, train_labels)
+{
+	init();
+
+	if (degree>0)
+		m_degree=degree;
+	if (ef>0)
+		m_ef=ef;
+}
+
+SGMatrix<index_t> NSWKNNSolver::compute_nearest_neighbors(const std::shared_ptr<Distance>& knn_distance) const
+{
+	auto lhs=knn_distance->get_lhs()->as<DenseFeatures<float64_t>>();
+	auto rhs=knn_distance->get_rhs()->as<DenseFeatures<float64_t>>();
+
+	int32_t num_feat, num_train, num_query_feat, num_queries;
+	const float64_t* train_matrix=lhs->get_feature_matrix(num_feat, num_train);
+	const float64_t* query_matrix=rhs->get_feature_matrix(num_query_feat, num_queries);
+
+	require(num_feat==num_query_feat,
+		"Dimension of query vectors ({}) must match dimension of training vectors ({})",
+		num_query_feat, num_feat);
+	require(num_train>=m_k,
+		"K ({}) must not be larger than the number of training vectors ({})",
+		m_k, num_train);
+
+	NSWGraph graph{train_matrix, num_feat, num_train, m_degree, 2*m_degree,
+		Math::max(m_ef, m_k), std::vector<std::vector<index_t>>()};
+	graph.build();
+
+	int32_t beam=Math::max(m_ef, m_k);
+	SGMatrix<index_t> NN(m_k, num_queries);
+
+	#pragma omp parallel for schedule(dynamic, 16)
+	for (int32_t i=0; i<num_queries; i++)
+	{
+		auto found=graph.search(query_matrix+int64_t(i)*num_feat, beam, m_k);
+		for (int32_t j=0; j<m_k; j++)
+			NN(j,i)=found[Math::min(j, int32_t(found.size())-1)].second;
+	}
+
+	return NN;
+}
+
+std::shared_ptr<MulticlassLabels> NSWKNNSolver::classify_objects(std::shared_ptr<Distance> knn_distance, const int32_t num_lab, SGVector<int32_t>& train_lab, SGVector<float64_t>& classes) const
+{
+	auto output=std::make_shared<MulticlassLabels>(num_lab);
+	SGMatrix<index_t> NN=compute_nearest_neighbors(knn_distance);
+
+	for (int32_t i = 0; i < num_lab && (!cancel_computation()); i++)
+	{
+		//write the labels of the k nearest neighbors from theirs indices
+		for (int32_t j=0; j<m_k; j++)
+			train_lab[j] = m_train_labels[ NN(j,i) ];
+
+		//get the index of the 'nearest' class
+		int32_t out_idx = choose_class(classes.vector, train_lab.vector);
+		//write the label of 'nearest' in the output
+		output->set_label(i, out_idx + m_min_label);
+	}
+	return output;
+}
+
+SGVector<int32_t> NSWKNNSolver::classify_objects_k(std::shared_ptr<Distance> knn_distance, const int32_t num_lab, SGVector<int32_t>& train_lab, SGVector<int32_t>& classes) const
+{
+	SGVector<int32_t> output(m_k*num_lab);
+	SGMatrix<index_t> NN=compute_nearest_neighbors(knn_distance);
+
+	//allocation for distances to nearest neighbors
+	SGVector<float64_t> dists(m_k);
+
+	for (index_t i = 0; i < num_lab && (!cancel_computation()); i++)
+	{
+		//write the labels of the k nearest neighbors from theirs indices
+		for (index_t j=0; j<m_k; j++)
+		{
+			train_lab[j] = m_train_labels[ NN(j,i) ];
+			dists[j] = knn_distance->distance(NN(j,i), i);
+		}
+		Math::qsort_index(dists.vector, train_lab.vector, m_k);
+
+		choose_class_for_multiple_k(output.vector+i, classes.vector, train_lab.vector, num_lab);
+	}
+
+	return output;
+}
@@ -0,0 +1,85 @@
+/* This software is distributed under BSD 3-clause license (see LICENSE file).
+ *
+ * Copyright (c) 2012-2013 Sergey Lisitsyn
+ */
+
+#ifndef NSWSOLVER_H__
+#define NSWSOLVER_H__
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/common.h>
+#include <shogun/distance/Distance.h>
+#include <shogun/multiclass/KNNSolver.h>
+
+namespace shogun
+{
+
+/**
+ * Navigable small world graph solver. The training vectors are linked into a
+ * proximity graph once; queries then run a best-first beam search over the
+ * graph instead of scanning all training vectors. The search is approximate
+ * but keeps high recall in high dimensions, where space-partitioning trees
+ * degrade to brute force.
+ * For more information, see
+ * https://en.wikipedia.org/wiki/Hierarchical_navigable_small_world
+ *
+ */
+class NSWKNNSolver : public KNNSolver
+{
+	public:
+		/** default constructor */
+		NSWKNNSolver() : KNNSolver()
+		{
+			init();
+		}
+
+		/** deconstructor */
+		~NSWKNNSolver() override { /* nothing to do */ }
+
+		/** constructor
+		 *
+		 * @param k k
+		 * @param q m_q
+		 * @param num_classes m_num_classes
+		 * @param min_label m_min_label
+		 * @param train_labels m_train_labels
+		 * @param degree number of outgoing edges added per vertex
+		 * @param ef beam width of the graph search
+		 */
+		NSWKNNSolver(const int32_t k, const float64_t q, const int32_t num_classes, const int32_t min_label, const SGVector<int32_t> train_labels, const int32_t degree, const int32_t ef);
+
+		std::shared_ptr<MulticlassLabels> classify_objects(std::shared_ptr<Distance> d, const int32_t num_lab, SGVector<int32_t>& train_lab, SGVector<float64_t>& classes) const override;
+
+		SGVector<int32_t> classify_objects_k(std::shared_ptr<Distance> d, const int32_t num_lab, SGVector<int32_t>& train_lab, SGVector<int32_t>& classes) const override;
+
+		/** @return object name */
+		const char* get_name() const override { return "NSWKNNSolver"; }
+
+	private:
+		void init()
+		{
+			m_degree=16;
+			m_ef=64;
+		}
+
+		/** build the graph over the training vectors and run one beam
+		 * search per query
+		 *
+		 * @param knn_distance distance whose lhs are the training vectors
+		 * and whose rhs are the queries
+		 * @return matrix of the indices of the k nearest neighbors found
+		 */
+		SGMatrix<index_t> compute_nearest_neighbors(const std::shared_ptr<Distance>& knn_distance) const;
+
+	protected:
+		/* Number of outgoing edges added per vertex */
+		int32_t m_degree;
+
+		/* Beam width of the graph search */
+		int32_t m_ef;
+
+};
+}
+
+#endif
@@ -49,6 +49,28 @@ protected:
             dist += (outputs[i]-code[i])*(outputs[i]-code[i]) * Math::abs(code[i]);
 		return std::sqrt(dist);
 	}
+
+    /** the attenuation weights the \f$\|q\|^2\f$ term per codeword, so
+     * the quadratic term stays in the blocked ranking */
+    bool quadratic_decoding() override
+    {
+        return true;
+    }
+
+    /** the attenuated squared codeword norm; codes are in
+     * \f$\{-1,0,1\}\f$ so \f$b^2 |b| = |b|\f$ */
+    SGVector<float64_t> codeword_bias(const SGMatrix<int32_t> codebook) override
+    {
+        SGVector<float64_t> bias(codebook.num_cols);
+        for (int32_t k=0; k < codebook.num_cols; ++k)
+        {
+            const int32_t *code = codebook.get_column_vector(k);
+            bias[k] = 0;
+            for (int32_t j=0; j < codebook.num_rows; ++j)
+                bias[k] += Math::abs(code[j]);
+        }
+        return bias;
+    }
 };
 
 } /* shogun */
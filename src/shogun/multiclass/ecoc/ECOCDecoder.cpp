@@ -9,6 +9,17 @@
 
 using namespace shogun;
 
+SGVector<int32_t> ECOCDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    SGVector<int32_t> labels(outputs.num_cols);
+    for (int32_t i=0; i < outputs.num_cols; ++i)
+    {
+        SGVector<float64_t> query(outputs.get_column_vector(i), outputs.num_rows, false);
+        labels[i] = decide_label(query, codebook);
+    }
+    return labels;
+}
+
 SGVector<float64_t> ECOCDecoder::binarize(const SGVector<float64_t> query)
 {
     SGVector<float64_t> bquery(query.vlen);
@@ -43,6 +43,16 @@ public:
      */
     virtual int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook)=0;
 
+    /** decide labels for a batch of samples at once. The default
+     * implementation decodes column by column via decide_label;
+     * subclasses can decode the whole block with dense matrix
+     * operations instead.
+     *
+     * @param outputs classifier outputs, one column per sample
+     * @param codebook ECOC codebook
+     */
+    virtual SGVector<int32_t> decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook);
+
 protected:
     /** turn 2-class labels into binary */
     SGVector<float64_t> binarize(const SGVector<float64_t> query);
@@ -49,6 +49,22 @@ protected:
             dist += (outputs[i]-code[i])*(outputs[i]-code[i]);
 		return std::sqrt(dist);
 	}
+
+    /** the squared codeword norm: the \f$\|q\|^2\f$ term of the
+     * squared distance is constant per sample and drops out of the
+     * ranking */
+    SGVector<float64_t> codeword_bias(const SGMatrix<int32_t> codebook) override
+    {
+        SGVector<float64_t> bias(codebook.num_cols);
+        for (int32_t k=0; k < codebook.num_cols; ++k)
+        {
+            const int32_t *code = codebook.get_column_vector(k);
+            bias[k] = 0;
+            for (int32_t j=0; j < codebook.num_rows; ++j)
+                bias[k] += code[j]*code[j];
+        }
+        return bias;
+    }
 };
 
 } /* shogun */
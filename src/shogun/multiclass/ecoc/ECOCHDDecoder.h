@@ -12,6 +12,8 @@
 #include <shogun/multiclass/ecoc/ECOCSimpleDecoder.h>
 #include <shogun/multiclass/ecoc/ECOCUtil.h>
 
+#include <cmath>
+
 namespace shogun
 {
 
@@ -43,6 +45,17 @@ protected:
     {
         return ECOCUtil::hamming_distance(outputs.vector, code, outputs.vlen);
     }
+
+    /** ECOCUtil::hamming_distance sums \f$|q_i - b_{ki}|\f$, which for
+     * binarized outputs equals \f$L - q^T b_k\f$, and then
+     * integer-divides by two; the truncation changes which codeword
+     * wins a near-tie. The correlation of \f$\pm 1\f$ outputs with an
+     * integer codeword is an exact integer in double, so flooring
+     * here matches the scalar distance bit for bit. */
+    float64_t rank_correlation(float64_t correlation, int32_t code_len) override
+    {
+        return std::floor((code_len - correlation)/2);
+    }
 };
 
 }
@@ -4,8 +4,9 @@
  * Authors: Soeren Sonnenburg, Sanuj Sharma, Chiyuan Zhang
  */
 
-#include <shogun/multiclass/ecoc/ECOCSimpleDecoder.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/multiclass/ecoc/ECOCSimpleDecoder.h>
 
 using namespace shogun;
 
@@ -23,3 +24,83 @@ int32_t ECOCSimpleDecoder::decide_label(const SGVector<float64_t> outputs, const
     int32_t result = Math::arg_min(distances.vector, 1, distances.vlen);
     return result;
 }
+
+SGVector<int32_t> ECOCSimpleDecoder::decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook)
+{
+    int32_t code_len = codebook.num_rows;
+    int32_t num_classes = codebook.num_cols;
+    int32_t num_samples = outputs.num_cols;
+
+    SGMatrix<float64_t> codes(code_len, num_classes);
+    for (int32_t i=0; i < code_len*num_classes; ++i)
+        codes.matrix[i] = codebook.matrix[i];
+
+    SGMatrix<float64_t> abs_codes;
+    if (quadratic_decoding())
+    {
+        abs_codes = SGMatrix<float64_t>(code_len, num_classes);
+        for (int32_t i=0; i < code_len*num_classes; ++i)
+            abs_codes.matrix[i] = Math::abs(codes.matrix[i]);
+    }
+
+    SGVector<float64_t> bias = codeword_bias(codebook);
+
+    // blocked over samples so the score matrix stays small no matter
+    // how many samples are decoded at once
+    const int32_t block_size = 1024;
+    SGVector<int32_t> labels(num_samples);
+    for (int32_t start=0; start < num_samples; start += block_size)
+    {
+        int32_t cur = Math::min(block_size, num_samples-start);
+
+        SGMatrix<float64_t> query(code_len, cur);
+        if (binary_decoding())
+        {
+            for (int32_t i=0; i < cur; ++i)
+            {
+                const float64_t *src = outputs.get_column_vector(start+i);
+                float64_t *dst = query.get_column_vector(i);
+                for (int32_t j=0; j < code_len; ++j)
+                    dst[j] = src[j] >= 0 ? +1.0 : -1.0;
+            }
+        }
+        else
+        {
+            sg_memcpy(query.matrix, outputs.get_column_vector(start),
+                code_len*cur*sizeof(float64_t));
+        }
+
+        SGMatrix<float64_t> scores = linalg::matrix_prod(codes, query, true, false);
+
+        SGMatrix<float64_t> quad;
+        if (quadratic_decoding())
+        {
+            SGMatrix<float64_t> query_sq(code_len, cur);
+            for (int32_t i=0; i < code_len*cur; ++i)
+                query_sq.matrix[i] = query.matrix[i]*query.matrix[i];
+            quad = linalg::matrix_prod(abs_codes, query_sq, true, false);
+        }
+
+        for (int32_t i=0; i < cur; ++i)
+        {
+            int32_t best = 0;
+            float64_t best_score = 0;
+            for (int32_t k=0; k < num_classes; ++k)
+            {
+                float64_t score = rank_correlation(scores(k, i), code_len);
+                if (bias.vlen)
+                    score += bias[k];
+                if (quad.matrix)
+                    score += quad(k, i);
+                if (k==0 || score < best_score)
+                {
+                    best = k;
+                    best_score = score;
+                }
+            }
+            labels[start+i] = best;
+        }
+    }
+
+    return labels;
+}
@@ -37,12 +37,56 @@ public:
      */
     int32_t decide_label(const SGVector<float64_t> outputs, const SGMatrix<int32_t> codebook) override;
 
+    /** decide labels for a batch of samples at once. The simple
+     * distances all rank codewords by
+     *
+     * \f[
+     * (q \circ q)^T |b_k| \cdot \gamma + \rho(q^T b_k) + \delta_k
+     * \f]
+     *
+     * so the sample-times-codeword score matrix of a block of samples
+     * is computed with dense matrix products instead of per-sample
+     * per-codeword scalar loops. \f$\gamma\f$ is controlled by
+     * quadratic_decoding(), \f$\rho\f$ by rank_correlation() and
+     * \f$\delta\f$ by codeword_bias(); subclasses whose distance is
+     * not of this form must override decide_labels itself.
+     *
+     * @param outputs classifier outputs, one column per sample
+     * @param codebook ECOC codebook
+     */
+    SGVector<int32_t> decide_labels(const SGMatrix<float64_t> outputs, const SGMatrix<int32_t> codebook) override;
+
 protected:
     /** whether to turn the output into binary before decoding */
     virtual bool binary_decoding()=0;
 
     /** compute distance */
     virtual float64_t compute_distance(SGVector<float64_t> outputs, const int32_t *code)=0;
+
+    /** ranking contribution of the correlation \f$q^T b_k\f$; the
+     * default is the linear term \f$-2 q^T b_k\f$ of the expanded
+     * squared distances. Subclasses whose compute_distance() is a
+     * different function of the correlation override this so the
+     * blocked ranking reproduces the scalar distance exactly,
+     * including how ties between codewords break. */
+    virtual float64_t rank_correlation(float64_t correlation, int32_t code_len)
+    {
+        return -2*correlation;
+    }
+
+    /** whether the blocked ranking needs the quadratic term
+     * \f$(q \circ q)^T |b_k|\f$ */
+    virtual bool quadratic_decoding()
+    {
+        return false;
+    }
+
+    /** per-codeword additive term of the blocked ranking; an empty
+     * vector means all zero */
+    virtual SGVector<float64_t> codeword_bias(const SGMatrix<int32_t> codebook)
+    {
+        return SGVector<float64_t>();
+    }
 };
 
 } /* shogun */
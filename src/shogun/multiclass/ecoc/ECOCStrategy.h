@@ -51,6 +51,12 @@ public:
      */
     int32_t decide_label(SGVector<float64_t> outputs) override;
 
+    /** decide the final labels of a batch of samples in one pass
+     * through the decoder.
+     * @param outputs machine outputs, one column per sample
+     */
+    SGVector<int32_t> decide_labels(SGMatrix<float64_t> outputs) override;
+
     /** get number of machines used in this strategy.
      */
     int32_t get_num_machines() override;
@@ -214,13 +214,14 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	if (feature_id_vector.vlen==0)
 		return node;
 
-	// if all remaining attributes are identical
+	// if all remaining (still active) attributes are identical
 	bool flag=true;
 	for (int32_t i=1;i<num_vecs;i++)
 	{
-		for (int32_t j=0;j<feats->get_num_features();j++)
+		for (int32_t j=0;j<feature_id_vector.vlen;j++)
 		{
-			if (feats->get_feature_vector(i)[j]!=feats->get_feature_vector(i-1)[j])
+			if (feats->get_feature_vector(i)[feature_id_vector[j]]!=
+				feats->get_feature_vector(i-1)[feature_id_vector[j]])
 			{
 				flag=false;
 				break;
@@ -240,12 +241,12 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	float64_t max_impurity = 0.0;
 	int32_t best_feature_index=-1;
 	float64_t threshold=0.;
-	for (int32_t i=0; i<feats->get_num_features(); i++)
+	for (int32_t i=0; i<feature_id_vector.vlen; i++)
 	{
 		if (m_nominal[feature_id_vector[i]])
 		{
 			float64_t gain = informational_gain_attribute(
-			    i, feats, weights, class_labels, impurity);
+			    feature_id_vector[i], feats, weights, class_labels, impurity);
 			max_impurity = std::max(max_impurity, impurity);
 			if (gain>=max)
 			{
@@ -259,7 +260,7 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 			float64_t max_value=Math::MIN_REAL_NUMBER;
 			for (int32_t k=0; k<num_vecs; k++)
 			{
-				feature_values[k]=(feats->get_feature_vector(k))[i];
+				feature_values[k]=(feats->get_feature_vector(k))[feature_id_vector[i]];
 
 				if (!Math::fequals(feature_values[k],MISSING,0) && feature_values[k]>max_value)
 					max_value=feature_values[k];
@@ -306,21 +307,21 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 		// convert continuous feature to nominal. Store cache for restoration
 		for(int32_t p=0;p<num_vecs;p++)
 		{
-			feature_cache[p]=feats->get_feature_vector(p)[best_feature_index];
+			feature_cache[p]=feats->get_feature_vector(p)[feature_id_vector[best_feature_index]];
 			if (Math::fequals(feature_cache[p],MISSING,0))
 				continue;
 
 			if (feature_cache[p]<=threshold)
-				feats->get_feature_vector(p)[best_feature_index]=0.;
+				feats->get_feature_vector(p)[feature_id_vector[best_feature_index]]=0.;
 			else
-				feats->get_feature_vector(p)[best_feature_index]=1.;
+				feats->get_feature_vector(p)[feature_id_vector[best_feature_index]]=1.;
 		}
 	}
 
 	// get feature values for the best feature chosen - shorthand for the features values of the best feature chosen
 	SGVector<float64_t> best_feature_values(num_vecs);
 	for (int32_t i=0; i<num_vecs; i++)
-		best_feature_values[i]=(feats->get_feature_vector(i))[best_feature_index];
+		best_feature_values[i]=(feats->get_feature_vector(i))[feature_id_vector[best_feature_index]];
 
 	// prepare vector of unique feature values excluding MISSING , also calculate total weight associated with missing attributes
 	int32_t num_missing=0;
@@ -357,26 +358,19 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 				num_cols++;
 		}
 
-		SGMatrix<float64_t> mat(feats->get_num_features()-1, num_cols);
-		SGVector<float64_t> new_labels_vector(num_cols);
+		SGVector<index_t> subset(num_cols);
 		SGVector<float64_t> new_weights(num_cols);
 
 		int32_t cnt=0;
-		//choose the samples that have the active feature value
+		// stable partition of this node's vectors by attribute value:
+		// the child works on a zero-copy subset view of the same matrix
+		// instead of a freshly copied submatrix
 		for (int32_t j=0; j<num_vecs; j++)
 		{
-			SGVector<float64_t> sample=feats->get_feature_vector(j);
-			if (active_feature_value==sample[best_feature_index] || Math::fequals(sample[best_feature_index],MISSING,0))
+			if (active_feature_value==best_feature_values[j] || Math::fequals(best_feature_values[j],MISSING,0))
 			{
-				int32_t idx=-1;
-				for (int32_t k=0; k<sample.size(); k++)
-				{
-					if (k!=best_feature_index)
-						mat(++idx, cnt) = sample[k];
-				}
-
-				new_labels_vector[cnt]=class_labels->get_labels()[j];
-				if (!Math::fequals(sample[best_feature_index],MISSING,0))
+				subset[cnt]=j;
+				if (!Math::fequals(best_feature_values[j],MISSING,0))
 					new_weights[cnt]=weights[j];
 				else
 					new_weights[cnt]=0.;
@@ -407,8 +401,8 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 		}
 
 		// new data & label for child node
-		auto new_class_labels=std::make_shared<MulticlassLabels>(new_labels_vector);
-		auto new_data=std::make_shared<DenseFeatures<float64_t>>(mat);
+		auto new_class_labels=view(class_labels, subset);
+		auto new_data=view(feats, subset);
 
 		// recursion over child nodes
 		auto child=C45train(new_data,new_weights,new_class_labels,new_feature_id_vector,level+1);
@@ -427,7 +421,7 @@ std::shared_ptr<TreeMachineNode<C45TreeNodeData>> C45ClassifierTree::C45train(co
 	{
 		// restore data matrix
 		for(int32_t p=0;p<num_vecs;p++)
-			feats->get_feature_vector(p)[best_feature_index]=feature_cache[p];
+			feats->get_feature_vector(p)[feature_id_vector[best_feature_index]]=feature_cache[p];
 	}
 
 	return node;
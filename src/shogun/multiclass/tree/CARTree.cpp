@@ -33,6 +33,7 @@
 #include <shogun/lib/View.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/multiclass/tree/CARTree.h>
@@ -106,10 +107,12 @@ std::shared_ptr<MulticlassLabels> CARTree::apply_multiclass(std::shared_ptr<Feat
 {
 	require(data, "Data required for classification in apply_multiclass");
 
-	// apply multiclass starting from root
-	auto current=get_root()->as<bnode_t>();
+	// apply multiclass starting from root; a tree restored through
+	// import_compiled() has no node graph and predicts from its arrays
+	auto root=get_root();
+	auto current=root ? root->as<bnode_t>() : nullptr;
 
-	require(current, "Tree machine not yet trained.");
+	require(current || m_compiled_attribute.vlen>0, "Tree machine not yet trained.");
 	if (auto subfeat_data =
 	        std::dynamic_pointer_cast<DenseSubSamplesFeatures<float64_t>>(data))
 	{
@@ -138,8 +141,11 @@ std::shared_ptr<RegressionLabels> CARTree::apply_regression(std::shared_ptr<Feat
 {
 	require(data, "Data required for classification in apply_multiclass");
 
-	// apply regression starting from root
-	auto current=get_root()->as<bnode_t>();
+	// apply regression starting from root; a tree restored through
+	// import_compiled() has no node graph and predicts from its arrays
+	auto root=get_root();
+	auto current=root ? root->as<bnode_t>() : nullptr;
+	require(current || m_compiled_attribute.vlen>0, "Tree machine not yet trained.");
 	return apply_from_current_node(data->as<DenseFeatures<float64_t>>(), current)->as<RegressionLabels>();
 }
 
@@ -292,6 +298,25 @@ bool CARTree::train_machine(std::shared_ptr<Features> data)
 		linalg::set_const(m_nominal, false);
 	}
 
+	if (m_num_bins>0)
+	{
+		require(
+		    !m_pre_sort, "Histogram split finding cannot be combined with "
+		    "pre-sorted features");
+		if (m_external_bin_edges)
+		{
+			require(
+			    m_bin_edges.num_rows==m_num_bins &&
+			    m_bin_edges.num_cols==num_features,
+			    "Supplied bin edges ({}x{}) do not match number of "
+			    "bins ({}) and features ({})",
+			    m_bin_edges.num_rows, m_bin_edges.num_cols, m_num_bins,
+			    num_features);
+		}
+		else
+			compute_bin_edges(dense_features);
+	}
+
 	auto dense_labels = m_labels->as<DenseLabels>();
 	set_root(CARTtrain(dense_features,m_weights,dense_labels,0));
 
@@ -322,6 +347,116 @@ void CARTree::set_sorted_features(SGMatrix<float64_t>& sorted_feats, SGMatrix<in
 	m_sorted_indices=sorted_indices;
 }
 
+void CARTree::set_histogram_bins(int32_t num_bins)
+{
+	require(num_bins==0 || (num_bins>=2 && num_bins<=256),
+		"Number of bins should be 0 (disabled) or in [2,256]. "
+		"Supplied value is {}",num_bins);
+	m_num_bins=num_bins;
+}
+
+SGMatrix<float64_t> CARTree::pre_compute_bin_edges(const std::shared_ptr<DenseFeatures<float64_t>>& data)
+{
+	require(data, "Data required for computing bin edges");
+	require(
+	    m_num_bins>0, "set_histogram_bins() must be called before bin "
+	    "edges can be computed");
+
+	// feature types may not have been set yet; treat everything as
+	// continuous then, exactly like train_machine() does
+	auto num_features=data->get_num_features();
+	if (m_nominal.vlen!=num_features)
+	{
+		m_nominal=SGVector<bool>(num_features);
+		linalg::set_const(m_nominal, false);
+	}
+
+	compute_bin_edges(data);
+	return m_bin_edges;
+}
+
+void CARTree::set_bin_edges(const SGMatrix<float64_t>& bin_edges)
+{
+	m_external_bin_edges=true;
+	m_bin_edges=bin_edges;
+}
+
+bool CARTree::export_compiled(
+	SGVector<int32_t>& attributes, SGVector<float64_t>& thresholds,
+	SGVector<int32_t>& left_children, SGVector<float64_t>& labels)
+{
+	auto root=get_root();
+	require(root, "Tree machine not yet trained.");
+
+	auto current=root->as<bnode_t>();
+	if (current!=m_compiled_from)
+		compile_tree(current);
+
+	if (m_compiled_attribute.vlen==0)
+		return false;
+
+	attributes=m_compiled_attribute;
+	thresholds=m_compiled_threshold;
+	left_children=m_compiled_left;
+	labels=m_compiled_label;
+	return true;
+}
+
+void CARTree::import_compiled(
+	const SGVector<int32_t>& attributes, const SGVector<float64_t>& thresholds,
+	const SGVector<int32_t>& left_children, const SGVector<float64_t>& labels)
+{
+	require(
+	    attributes.vlen>0 && attributes.vlen==thresholds.vlen &&
+	    attributes.vlen==left_children.vlen && attributes.vlen==labels.vlen,
+	    "Flattened tree arrays must be non-empty and of equal length");
+
+	// no pointer-linked node graph is rebuilt: prediction runs on the
+	// flat arrays directly (m_compiled_from stays empty, which is what
+	// apply_from_current_node receives as root for an imported tree)
+	m_compiled_from=nullptr;
+	m_compiled_attribute=attributes;
+	m_compiled_threshold=thresholds;
+	m_compiled_left=left_children;
+	m_compiled_label=labels;
+}
+
+void CARTree::compute_bin_edges(const std::shared_ptr<DenseFeatures<float64_t>>& data)
+{
+	SGMatrix<float64_t> mat=data->get_feature_matrix();
+	m_bin_edges=SGMatrix<float64_t>(m_num_bins, mat.num_rows);
+	m_bin_edges.zero();
+
+	#pragma omp parallel for
+	for (index_t f=0; f<mat.num_rows; ++f)
+	{
+		if (m_nominal[f])
+			continue;
+
+		// collect the non-missing values and take quantiles as the
+		// inclusive upper edge of each bin
+		SGVector<float64_t> col(mat.num_cols);
+		index_t n=0;
+		for (index_t j=0;j<mat.num_cols;++j)
+		{
+			if (mat(f,j)!=MISSING)
+				col[n++]=mat(f,j);
+		}
+
+		if (n==0)
+			continue;
+
+		std::sort(col.vector, col.vector+n);
+		for (index_t b=0;b<m_num_bins;++b)
+		{
+			index_t q=(index_t)(((int64_t)(b+1)*n)/m_num_bins);
+			m_bin_edges(b,f)=col[Math::max(q-1, (index_t) 0)];
+		}
+		// the last bin always covers the maximum
+		m_bin_edges(m_num_bins-1,f)=col[n-1];
+	}
+}
+
 void CARTree::pre_sort_features(const std::shared_ptr<Features>& data, SGMatrix<float64_t>& sorted_feats, SGMatrix<index_t>& sorted_indices)
 {
 	SGMatrix<float64_t> mat=(data)->as<DenseFeatures<float64_t>>()->get_feature_matrix();
@@ -596,12 +731,24 @@ index_t CARTree::compute_best_attribute(
 		}
 	}
 
-	SGVector<index_t> idx(num_feats);
-	linalg::range_fill(idx);
+	// persistent sampling workspace: the index buffer lives across nodes,
+	// so feature subsampling costs no allocations at the millions of
+	// nodes a forest visits
+	if (m_attribute_indices.vlen!=num_feats)
+	{
+		m_attribute_indices=SGVector<index_t>(num_feats);
+		linalg::range_fill(m_attribute_indices);
+	}
+	SGVector<index_t> idx(m_attribute_indices.vector, num_feats, false);
 	if (subset_size)
 	{
+		// partial Fisher-Yates: only the first subset_size slots need to
+		// be settled, which is all the feature loop below reads; the
+		// buffer stays a permutation of all attribute ids throughout
+		UniformIntDistribution<index_t> uniform_int_dist;
+		for (index_t i=0;i<subset_size;++i)
+			Math::swap(idx[i], idx[uniform_int_dist(m_prng, {i, num_feats-1})]);
 		num_feats=subset_size;
-		random::shuffle(idx, m_prng);
 	}
 
 	float64_t max_gain=MIN_SPLIT_GAIN;
@@ -630,6 +777,103 @@ index_t CARTree::compute_best_attribute(
 
 	for (index_t i=0;i<num_feats;++i)
 	{
+		if (m_num_bins>0 && !m_nominal[idx[i]])
+		{
+			// histogram split finding: one O(N) scan filling per-bin class
+			// statistics of this node, then a linear sweep over the bins;
+			// no per-node sort. Thresholds are the precomputed bin edges.
+			SGMatrix<float64_t> hist_w(n_ulabels, m_num_bins);
+			hist_w.zero();
+			SGVector<index_t> bin_count(m_num_bins);
+			bin_count.zero();
+			SGVector<float64_t> miss_w(n_ulabels);
+			miss_w.zero();
+			index_t n_missing=0;
+
+			const float64_t* edges=m_bin_edges.get_column_vector(idx[i]);
+			for (index_t j=0;j<num_vecs;++j)
+			{
+				float64_t v=mat(idx[i],j);
+				if (v==MISSING)
+				{
+					miss_w[simple_labels[j]]+=weights[j];
+					++n_missing;
+					continue;
+				}
+
+				index_t b=(index_t)(
+					std::lower_bound(edges, edges+m_num_bins-1, v)-edges);
+				hist_w(simple_labels[j], b)+=weights[j];
+				++bin_count[b];
+			}
+
+			if (n_missing==num_vecs)
+				continue;
+
+			// exclude missing vectors from the node totals, like the
+			// sorted path does
+			if (n_missing>0)
+			{
+				for (index_t j=0;j<n_ulabels;++j)
+					total_wclasses[j]-=miss_w[j];
+			}
+
+			SGVector<float64_t> right_wclasses=total_wclasses.clone();
+			SGVector<float64_t> left_wclasses(n_ulabels);
+			linalg::zero(left_wclasses);
+
+			index_t seen=0;
+			for (index_t b=0;b<m_num_bins-1;++b)
+			{
+				if (bin_count[b]==0)
+					continue;
+
+				for (index_t j=0;j<n_ulabels;++j)
+				{
+					left_wclasses[j]+=hist_w(j,b);
+					right_wclasses[j]-=hist_w(j,b);
+				}
+
+				seen+=bin_count[b];
+				if (seen==num_vecs-n_missing)
+					break;
+
+				float64_t g=0;
+				if (m_mode == PT_MULTICLASS)
+				{
+					g = gain(
+					    left_wclasses, right_wclasses, total_wclasses,
+					    max_impurity);
+					impurity = std::max(max_impurity, impurity);
+				}
+				else if (m_mode == PT_REGRESSION)
+				{
+					g = gain(
+					    left_wclasses, right_wclasses, total_wclasses, ulabels,
+					    max_impurity);
+					impurity = std::max(max_impurity, impurity);
+				}
+				else
+					error("Undefined problem statement");
+
+				if (g>max_gain)
+				{
+					max_gain=g;
+					best_attribute=idx[i];
+					best_threshold=edges[b];
+					num_missing_final=n_missing;
+				}
+			}
+
+			if (n_missing>0)
+			{
+				for (index_t j=0;j<n_ulabels;++j)
+					total_wclasses[j]+=miss_w[j];
+			}
+
+			continue;
+		}
+
 		SGVector<float64_t> feats(num_vecs);
 		SGVector<index_t> sorted_args(num_vecs);
 		SGVector<index_t> temp_count_indices(count_indices.size());
@@ -1140,12 +1384,109 @@ float64_t CARTree::least_squares_deviation(const SGVector<float64_t>& feats, con
 	return dev/total_weight;
 }
 
+bool CARTree::compile_tree(const std::shared_ptr<bnode_t>& root)
+{
+	m_compiled_from=root;
+	m_compiled_attribute=SGVector<int32_t>();
+	m_compiled_threshold=SGVector<float64_t>();
+	m_compiled_left=SGVector<int32_t>();
+	m_compiled_label=SGVector<float64_t>();
+
+	// breadth-first layout: the children of all nodes on one level are
+	// laid out contiguously on the next, so a batch of samples descends
+	// the array level by level
+	std::vector<std::shared_ptr<bnode_t>> nodes;
+	nodes.push_back(root);
+	for (size_t n=0; n<nodes.size(); ++n)
+	{
+		auto node=nodes[n];
+		if (node->data.num_leaves==1)
+			continue;
+
+		if (m_nominal[node->data.attribute_id])
+			return false;
+
+		nodes.push_back(node->left());
+		nodes.push_back(node->right());
+	}
+
+	auto num_nodes=(index_t)nodes.size();
+	m_compiled_attribute=SGVector<int32_t>(num_nodes);
+	m_compiled_threshold=SGVector<float64_t>(num_nodes);
+	m_compiled_left=SGVector<int32_t>(num_nodes);
+	m_compiled_label=SGVector<float64_t>(num_nodes);
+
+	// children were pushed in traversal order above, so they sit at the
+	// next two unassigned positions
+	index_t next_child=1;
+	for (index_t n=0;n<num_nodes;++n)
+	{
+		const auto& node=nodes[n];
+		if (node->data.num_leaves==1)
+		{
+			m_compiled_attribute[n]=-1;
+			m_compiled_threshold[n]=0;
+			m_compiled_left[n]=-1;
+			m_compiled_label[n]=node->data.node_label;
+		}
+		else
+		{
+			m_compiled_attribute[n]=node->data.attribute_id;
+			m_compiled_threshold[n]=node->left()->data.transit_into_values[0];
+			m_compiled_left[n]=next_child;
+			m_compiled_label[n]=0;
+			next_child+=2;
+		}
+	}
+
+	return true;
+}
+
 std::shared_ptr<Labels> CARTree::apply_from_current_node(const std::shared_ptr<DenseFeatures<float64_t>>& feats, const std::shared_ptr<bnode_t>& current)
 {
 	auto num_vecs=feats->get_num_vectors();
 	require(num_vecs>0, "No data provided in apply");
 
 	SGVector<float64_t> labels(num_vecs);
+
+	// flatten the tree once per root and route samples through the
+	// contiguous records; trees with nominal splits keep the pointer walk
+	if (current && current!=m_compiled_from)
+		compile_tree(current);
+
+	if (m_compiled_attribute.vlen>0)
+	{
+		for (index_t i=0;i<num_vecs;++i)
+		{
+			auto sample=feats->get_feature_vector(i);
+
+			int32_t n=0;
+			while (m_compiled_attribute[n]>=0)
+			{
+				if (sample[m_compiled_attribute[n]]<=m_compiled_threshold[n])
+					n=m_compiled_left[n];
+				else
+					n=m_compiled_left[n]+1;
+			}
+
+			labels[i]=m_compiled_label[n];
+		}
+
+		switch(m_mode)
+		{
+			case PT_MULTICLASS:
+				return std::make_shared<MulticlassLabels>(labels);
+
+			case PT_REGRESSION:
+				return std::make_shared<RegressionLabels>(labels);
+
+			default:
+				error("mode should be either PT_MULTICLASS or PT_REGRESSION");
+		}
+	}
+
+	require(current, "Tree machine not yet trained.");
+
 	for (index_t i=0;i<num_vecs;++i)
 	{
 		auto sample=feats->get_feature_vector(i);
@@ -1508,12 +1849,24 @@ void CARTree::init()
 	m_label_epsilon=1e-7;
 	m_sorted_features=SGMatrix<float64_t>();
 	m_sorted_indices=SGMatrix<index_t>();
+	m_num_bins=0;
+	m_bin_edges=SGMatrix<float64_t>();
+	m_external_bin_edges=false;
+	m_attribute_indices=SGVector<index_t>();
+	m_compiled_from=nullptr;
+	m_compiled_attribute=SGVector<int32_t>();
+	m_compiled_threshold=SGVector<float64_t>();
+	m_compiled_left=SGVector<int32_t>();
+	m_compiled_label=SGVector<float64_t>();
 
 	SG_ADD(
 	    &m_feature_importances, "feature_importances", "feature importances",
 	    ParameterProperties::READONLY);
 
 	SG_ADD(&m_pre_sort, "pre_sort", "presort");
+	SG_ADD(
+	    &m_num_bins, "num_bins",
+	    "number of quantile bins for histogram split finding");
 	SG_ADD(&m_sorted_features, "sorted_features", "sorted feats");
 	SG_ADD(&m_sorted_indices, "sorted_indices", "sorted indices");
 	SG_ADD(&m_nominal, "nominal", "feature types");
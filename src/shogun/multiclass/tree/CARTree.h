@@ -238,6 +238,68 @@ public:
 
 	void set_sorted_features(SGMatrix<float64_t>& sorted_feats, SGMatrix<index_t>& sorted_indices);
 
+	/** enable histogram-based split finding for continuous attributes:
+	 * quantile bin edges are computed once per train call and every node
+	 * finds its best threshold by a linear scan over per-bin class
+	 * statistics instead of sorting its feature values. Split thresholds
+	 * are restricted to bin edges, which is the usual trade-off of
+	 * histogram tree learners. Cannot be combined with pre-sorted
+	 * features. Nominal attributes are unaffected.
+	 *
+	 * @param num_bins number of quantile bins (2..256), 0 disables
+	 */
+	void set_histogram_bins(int32_t num_bins);
+
+	/** @return number of histogram bins, 0 if histogram mode is disabled */
+	int32_t get_histogram_bins() const { return m_num_bins; }
+
+	/** computes per-feature quantile bin edges on the supplied data
+	 * without training, so that callers fitting many histogram trees on
+	 * (subsets of) the same data can quantize once and share the edges
+	 * via set_bin_edges(). set_histogram_bins() must be called first.
+	 *
+	 * @param data training data to quantize
+	 * @return bin edges matrix (num_bins rows, one column per feature)
+	 */
+	SGMatrix<float64_t> pre_compute_bin_edges(const std::shared_ptr<DenseFeatures<float64_t>>& data);
+
+	/** supply externally computed bin edges for histogram split finding,
+	 * e.g. from pre_compute_bin_edges() on a prototype tree; training
+	 * then skips the per-train quantile computation
+	 *
+	 * @param bin_edges bin edges matrix (num_bins rows, one column per
+	 * feature)
+	 */
+	void set_bin_edges(const SGMatrix<float64_t>& bin_edges);
+
+	/** export the trained tree in its flattened prediction layout (see
+	 * compile_tree()), e.g. for packed ensemble serialization. Fails for
+	 * trees containing nominal splits, which have no flat layout.
+	 *
+	 * @param attributes per-node split attribute id, -1 marks a leaf
+	 * @param thresholds per-node split threshold
+	 * @param left_children per-node index of the left child (right child
+	 * follows it)
+	 * @param labels per-node label, meaningful for leaves
+	 * @return whether the tree could be exported
+	 */
+	bool export_compiled(
+		SGVector<int32_t>& attributes, SGVector<float64_t>& thresholds,
+		SGVector<int32_t>& left_children, SGVector<float64_t>& labels);
+
+	/** restore a tree from its flattened prediction layout, as produced
+	 * by export_compiled(); prediction runs directly on the flat arrays
+	 * without rebuilding the pointer-linked node graph
+	 *
+	 * @param attributes per-node split attribute id, -1 marks a leaf
+	 * @param thresholds per-node split threshold
+	 * @param left_children per-node index of the left child
+	 * @param labels per-node label, meaningful for leaves
+	 */
+	void import_compiled(
+		const SGVector<int32_t>& attributes, const SGVector<float64_t>& thresholds,
+		const SGVector<int32_t>& left_children, const SGVector<float64_t>& labels);
+
 	/**return feature importance
 	 * this way is the same as sklearn
 	 */
@@ -427,6 +489,26 @@ protected:
 	 */
 	void form_t1(const std::shared_ptr<bnode_t>& node);
 
+	/** computes the per-feature quantile bin edges used by histogram
+	 * split finding; one sort per feature per train call
+	 *
+	 * @param data training data
+	 */
+	void compute_bin_edges(const std::shared_ptr<DenseFeatures<float64_t>>& data);
+
+	/** flattens the subtree under the given root into contiguous
+	 * (attribute, threshold, child index) records in breadth-first
+	 * order, so prediction descends a compact array level by level
+	 * instead of chasing pointer-linked node objects. Returns false
+	 * (leaving the records empty) when the subtree contains nominal
+	 * splits, whose value sets do not fit the flat record; those trees
+	 * keep using the pointer walk.
+	 *
+	 * @param root root of the subtree to flatten
+	 * @return whether the subtree could be flattened
+	 */
+	bool compile_tree(const std::shared_ptr<bnode_t>& root);
+
 	/** initializes members of class */
 	void init();
 public:
@@ -466,6 +548,36 @@ protected:
 	/** If pre sorted features are used in train */
 	bool m_pre_sort;
 
+	/** number of quantile bins for histogram split finding, 0 disables */
+	int32_t m_num_bins;
+
+	/** inclusive upper edge of each bin per feature (num_bins x num_feats) */
+	SGMatrix<float64_t> m_bin_edges;
+
+	/** if externally supplied bin edges are used in train */
+	bool m_external_bin_edges;
+
+	/** reusable attribute index buffer for per-node feature subsampling;
+	 * kept across nodes so sampling is a partial Fisher-Yates without
+	 * allocations */
+	SGVector<index_t> m_attribute_indices;
+
+	/** root the flattened records below were compiled from; records are
+	 * rebuilt lazily whenever prediction starts from a different root */
+	std::shared_ptr<bnode_t> m_compiled_from;
+
+	/** per flattened node: split attribute id, -1 marks a leaf */
+	SGVector<int32_t> m_compiled_attribute;
+
+	/** per flattened node: split threshold (continuous attributes) */
+	SGVector<float64_t> m_compiled_threshold;
+
+	/** per flattened node: index of the left child, right child follows it */
+	SGVector<int32_t> m_compiled_left;
+
+	/** per flattened node: label, meaningful for leaves only */
+	SGVector<float64_t> m_compiled_label;
+
 	/** flag indicating whether cross validation pruning has to be applied or not - false by default **/
 	bool m_apply_cv_pruning;
 
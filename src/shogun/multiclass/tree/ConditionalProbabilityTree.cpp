@@ -56,6 +56,10 @@ int32_t ConditionalProbabilityTree::apply_multiclass_example(SGVector<float32_t>
 
 void ConditionalProbabilityTree::compute_conditional_probabilities(const SGVector<float32_t>& ex)
 {
+	// collect the internal nodes first: each owns its own binary
+	// machine, so their sigmoid outputs for one example are computed
+	// concurrently
+	vector<std::shared_ptr<bnode_t>> internal_nodes;
 	stack<std::shared_ptr<bnode_t>> nodes;
 	nodes.push(m_root->as<bnode_t>());
 
@@ -69,9 +73,14 @@ void ConditionalProbabilityTree::compute_conditional_probabilities(const SGVecto
 			nodes.push(node->right());
 
 			// don't calculate for leaf
-			node->data.p_right = predict_node(ex, node);
+			internal_nodes.push_back(node);
 		}
 	}
+
+	int32_t num_internal = (int32_t)internal_nodes.size();
+	#pragma omp parallel for
+	for (int32_t i=0; i < num_internal; ++i)
+		internal_nodes[i]->data.p_right = predict_node(ex, internal_nodes[i]);
 }
 
 float64_t ConditionalProbabilityTree::accumulate_conditional_probability(std::shared_ptr<bnode_t> leaf)
@@ -197,21 +206,29 @@ void ConditionalProbabilityTree::train_example(const std::shared_ptr<StreamingDe
 
 void ConditionalProbabilityTree::train_path(const std::shared_ptr<StreamingDenseFeatures<float32_t>>& ex, std::shared_ptr<bnode_t> node)
 {
-	float64_t node_label = 0;
-	train_node(ex, node_label, node);
+	// collect the leaf-to-root path first: every node on it updates
+	// its own binary machine, so the per-node updates touch disjoint
+	// weight vectors and run concurrently for one example
+	vector<std::shared_ptr<bnode_t>> nodes;
+	vector<float64_t> node_labels;
+
+	nodes.push_back(node);
+	node_labels.push_back(0);
 
 	auto par = node->parent()->as<bnode_t>();
 	while (par != NULL)
 	{
-		if (par->left() == node)
-			node_label = 0;
-		else
-			node_label = 1;
+		node_labels.push_back(par->left() == node ? 0 : 1);
+		nodes.push_back(par);
 
-		train_node(ex, node_label, par);
 		node = par;
 		par = node->parent()->as<bnode_t>();
 	}
+
+	int32_t num_nodes = (int32_t)nodes.size();
+	#pragma omp parallel for
+	for (int32_t i=0; i < num_nodes; ++i)
+		train_node(ex, node_labels[i], nodes[i]);
 }
 
 void ConditionalProbabilityTree::train_node(const std::shared_ptr<StreamingDenseFeatures<float32_t>>& ex, float64_t label, const std::shared_ptr<bnode_t>& node)
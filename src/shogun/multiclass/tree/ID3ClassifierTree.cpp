@@ -136,14 +136,16 @@ std::shared_ptr<TreeMachineNode<id3TreeNodeData>> ID3ClassifierTree::id3train(co
 	if (feature_id_vector.vlen == 0)
 		return node;
 
-	// else get the feature with the highest informational gain
+	// else get the feature with the highest informational gain; only the
+	// features still active at this node are considered, the matrix
+	// itself is never rewritten
 	float64_t max = 0;
 	int32_t best_feature_index = -1;
 	float64_t impurity = 0.0, max_impurity = 0.0;
-	for (int32_t i=0; i<feats->get_num_features(); i++)
+	for (int32_t i=0; i<feature_id_vector.vlen; i++)
 	{
-		float64_t gain =
-		    informational_gain_attribute(i, feats, class_labels, impurity);
+		float64_t gain = informational_gain_attribute(
+		    feature_id_vector[i], feats, class_labels, impurity);
 		max_impurity = std::max(impurity, max_impurity);
 		if (gain >= max)
 		{
@@ -155,7 +157,8 @@ std::shared_ptr<TreeMachineNode<id3TreeNodeData>> ID3ClassifierTree::id3train(co
 	// get feature values for the best feature chosen
 	SGVector<float64_t> best_feature_values = SGVector<float64_t>(num_vecs);
 	for (int32_t i=0; i<num_vecs; i++)
-		best_feature_values[i] = (feats->get_feature_vector(i))[best_feature_index];
+		best_feature_values[i] =
+		    (feats->get_feature_vector(i))[feature_id_vector[best_feature_index]];
 
 	auto best_feature_labels = std::make_shared<MulticlassLabels>(best_feature_values);
 	SGVector<float64_t> best_labels_unique = best_feature_labels->get_unique_labels();
@@ -172,29 +175,18 @@ std::shared_ptr<TreeMachineNode<id3TreeNodeData>> ID3ClassifierTree::id3train(co
 				num_cols++;
 		}
 
-		SGMatrix<float64_t> mat = SGMatrix<float64_t>(feats->get_num_features()-1, num_cols);
-		SGVector<float64_t> new_labels_vector = SGVector<float64_t>(num_cols);
-
+		// stable partition of this node's vectors by attribute value:
+		// the child works on a zero-copy subset view of the same matrix
+		// instead of a freshly copied submatrix
+		SGVector<index_t> subset(num_cols);
 		int32_t cnt = 0;
-		// choose the samples that have the active feature value
 		for (int32_t j=0; j<num_vecs; j++)
 		{
-			SGVector<float64_t> sample = feats->get_feature_vector(j);
-			if (active_feature_value == sample[best_feature_index])
-			{
-				int32_t idx = -1;
-				for (int32_t k=0; k<sample.size(); k++)
-				{
-					if (k != best_feature_index)
-						mat(++idx, cnt) = sample[k];
-				}
-
-				new_labels_vector[cnt] = class_labels->get_labels()[j];
-				cnt++;
-			}
+			if (active_feature_value == best_feature_values[j])
+				subset[cnt++] = j;
 		}
 
-		// remove the best_attribute from the remaining attributes index vector
+		// deactivate the best attribute in the subtree
 		SGVector<int32_t> new_feature_id_vector = SGVector<int32_t>(feature_id_vector.vlen-1);
 		cnt = -1;
 		for (int32_t j=0;j<feature_id_vector.vlen;j++)
@@ -203,8 +195,8 @@ std::shared_ptr<TreeMachineNode<id3TreeNodeData>> ID3ClassifierTree::id3train(co
 				new_feature_id_vector[++cnt] = feature_id_vector[j];
 		}
 
-		auto new_class_labels = std::make_shared<MulticlassLabels>(new_labels_vector);
-		auto new_data = std::make_shared<DenseFeatures<float64_t>>(mat);
+		auto new_class_labels = view(class_labels, subset);
+		auto new_data = view(feats, subset);
 
 		auto child = id3train(new_data, new_class_labels, new_feature_id_vector, level+1);
 		child->data.transit_if_feature_value = active_feature_value;
@@ -28,9 +28,12 @@
  * either expressed or implied, of the Shogun Development Team.
  */
 
+#include <shogun/base/ShogunEnv.h>
 #include <shogun/multiclass/tree/NbodyTree.h>
 #include <shogun/distributions/KernelDensity.h>
 
+#include <vector>
+
 using namespace shogun;
 
 CNbodyTree::CNbodyTree(int32_t leaf_size, EDistanceType d)
@@ -53,7 +56,80 @@ void CNbodyTree::build_tree(const std::shared_ptr<DenseFeatures<float64_t>>& dat
 	m_vec_id=SGVector<index_t>(m_data.num_cols);
 	m_vec_id.range_fill(0);
 
-	set_root(recursive_build(0,m_data.num_cols-1));
+	int32_t num_threads=env()->get_num_threads();
+	if (num_threads<2)
+	{
+		set_root(recursive_build(0,m_data.num_cols-1));
+		return;
+	}
+
+	// expand the top of the tree breadth-first until there are enough
+	// independent subtrees to keep all threads busy; each subtree covers a
+	// disjoint slice of m_vec_id, so the subtrees can be built in parallel
+	struct SubtreeTask
+	{
+		std::shared_ptr<bnode_t> parent;
+		bool is_left;
+		index_t start;
+		index_t end;
+	};
+
+	std::vector<SubtreeTask> frontier;
+	frontier.push_back({nullptr,false,0,m_data.num_cols-1});
+
+	bool expanded=true;
+	while (expanded && int32_t(frontier.size())<num_threads)
+	{
+		expanded=false;
+		std::vector<SubtreeTask> next_frontier;
+
+		for (auto& task : frontier)
+		{
+			// leaf-sized slices are left for recursive_build below
+			if (task.end-task.start+1<m_leaf_size*2)
+			{
+				next_frontier.push_back(task);
+				continue;
+			}
+
+			auto node=std::make_shared<bnode_t>();
+			init_node(node,task.start,task.end);
+			node->data.is_leaf=false;
+
+			index_t dim=find_split_dim(node);
+			index_t mid=(task.end+task.start)/2;
+			partition(dim,task.start,task.end,mid);
+
+			if (!task.parent)
+				set_root(node);
+			else if (task.is_left)
+				task.parent->left(node);
+			else
+				task.parent->right(node);
+
+			next_frontier.push_back({node,true,task.start,mid});
+			next_frontier.push_back({node,false,mid+1,task.end});
+			expanded=true;
+		}
+
+		frontier=std::move(next_frontier);
+	}
+
+	std::vector<std::shared_ptr<bnode_t>> subtrees(frontier.size());
+
+	#pragma omp parallel for schedule(dynamic)
+	for (index_t i=0;i<index_t(frontier.size());i++)
+		subtrees[i]=recursive_build(frontier[i].start,frontier[i].end);
+
+	for (index_t i=0;i<index_t(frontier.size());i++)
+	{
+		if (!frontier[i].parent)
+			set_root(subtrees[i]);
+		else if (frontier[i].is_left)
+			frontier[i].parent->left(subtrees[i]);
+		else
+			frontier[i].parent->right(subtrees[i]);
+	}
 }
 
 void CNbodyTree::query_knn(const std::shared_ptr<DenseFeatures<float64_t>>& data, int32_t k)
@@ -67,12 +143,16 @@ void CNbodyTree::query_knn(const std::shared_ptr<DenseFeatures<float64_t>>& data
 	m_knn_indices=SGMatrix<index_t>(k,qfeats.num_cols);
 	int32_t dim=qfeats.num_rows;
 
+	std::shared_ptr<bnode_t> root;
+	if (m_root)
+		root=m_root->as<bnode_t>();
+
+	// the tree is read-only during querying and each query owns its heap,
+	// so a block of queries can descend the tree concurrently
+	#pragma omp parallel for schedule(dynamic, 64)
 	for (int32_t i=0;i<qfeats.num_cols;i++)
 	{
 		auto heap=std::make_shared<KNNHeap>(k);
-		std::shared_ptr<bnode_t> root;
-		if (m_root)
-			root=m_root->as<bnode_t>();
 
 		float64_t mdist=min_dist(root,qfeats.matrix+i*dim,dim);
 		query_knn_single(heap,mdist,root,qfeats.matrix+i*dim,dim);
@@ -81,6 +161,115 @@ void CNbodyTree::query_knn(const std::shared_ptr<DenseFeatures<float64_t>>& data
 	}
 }
 
+void CNbodyTree::query_knn_dual(SGMatrix<float64_t> qfeats, SGVector<index_t> qid, const std::shared_ptr<bnode_t>& qroot, int32_t k)
+{
+	require(qroot,"query tree root not supplied");
+	require(qfeats.num_rows==m_data.num_rows,"query data dimension should be same as training data dimension");
+	require(qid.vlen==qfeats.num_cols,"id vector of the query tree should cover all query vectors");
+
+	m_knn_done=true;
+	m_knn_dists=SGMatrix<float64_t>(k,qfeats.num_cols);
+	m_knn_indices=SGMatrix<index_t>(k,qfeats.num_cols);
+
+	std::vector<std::shared_ptr<KNNHeap>> heaps;
+	heaps.reserve(qfeats.num_cols);
+	for (int32_t i=0;i<qfeats.num_cols;i++)
+		heaps.push_back(std::make_shared<KNNHeap>(k));
+
+	std::shared_ptr<bnode_t> root;
+	if (m_root)
+		root=m_root->as<bnode_t>();
+
+	knn_dual(qroot,root,qfeats,qid,heaps);
+
+	for (int32_t i=0;i<qfeats.num_cols;i++)
+	{
+		sg_memcpy(m_knn_dists.matrix+i*k,heaps[i]->get_dists(),k*sizeof(float64_t));
+		sg_memcpy(m_knn_indices.matrix+i*k,heaps[i]->get_indices(),k*sizeof(index_t));
+	}
+}
+
+void CNbodyTree::knn_dual(const std::shared_ptr<bnode_t>& qnode, const std::shared_ptr<bnode_t>& rnode, const SGMatrix<float64_t>& qfeats,
+	const SGVector<index_t>& qid, const std::vector<std::shared_ptr<KNNHeap>>& heaps)
+{
+	// the reference node can be pruned for the whole query node if it is
+	// farther away than the worst current candidate of every query in it
+	float64_t bound=0;
+	for (index_t i=qnode->data.start_idx;i<=qnode->data.end_idx;i++)
+		bound=Math::max(bound,heaps[qid[i]]->get_max_dist());
+
+	if (min_dist_dual(qnode,rnode)>bound)
+		return;
+
+	int32_t dim=qfeats.num_rows;
+
+	if (qnode->data.is_leaf && rnode->data.is_leaf)
+	{
+		for (index_t i=qnode->data.start_idx;i<=qnode->data.end_idx;i++)
+		{
+			auto& heap=heaps[qid[i]];
+			float64_t* q=qfeats.matrix+qid[i]*dim;
+
+			for (index_t j=rnode->data.start_idx;j<=rnode->data.end_idx;j++)
+				heap->push(m_vec_id[j],distance(m_vec_id[j],q,dim));
+		}
+
+		return;
+	}
+
+	if (rnode->data.is_leaf)
+	{
+		knn_dual(qnode->left(),rnode,qfeats,qid,heaps);
+		knn_dual(qnode->right(),rnode,qfeats,qid,heaps);
+		return;
+	}
+
+	auto rleft=rnode->left();
+	auto rright=rnode->right();
+
+	if (qnode->data.is_leaf)
+	{
+		// visit the nearer reference child first to tighten bounds early
+		if (min_dist_dual(qnode,rleft)<=min_dist_dual(qnode,rright))
+		{
+			knn_dual(qnode,rleft,qfeats,qid,heaps);
+			knn_dual(qnode,rright,qfeats,qid,heaps);
+		}
+		else
+		{
+			knn_dual(qnode,rright,qfeats,qid,heaps);
+			knn_dual(qnode,rleft,qfeats,qid,heaps);
+		}
+
+		return;
+	}
+
+	auto qleft=qnode->left();
+	auto qright=qnode->right();
+
+	if (min_dist_dual(qleft,rleft)<=min_dist_dual(qleft,rright))
+	{
+		knn_dual(qleft,rleft,qfeats,qid,heaps);
+		knn_dual(qleft,rright,qfeats,qid,heaps);
+	}
+	else
+	{
+		knn_dual(qleft,rright,qfeats,qid,heaps);
+		knn_dual(qleft,rleft,qfeats,qid,heaps);
+	}
+
+	if (min_dist_dual(qright,rleft)<=min_dist_dual(qright,rright))
+	{
+		knn_dual(qright,rleft,qfeats,qid,heaps);
+		knn_dual(qright,rright,qfeats,qid,heaps);
+	}
+	else
+	{
+		knn_dual(qright,rright,qfeats,qid,heaps);
+		knn_dual(qright,rleft,qfeats,qid,heaps);
+	}
+}
+
 SGVector<float64_t> CNbodyTree::log_kernel_density(SGMatrix<float64_t> test, EKernelType kernel, float64_t h, float64_t atol, float64_t rtol)
 {
 	int32_t dim=m_data.num_rows;
@@ -41,6 +41,8 @@
 #include <shogun/multiclass/tree/KNNHeap.h>
 #include <shogun/features/DenseFeatures.h>
 
+#include <vector>
+
 namespace shogun
 {
 
@@ -84,6 +86,17 @@ public:
 	 */
 	void query_knn(const std::shared_ptr<DenseFeatures<float64_t>>& data, int32_t k);
 
+	/** apply knn using dual-tree traversal: the whole query set is answered
+	 * in one pruned pass over reference-tree/query-tree node pairs instead
+	 * of one root-to-leaf descent per query
+	 *
+	 * @param qfeats query data matrix
+	 * @param qid id vector of the query tree
+	 * @param qroot root of the query tree
+	 * @param k K value in KNN
+	 */
+	void query_knn_dual(SGMatrix<float64_t> qfeats, SGVector<index_t> qid, const std::shared_ptr<bnode_t>& qroot, int32_t k);
+
 	/** get log of kernel density at query points
 	 *
 	 * @param test query points at which kernel density is to be calculated
@@ -215,6 +228,17 @@ private:
 	 */
 	void query_knn_single(const std::shared_ptr<KNNHeap>& heap, float64_t min_dist, const std::shared_ptr<bnode_t>& node, float64_t* arr, int32_t dim);
 
+	/** depth-first traversal in dual trees for KNN
+	 *
+	 * @param qnode current node from query tree
+	 * @param rnode current node from reference tree
+	 * @param qfeats query data matrix
+	 * @param qid id vector of query tree
+	 * @param heaps per-query heaps storing the k best candidates seen so far
+	 */
+	void knn_dual(const std::shared_ptr<bnode_t>& qnode, const std::shared_ptr<bnode_t>& rnode, const SGMatrix<float64_t>& qfeats,
+	const SGVector<index_t>& qid, const std::vector<std::shared_ptr<KNNHeap>>& heaps);
+
 	/** find kde at each query point
 	 *
 	 * @param node current node
@@ -36,6 +36,7 @@
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/mathematics/Math.h>
+#include <shogun/mathematics/eigen3.h>
 
 using namespace shogun;
 
@@ -263,6 +264,42 @@ void CConvolutionalFeatureMap::pool_activations(
 	}
 }
 
+void CConvolutionalFeatureMap::im2col(const SGMatrix<float64_t>& image)
+{
+	const int32_t filter_size = m_filter_height*m_filter_width;
+	const int32_t num_positions =
+		((m_input_width+m_stride_x-1)/m_stride_x)*
+		((m_input_height+m_stride_y-1)/m_stride_y);
+
+	if (m_im2col_buffer.num_rows != filter_size ||
+		m_im2col_buffer.num_cols != num_positions)
+	{
+		m_im2col_buffer = SGMatrix<float64_t>(filter_size, num_positions);
+	}
+
+	int32_t p = 0;
+	for (int32_t x=0; x<m_input_width; x+=m_stride_x)
+	{
+		for (int32_t y=0; y<m_input_height; y+=m_stride_y)
+		{
+			float64_t* column = m_im2col_buffer.get_column_vector(p);
+			int32_t k = 0;
+			for (int32_t x1=x-m_radius_x; x1<=x+m_radius_x; x1++)
+			{
+				for (int32_t y1=y-m_radius_y; y1<=y+m_radius_y; y1++)
+				{
+					if (x1>=0 && y1>=0 && x1<image.num_cols && y1<image.num_rows)
+						column[k] = image(y1,x1);
+					else
+						column[k] = 0;
+					k++;
+				}
+			}
+			p++;
+		}
+	}
+}
+
 void CConvolutionalFeatureMap::convolve(
 	SGMatrix< float64_t > inputs,
 	SGMatrix< float64_t > weights,
@@ -272,16 +309,43 @@ void CConvolutionalFeatureMap::convolve(
 	int32_t inputs_row_offset,
  	int32_t outputs_row_offset)
 {
+	typedef Eigen::Map<Eigen::MatrixXd> EMappedMatrix;
+	typedef Eigen::Map<Eigen::VectorXd> EMappedVector;
+
+	const int32_t filter_size = m_filter_height*m_filter_width;
+	const int32_t num_positions =
+		((m_input_width+m_stride_x-1)/m_stride_x)*
+		((m_input_height+m_stride_y-1)/m_stride_y);
+
+	/* the filter flattened in patch order: patches are gathered with the
+	 * kernel offsets running forward, so plain convolution (flip=false)
+	 * is a reversal of the column-major filter entries */
+	SGVector<float64_t> filter_vector(filter_size);
+	for (int32_t k=0; k<filter_size; k++)
+		filter_vector[k] = flip ? weights.matrix[k] : weights.matrix[filter_size-1-k];
+
+	SGVector<float64_t> conv_result(num_positions);
+
+	EMappedVector W(filter_vector.vector, filter_size);
+	EMappedVector R(conv_result.vector, num_positions);
+
 	for (int32_t i=0; i<outputs.num_cols; i++)
 	{
 		SGMatrix<float64_t> image(
 			inputs.matrix+i*inputs.num_rows + inputs_row_offset,
 			m_input_height, m_input_width, false);
 
+		im2col(image);
+
+		/* all positions of one image convolved with a single product */
+		EMappedMatrix C(m_im2col_buffer.matrix, filter_size, num_positions);
+		R.noalias() = C.transpose()*W;
+
 		SGMatrix<float64_t> result(
 			outputs.matrix+i*outputs.num_rows + outputs_row_offset,
 			m_output_height, m_output_width, false);
 
+		int32_t p = 0;
 		for (int32_t x=0; x<m_input_width; x+=m_stride_x)
 		{
 			for (int32_t y=0; y<m_input_height; y+=m_stride_y)
@@ -289,23 +353,11 @@ void CConvolutionalFeatureMap::convolve(
 				int32_t res_x = m_autoencoder_position == NLAP_NONE ? x/m_stride_x : x;
 				int32_t res_y = m_autoencoder_position == NLAP_NONE ? y/m_stride_y : y;
 
-				float64_t sum = reset_output ? 0 : result(res_y,res_x);
-				for (int32_t x1=x-m_radius_x; x1<=x+m_radius_x; x1++)
-				{
-					for (int32_t y1=y-m_radius_y; y1<=y+m_radius_y; y1++)
-					{
-						if (x1>=0 && y1>=0 && x1<image.num_cols && y1<image.num_rows)
-						{
-							if (flip)
-								sum +=
-									weights(y1-y+m_radius_y,x1-x+m_radius_x)*image(y1,x1);
-							else
-								sum +=
-									weights(m_radius_y-y1+y,m_radius_x-x1+x)*image(y1,x1);
-						}
-					}
-				}
-				result(res_y,res_x) = sum;
+				if (reset_output)
+					result(res_y,res_x) = conv_result[p];
+				else
+					result(res_y,res_x) += conv_result[p];
+				p++;
 			}
 		}
 	}
@@ -318,7 +370,21 @@ void CConvolutionalFeatureMap::compute_weight_gradients(
 	int32_t inputs_row_offset,
  	int32_t local_gradients_row_offset)
 {
-	weight_gradients.zero();
+	typedef Eigen::Map<Eigen::MatrixXd> EMappedMatrix;
+	typedef Eigen::Map<Eigen::VectorXd> EMappedVector;
+
+	const int32_t filter_size = m_filter_height*m_filter_width;
+	const int32_t num_positions =
+		((m_input_width+m_stride_x-1)/m_stride_x)*
+		((m_input_height+m_stride_y-1)/m_stride_y);
+
+	SGVector<float64_t> gradient_vector(num_positions);
+	SGVector<float64_t> accumulator(filter_size);
+	accumulator.zero();
+
+	EMappedVector L(gradient_vector.vector, num_positions);
+	EMappedVector A(accumulator.vector, filter_size);
+
 	for (int32_t i=0; i<local_gradients.num_cols; i++)
 	{
 		SGMatrix<float64_t> image(
@@ -329,26 +395,33 @@ void CConvolutionalFeatureMap::compute_weight_gradients(
 			local_gradients.matrix+i*local_gradients.num_rows
 			+ local_gradients_row_offset, m_output_height, m_output_width, false);
 
+		im2col(image);
+
+		/* local gradients gathered in the same position order as the
+		 * im2col columns */
+		int32_t p = 0;
 		for (int32_t x=0; x<m_input_width; x+=m_stride_x)
 		{
 			for (int32_t y=0; y<m_input_height; y+=m_stride_y)
 			{
-				for (int32_t x1=x-m_radius_x; x1<=x+m_radius_x; x1++)
-				{
-					for (int32_t y1=y-m_radius_y; y1<=y+m_radius_y; y1++)
-					{
-						if (x1>=0 && y1>=0 && x1<image.num_cols && y1<image.num_rows)
-						{
-							if (m_autoencoder_position == NLAP_NONE)
-								weight_gradients(m_radius_y-y1+y,m_radius_x-x1+x) +=
-									LG_image(y/m_stride_y,x/m_stride_x)*image(y1,x1);
-							else
-								weight_gradients(m_radius_y-y1+y,m_radius_x-x1+x) +=
-									LG_image(y,x)*image(y1,x1);
-						}
-					}
-				}
+				if (m_autoencoder_position == NLAP_NONE)
+					gradient_vector[p] = LG_image(y/m_stride_y,x/m_stride_x);
+				else
+					gradient_vector[p] = LG_image(y,x);
+				p++;
 			}
 		}
+
+		/* the gradient of every filter entry over all positions of this
+		 * image is one product of the lowered patches with the local
+		 * gradients (col2im reduces to this because each filter entry
+		 * occupies one fixed workspace row) */
+		EMappedMatrix C(m_im2col_buffer.matrix, filter_size, num_positions);
+		A.noalias() += C*L;
 	}
+
+	/* patch order runs the kernel offsets forward, so the convolution
+	 * gradient is the reversal of the accumulated products */
+	for (int32_t k=0; k<filter_size; k++)
+		weight_gradients.matrix[filter_size-1-k] = accumulator[k];
 }
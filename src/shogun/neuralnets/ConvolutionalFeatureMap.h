@@ -34,6 +34,7 @@
 #ifndef __CONVOLUTIONALFEATUREMAP_H__
 #define __CONVOLUTIONALFEATUREMAP_H__
 
+#include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/common.h>
 #include <shogun/neuralnets/NeuralLayer.h>
 
@@ -56,7 +57,6 @@ enum EConvMapActivationFunction
 };
 
 template <class T> class SGVector;
-template <class T> class SGMatrix;
 
 /** @brief Handles convolution and gradient calculation for a single feature
  * map in a convolutional neural network
@@ -170,6 +170,14 @@ protected:
 			int32_t inputs_row_offset,
  			int32_t local_gradients_row_offset);
 
+	/** Lowers one image into the im2col workspace: each column holds one
+	 * zero-padded filter-sized patch, columns ordered like the convolved
+	 * positions, so convolution and its gradients become matrix products
+	 *
+	 * @param image Input image in column major format
+	 */
+	void im2col(const SGMatrix<float64_t>& image);
+
 protected:
 	/** Width of the input */
 	int32_t m_input_width;
@@ -222,6 +230,11 @@ protected:
 	 * i.e an encoding layer or a decoding layer. Default value is NLAP_NONE
 	 */
 	ENLAutoencoderPosition m_autoencoder_position;
+
+	/** Workspace holding the im2col lowering of one image, allocated once
+	 * and reused across images and batches
+	 */
+	SGMatrix<float64_t> m_im2col_buffer;
 };
 
 }
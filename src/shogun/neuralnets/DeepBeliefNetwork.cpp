@@ -149,11 +149,25 @@ void DeepBeliefNetwork::set_batch_size(int32_t batch_size)
 
 void DeepBeliefNetwork::pre_train(std::shared_ptr<Features> features)
 {
+	auto layer_input = std::dynamic_pointer_cast<DenseFeatures<float64_t>>(features);
+	require(layer_input, "Input features must be of type DenseFeatures<float64_t>.");
+
+	// each layer's representation of the dataset is computed once, from the
+	// cached representation of the layer below, instead of re-propagating
+	// the full dataset from the visible layer for every RBM
 	for (int32_t k=0; k<m_num_layers-1; k++)
 	{
 		io::info("Pre-training RBM {}",k);
-		pre_train(k, features);
+		pre_train_rbm(k, layer_input);
 		io::info("Finished pre-training RBM {}",k);
+
+		if (k < m_num_layers-2)
+		{
+			SGMatrix<float64_t> current = layer_input->get_feature_matrix();
+			SGMatrix<float64_t> next(m_layer_sizes[k+1], current.num_cols);
+			up_step(k+1, m_params, current, next, false);
+			layer_input = std::make_shared<DenseFeatures<float64_t>>(next);
+		}
 	}
 }
 
@@ -162,6 +176,16 @@ void DeepBeliefNetwork::pre_train(int32_t index,
 {
 	auto dense_features = std::dynamic_pointer_cast<DenseFeatures<float64_t>>(features);
 	require(dense_features, "Input features must be of type DenseFeatures<float64_t>.");
+
+	if (index > 0)
+		pre_train_rbm(index, transform(features, index));
+	else
+		pre_train_rbm(index, dense_features);
+}
+
+void DeepBeliefNetwork::pre_train_rbm(int32_t index,
+	const std::shared_ptr<DenseFeatures<float64_t>>& layer_input)
+{
 	auto rbm = std::make_shared<RBM>(m_layer_sizes[index + 1]);
 	if (index == 0)
 		rbm->add_visible_group(m_layer_sizes[index], m_visible_units_type);
@@ -182,15 +206,7 @@ void DeepBeliefNetwork::pre_train(int32_t index,
 	rbm->gd_learning_rate_decay = pt_gd_learning_rate_decay[index];
 	rbm->gd_momentum = pt_gd_momentum[index];
 
-	if (index > 0)
-	{
-		auto transformed_features =
-			transform(features, index);
-		rbm->train(transformed_features);
-
-	}
-	else
-		rbm->train(features);
+	rbm->train(layer_input);
 
 	SGVector<float64_t> rbm_b = rbm->get_visible_bias();
 	SGVector<float64_t> rbm_c = rbm->get_hidden_bias();
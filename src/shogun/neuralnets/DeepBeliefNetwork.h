@@ -212,6 +212,17 @@ public:
 	const char* get_name() const override { return "DeepBeliefNetwork"; }
 
 protected:
+	/** Trains the RBM between layers index and index+1 on the given features,
+	 * which must already be the layer index's representation of the dataset,
+	 * and copies the learned parameters into the DBN.
+	 *
+	 * Used by pre_train(), which caches each layer's representation so that
+	 * the dataset is propagated through each layer only once over the whole
+	 * pre-training run
+	 */
+	virtual void pre_train_rbm(int32_t index,
+		const std::shared_ptr<DenseFeatures<float64_t>>& layer_input);
+
 	/** Computes the states of some layer using the states of the layer above it */
 	virtual void down_step(int32_t index, SGVector<float64_t> params,
 		SGMatrix<float64_t> input, SGMatrix<float64_t> result,
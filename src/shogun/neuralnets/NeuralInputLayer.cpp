@@ -60,6 +60,8 @@ NeuralInputLayer::NeuralInputLayer(int32_t width, int32_t height,
 
 void NeuralInputLayer::compute_activations(SGMatrix< float64_t > inputs)
 {
+	m_sparse = false;
+
 	if (m_start_index == 0)
 	{
 		sg_memcpy(m_activations.matrix, inputs.matrix,
@@ -80,10 +82,37 @@ void NeuralInputLayer::compute_activations(SGMatrix< float64_t > inputs)
 	}
 }
 
+void NeuralInputLayer::compute_activations(SGSparseMatrix<float64_t> inputs)
+{
+	require(m_start_index == 0, "Sparse inputs are not supported with a "
+		"non-zero start index ({})", m_start_index);
+
+	m_sparse_activations = inputs;
+	m_sparse = true;
+}
+
+void NeuralInputLayer::compute_activations_single(SGMatrix<float32_t> inputs)
+{
+	prepare_single_precision();
+
+	if (m_start_index == 0)
+	{
+		sg_memcpy(m_activations_single.matrix, inputs.matrix,
+			m_num_neurons*m_batch_size*sizeof(float32_t));
+	}
+	else
+	{
+		for (int32_t i=0; i<m_num_neurons; i++)
+			for (int32_t j=0; j<m_batch_size; j++)
+				m_activations_single(i,j) = inputs(m_start_index+i, j);
+	}
+}
+
 void NeuralInputLayer::init()
 {
 	m_start_index = 0;
 	gaussian_noise = 0;
+	m_sparse = false;
 	SG_ADD(&m_start_index, "start_index",
 	       "Start Index");
 	SG_ADD(&gaussian_noise, "gaussian_noise",
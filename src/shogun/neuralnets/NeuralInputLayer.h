@@ -35,6 +35,7 @@
 #define __NEURALINPUTLAYER_H__
 
 #include <shogun/lib/common.h>
+#include <shogun/lib/SGSparseMatrix.h>
 #include <shogun/neuralnets/NeuralLayer.h>
 
 namespace shogun
@@ -87,6 +88,42 @@ public:
 	 */
 	void compute_activations(SGMatrix<float64_t> inputs) override;
 
+	/** Takes hold of the given sparse inputs without densifying them. The
+	 * layers reading from this layer can then compute their pre-activations
+	 * directly from the non-zero entries (see
+	 * NeuralLayer::supports_sparse_inputs()). Only supported with a zero
+	 * start index, and gaussian noise is not applied in this mode
+	 *
+	 * @param inputs Sparse input features matrix, size
+	 * num_features*num_cases
+	 */
+	virtual void compute_activations(SGSparseMatrix<float64_t> inputs);
+
+	/** Returns true if the last call to compute_activations() handed the
+	 * layer sparse inputs, in which case the activations are held in
+	 * get_sparse_activations() instead of get_activations()
+	 */
+	virtual bool is_sparse() { return m_sparse; }
+
+	/** Returns the sparse inputs held by the layer, valid only when
+	 * is_sparse() returns true
+	 */
+	virtual SGSparseMatrix<float64_t> get_sparse_activations()
+	{
+		return m_sparse_activations;
+	}
+
+	/** Returns true */
+	bool supports_single_precision() override { return true; }
+
+	/** Copies inputs[start_index:start_index+num_neurons, :] into the
+	 * layer's single precision activations. Gaussian noise is not applied,
+	 * since the single precision path is used only during inference
+	 *
+	 * @param inputs Input features matrix, size num_features*num_cases
+	 */
+	void compute_activations_single(SGMatrix<float32_t> inputs) override;
+
 	/** Gets the index of the first feature that the layer connects to,
 	 * i.e the activations of the layer are copied from
 	 * input_features[start_index:start_index+num_neurons]
@@ -116,6 +153,14 @@ protected:
 	 * input_features[start_index:start_index+num_neurons]
 	 */
 	int32_t m_start_index;
+
+	/** The sparse inputs handed to the layer by the last call to
+	 * compute_activations(SGSparseMatrix<float64_t>), held without copying
+	 */
+	SGSparseMatrix<float64_t> m_sparse_activations;
+
+	/** True if the layer currently holds sparse inputs */
+	bool m_sparse;
 };
 }
 #endif
@@ -76,14 +76,89 @@ void NeuralLayer::set_batch_size(int32_t batch_size)
 {
 	m_batch_size = batch_size;
 
-	m_activations = SGMatrix<float64_t>(m_num_neurons, m_batch_size);
-	m_dropout_mask = SGMatrix<bool>(m_num_neurons, m_batch_size);
+	if (m_workspace_offset>=0 &&
+			get_workspace_size(batch_size)<=m_workspace_size)
+	{
+		// buffers are views into the layer's section of the shared
+		// workspace, no allocation takes place
+		int32_t offset = m_workspace_offset;
+
+		m_activations = SGMatrix<float64_t>(m_workspace.vector+offset,
+			m_num_neurons, m_batch_size, false);
+		offset += m_num_neurons*m_batch_size;
 
-	if (!is_input())
+		if (!is_input())
+		{
+			m_activation_gradients =
+				SGMatrix<float64_t>(m_workspace.vector+offset,
+					m_num_neurons, m_batch_size, false);
+			offset += m_num_neurons*m_batch_size;
+
+			m_local_gradients = SGMatrix<float64_t>(
+				m_workspace.vector+offset, m_num_neurons, m_batch_size,
+				false);
+		}
+	}
+	else
+	{
+		m_activations = SGMatrix<float64_t>(m_num_neurons, m_batch_size);
+
+		if (!is_input())
+		{
+			m_activation_gradients =
+				SGMatrix<float64_t>(m_num_neurons, m_batch_size);
+			m_local_gradients =
+				SGMatrix<float64_t>(m_num_neurons, m_batch_size);
+		}
+	}
+
+	if (m_dropout_mask.num_rows != m_num_neurons ||
+			m_dropout_mask.num_cols != m_batch_size)
+	{
+		m_dropout_mask = SGMatrix<bool>(m_num_neurons, m_batch_size);
+	}
+}
+
+void NeuralLayer::attach_workspace(SGVector<float64_t> workspace,
+		int32_t offset, int32_t size)
+{
+	m_workspace = workspace;
+	m_workspace_offset = offset;
+	m_workspace_size = size;
+}
+
+void NeuralLayer::release_buffers()
+{
+	m_activations = SGMatrix<float64_t>();
+	m_activation_gradients = SGMatrix<float64_t>();
+	m_local_gradients = SGMatrix<float64_t>();
+}
+
+void NeuralLayer::ensure_buffers()
+{
+	if (m_activations.num_rows != m_num_neurons ||
+			m_activations.num_cols != m_batch_size)
+	{
+		set_batch_size(m_batch_size);
+	}
+}
+
+void NeuralLayer::reapply_dropout_mask()
+{
+	if (dropout_prop==0.0) return;
+
+	int32_t len = m_num_neurons*m_batch_size;
+	for (int32_t i=0; i<len; i++)
+		m_activations[i] *= m_dropout_mask[i];
+}
+
+void NeuralLayer::prepare_single_precision()
+{
+	if (m_activations_single.num_rows != m_num_neurons ||
+			m_activations_single.num_cols != m_batch_size)
 	{
-		m_activation_gradients =
-			SGMatrix<float64_t>(m_num_neurons, m_batch_size);
-		m_local_gradients = SGMatrix<float64_t>(m_num_neurons, m_batch_size);
+		m_activations_single =
+			SGMatrix<float32_t>(m_num_neurons, m_batch_size);
 	}
 }
 
@@ -121,6 +196,8 @@ void NeuralLayer::init()
 	contraction_coefficient = 0.0;
 	is_training = false;
 	autoencoder_position = NLAP_NONE;
+	m_workspace_offset = -1;
+	m_workspace_size = 0;
 
 	SG_ADD(&m_num_neurons, "num_neurons", "Number of Neurons");
 	SG_ADD(&m_width, "width", "Width");
@@ -119,6 +119,51 @@ public:
 	 */
 	virtual void set_batch_size(int32_t batch_size);
 
+	/** Returns the number of float64 elements the layer needs in a shared
+	 * workspace for its activation and gradient buffers at the given batch
+	 * size. Used by NeuralNetwork to size the workspace it hands out via
+	 * attach_workspace()
+	 *
+	 * @param batch_size number of training/test cases
+	 */
+	virtual int32_t get_workspace_size(int32_t batch_size)
+	{
+		return is_input() ? m_num_neurons*batch_size
+			: 3*m_num_neurons*batch_size;
+	}
+
+	/** Attaches a section of a workspace shared between the layers of a
+	 * network. Subsequent calls to set_batch_size() create the activation
+	 * and gradient buffers as views into the section instead of allocating
+	 * separate matrices. If the section is too small for the requested batch
+	 * size the layer falls back to its own allocations
+	 *
+	 * @param workspace contiguous buffer owned by the network
+	 * @param offset index of the first element of this layer's section
+	 * @param size number of elements in this layer's section
+	 */
+	void attach_workspace(SGVector<float64_t> workspace, int32_t offset,
+			int32_t size);
+
+	/** Releases the activation and gradient buffers while keeping the batch
+	 * size and the dropout mask. Used by gradient checkpointing to drop the
+	 * buffers of non-checkpointed layers; ensure_buffers() brings them back
+	 */
+	virtual void release_buffers();
+
+	/** Allocates the activation and gradient buffers for the current batch
+	 * size if they have been released by release_buffers(), otherwise does
+	 * nothing
+	 */
+	virtual void ensure_buffers();
+
+	/** Multiplies the stored dropout mask into the activations. Used when
+	 * activations are recomputed during gradient checkpointing, so the
+	 * backward pass sees the same dropped units as the original forward
+	 * pass instead of drawing a fresh mask
+	 */
+	virtual void reapply_dropout_mask();
+
 	/** returns true if the layer is an input layer. Input layers are the root
 	 * layers of a network, that is, they don't receive signals from other
 	 * layers, they receive signals from the inputs features to the network.
@@ -166,6 +211,45 @@ public:
 		SGVector<float64_t> parameters,
 		const std::vector<std::shared_ptr<NeuralLayer>>& layers) { }
 
+	/** Returns true if the layer implements a single precision forward pass,
+	 * i.e the compute_activations_single() functions. Used by
+	 * NeuralNetwork::set_single_precision_inference()
+	 */
+	virtual bool supports_single_precision() { return false; }
+
+	/** Returns true if the layer can compute its activations directly from
+	 * an input layer holding sparse inputs, without the inputs being
+	 * densified first. Used by NeuralNetwork when training on or applying to
+	 * SparseFeatures
+	 */
+	virtual bool supports_sparse_inputs() { return false; }
+
+	/** Computes the activations of the neurons in this layer in single
+	 * precision, results should be stored in the matrix returned by
+	 * get_activations_single(). To be used only with input layers, and only
+	 * during inference
+	 *
+	 * @param inputs inputs to the network, matrix of size
+	 * network_num_inputs * batch_size
+	 */
+	virtual void compute_activations_single(SGMatrix<float32_t> inputs) { }
+
+	/** Computes the activations of the neurons in this layer in single
+	 * precision, reading the activations of the input layers from their
+	 * get_activations_single() matrices. Results should be stored in the
+	 * matrix returned by get_activations_single(). To be used only with
+	 * non-input layers, and only during inference
+	 *
+	 * @param parameters Vector of size get_num_parameters(), contains the
+	 * parameters of the layer cast to single precision
+	 *
+	 * @param layers Array of layers that form the network that this layer is
+	 * being used with
+	 */
+	virtual void compute_activations_single(
+		SGVector<float32_t> parameters,
+		const std::vector<std::shared_ptr<NeuralLayer>>& layers) { }
+
 	/** Computes the gradients that are relevent to this layer:
 	 *- The gradients of the error with respect to the layer's parameters
 	 * -The gradients of the error with respect to the layer's inputs
@@ -288,6 +372,17 @@ public:
 	 */
 	virtual SGMatrix<float64_t> get_activations() { return m_activations; }
 
+	/** Gets the layer's single precision activations, a matrix of size
+	 * num_neurons * batch_size. Only valid after a call to
+	 * compute_activations_single()
+	 *
+	 * @return layer's single precision activations
+	 */
+	virtual SGMatrix<float32_t> get_activations_single()
+	{
+		return m_activations_single;
+	}
+
 	/** Gets the layer's activation gradients, a matrix of size
 	 * num_neurons * batch_size
 	 *
@@ -316,6 +411,14 @@ public:
 
 	const char* get_name() const override { return "NeuralLayer"; }
 
+protected:
+	/** Allocates m_activations_single if it does not match the current layer
+	 * and batch sizes. Called by the compute_activations_single()
+	 * implementations, so the buffer only uses memory when single precision
+	 * inference is actually in use
+	 */
+	void prepare_single_precision();
+
 private:
 	void init();
 
@@ -393,6 +496,25 @@ protected:
 	 * size num_neurons * batch_size
 	 */
 	SGMatrix<bool> m_dropout_mask;
+
+	/** single precision activations of the neurons in this layer, allocated
+	 * lazily when single precision inference is used
+	 * size num_neurons * batch_size
+	 */
+	SGMatrix<float32_t> m_activations_single;
+
+	/** workspace shared between the layers of a network, empty if the layer
+	 * manages its own buffers
+	 */
+	SGVector<float64_t> m_workspace;
+
+	/** index of the first element of this layer's workspace section, -1 if
+	 * no workspace is attached
+	 */
+	int32_t m_workspace_offset;
+
+	/** number of elements in this layer's workspace section */
+	int32_t m_workspace_size;
 };
 
 }
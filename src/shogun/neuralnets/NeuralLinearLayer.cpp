@@ -32,6 +32,7 @@
  */
 
 #include <shogun/neuralnets/NeuralLinearLayer.h>
+#include <shogun/neuralnets/NeuralInputLayer.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/lib/SGVector.h>
 
@@ -98,7 +99,61 @@ void NeuralLinearLayer::compute_activations(
 		weights_index_offset += m_num_neurons*layer->get_num_neurons();
 
 		EMappedMatrix W(weights, m_num_neurons, layer->get_num_neurons());
-		EMappedMatrix X(layer->get_activations().matrix,
+
+		auto input_layer = layer->is_input() ?
+			std::dynamic_pointer_cast<NeuralInputLayer>(layer) : nullptr;
+
+		if (input_layer && input_layer->is_sparse())
+		{
+			// A += W*X computed column by column from the non-zero entries
+			// of X, without densifying it
+			SGSparseMatrix<float64_t> X =
+				input_layer->get_sparse_activations();
+
+			for (int32_t j=0; j<m_batch_size; j++)
+			{
+				const SGSparseVector<float64_t>& x = X[j];
+				for (int32_t n=0; n<x.num_feat_entries; n++)
+					A.col(j) +=
+						x.features[n].entry*W.col(x.features[n].feat_index);
+			}
+		}
+		else
+		{
+			EMappedMatrix X(layer->get_activations().matrix,
+					layer->get_num_neurons(), m_batch_size);
+
+			A += W*X;
+		}
+	}
+}
+
+void NeuralLinearLayer::compute_activations_single(
+    SGVector<float32_t> parameters,
+    const std::vector<std::shared_ptr<NeuralLayer>>& layers)
+{
+	prepare_single_precision();
+
+	float32_t* biases = parameters.vector;
+
+	typedef Eigen::Map<Eigen::MatrixXf> EMappedMatrix;
+	typedef Eigen::Map<Eigen::VectorXf> EMappedVector;
+
+	EMappedMatrix  A(m_activations_single.matrix, m_num_neurons, m_batch_size);
+	EMappedVector  B(biases, m_num_neurons);
+
+	A.colwise() = B;
+
+	int32_t weights_index_offset = m_num_neurons;
+	for (int32_t l=0; l<m_input_indices.vlen; l++)
+	{
+		auto& layer = layers[m_input_indices[l]];
+
+		float32_t* weights = parameters.vector + weights_index_offset;
+		weights_index_offset += m_num_neurons*layer->get_num_neurons();
+
+		EMappedMatrix W(weights, m_num_neurons, layer->get_num_neurons());
+		EMappedMatrix X(layer->get_activations_single().matrix,
 				layer->get_num_neurons(), m_batch_size);
 
 		A += W*X;
@@ -143,21 +198,43 @@ void NeuralLinearLayer::compute_gradients(
 
 		weights_index_offset += m_num_neurons*layer->get_num_neurons();
 
-		EMappedMatrix X(layer->get_activations().matrix,
-				layer->get_num_neurons(), m_batch_size);
 		EMappedMatrix  W(weights, m_num_neurons, layer->get_num_neurons());
 		EMappedMatrix WG(weight_gradients,
 				m_num_neurons, layer->get_num_neurons());
-		EMappedMatrix  IG(layer->get_activation_gradients().matrix,
-				layer->get_num_neurons(), m_batch_size);
 
-		// compute weight gradients
-		WG = LG*X.transpose();
+		auto input_layer = layer->is_input() ?
+			std::dynamic_pointer_cast<NeuralInputLayer>(layer) : nullptr;
+
+		if (input_layer && input_layer->is_sparse())
+		{
+			// WG = LG*X^T accumulated from the non-zero entries of X. No
+			// input gradients are needed since X belongs to an input layer
+			SGSparseMatrix<float64_t> X =
+				input_layer->get_sparse_activations();
+
+			WG.setZero();
+			for (int32_t j=0; j<m_batch_size; j++)
+			{
+				const SGSparseVector<float64_t>& x = X[j];
+				for (int32_t n=0; n<x.num_feat_entries; n++)
+					WG.col(x.features[n].feat_index) +=
+						x.features[n].entry*LG.col(j);
+			}
+		}
+		else
+		{
+			EMappedMatrix X(layer->get_activations().matrix,
+					layer->get_num_neurons(), m_batch_size);
+			EMappedMatrix  IG(layer->get_activation_gradients().matrix,
+					layer->get_num_neurons(), m_batch_size);
 
-		// compute input gradients
-		if (!layer->is_input())
-			IG += W.transpose()*LG;
+			// compute weight gradients
+			WG = LG*X.transpose();
 
+			// compute input gradients
+			if (!layer->is_input())
+				IG += W.transpose()*LG;
+		}
 	}
 
 	if (contraction_coefficient != 0)
@@ -117,6 +117,28 @@ public:
 	void compute_activations(SGVector<float64_t> parameters,
 			const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
 
+	/** Returns true */
+	bool supports_single_precision() override { return true; }
+
+	/** Returns true: when an input layer holds sparse inputs, the layer's
+	 * pre-activations and weight gradients are computed directly from the
+	 * non-zero entries via a sparse-dense product
+	 */
+	bool supports_sparse_inputs() override { return true; }
+
+	/** Computes the activations of the neurons in this layer in single
+	 * precision, results are stored in the matrix returned by
+	 * get_activations_single(). To be used only during inference
+	 *
+	 * @param parameters Vector of size get_num_parameters(), contains the
+	 * parameters of the layer cast to single precision
+	 *
+	 * @param layers Array of layers that form the network that this layer is
+	 * being used with
+	 */
+	void compute_activations_single(SGVector<float32_t> parameters,
+			const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
+
 	/** Computes the gradients that are relevent to this layer:
 	 *- The gradients of the error with respect to the layer's parameters
 	 * -The gradients of the error with respect to the layer's inputs
@@ -58,6 +58,21 @@ void NeuralLogisticLayer::compute_activations(
 		m_activations[i] = 1.0 / (1.0 + std::exp(-1.0 * m_activations[i]));
 }
 
+void NeuralLogisticLayer::compute_activations_single(
+    SGVector<float32_t> parameters,
+    const std::vector<std::shared_ptr<NeuralLayer>>& layers)
+{
+	NeuralLinearLayer::compute_activations_single(parameters, layers);
+
+	// apply logistic activation function
+	int32_t length = m_num_neurons*m_batch_size;
+	for (int32_t i=0; i<length; i++)
+	{
+		m_activations_single[i] =
+			1.0f / (1.0f + std::exp(-1.0f * m_activations_single[i]));
+	}
+}
+
 float64_t NeuralLogisticLayer::compute_contraction_term(
 	SGVector< float64_t > parameters)
 {
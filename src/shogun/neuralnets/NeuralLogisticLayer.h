@@ -73,6 +73,19 @@ public:
 		SGVector<float64_t> parameters,
 		const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
 
+	/** Computes the activations of the neurons in this layer in single
+	 * precision, results are stored in the matrix returned by
+	 * get_activations_single(). To be used only during inference
+	 *
+	 * @param parameters Vector of size get_num_parameters(), contains the
+	 * parameters of the layer cast to single precision
+	 *
+	 * @param layers Array of layers that form the network that this layer is
+	 * being used with
+	 */
+	void compute_activations_single(SGVector<float32_t> parameters,
+			const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
+
 	/** Computes
 	 * \f[ \frac{\lambda}{N} \sum_{k=0}^{N-1} \left \| J(x_k) \right \|^2_F \f]
 	 * where \f$ \left \| J(x_k)) \right \|^2_F \f$ is the Frobenius norm of
@@ -33,9 +33,12 @@
 
 #include <shogun/base/progress.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
 #include <shogun/mathematics/UniformRealDistribution.h>
+#include <shogun/neuralnets/NeuralInputLayer.h>
 #include <shogun/neuralnets/NeuralLayer.h>
 #include <shogun/neuralnets/NeuralNetwork.h>
 #include <shogun/optimization/lbfgs/lbfgs.h>
@@ -153,6 +156,8 @@ void NeuralNetwork::initialize_neural_network(float64_t sigma)
 
 		get_layer(i)->set_batch_size(m_batch_size);
 	}
+
+	m_params_single_valid = false;
 }
 
 NeuralNetwork::~NeuralNetwork()
@@ -242,7 +247,20 @@ bool NeuralNetwork::train_machine(std::shared_ptr<Features> data)
 	require(m_max_num_epochs>=0,
 		"Maximum number of epochs ({}) must be >= 0", m_max_num_epochs);
 
-	SGMatrix<float64_t> inputs = features_to_matrix(data);
+	bool sparse = data != NULL && data->get_feature_class() == C_SPARSE;
+
+	SGMatrix<float64_t> inputs;
+	SGSparseMatrix<float64_t> sparse_inputs;
+	if (sparse)
+	{
+		require(m_optimization_method==NNOM_GRADIENT_DESCENT,
+			"Training on sparse features is only supported with gradient "
+			"descent");
+		sparse_inputs = features_to_sparse_matrix(data);
+	}
+	else
+		inputs = features_to_matrix(data);
+
 	SGMatrix<float64_t> targets = labels_to_matrix(m_labels);
 
 	for (int32_t i=0; i<m_num_layers-1; i++)
@@ -258,13 +276,15 @@ bool NeuralNetwork::train_machine(std::shared_ptr<Features> data)
 
 	bool result = false;
 	if (m_optimization_method==NNOM_GRADIENT_DESCENT)
-		result = train_gradient_descent(inputs, targets);
+		result = sparse ? train_gradient_descent(sparse_inputs, targets)
+			: train_gradient_descent(inputs, targets);
 	else if (m_optimization_method==NNOM_LBFGS)
 		result = train_lbfgs(inputs, targets);
 
 	for (int32_t i=0; i<m_num_layers; i++)
 		get_layer(i)->is_training = false;
 	m_is_training = false;
+	m_params_single_valid = false;
 
 	return result;
 }
@@ -313,53 +333,283 @@ bool NeuralNetwork::train_gradient_descent(SGMatrix<float64_t> inputs,
 			SGMatrix<float64_t> inputs_batch(inputs.matrix+j*m_num_inputs,
 				m_num_inputs, m_gd_mini_batch_size, false);
 
-			for (int32_t k=0; k<n_param; k++)
-				m_params[k] += m_gd_momentum*param_updates[k];
+			if (gd_step(inputs_batch, targets_batch, gradients, param_updates,
+					alpha, c, error, error_last_time, i))
+			{
+				continue_training = false;
+				break;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool NeuralNetwork::train_gradient_descent(SGSparseMatrix<float64_t> inputs,
+		SGMatrix<float64_t> targets)
+{
+	require(m_gd_learning_rate>0,
+		"Gradient descent learning rate ({}) must be > 0", m_gd_learning_rate);
+	require(m_gd_momentum>=0,
+		"Gradient descent momentum ({}) must be >= 0", m_gd_momentum);
+
+	int32_t training_set_size = inputs.num_vectors;
+	if (m_gd_mini_batch_size==0) m_gd_mini_batch_size = training_set_size;
+	set_batch_size(m_gd_mini_batch_size);
+
+	int32_t n_param = get_num_parameters();
+	SGVector<float64_t> gradients(n_param);
+
+	// needed for momentum
+	SGVector<float64_t> param_updates(n_param);
+	param_updates.zero();
+
+	float64_t error_last_time = -1.0, error = -1.0;
+
+	float64_t c = m_gd_error_damping_coeff;
+	if (c==-1.0)
+		c = 0.99*(float64_t)m_gd_mini_batch_size/training_set_size + 1e-2;
+
+	bool continue_training = true;
+	float64_t alpha = m_gd_learning_rate;
+
+	for (auto i : SG_PROGRESS(
+	         range(0, m_max_num_epochs), [&] { return continue_training; }))
+	{
+		for (int32_t j=0; j < training_set_size; j += m_gd_mini_batch_size)
+		{
+			alpha = m_gd_learning_rate_decay*alpha;
+
+			if (j+m_gd_mini_batch_size>training_set_size)
+				j = training_set_size-m_gd_mini_batch_size;
 
-			float64_t e = compute_gradients(inputs_batch, targets_batch, gradients);
+			SGMatrix<float64_t> targets_batch(targets.matrix+j*get_num_outputs(),
+				get_num_outputs(), m_gd_mini_batch_size, false);
 
+			// a view over the mini-batch's columns, no copying takes place
+			SGSparseMatrix<float64_t> inputs_batch(inputs.sparse_matrix+j,
+				m_num_inputs, m_gd_mini_batch_size, false);
 
-			for (int32_t k=0; k<m_num_layers; k++)
+			if (gd_step(inputs_batch, targets_batch, gradients, param_updates,
+					alpha, c, error, error_last_time, i))
 			{
-				SGVector<float64_t> layer_gradients = get_section(gradients, k);
-				if (layer_gradients.vlen > 0)
-				{
-					io::info("Layer {} ({}), Max Gradient: {:g}, Mean Gradient: {:g}.", k,get_layer(k)->get_name(),
-						Math::max(layer_gradients.vector, layer_gradients.vlen),
-						SGVector<float64_t>::sum(layer_gradients.vector, layer_gradients.vlen)/layer_gradients.vlen);
-				}
+				continue_training = false;
+				break;
 			}
+		}
+	}
 
-			// filter the errors
-			if (error==-1.0)
-				error = e;
-			else
-				error = (1.0-c) * error + c*e;
+	return true;
+}
 
-			for (int32_t k=0; k<n_param; k++)
-			{
-				param_updates[k] = m_gd_momentum*param_updates[k]
-						-alpha*gradients[k];
+bool NeuralNetwork::gd_step(SGMatrix<float64_t> inputs_batch,
+		SGMatrix<float64_t> targets_batch, SGVector<float64_t> gradients,
+		SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+		float64_t& error, float64_t& error_last_time, int32_t iter)
+{
+	int32_t n_param = get_num_parameters();
 
-				m_params[k] -= alpha*gradients[k];
-			}
+	for (int32_t k=0; k<n_param; k++)
+		m_params[k] += m_gd_momentum*param_updates[k];
 
-			if (error_last_time!=-1.0)
-			{
-				float64_t error_change = (error_last_time-error)/error;
-				if (error_change< m_epsilon && error_change>=0)
-				{
-					io::info("Gradient Descent Optimization Converged");
-					continue_training = false;
-					break;
-				}
+	float64_t e = compute_gradients(inputs_batch, targets_batch, gradients);
 
-				io::info("Epoch {}: Error = {}",i, error);
-			}
-			error_last_time = error;
+	return gd_update(gradients, param_updates, alpha, c, e, error,
+		error_last_time, iter);
+}
+
+bool NeuralNetwork::gd_step(SGSparseMatrix<float64_t> inputs_batch,
+		SGMatrix<float64_t> targets_batch, SGVector<float64_t> gradients,
+		SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+		float64_t& error, float64_t& error_last_time, int32_t iter)
+{
+	int32_t n_param = get_num_parameters();
+
+	for (int32_t k=0; k<n_param; k++)
+		m_params[k] += m_gd_momentum*param_updates[k];
+
+	float64_t e = compute_gradients(inputs_batch, targets_batch, gradients);
+
+	return gd_update(gradients, param_updates, alpha, c, e, error,
+		error_last_time, iter);
+}
+
+bool NeuralNetwork::gd_update(SGVector<float64_t> gradients,
+		SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+		float64_t e, float64_t& error, float64_t& error_last_time,
+		int32_t iter)
+{
+	int32_t n_param = get_num_parameters();
+
+	for (int32_t k=0; k<m_num_layers; k++)
+	{
+		SGVector<float64_t> layer_gradients = get_section(gradients, k);
+		if (layer_gradients.vlen > 0)
+		{
+			io::info("Layer {} ({}), Max Gradient: {:g}, Mean Gradient: {:g}.", k,get_layer(k)->get_name(),
+				Math::max(layer_gradients.vector, layer_gradients.vlen),
+				SGVector<float64_t>::sum(layer_gradients.vector, layer_gradients.vlen)/layer_gradients.vlen);
 		}
 	}
 
+	// filter the errors
+	if (error==-1.0)
+		error = e;
+	else
+		error = (1.0-c) * error + c*e;
+
+	for (int32_t k=0; k<n_param; k++)
+	{
+		param_updates[k] = m_gd_momentum*param_updates[k]
+				-alpha*gradients[k];
+
+		m_params[k] -= alpha*gradients[k];
+	}
+
+	bool converged = false;
+	if (error_last_time!=-1.0)
+	{
+		float64_t error_change = (error_last_time-error)/error;
+		if (error_change< m_epsilon && error_change>=0)
+		{
+			io::info("Gradient Descent Optimization Converged");
+			converged = true;
+		}
+		else
+			io::info("Epoch {}: Error = {}",iter, error);
+	}
+	error_last_time = error;
+
+	return converged;
+}
+
+bool NeuralNetwork::train_on_stream(
+		const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream)
+{
+	require(stream, "Invalid (NULL) streaming features pointer");
+	require(stream->get_has_labels(),
+		"Streaming features must be labelled for training");
+	require(m_gd_mini_batch_size>0, "Mini-batch size ({}) must be > 0 for "
+		"streaming training, since the size of the data set is not known in "
+		"advance", m_gd_mini_batch_size);
+	require(m_gd_learning_rate>0,
+		"Gradient descent learning rate ({}) must be > 0", m_gd_learning_rate);
+	require(m_gd_momentum>=0,
+		"Gradient descent momentum ({}) must be >= 0", m_gd_momentum);
+
+	if (m_auto_quick_initialize)
+	{
+		quick_connect();
+		initialize_neural_network(m_sigma);
+	}
+
+	for (int32_t i=0; i<m_num_layers-1; i++)
+	{
+		get_layer(i)->dropout_prop =
+			get_layer(i)->is_input() ? m_dropout_input : m_dropout_hidden;
+	}
+	get_layer(m_num_layers-1)->dropout_prop = 0.0;
+
+	m_is_training = true;
+	for (int32_t i=0; i<m_num_layers; i++)
+		get_layer(i)->is_training = true;
+
+	set_batch_size(m_gd_mini_batch_size);
+
+	int32_t n_param = get_num_parameters();
+	SGVector<float64_t> gradients(n_param);
+
+	// needed for momentum
+	SGVector<float64_t> param_updates(n_param);
+	param_updates.zero();
+
+	float64_t error_last_time = -1.0, error = -1.0;
+
+	// the training set size is unknown in advance, so the automatic damping
+	// coefficient falls back to the lower bound of the in-memory formula
+	float64_t c = m_gd_error_damping_coeff;
+	if (c==-1.0)
+		c = 1e-2;
+
+	float64_t alpha = m_gd_learning_rate;
+
+	// the current mini-batch is assembled here while the stream's parser
+	// thread reads the following examples ahead into its example ring
+	SGMatrix<float64_t> inputs_batch(m_num_inputs, m_gd_mini_batch_size);
+	SGMatrix<float64_t> targets_batch(get_num_outputs(), m_gd_mini_batch_size);
+	targets_batch.zero();
+
+	int32_t num_in_batch = 0;
+	int32_t batch_counter = 0;
+	bool converged = false;
+
+	stream->start_parser();
+	while (stream->get_next_example())
+	{
+		SGVector<float64_t> v = stream->get_vector();
+		require(v.vlen==m_num_inputs, "Streamed example dimension ({}) must "
+			"match the network's number of inputs ({})", v.vlen, m_num_inputs);
+
+		sg_memcpy(inputs_batch.matrix+num_in_batch*m_num_inputs, v.vector,
+			m_num_inputs*sizeof(float64_t));
+
+		float64_t label = stream->get_label();
+		if (get_num_outputs()>1)
+		{
+			int32_t label_index = (int32_t)label;
+			require(label_index>=0 && label_index<get_num_outputs(),
+				"Streamed label ({}) must be a class index less than the "
+				"network's number of outputs ({})", label, get_num_outputs());
+			targets_batch(label_index, num_in_batch) = 1.0;
+		}
+		else
+			targets_batch(0, num_in_batch) = label;
+
+		stream->release_example();
+
+		if (++num_in_batch < m_gd_mini_batch_size)
+			continue;
+
+		alpha = m_gd_learning_rate_decay*alpha;
+
+		converged = gd_step(inputs_batch, targets_batch, gradients,
+			param_updates, alpha, c, error, error_last_time, batch_counter);
+
+		num_in_batch = 0;
+		batch_counter++;
+		if (get_num_outputs()>1)
+			targets_batch.zero();
+
+		if (converged)
+			break;
+	}
+
+	if (converged)
+	{
+		// drain whatever the parser thread read ahead so it can terminate
+		while (stream->get_next_example())
+			stream->release_example();
+	}
+	else if (num_in_batch>0)
+	{
+		// trailing examples that do not fill a complete mini-batch
+		set_batch_size(num_in_batch);
+		SGMatrix<float64_t> inputs_tail(inputs_batch.matrix, m_num_inputs,
+			num_in_batch, false);
+		SGMatrix<float64_t> targets_tail(targets_batch.matrix,
+			get_num_outputs(), num_in_batch, false);
+
+		alpha = m_gd_learning_rate_decay*alpha;
+		gd_step(inputs_tail, targets_tail, gradients, param_updates, alpha,
+			c, error, error_last_time, batch_counter);
+	}
+	stream->end_parser();
+
+	for (int32_t i=0; i<m_num_layers; i++)
+		get_layer(i)->is_training = false;
+	m_is_training = false;
+	m_params_single_valid = false;
+
 	return true;
 }
 
@@ -447,6 +697,14 @@ int NeuralNetwork::lbfgs_progress(void* instance,
 
 SGMatrix<float64_t> NeuralNetwork::forward_propagate(std::shared_ptr<Features> data, int32_t j)
 {
+	if (data != NULL && data->get_feature_class() == C_SPARSE)
+	{
+		SGSparseMatrix<float64_t> sparse_inputs =
+			features_to_sparse_matrix(data);
+		set_batch_size(data->get_num_vectors());
+		return forward_propagate(sparse_inputs, j);
+	}
+
 	SGMatrix<float64_t> inputs = features_to_matrix(data);
 	set_batch_size(data->get_num_vectors());
 	return forward_propagate(inputs, j);
@@ -458,10 +716,28 @@ SGMatrix<float64_t> NeuralNetwork::forward_propagate(
 	if (j==-1)
 		j = m_num_layers-1;
 
+	if (m_single_precision_inference && !m_is_training)
+	{
+		bool supported = true;
+		for (int32_t i=0; i<=j && supported; i++)
+			supported = get_layer(i)->supports_single_precision();
+
+		if (supported)
+			return forward_propagate_single(inputs, j);
+
+		io::warn("Single precision inference is enabled, but not all layers "
+			"implement a single precision forward pass. Falling back to "
+			"double precision");
+	}
+
 	for (int32_t i=0; i<=j; i++)
 	{
 		auto layer = get_layer(i);
 
+		// a preceding checkpointed backward pass may have released this
+		// layer's buffers
+		layer->ensure_buffers();
+
 		if (layer->is_input())
 			layer->compute_activations(inputs);
 		else
@@ -473,11 +749,146 @@ SGMatrix<float64_t> NeuralNetwork::forward_propagate(
 	return get_layer(j)->get_activations();
 }
 
+SGMatrix<float64_t> NeuralNetwork::forward_propagate_single(
+	SGMatrix<float64_t> inputs, int32_t j)
+{
+	if (j==-1)
+		j = m_num_layers-1;
+
+	// the packed single precision parameters are kept across calls and
+	// refreshed only after initialization or training changes m_params
+	if (m_params_single.vlen != m_total_num_parameters)
+	{
+		m_params_single = SGVector<float32_t>(m_total_num_parameters);
+		m_params_single_valid = false;
+	}
+
+	if (!m_params_single_valid)
+	{
+		for (int32_t i=0; i<m_total_num_parameters; i++)
+			m_params_single[i] = (float32_t)m_params[i];
+		m_params_single_valid = true;
+	}
+
+	if (m_inputs_single.num_rows != inputs.num_rows ||
+			m_inputs_single.num_cols != inputs.num_cols)
+	{
+		m_inputs_single = SGMatrix<float32_t>(inputs.num_rows,
+			inputs.num_cols);
+	}
+
+	SGMatrix<float32_t> inputs_single = m_inputs_single;
+	int32_t inputs_len = inputs.num_rows*inputs.num_cols;
+	for (int32_t i=0; i<inputs_len; i++)
+		inputs_single[i] = (float32_t)inputs[i];
+
+	for (int32_t i=0; i<=j; i++)
+	{
+		auto layer = get_layer(i);
+
+		if (layer->is_input())
+			layer->compute_activations_single(inputs_single);
+		else
+			layer->compute_activations_single(
+				get_section(m_params_single, i), m_layers);
+
+		// compensate for dropout being used during training, same as
+		// NeuralLayer::dropout_activations() outside of training
+		if (layer->dropout_prop>0.0)
+		{
+			SGMatrix<float32_t> activations = layer->get_activations_single();
+			int32_t len = activations.num_rows*activations.num_cols;
+			for (int32_t k=0; k<len; k++)
+				activations[k] *= (float32_t)(1.0-layer->dropout_prop);
+		}
+	}
+
+	// results are handed back in double precision, so callers are unaffected
+	SGMatrix<float32_t> output = get_layer(j)->get_activations_single();
+	if (m_outputs_single_to_double.num_rows != output.num_rows ||
+			m_outputs_single_to_double.num_cols != output.num_cols)
+	{
+		m_outputs_single_to_double =
+			SGMatrix<float64_t>(output.num_rows, output.num_cols);
+	}
+
+	int32_t output_len = output.num_rows*output.num_cols;
+	for (int32_t i=0; i<output_len; i++)
+		m_outputs_single_to_double[i] = output[i];
+
+	return m_outputs_single_to_double;
+}
+
+SGMatrix<float64_t> NeuralNetwork::forward_propagate(
+	SGSparseMatrix<float64_t> inputs, int32_t j)
+{
+	if (j==-1)
+		j = m_num_layers-1;
+
+	for (int32_t i=0; i<=j; i++)
+	{
+		auto layer = get_layer(i);
+		layer->ensure_buffers();
+
+		if (layer->is_input())
+		{
+			auto input_layer =
+				std::dynamic_pointer_cast<NeuralInputLayer>(layer);
+			require(input_layer, "Layer {} ({}) is an input layer but not a "
+				"NeuralInputLayer, sparse inputs are not supported",
+				i, layer->get_name());
+
+			input_layer->compute_activations(inputs);
+		}
+		else
+		{
+			// layers reading from a sparse input layer must compute their
+			// pre-activations from the non-zero entries themselves
+			SGVector<int32_t> input_indices = layer->get_input_indices();
+			for (int32_t l=0; l<input_indices.vlen; l++)
+			{
+				if (get_layer(input_indices[l])->is_input())
+					require(layer->supports_sparse_inputs(),
+						"Layer {} ({}) reads from an input layer but does "
+						"not support sparse inputs", i, layer->get_name());
+			}
+
+			layer->compute_activations(get_section(m_params, i), m_layers);
+		}
+
+		layer->dropout_activations();
+	}
+
+	return get_layer(j)->get_activations();
+}
+
 float64_t NeuralNetwork::compute_gradients(SGMatrix<float64_t> inputs,
 		SGMatrix<float64_t> targets, SGVector<float64_t> gradients)
+{
+	if (m_checkpoint_interval > 0)
+	{
+		if (checkpointing_applicable())
+			return compute_gradients_checkpointed(inputs, targets, gradients);
+
+		io::warn("Gradient checkpointing is enabled, but the network is not "
+			"a simple chain of layers without contraction terms. Falling "
+			"back to the standard backward pass");
+	}
+
+	forward_propagate(inputs);
+	return backpropagate(targets, gradients);
+}
+
+float64_t NeuralNetwork::compute_gradients(SGSparseMatrix<float64_t> inputs,
+		SGMatrix<float64_t> targets, SGVector<float64_t> gradients)
 {
 	forward_propagate(inputs);
+	return backpropagate(targets, gradients);
+}
 
+float64_t NeuralNetwork::backpropagate(SGMatrix<float64_t> targets,
+		SGVector<float64_t> gradients)
+{
 	for (int32_t i=0; i<m_num_layers; i++)
 	{
 		if (!get_layer(i)->is_input())
@@ -528,6 +939,138 @@ float64_t NeuralNetwork::compute_gradients(SGMatrix<float64_t> inputs,
 	return compute_error(targets);
 }
 
+bool NeuralNetwork::checkpointing_applicable() const
+{
+	if (!m_layers[0]->is_input())
+		return false;
+
+	for (int32_t i=0; i<m_num_layers; i++)
+	{
+		// contractive error terms read the hidden activations after the
+		// backward pass, which checkpointing releases
+		if (m_layers[i]->contraction_coefficient != 0.0)
+			return false;
+
+		if (i==0)
+			continue;
+
+		if (m_layers[i]->is_input())
+			return false;
+
+		SGVector<int32_t> input_indices = m_layers[i]->get_input_indices();
+		if (input_indices.vlen != 1 || input_indices[0] != i-1)
+			return false;
+	}
+
+	return true;
+}
+
+float64_t NeuralNetwork::compute_gradients_checkpointed(
+		SGMatrix<float64_t> inputs, SGMatrix<float64_t> targets,
+		SGVector<float64_t> gradients)
+{
+	int32_t k = m_checkpoint_interval;
+	int32_t last = m_num_layers-1;
+
+	// forward pass that only keeps the activations of every k-th layer and
+	// of the output layer. Each interior layer's activations are dropped as
+	// soon as the layer above has consumed them
+	for (int32_t i=0; i<m_num_layers; i++)
+	{
+		auto layer = get_layer(i);
+		layer->ensure_buffers();
+
+		if (layer->is_input())
+			layer->compute_activations(inputs);
+		else
+			layer->compute_activations(get_section(m_params, i), m_layers);
+
+		layer->dropout_activations();
+
+		if (i>1 && (i-1)%k!=0)
+			get_layer(i-1)->release_buffers();
+	}
+
+	// the output layer's activations are released during the backward pass,
+	// so the error has to be computed up front
+	float64_t error = compute_error(targets);
+
+	// backward pass over one segment at a time: recompute the activations
+	// between two checkpoints, backpropagate through the segment, release it
+	int32_t seg_end = last;
+	while (seg_end > 0)
+	{
+		int32_t seg_start = ((seg_end-1)/k)*k;
+
+		for (int32_t i=seg_start+1; i<seg_end; i++)
+		{
+			auto layer = get_layer(i);
+			layer->ensure_buffers();
+			layer->compute_activations(get_section(m_params, i), m_layers);
+
+			// reuse the mask drawn during the original forward pass so that
+			// the recomputed activations match it exactly
+			layer->reapply_dropout_mask();
+		}
+
+		// seg_end's activation gradients are left alone, they hold the
+		// contribution accumulated while processing the segment above
+		for (int32_t i=seg_start; i<seg_end; i++)
+		{
+			if (!get_layer(i)->is_input())
+				get_layer(i)->get_activation_gradients().zero();
+		}
+
+		for (int32_t i=seg_end; i>seg_start; i--)
+		{
+			if (i==last)
+				get_layer(i)->compute_gradients(get_section(m_params,i),
+					targets, m_layers, get_section(gradients,i));
+			else
+				get_layer(i)->compute_gradients(get_section(m_params,i),
+					SGMatrix<float64_t>(), m_layers, get_section(gradients,i));
+		}
+
+		for (int32_t i=seg_start+1; i<=seg_end; i++)
+			get_layer(i)->release_buffers();
+
+		seg_end = seg_start;
+	}
+
+	// L2 regularization
+	if (m_l2_coefficient != 0.0)
+	{
+		for (int32_t i=0; i<m_total_num_parameters; i++)
+		{
+			if (m_param_regularizable[i])
+				gradients[i] += m_l2_coefficient*m_params[i];
+		}
+	}
+
+	// L1 regularization
+	if (m_l1_coefficient != 0.0)
+	{
+		for (int32_t i=0; i<m_total_num_parameters; i++)
+		{
+			if (m_param_regularizable[i])
+				gradients[i] +=
+					m_l1_coefficient*Math::sign<float64_t>(m_params[i]);
+		}
+	}
+
+	// max-norm regularization
+	if (m_max_norm != -1.0)
+	{
+		for (int32_t i=0; i<m_num_layers; i++)
+		{
+			SGVector<float64_t> layer_params = get_section(m_params,i);
+			get_layer(i)->enforce_max_norm(layer_params, m_max_norm);
+		}
+	}
+
+	return error;
+}
+
 float64_t NeuralNetwork::compute_error(SGMatrix<float64_t> targets)
 {
 	float64_t error = get_layer(m_num_layers-1)->compute_error(targets);
@@ -616,8 +1159,46 @@ void NeuralNetwork::set_batch_size(int32_t batch_size)
 	if (batch_size!=m_batch_size)
 	{
 		m_batch_size = batch_size;
+
+		if (m_checkpoint_interval>0 && checkpointing_applicable())
+		{
+			// under checkpointing each layer allocates its buffers on demand
+			// and frees them once its segment has been backpropagated, so
+			// the layers are not tied to the shared workspace. Only the
+			// checkpoint layers and the output layer keep their buffers
+			for (int32_t i=0; i<m_num_layers; i++)
+			{
+				get_layer(i)->attach_workspace(SGVector<float64_t>(), -1, 0);
+				get_layer(i)->set_batch_size(m_batch_size);
+
+				if (i>0 && i%m_checkpoint_interval!=0 && i!=m_num_layers-1)
+					get_layer(i)->release_buffers();
+			}
+
+			return;
+		}
+
+		// hand each layer a section of one contiguous workspace, so that
+		// adjacent layers' buffers are adjacent in memory. The workspace
+		// only grows, so it is allocated once for the largest batch seen
+		// and reused when the batch shrinks again (e.g. between mini-batch
+		// training and full-set inference)
+		int32_t total_size = 0;
+		for (int32_t i=0; i<m_num_layers; i++)
+			total_size += get_layer(i)->get_workspace_size(m_batch_size);
+
+		if (m_workspace.vlen < total_size)
+			m_workspace = SGVector<float64_t>(total_size);
+
+		int32_t offset = 0;
 		for (int32_t i=0; i<m_num_layers; i++)
+		{
+			int32_t size = get_layer(i)->get_workspace_size(m_batch_size);
+			get_layer(i)->attach_workspace(m_workspace, offset, size);
+			offset += size;
+
 			get_layer(i)->set_batch_size(m_batch_size);
+		}
 	}
 }
 
@@ -637,6 +1218,23 @@ SGMatrix<float64_t> NeuralNetwork::features_to_matrix(const std::shared_ptr<Feat
 	return inputs->get_feature_matrix();
 }
 
+SGSparseMatrix<float64_t> NeuralNetwork::features_to_sparse_matrix(
+	const std::shared_ptr<Features>& features)
+{
+	require(features != NULL, "Invalid (NULL) feature pointer");
+	require(features->get_feature_type() == F_DREAL,
+		"Feature type must be F_DREAL");
+	require(features->get_feature_class() == C_SPARSE,
+		"Feature class must be C_SPARSE");
+
+	auto inputs = features->as<SparseFeatures<float64_t>>();
+	require(inputs->get_num_features()==m_num_inputs,
+		"Number of features ({}) must match the network's number of inputs "
+		"({})", inputs->get_num_features(), get_num_inputs());
+
+	return inputs->get_sparse_feature_matrix();
+}
+
 SGMatrix<float64_t> NeuralNetwork::labels_to_matrix(const std::shared_ptr<Labels>& labs)
 {
 	require(labs != NULL, "Invalid (NULL) labels pointer");
@@ -786,6 +1384,9 @@ void NeuralNetwork::init()
 	m_is_training = false;
 	m_auto_quick_initialize = true;
 	m_sigma = 0.01f;
+	m_single_precision_inference = false;
+	m_params_single_valid = false;
+	m_checkpoint_interval = 0;
 	m_layers.clear();
 
 	SG_ADD_OPTIONS(
@@ -832,6 +1433,12 @@ void NeuralNetwork::init()
 	    "auto_quick_initialize");
 	SG_ADD(&m_is_training, "is_training", "is_training");
 	SG_ADD(&m_sigma, "sigma", "sigma");
+	SG_ADD(
+	    &m_single_precision_inference, "single_precision_inference",
+	    "Single precision inference");
+	SG_ADD(
+	    &m_checkpoint_interval, "checkpoint_interval",
+	    "Gradient checkpointing interval");
 
 	watch_method("layer_parameters", &NeuralNetwork::get_layer_parameters);
 }
@@ -43,6 +43,8 @@
 namespace shogun
 {
 template<class T> class DenseFeatures;
+template<class T> class SGSparseMatrix;
+template<class T> class StreamingDenseFeatures;
 class NeuralLayer;
 
 /** optimization method for neural networks */
@@ -467,6 +469,80 @@ public:
 		return m_gd_error_damping_coeff;
 	}
 
+	/** Enables or disables single precision inference. When enabled, apply()
+	 * performs the forward pass with float32 parameters and activations,
+	 * which halves the memory traffic of the dominant matrix products.
+	 * Training always computes in double precision, so gradient checking is
+	 * unaffected. Layers that do not implement the single precision path
+	 * cause a fallback to double precision for the whole pass.
+	 *
+	 * default value is false
+	 *
+	 * @param single_precision_inference true to compute inference in single
+	 * precision
+	 */
+	void set_single_precision_inference(bool single_precision_inference)
+	{
+		m_single_precision_inference = single_precision_inference;
+	}
+
+	/** Returns whether single precision inference is enabled */
+	bool get_single_precision_inference() const
+	{
+		return m_single_precision_inference;
+	}
+
+	/** Enables gradient checkpointing: during backpropagation only the
+	 * activations of every interval-th layer (and of the output layer) are
+	 * kept, and the activations in between are recomputed from the nearest
+	 * kept layer when the backward pass reaches them. This trades one extra
+	 * forward computation per layer for a memory footprint of roughly
+	 * num_layers/interval + interval layer buffers instead of num_layers,
+	 * which allows much larger batches on deep networks.
+	 *
+	 * Only networks forming a simple chain (each layer reading from its
+	 * predecessor, a single input layer) are supported; other topologies,
+	 * and contractive autoencoders, fall back to the standard backward
+	 * pass with a warning.
+	 *
+	 * default value is 0 (checkpointing disabled)
+	 *
+	 * @param checkpoint_interval distance between kept layers, 0 to disable
+	 */
+	void set_checkpoint_interval(int32_t checkpoint_interval)
+	{
+		m_checkpoint_interval = checkpoint_interval;
+	}
+
+	/** Returns the gradient checkpointing interval */
+	int32_t get_checkpoint_interval() const
+	{
+		return m_checkpoint_interval;
+	}
+
+	/** Trains the network with mini-batch gradient descent directly from a
+	 * streaming source, without materializing the full feature matrix in
+	 * memory. The stream's parser thread reads the following examples ahead
+	 * into its ring while the learner computes the gradients on the current
+	 * mini-batch, so gradient computation overlaps with data movement. A
+	 * single pass is made over the stream.
+	 *
+	 * The stream must be labelled. When the network has more than one output
+	 * the labels are interpreted as class indices and encoded one-hot; with
+	 * a single output the labels are used directly as the targets
+	 * (regression values or 0/1 class indicators).
+	 *
+	 * The mini-batch size must be set to a positive value using
+	 * set_gd_mini_batch_size() beforehand, since full-batch training is not
+	 * possible when the size of the data set is unknown in advance.
+	 *
+	 * @param stream labelled streaming features of dimension
+	 * get_num_inputs()
+	 * @return True if training succeeded, false otherwise
+	 */
+	virtual bool train_on_stream(
+			const std::shared_ptr<StreamingDenseFeatures<float64_t>>& stream);
+
 protected:
 	/** trains the network */
 	bool train_machine(std::shared_ptr<Features> data=NULL) override;
@@ -475,6 +551,61 @@ protected:
 	virtual bool train_gradient_descent(SGMatrix<float64_t> inputs,
 			SGMatrix<float64_t> targets);
 
+	/** Trains the network using gradient descent on sparse inputs. The
+	 * mini-batches are views into the sparse feature matrix and the first
+	 * hidden layers compute their pre-activations directly from the
+	 * non-zero entries, so the inputs are never densified
+	 */
+	virtual bool train_gradient_descent(SGSparseMatrix<float64_t> inputs,
+			SGMatrix<float64_t> targets);
+
+	/** Performs one gradient descent update on a single mini-batch: applies
+	 * the momentum pre-update, computes the gradients, updates the
+	 * parameters and the filtered error
+	 *
+	 * @param inputs_batch inputs of the mini-batch
+	 * @param targets_batch desired outputs of the mini-batch
+	 * @param gradients scratch vector for the gradients
+	 * @param param_updates accumulated momentum updates, updated in place
+	 * @param alpha current learning rate
+	 * @param c error damping coefficient
+	 * @param error filtered error, updated in place
+	 * @param error_last_time filtered error of the previous mini-batch,
+	 * updated in place
+	 * @param iter iteration index, used for logging
+	 * @return true if the filtered error indicates convergence
+	 */
+	virtual bool gd_step(SGMatrix<float64_t> inputs_batch,
+			SGMatrix<float64_t> targets_batch, SGVector<float64_t> gradients,
+			SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+			float64_t& error, float64_t& error_last_time, int32_t iter);
+
+	/** Same as gd_step(), operating on a sparse mini-batch */
+	virtual bool gd_step(SGSparseMatrix<float64_t> inputs_batch,
+			SGMatrix<float64_t> targets_batch, SGVector<float64_t> gradients,
+			SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+			float64_t& error, float64_t& error_last_time, int32_t iter);
+
+	/** Applies the parameter update, the error filtering and the convergence
+	 * check shared by the gd_step() overloads, after the gradients of the
+	 * current mini-batch have been computed
+	 *
+	 * @param gradients gradients of the current mini-batch
+	 * @param param_updates accumulated momentum updates, updated in place
+	 * @param alpha current learning rate
+	 * @param c error damping coefficient
+	 * @param e error of the current mini-batch
+	 * @param error filtered error, updated in place
+	 * @param error_last_time filtered error of the previous mini-batch,
+	 * updated in place
+	 * @param iter iteration index, used for logging
+	 * @return true if the filtered error indicates convergence
+	 */
+	virtual bool gd_update(SGVector<float64_t> gradients,
+			SGVector<float64_t> param_updates, float64_t alpha, float64_t c,
+			float64_t e, float64_t& error, float64_t& error_last_time,
+			int32_t iter);
+
 	/** trains the network using L-BFGS*/
 	virtual bool train_lbfgs(SGMatrix<float64_t> inputs,
 			SGMatrix<float64_t> targets);
@@ -502,6 +633,39 @@ protected:
 	 */
 	virtual SGMatrix<float64_t> forward_propagate(SGMatrix<float64_t> inputs, int32_t j=-1);
 
+	/** Applies forward propagation on sparse inputs, computes the activations
+	 * of each layer up to layer j. The input layers take hold of the sparse
+	 * matrix without densifying it, and every layer reading from them must
+	 * support sparse inputs (see NeuralLayer::supports_sparse_inputs())
+	 *
+	 * @param inputs sparse inputs to the network, a matrix of size
+	 * m_num_inputs*m_batch_size
+	 * @param j layer index at which the propagation should stop. If -1, the
+	 * propagation continues up to the last layer
+	 *
+	 * @return activations of the last layer
+	 */
+	virtual SGMatrix<float64_t> forward_propagate(
+			SGSparseMatrix<float64_t> inputs, int32_t j=-1);
+
+	/** Applies forward propagation in single precision: the parameters and
+	 * the inputs are cast to float32 once per batch and all the layer
+	 * computations are performed on float32 buffers, halving the memory
+	 * traffic of the forward pass. The activations of the last layer are
+	 * cast back to float64, so callers see the same interface as
+	 * forward_propagate(). Used by forward_propagate() when single precision
+	 * inference is enabled and all the involved layers support it
+	 *
+	 * @param inputs inputs to the network, a matrix of size
+	 * m_num_inputs*m_batch_size
+	 * @param j layer index at which the propagation should stop. If -1, the
+	 * propagation continues up to the last layer
+	 *
+	 * @return activations of the last layer, in double precision
+	 */
+	virtual SGMatrix<float64_t> forward_propagate_single(
+			SGMatrix<float64_t> inputs, int32_t j=-1);
+
 	/** Sets the batch size (the number of train/test cases) the network is
 	 * expected to deal with.
 	 * Allocates memory for the activations, local gradients, input gradients
@@ -528,6 +692,67 @@ protected:
 	virtual float64_t compute_gradients(SGMatrix<float64_t> inputs,
 			SGMatrix<float64_t> targets, SGVector<float64_t> gradients);
 
+	/** Same as compute_gradients(), operating on sparse inputs. Gradient
+	 * checkpointing is not applied in this mode
+	 *
+	 * @param inputs sparse inputs to the network, a matrix of size
+	 * m_num_inputs*m_batch_size
+	 *
+	 * @param targets desired values for the output layer's activations.
+	 * matrix of size m_layers[m_num_layers-1].get_num_neurons()*m_batch_size
+	 *
+	 * @param gradients array to be filled with gradient values.
+	 *
+	 * @return error between the targets and the activations of the last
+	 * layer
+	 */
+	virtual float64_t compute_gradients(SGSparseMatrix<float64_t> inputs,
+			SGMatrix<float64_t> targets, SGVector<float64_t> gradients);
+
+	/** Performs the backward pass and the regularization shared by the
+	 * compute_gradients() overloads, after the activations have been
+	 * computed by forward propagation
+	 *
+	 * @param targets desired values for the output layer's activations.
+	 * matrix of size m_layers[m_num_layers-1].get_num_neurons()*m_batch_size
+	 *
+	 * @param gradients array to be filled with gradient values.
+	 *
+	 * @return error between the targets and the activations of the last
+	 * layer
+	 */
+	virtual float64_t backpropagate(SGMatrix<float64_t> targets,
+			SGVector<float64_t> gradients);
+
+	/** Backpropagation with gradient checkpointing: keeps the activations
+	 * of every m_checkpoint_interval-th layer during the forward pass and
+	 * recomputes each segment's interior activations from its checkpoint
+	 * when the backward pass reaches it. Produces the same gradients as
+	 * compute_gradients() for chain networks. Called by compute_gradients()
+	 * when checkpointing is enabled and applicable
+	 *
+	 * @param inputs inputs to the network, a matrix of size
+	 * m_num_inputs*m_batch_size
+	 *
+	 * @param targets desired values for the output layer's activations.
+	 * matrix of size m_layers[m_num_layers-1].get_num_neurons()*m_batch_size
+	 *
+	 * @param gradients array to be filled with gradient values.
+	 *
+	 * @return error between the targets and the activations of the last
+	 * layer
+	 */
+	virtual float64_t compute_gradients_checkpointed(
+			SGMatrix<float64_t> inputs, SGMatrix<float64_t> targets,
+			SGVector<float64_t> gradients);
+
+	/** Returns true if the network can be trained with gradient
+	 * checkpointing: the layers must form a simple chain and no layer may
+	 * use a contraction term, since contractive error terms need all the
+	 * hidden activations at once
+	 */
+	bool checkpointing_applicable() const;
+
 	/** Forward propagates the inputs and computes the error between the output
 	 * layer's activations and the given target activations.
 	 *
@@ -558,6 +783,12 @@ protected:
 	 */
 	SGMatrix<float64_t> features_to_matrix(const std::shared_ptr<Features>& features);
 
+	/** Ensures the given features are suitable for use with the network and
+	 * returns their sparse feature matrix
+	 */
+	SGSparseMatrix<float64_t> features_to_sparse_matrix(
+			const std::shared_ptr<Features>& features);
+
 	/** converts the given labels into a matrix suitable for use with network
 	 *
 	 * @return matrix of size get_num_outputs()*num_labels
@@ -612,6 +843,47 @@ protected:
 	/** array where all the parameters of the network are stored */
 	SGVector<float64_t> m_params;
 
+	/** single precision copy of m_params, allocated lazily when single
+	 * precision inference is used
+	 */
+	SGVector<float32_t> m_params_single;
+
+	/** true while m_params_single matches m_params. Invalidated by
+	 * initialization and training, so repeated apply() calls reuse the
+	 * packed single precision parameters instead of re-casting them per
+	 * batch. Note that modifying the array returned by get_parameters()
+	 * in place does not invalidate the cache
+	 */
+	bool m_params_single_valid;
+
+	/** single precision copy of the network inputs used by
+	 * forward_propagate_single(), reused across calls with the same input
+	 * shape so steady-state inference performs no allocations
+	 */
+	SGMatrix<float32_t> m_inputs_single;
+
+	/** double precision view of the output layer's single precision
+	 * activations, handed back by forward_propagate_single() and reused
+	 * across calls with the same output shape
+	 */
+	SGMatrix<float64_t> m_outputs_single_to_double;
+
+	/** contiguous workspace holding the activation and gradient buffers of
+	 * all the layers, sized by set_batch_size() for the largest batch seen
+	 */
+	SGVector<float64_t> m_workspace;
+
+	/** if true, apply() performs the forward pass in single precision
+	 * initial value is false
+	 */
+	bool m_single_precision_inference;
+
+	/** distance between layers whose activations are kept during
+	 * checkpointed backpropagation, 0 to disable checkpointing
+	 * initial value is 0
+	 */
+	int32_t m_checkpoint_interval;
+
 	/** Array that specifies which parameters are to be regularized. This is
 	 * used to turn off regularization for bias parameters
 	 */
@@ -58,6 +58,20 @@ void NeuralRectifiedLinearLayer::compute_activations(SGVector<float64_t> paramet
 	}
 }
 
+void NeuralRectifiedLinearLayer::compute_activations_single(
+    SGVector<float32_t> parameters,
+    const std::vector<std::shared_ptr<NeuralLayer>>& layers)
+{
+	NeuralLinearLayer::compute_activations_single(parameters, layers);
+
+	int32_t len = m_num_neurons*m_batch_size;
+	for (int32_t i=0; i<len; i++)
+	{
+		m_activations_single[i] =
+			Math::max<float32_t>(0, m_activations_single[i]);
+	}
+}
+
 float64_t NeuralRectifiedLinearLayer::compute_contraction_term(
 	SGVector< float64_t > parameters)
 {
@@ -52,9 +52,17 @@ void NeuralSoftmaxLayer::compute_activations(
 {
 	NeuralLinearLayer::compute_activations(parameters, layers);
 
+	if (m_log_activations.num_rows != m_num_neurons ||
+			m_log_activations.num_cols != m_batch_size)
+	{
+		m_log_activations = SGMatrix<float64_t>(m_num_neurons, m_batch_size);
+	}
+
 	// to avoid exponentiating large numbers, the maximum activation is
 	// subtracted from all the activations and the computations are done in the
-	// log domain
+	// log domain. Each element is exponentiated only once: the normalization
+	// is applied as a multiply, and the log-activations needed by
+	// compute_error() are produced in the same pass
 
 	float64_t max = m_activations.max_single();
 
@@ -63,13 +71,49 @@ void NeuralSoftmaxLayer::compute_activations(
 		float64_t sum = 0;
 		for (int32_t i=0; i<m_num_neurons; i++)
 		{
-			sum += std::exp(m_activations[i + j * m_num_neurons] - max);
+			float64_t shifted = m_activations[i + j * m_num_neurons] - max;
+			float64_t exponentiated = std::exp(shifted);
+
+			m_log_activations[i + j * m_num_neurons] = shifted;
+			m_activations[i + j * m_num_neurons] = exponentiated;
+			sum += exponentiated;
 		}
+
 		float64_t normalizer = std::log(sum);
+		float64_t inv_sum = 1.0/sum;
 		for (int32_t k=0; k<m_num_neurons; k++)
 		{
-			m_activations[k + j * m_num_neurons] = std::exp(
-			    m_activations[k + j * m_num_neurons] - max - normalizer);
+			m_activations[k + j * m_num_neurons] *= inv_sum;
+			m_log_activations[k + j * m_num_neurons] -= normalizer;
+		}
+	}
+}
+
+void NeuralSoftmaxLayer::compute_activations_single(
+    SGVector<float32_t> parameters,
+    const std::vector<std::shared_ptr<NeuralLayer>>& layers)
+{
+	NeuralLinearLayer::compute_activations_single(parameters, layers);
+
+	// to avoid exponentiating large numbers, the maximum activation is
+	// subtracted from all the activations and the computations are done in the
+	// log domain
+	float32_t max = m_activations_single.max_single();
+
+	for (int32_t j=0; j<m_batch_size; j++)
+	{
+		float32_t sum = 0;
+		for (int32_t i=0; i<m_num_neurons; i++)
+		{
+			sum += std::exp(
+			    m_activations_single[i + j * m_num_neurons] - max);
+		}
+		float32_t normalizer = std::log(sum);
+		for (int32_t k=0; k<m_num_neurons; k++)
+		{
+			m_activations_single[k + j * m_num_neurons] = std::exp(
+			    m_activations_single[k + j * m_num_neurons] - max
+			    - normalizer);
 		}
 	}
 }
@@ -88,15 +132,14 @@ void NeuralSoftmaxLayer::compute_local_gradients(SGMatrix<float64_t> targets)
 
 float64_t NeuralSoftmaxLayer::compute_error(SGMatrix<float64_t> targets)
 {
+	// the log-activations are cached by compute_activations(), so the error
+	// is a single multiply-add pass with no log calls. The cached values are
+	// computed in the log domain directly, so no clamping against log(0) is
+	// needed either
 	int32_t len = m_num_neurons*m_batch_size;
 	float64_t sum = 0;
 	for (int32_t i=0; i< len; i++)
-	{
-		// to prevent taking the log of a zero
-		if (m_activations[i]==0)
-			sum += targets[i] * std::log(1e-50);
-		else
-			sum += targets[i] * std::log(m_activations[i]);
-	}
+		sum += targets[i] * m_log_activations[i];
+
 	return -1*sum/m_batch_size;
 }
@@ -71,6 +71,19 @@ public:
 	void compute_activations(SGVector<float64_t> parameters,
 			const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
 
+	/** Computes the activations of the neurons in this layer in single
+	 * precision, results are stored in the matrix returned by
+	 * get_activations_single(). To be used only during inference
+	 *
+	 * @param parameters Vector of size get_num_parameters(), contains the
+	 * parameters of the layer cast to single precision
+	 *
+	 * @param layers Array of layers that form the network that this layer is
+	 * being used with
+	 */
+	void compute_activations_single(SGVector<float32_t> parameters,
+			const std::vector<std::shared_ptr<NeuralLayer>>& layers) override;
+
 	/** Computes the gradients of the error with respect to this layer's
 	 * pre-activations. Results are stored in m_local_gradients.
 	 *
@@ -92,6 +105,14 @@ public:
 	float64_t compute_error(SGMatrix<float64_t> targets) override;
 
 	const char* get_name() const override { return "NeuralSoftmaxLayer"; }
+
+protected:
+	/** log of the activations, filled by compute_activations() in the same
+	 * pass that computes the activations and consumed by compute_error(),
+	 * avoiding a second exponentiation/log pass over the output matrix
+	 * size num_neurons * batch_size
+	 */
+	SGMatrix<float64_t> m_log_activations;
 };
 
 }
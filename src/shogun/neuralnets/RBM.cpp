@@ -521,8 +521,17 @@ void RBM::mean_visible(SGMatrix< float64_t > hidden, SGMatrix< float64_t > resul
 void RBM::sample_hidden(SGMatrix< float64_t > mean, SGMatrix< float64_t > result)
 {
 	int32_t length = result.num_rows*result.num_cols;
+
+	if (m_sampling_buffer.vlen < length)
+		m_sampling_buffer = SGVector<float64_t>(length);
+
+	// one bulk RNG fill for the whole state matrix, followed by a
+	// branch-free compare loop that the compiler can vectorize
+	random::fill_array(m_sampling_buffer.vector,
+		m_sampling_buffer.vector+length, m_uniform_prob, m_prng);
+
 	for (int32_t i=0; i<length; i++)
-		result[i] = m_uniform_prob(m_prng) < mean[i];
+		result[i] = m_sampling_buffer[i] < mean[i];
 }
 
 void RBM::sample_visible(SGMatrix< float64_t > mean, SGMatrix< float64_t > result)
@@ -540,9 +549,21 @@ void RBM::sample_visible(int32_t index,
 
 	if (m_visible_group_types[index] == RBMVUT_BINARY)
 	{
-		for (int32_t i = 0; i < m_visible_group_sizes[index]; i++)
-			for (int32_t j=0; j<m_batch_size; j++)
-				result(i+offset,j) = m_uniform_prob(m_prng) < mean(i+offset,j);
+		int32_t size = m_visible_group_sizes[index];
+		int32_t length = size*m_batch_size;
+
+		if (m_sampling_buffer.vlen < length)
+			m_sampling_buffer = SGVector<float64_t>(length);
+
+		random::fill_array(m_sampling_buffer.vector,
+			m_sampling_buffer.vector+length, m_uniform_prob, m_prng);
+
+		for (int32_t j=0; j<m_batch_size; j++)
+			for (int32_t i = 0; i < size; i++)
+			{
+				result(i+offset,j) =
+					m_sampling_buffer[i+j*size] < mean(i+offset,j);
+			}
 	}
 
 	if (m_visible_group_types[index] == RBMVUT_SOFTMAX)
@@ -463,6 +463,12 @@ protected:
 
 private:
 	UniformRealDistribution<float64_t> m_uniform_prob;
+
+	/** buffer holding one uniform random number per sampled state, filled
+	 * in bulk once per Gibbs step by sample_hidden()/sample_visible() and
+	 * grown lazily to the largest state matrix sampled so far
+	 */
+	SGVector<float64_t> m_sampling_buffer;
 };
 
 }
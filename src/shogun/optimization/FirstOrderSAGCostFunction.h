@@ -32,7 +32,10 @@
 #ifndef FIRSTORDERSAGCOSTFUNCTION_H
 #define FIRSTORDERSAGCOSTFUNCTION_H
 #include <shogun/lib/config.h>
+#include <shogun/lib/SGMatrix.h>
 #include <shogun/optimization/FirstOrderStochasticCostFunction.h>
+
+#include <algorithm>
 namespace shogun
 {
 /** @brief The class is about a stochastic cost function for stochastic average minimizers.
@@ -112,13 +115,77 @@ public:
 	 */
 	SGVector<float64_t> get_gradient() override =0;
 
-	/** Get the cost given current target variables 
+	/** Get the cost given current target variables
 	 *
 	 * For least squares cost function, that is the value of \f$f(w)\f$.
 	 *
 	 * @return cost
 	 */
 	float64_t get_cost() override =0;
+
+	/** Whether sample gradients can be evaluated concurrently for arbitrary
+	 * sample indices via get_gradient(const SGVector<float64_t>&, index_t).
+	 *
+	 * Asynchronous minimizers (for example, HogwildSVRGMinimizer) only use
+	 * their parallel update path when this returns true. The default is
+	 * false since the sampling API of this interface is a shared cursor.
+	 *
+	 * @return whether concurrent index-based gradient evaluation is safe
+	 */
+	virtual bool supports_parallel_sampling() const { return false; }
+
+	/** Get the SAMPLE gradient wrt the given variable values for the given
+	 * sample index.
+	 *
+	 * Unlike get_gradient(), this method does not depend on the internal
+	 * sampling cursor nor on the variable reference. Implementations opting
+	 * into parallel sampling must make it safe to call concurrently from
+	 * several threads and must not modify any shared state.
+	 *
+	 * @param variable the variable values to evaluate the gradient at
+	 * @param idx the sample index
+	 * @return sample gradient of target variables
+	 */
+	virtual SGVector<float64_t> get_gradient(
+		const SGVector<float64_t>& variable, index_t idx)
+	{
+		not_implemented(SOURCE_LOCATION);
+		return SGVector<float64_t>();
+	}
+
+	/** Get the SAMPLE gradients for a batch of sample indices.
+	 *
+	 * The gradient of sample indices[i] is stored in the i-th column of
+	 * the given gradient matrix, which must have one row per variable and
+	 * at least one column per requested index.
+	 *
+	 * The default implementation loops over
+	 * get_gradient(const SGVector<float64_t>&, index_t). Cost functions
+	 * whose sample gradients are a common term scaled per sample (for
+	 * example, linear models) should override this method and fill the
+	 * whole batch with matrix-level operations, so that minibatch
+	 * minimizers amortize the per-sample virtual dispatch.
+	 *
+	 * @param variable the variable values to evaluate the gradients at
+	 * @param indices the sample indices of the batch
+	 * @param gradients the matrix the sample gradients are written into
+	 */
+	virtual void get_gradient_batch(const SGVector<float64_t>& variable,
+		const SGVector<index_t>& indices, SGMatrix<float64_t>& gradients)
+	{
+		require(gradients.num_rows==variable.vlen,
+			"The gradient matrix must have one row per variable ({}) but has {} rows",
+			variable.vlen, gradients.num_rows);
+		require(gradients.num_cols>=indices.vlen,
+			"The gradient matrix must have at least one column per index ({}) but has {} columns",
+			indices.vlen, gradients.num_cols);
+		for (index_t i=0; i<indices.vlen; i++)
+		{
+			SGVector<float64_t> grad=get_gradient(variable, indices[i]);
+			std::copy(grad.vector, grad.vector+grad.vlen,
+				gradients.get_column_vector(i));
+		}
+	}
 };
 
 }
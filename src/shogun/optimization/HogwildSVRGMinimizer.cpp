@@ -0,0 +1,101 @@
+ /*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+#include <shogun/io/SGIO.h>
+#include <shogun/optimization/HogwildSVRGMinimizer.h>
+
+using namespace shogun;
+
+HogwildSVRGMinimizer::HogwildSVRGMinimizer()
+	:SVRGMinimizer()
+{
+}
+
+HogwildSVRGMinimizer::~HogwildSVRGMinimizer()
+{
+}
+
+HogwildSVRGMinimizer::HogwildSVRGMinimizer(const std::shared_ptr<FirstOrderSAGCostFunction >&fun)
+	:SVRGMinimizer(fun)
+{
+}
+
+float64_t HogwildSVRGMinimizer::minimize()
+{
+	auto fun=m_fun->as<FirstOrderSAGCostFunction>();
+	require(fun,"the cost function must be a stochastic average gradient cost function");
+	if (!fun->supports_parallel_sampling())
+	{
+		io::warn("{} does not support parallel sampling, "
+			"falling back to serial SVRG updates", fun->get_name());
+		return SVRGMinimizer::minimize();
+	}
+
+	init_minimization();
+
+	SGVector<float64_t> variable_reference=m_fun->obtain_variable_reference();
+	int32_t num_samples=fun->get_sample_size();
+	for(;m_cur_passes<(m_num_passes-m_num_sgd_passes);m_cur_passes++)
+	{
+		if(m_cur_passes%m_svrg_interval==0)
+		{
+			if(m_previous_variable.vlen==0)
+				m_previous_variable=SGVector<float64_t>(variable_reference.vlen);
+
+			std::copy(variable_reference.vector, variable_reference.vector+variable_reference.vlen, m_previous_variable.vector);
+			m_average_gradient=fun->get_average_gradient();
+		}
+
+		// workers read and write the shared variable without locks; the
+		// occasional overwritten update is tolerated by the stochastic
+		// updates (Hogwild-style), while the snapshot terms keep the
+		// gradient variance bounded
+#pragma omp parallel for
+		for(index_t idx=0; idx<num_samples; idx++)
+		{
+			float64_t learning_rate=1.0;
+			if(m_learning_rate)
+				learning_rate=m_learning_rate->get_learning_rate(m_iter_counter+idx+1);
+
+			SGVector<float64_t> grad_new=fun->get_gradient(variable_reference, idx);
+			SGVector<float64_t> grad_old=fun->get_gradient(m_previous_variable, idx);
+			for(index_t k=0; k<grad_new.vlen; k++)
+				grad_new[k]+=(m_average_gradient[k]-grad_old[k]);
+
+			update_gradient(grad_new,variable_reference);
+			for(index_t k=0; k<grad_new.vlen; k++)
+				variable_reference[k]-=learning_rate*grad_new[k];
+		}
+		m_iter_counter+=num_samples;
+
+		do_proximal_operation(variable_reference);
+	}
+	float64_t cost=m_fun->get_cost();
+	return cost+get_penalty(variable_reference);
+}
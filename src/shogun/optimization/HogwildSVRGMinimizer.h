@@ -0,0 +1,89 @@
+ /*
+ * Copyright (c) The Shogun Machine Learning Toolbox
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The views and conclusions contained in the software and documentation are those
+ * of the authors and should not be interpreted as representing official policies,
+ * either expressed or implied, of the Shogun Development Team.
+ *
+ */
+
+#ifndef HOGWILDSVRGMINIMIZER_H
+#define HOGWILDSVRGMINIMIZER_H
+#include <shogun/optimization/SVRGMinimizer.h>
+namespace shogun
+{
+
+/** @brief The class implements an asynchronous multi-threaded variant of the
+ * SVRG minimizer.
+ *
+ * Worker threads evaluate variance-reduced sample gradients concurrently and
+ * apply their descent steps to the shared variable without locks in the style
+ * of Hogwild. This requires the cost function to opt into
+ * FirstOrderSAGCostFunction::supports_parallel_sampling(); cost functions
+ * that do not are minimized with the serial SVRG update path instead.
+ *
+ * Since the parallel updates are applied lock-free, gradient updaters with
+ * internal state (momentum, adaptive rates) are not applied in the parallel
+ * path; plain descent steps scaled by the learning rate are taken. Proximal
+ * operations for sparse penalties are applied once per pass.
+ *
+ * References:
+ * Johnson, Rie, and Tong Zhang.
+ * "Accelerating stochastic gradient descent using predictive variance reduction."
+ * Advances in Neural Information Processing Systems. 2013.
+ *
+ * Niu, Feng, et al.
+ * "Hogwild: A lock-free approach to parallelizing stochastic gradient descent."
+ * Advances in Neural Information Processing Systems. 2011.
+ */
+
+class HogwildSVRGMinimizer: public SVRGMinimizer
+{
+public:
+	/** Default constructor */
+	HogwildSVRGMinimizer();
+
+	/** Constructor
+	 * @param fun stochastic average gradient cost function
+	 */
+	HogwildSVRGMinimizer(const std::shared_ptr<FirstOrderSAGCostFunction >&fun);
+
+	/** Destructor */
+	~HogwildSVRGMinimizer() override;
+
+	/** Do minimization and get the optimal value
+	 *
+	 * @return optimal value
+	 */
+	float64_t minimize() override;
+
+	/** returns the name of the class
+	 *
+	 * @return name HogwildSVRGMinimizer
+	 */
+	const char* get_name() const override { return "HogwildSVRGMinimizer"; }
+};
+
+}
+#endif /* HOGWILDSVRGMINIMIZER_H */
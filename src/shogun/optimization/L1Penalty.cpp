@@ -47,8 +47,51 @@ void L1Penalty::set_rounding_epsilon(float64_t epsilon)
 void L1Penalty::update_variable_for_proximity(SGVector<float64_t> variable,
 	float64_t proximal_weight)
 {
-	for(index_t idx=0; idx<variable.vlen; idx++)
-		variable[idx]=get_sparse_variable(variable[idx], proximal_weight);
+	if (m_applied_weight.vlen>0)
+	{
+		/* lazy accounting is active, so catch every coordinate up to keep
+		   earlier sparse updates and this dense one consistent */
+		m_accumulated_weight+=proximal_weight;
+		for(index_t idx=0; idx<variable.vlen; idx++)
+			apply_outstanding_penalty(variable, idx);
+	}
+	else
+	{
+		for(index_t idx=0; idx<variable.vlen; idx++)
+			variable[idx]=get_sparse_variable(variable[idx], proximal_weight);
+	}
+}
+
+void L1Penalty::update_variable_for_proximity(SGVector<float64_t> variable,
+	float64_t proximal_weight, const SGVector<index_t>& indices)
+{
+	if (m_applied_weight.vlen==0)
+	{
+		m_applied_weight=SGVector<float64_t>(variable.vlen);
+		m_applied_weight.set_const(0.0);
+		m_accumulated_weight=0.0;
+	}
+	else
+	{
+		require(variable.vlen==m_applied_weight.vlen,
+			"The length of variable ({}) is changed. Last time, the length of variable was {}",
+			variable.vlen, m_applied_weight.vlen);
+	}
+	m_accumulated_weight+=proximal_weight;
+	for(index_t i=0; i<indices.vlen; i++)
+	{
+		index_t idx=indices[i];
+		require(idx>=0 && idx<variable.vlen,
+			"The index ({}) is out of range ([0,{}))", idx, variable.vlen);
+		apply_outstanding_penalty(variable, idx);
+	}
+}
+
+void L1Penalty::apply_outstanding_penalty(SGVector<float64_t> variable, index_t idx)
+{
+	variable[idx]=get_sparse_variable(variable[idx],
+		m_accumulated_weight-m_applied_weight[idx]);
+	m_applied_weight[idx]=m_accumulated_weight;
 }
 
 float64_t L1Penalty::get_sparse_variable(float64_t variable, float64_t penalty_weight)
@@ -73,6 +116,12 @@ float64_t L1Penalty::get_sparse_variable(float64_t variable, float64_t penalty_w
 void L1Penalty::init()
 {
 	m_rounding_epsilon=1e-8;
+	m_accumulated_weight=0;
+	m_applied_weight=SGVector<float64_t>();
 	SG_ADD(&m_rounding_epsilon, "L1Penalty__m_rounding_epsilon",
 		"rounding_epsilon in L1Penalty");
+	SG_ADD(&m_accumulated_weight, "L1Penalty__m_accumulated_weight",
+		"accumulated_weight in L1Penalty");
+	SG_ADD(&m_applied_weight, "L1Penalty__m_applied_weight",
+		"applied_weight in L1Penalty");
 }
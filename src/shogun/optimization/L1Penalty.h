@@ -32,6 +32,7 @@
 #ifndef L1PENALTY_H
 #define L1PENALTY_H
 #include <shogun/optimization/SparsePenalty.h>
+#include <shogun/lib/SGVector.h>
 
 namespace shogun
 {
@@ -97,6 +98,20 @@ public:
 	void update_variable_for_proximity(SGVector<float64_t> variable,
 		float64_t proximal_weight) override;
 
+	/** Do proximal projection/operation in place for the given coordinates
+	 *
+	 * The penalty weight of every iteration is accumulated and a coordinate
+	 * is caught up with its outstanding cumulative penalty when it is
+	 * touched, so sparse stochastic updates cost O(nnz) per iteration
+	 * instead of O(d).
+	 *
+	 * @param variable the raw variable
+	 * @param proximal_weight weight of the penalty
+	 * @param indices the coordinates touched by this iteration
+	 */
+	void update_variable_for_proximity(SGVector<float64_t> variable,
+		float64_t proximal_weight, const SGVector<index_t>& indices) override;
+
 	/** Get the sparse variable
 	 * @param variable the raw variable
 	 * @param penalty_weight weight of the penalty
@@ -105,9 +120,21 @@ public:
 	float64_t get_sparse_variable(float64_t variable, float64_t penalty_weight) override;
 
 protected:
+	/** Catch the given coordinate up with its outstanding cumulative penalty
+	 * @param variable the raw variable
+	 * @param idx the coordinate
+	 */
+	void apply_outstanding_penalty(SGVector<float64_t> variable, index_t idx);
+
 	/** rounding epsilon */
 	float64_t m_rounding_epsilon;
 
+	/** cumulative penalty weight of all iterations */
+	float64_t m_accumulated_weight;
+
+	/** cumulative penalty weight already applied, per coordinate */
+	SGVector<float64_t> m_applied_weight;
+
 private:
 	/** init */
 	void init();
@@ -57,6 +57,34 @@ void L1PenaltyForTG::update_variable_for_proximity(SGVector<float64_t> variable,
 	}
 }
 
+void L1PenaltyForTG::update_variable_for_proximity(SGVector<float64_t> variable,
+	float64_t proximal_weight, const SGVector<index_t>& indices)
+{
+	if(m_q.vlen==0)
+	{
+		m_q=SGVector<float64_t>(variable.vlen);
+		m_q.set_const(0.0);
+	}
+	else
+	{
+		require(variable.vlen==m_q.vlen,
+			"The length of variable ({}) is changed. Last time, the length of variable was {}", variable.vlen, m_q.vlen);
+	}
+	m_u+=proximal_weight;
+	for(index_t i=0; i<indices.vlen; i++)
+	{
+		index_t idx=indices[i];
+		require(idx>=0 && idx<variable.vlen,
+			"The index ({}) is out of range ([0,{}))", idx, variable.vlen);
+		float64_t z=variable[idx];
+		if(z>0.0)
+			variable[idx]=get_sparse_variable(z, m_u+m_q[idx]);
+		else if(z<0.0)
+			variable[idx]=get_sparse_variable(z, m_u-m_q[idx]);
+		m_q[idx]+=variable[idx]-z;
+	}
+}
+
 void L1PenaltyForTG::init()
 {
 	m_u=0;
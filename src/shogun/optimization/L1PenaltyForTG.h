@@ -70,6 +70,19 @@ public:
 	void update_variable_for_proximity(SGVector<float64_t> variable,
 		float64_t proximal_weight) override;
 
+	/** Do proximal projection/operation in place for the given coordinates
+	 *
+	 * Since u and q of the cumulative penalty scheme already track the
+	 * outstanding penalty per coordinate, touched coordinates are caught up
+	 * in O(nnz) time while untouched ones keep accumulating.
+	 *
+	 * @param variable the raw variable
+	 * @param proximal_weight weight of the penalty
+	 * @param indices the coordinates touched by this iteration
+	 */
+	void update_variable_for_proximity(SGVector<float64_t> variable,
+		float64_t proximal_weight, const SGVector<index_t>& indices) override;
+
 protected:
 	/** u is defined in Figure 2 of the reference */
 	float64_t m_u;
@@ -59,6 +59,25 @@ public:
 	virtual void update_variable_for_proximity(SGVector<float64_t> variable,
 		float64_t proximal_weight)=0;
 
+	/** Do proximal projection/operation in place for the given coordinates
+	 *
+	 * Minimizers whose stochastic gradients touch only a few coordinates per
+	 * iteration can pass those coordinates here. Penalties that support lazy
+	 * per-coordinate accounting (eg, L1Penalty) then catch the touched
+	 * coordinates up with their outstanding cumulative penalty in O(nnz)
+	 * time. The default implementation applies the penalty to the whole
+	 * variable.
+	 *
+	 * @param variable the raw variable
+	 * @param proximal_weight weight of the penalty
+	 * @param indices the coordinates touched by this iteration
+	 */
+	virtual void update_variable_for_proximity(SGVector<float64_t> variable,
+		float64_t proximal_weight, const SGVector<index_t>& indices)
+	{
+		update_variable_for_proximity(variable, proximal_weight);
+	}
+
 };
 
 }
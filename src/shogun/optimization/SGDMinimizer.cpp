@@ -30,6 +30,7 @@
  */
 #include <shogun/optimization/SGDMinimizer.h>
 #include <shogun/optimization/GradientDescendUpdater.h>
+#include <shogun/lib/Telemetry.h>
 #include <shogun/lib/config.h>
 
 #include <utility>
@@ -72,7 +73,9 @@ float64_t SGDMinimizer::minimize()
 			m_gradient_updater->update_variable(variable_reference,grad,learning_rate);
 
 			do_proximal_operation(variable_reference);
+			SG_TELEMETRY(GRADIENT_STEP, m_iter_counter);
 		}
+		SG_TELEMETRY(TRAIN_PASS, m_cur_passes);
 	}
 	float64_t cost=m_fun->get_cost();
 	return cost+get_penalty(variable_reference);
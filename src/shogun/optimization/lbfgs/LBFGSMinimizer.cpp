@@ -167,7 +167,7 @@ float64_t LBFGSMinimizer::minimize()
 	float64_t cost=0.0;
 	int32_t error_code=lbfgs(m_target_variable.vlen, m_target_variable.vector,
 		&cost, LBFGSMinimizer::evaluate,
-		NULL, this, &lbfgs_param);
+		NULL, this, &lbfgs_param, NULL, &m_workspace);
 
 	if(error_code!=0 && error_code!=LBFGS_ALREADY_MINIMIZED)
 	{
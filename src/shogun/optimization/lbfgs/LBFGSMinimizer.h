@@ -191,6 +191,9 @@ protected:
 
 	/** Target variable */
 	SGVector<float64_t> m_target_variable;
+
+	/** Working storage reused across minimize() calls */
+	lbfgs_workspace_t m_workspace;
 };
 
 }
@@ -90,14 +90,6 @@ struct tag_callback_data {
 };
 typedef struct tag_callback_data callback_data_t;
 
-struct tag_iteration_data {
-    float64_t alpha;
-    SGVector<float64_t> s;     /* [n] */
-    SGVector<float64_t> y;     /* [n] */
-    float64_t ys;     /* vecdot(y, s) */
-};
-typedef struct tag_iteration_data iteration_data_t;
-
 static const lbfgs_parameter_t _defparam = {
     6, 1e-5, 0, 0.0,
     0, LBFGS_LINESEARCH_DEFAULT, 20,
@@ -207,6 +199,50 @@ void lbfgs_parameter_init(lbfgs_parameter_t *param)
     sg_memcpy(param, &_defparam, sizeof(*param));
 }
 
+void lbfgs_workspace_t::reserve(int n, const lbfgs_parameter_t& param)
+{
+    if (xp.vlen != n)
+    {
+        xp = SGVector<float64_t>(n);
+        g = SGVector<float64_t>(n);
+        gp = SGVector<float64_t>(n);
+        d = SGVector<float64_t>(n);
+        w = SGVector<float64_t>(n);
+    }
+
+    if (param.orthantwise_c != 0. && pg.vlen != n)
+    {
+        /* Working space for OW-LQN. */
+        pg = SGVector<float64_t>(n);
+    }
+
+    /* Limited memory of the (s,y) correction pairs. */
+    if (static_cast<int>(lm.size()) != param.m ||
+        (param.m > 0 && lm[0].s.vlen != n))
+    {
+        lm.resize(param.m);
+        for (auto& e: lm)
+        {
+            e.s = SGVector<float64_t>(n);
+            e.y = SGVector<float64_t>(n);
+        }
+    }
+    for (auto& e: lm)
+    {
+        e.alpha = 0;
+        e.ys = 0;
+    }
+
+    /* Storage for previous values of the objective function. */
+    if (0 < param.past)
+    {
+        if (pf.vlen != param.past)
+            pf = SGVector<float64_t>(param.past);
+    }
+    else
+        pf = SGVector<float64_t>();
+}
+
 int32_t lbfgs(
     int32_t n,
     float64_t *x,
@@ -215,7 +251,8 @@ int32_t lbfgs(
     lbfgs_progress_t proc_progress,
     void *instance,
     lbfgs_parameter_t *_param,
-    lbfgs_adjust_step_t proc_adjust_step
+    lbfgs_adjust_step_t proc_adjust_step,
+    lbfgs_workspace_t *workspace
     )
 {
     int32_t ret;
@@ -226,7 +263,12 @@ int32_t lbfgs(
     lbfgs_parameter_t param = (_param != NULL) ? (*_param) : _defparam;
     const int32_t m = param.m;
 
-    std::vector<iteration_data_t> lm;
+    /* Use the caller-provided working storage when available, so that
+       repeated invocations do not pay for the allocations again. */
+    lbfgs_workspace_t local_workspace;
+    lbfgs_workspace_t *ws = (workspace != NULL) ? workspace : &local_workspace;
+
+    std::vector<iteration_data_t>& lm = ws->lm;
     std::vector<iteration_data_t>::iterator it;
     SGVector<float64_t> x_wrap(x, n, false);
     float64_t ys, yy;
@@ -316,36 +358,12 @@ int32_t lbfgs(
         }
     }
 
-    /* Allocate working space. */
-    SGVector<float64_t> xp, g, gp, d, w, pg, pf;
+    /* Size the working space, reusing the buffers of earlier invocations. */
+    SGVector<float64_t> &xp = ws->xp, &g = ws->g, &gp = ws->gp, &d = ws->d,
+        &w = ws->w, &pg = ws->pg, &pf = ws->pf;
     try
     {
-        xp = SGVector<float64_t>(n);
-        g = SGVector<float64_t>(n);
-        gp = SGVector<float64_t>(n);
-        d = SGVector<float64_t>(n);
-        w = SGVector<float64_t>(n);
-
-        if (param.orthantwise_c != 0.) {
-            /* Allocate working space for OW-LQN. */
-            pg = SGVector<float64_t>(n);
-        }
-
-        /* Allocate limited memory storage. */
-        lm.resize(m);
-
-        /* Initialize the limited memory. */
-        for (auto& e: lm)
-        {
-            e.alpha = 0;
-            e.ys = 0;
-            e.s = SGVector<float64_t>(n);
-            e.y = SGVector<float64_t>(n);
-        }
-
-        /* Allocate an array for storing previous values of the objective function. */
-        if (0 < param.past)
-            pf = SGVector<float64_t>(param.past);
+        ws->reserve(n, param);
     }
     catch (const ShogunException& e)
     {
@@ -603,9 +621,6 @@ lbfgs_exit:
 		*ptr_fx = fx;
 	}
 
-	/* Free memory blocks used by this function. */
-	lm.clear();
-
 	return ret;
 }
 
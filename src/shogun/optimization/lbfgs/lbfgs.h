@@ -30,8 +30,11 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/lib/common.h>
+#include <shogun/lib/SGVector.h>
 #include <shogun/optimization/lbfgs/lbfgscommon.h>
 
+#include <vector>
+
 namespace shogun
 {
 /**
@@ -336,6 +339,59 @@ typedef struct {
     int             orthantwise_end;
 } lbfgs_parameter_t;
 
+/**
+ * An (s,y) correction pair of the limited memory, together with the scalars
+ *  cached for it by the two-loop recursion.
+ */
+struct tag_iteration_data {
+    /** alpha cached by the first loop of the recursion */
+    float64_t alpha;
+    /** s = x_{k+1} - x_{k}, [n] */
+    SGVector<float64_t> s;
+    /** y = g_{k+1} - g_{k}, [n] */
+    SGVector<float64_t> y;
+    /** vecdot(y, s) */
+    float64_t ys;
+};
+typedef struct tag_iteration_data iteration_data_t;
+
+/**
+ * Reusable L-BFGS working storage.
+ *
+ *  lbfgs() allocates its working vectors and the limited memory of (s,y)
+ *  correction pairs on every invocation. A client program that minimizes
+ *  repeatedly over variables of the same size (for example, refitting
+ *  hyperparameters once per model selection step) can construct a workspace
+ *  once, keep it alive between the calls and pass its address to lbfgs();
+ *  the buffers are then reallocated only when the number of variables or the
+ *  relevant parameters change.
+ */
+struct lbfgs_workspace_t {
+    /** previous values of the variables, [n] */
+    SGVector<float64_t> xp;
+    /** gradient, [n] */
+    SGVector<float64_t> g;
+    /** previous gradient, [n] */
+    SGVector<float64_t> gp;
+    /** search direction, [n] */
+    SGVector<float64_t> d;
+    /** line search scratch space, [n] */
+    SGVector<float64_t> w;
+    /** pseudo gradient for OW-LQN, [n] */
+    SGVector<float64_t> pg;
+    /** previous values of the objective function, [past] */
+    SGVector<float64_t> pf;
+    /** limited memory of correction pairs, [m] */
+    std::vector<iteration_data_t> lm;
+
+    /** Size the buffers for the given problem, reusing the existing
+     *  allocations whenever the sizes already match.
+     *
+     *  @param n the number of variables
+     *  @param param the L-BFGS parameters
+     */
+    void reserve(int n, const lbfgs_parameter_t& param);
+};
 
 /**
  * Callback interface to provide objective function and gradient evaluations.
@@ -476,6 +532,11 @@ In this formula, ||.|| denotes the Euclidean norm.
  *                      structure with the default values.
  *  @param  proc_adjust_step   The callback function to adjust step size based on constraints.
  *                          This argument can be set to \c NULL if there is not constraint.
+ *  @param  workspace   The pointer to a reusable working storage, so that
+ *                      repeated invocations do not reallocate the working
+ *                      vectors and the limited memory. A client program can
+ *                      set this parameter to \c NULL to let lbfgs() use a
+ *                      local workspace instead.
  *
  *  @retval int         The status code. This function returns zero if the
  *                      minimization process terminates without an error. A
@@ -489,7 +550,8 @@ int lbfgs(
     lbfgs_progress_t proc_progress,
     void *instance,
     lbfgs_parameter_t *param,
-    lbfgs_adjust_step_t proc_adjust_step=NULL
+    lbfgs_adjust_step_t proc_adjust_step=NULL,
+    lbfgs_workspace_t *workspace=NULL
     );
 
 /**
@@ -493,8 +493,16 @@ void Solver_MCSVM_CS::solve(PRNG& prng)
 	active_size_i = state->active_size_i;
 
 	double* tx = SG_MALLOC(double, w_size);
+	double* Gfull = SG_MALLOC(double, nr_class);
 	int dim = prob->x->get_dim_feature_space();
 
+	/* w stores the classes of one feature contiguously, so it is a
+	 * column-major nr_class x dim matrix and all class scores of one
+	 * example are a single GEMV against it */
+	SGMatrix<float64_t> w_mat(w, nr_class, dim, false);
+	SGVector<float64_t> tx_vec(tx, dim, false);
+	SGVector<float64_t> Gfull_vec(Gfull, nr_class, false);
+
 	int active_size = l;
 	double eps_shrink = Math::max(10.0*eps, 1.0); // stopping tolerance for shrinking
 	bool start_from_all = true;
@@ -540,14 +548,23 @@ void Solver_MCSVM_CS::solve(PRNG& prng)
 
 				memset(tx,0,dim*sizeof(double));
 				prob->x->add_to_dense_vec(1.0,i,tx,dim);
-				for (k=0; k<dim; k++)
+				if (active_size_i[i] == nr_class)
 				{
-					if (tx[k]==0.0)
-						continue;
+					linalg::matrix_prod(w_mat, tx_vec, Gfull_vec);
+					for (m=0; m<nr_class; m++)
+						G[m] += Gfull[alpha_index_i[m]];
+				}
+				else
+				{
+					for (k=0; k<dim; k++)
+					{
+						if (tx[k]==0.0)
+							continue;
 
-					double* w_i = &w[k*nr_class];
-					for (m=0; m<active_size_i[i]; m++)
-						G[m] += w_i[alpha_index_i[m]]*tx[k];
+						double* w_i = &w[k*nr_class];
+						for (m=0; m<active_size_i[i]; m++)
+							G[m] += w_i[alpha_index_i[m]]*tx[k];
+					}
 				}
 
 				// experimental
@@ -635,8 +652,7 @@ void Solver_MCSVM_CS::solve(PRNG& prng)
 					}
 				}
 
-				memset(tx,0,dim*sizeof(double));
-				prob->x->add_to_dense_vec(1.0,i,tx,dim);
+				/* tx still holds example i from the score computation */
 				for (k=0; k<dim; k++)
 				{
 					if (tx[k]==0.0)
@@ -692,6 +708,7 @@ void Solver_MCSVM_CS::solve(PRNG& prng)
 		io::info("Warning: reaching max number of iterations");
 
 	SG_FREE(tx);
+	SG_FREE(Gfull);
 }
 
 template void Solver_MCSVM_CS::solve<std::mt19937_64>(std::mt19937_64& prng);
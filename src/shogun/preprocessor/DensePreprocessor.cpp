@@ -93,9 +93,16 @@ std::shared_ptr<Features> DensePreprocessor<ST>::transform(std::shared_ptr<Featu
 			features->get_feature_class(), C_DENSE);
 
 	auto matrix = features->as<DenseFeatures<ST>>()->get_feature_matrix();
-	if (!inplace)
+	if (!inplace && writes_input_matrix())
 		matrix = matrix.clone();
 	auto feat_matrix = apply_to_matrix(matrix);
+	/* zero-copy chaining: an in-place stage that kept buffer and shape
+	 * needs no fresh feature object */
+	if (inplace && feat_matrix.matrix == matrix.matrix &&
+	    feat_matrix.num_rows == matrix.num_rows &&
+	    feat_matrix.num_cols == matrix.num_cols &&
+	    !features->get_subset_stack()->has_subsets())
+		return features;
 	return std::make_shared<DenseFeatures<ST>>(feat_matrix);
 }
 
@@ -110,9 +117,14 @@ DensePreprocessor<ST>::inverse_transform(std::shared_ptr<Features> features, boo
 		features->get_feature_class(), C_DENSE);
 
 	auto matrix = features->as<DenseFeatures<ST>>()->get_feature_matrix();
-	if (!inplace)
+	if (!inplace && writes_input_matrix())
 		matrix = matrix.clone();
 	auto feat_matrix = inverse_apply_to_matrix(matrix);
+	if (inplace && feat_matrix.matrix == matrix.matrix &&
+	    feat_matrix.num_rows == matrix.num_rows &&
+	    feat_matrix.num_cols == matrix.num_cols &&
+	    !features->get_subset_stack()->has_subsets())
+		return features;
 	return std::make_shared<DenseFeatures<ST>>(feat_matrix);
 }
 
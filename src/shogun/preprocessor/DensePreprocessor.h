@@ -72,6 +72,20 @@ template <class ST> class DensePreprocessor : public Preprocessor
 		 */
 		virtual SGMatrix<ST> apply_to_matrix(SGMatrix<ST> matrix) = 0;
 
+		/** Declared capability of apply_to_matrix() and
+		 * inverse_apply_to_matrix(): whether they may write to the matrix
+		 * they are given. transform() takes a defensive copy of the input
+		 * for inplace=false only when this returns true, so preprocessors
+		 * that always allocate a fresh result matrix and leave their input
+		 * untouched should override this to return false and save a full
+		 * copy of the data. The conservative default is true.
+		 * @return whether the preprocessor writes its input matrix
+		 */
+		virtual bool writes_input_matrix() const
+		{
+			return true;
+		}
+
 		/** Inverse apply preprocessor on matrix. Subclasses should try to apply
 		 * in place to avoid copying.
 		 * @param matrix the input feature matrix
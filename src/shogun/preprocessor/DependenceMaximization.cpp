@@ -31,6 +31,7 @@
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/labels/Labels.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SubsetStack.h>
 #include <shogun/statistical_testing/IndependenceTest.h>
 #include <shogun/preprocessor/DependenceMaximization.h>
 #include <shogun/mathematics/Math.h>
@@ -52,6 +53,8 @@ void DependenceMaximization::init()
 
 	m_estimator=NULL;
 	m_labels_feats=NULL;
+	m_scratch_feats=NULL;
+	m_scratch_idx=-1;
 }
 
 DependenceMaximization::~DependenceMaximization()
@@ -88,13 +91,43 @@ std::shared_ptr<Features> DependenceMaximization::create_transformed_copy(std::s
 	return features->copy_dimension_subset(dims);
 }
 
+void DependenceMaximization::adapt_params(std::shared_ptr<Features> features)
+{
+	// the features change between elimination rounds, so any cached reduced
+	// copy from the previous round is stale
+	m_scratch_feats=NULL;
+	m_scratch_idx=-1;
+}
+
 float64_t DependenceMaximization::compute_measures(std::shared_ptr<Features> features,
 		index_t idx)
 {
 	SG_TRACE("Entering!");
 
-	// remove the dimension (feat) specified by the index idx
-	auto reduced_feats=create_transformed_copy(features, idx);
+	// remove the dimension (feat) specified by the index idx. when the
+	// candidates are scanned in increasing order, the reduced set for idx
+	// differs from the one for idx-1 only in row idx-1 (which now holds
+	// dimension idx-1 instead of idx), so the cached copy is downdated in
+	// place instead of copying the whole matrix again
+	std::shared_ptr<Features> reduced_feats;
+	auto d_feats=std::dynamic_pointer_cast<DenseFeatures<float64_t>>(features);
+	bool plain_dense=d_feats && !d_feats->get_subset_stack()->has_subsets();
+
+	if (plain_dense && m_scratch_feats && idx==m_scratch_idx+1)
+	{
+		SGMatrix<float64_t> source=d_feats->get_feature_matrix();
+		SGMatrix<float64_t> scratch=
+			m_scratch_feats->as<DenseFeatures<float64_t>>()->get_feature_matrix();
+		for (index_t j=0; j<source.num_cols; ++j)
+			scratch(idx-1, j)=source(idx-1, j);
+		reduced_feats=m_scratch_feats;
+	}
+	else
+	{
+		reduced_feats=create_transformed_copy(features, idx);
+		m_scratch_feats=plain_dense ? reduced_feats : NULL;
+	}
+	m_scratch_idx=idx;
 	ASSERT(reduced_feats);
 
 	// perform an independence test for X\X_i ~ p and Y ~ q with
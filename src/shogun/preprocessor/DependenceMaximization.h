@@ -142,6 +142,25 @@ protected:
 	 */
 	virtual std::shared_ptr<Features> create_transformed_copy(std::shared_ptr<Features> features, index_t idx);
 
+	/**
+	 * Invalidates the cached reduced copy since the features change between
+	 * elimination rounds
+	 *
+	 * @param features the features on which measures will be computed next
+	 */
+	void adapt_params(std::shared_ptr<Features> features) override;
+
+	/**
+	 * Cached reduced copy reused across consecutive compute_measures()
+	 * calls within one elimination round. The reduced sets for candidates
+	 * \f$i-1\f$ and \f$i\f$ differ in a single dimension, so only that row
+	 * is downdated in place instead of copying the whole matrix again
+	 */
+	std::shared_ptr<Features> m_scratch_feats;
+
+	/** candidate index #m_scratch_feats corresponds to, -1 if none */
+	index_t m_scratch_idx;
+
 	/**
 	 * The estimator for performing statistical tests for independence which
 	 * is used for computing measures
@@ -70,6 +70,15 @@ void FisherLDA::initialize_parameters()
 	m_num_dim=0;
 	m_gamma = 0;
 	m_bdc_svd = true;
+	m_fitted_data = NULL;
+	m_fitted_labels = NULL;
+	m_fitted_num_features = 0;
+	m_fitted_num_vectors = 0;
+	m_fitted_num_dim = 0;
+	m_fitted_gamma = 0;
+	m_fitted_threshold = 0;
+	m_fitted_method = AUTO_FLDA;
+	m_fitted_bdc_svd = true;
 	SG_ADD(
 	    &m_num_dim, "final_dimensions", "dimensions to be retained");
 	SG_ADD(&m_gamma, "m_gamma", "Regularization parameter");
@@ -129,6 +138,27 @@ void FisherLDA::fit(std::shared_ptr<Features> features, std::shared_ptr<Labels>
 	if ((m_num_dim <= 0) || (m_num_dim > (num_class - 1)))
 		m_num_dim = (num_class - 1);
 
+	// sliding-window callers tend to re-fit repeatedly; when fit is called
+	// again on the very same data, labels and hyperparameters the cached
+	// factorization is still valid and the decomposition can be skipped
+	// entirely. The hyperparameters feed the solvers, so any change to
+	// them (e.g. a grid search over gamma, or a new final_dimensions)
+	// must refit; m_num_dim is compared after the clip above so that a
+	// clipped-back value does not count as a change
+	const void* data_identity = dense_features->get_feature_matrix().matrix;
+	const void* labels_identity = mc->get_labels().vector;
+	if (m_fitted.load() && data_identity == m_fitted_data &&
+	    labels_identity == m_fitted_labels &&
+	    num_features == m_fitted_num_features &&
+	    num_vectors == m_fitted_num_vectors &&
+	    m_num_dim == m_fitted_num_dim && m_gamma == m_fitted_gamma &&
+	    m_threshold == m_fitted_threshold && m_method == m_fitted_method &&
+	    m_bdc_svd == m_fitted_bdc_svd)
+	{
+		SG_DEBUG("Data unchanged since last fit, reusing factorization.");
+		return;
+	}
+
 	bool lda_more_efficient =
 	    m_method == AUTO_FLDA && num_vectors < num_features;
 
@@ -136,7 +166,16 @@ void FisherLDA::fit(std::shared_ptr<Features> features, std::shared_ptr<Labels>
 		solver_canvar(dense_features, mc);
 	else
 		solver_classic(dense_features, mc);
-	
+
+	m_fitted_data = data_identity;
+	m_fitted_labels = labels_identity;
+	m_fitted_num_features = num_features;
+	m_fitted_num_vectors = num_vectors;
+	m_fitted_num_dim = m_num_dim;
+	m_fitted_gamma = m_gamma;
+	m_fitted_threshold = m_threshold;
+	m_fitted_method = m_method;
+	m_fitted_bdc_svd = m_bdc_svd;
 	m_fitted.store(true);
 }
 
@@ -211,18 +250,12 @@ SGMatrix<float64_t> FisherLDA::apply_to_matrix(SGMatrix<float64_t> matrix)
 
 	Map<MatrixXd> feature_matrix(matrix.matrix, num_features, num_vectors);
 
-	feature_matrix.block(0, 0, m_num_dim, num_vectors) =
-	    transform_matrix.transpose() * feature_matrix;
-
-	io::info("Form matrix of target dimension");
-	for (int32_t col=0; col<num_vectors; col++)
-	{
-		for (int32_t row=0; row<m_num_dim; row++)
-			matrix[col * m_num_dim + row] = feature_matrix(row, col);
-	}
-	matrix.num_rows = m_num_dim;
-	matrix.num_cols = num_vectors;
-	return matrix;
+	// project the whole dataset with a single matrix-matrix product
+	// straight into the reduced matrix
+	SGMatrix<float64_t> result(m_num_dim, num_vectors);
+	Map<MatrixXd> result_matrix(result.matrix, m_num_dim, num_vectors);
+	result_matrix.noalias() = transform_matrix.transpose() * feature_matrix;
+	return result;
 }
 
 SGVector<float64_t> FisherLDA::apply_to_feature_vector(SGVector<float64_t> vector)
@@ -169,6 +169,13 @@ class MulticlassLabels;
 		 */
 		SGMatrix<float64_t> apply_to_matrix(SGMatrix<float64_t> matrix) override;
 
+		/** the projection is written into a fresh reduced matrix, the
+		 * input stays untouched */
+		bool writes_input_matrix() const override
+		{
+			return false;
+		}
+
 		/**
 		 * Train the preprocessor with the canonical variates method.
 		 * @param features training data.
@@ -201,6 +208,23 @@ class MulticlassLabels;
 		SGVector<float64_t> m_mean_vector;
 		/** eigenvalues vector */
 		SGVector<float64_t> m_eigenvalues_vector;
+		/** underlying data the current factorization was fitted on, used to
+		 * skip the decomposition when fit is called again on identical data */
+		const void* m_fitted_data;
+		/** underlying labels the current factorization was fitted on */
+		const void* m_fitted_labels;
+		/** number of features at the time of the last fit */
+		index_t m_fitted_num_features;
+		/** number of vectors at the time of the last fit */
+		index_t m_fitted_num_vectors;
+		/** hyperparameters at the time of the last fit; a change to any
+		 * of them invalidates the cached factorization even when the
+		 * data is identical */
+		int32_t m_fitted_num_dim;
+		float64_t m_fitted_gamma;
+		float64_t m_fitted_threshold;
+		int32_t m_fitted_method;
+		bool m_fitted_bdc_svd;
 };
 }
 #endif //ifndef
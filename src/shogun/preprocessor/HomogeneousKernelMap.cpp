@@ -5,7 +5,6 @@
  *          Evgeniy Andreev, Evan Shelhamer, Bjoern Esser
  */
 
-#include <shogun/base/range.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/preprocessor/HomogeneousKernelMap.h>
@@ -154,11 +153,13 @@ HomogeneousKernelMap::apply_to_matrix(SGMatrix<float64_t> matrix)
 	auto num_features = matrix.num_rows;
 
 	SGMatrix<float64_t> feature_matrix(num_features*(2*m_order+1),num_vectors);
-	for (auto i : range(num_vectors))
+	// the lookup table is read-only here and every column is mapped
+	// straight into its own slice of the output matrix
+#pragma omp parallel for
+	for (index_t i = 0; i < num_vectors; ++i)
 	{
-		SGVector<float64_t> transformed = apply_to_vector(matrix.get_column(i));
-		for (auto j : range(transformed.vlen))
-			feature_matrix(j,i) = transformed[j];
+		map_vector(matrix.get_column_vector(i), num_features,
+			feature_matrix.get_column_vector(i));
 	}
 
 	return feature_matrix;
@@ -293,12 +294,19 @@ SGVector<float64_t> HomogeneousKernelMap::apply_to_vector(const SGVector<float64
 	uint64_t featureDimension = 2*m_order+1;
 
 	SGVector<float64_t> out_v(featureDimension*in_v.vlen);
+	map_vector (in_v.vector, in_v.vlen, out_v.vector);
+	return out_v;
+}
+
+void HomogeneousKernelMap::map_vector(const float64_t* in, index_t in_len, float64_t* out) const
+{
+	uint64_t featureDimension = 2*m_order+1;
 
-	for (int k = 0; k < in_v.vlen; ++k) {
+	for (int k = 0; k < in_len; ++k) {
 		/* break value into exponent and mantissa */
 		int exponent;
 		int unsigned j;
-		float64_t mantissa = std::frexp (in_v[k], &exponent);
+		float64_t mantissa = std::frexp (in[k], &exponent);
 		float64_t sign = (mantissa >= 0.0) ? +1.0 : -1.0;
 		mantissa *= 2*sign;
 		exponent -- ;
@@ -308,32 +316,33 @@ SGVector<float64_t> HomogeneousKernelMap::apply_to_vector(const SGVector<float64
 				exponent >= m_maxExponent)
 		{
 			for (j = 0 ; j <= m_order ; ++j) {
-				out_v[k*featureDimension+j] = 0.0;
+				out[k*featureDimension+j] = 0.0;
 			}
 			continue;
 		}
 
-		//uint64_t featureDimension = 2*m_order+1;
+		/* locate the interpolation bin arithmetically instead of
+		 * scanning the mantissa range one subdivision at a time */
+		mantissa -= 1.0;
+		uint64_t bin = static_cast<uint64_t>(mantissa * m_numSubdivisions);
+		if (bin >= m_numSubdivisions)
+			bin = m_numSubdivisions - 1;
+		mantissa -= bin * m_subdivision;
+
 		float64_t const * v1 = m_table.vector +
-			(exponent - m_minExponent) * m_numSubdivisions * featureDimension;
-		float64_t const * v2;
+			((exponent - m_minExponent) * m_numSubdivisions + bin) * featureDimension;
+		float64_t const * v2 = v1 + featureDimension;
 		float64_t f1, f2;
 
-		mantissa -= 1.0;
-		while (mantissa >= m_subdivision) {
-			mantissa -= m_subdivision;
-			v1 += featureDimension;
-		}
-
-		v2 = v1 + featureDimension;
+		/* tight interpolation loop over contiguous table rows, friendly
+		 * to compiler vectorization */
 		for (j = 0 ; j < featureDimension ; ++j) {
 			f1 = *v1++;
 			f2 = *v2++;
 
-			out_v[k*featureDimension+j] = sign * ((f2 - f1) * (m_numSubdivisions * mantissa) + f1);
+			out[k*featureDimension+j] = sign * ((f2 - f1) * (m_numSubdivisions * mantissa) + f1);
 		}
 	}
-	return out_v;
 }
 
 void HomogeneousKernelMap::register_params()
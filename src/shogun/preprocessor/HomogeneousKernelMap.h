@@ -130,6 +130,13 @@ namespace shogun
 		    SGMatrix<float64_t>
 		    apply_to_matrix(SGMatrix<float64_t> matrix) override;
 
+		    /** the map always allocates a fresh expanded matrix and never
+		     * touches its input, so no defensive copy is needed */
+		    bool writes_input_matrix() const override
+		    {
+			    return false;
+		    }
+
 		private:
 			void init ();
 			void register_params ();
@@ -137,6 +144,7 @@ namespace shogun
 			inline float64_t sinc (float64_t x) const;
 			inline float64_t get_spectrum (float64_t omega) const;
 			SGVector<float64_t> apply_to_vector(const SGVector<float64_t>& in_v) const;
+			void map_vector (const float64_t* in, index_t in_len, float64_t* out) const;
 
 		private:
 			HomogeneousKernelType m_kernel;
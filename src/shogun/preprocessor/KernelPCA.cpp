@@ -19,6 +19,8 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/lib/common.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
 
 using namespace shogun;
 
@@ -87,8 +89,23 @@ void KernelPCA::fit(std::shared_ptr<Features> features)
 
 	SGVector<float64_t> eigenvalues(m_target_dim);
 	SGMatrix<float64_t> eigenvectors(kernel_matrix.num_rows, m_target_dim);
-	linalg::eigen_solver_symmetric(
-	    kernel_matrix, eigenvalues, eigenvectors, m_target_dim);
+	if (RandomizedEigenSolver::is_preferred(n, m_target_dim))
+	{
+		// few components of a large kernel matrix: a randomized top-k
+		// decomposition avoids the full eigendecomposition; the result
+		// follows the same increasing-order layout
+		auto op = std::make_shared<DenseMatrixOperator<float64_t>>(kernel_matrix);
+		auto eigen_solver =
+		    std::make_shared<RandomizedEigenSolver>(op, m_target_dim);
+		eigen_solver->compute();
+		eigenvalues = eigen_solver->get_eigenvalues();
+		eigenvectors = eigen_solver->get_eigenvectors();
+	}
+	else
+	{
+		linalg::eigen_solver_symmetric(
+		    kernel_matrix, eigenvalues, eigenvectors, m_target_dim);
+	}
 
 	m_transformation_matrix =
 	    SGMatrix<float64_t>(kernel_matrix.num_rows, m_target_dim);
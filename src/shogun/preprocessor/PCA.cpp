@@ -7,9 +7,12 @@
 #include <shogun/lib/config.h>
 
 #include <shogun/features/Features.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
 #include <shogun/preprocessor/DensePreprocessor.h>
 #include <shogun/preprocessor/PCA.h>
 
@@ -51,6 +54,7 @@ void PCA::init()
 	m_method = AUTO;
 	m_eigenvalue_zero_tolerance = 1e-15;
 	m_target_dim = 1;
+	m_block_size = 1024;
 
 	SG_ADD(
 	    &m_transformation_matrix, "transformation_matrix",
@@ -72,6 +76,9 @@ void PCA::init()
 	SG_ADD(
 	    &m_target_dim, "target_dim", "target dimensionality of preprocessor",
 	    ParameterProperties::HYPER);
+	SG_ADD(
+	    &m_block_size, "block_size",
+	    "number of vectors accumulated at once when fitting from a stream");
 	SG_ADD_OPTIONS(
 	    (machine_int_t*)&m_mode, "mode", "PCA Mode.",
 	    ParameterProperties::HYPER,
@@ -90,6 +97,110 @@ PCA::~PCA()
 {
 }
 
+void PCA::fit(std::shared_ptr<Features> features)
+{
+	require(features, "No features provided");
+
+	if (features->get_feature_class() == C_STREAMING_DENSE)
+	{
+		fit_streaming(features->as<StreamingDenseFeatures<float64_t>>());
+		m_fitted.store(true);
+		return;
+	}
+
+	DensePreprocessor<float64_t>::fit(features);
+}
+
+void PCA::fit_streaming(
+    const std::shared_ptr<StreamingDenseFeatures<float64_t>>& features)
+{
+	int32_t num_features = 0;
+	int64_t num_vectors = 0;
+	int32_t in_block = 0;
+	MatrixXd scatter;
+	VectorXd data_sum;
+	MatrixXd block;
+
+	features->start_parser();
+	while (features->get_next_example())
+	{
+		SGVector<float64_t> vec = features->get_vector();
+		if (num_features == 0)
+		{
+			num_features = vec.vlen;
+			scatter = MatrixXd::Zero(num_features, num_features);
+			data_sum = VectorXd::Zero(num_features);
+			block = MatrixXd(num_features, m_block_size);
+		}
+		require(
+		    vec.vlen == num_features,
+		    "Streamed vector has {} dimensions, expected {}", vec.vlen,
+		    num_features);
+
+		block.col(in_block++) = Map<VectorXd>(vec.vector, vec.vlen);
+		features->release_example();
+
+		if (in_block == m_block_size)
+		{
+			// rank-block update, only this block and the DxD
+			// accumulators are ever held
+			scatter.noalias() += block * block.transpose();
+			data_sum += block.rowwise().sum();
+			num_vectors += in_block;
+			in_block = 0;
+		}
+	}
+	features->end_parser();
+
+	if (in_block > 0)
+	{
+		auto partial = block.leftCols(in_block);
+		scatter.noalias() += partial * partial.transpose();
+		data_sum += partial.rowwise().sum();
+		num_vectors += in_block;
+	}
+
+	require(
+	    num_vectors > 1, "At least two examples are required, got {}",
+	    num_vectors);
+	io::info("num_examples: {} num_features: {}", num_vectors, num_features);
+
+	auto max_dim_allowed =
+	    static_cast<int32_t>(std::min<int64_t>(num_vectors, num_features));
+	num_dim = 0;
+
+	require(
+	    m_target_dim <= max_dim_allowed,
+	    "target dimension should be less or equal to than minimum of N and D");
+
+	m_mean_vector = SGVector<float64_t>(num_features);
+	Map<VectorXd> data_mean(m_mean_vector.vector, num_features);
+	data_mean = data_sum / (float64_t)num_vectors;
+
+	// E[xx^T] accumulated above, recentered around the streamed mean
+	SGMatrix<float64_t> cov_mat(num_features, num_features);
+	Map<MatrixXd> map_cov(cov_mat.matrix, num_features, num_features);
+	map_cov = (scatter -
+	           (float64_t)num_vectors * data_mean * data_mean.transpose()) /
+	          (float64_t)(num_vectors - 1);
+
+	m_eigenvalues_vector = SGVector<float64_t>(max_dim_allowed);
+
+	// SVD needs the materialized data matrix, the stream only yields a
+	// covariance
+	if (m_method == SVD)
+		io::info("SVD is not available for streamed fits, using EVD");
+	m_method = EVD;
+
+	if (m_mode == FIXED_NUMBER &&
+	    RandomizedEigenSolver::is_preferred(num_features, m_target_dim))
+		init_from_covariance_randomized(
+		    cov_mat, static_cast<int32_t>(num_vectors));
+	else
+		init_from_covariance(
+		    cov_mat, static_cast<int32_t>(num_vectors), max_dim_allowed);
+}
+
 void PCA::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 {
 
@@ -119,7 +230,16 @@ void PCA::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 		m_method = (num_vectors > num_features) ? EVD : SVD;
 
 	if (m_method == EVD)
-		init_with_evd(feature_matrix, max_dim_allowed);
+	{
+		// when only a few of many components are requested, a randomized
+		// top-k decomposition avoids the full eigendecomposition of the
+		// covariance matrix
+		if (m_mode == FIXED_NUMBER &&
+		    RandomizedEigenSolver::is_preferred(num_features, m_target_dim))
+			init_with_randomized_evd(feature_matrix);
+		else
+			init_with_evd(feature_matrix, max_dim_allowed);
+	}
 	else
 		init_with_svd(feature_matrix, max_dim_allowed);
 
@@ -133,17 +253,28 @@ void PCA::init_with_evd(const SGMatrix<float64_t>& feature_matrix, int32_t max_d
 	int32_t num_features = feature_matrix.num_rows;
 
 	Map<MatrixXd> fmatrix(feature_matrix.matrix, num_features, num_vectors);
-	Map<VectorXd> eigenValues(m_eigenvalues_vector.vector, max_dim_allowed);
 
 	// covariance matrix
-	MatrixXd cov_mat(num_features, num_features);
-	cov_mat = fmatrix*fmatrix.transpose();
-	cov_mat /= (num_vectors-1);
+	SGMatrix<float64_t> cov_mat(num_features, num_features);
+	Map<MatrixXd> map_cov(cov_mat.matrix, num_features, num_features);
+	map_cov = fmatrix*fmatrix.transpose();
+	map_cov /= (num_vectors-1);
+
+	init_from_covariance(cov_mat, num_vectors, max_dim_allowed);
+}
+
+void PCA::init_from_covariance(const SGMatrix<float64_t>& cov_mat,
+		int32_t num_vectors, int32_t max_dim_allowed)
+{
+	int32_t num_features = cov_mat.num_rows;
+
+	Map<MatrixXd> map_cov(cov_mat.matrix, num_features, num_features);
+	Map<VectorXd> eigenValues(m_eigenvalues_vector.vector, max_dim_allowed);
 
 	io::info("Computing Eigenvalues");
 	// eigen value computed
 	SelfAdjointEigenSolver<MatrixXd> eigenSolve =
-			SelfAdjointEigenSolver<MatrixXd>(cov_mat);
+			SelfAdjointEigenSolver<MatrixXd>(map_cov);
 	eigenValues = eigenSolve.eigenvalues().tail(max_dim_allowed);
 
 	// target dimension
@@ -211,6 +342,67 @@ void PCA::init_with_evd(const SGMatrix<float64_t>& feature_matrix, int32_t max_d
 	}
 }
 
+void PCA::init_with_randomized_evd(const SGMatrix<float64_t>& feature_matrix)
+{
+	int32_t num_vectors = feature_matrix.num_cols;
+	int32_t num_features = feature_matrix.num_rows;
+
+	Map<MatrixXd> fmatrix(feature_matrix.matrix, num_features, num_vectors);
+
+	// covariance matrix
+	SGMatrix<float64_t> cov_mat(num_features, num_features);
+	Map<MatrixXd> map_cov(cov_mat.matrix, num_features, num_features);
+	map_cov = fmatrix*fmatrix.transpose();
+	map_cov /= (num_vectors-1);
+
+	init_from_covariance_randomized(cov_mat, num_vectors);
+}
+
+void PCA::init_from_covariance_randomized(const SGMatrix<float64_t>& cov_mat,
+		int32_t num_vectors)
+{
+	int32_t num_features = cov_mat.num_rows;
+
+	num_dim = m_target_dim;
+	io::info("Computing top {} Eigenvalues with the randomized solver", num_dim);
+
+	auto op = std::make_shared<DenseMatrixOperator<float64_t>>(cov_mat);
+	auto eigen_solver = std::make_shared<RandomizedEigenSolver>(op, num_dim);
+	eigen_solver->compute();
+
+	// eigenvalues and eigenvectors are in increasing order, matching the
+	// layout of the full decomposition truncated to its top num_dim entries
+	m_eigenvalues_vector = eigen_solver->get_eigenvalues();
+	m_transformation_matrix = eigen_solver->get_eigenvectors();
+	num_old_dim = num_features;
+
+	io::info("Reducing from {} to {} features", num_features, num_dim);
+
+	if (m_whitening)
+	{
+		Map<MatrixXd> transformMatrix(m_transformation_matrix.matrix,
+							 num_features, num_dim);
+		for (int32_t i=0; i<num_dim; i++)
+		{
+			if (Math::fequals_abs<float64_t>(0.0, m_eigenvalues_vector[i],
+									m_eigenvalue_zero_tolerance))
+			{
+				io::warn(
+				    "Covariance matrix has almost zero Eigenvalue (ie "
+				    "Eigenvalue within a tolerance of {:E} around 0) at "
+				    "dimension {}. Consider reducing its dimension.",
+				    m_eigenvalue_zero_tolerance, i + 1);
+
+				transformMatrix.col(i) = MatrixXd::Zero(num_features,1);
+				continue;
+			}
+
+			transformMatrix.col(i) /= std::sqrt(
+			    m_eigenvalues_vector[i] * (num_vectors - 1));
+		}
+	}
+}
+
 void PCA::init_with_svd(const SGMatrix<float64_t> &feature_matrix, int32_t max_dim_allowed)
 {
 	int32_t num_vectors = feature_matrix.num_cols;
@@ -17,6 +17,8 @@
 
 namespace shogun
 {
+template <class T> class StreamingDenseFeatures;
+
 /** Matrix decomposition method for PCA */
 enum EPCAMethod
 {
@@ -74,6 +76,9 @@ enum EPCAMemoryMode
  * The covariance matrix \f$XX^T\f$ is first formed internally and then
  * its eigenvectors and eigenvalues are computed.
  * The time complexity of this method is \f$~10D^3\f$ and should be used when N > D.
+ * In FIXED_NUMBER mode, when only a few components of a large covariance matrix
+ * are requested, a randomized top-k eigendecomposition (see RandomizedEigenSolver)
+ * is used instead of the full decomposition.
  *
  * <em>SVD</em> : Singular Value Decomposition of feature matrix X
  * The transpose of feature matrix, \f$X^T\f$, is decomposed using SVD.\f$X^T = UDV^T\f$
@@ -130,6 +135,17 @@ class PCA : public DensePreprocessor<float64_t>
 		/** destructor */
 		~PCA() override;
 
+		/** Fit the preprocessor. Dense features are handled as before. For
+		 * streaming dense features the fit is blocked and out-of-core: the
+		 * stream is consumed in blocks of block_size vectors, mean and
+		 * covariance are accumulated in a single pass, and the
+		 * transformation matrix is computed from the accumulated
+		 * covariance. The dataset itself is never held in memory, only one
+		 * block and the DxD covariance.
+		 * @param features dense or streaming dense features
+		 */
+		void fit(std::shared_ptr<Features> features) override;
+
 		/** apply preprocessor to feature vector
 		 * @param vector feature vector
 		 * @return processed feature vector
@@ -222,11 +238,29 @@ class PCA : public DensePreprocessor<float64_t>
 		/** target dimension */
 		int32_t m_target_dim;
 
+		/** number of vectors accumulated at once in the streaming fit */
+		int32_t m_block_size;
+
 	private:
 		/** Computes the transformation matrix using an eigenvalue decomposition. */
 		void init_with_evd(const SGMatrix<float64_t>& feature_matrix, int32_t max_dim_allowed);
 		/** Computes the transformation matrix using svd */
 		void init_with_svd(const SGMatrix<float64_t>& feature_matrix, int32_t max_dim_allowed);
+		/** Computes the transformation matrix using a randomized range-finder
+		 * eigenvalue decomposition of the covariance matrix. Only the top
+		 * target_dim eigenpairs are computed, so this is used in FIXED_NUMBER
+		 * mode when few components of a large covariance are requested.
+		 */
+		void init_with_randomized_evd(const SGMatrix<float64_t>& feature_matrix);
+		/** Full eigendecomposition of an already accumulated covariance. */
+		void init_from_covariance(const SGMatrix<float64_t>& cov_mat,
+				int32_t num_vectors, int32_t max_dim_allowed);
+		/** Randomized top target_dim eigendecomposition of an already
+		 * accumulated covariance. */
+		void init_from_covariance_randomized(const SGMatrix<float64_t>& cov_mat,
+				int32_t num_vectors);
+		/** Single-pass blocked mean/covariance accumulation over a stream. */
+		void fit_streaming(const std::shared_ptr<StreamingDenseFeatures<float64_t>>& features);
 };
 }
 #endif // PCA_H_
@@ -6,6 +6,7 @@
  */
 
 #include <shogun/features/Features.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/io/SGIO.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
@@ -27,6 +28,57 @@ PruneVarSubMean::~PruneVarSubMean()
 
 }
 
+void PruneVarSubMean::fit(std::shared_ptr<Features> features)
+{
+	require(features, "No features provided");
+
+	if (features->get_feature_class() != C_STREAMING_DENSE)
+	{
+		DensePreprocessor<float64_t>::fit(features);
+		return;
+	}
+
+	io::info("Accumulating running moments from the stream");
+
+	auto stream = features->as<StreamingDenseFeatures<float64_t>>();
+	m_num_observed = 0;
+
+	stream->start_parser();
+	while (stream->get_next_example())
+	{
+		SGVector<float64_t> vec = stream->get_vector();
+		if (m_num_observed == 0)
+		{
+			m_running_mean = SGVector<float64_t>(vec.vlen);
+			m_running_mean.zero();
+			m_running_m2 = SGVector<float64_t>(vec.vlen);
+			m_running_m2.zero();
+		}
+		else
+		{
+			require(vec.vlen == m_running_mean.vlen,
+			    "Dimension of streamed example ({}) does not match the "
+			    "previous examples ({})!", vec.vlen, m_running_mean.vlen);
+		}
+
+		// standard Welford update of the running moments
+		m_num_observed++;
+		for (index_t j = 0; j < vec.vlen; j++)
+		{
+			float64_t delta = vec[j] - m_running_mean[j];
+			m_running_mean[j] += delta / m_num_observed;
+			m_running_m2[j] += delta * (vec[j] - m_running_mean[j]);
+		}
+		stream->release_example();
+	}
+	stream->end_parser();
+
+	require(m_num_observed > 0, "No examples were streamed!");
+
+	derive_from_stats();
+	m_fitted.store(true);
+}
+
 void PruneVarSubMean::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 {
 
@@ -36,31 +88,42 @@ void PruneVarSubMean::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 	m_idx = SGVector<int32_t>();
 	m_std = SGVector<float64_t>();
 
-	SGVector<float64_t> var(num_features);
-
 	// compute mean
-	m_mean = linalg::rowwise_sum(feature_matrix);
-	linalg::scale(m_mean, m_mean, 1.0 / num_examples);
-
-	// compute var
-	for (auto i : range(num_examples))
+	auto mean = linalg::rowwise_sum(feature_matrix);
+	linalg::scale(mean, mean, 1.0 / num_examples);
+
+	// accumulate the squared deviations of each feature; the features are
+	// independent, so every row is reduced in parallel
+	SGVector<float64_t> m2(num_features);
+#pragma omp parallel for
+	for (index_t j = 0; j < num_features; j++)
 	{
-		for (auto j : range(num_features))
+		float64_t acc = 0;
+		for (index_t i = 0; i < num_examples; i++)
 		{
-			auto diff =
-			    linalg::add(m_mean, feature_matrix.get_column(i), 1.0, -1.0);
-			var[j] += linalg::dot(diff, diff);
+			float64_t diff = feature_matrix(j, i) - mean[j];
+			acc += diff * diff;
 		}
+		m2[j] = acc;
 	}
 
+	m_running_mean = mean;
+	m_running_m2 = m2;
+	m_num_observed = num_examples;
+
+	derive_from_stats();
+}
+
+void PruneVarSubMean::derive_from_stats()
+{
+	auto num_features = m_running_mean.vlen;
+
 	int32_t num_ok = 0;
 	auto idx_ok = SGVector<int32_t>(num_features);
 
 	for (auto j : range(num_features))
 	{
-		var[j] /= num_examples;
-
-		if (var[j] >= 1e-14)
+		if (m_running_m2[j] / m_num_observed >= 1e-14)
 		{
 			idx_ok[num_ok] = j;
 			num_ok++;
@@ -69,19 +132,42 @@ void PruneVarSubMean::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 
 	io::info("Reducing number of features from {} to {}", num_features, num_ok);
 
-	m_idx.resize_vector(num_ok);
-	SGVector<float64_t> new_mean(num_ok);
-	m_std.resize_vector(num_ok);
+	m_idx = SGVector<int32_t>(num_ok);
+	m_mean = SGVector<float64_t>(num_ok);
+	m_std = SGVector<float64_t>(num_ok);
 
 	for (auto j : range(num_ok))
 	{
 		m_idx[j] = idx_ok[j];
-		new_mean[j] = m_mean[idx_ok[j]];
-		m_std[j] = std::sqrt(var[idx_ok[j]]);
+		m_mean[j] = m_running_mean[idx_ok[j]];
+		m_std[j] = std::sqrt(m_running_m2[idx_ok[j]] / m_num_observed);
 	}
 	m_num_idx = num_ok;
-	m_mean = new_mean;
+}
 
+void PruneVarSubMean::update(const SGVector<float64_t>& vector)
+{
+	assert_fitted();
+	require(vector.vlen == m_running_mean.vlen,
+	    "Dimension of the given example ({}) does not match the fitted "
+	    "features ({})!", vector.vlen, m_running_mean.vlen);
+
+	// standard Welford update of the running moments
+	m_num_observed++;
+	for (index_t j = 0; j < vector.vlen; j++)
+	{
+		float64_t delta = vector[j] - m_running_mean[j];
+		m_running_mean[j] += delta / m_num_observed;
+		m_running_m2[j] += delta * (vector[j] - m_running_mean[j]);
+	}
+
+	// the pruned feature set stays fixed, only the statistics of the
+	// retained features are refreshed
+	for (auto j : range(m_num_idx))
+	{
+		m_mean[j] = m_running_mean[m_idx[j]];
+		m_std[j] = std::sqrt(m_running_m2[m_idx[j]] / m_num_observed);
+	}
 }
 
 SGMatrix<float64_t>
@@ -138,6 +224,9 @@ void PruneVarSubMean::init()
 	m_idx = SGVector<int32_t>();
 	m_mean = SGVector<float64_t>();
 	m_std = SGVector<float64_t>();
+	m_running_mean = SGVector<float64_t>();
+	m_running_m2 = SGVector<float64_t>();
+	m_num_observed = 0;
 }
 
 void PruneVarSubMean::register_parameters()
@@ -147,4 +236,9 @@ void PruneVarSubMean::register_parameters()
 	SG_ADD(&m_std, "std_vec", "Standard dev vector");
 	SG_ADD(&m_mean, "mean_vec", "Mean vector");
 	SG_ADD(&m_idx, "idx_vec", "Index vector");
+	SG_ADD(&m_running_mean, "running_mean", "Running mean of all features");
+	SG_ADD(
+	    &m_running_m2, "running_m2",
+	    "Running sum of squared deviations of all features");
+	SG_ADD(&m_num_observed, "num_observed", "Number of observed examples");
 }
@@ -35,11 +35,28 @@ class PruneVarSubMean : public DensePreprocessor<float64_t>
 		/** destructor */
 		~PruneVarSubMean() override;
 
+		/** Fits mean and variance statistics. In addition to in-memory
+		 * dense features, streaming dense features are supported, in which
+		 * case the running moments are accumulated in a single pass over
+		 * the stream.
+		 *
+		 * @param features the features to fit on
+		 */
+		void fit(std::shared_ptr<Features> features) override;
 
 		/// apply preproc on single feature vector
 		/// result in feature matrix
 		SGVector<float64_t> apply_to_feature_vector(SGVector<float64_t> vector) override;
 
+		/** Folds a single newly observed example into the running moments
+		 * and refreshes mean and standard deviation of the retained
+		 * features, so the normalization can track drift without a batch
+		 * refit. The pruned feature set itself stays fixed at fit time.
+		 *
+		 * @param vector the newly observed example
+		 */
+		void update(const SGVector<float64_t>& vector);
+
 		/** @return object name */
 		const char* get_name() const override { return "PruneVarSubMean"; }
 
@@ -55,6 +72,10 @@ class PruneVarSubMean : public DensePreprocessor<float64_t>
 		void init();
 		void register_parameters();
 
+		/** prunes low-variance features and compacts mean/std from the
+		 * running moments */
+		void derive_from_stats();
+
 	protected:
 		/** idx */
 		SGVector<int32_t> m_idx;
@@ -66,6 +87,12 @@ class PruneVarSubMean : public DensePreprocessor<float64_t>
 		int32_t m_num_idx;
 		/** divide by std */
 		bool m_divide_by_std;
+		/** running mean over all (unpruned) features, kept for update() */
+		SGVector<float64_t> m_running_mean;
+		/** running sum of squared deviations over all features */
+		SGVector<float64_t> m_running_m2;
+		/** number of examples folded into the running moments */
+		int64_t m_num_observed;
 };
 }
 #endif
@@ -82,6 +82,13 @@ public:
 
 	SGMatrix<float64_t> apply_to_matrix(SGMatrix<float64_t> matrix) override;
 
+	/** the projection always allocates a fresh matrix and never touches
+	 *  its input, so no defensive copy is needed */
+	bool writes_input_matrix() const override
+	{
+		return false;
+	}
+
 	void fit_impl(const SGMatrix<float64_t>& feature_matrix) override;
 
 	/** Helper method which generates random coefficients and stores in the
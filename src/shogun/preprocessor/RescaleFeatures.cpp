@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <shogun/base/range.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/preprocessor/RescaleFeatures.h>
 
@@ -21,6 +22,58 @@ RescaleFeatures::~RescaleFeatures()
 
 }
 
+void RescaleFeatures::fit(std::shared_ptr<Features> features)
+{
+	require(features, "No features provided");
+
+	if (features->get_feature_class() != C_STREAMING_DENSE)
+	{
+		DensePreprocessor<float64_t>::fit(features);
+		return;
+	}
+
+	io::info("Extracting min and range values from the stream");
+
+	auto stream = features->as<StreamingDenseFeatures<float64_t>>();
+	index_t num_examples = 0;
+
+	stream->start_parser();
+	while (stream->get_next_example())
+	{
+		SGVector<float64_t> vec = stream->get_vector();
+		if (num_examples == 0)
+		{
+			m_obs_min = SGVector<float64_t>(vec.vlen);
+			m_obs_max = SGVector<float64_t>(vec.vlen);
+			for (index_t i = 0; i < vec.vlen; i++)
+			{
+				m_obs_min[i] = vec[i];
+				m_obs_max[i] = vec[i];
+			}
+		}
+		else
+		{
+			require(vec.vlen == m_obs_min.vlen,
+			    "Dimension of streamed example ({}) does not match the "
+			    "previous examples ({})!", vec.vlen, m_obs_min.vlen);
+			for (index_t i = 0; i < vec.vlen; i++)
+			{
+				m_obs_min[i] = std::min(vec[i], m_obs_min[i]);
+				m_obs_max[i] = std::max(vec[i], m_obs_max[i]);
+			}
+		}
+		num_examples++;
+		stream->release_example();
+	}
+	stream->end_parser();
+
+	require(
+	    num_examples > 1, "number of feature vectors should be at least 2!");
+
+	derive_scaling();
+	m_fitted.store(true);
+}
+
 void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 {
 	int32_t num_examples = feature_matrix.num_cols;
@@ -30,8 +83,10 @@ void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 
 	io::info("Extracting min and range values for each feature");
 
-	m_min = SGVector<float64_t>(num_features);
-	m_range = SGVector<float64_t>(num_features);
+	m_obs_min = SGVector<float64_t>(num_features);
+	m_obs_max = SGVector<float64_t>(num_features);
+	// every feature accumulates its own bounds
+#pragma omp parallel for
 	for (index_t i = 0; i < num_features; i++)
 	{
 		SGVector<float64_t> vec = feature_matrix.get_row_vector(i);
@@ -45,11 +100,26 @@ void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 			cur_max = std::max(vec[j], cur_max);
 		}
 
+		m_obs_min[i] = cur_min;
+		m_obs_max[i] = cur_max;
+	}
+
+	derive_scaling();
+}
+
+void RescaleFeatures::derive_scaling()
+{
+	index_t num_features = m_obs_min.vlen;
+
+	m_min = SGVector<float64_t>(num_features);
+	m_range = SGVector<float64_t>(num_features);
+	for (index_t i = 0; i < num_features; i++)
+	{
 		/* only rescale if range > 0 */
-		if ((cur_max - cur_min) > 0)
+		if ((m_obs_max[i] - m_obs_min[i]) > 0)
 		{
-			m_min[i] = cur_min;
-			m_range[i] = 1.0 / (cur_max - cur_min);
+			m_min[i] = m_obs_min[i];
+			m_range[i] = 1.0 / (m_obs_max[i] - m_obs_min[i]);
 		}
 		else
 		{
@@ -57,7 +127,21 @@ void RescaleFeatures::fit_impl(const SGMatrix<float64_t>& feature_matrix)
 			m_range[i] = 1.0;
 		}
 	}
+}
 
+void RescaleFeatures::update(const SGVector<float64_t>& vector)
+{
+	assert_fitted();
+	require(vector.vlen == m_obs_min.vlen,
+	    "Dimension of the given example ({}) does not match the fitted "
+	    "features ({})!", vector.vlen, m_obs_min.vlen);
+
+	for (index_t i = 0; i < vector.vlen; i++)
+	{
+		m_obs_min[i] = std::min(vector[i], m_obs_min[i]);
+		m_obs_max[i] = std::max(vector[i], m_obs_max[i]);
+	}
+	derive_scaling();
 }
 
 SGMatrix<float64_t>
@@ -95,4 +179,6 @@ void RescaleFeatures::register_parameters()
 {
 	SG_ADD(&m_min, "min", "minimum values of each feature");
 	SG_ADD(&m_range, "range", "Reciprocal of the range of each feature");
+	SG_ADD(&m_obs_min, "obs_min", "observed minimum of each feature");
+	SG_ADD(&m_obs_max, "obs_max", "observed maximum of each feature");
 }
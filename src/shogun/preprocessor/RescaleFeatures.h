@@ -32,12 +32,28 @@ namespace shogun
 		/** dtor */
 		~RescaleFeatures() override;
 
+		/** Fits the rescaling bounds. In addition to in-memory dense
+		 * features, streaming dense features are supported, in which case
+		 * the bounds are accumulated in a single pass over the stream.
+		 *
+		 * @param features the features to fit on
+		 */
+		void fit(std::shared_ptr<Features> features) override;
+
 		/**
 		 * Apply preproc on a single feature vector
 		 */
 		SGVector<float64_t>
 		apply_to_feature_vector(SGVector<float64_t> vector) override;
 
+		/** Widens the observed per-feature bounds with a single example
+		 * without refitting, so that the scaling can track drift in online
+		 * pipelines.
+		 *
+		 * @param vector the newly observed example
+		 */
+		void update(const SGVector<float64_t>& vector);
+
 		/** @return object name */
 		const char* get_name() const override
 		{
@@ -53,6 +69,9 @@ namespace shogun
 	private:
 		void register_parameters();
 
+		/** derives #m_min and #m_range from the observed bounds */
+		void derive_scaling();
+
 	protected:
 		SGMatrix<float64_t> apply_to_matrix(SGMatrix<float64_t> matrix) override;
 
@@ -62,6 +81,10 @@ namespace shogun
 		SGVector<float64_t> m_min;
 		/** 1.0/(max[i]-min[i]) */
 		SGVector<float64_t> m_range;
+		/** observed minimum of each feature, kept for update() */
+		SGVector<float64_t> m_obs_min;
+		/** observed maximum of each feature, kept for update() */
+		SGVector<float64_t> m_obs_max;
 	};
 }
 
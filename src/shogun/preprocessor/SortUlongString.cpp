@@ -39,12 +39,14 @@ bool SortUlongString::save(FILE* f)
 
 void SortUlongString::apply_to_string_list(std::vector<SGVector<uint64_t>>& string_list)
 {
-	for (auto& vec : string_list)
+	// each string is sorted in place independently of the others
+#pragma omp parallel for
+	for (index_t i = 0; i < static_cast<index_t>(string_list.size()); ++i)
 	{
-		SG_DEBUG("sorting string of length {}", vec.vlen);
+		SG_DEBUG("sorting string of length {}", string_list[i].vlen);
 
 		//Math::qsort(vec, len);
-		Math::radix_sort(vec.vector, vec.vlen);
+		Math::radix_sort(string_list[i].vector, string_list[i].vlen);
 	}
 }
 
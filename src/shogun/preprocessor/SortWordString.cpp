@@ -38,10 +38,12 @@ bool SortWordString::save(FILE* f)
 
 void SortWordString::apply_to_string_list(std::vector<SGVector<uint16_t>>& string_list)
 {
-	for (auto& vec : string_list)
+	// each string is sorted in place independently of the others
+#pragma omp parallel for
+	for (index_t i = 0; i < static_cast<index_t>(string_list.size()); ++i)
 	{
 		//Math::qsort(vec, len);
-		Math::radix_sort(vec.vector, vec.vlen);
+		Math::radix_sort(string_list[i].vector, string_list[i].vlen);
 	}
 }
 
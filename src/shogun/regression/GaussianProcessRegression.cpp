@@ -38,14 +38,12 @@ std::shared_ptr<RegressionLabels> GaussianProcessRegression::apply_regression(st
 			"regression",	m_method->get_name(), lik->get_name());
 
 
-	std::shared_ptr<RegressionLabels> result;
+	std::shared_ptr<Features> feat=data;
 
 	// if regression data equals to NULL, then apply regression on training
 	// features
-	if (!data)
+	if (!feat)
 	{
-		std::shared_ptr<Features> feat;
-
 		// use inducing features for FITC inference method
 		if (m_method->get_inference_type()==INF_FITC_REGRESSION)
 		{
@@ -54,19 +52,16 @@ std::shared_ptr<RegressionLabels> GaussianProcessRegression::apply_regression(st
 		}
 		else
 			feat=m_method->get_features();
+	}
 
-		result=std::make_shared<RegressionLabels>(get_mean_vector(feat));
-		if (m_compute_variance)
-			result->put("current_values", get_variance_vector(feat));
+	// compute the posterior means and variances of the whole test matrix in
+	// one pass and evaluate both predictive quantities from them
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(feat, mu, s2);
 
-
-	}
-	else
-	{
-		result=std::make_shared<RegressionLabels>(get_mean_vector(data));
-		if (m_compute_variance)
-			result->put("current_values", get_variance_vector(data));
-	}
+	auto result=std::make_shared<RegressionLabels>(lik->get_predictive_means(mu, s2));
+	if (m_compute_variance)
+		result->put("current_values", lik->get_predictive_variances(mu, s2));
 
 	return result;
 }
@@ -100,6 +95,9 @@ bool GaussianProcessRegression::train_machine(std::shared_ptr<Features> data)
 	// perform inference
 	m_method->update();
 
+	// cache the posterior quantities needed for prediction
+	compile_posterior();
+
 	return true;
 }
 
@@ -112,8 +110,8 @@ SGVector<float64_t> GaussianProcessRegression::get_mean_vector(const std::shared
 	require(m_method->supports_regression(), "{} with {} doesn't support "
 			"regression",	m_method->get_name(), lik->get_name());
 
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 
 	// evaluate mean
 	lik=m_method->get_model();
@@ -133,8 +131,8 @@ SGVector<float64_t> GaussianProcessRegression::get_variance_vector(
 	require(m_method->supports_regression(), "{} with {} doesn't support "
 			"regression",	m_method->get_name(), lik->get_name());
 
-	SGVector<float64_t> mu=get_posterior_means(data);
-	SGVector<float64_t> s2=get_posterior_variances(data);
+	SGVector<float64_t> mu, s2;
+	compute_posterior_stats(data, mu, s2);
 
 	// evaluate variance
 	s2=lik->get_predictive_variances(mu, s2);
@@ -136,44 +136,70 @@ namespace shogun
 	void LDASolver<T>::compute_within_cov()
 	{
 		index_t num_features = m_features->get_num_features();
+		index_t num_vec = m_features->get_num_vectors();
 		index_t num_class = m_labels->get_num_classes();
 
-		auto mean_matrix =
-		    SGMatrix<T>(num_features, m_features->get_num_vectors());
-
-		// Center data with respect to each data point's class
-		for (const auto& [idx, data_i, label_i] : enumerate(m_features, m_labels))
-		{
-			mean_matrix.set_column(
-			    idx, linalg::add(
-			                 m_class_mean.at(label_i), data_i,
-			                 static_cast<T>(1), static_cast<T>(-1)));
-		}
-		// holds the feature matrix for each class
-		std::vector<SGMatrix<T>> centered_class(num_class);
-		std::vector<index_t> centered_class_col(num_class);
-
+		// One pass over the data in fixed-size blocks: each class' second
+		// moment S_c = sum x*x^T is accumulated from block-local gathers
+		// and the class mean is subtracted afterwards as a rank-one update.
+		// Unlike centering the data up front, this never materializes a
+		// copy of the feature matrix.
 		m_within_cov = SGMatrix<T>(num_features, num_features);
 		linalg::zero(m_within_cov);
-		for (auto i = 0; i < num_class; ++i)
+
+		std::vector<SGMatrix<T>> second_moment(num_class);
+		for (index_t c = 0; c < num_class; ++c)
 		{
-			centered_class[i] = SGMatrix<T>(num_features, m_class_count[i]);
-			linalg::zero(centered_class[i]);
+			second_moment[c] = SGMatrix<T>(num_features, num_features);
+			linalg::zero(second_moment[c]);
 		}
-		for (const auto& [idx, label_i] : enumerate(*m_labels))
+
+		constexpr index_t block_size = 256;
+
+#pragma omp parallel
 		{
-			auto c = static_cast<index_t>(label_i);
-			centered_class[c].set_column(
-			    centered_class_col[c], mean_matrix.get_column(idx));
-			++centered_class_col[c];
+			std::vector<SGMatrix<T>> scratch(num_class);
+			std::vector<index_t> filled(num_class, 0);
+			for (index_t c = 0; c < num_class; ++c)
+				scratch[c] = SGMatrix<T>(num_features, block_size);
+
+			auto flush = [&](index_t c) {
+				if (filled[c] == 0)
+					return;
+				SGMatrix<T> gathered(
+				    scratch[c].matrix, num_features, filled[c], false);
+				auto partial =
+				    linalg::matrix_prod(gathered, gathered, false, true);
+#pragma omp critical(shogun_lda_second_moment)
+				linalg::add(second_moment[c], partial, second_moment[c]);
+				filled[c] = 0;
+			};
+
+#pragma omp for schedule(static)
+			for (index_t i = 0; i < num_vec; ++i)
+			{
+				auto c = static_cast<index_t>(m_labels->get_label(i));
+				auto data_i = m_features->get_feature_vector(i);
+				scratch[c].set_column(filled[c]++, data_i);
+				m_features->free_feature_vector(data_i, i);
+				if (filled[c] == block_size)
+					flush(c);
+			}
+
+			for (index_t c = 0; c < num_class; ++c)
+				flush(c);
 		}
-		for (index_t i = 0; i < num_class; ++i)
+
+		for (index_t c = 0; c < num_class; ++c)
 		{
-			auto tmp = linalg::matrix_prod(
-			    centered_class[i], centered_class[i], false, true);
+			SGMatrix<T> mean(m_class_mean[c].vector, num_features, 1, false);
+			auto mean_outer = linalg::matrix_prod(mean, mean, false, true);
+			T factor = (T)m_class_count[c] / (m_class_count[c] - 1);
+			linalg::add(
+			    m_within_cov, second_moment[c], m_within_cov, (T)1.0, factor);
 			linalg::add(
-			    m_within_cov, tmp, m_within_cov, (T)1.0,
-			    ((T)m_class_count[i] / (m_class_count[i] - 1)));
+			    m_within_cov, mean_outer, m_within_cov, (T)1.0,
+			    -factor * (T)m_class_count[c]);
 		}
 
 		if (m_gamma > 0.0)
@@ -29,6 +29,9 @@
  * either expressed or implied, of the Shogun Development Team.
  */
 
+#include <algorithm>
+#include <vector>
+#include <shogun/io/SGIO.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
@@ -59,6 +62,67 @@ void BTestMMD::set_num_blocks_per_burst(index_t num_blocks_per_burst)
 	get_data_mgr().set_num_blocks_per_burst(num_blocks_per_burst);
 }
 
+index_t BTestMMD::tune_blocksize(index_t min_blocksize, index_t max_blocksize,
+	float64_t rel_tolerance)
+{
+	require(min_blocksize>=2, "Minimum blocksize ({}) has to be at least 2!",
+		min_blocksize);
+	require(max_blocksize>=min_blocksize,
+		"Maximum blocksize ({}) cannot be smaller than the minimum blocksize ({})!",
+		max_blocksize, min_blocksize);
+	require(rel_tolerance>=0, "Relative tolerance ({}) cannot be negative!",
+		rel_tolerance);
+
+	DataManager& data_mgr=get_data_mgr();
+	const index_t total=data_mgr.get_num_samples();
+	const index_t min_valid=data_mgr.get_min_blocksize();
+
+	// valid blocksizes are the multiples of the minimum possible blocksize
+	// that divide the total number of samples, thinned to doubling steps
+	std::vector<index_t> candidates;
+	for (index_t blocksize=min_valid; blocksize<=total; blocksize+=min_valid)
+	{
+		if (total%blocksize!=0)
+			continue;
+		if (blocksize<min_blocksize || blocksize>max_blocksize)
+			continue;
+		if (!candidates.empty() && blocksize<2*candidates.back())
+			continue;
+		candidates.push_back(blocksize);
+	}
+	require(!candidates.empty(),
+		"No valid blocksize in [{}, {}]! The blocksize has to be a multiple "
+		"of {} and has to divide the total number of samples ({}).",
+		min_blocksize, max_blocksize, min_valid, total);
+
+	std::vector<float64_t> snr(candidates.size());
+	for (size_t i=0; i<candidates.size(); ++i)
+	{
+		set_blocksize(candidates[i]);
+		auto estimate=compute_statistic_variance();
+		auto std_dev=std::sqrt(estimate.second);
+		snr[i]=std_dev>0 ? estimate.first/std_dev : estimate.first;
+		SG_DEBUG("blocksize={}: statistic={}, std-dev={}, snr={}",
+			candidates[i], estimate.first, std_dev, snr[i]);
+	}
+
+	const float64_t best=*std::max_element(snr.begin(), snr.end());
+	index_t selected=candidates.back();
+	for (size_t i=0; i<candidates.size(); ++i)
+	{
+		if (snr[i]>=(1.0-rel_tolerance)*best)
+		{
+			selected=candidates[i];
+			break;
+		}
+	}
+
+	io::info("Selected blocksize {} out of [{}, {}] based on observed variance.",
+		selected, min_blocksize, max_blocksize);
+	set_blocksize(selected);
+	return selected;
+}
+
 const std::function<float32_t(SGMatrix<float32_t>)> BTestMMD::get_direct_estimation_method() const
 {
 	return mmd::WithinBlockDirect();
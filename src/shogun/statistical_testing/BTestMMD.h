@@ -47,6 +47,25 @@ public:
 	void set_blocksize(index_t blocksize);
 	void set_num_blocks_per_burst(index_t num_blocks_per_burst);
 
+	/**
+	 * Automatically tunes the blocksize based on the observed variance of
+	 * the statistic. Valid candidate blocksizes within the given bounds
+	 * (thinned to roughly doubling steps) are each evaluated by computing
+	 * the statistic and its variance estimate over the data. The smallest
+	 * candidate whose signal-to-noise ratio is within rel_tolerance of the
+	 * best observed one is selected, since the computational cost of the
+	 * test grows linearly with the blocksize. The selected blocksize is
+	 * set on the test and returned.
+	 *
+	 * @param min_blocksize smallest blocksize to consider
+	 * @param max_blocksize largest blocksize to consider
+	 * @param rel_tolerance allowed relative signal-to-noise loss w.r.t.
+	 * the best candidate
+	 * @return the selected blocksize
+	 */
+	index_t tune_blocksize(index_t min_blocksize, index_t max_blocksize,
+		float64_t rel_tolerance=0.05);
+
 	float64_t compute_p_value(float64_t statistic) override;
 	float64_t compute_threshold(float64_t alpha) override;
 
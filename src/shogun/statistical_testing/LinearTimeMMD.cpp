@@ -29,11 +29,14 @@
  * either expressed or implied, of the Shogun Development Team.
  */
 
+#include <algorithm>
 #include <shogun/io/SGIO.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/Statistics.h>
 #include <shogun/distance/CustomDistance.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/Kernel.h>
 #include <shogun/statistical_testing/LinearTimeMMD.h>
 #include <shogun/statistical_testing/TestEnums.h>
 #include <shogun/statistical_testing/internals/DataManager.h>
@@ -42,7 +45,8 @@
 using namespace shogun;
 using namespace internal;
 
-LinearTimeMMD::LinearTimeMMD() : StreamingMMD()
+LinearTimeMMD::LinearTimeMMD() : StreamingMMD(), m_window_size(0),
+	m_window_h_sum(0)
 {
 }
 
@@ -72,6 +76,98 @@ void LinearTimeMMD::set_num_blocks_per_burst(index_t num_blocks_per_burst)
 	SG_DEBUG("Block contains {} and {} samples, from P and Q respectively!", data_mgr.blocksize_at(0), data_mgr.blocksize_at(1));
 }
 
+void LinearTimeMMD::set_window_size(index_t window_size)
+{
+	require(window_size>=2, "Window size ({}) has to be at least 2!",
+		window_size);
+	m_window_size=window_size;
+	while ((index_t)m_window_p.size()>m_window_size)
+	{
+		m_window_p.pop_front();
+		m_window_q.pop_front();
+		m_window_h_sum-=m_window_h_terms.front();
+		m_window_h_terms.pop_front();
+	}
+}
+
+void LinearTimeMMD::push_sample_pair(const SGVector<float64_t>& sample_p,
+	const SGVector<float64_t>& sample_q)
+{
+	require(m_window_size>0,
+		"Window size is not set! Use set_window_size() before pushing samples.");
+	require(sample_p.vlen==sample_q.vlen,
+		"Dimensions of the samples from p ({}) and q ({}) have to be the same!",
+		sample_p.vlen, sample_q.vlen);
+	if (!m_window_p.empty())
+	{
+		require(sample_p.vlen==m_window_p.back().vlen,
+			"Dimension of the pushed samples ({}) has to match the window ({})!",
+			sample_p.vlen, m_window_p.back().vlen);
+	}
+
+	if ((index_t)m_window_p.size()==m_window_size)
+	{
+		m_window_p.pop_front();
+		m_window_q.pop_front();
+		m_window_h_sum-=m_window_h_terms.front();
+		m_window_h_terms.pop_front();
+	}
+
+	/* only the h-statistic term against the previously pushed pair has to
+	 * be evaluated, all the older terms are cached */
+	if (!m_window_p.empty())
+	{
+		auto h=compute_h_term(m_window_p.back(), sample_p,
+			m_window_q.back(), sample_q);
+		m_window_h_terms.push_back(h);
+		m_window_h_sum+=h;
+	}
+
+	m_window_p.push_back(sample_p.clone());
+	m_window_q.push_back(sample_q.clone());
+}
+
+float64_t LinearTimeMMD::compute_windowed_statistic() const
+{
+	const index_t n=(index_t)m_window_p.size();
+	require(n>=2,
+		"At least 2 sample pairs are required in the window (was {})!", n);
+	const float64_t statistic=m_window_h_sum/m_window_h_terms.size();
+	return std::sqrt(n/2.0)*statistic;
+}
+
+float64_t LinearTimeMMD::compute_windowed_variance() const
+{
+	const index_t num_terms=(index_t)m_window_h_terms.size();
+	require(num_terms>=2,
+		"At least 3 sample pairs are required in the window (was {})!",
+		m_window_p.size());
+	const float64_t mean=m_window_h_sum/num_terms;
+	float64_t sq_sum=0;
+	for (auto h : m_window_h_terms)
+		sq_sum+=Math::sq(h-mean);
+	return sq_sum/(num_terms-1)/num_terms;
+}
+
+float64_t LinearTimeMMD::compute_h_term(const SGVector<float64_t>& x_a,
+	const SGVector<float64_t>& x_b, const SGVector<float64_t>& y_a,
+	const SGVector<float64_t>& y_b) const
+{
+	auto kernel=get_kernel();
+	require(kernel!=nullptr, "Kernel is not set!");
+
+	SGMatrix<float64_t> data(x_a.vlen, 4);
+	std::copy(x_a.vector, x_a.vector+x_a.vlen, data.get_column_vector(0));
+	std::copy(x_b.vector, x_b.vector+x_b.vlen, data.get_column_vector(1));
+	std::copy(y_a.vector, y_a.vector+y_a.vlen, data.get_column_vector(2));
+	std::copy(y_b.vector, y_b.vector+y_b.vlen, data.get_column_vector(3));
+	auto features=std::make_shared<DenseFeatures<float64_t>>(data);
+	kernel->init(features, features);
+
+	return kernel->kernel(0, 1)+kernel->kernel(2, 3)
+		-kernel->kernel(0, 3)-kernel->kernel(1, 2);
+}
+
 const std::function<float32_t(SGMatrix<float32_t>)> LinearTimeMMD::get_direct_estimation_method() const
 {
 	return mmd::WithinBlockDirect();
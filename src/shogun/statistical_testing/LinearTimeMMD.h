@@ -32,6 +32,8 @@
 #ifndef LINEAR_TIME_MMD_H_
 #define LINEAR_TIME_MMD_H_
 
+#include <deque>
+#include <shogun/lib/SGVector.h>
 #include <shogun/statistical_testing/StreamingMMD.h>
 
 namespace shogun
@@ -46,6 +48,45 @@ public:
 
 	void set_num_blocks_per_burst(index_t num_blocks_per_burst);
 
+	/**
+	 * Enables the sliding-window mode with the provided window size. In
+	 * this mode, observation pairs (one sample from each distribution) are
+	 * appended via push_sample_pair() and the oldest pair is evicted once
+	 * the window is full. The linear-time h-statistic terms over
+	 * consecutive pairs are cached, so each tick only evaluates the kernel
+	 * against the previously pushed pair instead of redoing the
+	 * full-window computation.
+	 *
+	 * @param window_size number of most recent sample pairs to retain
+	 */
+	void set_window_size(index_t window_size);
+
+	/**
+	 * Appends one observation from each distribution to the sliding
+	 * window, evicting the oldest pair if the window is full. The kernel
+	 * has to be set beforehand.
+	 *
+	 * @param sample_p observation from distribution p
+	 * @param sample_q observation from distribution q
+	 */
+	void push_sample_pair(const SGVector<float64_t>& sample_p,
+		const SGVector<float64_t>& sample_q);
+
+	/**
+	 * @return the linear-time MMD estimate over the current window,
+	 * normalized the same way as compute_statistic(). It averages the
+	 * h-statistic terms of consecutive sample pairs, which keeps the
+	 * estimate unbiased while allowing O(1) append/evict updates.
+	 */
+	float64_t compute_windowed_statistic() const;
+
+	/**
+	 * @return the estimated variance of the mean of the h-statistic terms
+	 * over the current window, computed from the cached terms. Useful for
+	 * thresholding the drift checks via a Gaussian approximation.
+	 */
+	float64_t compute_windowed_variance() const;
+
 	float64_t compute_p_value(float64_t statistic) override;
 	float64_t compute_threshold(float64_t alpha) override;
 
@@ -55,6 +96,21 @@ private:
 	float64_t normalize_statistic(float64_t statistic) const override;
 	const float64_t normalize_variance(float64_t variance) const override;
 	const float64_t gaussian_variance(float64_t variance) const;
+
+	/** Evaluates the linear-time h-statistic term of two sample pairs. */
+	float64_t compute_h_term(const SGVector<float64_t>& x_a,
+		const SGVector<float64_t>& x_b, const SGVector<float64_t>& y_a,
+		const SGVector<float64_t>& y_b) const;
+
+	/** Size of the sliding window, 0 when the mode is disabled. */
+	index_t m_window_size;
+	/** Retained observations from both the distributions. */
+	std::deque<SGVector<float64_t>> m_window_p;
+	std::deque<SGVector<float64_t>> m_window_q;
+	/** Cached h-statistic terms over consecutive sample pairs. */
+	std::deque<float64_t> m_window_h_terms;
+	/** Running sum of the cached h-statistic terms. */
+	float64_t m_window_h_sum;
 };
 
 }
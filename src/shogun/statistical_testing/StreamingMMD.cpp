@@ -51,6 +51,7 @@
 #include <shogun/mathematics/eigen3.h>
 
 #include <functional>
+#include <future>
 
 using namespace shogun;
 using namespace internal;
@@ -209,6 +210,10 @@ std::pair<float64_t, float64_t> StreamingMMD::Self::compute_statistic_variance()
 
 		while (!next_burst.empty())
 		{
+			/* fetch the next burst while this one is being processed */
+			auto prefetched=std::async(std::launch::async,
+				[&data_mgr]() { return data_mgr.next(); });
+
 			merge_samples(next_burst, blocks);
 			compute_kernel(cm, blocks, kernel);
 			blocks.resize(0);
@@ -243,7 +248,7 @@ std::pair<float64_t, float64_t> StreamingMMD::Self::compute_statistic_variance()
 					variance_term_counter++;
 				}
 			}
-			next_burst=data_mgr.next();
+			next_burst=prefetched.get();
 		}
 		cm.done();
 	}
@@ -289,6 +294,10 @@ std::pair<SGVector<float64_t>, SGMatrix<float64_t> > StreamingMMD::Self::compute
 	std::vector<std::vector<float32_t> > mmds(num_kernels);
 	while (!next_burst.empty())
 	{
+		/* fetch the next burst while this one is being processed */
+		auto prefetched=std::async(std::launch::async,
+			[&data_mgr]() { return data_mgr.next(); });
+
 		const auto num_blocks=next_burst.num_blocks();
 		require(num_blocks%2==0,
 				"The number of blocks per burst ({} this burst) has to be even!",
@@ -319,7 +328,7 @@ std::pair<SGVector<float64_t>, SGMatrix<float64_t> > StreamingMMD::Self::compute
 				Q(j, i)=Q(i, j);
 			}
 		}
-		next_burst=data_mgr.next();
+		next_burst=prefetched.get();
 	}
 	mmds.clear();
 
@@ -358,6 +367,10 @@ SGVector<float64_t> StreamingMMD::Self::sample_null()
 
 	while (!next_burst.empty())
 	{
+		/* fetch the next burst while this one is being processed */
+		auto prefetched=std::async(std::launch::async,
+			[&data_mgr]() { return data_mgr.next(); });
+
 		merge_samples(next_burst, blocks);
 		compute_kernel(cm, blocks, kernel);
 		blocks.resize(0);
@@ -373,7 +386,7 @@ SGVector<float64_t> StreamingMMD::Self::sample_null()
 				term_counters[j]++;
 			}
 		}
-		next_burst=data_mgr.next();
+		next_burst=prefetched.get();
 	}
 
 	data_mgr.end();
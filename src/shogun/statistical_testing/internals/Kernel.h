@@ -30,6 +30,10 @@
 
 #include <shogun/lib/common.h>
 #include <shogun/kernel/Kernel.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/normalizer/IdentityKernelNormalizer.h>
+#include <shogun/distance/CustomDistance.h>
+#include <shogun/mathematics/eigen3.h>
 
 #ifndef KERNEL_FUNCTOR_H__
 #define KERNEL_FUNCTOR_H__
@@ -77,6 +81,8 @@ public:
 		auto size=m_num_feat_vec*(m_num_feat_vec+1)/2;
 		if (m_self_adjoint_kernel_matrix.size()==0 || m_self_adjoint_kernel_matrix.size()!=size)
 			m_self_adjoint_kernel_matrix=SGVector<float32_t>(size);
+		if (precompute_gaussian(kernel))
+			return;
 		for (auto i=0; i<m_num_feat_vec; ++i)
 		{
 			for (auto j=i; j<m_num_feat_vec; ++j)
@@ -97,7 +103,50 @@ public:
 		return m_self_adjoint_kernel_matrix[index];
 	}
 private:
+	/**
+	 * Vectorized fill for Gaussian kernels that run against a shared
+	 * precomputed distance (see KernelManager::set_precomputed_distance).
+	 * The packed pairwise distances are gathered once and reused by every
+	 * subsequent precompute() call whose kernel shares the same distance
+	 * instance, so evaluating a family of bandwidths costs one distance
+	 * computation plus an elementwise exp transform per bandwidth instead
+	 * of one full kernel matrix computation each.
+	 */
+	bool precompute_gaussian(const std::shared_ptr<shogun::Kernel>& kernel)
+	{
+		if (kernel->get_kernel_type()!=K_GAUSSIAN)
+			return false;
+		auto gaussian=kernel->as<shogun::GaussianKernel>();
+		auto distance=gaussian->m_precomputed_distance;
+		if (distance==nullptr)
+			return false;
+		if (std::dynamic_pointer_cast<IdentityKernelNormalizer>(gaussian->get_normalizer())==nullptr)
+			return false;
+
+		const auto size=m_self_adjoint_kernel_matrix.size();
+		if (m_packed_distance_source!=distance || m_packed_distance.size()!=size)
+		{
+			m_packed_distance=SGVector<float64_t>(size);
+			for (auto i=0; i<m_num_feat_vec; ++i)
+			{
+				for (auto j=i; j<m_num_feat_vec; ++j)
+				{
+					auto index=i*m_num_feat_vec-i*(i+1)/2+j;
+					m_packed_distance[index]=distance->distance(i, j);
+				}
+			}
+			m_packed_distance_source=distance;
+		}
+
+		Eigen::Map<const Eigen::ArrayXd> distances(m_packed_distance.vector, size);
+		Eigen::Map<Eigen::ArrayXf> kernel_values(m_self_adjoint_kernel_matrix.vector, size);
+		kernel_values=(-distances/gaussian->get_width()).exp().cast<float32_t>();
+		return true;
+	}
+
 	SGVector<float32_t> m_self_adjoint_kernel_matrix;
+	SGVector<float64_t> m_packed_distance;
+	std::shared_ptr<CustomDistance> m_packed_distance_source;
 	index_t m_num_feat_vec;
 };
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -32,6 +32,7 @@
 #ifndef COMPUTE_MMD_H_
 #define COMPUTE_MMD_H_
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <shogun/lib/config.h>
@@ -40,6 +41,7 @@
 #include <shogun/kernel/Kernel.h>
 #include <shogun/statistical_testing/MMD.h>
 #include <shogun/statistical_testing/TestEnums.h>
+#include <shogun/statistical_testing/internals/Kernel.h>
 #include <shogun/statistical_testing/internals/KernelManager.h>
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/io/SGIO.h>
@@ -73,11 +75,41 @@ struct ComputeMMD
 	{
 		ASSERT(m_n_x>0 && m_n_y>0);
 		const index_t size=m_n_x+m_n_y;
+		const index_t num_tiles=(size+TILE_SIZE-1)/TILE_SIZE;
 		terms_t terms;
-		for (auto i=0; i<size; ++i)
+
+		/* tiles of the upper triangle are independent: compute kernel
+		 * values tile by tile in parallel and accumulate per-thread terms,
+		 * the gram matrix is never materialized */
+		#pragma omp parallel
 		{
-			for (auto j=i; j<size; ++j)
-				add_term_upper(terms, kernel(i, j), i, j);
+			terms_t local_terms;
+
+			#pragma omp for schedule(dynamic) nowait
+			for (index_t t=0; t<num_tiles*num_tiles; ++t)
+			{
+				const index_t tile_i=t/num_tiles;
+				const index_t tile_j=t%num_tiles;
+				if (tile_j<tile_i)
+					continue;
+
+				const index_t i_end=std::min(size, (tile_i+1)*TILE_SIZE);
+				const index_t j_end=std::min(size, (tile_j+1)*TILE_SIZE);
+				for (index_t i=tile_i*TILE_SIZE; i<i_end; ++i)
+				{
+					for (index_t j=std::max(i, tile_j*TILE_SIZE); j<j_end; ++j)
+						add_term_upper(local_terms, kernel(i, j), i, j);
+				}
+			}
+
+			#pragma omp critical
+			{
+				for (index_t k=0; k<3; ++k)
+				{
+					terms.term[k]+=local_terms.term[k];
+					terms.diag[k]+=local_terms.diag[k];
+				}
+			}
 		}
 		return compute(terms);
 	}
@@ -123,27 +155,25 @@ struct ComputeMMD
 	SGVector<float64_t> operator()(const KernelManager& kernel_mgr) const
 	{
 		ASSERT(m_n_x>0 && m_n_y>0);
-		std::vector<terms_t> terms(kernel_mgr.num_kernels());
 		const index_t size=m_n_x+m_n_y;
-		for (auto j=0; j<size; ++j)
-		{
-			for (auto i=j; i<size; ++i)
-			{
-				for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
-				{
-					auto kernel=kernel_mgr.kernel_at(k)->kernel(i, j);
-					add_term_lower(terms[k], kernel, i, j);
-				}
-			}
-		}
 
+		/* the functor packs each candidate kernel once; for shift-invariant
+		 * families over a shared precomputed distance this reduces to one
+		 * distance gather plus a vectorized transform per kernel */
+		SelfAdjointPrecomputedKernel kernel_functor(SGVector<float32_t>(size*(size+1)/2));
 		SGVector<float64_t> result(kernel_mgr.num_kernels());
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			result[k]=compute(terms[k]);
+			kernel_functor.precompute(kernel_mgr.kernel_at(k));
+			terms_t terms;
+			for (auto i=0; i<size; ++i)
+			{
+				for (auto j=i; j<size; ++j)
+					add_term_upper(terms, kernel_functor(i, j), i, j);
+			}
+			result[k]=compute(terms);
 			SG_DEBUG("result[{}] = {}!", k, result[k]);
 		}
-		terms.resize(0);
 		return result;
 	}
 
@@ -262,6 +292,9 @@ struct ComputeMMD
 	index_t m_n_x;
 	index_t m_n_y;
 	EStatisticType m_stype;
+
+	/** edge length of the kernel tiles streamed in the functor paths */
+	static constexpr index_t TILE_SIZE=256;
 };
 #endif // DOXYGEN_SHOULD_SKIP_THIS
 }
@@ -86,19 +86,15 @@ struct CrossValidationMMD : PermutationMMD
 		const index_t orig_n_x=m_n_x;
 		const index_t orig_n_y=m_n_y;
 		SGVector<float64_t> null_samples(m_num_null_samples);
-		SGVector<float32_t> precomputed_km(size*(size+1)/2);
+
+		/* the functor packs each candidate kernel once; for shift-invariant
+		 * families over a shared precomputed distance this reduces to one
+		 * distance gather plus a vectorized transform per kernel */
+		SelfAdjointPrecomputedKernel kernel_functor(SGVector<float32_t>(size*(size+1)/2));
 
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			auto kernel=kernel_mgr.kernel_at(k);
-			for (auto i=0; i<size; ++i)
-			{
-				for (auto j=i; j<size; ++j)
-				{
-					auto index=i*size-i*(i+1)/2+j;
-					precomputed_km[index]=kernel->kernel(i, j);
-				}
-			}
+			kernel_functor.precompute(kernel_mgr.kernel_at(k));
 
 			for (auto current_run=0; current_run<m_num_runs; ++current_run)
 			{
@@ -136,15 +132,11 @@ struct CrossValidationMMD : PermutationMMD
 					for (auto i=0; i<size; ++i)
 					{
 						auto inverted_row=m_inverted_inds[i];
-						auto idx_base=i*size-i*(i+1)/2;
 						for (auto j=i; j<size; ++j)
 						{
 							auto inverted_col=m_inverted_inds[j];
 							if (inverted_row!=-1 && inverted_col!=-1)
-							{
-								auto idx=idx_base+j;
-								add_term_upper(terms, precomputed_km[idx], inverted_row, inverted_col);
-							}
+								add_term_upper(terms, kernel_functor(i, j), inverted_row, inverted_col);
 						}
 					}
 					auto statistic=compute(terms);
@@ -156,17 +148,15 @@ struct CrossValidationMMD : PermutationMMD
 						for (auto i=0; i<size; ++i)
 						{
 							auto inverted_row=m_inverted_permuted_inds(i, n);
-							auto idx_base=i*size-i*(i+1)/2;
 							for (auto j=i; j<size; ++j)
 							{
 								auto inverted_col=m_inverted_permuted_inds(j, n);
 								if (inverted_row!=-1 && inverted_col!=-1)
 								{
-									auto idx=idx_base+j;
 									if (inverted_row<=inverted_col)
-										add_term_upper(null_terms, precomputed_km[idx], inverted_row, inverted_col);
+										add_term_upper(null_terms, kernel_functor(i, j), inverted_row, inverted_col);
 									else
-										add_term_upper(null_terms, precomputed_km[idx], inverted_col, inverted_row);
+										add_term_upper(null_terms, kernel_functor(i, j), inverted_col, inverted_row);
 								}
 							}
 						}
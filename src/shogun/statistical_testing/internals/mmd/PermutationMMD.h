@@ -63,24 +63,167 @@ struct PermutationMMD : ComputeMMD
 		precompute_permutation_inds(prng);
 
 		const index_t size=m_n_x+m_n_y;
+		const index_t num_tiles=(size+TILE_SIZE-1)/TILE_SIZE;
+		std::vector<terms_t> terms(m_num_null_samples);
+
+		/* kernel tiles are computed on the fly, once per pair, and each
+		 * value is scattered into the terms of every permutation. neither
+		 * the gram matrix is materialized nor is the kernel re-evaluated
+		 * per null sample */
+		#pragma omp parallel
+		{
+			std::vector<terms_t> local_terms(m_num_null_samples);
+
+			#pragma omp for schedule(dynamic) nowait
+			for (index_t t=0; t<num_tiles*num_tiles; ++t)
+			{
+				const index_t tile_i=t/num_tiles;
+				const index_t tile_j=t%num_tiles;
+				if (tile_j<tile_i)
+					continue;
+
+				const index_t i_end=std::min(size, (tile_i+1)*TILE_SIZE);
+				const index_t j_end=std::min(size, (tile_j+1)*TILE_SIZE);
+				for (index_t i=tile_i*TILE_SIZE; i<i_end; ++i)
+				{
+					for (index_t j=std::max(i, tile_j*TILE_SIZE); j<j_end; ++j)
+					{
+						const float32_t kernel_value=kernel(i, j);
+						for (auto n=0; n<m_num_null_samples; ++n)
+						{
+							auto inverted_row=m_inverted_permuted_inds(i, n);
+							auto inverted_col=m_inverted_permuted_inds(j, n);
+
+							if (inverted_row<=inverted_col)
+								add_term_upper(local_terms[n], kernel_value, inverted_row, inverted_col);
+							else
+								add_term_upper(local_terms[n], kernel_value, inverted_col, inverted_row);
+						}
+					}
+				}
+			}
+
+			#pragma omp critical
+			{
+				for (auto n=0; n<m_num_null_samples; ++n)
+				{
+					for (index_t k=0; k<3; ++k)
+					{
+						terms[n].term[k]+=local_terms[n].term[k];
+						terms[n].diag[k]+=local_terms[n].diag[k];
+					}
+				}
+			}
+		}
+
 		SGVector<float32_t> null_samples(m_num_null_samples);
-#pragma omp parallel for
 		for (auto n=0; n<m_num_null_samples; ++n)
 		{
-			terms_t terms;
-			for (auto j=0; j<size; ++j)
+			null_samples[n]=compute(terms[n]);
+			SG_DEBUG("null_samples[{}] = {}!", n, null_samples[n]);
+		}
+		return null_samples;
+	}
+
+	/**
+	 * Batched permutation engine for a precomputed kernel matrix. All
+	 * permutations are expressed as one 0/1 assignment matrix Z with
+	 * Z(i, n)=1 iff sample i falls into X under permutation n. The MMD
+	 * terms of every permutation then follow from quadratic forms
+	 *   xx_n = z_n^T K z_n
+	 *   yy_n = sum(K) - 2 z_n^T K 1 + xx_n
+	 *   xy_n = z_n^T K 1 - xx_n
+	 * which are evaluated for all permutations at once with blocked
+	 * matrix products over kernel tiles, instead of one full sweep over
+	 * the matrix per permutation.
+	 */
+	template <class PRNG>
+	SGVector<float32_t> operator()(const SGMatrix<float32_t>& kernel_matrix, PRNG& prng)
+	{
+		ASSERT(m_n_x>0 && m_n_y>0);
+		ASSERT(m_num_null_samples>0);
+		const index_t size=m_n_x+m_n_y;
+		ASSERT(kernel_matrix.num_rows==size && kernel_matrix.num_cols==size);
+		precompute_permutation_inds(prng);
+
+		Eigen::Map<const Eigen::MatrixXf> map(kernel_matrix.matrix, size, size);
+
+		Eigen::MatrixXd assignment(size, m_num_null_samples);
+		for (auto n=0; n<m_num_null_samples; ++n)
+		{
+			for (index_t i=0; i<size; ++i)
+				assignment(i, n)=m_inverted_permuted_inds(i, n)<m_n_x ? 1.0 : 0.0;
+		}
+
+		const Eigen::VectorXd row_sums=map.cast<float64_t>().rowwise().sum();
+		const Eigen::VectorXd diag=map.diagonal().cast<float64_t>();
+		const float64_t full_sum=row_sums.sum();
+		const float64_t diag_sum=diag.sum();
+
+		const Eigen::VectorXd weighted_sums=assignment.transpose()*row_sums;
+		const Eigen::VectorXd weighted_diags=assignment.transpose()*diag;
+
+		const index_t num_tiles=(size+TILE_SIZE-1)/TILE_SIZE;
+		Eigen::VectorXd quad=Eigen::VectorXd::Zero(m_num_null_samples);
+
+		#pragma omp parallel
+		{
+			Eigen::VectorXd local_quad=Eigen::VectorXd::Zero(m_num_null_samples);
+			Eigen::MatrixXd kz(TILE_SIZE, m_num_null_samples);
+
+			#pragma omp for schedule(dynamic) nowait
+			for (index_t r=0; r<num_tiles; ++r)
 			{
-				auto inverted_col=m_inverted_permuted_inds(j, n);
-				for (auto i=j; i<size; ++i)
+				const index_t row_start=r*TILE_SIZE;
+				const index_t rows=std::min(TILE_SIZE, size-row_start);
+				kz.topRows(rows).setZero();
+				for (index_t c=0; c<num_tiles; ++c)
 				{
-					auto inverted_row=m_inverted_permuted_inds(i, n);
-
-					if (inverted_row>=inverted_col)
-						add_term_lower(terms, kernel(i, j), inverted_row, inverted_col);
-					else
-						add_term_lower(terms, kernel(i, j), inverted_col, inverted_row);
+					const index_t col_start=c*TILE_SIZE;
+					const index_t cols=std::min(TILE_SIZE, size-col_start);
+					kz.topRows(rows).noalias()+=
+						map.block(row_start, col_start, rows, cols).cast<float64_t>()*
+						assignment.middleRows(col_start, cols);
 				}
+				local_quad+=(assignment.middleRows(row_start, rows).array()*
+					kz.topRows(rows).array()).colwise().sum().matrix().transpose();
 			}
+
+			#pragma omp critical
+			quad+=local_quad;
+		}
+
+		/* the diagonal of the permuted cross-block cannot be written as a
+		 * quadratic form, gather it where the statistic needs it */
+		Eigen::VectorXd cross_diags=Eigen::VectorXd::Zero(m_num_null_samples);
+		if (m_stype==ST_UNBIASED_INCOMPLETE)
+		{
+			std::vector<index_t> forward(size);
+			for (auto n=0; n<m_num_null_samples; ++n)
+			{
+				for (index_t i=0; i<size; ++i)
+					forward[m_inverted_permuted_inds(i, n)]=i;
+				for (index_t i=0; i<m_n_x; ++i)
+					cross_diags[n]+=map(forward[i], forward[i+m_n_x]);
+			}
+		}
+
+		SGVector<float32_t> null_samples(m_num_null_samples);
+		for (auto n=0; n<m_num_null_samples; ++n)
+		{
+			terms_t terms;
+			const float64_t xx=quad[n];
+			const float64_t yy=full_sum-2*weighted_sums[n]+xx;
+			const float64_t diag_x=weighted_diags[n];
+			const float64_t diag_y=diag_sum-diag_x;
+
+			terms.term[0]=(xx-diag_x)/2+diag_x;
+			terms.diag[0]=diag_x;
+			terms.term[1]=(yy-diag_y)/2+diag_y;
+			terms.diag[1]=diag_y;
+			terms.term[2]=weighted_sums[n]-xx;
+			terms.diag[2]=cross_diags[n];
+
 			null_samples[n]=compute(terms);
 			SG_DEBUG("null_samples[{}] = {}!", n, null_samples[n]);
 		}
@@ -96,19 +239,14 @@ struct PermutationMMD : ComputeMMD
 
 		const index_t size=m_n_x+m_n_y;
 		SGMatrix<float32_t> null_samples(m_num_null_samples, kernel_mgr.num_kernels());
-		SGVector<float32_t> km(size*(size+1)/2);
+
+		/* the functor packs each candidate kernel once; for shift-invariant
+		 * families over a shared precomputed distance this reduces to one
+		 * distance gather plus a vectorized transform per kernel */
+		SelfAdjointPrecomputedKernel kernel_functor(SGVector<float32_t>(size*(size+1)/2));
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			auto kernel=kernel_mgr.kernel_at(k);
-			terms_t terms;
-			for (auto i=0; i<size; ++i)
-			{
-				for (auto j=i; j<size; ++j)
-				{
-					auto index=i*size-i*(i+1)/2+j;
-					km[index]=kernel->kernel(i, j);
-				}
-			}
+			kernel_functor.precompute(kernel_mgr.kernel_at(k));
 
 #pragma omp parallel for
 			for (auto n=0; n<m_num_null_samples; ++n)
@@ -117,16 +255,14 @@ struct PermutationMMD : ComputeMMD
 				for (auto i=0; i<size; ++i)
 				{
 					auto inverted_row=m_inverted_permuted_inds(i, n);
-					auto index_base=i*size-i*(i+1)/2;
 					for (auto j=i; j<size; ++j)
 					{
-						auto index=index_base+j;
 						auto inverted_col=m_inverted_permuted_inds(j, n);
 
 						if (inverted_row<=inverted_col)
-							add_term_upper(null_terms, km[index], inverted_row, inverted_col);
+							add_term_upper(null_terms, kernel_functor(i, j), inverted_row, inverted_col);
 						else
-							add_term_upper(null_terms, km[index], inverted_col, inverted_row);
+							add_term_upper(null_terms, kernel_functor(i, j), inverted_col, inverted_row);
 					}
 				}
 				null_samples(n, k)=compute(null_terms);
@@ -154,19 +290,15 @@ struct PermutationMMD : ComputeMMD
 		SGVector<float32_t> null_samples(m_num_null_samples);
 		SGVector<float64_t> result(kernel_mgr.num_kernels());
 
-		SGVector<float32_t> km(size*(size+1)/2);
+		SelfAdjointPrecomputedKernel kernel_functor(SGVector<float32_t>(size*(size+1)/2));
 		for (auto k=0; k<kernel_mgr.num_kernels(); ++k)
 		{
-			auto kernel=kernel_mgr.kernel_at(k);
+			kernel_functor.precompute(kernel_mgr.kernel_at(k));
 			terms_t terms;
 			for (auto i=0; i<size; ++i)
 			{
 				for (auto j=i; j<size; ++j)
-				{
-					auto index=i*size-i*(i+1)/2+j;
-					km[index]=kernel->kernel(i, j);
-					add_term_upper(terms, km[index], i, j);
-				}
+					add_term_upper(terms, kernel_functor(i, j), i, j);
 			}
 			float32_t statistic=compute(terms);
 			SG_DEBUG("Kernel({}): statistic={}", k, statistic);
@@ -178,16 +310,14 @@ struct PermutationMMD : ComputeMMD
 				for (auto i=0; i<size; ++i)
 				{
 					auto inverted_row=m_inverted_permuted_inds(i, n);
-					auto index_base=i*size-i*(i+1)/2;
 					for (auto j=i; j<size; ++j)
 					{
-						auto index=index_base+j;
 						auto inverted_col=m_inverted_permuted_inds(j, n);
 
 						if (inverted_row<=inverted_col)
-							add_term_upper(null_terms, km[index], inverted_row, inverted_col);
+							add_term_upper(null_terms, kernel_functor(i, j), inverted_row, inverted_col);
 						else
-							add_term_upper(null_terms, km[index], inverted_col, inverted_row);
+							add_term_upper(null_terms, kernel_functor(i, j), inverted_col, inverted_row);
 					}
 				}
 				null_samples[n]=compute(null_terms);
@@ -80,6 +80,7 @@ TreeMaxProduct::TreeMaxProduct(std::shared_ptr<FactorGraph> fg)
 		}
 	}
 
+	build_message_schedule();
 }
 
 TreeMaxProduct::~TreeMaxProduct()
@@ -106,6 +107,50 @@ void TreeMaxProduct::init()
 	m_msgset_map_var = msgset_map_type();
 }
 
+void TreeMaxProduct::build_message_schedule()
+{
+	auto facs = m_fg->get_factors();
+	std::vector<int32_t> level(m_msg_order.size(), 0);
+	int32_t num_levels = 0;
+
+	// m_msg_order is topologically sorted (children before parents), so
+	// the level of each message is one above its deepest dependency
+	for (uint32_t mi = 0; mi < m_msg_order.size(); mi++)
+	{
+		if (m_msg_order[mi]->mtype == VAR_TO_FAC) // var -> factor
+		{
+			msgset_map_type::const_iterator mit =
+				m_msgset_map_var.find(m_msg_order[mi]->child);
+			if (mit != m_msgset_map_var.end())
+			{
+				for (std::set<uint32_t>::const_iterator cit = mit->second.begin();
+					cit != mit->second.end(); cit++)
+				{
+					level[mi] = std::max(level[mi], level[*cit] + 1);
+				}
+			}
+		}
+		else // factor -> var
+		{
+			auto fac = facs[m_msg_order[mi]->child];
+			SGVector<int32_t> fvars = fac->get_variables();
+			for (int32_t vi = 0; vi < fvars.size(); vi++)
+			{
+				if (fvars[vi] == m_msg_order[mi]->parent)
+					continue;
+
+				uint32_t adj_msg = m_msg_map_var.at(fvars[vi]);
+				level[mi] = std::max(level[mi], level[adj_msg] + 1);
+			}
+		}
+		num_levels = std::max(num_levels, level[mi] + 1);
+	}
+
+	m_msg_levels = std::vector< std::vector<uint32_t> >(num_levels);
+	for (uint32_t mi = 0; mi < m_msg_order.size(); mi++)
+		m_msg_levels[level[mi]].push_back(mi);
+}
+
 void TreeMaxProduct::get_message_order(std::vector<MessageEdge*>& order,
 	std::vector<bool>& is_root) const
 {
@@ -245,7 +290,7 @@ void TreeMaxProduct::bottom_up_pass()
 	// where q_v2f and r_f2v are beliefs of the edge collecting from neighborhoods
 	// by one end, which will be sent to another end, read Eq.(3.19), Eq.(3.20)
 	// on [Nowozin et al. 2011] for more detail.
-	for (uint32_t mi = 0; mi < m_msg_order.size(); ++mi)
+	auto compute_forward_msg = [&](uint32_t mi)
 	{
 		SG_DEBUG("mi = {}, mtype: {} {} -> {}", mi,
 			m_msg_order[mi]->mtype, m_msg_order[mi]->child, m_msg_order[mi]->parent);
@@ -253,7 +298,10 @@ void TreeMaxProduct::bottom_up_pass()
 		if (m_msg_order[mi]->mtype == VAR_TO_FAC) // var -> factor
 		{
 			uint32_t var_id = m_msg_order[mi]->child;
-			const std::set<uint32_t>& msgset_var = m_msgset_map_var[var_id];
+			msgset_map_type::const_iterator mit = m_msgset_map_var.find(var_id);
+			if (mit == m_msgset_map_var.end())
+				return;
+			const std::set<uint32_t>& msgset_var = mit->second;
 
 			// q_v2f = sum(r_f2v), i.e. sum all incoming f2v msgs
 			for (std::set<uint32_t>::const_iterator cit = msgset_var.begin(); cit != msgset_var.end(); cit++)
@@ -296,7 +344,7 @@ void TreeMaxProduct::bottom_up_pass()
 					if (vi == var_id_index)
 						continue;
 
-					uint32_t adj_msg = m_msg_map_var[fvars[vi]];
+					uint32_t adj_msg = m_msg_map_var.at(fvars[vi]);
 					int32_t adj_var_state = ftype->state_from_index(ei, vi);
 
 					r_f2v[ei] += m_fw_msgs[adj_msg][adj_var_state];
@@ -314,6 +362,17 @@ void TreeMaxProduct::bottom_up_pass()
 
 
 		}
+	};
+
+	// messages within one level belong to independent subtrees and only
+	// read messages of lower levels, so each level can be computed in
+	// parallel; each message keeps its own stack-local workspace
+	for (uint32_t li = 0; li < m_msg_levels.size(); ++li)
+	{
+		const std::vector<uint32_t>& level_msgs = m_msg_levels[li];
+#pragma omp parallel for
+		for (int64_t i = 0; i < (int64_t)level_msgs.size(); ++i)
+			compute_forward_msg(level_msgs[i]);
 	}
 
 
@@ -389,7 +448,7 @@ void TreeMaxProduct::top_down_pass()
 	//   compute marginal of f
 	// else var <- factor edge
 	//   compute r_f2v
-	for (int32_t mi = (int32_t)(m_msg_order.size()-1); mi >= 0; --mi)
+	auto compute_backward_msg = [&](uint32_t mi)
 	{
 		SG_DEBUG("mi = {}, mtype: {} {} <- {}", mi,
 			m_msg_order[mi]->mtype, m_msg_order[mi]->child, m_msg_order[mi]->parent);
@@ -418,13 +477,16 @@ void TreeMaxProduct::top_down_pass()
 			// parent msg: r_bw_parent2v
 			if (m_is_root[var_id] == 0)
 			{
-				uint32_t parent_msg = m_msg_map_var[var_id];
+				uint32_t parent_msg = m_msg_map_var.at(var_id);
 				std::fill(m_bw_msgs[mi].begin(), m_bw_msgs[mi].end(),
 					m_bw_msgs[parent_msg][m_states[var_id]]);
 			}
 
 			// siblings: sum_{child!=f} r_fw_child2v
-			const std::set<uint32_t>& msgset_var = m_msgset_map_var[var_id];
+			static const std::set<uint32_t> empty_msgset;
+			msgset_map_type::const_iterator mit = m_msgset_map_var.find(var_id);
+			const std::set<uint32_t>& msgset_var = mit != m_msgset_map_var.end()
+				? mit->second : empty_msgset;
 			for (std::set<uint32_t>::const_iterator cit = msgset_var.begin();
 				cit != msgset_var.end(); cit++)
 			{
@@ -456,7 +518,7 @@ void TreeMaxProduct::top_down_pass()
 					else
 					{
 						uint32_t adj_id = fvars[vi];
-						uint32_t adj_msg = m_msg_map_var[adj_id];
+						uint32_t adj_msg = m_msg_map_var.at(adj_id);
 						int32_t adj_id_state = ftype->state_from_index(ei, vi);
 
 						marg[ei] += m_fw_msgs[adj_msg][adj_id_state];
@@ -499,7 +561,7 @@ void TreeMaxProduct::top_down_pass()
 			ASSERT(fvar_set.vlen == 1);
 			int32_t var_id_index = fvar_set[0];
 
-			uint32_t msg_parent = m_msg_map_fac[fac_id];
+			uint32_t msg_parent = m_msg_map_fac.at(fac_id);
 			int32_t var_parent = m_msg_order[msg_parent]->parent;
 
 			std::vector<float64_t> r_f2v(fenrgs.size());
@@ -524,7 +586,7 @@ void TreeMaxProduct::top_down_pass()
 					else
 					{
 						int32_t adj_id = fvars[vi];
-						uint32_t adj_msg = m_msg_map_var[adj_id];
+						uint32_t adj_msg = m_msg_map_var.at(adj_id);
 						int32_t adj_var_state = ftype->state_from_index(ei, vi);
 
 						if (m_states[adj_id] != minf)
@@ -545,7 +607,19 @@ void TreeMaxProduct::top_down_pass()
 
 
 		}
-	} // end for msg edge
+	}; // end compute_backward_msg
+
+	// the backward dependencies are the reverse of the forward ones, so
+	// walking the levels in descending order keeps every message behind
+	// the states and backward messages it conditions on; messages within
+	// one level are again independent
+	for (int32_t li = (int32_t)(m_msg_levels.size()-1); li >= 0; --li)
+	{
+		const std::vector<uint32_t>& level_msgs = m_msg_levels[li];
+#pragma omp parallel for
+		for (int64_t i = 0; i < (int64_t)level_msgs.size(); ++i)
+			compute_backward_msg(level_msgs[i]);
+	}
 
 	SG_DEBUG("***leave top_down_pass().");
 }
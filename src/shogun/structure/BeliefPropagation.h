@@ -120,8 +120,15 @@ protected:
 private:
 	void init();
 
+	/** group messages into dependency levels: a message only depends on
+	 * messages of strictly lower levels, so all messages within one level
+	 * (different subtrees of the factor graph) can be computed concurrently
+	 */
+	void build_message_schedule();
+
 private:
 	std::vector<MessageEdge*> m_msg_order;
+	std::vector< std::vector<uint32_t> > m_msg_levels;
 	std::vector<bool> m_is_root;
 	std::vector< std::vector<float64_t> > m_fw_msgs;
 	std::vector< std::vector<float64_t> > m_bw_msgs;
@@ -11,6 +11,9 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 
+#include <numeric>
+#include <vector>
+
 using namespace shogun;
 
 CCSOSVM::CCSOSVM()
@@ -192,6 +195,9 @@ bool CCSOSVM::train_machine(std::shared_ptr<Features> data)
 	if (data)
 		set_features(data);
 
+	/* initialize the model for training */
+	m_model->init_training();
+
 	SGVector<float64_t> alpha;
 	float64_t** G; /* Gram matrix */
 	std::vector<SGSparseVector<float64_t> > dXc; /* constraint matrix */
@@ -527,37 +533,46 @@ SGSparseVector<float64_t> CCSOSVM::find_cutting_plane(float64_t* margin)
 	int32_t psi_size = m_model->get_dim();
 
 	index_t num_samples = m_model->get_features()->get_num_vectors();
+	/* number of oracle calls handed to the model at a time */
+	const index_t oracle_block_size = 64;
 	/* find cutting plane */
 	*margin = 0;
 	new_constraint.zero();
-	for (index_t i = 0; i < num_samples; i++)
+	for (index_t bs = 0; bs < num_samples; bs += oracle_block_size)
 	{
-		auto result = m_model->argmax(m_w, i);
-		if (result->psi_computed)
-		{
-			linalg::add(new_constraint, result->psi_truth, new_constraint);
-			result->psi_pred.scale(-1.0);
-			linalg::add(new_constraint, result->psi_pred, new_constraint);
-		}
-		else if(result->psi_computed_sparse)
-		{
-			result->psi_truth_sparse.add_to_dense(1.0, new_constraint.vector,
-					new_constraint.vlen);
-			result->psi_pred_sparse.add_to_dense(-1.0, new_constraint.vector,
-					new_constraint.vlen);
-		}
-		else
+		/* run the oracle for a block of samples, across threads if the
+		 * model supports it */
+		std::vector<int32_t> block(Math::min(num_samples, bs + oracle_block_size) - bs);
+		std::iota(block.begin(), block.end(), bs);
+		auto results = m_model->argmax_block(m_w, block);
+
+		for (auto& result : results)
 		{
-			error("model({}) should have either of psi_computed or psi_computed_sparse"
-					"to be set true", m_model->get_name());
+			if (result->psi_computed)
+			{
+				linalg::add(new_constraint, result->psi_truth, new_constraint);
+				result->psi_pred.scale(-1.0);
+				linalg::add(new_constraint, result->psi_pred, new_constraint);
+			}
+			else if(result->psi_computed_sparse)
+			{
+				result->psi_truth_sparse.add_to_dense(1.0, new_constraint.vector,
+						new_constraint.vlen);
+				result->psi_pred_sparse.add_to_dense(-1.0, new_constraint.vector,
+						new_constraint.vlen);
+			}
+			else
+			{
+				error("model({}) should have either of psi_computed or psi_computed_sparse"
+						"to be set true", m_model->get_name());
+			}
+			/*
+			printf("%.16lf %.16lf\n",
+					Math::dot(result->psi_truth.vector, result->psi_truth.vector, result->psi_truth.vlen),
+					Math::dot(result->psi_pred.vector, result->psi_pred.vector, result->psi_pred.vlen));
+			*/
+			*margin += result->delta;
 		}
-		/*
-		printf("%.16lf %.16lf\n",
-				Math::dot(result->psi_truth.vector, result->psi_truth.vector, result->psi_truth.vlen),
-				Math::dot(result->psi_pred.vector, result->psi_pred.vector, result->psi_pred.vlen));
-		*/
-		*margin += result->delta;
-
 	}
 	/* scaling */
 	float64_t scale = 1/(float64_t)num_samples;
@@ -95,7 +95,8 @@ DynProg::DynProg(int32_t num_svms /*= 8 */)
 	  m_num_raw_data(0),
 
 	  m_long_transitions(true),
-	  m_long_transition_threshold(1000)
+	  m_long_transition_threshold(1000),
+	  m_checkpoint_interval(0)
 {
 	trans_list_forward = NULL ;
 	trans_list_forward_cnt = NULL ;
@@ -1247,19 +1248,60 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 	      }*/
 	    ASSERT(nbest < 32000)
 
-	    DynamicArray<float64_t> delta(m_seq_len, m_N, nbest); // 3d
+	    bool checkpointing = m_checkpoint_interval > 0;
+	    if (checkpointing && (nbest != 1 || long_transitions))
+	    {
+		    io::warn(
+		        "Trellis checkpointing requires nbest==1 and disabled long "
+		        "transitions; falling back to full tables.");
+		    checkpointing = false;
+	    }
+
+	    /* the value table is only ever read within the look-back band, so
+	     * under checkpointing a circular buffer spanning that band replaces
+	     * the full table; delta_cols is the maximal number of columns any
+	     * look-back window can cover, including the column being computed */
+	    int32_t delta_cols = m_seq_len;
+	    if (checkpointing)
+	    {
+		    int32_t band = 1;
+		    for (int32_t t = 1, lo = 0; t < m_seq_len; t++)
+		    {
+			    while (m_pos[t] - m_pos[lo] > max_look_back)
+				    lo++;
+			    band = Math::max(band, t - lo + 1);
+		    }
+		    delta_cols = band;
+	    }
+	    const int32_t trace_cols =
+	        checkpointing ? Math::min(m_seq_len, m_checkpoint_interval)
+	                      : m_seq_len;
+	    const int32_t num_checkpoints =
+	        checkpointing ? (m_seq_len + m_checkpoint_interval - 2) /
+	                m_checkpoint_interval
+	                      : 0;
+	    const int64_t checkpoint_size = int64_t(delta_cols) * m_N * nbest;
+
+	    DynamicArray<float64_t> delta(delta_cols, m_N, nbest); // 3d
 	    float64_t* delta_array = delta.get_array();
 	    // delta.set_const(0) ;
 
-	    DynamicArray<T_STATES> psi(m_seq_len, m_N, nbest); // 3d
+	    DynamicArray<T_STATES> psi(trace_cols, m_N, nbest); // 3d
 	    // psi.set_const(0) ;
 
-	    DynamicArray<int16_t> ktable(m_seq_len, m_N, nbest); // 3d
+	    DynamicArray<int16_t> ktable(trace_cols, m_N, nbest); // 3d
 	    // ktable.set_const(0) ;
 
-	    DynamicArray<int32_t> ptable(m_seq_len, m_N, nbest); // 3d
+	    DynamicArray<int32_t> ptable(trace_cols, m_N, nbest); // 3d
 	    // ptable.set_const(0) ;
 
+	    /* band snapshots taken at every m_checkpoint_interval-th column,
+	     * used to reseed the recursion when spans are replayed during the
+	     * traceback */
+	    DynamicArray<float64_t> checkpoint_deltas(
+	        Math::max(num_checkpoints, 1),
+	        checkpointing ? (int32_t)checkpoint_size : 1); // 2d
+
 	    DynamicArray<float64_t> delta_end(nbest);
 	    // delta_end.set_const(0) ;
 
@@ -1353,7 +1395,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 			for (T_STATES i=0; i<m_N; i++)
 			{
 				//delta.element(0, i, 0) = get_p(i) + seq.element(i,0) ;        // get_p defined in HMM.h to be equiv to initial_state_distribution
-				delta.element(delta_array, 0, i, 0, m_seq_len, m_N) = get_p(i) + seq.element(i,0) ;        // get_p defined in HMM.h to be equiv to initial_state_distribution
+				delta.element(delta_array, 0, i, 0, delta_cols, m_N) = get_p(i) + seq.element(i,0) ;        // get_p defined in HMM.h to be equiv to initial_state_distribution
 				psi.element(0,i,0)   = 0 ;
 				if (nbest>1)
 					ktable.element(0,i,0)  = 0 ;
@@ -1364,7 +1406,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 					delta.get_array_size(dim1, dim2, dim3) ;
 					//SG_DEBUG("i={}, k={} -- {}, {}, {}", i, k, dim1, dim2, dim3)
 					//delta.element(0, i, k)    = -CMath::INFTY ;
-					delta.element(delta_array, 0, i, k, m_seq_len, m_N)    = -Math::INFTY ;
+					delta.element(delta_array, 0, i, k, delta_cols, m_N)    = -Math::INFTY ;
 					psi.element(0,i,0)      = 0 ;                  // <--- what's this for?
 					if (nbest>1)
 						ktable.element(0,i,k)     = 0 ;
@@ -1393,8 +1435,9 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 
 		SG_DEBUG("START_RECURSION ")
 
-		// recursion
-		for (int32_t t=1; t<m_seq_len; t++)
+		/* the per-column recursion is shared between the forward sweep and
+		 * the traceback-time recomputation of checkpoint spans */
+		auto compute_column = [&](int32_t t)
 		{
 			for (T_STATES j=0; j<m_N; j++)
 			{
@@ -1402,11 +1445,11 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 				{ // if we cannot observe the symbol here, then we can omit the rest
 					for (int16_t k=0; k<nbest; k++)
 					{
-						delta.element(delta_array, t, j, k, m_seq_len, m_N)    = seq.element(j,t) ;
-						psi.element(t,j,k)         = 0 ;
+						delta.element(delta_array, t%delta_cols, j, k, delta_cols, m_N)    = seq.element(j,t) ;
+						psi.element(t%trace_cols,j,k)         = 0 ;
 						if (nbest>1)
-							ktable.element(t,j,k)  = 0 ;
-						ptable.element(t,j,k)      = 0 ;
+							ktable.element(t%trace_cols,j,k)  = 0 ;
+						ptable.element(t%trace_cols,j,k)      = 0 ;
 					}
 				}
 				else
@@ -1522,7 +1565,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 									if (with_loss)
 										val              += segment_loss ;
 
-									float64_t mval = -(val + delta.element(delta_array, ts, ii, 0, m_seq_len, m_N)) ;
+									float64_t mval = -(val + delta.element(delta_array, ts%delta_cols, ii, 0, delta_cols, m_N)) ;
 
 									if (mval<fixedtempvv_)
 									{
@@ -1541,7 +1584,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 										if (with_loss)
 											val              += segment_loss ;
 
-										float64_t mval = -(val + delta.element(delta_array, ts, ii, diff, m_seq_len, m_N)) ;
+										float64_t mval = -(val + delta.element(delta_array, ts%delta_cols, ii, diff, delta_cols, m_N)) ;
 
 										/* only place -val in fixedtempvv if it is one of the nbest lowest values in there */
 										/* fixedtempvv[i], i=0:nbest-1, is sorted so that fixedtempvv[0] <= fixedtempvv[1] <= ...*/
@@ -1672,8 +1715,8 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 								  io::print("Part1: ts={}  t={}  start_5p_part={}  m_seq_len={}\n", m_pos[ts], m_pos[t], m_pos[start_5p_part], m_seq_len);
 								  }*/
 
-								float64_t mval_trans = -( elem_val[i] + pen_val*0.5 + delta.element(delta_array, start_5p_part, ii, 0, m_seq_len, m_N) ) ;
-								//float64_t mval_trans = -( elem_val[i] + delta.element(delta_array, ts, ii, 0, m_seq_len, m_N) ) ; // enable this for the incomplete extra check
+								float64_t mval_trans = -( elem_val[i] + pen_val*0.5 + delta.element(delta_array, start_5p_part, ii, 0, delta_cols, m_N) ) ;
+								//float64_t mval_trans = -( elem_val[i] + delta.element(delta_array, ts, ii, 0, delta_cols, m_N) ) ; // enable this for the incomplete extra check
 
 								float64_t segment_loss_part1=0.0 ;
 								if (with_loss)
@@ -1724,7 +1767,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 #ifdef DYNPROG_DEBUG
 									long_transition_content_scores_pen.set_element(pen_val*0.5, ii, j) ;
 									long_transition_content_scores_elem.set_element(elem_val[i], ii, j) ;
-									long_transition_content_scores_prev.set_element(delta.element(delta_array, start_5p_part, ii, 0, m_seq_len, m_N), ii, j) ;
+									long_transition_content_scores_prev.set_element(delta.element(delta_array, start_5p_part, ii, 0, delta_cols, m_N), ii, j) ;
 									/*ASSERT(fabs(long_transition_content_scores.get_element(ii, j)-(long_transition_content_scores_pen.get_element(ii, j) +
 									  long_transition_content_scores_elem.get_element(ii, j) +
 									  long_transition_content_scores_prev.get_element(ii, j)))<1e-6) ;*/
@@ -1863,23 +1906,36 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 								fromtjk = fixedtempii[k];
 							}
 
-							delta.element(delta_array, t, j, k, m_seq_len, m_N)    = -minusscore + seq.element(j,t);
-							psi.element(t,j,k)      = (fromtjk%m_N) ;
+							delta.element(delta_array, t%delta_cols, j, k, delta_cols, m_N)    = -minusscore + seq.element(j,t);
+							psi.element(t%trace_cols,j,k)      = (fromtjk%m_N) ;
 							if (nbest>1)
-								ktable.element(t,j,k)   = (fromtjk%(m_N*nbest)-psi.element(t,j,k))/m_N ;
-							ptable.element(t,j,k)   = (fromtjk-(fromtjk%(m_N*nbest)))/(m_N*nbest) ;
+								ktable.element(t%trace_cols,j,k)   = (fromtjk%(m_N*nbest)-psi.element(t%trace_cols,j,k))/m_N ;
+							ptable.element(t%trace_cols,j,k)   = (fromtjk-(fromtjk%(m_N*nbest)))/(m_N*nbest) ;
 						}
 						else
 						{
-							delta.element(delta_array, t, j, k, m_seq_len, m_N)    = -Math::INFTY ;
-							psi.element(t,j,k)      = 0 ;
+							delta.element(delta_array, t%delta_cols, j, k, delta_cols, m_N)    = -Math::INFTY ;
+							psi.element(t%trace_cols,j,k)      = 0 ;
 							if (nbest>1)
-								ktable.element(t,j,k)     = 0 ;
-							ptable.element(t,j,k)     = 0 ;
+								ktable.element(t%trace_cols,j,k)     = 0 ;
+							ptable.element(t%trace_cols,j,k)     = 0 ;
 						}
 					}
 				}
 			}
+		};
+
+		// forward sweep; the look-back band is snapshot before entering
+		// each checkpoint span so that the span can be replayed later
+		for (int32_t t=1; t<m_seq_len; t++)
+		{
+			if (checkpointing && (t-1)%m_checkpoint_interval==0)
+			{
+				sg_memcpy(checkpoint_deltas.get_array()
+						+int64_t((t-1)/m_checkpoint_interval)*checkpoint_size,
+					delta_array, checkpoint_size*sizeof(float64_t)) ;
+			}
+			compute_column(t) ;
 		}
 		{ //termination
 			int32_t list_len = 0 ;
@@ -1887,7 +1943,7 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 			{
 				for (T_STATES i=0; i<m_N; i++)
 				{
-					oldtempvv[list_len] = -(delta.element(delta_array, (m_seq_len-1), i, diff, m_seq_len, m_N)+get_q(i)) ;
+					oldtempvv[list_len] = -(delta.element(delta_array, (m_seq_len-1)%delta_cols, i, diff, delta_cols, m_N)+get_q(i)) ;
 					oldtempii[list_len] = i + diff*m_N ;
 					list_len++ ;
 				}
@@ -1906,6 +1962,28 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 
 		}
 
+		/* after the forward sweep the traceback tables hold the pointers of
+		 * the last checkpoint span; earlier spans are replayed on demand
+		 * from their band snapshots */
+		int32_t materialized_span = checkpointing
+			? Math::max((m_seq_len-2)/m_checkpoint_interval, 0) : 0 ;
+		auto materialize_trace_span = [&](int32_t t)
+		{
+			if (!checkpointing)
+				return ;
+			const int32_t span = (t-1)/m_checkpoint_interval ;
+			if (span==materialized_span)
+				return ;
+			sg_memcpy(delta_array, checkpoint_deltas.get_array()
+					+int64_t(span)*checkpoint_size,
+				checkpoint_size*sizeof(float64_t)) ;
+			const int32_t span_end =
+				Math::min(m_seq_len-1, (span+1)*m_checkpoint_interval) ;
+			for (int32_t tr=span*m_checkpoint_interval+1; tr<=span_end; tr++)
+				compute_column(tr) ;
+			materialized_span = span ;
+		};
+
 		{ //state sequence backtracking
 			for (int16_t k=0; k<nbest; k++)
 			{
@@ -1922,10 +2000,11 @@ void DynProg::compute_nbest_paths(int32_t max_num_signals, bool use_orf,
 				{
 					ASSERT(i+1<m_seq_len)
 					//SG_DEBUG("s={} p={} q={}", state_seq[i], pos_seq[i], q)
-					state_seq[i+1] = psi.element(pos_seq[i], state_seq[i], q);
-					pos_seq[i+1]   = ptable.element(pos_seq[i], state_seq[i], q) ;
+					materialize_trace_span(pos_seq[i]) ;
+					state_seq[i+1] = psi.element(pos_seq[i]%trace_cols, state_seq[i], q);
+					pos_seq[i+1]   = ptable.element(pos_seq[i]%trace_cols, state_seq[i], q) ;
 					if (nbest>1)
-						q              = ktable.element(pos_seq[i], state_seq[i], q) ;
+						q              = ktable.element(pos_seq[i]%trace_cols, state_seq[i], q) ;
 					i++ ;
 				}
 				//SG_DEBUG("s={} p={} q={}", state_seq[i], pos_seq[i], q)
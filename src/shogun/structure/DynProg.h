@@ -477,6 +477,29 @@ public:
 		//m_long_transition_max = max_len;
 	}
 
+	/** settings for trellis checkpointing
+	 *
+	 *  When enabled, the Viterbi value table only keeps the columns within
+	 *  the maximal look-back band, a snapshot of that band is stored at
+	 *  every checkpoint_interval-th candidate position and the traceback
+	 *  tables are only kept for a single checkpoint span. The spans
+	 *  visited during traceback are recomputed from the nearest snapshot,
+	 *  trading a second pass over those spans for trellis memory that no
+	 *  longer scales with the full sequence length.
+	 *
+	 *  Only supported for nbest==1 with long transitions disabled;
+	 *  compute_nbest_paths() falls back to full tables otherwise.
+	 *
+	 *  @param checkpoint_interval number of candidate positions between
+	 *  two snapshots, 0 disables checkpointing; intervals well above the
+	 *  maximal look-back give the largest savings
+	 */
+	void set_checkpoint_interval(int32_t checkpoint_interval)
+	{
+		ASSERT(checkpoint_interval>=0)
+		m_checkpoint_interval = checkpoint_interval;
+	}
+
 protected:
 
 	/* helper functions */
@@ -753,6 +776,9 @@ protected:
 	/** threshold for transitions that are computed
 	 *  the traditional way*/
 	int32_t m_long_transition_threshold  ;
+	/** number of candidate positions between two trellis snapshots,
+	 *  0 disables checkpointing */
+	int32_t m_checkpoint_interval ;
 	/** maximal length of a long transition
 	 *  Note: is ignored in the current implementation
 	 *        => arbitrarily long transitions can be decoded
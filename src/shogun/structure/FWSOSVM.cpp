@@ -9,6 +9,9 @@
 #include <shogun/structure/FWSOSVM.h>
 #include <shogun/lib/SGVector.h>
 
+#include <numeric>
+#include <vector>
+
 using namespace shogun;
 
 FWSOSVM::FWSOSVM()
@@ -93,6 +96,9 @@ bool FWSOSVM::train_machine(std::shared_ptr<Features> data)
 		m_helper = std::make_shared<SOSVMHelper>();
 	}
 
+	// Number of oracle calls handed to the model at a time
+	const int32_t oracle_block_size = 64;
+
 	// Main loop
 	int32_t k = 0;
 	SGVector<float64_t> w_s(M);
@@ -104,43 +110,47 @@ bool FWSOSVM::train_machine(std::shared_ptr<Features> data)
 		w_s.zero();
 		ell_s = 0;
 
-		for (int32_t si = 0; si < N; ++si)
+		for (int32_t bs = 0; bs < N; bs += oracle_block_size)
 		{
-			// 1) solve the loss-augmented inference for point si
-			auto result = m_model->argmax(m_w, si);
+			// 1) solve the loss-augmented inference for a block of points,
+			// across threads if the model supports it
+			std::vector<int32_t> block(Math::min(N, bs + oracle_block_size) - bs);
+			std::iota(block.begin(), block.end(), bs);
+			auto results = m_model->argmax_block(m_w, block);
 
-			// 2) get the subgradient
-			// psi_i(y) := phi(x_i,y_i) - phi(x_i, y_pred)
-			SGVector<float64_t> psi_i(M);
-			if (result->psi_computed)
-			{
-				SGVector<float64_t>::add(psi_i.vector,
-					1.0, result->psi_truth.vector, -1.0, result->psi_pred.vector,
-					psi_i.vlen);
-			}
-			else if(result->psi_computed_sparse)
+			for (auto& result : results)
 			{
-				psi_i.zero();
-				result->psi_pred_sparse.add_to_dense(1.0, psi_i.vector, psi_i.vlen);
-				result->psi_truth_sparse.add_to_dense(-1.0, psi_i.vector, psi_i.vlen);
-			}
-			else
-			{
-				error("model({}) should have either of psi_computed or psi_computed_sparse"
-						"to be set true", m_model->get_name());
-			}
-
-			// 3) loss_i = L(y_i, y_pred)
-			float64_t loss_i = result->delta;
-			ASSERT(loss_i - linalg::dot(m_w, psi_i) >= -1e-12);
-
-			// 4) update w_s and ell_s
-			linalg::add(w_s, psi_i, w_s);
-			ell_s += loss_i;
-
-
-
-		} // end si
+				// 2) get the subgradient
+				// psi_i(y) := phi(x_i,y_i) - phi(x_i, y_pred)
+				SGVector<float64_t> psi_i(M);
+				if (result->psi_computed)
+				{
+					SGVector<float64_t>::add(psi_i.vector,
+						1.0, result->psi_truth.vector, -1.0, result->psi_pred.vector,
+						psi_i.vlen);
+				}
+				else if(result->psi_computed_sparse)
+				{
+					psi_i.zero();
+					result->psi_pred_sparse.add_to_dense(1.0, psi_i.vector, psi_i.vlen);
+					result->psi_truth_sparse.add_to_dense(-1.0, psi_i.vector, psi_i.vlen);
+				}
+				else
+				{
+					error("model({}) should have either of psi_computed or psi_computed_sparse"
+							"to be set true", m_model->get_name());
+				}
+
+				// 3) loss_i = L(y_i, y_pred)
+				float64_t loss_i = result->delta;
+				ASSERT(loss_i - linalg::dot(m_w, psi_i) >= -1e-12);
+
+				// 4) update w_s and ell_s
+				linalg::add(w_s, psi_i, w_s);
+				ell_s += loss_i;
+			} // end result
+
+		} // end bs
 
 		w_s.scale(1.0 / (N*m_lambda));
 		ell_s /= N;
@@ -38,6 +38,8 @@ FactorGraph::FactorGraph(const FactorGraph &fg)
 	m_dset = fg.get_disjoint_set();
 	m_has_cycle = !(fg.is_acyclic_graph());
 	m_num_edges = fg.get_num_edges();
+	// flattened view is rebuilt on demand
+	m_frozen = false;
 }
 
 FactorGraph::~FactorGraph()
@@ -58,6 +60,7 @@ void FactorGraph::init()
 {
 	m_has_cycle = false;
 	m_num_edges = 0;
+	m_frozen = false;
 	m_factors.clear();
 	m_datasources.clear();
 
@@ -69,6 +72,7 @@ void FactorGraph::add_factor(const std::shared_ptr<Factor>& factor)
 {
 	m_factors.push_back(factor);
 	m_num_edges += factor->get_variables().size();
+	m_frozen = false;
 
 	// graph structure changed after adding factors
 	if (m_dset->get_connected())
@@ -130,6 +134,63 @@ void FactorGraph::compute_energies()
 	{
 		fac->compute_energies();
 	}
+
+	freeze();
+}
+
+void FactorGraph::freeze()
+{
+	int32_t num_factors = m_factors.size();
+	int32_t total_vars = 0;
+	int32_t total_energies = 0;
+	for (auto& fac : m_factors)
+	{
+		total_vars += fac->get_num_vars();
+		total_energies += fac->get_energies().size();
+	}
+
+	m_flat_var_offsets = SGVector<int32_t>(num_factors + 1);
+	m_flat_energy_offsets = SGVector<int32_t>(num_factors + 1);
+	m_flat_type_ids = SGVector<int32_t>(num_factors);
+	m_flat_vars = SGVector<int32_t>(total_vars);
+	m_flat_strides = SGVector<int32_t>(total_vars);
+	m_flat_energies = SGVector<float64_t>(total_energies);
+
+	int32_t voff = 0;
+	int32_t eoff = 0;
+	for (int32_t fi = 0; fi < num_factors; ++fi)
+	{
+		auto fac = m_factors[fi];
+		m_flat_var_offsets[fi] = voff;
+		m_flat_energy_offsets[fi] = eoff;
+		m_flat_type_ids[fi] = fac->get_factor_type()->get_type_id();
+
+		SGVector<int32_t> vars = fac->get_variables();
+		SGVector<int32_t> cards = fac->get_cardinalities();
+		// energy tables are Matlab-linearized: leftmost indices run fastest
+		int32_t stride = 1;
+		for (int32_t vi = 0; vi < vars.size(); ++vi)
+		{
+			m_flat_vars[voff + vi] = vars[vi];
+			m_flat_strides[voff + vi] = stride;
+			stride *= cards[vi];
+		}
+		voff += vars.size();
+
+		SGVector<float64_t> energies = fac->get_energies();
+		sg_memcpy(m_flat_energies.vector + eoff, energies.vector,
+			energies.size() * sizeof(float64_t));
+		eoff += energies.size();
+	}
+	m_flat_var_offsets[num_factors] = voff;
+	m_flat_energy_offsets[num_factors] = eoff;
+
+	m_frozen = true;
+}
+
+bool FactorGraph::is_frozen() const
+{
+	return m_frozen;
 }
 
 float64_t FactorGraph::evaluate_energy(const SGVector<int32_t> state) const
@@ -137,6 +198,22 @@ float64_t FactorGraph::evaluate_energy(const SGVector<int32_t> state) const
 	ASSERT(state.size() == m_cardinalities.size());
 
 	float64_t energy = 0.0;
+
+	if (m_frozen)
+	{
+		// flattened view: walk contiguous arrays instead of per-factor
+		// objects
+		for (int32_t fi = 0; fi < m_flat_type_ids.size(); ++fi)
+		{
+			int32_t ei = 0;
+			for (int32_t vi = m_flat_var_offsets[fi]; vi < m_flat_var_offsets[fi+1]; ++vi)
+				ei += state[m_flat_vars[vi]] * m_flat_strides[vi];
+
+			energy += m_flat_energies[m_flat_energy_offsets[fi] + ei];
+		}
+		return energy;
+	}
+
 	for (auto& fac : m_factors)
 	{
 		energy += fac->evaluate_energy(state);
@@ -283,5 +360,9 @@ void FactorGraph::loss_augmentation(SGVector<int32_t> states_gt, SGVector<float6
 	// make sure all variables have been checked
 	int32_t min_var = Math::min(var_flags.vector, var_flags.vlen);
 	ASSERT(min_var == 1);
+
+	// augmented energies invalidated the flattened view
+	if (m_frozen)
+		freeze();
 }
 
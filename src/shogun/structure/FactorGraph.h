@@ -74,9 +74,24 @@ public:
 	 */
 	void set_cardinalities(SGVector<int32_t> cards);
 
-	/** compute energy tables in the factor graph */
+	/** compute energy tables in the factor graph
+	 * NOTE: the flattened view is rebuilt afterwards, see freeze()
+	 */
 	void compute_energies();
 
+	/** build a flattened view of the graph: variable indices, energy
+	 * table strides, factor type ids and energy tables of all factors
+	 * are packed into contiguous arrays, so that repeated energy
+	 * evaluations walk linear memory instead of chasing per-factor
+	 * objects. compute_energies() and loss_augmentation() keep the view
+	 * up to date; callers mutating factor energies directly via
+	 * Factor::set_energy() must call freeze() again themselves.
+	 */
+	void freeze();
+
+	/** @return whether the flattened view is up to date */
+	bool is_frozen() const;
+
 	/** evaluate energy given full assignment
 	 *
 	 * @param state an assignment
@@ -158,6 +173,27 @@ protected:
 	/** number of edges */
 	int32_t m_num_edges;
 
+	/** whether the flattened view below is up to date */
+	bool m_frozen;
+
+	/** per-factor offsets into m_flat_vars, size num_factors+1 */
+	SGVector<int32_t> m_flat_var_offsets;
+
+	/** concatenated adjacent variable indices of all factors */
+	SGVector<int32_t> m_flat_vars;
+
+	/** energy table strides aligned with m_flat_vars */
+	SGVector<int32_t> m_flat_strides;
+
+	/** factor type ids, one per factor */
+	SGVector<int32_t> m_flat_type_ids;
+
+	/** per-factor offsets into m_flat_energies, size num_factors+1 */
+	SGVector<int32_t> m_flat_energy_offsets;
+
+	/** concatenated energy tables of all factors */
+	SGVector<float64_t> m_flat_energies;
+
 };
 
 }
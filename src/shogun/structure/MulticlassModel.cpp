@@ -62,6 +62,18 @@ SGVector< float64_t > MulticlassModel::get_joint_feature_vector(int32_t feat_idx
 	return psi;
 }
 
+bool MulticlassModel::supports_parallel_argmax() const
+{
+	return true;
+}
+
+void MulticlassModel::init_training()
+{
+	// cache the number of classes up-front so that concurrent argmax()
+	// calls only read it
+	m_num_classes = m_labels->as<MulticlassSOLabels>()->get_num_classes();
+}
+
 std::shared_ptr<ResultSet> MulticlassModel::argmax(
 		SGVector< float64_t > w,
 		int32_t feat_idx,
@@ -70,16 +82,10 @@ std::shared_ptr<ResultSet> MulticlassModel::argmax(
 	auto df = m_features->as<DotFeatures>();
 	int32_t feats_dim   = df->get_dim_feature_space();
 
-	if ( training )
-	{
-		auto ml = m_labels->as<MulticlassSOLabels>();
-		m_num_classes = ml->get_num_classes();
-	}
-	else
-	{
-		require(m_num_classes > 0, "The model needs to be trained before "
-				"using it for prediction");
-	}
+	// m_num_classes is cached by init_training(); argmax() only reads
+	// it so that examples can be processed concurrently
+	require(m_num_classes > 0, "The model needs to be trained before "
+			"using it for prediction");
 
 	int32_t dim = get_dim();
 	ASSERT(dim == w.vlen)
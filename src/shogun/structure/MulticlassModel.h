@@ -75,6 +75,19 @@ class MulticlassModel : public StructuredModel
 		 */
 		std::shared_ptr<ResultSet> argmax(SGVector< float64_t > w, int32_t feat_idx, bool const training = true) override;
 
+		/** argmax() only reads the features, labels and the number of
+		 * classes set up in init_training(), so oracle calls for
+		 * different examples may run concurrently
+		 *
+		 * @return true
+		 */
+		bool supports_parallel_argmax() const override;
+
+		/** caches the number of classes from the labels so that
+		 * concurrent argmax() calls do not have to write it
+		 */
+		void init_training() override;
+
 		/** computes \f$ \Delta(y_{1}, y_{2}) \f$
 		 *
 		 * @param y1 an instance of structured data
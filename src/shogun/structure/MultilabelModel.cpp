@@ -150,23 +150,28 @@ SGVector<int32_t> MultilabelModel::to_sparse(SGVector<float64_t> dense_vec,
 	return sparse_vec;
 }
 
+bool MultilabelModel::supports_parallel_argmax() const
+{
+	return true;
+}
+
+void MultilabelModel::init_training()
+{
+	// cache the number of classes up-front so that concurrent argmax()
+	// calls only read it
+	m_num_classes = m_labels->as<MultilabelSOLabels>()->get_num_classes();
+}
+
 std::shared_ptr<ResultSet > MultilabelModel::argmax(SGVector<float64_t> w, int32_t feat_idx,
                                       bool const training)
 {
 	auto dot_feats = m_features->as<DotFeatures>();
 	int32_t feats_dim = dot_feats->get_dim_feature_space();
 
-	auto multi_labs = m_labels->as<MultilabelSOLabels>();
-
-	if (training)
-	{
-		m_num_classes = multi_labs->get_num_classes();
-	}
-	else
-	{
-		require(m_num_classes > 0, "The model needs to be trained before using "
-		        "it for prediction");
-	}
+	// m_num_classes is cached by init_training(); argmax() only reads
+	// it so that examples can be processed concurrently
+	require(m_num_classes > 0, "The model needs to be trained before using "
+	        "it for prediction");
 
 	int32_t dim = get_dim();
 	ASSERT(dim == w.vlen);
@@ -136,6 +136,33 @@ SGSparseVector< float64_t > StructuredModel::get_sparse_joint_feature_vector(
 	return SGSparseVector< float64_t >();
 }
 
+bool StructuredModel::supports_parallel_argmax() const
+{
+	return false;
+}
+
+std::vector<std::shared_ptr<ResultSet>> StructuredModel::argmax_block(
+		SGVector< float64_t > w,
+		const std::vector<int32_t>& feat_idxs,
+		bool const training)
+{
+	std::vector<std::shared_ptr<ResultSet>> results(feat_idxs.size());
+
+	if (supports_parallel_argmax())
+	{
+#pragma omp parallel for
+		for (int64_t i = 0; i < (int64_t)feat_idxs.size(); ++i)
+			results[i] = argmax(w, feat_idxs[i], training);
+	}
+	else
+	{
+		for (size_t i = 0; i < feat_idxs.size(); ++i)
+			results[i] = argmax(w, feat_idxs[i], training);
+	}
+
+	return results;
+}
+
 float64_t StructuredModel::delta_loss(int32_t ytrue_idx, std::shared_ptr<StructuredData> ypred)
 {
 	require(ytrue_idx >= 0 || ytrue_idx < m_labels->get_num_labels(),
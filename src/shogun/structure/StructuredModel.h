@@ -21,6 +21,8 @@
 #include <shogun/lib/SGSparseVector.h>
 #include <shogun/lib/StructuredData.h>
 
+#include <vector>
+
 namespace shogun
 {
 
@@ -236,6 +238,31 @@ class StructuredModel : public SGObject
 		 */
 		virtual std::shared_ptr<ResultSet> argmax(SGVector< float64_t > w, int32_t feat_idx, bool const training = true) = 0;
 
+		/**
+		 * whether argmax() may be called concurrently for different
+		 * examples. Models returning true guarantee that argmax() does
+		 * not mutate state shared between examples; the SO-SVM solvers
+		 * then distribute blocks of oracle calls across threads.
+		 *
+		 * @return true if argmax() is safe to call in parallel
+		 */
+		virtual bool supports_parallel_argmax() const;
+
+		/**
+		 * runs the loss-augmented oracle for a block of examples. If the
+		 * model supports_parallel_argmax(), the block is distributed
+		 * across threads, otherwise the examples are processed one at a
+		 * time. Results are returned in the order of the given indices.
+		 *
+		 * @param w weight vector
+		 * @param feat_idxs indices of the features to compute the argmax
+		 * @param training true if argmax is called during training
+		 *
+		 * @return predicted outputs, one per requested index
+		 */
+		std::vector<std::shared_ptr<ResultSet>> argmax_block(SGVector< float64_t > w,
+				const std::vector<int32_t>& feat_idxs, bool const training = true);
+
 		/** computes \f$ \Delta(y_{\text{true}}, y_{\text{pred}}) \f$
 		 *
 		 * @param ytrue_idx index of the true label in labels
@@ -70,4 +70,37 @@ TEST(Parallel, openmp_set_num_threads)
 
 	env()->set_num_threads(orig_num_threads);
 }
+
+TEST(Parallel, thread_budget_nesting)
+{
+	int32_t orig_num_threads = env()->get_num_threads();
+	env()->set_num_threads(4);
+
+	{
+		// outer region gets the full budget
+		ThreadBudget outer(env());
+		ASSERT_EQ(4, outer.get_num_threads());
+
+		// a nested region finds the budget exhausted and runs serially
+		// instead of oversubscribing
+		ThreadBudget inner(env());
+		ASSERT_EQ(1, inner.get_num_threads());
+	}
+
+	// releasing restores the full budget
+	{
+		ThreadBudget again(env());
+		ASSERT_EQ(4, again.get_num_threads());
+	}
+
+	// explicit requests are honoured while budget remains
+	{
+		ThreadBudget first(env(), 3);
+		ASSERT_EQ(3, first.get_num_threads());
+		ThreadBudget second(env());
+		ASSERT_EQ(1, second.get_num_threads());
+	}
+
+	env()->set_num_threads(orig_num_threads);
+}
 #endif // HAVE_OPENMP
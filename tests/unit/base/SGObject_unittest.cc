@@ -19,6 +19,7 @@
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/kernel/LinearKernel.h>
 #include <shogun/lib/DataType.h>
+#include <shogun/lib/observers/ObservedValueTemplated.h>
 #include <shogun/lib/observers/ParameterObserverLogger.h>
 #include <shogun/machine/gp/ExactInferenceMethod.h>
 #include <shogun/machine/gp/GaussianLikelihood.h>
@@ -263,6 +264,54 @@ TYPED_TEST(SGObjectClone, equals_other_has_null_param)
 	EXPECT_TRUE(clone->equals(obj));
 }
 
+TEST(SGObjectClone, shares_readonly_parameters)
+{
+	SGMatrix<float64_t> data(2, 3);
+	data.set_const(1.0);
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto kernel = std::make_shared<GaussianKernel>(10, 2.0);
+	kernel->init(features, features);
+
+	auto clone = kernel->clone()->as<GaussianKernel>();
+	ASSERT_NE(clone, nullptr);
+
+	// lhs/rhs are registered READONLY, so the clone shares the feature
+	// objects instead of deep-copying them
+	EXPECT_EQ(clone->get_lhs(), kernel->get_lhs());
+	EXPECT_EQ(clone->get_rhs(), kernel->get_rhs());
+
+	// parameters without READONLY are still deep-copied
+	auto obj = std::make_shared<CloneEqualsMock<float64_t>>();
+	auto obj_clone = obj->clone()->as<CloneEqualsMock<float64_t>>();
+	EXPECT_NE(obj_clone->m_sg_vector.vector, obj->m_sg_vector.vector);
+}
+
+TEST(SGObject, parameter_handle)
+{
+	auto obj = std::make_shared<CloneEqualsMock<float64_t>>();
+
+	auto handle = obj->get_parameter_handle<float64_t>("basic");
+	EXPECT_EQ(handle.get(), obj->m_basic);
+
+	// the handle reads the watched variable directly
+	obj->m_basic += 1;
+	EXPECT_EQ(handle.get(), obj->m_basic);
+
+	// writes through the handle are visible via the parameter map
+	handle.set(42);
+	EXPECT_EQ(obj->m_basic, 42);
+	EXPECT_EQ(obj->get<float64_t>("basic"), 42);
+
+	// emitting without subscribers is a no-op
+	handle.observe(0);
+
+	EXPECT_THROW(
+	    obj->get_parameter_handle<int32_t>("basic"), TypeMismatchException);
+	EXPECT_THROW(
+	    obj->get_parameter_handle<float64_t>("unknown"), ShogunException);
+}
+
 TEST(SGObject,equals_complex_equal)
 {
 	/* create some easy regression data: 1d noisy sine wave */
@@ -0,0 +1,91 @@
+#include <shogun/classifier/PluginEstimate.h>
+#include <shogun/distributions/LinearHMM.h>
+#include <shogun/features/StringFeatures.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <gtest/gtest.h>
+
+#include <random>
+
+using namespace shogun;
+
+TEST(PluginEstimate, linear_hmm_batch_matches_scalar)
+{
+	const int32_t seed = 17;
+	const int32_t seq_length = 24;
+	const int32_t num_symbols = 4;
+	const int32_t num_sequences = 37;
+
+	std::mt19937_64 prng(seed);
+	std::uniform_real_distribution<float64_t> uniform_prob(0.05, 1.0);
+
+	SGMatrix<float64_t> log_probs(num_symbols, seq_length);
+	for (int32_t i = 0; i < num_symbols * seq_length; i++)
+		log_probs[i] = std::log(uniform_prob(prng));
+
+	auto hmm = std::make_shared<LinearHMM>(seq_length, num_symbols);
+	hmm->set_log_transition_probs(log_probs);
+
+	SGMatrix<uint16_t> sequences(seq_length, num_sequences);
+	std::vector<const uint16_t*> vectors;
+	for (int32_t j = 0; j < num_sequences; j++)
+	{
+		for (int32_t i = 0; i < seq_length; i++)
+			sequences(i, j) = (uint16_t)(prng() % num_symbols);
+		vectors.push_back(sequences.get_column_vector(j));
+	}
+
+	SGVector<float64_t> batch(num_sequences);
+	hmm->get_log_likelihood_batch(
+	    vectors.data(), num_sequences, seq_length, batch.vector);
+
+	for (int32_t j = 0; j < num_sequences; j++)
+	{
+		float64_t scalar = hmm->get_log_likelihood_example(
+		    sequences.get_column_vector(j), seq_length);
+		EXPECT_DOUBLE_EQ(scalar, batch[j]);
+	}
+}
+
+TEST(PluginEstimate, batched_log_odds_matches_apply_one)
+{
+	const int32_t seed = 17;
+	const char symbols[4] = {'A', 'C', 'G', 'T'};
+	const index_t num_strings = 70;
+	const index_t string_length = 16;
+
+	std::mt19937_64 prng(seed);
+
+	std::vector<SGVector<char>> strings;
+	strings.reserve(num_strings);
+	SGVector<float64_t> labels(num_strings);
+	for (index_t i = 0; i < num_strings; i++)
+	{
+		SGVector<char> current(string_length);
+		for (index_t j = 0; j < string_length; j++)
+			current[j] = symbols[prng() % 4];
+		strings.push_back(current);
+		labels[i] = (i % 2 == 0) ? 1.0 : -1.0;
+	}
+
+	auto char_feats = std::make_shared<StringFeatures<char>>(strings, DNA);
+	auto word_feats =
+	    std::make_shared<StringFeatures<uint16_t>>(char_feats->get_alphabet());
+	word_feats->obtain_from_char(char_feats, 0, 1, 0, false);
+
+	auto machine = std::make_shared<PluginEstimate>();
+	machine->set_labels(std::make_shared<BinaryLabels>(labels));
+	machine->set_features(word_feats);
+	machine->train();
+
+	SGVector<float64_t> batched =
+	    machine->apply_log_odds_batch(0, num_strings);
+	ASSERT_EQ(num_strings, batched.vlen);
+	for (index_t i = 0; i < num_strings; i++)
+		EXPECT_DOUBLE_EQ(machine->apply_one(i), batched[i]);
+
+	// sub-ranges score the same vectors
+	SGVector<float64_t> tail = machine->apply_log_odds_batch(5, 25);
+	ASSERT_EQ(20, tail.vlen);
+	for (index_t i = 0; i < tail.vlen; i++)
+		EXPECT_DOUBLE_EQ(batched[5 + i], tail[i]);
+}
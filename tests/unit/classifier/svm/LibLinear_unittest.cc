@@ -436,3 +436,38 @@ TEST_F(LibLinearFixture, simple_set_train_L2R_LR_DUAL_BIAS)
 	// bias, not l1
 	train_with_solver_simple(liblinear_solver_type, true, false, t_w);
 }
+
+TEST_F(LibLinearFixture, train_path_matches_cold_starts)
+{
+	generate_data_l2();
+
+	auto ll = std::make_shared<LibLinear>(L2R_L1LOSS_SVC_DUAL);
+	ll->set_bias_enabled(false);
+	ll->set_features(train_feats);
+	ll->set_labels(ground_truth);
+
+	SGVector<float64_t> Cs(3);
+	Cs[0] = 0.1;
+	Cs[1] = 1.0;
+	Cs[2] = 10.0;
+	SGMatrix<float64_t> path = ll->train_path(Cs);
+
+	ASSERT_EQ(path.num_cols, 3);
+
+	// every warm-started solution of the path must agree with an
+	// independent cold start at the same C
+	for (index_t c = 0; c < Cs.vlen; c++)
+	{
+		auto cold = std::make_shared<LibLinear>(L2R_L1LOSS_SVC_DUAL);
+		cold->set_bias_enabled(false);
+		cold->set_features(train_feats);
+		cold->set_labels(ground_truth);
+		cold->set_C(Cs[c], Cs[c]);
+		cold->train();
+
+		SGVector<float64_t> w = cold->get_w();
+		ASSERT_EQ(path.num_rows, w.vlen);
+		for (index_t i = 0; i < w.vlen; i++)
+			EXPECT_NEAR(path(i, c), w[i], 1e-3);
+	}
+}
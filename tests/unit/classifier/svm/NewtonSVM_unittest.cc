@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <shogun/lib/config.h>
+#include <shogun/classifier/svm/NewtonSVM.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/labels/BinaryLabels.h>
+
+#include "environments/LinearTestEnvironment.h"
+
+using namespace shogun;
+
+extern LinearTestEnvironment* linear_test_env;
+
+TEST(NewtonSVMTest, hessian_free_matches_explicit_solver)
+{
+	std::shared_ptr<GaussianCheckerboard> mockData =
+	    linear_test_env->getBinaryLabelData();
+
+	auto train_feats = mockData->get_features_train();
+	auto train_labels = mockData->get_labels_train();
+
+	auto svm = std::make_shared<NewtonSVM>(1.0, train_feats, train_labels);
+	svm->train();
+	SGVector<float64_t> w_explicit = svm->get_w().clone();
+	float64_t bias_explicit = svm->get_bias();
+
+	auto svm_cg = std::make_shared<NewtonSVM>(1.0, train_feats, train_labels);
+	svm_cg->set_hessian_free_enabled(true);
+	svm_cg->train();
+	SGVector<float64_t> w_cg = svm_cg->get_w();
+
+	ASSERT_EQ(w_explicit.vlen, w_cg.vlen);
+	for (index_t i = 0; i < w_explicit.vlen; i++)
+		EXPECT_NEAR(w_explicit[i], w_cg[i], 1e-4);
+	EXPECT_NEAR(bias_explicit, svm_cg->get_bias(), 1e-4);
+}
@@ -10,6 +10,7 @@
 #include <shogun/clustering/KMeansMiniBatch.h>
 #include <shogun/distance/EuclideanDistance.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/labels/MulticlassLabels.h>
 #include <shogun/lib/observers/ParameterObserver.h>
 #include <shogun/lib/observers/ParameterObserverLogger.h>
@@ -293,3 +294,188 @@ TEST(KMeans, random_centers_assign)
 
 }
 
+
+TEST(KMeans, bound_pruning_matches_lloyd)
+{
+	/* three well separated point clouds on a line, plus stragglers */
+	SGMatrix<float64_t> data(2, 12);
+	for (int32_t c=0; c<3; c++)
+	{
+		for (int32_t i=0; i<4; i++)
+		{
+			data(0, c*4+i)=10*c+i*0.5;
+			data(1, c*4+i)=i%2;
+		}
+	}
+
+	SGMatrix<float64_t> initial_centers(2, 3);
+	for (int32_t c=0; c<3; c++)
+	{
+		initial_centers(0, c)=10*c+3;
+		initial_centers(1, c)=2;
+	}
+
+	auto features=std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto distance=std::make_shared<EuclideanDistance>(features, features);
+	auto lloyd=std::make_shared<KMeans>(3, distance, initial_centers.clone());
+	lloyd->train(features);
+	SGMatrix<float64_t> lloyd_centers=lloyd->get_cluster_centers();
+
+	auto distance_pruned=std::make_shared<EuclideanDistance>(features, features);
+	auto pruned=std::make_shared<KMeans>(3, distance_pruned, initial_centers.clone());
+	pruned->set_use_bound_pruning(true);
+	pruned->train(features);
+	SGMatrix<float64_t> pruned_centers=pruned->get_cluster_centers();
+
+	ASSERT_EQ(lloyd_centers.num_rows, pruned_centers.num_rows);
+	ASSERT_EQ(lloyd_centers.num_cols, pruned_centers.num_cols);
+	for (int32_t i=0; i<lloyd_centers.num_rows*lloyd_centers.num_cols; i++)
+		EXPECT_NEAR(lloyd_centers.matrix[i], pruned_centers.matrix[i], 1e-10);
+
+	auto result=pruned->apply()->as<MulticlassLabels>();
+	for (int32_t c=0; c<3; c++)
+	{
+		for (int32_t i=1; i<4; i++)
+			EXPECT_EQ(result->get_label(c*4), result->get_label(c*4+i));
+	}
+}
+
+TEST(KMeans, kmeans_parallel_seeding_test)
+{
+	/*create a rectangle with four points as (0,0) (0,10) (2,0) (2,10)*/
+	SGMatrix<float64_t> rect(2, 4);
+	rect(0,0)=0;
+	rect(0,1)=0;
+	rect(0,2)=2;
+	rect(0,3)=2;
+	rect(1,0)=0;
+	rect(1,1)=10;
+	rect(1,2)=0;
+	rect(1,3)=10;
+
+	auto features=std::make_shared<DenseFeatures<float64_t>>(rect);
+
+	auto distance=std::make_shared<EuclideanDistance>(features, features);
+	auto clustering=std::make_shared<KMeans>(4, distance);
+	clustering->put<bool>("kmeans_parallel", true);
+
+	for (int32_t loop=0; loop<10; loop++)
+	{
+		clustering->train(features);
+		auto learnt_centers=distance->get_lhs()->as<DenseFeatures<float64_t>>();
+		SGMatrix<float64_t> learnt_centers_matrix=learnt_centers->get_feature_matrix();
+		SGVector<int32_t> count=SGVector<int32_t>(4);
+		count.zero();
+		for (int32_t c=0; c<4; c++)
+		{
+			if (learnt_centers_matrix(0,c)==0 && learnt_centers_matrix(1,c)==0)
+				count[0]++;
+			else if (learnt_centers_matrix(0,c)==0 && learnt_centers_matrix(1,c)==10)
+				count[1]++;
+			else if (learnt_centers_matrix(0,c)==2 && learnt_centers_matrix(1,c)==0)
+				count[2]++;
+			else if (learnt_centers_matrix(0,c)==2 && learnt_centers_matrix(1,c)==10)
+				count[3]++;
+		}
+
+		EXPECT_EQ(1, count[0]);
+		EXPECT_EQ(1, count[1]);
+		EXPECT_EQ(1, count[2]);
+		EXPECT_EQ(1, count[3]);
+	}
+}
+
+TEST(KMeans, minibatch_streaming_training_test)
+{
+	/*create a rectangle with four points as (0,0) (0,1000) (2,0) (2,1000)*/
+	SGMatrix<float64_t> rect(2, 4);
+	rect(0,0)=0;
+	rect(0,1)=0;
+	rect(0,2)=2;
+	rect(0,3)=2;
+	rect(1,0)=0;
+	rect(1,1)=1000;
+	rect(1,2)=0;
+	rect(1,3)=1000;
+
+	SGMatrix<float64_t> initial_centers(2,1);
+	initial_centers(0,0)=0;
+	initial_centers(1,0)=0;
+
+	auto features=std::make_shared<DenseFeatures<float64_t>>(rect);
+	auto distance=std::make_shared<EuclideanDistance>();
+	auto clustering=
+	    std::make_shared<KMeansMiniBatch>(1, distance, initial_centers);
+	clustering->put<int32_t>("batch_size", 2);
+
+	/* running-mean updates over the two chunks reproduce the full mean */
+	auto stream=std::make_shared<StreamingDenseFeatures<float64_t>>(features);
+	clustering->train_on_stream(stream);
+
+	auto learnt_centers_matrix=clustering->get_cluster_centers();
+	EXPECT_NEAR(1, learnt_centers_matrix(0,0), 1e-10);
+	EXPECT_NEAR(500, learnt_centers_matrix(1,0), 1e-10);
+}
+
+TEST(KMeans, warm_start_and_delta_refit)
+{
+	/*create a rectangle with four points as (0,0) (0,10) (2,0) (2,10)*/
+	SGMatrix<float64_t> rect(2, 4);
+	rect(0,0)=0;
+	rect(0,1)=0;
+	rect(0,2)=2;
+	rect(0,3)=2;
+	rect(1,0)=0;
+	rect(1,1)=10;
+	rect(1,2)=0;
+	rect(1,3)=10;
+
+	SGMatrix<float64_t> initial_centers(2,2);
+	initial_centers(0,0)=0;
+	initial_centers(0,1)=2;
+	initial_centers(1,0)=5;
+	initial_centers(1,1)=5;
+
+	auto features=std::make_shared<DenseFeatures<float64_t>>(rect);
+	auto distance=std::make_shared<EuclideanDistance>(features, features);
+	auto clustering=std::make_shared<KMeans>(2, distance);
+	clustering->put<SGMatrix<float64_t>>("initial_centers", initial_centers);
+	clustering->train(features);
+
+	/* warm start reuses the converged centers and stays at the optimum */
+	clustering->put<bool>("warm_start", true);
+	clustering->train(features);
+
+	auto learnt_centers_matrix=clustering->get_cluster_centers();
+	EXPECT_NEAR(0, learnt_centers_matrix(0,0), 1e-10);
+	EXPECT_NEAR(5, learnt_centers_matrix(1,0), 1e-10);
+	EXPECT_NEAR(2, learnt_centers_matrix(0,1), 1e-10);
+	EXPECT_NEAR(5, learnt_centers_matrix(1,1), 1e-10);
+
+	/* an added point pulls its nearest center by one running-mean step:
+	 * (4,5) joins the two points of center (2,5), giving (8/3,5) */
+	SGMatrix<float64_t> add(2, 1);
+	add(0,0)=4;
+	add(1,0)=5;
+	auto added=std::make_shared<DenseFeatures<float64_t>>(add);
+	clustering->refit_delta(added);
+
+	learnt_centers_matrix=clustering->get_cluster_centers();
+	EXPECT_NEAR(0, learnt_centers_matrix(0,0), 1e-10);
+	EXPECT_NEAR(5, learnt_centers_matrix(1,0), 1e-10);
+	EXPECT_NEAR(8.0/3.0, learnt_centers_matrix(0,1), 1e-10);
+	EXPECT_NEAR(5, learnt_centers_matrix(1,1), 1e-10);
+
+	/* removing a point subtracts it from the running mean of its
+	 * nearest center */
+	SGMatrix<float64_t> rem(2, 1);
+	rem(0,0)=0;
+	rem(1,0)=10;
+	auto removed=std::make_shared<DenseFeatures<float64_t>>(rem);
+	clustering->refit_delta(nullptr, removed);
+
+	learnt_centers_matrix=clustering->get_cluster_centers();
+	EXPECT_NEAR(0, learnt_centers_matrix(0,0), 1e-10);
+	EXPECT_NEAR(0, learnt_centers_matrix(1,0), 1e-10);
+}
@@ -12,6 +12,8 @@
 #include <shogun/features/DenseSubSamplesFeatures.h>
 #include <shogun/lib/SGMatrix.h>
 
+#include <random>
+
 using namespace shogun;
 
 std::shared_ptr<DenseFeatures<float64_t>> create_lhs()
@@ -144,4 +146,48 @@ TEST(EuclideanDistance, heterogenous_features)
 
 
 
+}
+
+TEST(EuclideanDistance, get_distance_matrix_blocked)
+{
+	const int32_t num_feat=5;
+	const int32_t num_vec_lhs=23;
+	const int32_t num_vec_rhs=17;
+
+	std::mt19937_64 prng(17);
+	std::uniform_real_distribution<float64_t> dist(-1.0, 1.0);
+
+	SGMatrix<float64_t> feat_mat_lhs(num_feat, num_vec_lhs);
+	SGMatrix<float64_t> feat_mat_rhs(num_feat, num_vec_rhs);
+	for (int32_t i=0; i<num_feat*num_vec_lhs; i++)
+		feat_mat_lhs.matrix[i]=dist(prng);
+	for (int32_t i=0; i<num_feat*num_vec_rhs; i++)
+		feat_mat_rhs.matrix[i]=dist(prng);
+
+	auto features_lhs=std::make_shared<DenseFeatures<float64_t>>(feat_mat_lhs);
+	auto features_rhs=std::make_shared<DenseFeatures<float64_t>>(feat_mat_rhs);
+
+	auto euclidean=std::make_shared<EuclideanDistance>(features_lhs, features_rhs);
+	ASSERT_TRUE(euclidean->has_block_computation());
+
+	SGMatrix<float64_t> distance_matrix=euclidean->get_distance_matrix();
+	for (int32_t j=0; j<num_vec_rhs; j++)
+	{
+		for (int32_t i=0; i<num_vec_lhs; i++)
+			EXPECT_NEAR(distance_matrix(i,j), euclidean->distance(i,j), 1E-12);
+	}
+
+	// symmetric case without sqrt
+	euclidean=std::make_shared<EuclideanDistance>(features_lhs, features_lhs);
+	euclidean->set_disable_sqrt(true);
+
+	distance_matrix=euclidean->get_distance_matrix();
+	for (int32_t j=0; j<num_vec_lhs; j++)
+	{
+		for (int32_t i=0; i<num_vec_lhs; i++)
+		{
+			EXPECT_NEAR(distance_matrix(i,j), euclidean->distance(i,j), 1E-12);
+			EXPECT_DOUBLE_EQ(distance_matrix(i,j), distance_matrix(j,i));
+		}
+	}
 }
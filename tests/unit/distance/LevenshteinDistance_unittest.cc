@@ -41,3 +41,48 @@ TEST(LevenshteinDistance, distance)
 	EXPECT_EQ(levenshtein->distance(1, 1), 3);
 	EXPECT_EQ(levenshtein->distance(2, 2), 1);
 }
+
+TEST(LevenshteinDistance, get_distance_matrix)
+{
+	auto features_lhs = create_string_lhs();
+	auto features_rhs = create_string_rhs();
+	auto levenshtein =
+	    std::make_shared<LevenshteinDistance>(features_lhs, features_rhs);
+
+	SGMatrix<float64_t> distance_matrix = levenshtein->get_distance_matrix();
+	for (int32_t j = 0; j < 3; ++j)
+	{
+		for (int32_t i = 0; i < 3; ++i)
+			EXPECT_EQ(distance_matrix(i, j), levenshtein->distance(i, j));
+	}
+}
+
+TEST(LevenshteinDistance, upper_bounded_long_strings)
+{
+	// more than 64 characters exercises the banded two-row path
+	const int32_t len = 80;
+	SGVector<char> a(len);
+	SGVector<char> b(len);
+	for (int32_t i = 0; i < len; ++i)
+	{
+		a[i] = 'a' + (i % 3);
+		b[i] = a[i];
+	}
+	b[10] = 'z';
+	b[40] = 'z';
+	b[70] = 'z';
+
+	std::vector<SGVector<char>> strings_a = {a};
+	std::vector<SGVector<char>> strings_b = {b};
+	auto features_lhs =
+	    std::make_shared<StringFeatures<char>>(strings_a, RAWBYTE);
+	auto features_rhs =
+	    std::make_shared<StringFeatures<char>>(strings_b, RAWBYTE);
+	auto levenshtein =
+	    std::make_shared<LevenshteinDistance>(features_lhs, features_rhs);
+
+	EXPECT_EQ(levenshtein->distance(0, 0), 3);
+	EXPECT_EQ(levenshtein->distance_upper_bounded(0, 0, 5), 3);
+	// a threshold below the distance reports only that it is exceeded
+	EXPECT_GT(levenshtein->distance_upper_bounded(0, 0, 1), 1);
+}
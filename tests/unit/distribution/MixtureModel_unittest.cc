@@ -96,3 +96,62 @@ TEST(MixtureModel,gaussian_mixture_model)
 }
 
 #endif /* HAVE_LAPACK */
+
+#ifdef HAVE_LAPACK
+
+TEST(MixtureModel,gaussian_mixture_model_minibatch)
+{
+	std::mt19937_64 prng(28);
+	SGMatrix<float64_t> data(1,400);
+
+	NormalDistribution<float64_t> normal_dist;
+	for (int32_t i=0;i<100;i++)
+		data(0,i)=normal_dist(prng);
+	for (int32_t i=100;i<400;i++)
+		data(0,i)=normal_dist(prng)+10;
+
+	auto feats=std::make_shared<DenseFeatures<float64_t>>(data);
+
+	std::vector<std::shared_ptr<Distribution>> comps;
+	SGVector<float64_t> mean1(1);
+	mean1[0]=5;
+	SGMatrix<float64_t> cov1(1,1);
+	cov1(0,0)=5;
+	auto g1=std::make_shared<Gaussian>(mean1,cov1,DIAG);
+
+	SGVector<float64_t> mean2(1);
+	mean2[0]=4;
+	SGMatrix<float64_t> cov2(1,1);
+	cov2(0,0)=3;
+	auto g2=std::make_shared<Gaussian>(mean2,cov2,DIAG);
+
+	comps.push_back(g1);
+	comps.push_back(g2);
+
+	SGVector<float64_t> weights(2);
+	weights[0]=0.5;
+	weights[1]=0.5;
+
+	auto mix=std::make_shared<MixtureModel>(comps,weights);
+	mix->set_minibatch_size(64);
+	mix->train(feats);
+
+	/* incremental EM reaches the same stationary point as full-batch
+	 * EM on this well separated data, up to a looser tolerance */
+	auto outg=comps[0]->as<Gaussian>();
+	SGVector<float64_t> m=outg->get_mean();
+	SGMatrix<float64_t> cov=outg->get_cov();
+
+	float64_t eps=1e-3;
+	EXPECT_NEAR(m[0],10.00922977,eps);
+	EXPECT_NEAR(cov(0,0),0.96363983,eps);
+
+	outg=comps[1]->as<Gaussian>();
+	m=outg->get_mean();
+	cov=outg->get_cov();
+
+	EXPECT_NEAR(m[0],-0.159334860,eps);
+	EXPECT_NEAR(cov(0,0),1.075649391,eps);
+}
+
+#endif /* HAVE_LAPACK */
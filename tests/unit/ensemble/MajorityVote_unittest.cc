@@ -102,3 +102,84 @@ TEST(MajorityVote, multiclass_combine_vector)
 
 	
 }
+
+TEST(MajorityVote, streamed_combine_multiclass)
+{
+	std::mt19937_64 prng(32);
+
+	int32_t num_vectors = 20;
+	int32_t num_classifiers = 15;
+	int32_t num_classes = 3;
+	SGMatrix<float64_t> ensemble_matrix(num_vectors, num_classifiers);
+	auto mv = std::make_shared<MajorityVote>();
+
+	EXPECT_FALSE(mv->supports_streamed_combine());
+	mv->set_num_vote_bins(num_classes);
+	ASSERT_TRUE(mv->supports_streamed_combine());
+
+	UniformIntDistribution<int32_t> uniform_int_dist(0, num_classes - 1);
+	for (index_t i = 0; i < num_vectors * num_classifiers; ++i)
+		ensemble_matrix.matrix[i] = uniform_int_dist(prng);
+
+	SGMatrix<float64_t> accumulator(
+		mv->get_num_accumulator_slots(), num_vectors);
+	accumulator.zero();
+	for (index_t j = 0; j < num_classifiers; ++j)
+	{
+		SGVector<float64_t> member(
+			ensemble_matrix.get_column_vector(j), num_vectors, false);
+		mv->accumulate(accumulator, member);
+	}
+	SGVector<float64_t> streamed = mv->finalize(accumulator, num_classifiers);
+
+	ASSERT_EQ(num_vectors, streamed.vlen);
+	for (index_t i = 0; i < num_vectors; ++i)
+	{
+		/* histogram argmax, ties break toward the smaller label */
+		SGVector<index_t> hist(num_classes);
+		hist.zero();
+		for (index_t j = 0; j < num_classifiers; ++j)
+			hist[index_t(ensemble_matrix(i, j))]++;
+
+		index_t max_label = 0;
+		for (index_t c = 1; c < num_classes; ++c)
+		{
+			if (hist[c] > hist[max_label])
+				max_label = c;
+		}
+
+		EXPECT_EQ(max_label, streamed[i]);
+	}
+}
+
+TEST(MajorityVote, streamed_combine_binary)
+{
+	std::mt19937_64 prng(2);
+
+	int32_t num_vectors = 25;
+	int32_t num_classifiers = 9;
+	SGMatrix<float64_t> ensemble_matrix(num_vectors, num_classifiers);
+	auto mv = std::make_shared<MajorityVote>();
+	mv->set_num_vote_bins(2);
+
+	UniformIntDistribution<int32_t> uniform_int_dist(0, 1);
+	for (index_t i = 0; i < num_vectors * num_classifiers; ++i)
+		ensemble_matrix.matrix[i] = uniform_int_dist(prng) == 0 ? -1 : 1;
+
+	SGMatrix<float64_t> accumulator(
+		mv->get_num_accumulator_slots(), num_vectors);
+	accumulator.zero();
+	for (index_t j = 0; j < num_classifiers; ++j)
+	{
+		SGVector<float64_t> member(
+			ensemble_matrix.get_column_vector(j), num_vectors, false);
+		mv->accumulate(accumulator, member);
+	}
+	SGVector<float64_t> streamed = mv->finalize(accumulator, num_classifiers);
+
+	/* odd classifier count, so no ties and the map-based path agrees */
+	SGVector<float64_t> combined = mv->combine(ensemble_matrix);
+	ASSERT_EQ(combined.vlen, streamed.vlen);
+	for (index_t i = 0; i < num_vectors; ++i)
+		EXPECT_DOUBLE_EQ(combined[i], streamed[i]);
+}
@@ -63,3 +63,33 @@ TEST(MeanRule, combine_vector)
 
 	EXPECT_DOUBLE_EQ(expected, combined);
 }
+
+TEST(MeanRule, streamed_combine_matches_matrix)
+{
+	int32_t num_vectors = 20;
+	int32_t num_classifiers = 5;
+	std::mt19937_64 prng(32);
+
+	auto mr = std::make_shared<MeanRule>();
+	SGMatrix<float64_t> ensemble_matrix(num_vectors, num_classifiers);
+	generate_random_ensemble_matrix(ensemble_matrix, prng);
+
+	ASSERT_TRUE(mr->supports_streamed_combine());
+	SGMatrix<float64_t> accumulator(
+		mr->get_num_accumulator_slots(), num_vectors);
+	accumulator.zero();
+
+	/* fold in one classifier's outputs at a time */
+	for (index_t j = 0; j < num_classifiers; ++j)
+	{
+		SGVector<float64_t> member(
+			ensemble_matrix.get_column_vector(j), num_vectors, false);
+		mr->accumulate(accumulator, member);
+	}
+	SGVector<float64_t> streamed = mr->finalize(accumulator, num_classifiers);
+
+	SGVector<float64_t> combined = mr->combine(ensemble_matrix);
+	ASSERT_EQ(combined.vlen, streamed.vlen);
+	for (index_t i = 0; i < combined.vlen; ++i)
+		EXPECT_DOUBLE_EQ(combined[i], streamed[i]);
+}
@@ -132,3 +132,47 @@ TEST(WeightedMajorityVote, multiclass_combine_vector)
 
 	
 }
+TEST(WeightedMajorityVote, streamed_accumulate_honors_weights)
+{
+	std::mt19937_64 prng(57);
+	int32_t num_classifiers = 10;
+	int32_t num_vectors = 20;
+	int32_t num_classes = 3;
+
+	SGVector<float64_t> weights(num_classifiers);
+	random::fill_array(weights, 0.5, 2.0, prng);
+	auto mv = std::make_shared<WeightedMajorityVote>(weights);
+	mv->set_num_vote_bins(num_classes);
+
+	SGMatrix<float64_t> accumulator(
+		mv->get_num_accumulator_slots(), num_vectors);
+	accumulator.zero();
+	SGMatrix<float64_t> hist(num_classes, num_vectors);
+	hist.zero();
+
+	UniformIntDistribution<int32_t> uniform_int_dist(0, num_classes-1);
+	for (index_t i = 0; i < num_classifiers; ++i)
+	{
+		SGVector<float64_t> outputs(num_vectors);
+		for (index_t j = 0; j < num_vectors; ++j)
+		{
+			outputs[j] = uniform_int_dist(prng);
+			hist(index_t(outputs[j]), j) += weights[i];
+		}
+		EXPECT_DOUBLE_EQ(weights[i], mv->get_member_weight(i));
+		mv->accumulate(accumulator, outputs, mv->get_member_weight(i));
+	}
+
+	SGVector<float64_t> combined = mv->finalize(accumulator, num_classifiers);
+	for (index_t j = 0; j < num_vectors; ++j)
+	{
+		// finalize breaks ties toward the smaller label
+		index_t max_bin = 0;
+		for (index_t c = 1; c < num_classes; ++c)
+		{
+			if (hist(c, j) > hist(max_bin, j))
+				max_bin = c;
+		}
+		EXPECT_EQ(max_bin, combined[j]);
+	}
+}
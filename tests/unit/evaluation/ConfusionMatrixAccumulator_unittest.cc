@@ -0,0 +1,64 @@
+#include <shogun/evaluation/ConfusionMatrixAccumulator.h>
+#include <shogun/evaluation/MulticlassAccuracy.h>
+#include <shogun/labels/MulticlassLabels.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(ConfusionMatrixAccumulator, fused_metrics_from_one_pass)
+{
+	SGVector<float64_t> pred_vec({0, 1, 2, 0, 1, 2, 0, 0});
+	SGVector<float64_t> truth_vec({0, 1, 2, 1, 1, 0, 0, 2});
+
+	auto predicted = std::make_shared<MulticlassLabels>(pred_vec);
+	auto ground_truth = std::make_shared<MulticlassLabels>(truth_vec);
+
+	ConfusionMatrixAccumulator accumulator(predicted, ground_truth);
+
+	EXPECT_EQ(3, accumulator.get_num_classes());
+	EXPECT_EQ(0, accumulator.get_num_rejects());
+	EXPECT_DOUBLE_EQ(5.0 / 8.0, accumulator.get_accuracy(true));
+
+	/* engine matches the reference implementation layout */
+	SGMatrix<int32_t> expected = MulticlassAccuracy::get_confusion_matrix(
+	    predicted, ground_truth);
+	SGMatrix<int32_t> actual = accumulator.get_confusion_matrix();
+	ASSERT_EQ(expected.num_rows, actual.num_rows);
+	for (index_t i = 0; i < expected.num_rows * expected.num_cols; i++)
+		EXPECT_EQ(expected[i], actual[i]);
+
+	/* class 0 predicted 4 times, 2 correct; class 0 true 3 times */
+	SGVector<float64_t> precision = accumulator.get_precision();
+	SGVector<float64_t> recall = accumulator.get_recall();
+	EXPECT_DOUBLE_EQ(2.0 / 4.0, precision[0]);
+	EXPECT_DOUBLE_EQ(2.0 / 2.0, precision[1]);
+	EXPECT_DOUBLE_EQ(1.0 / 2.0, precision[2]);
+	EXPECT_DOUBLE_EQ(2.0 / 3.0, recall[0]);
+	EXPECT_DOUBLE_EQ(2.0 / 3.0, recall[1]);
+	EXPECT_DOUBLE_EQ(1.0 / 2.0, recall[2]);
+
+	auto evaluation = std::make_shared<MulticlassAccuracy>();
+	EXPECT_DOUBLE_EQ(
+	    accumulator.get_accuracy(false),
+	    evaluation->evaluate(predicted, ground_truth));
+}
+
+TEST(ConfusionMatrixAccumulator, rejects_are_excluded)
+{
+	SGVector<float64_t> pred_vec({0, 1, -2, 1});
+	SGVector<float64_t> truth_vec({0, 1, 0, 0});
+
+	auto predicted = std::make_shared<MulticlassLabels>(pred_vec);
+	auto ground_truth = std::make_shared<MulticlassLabels>(truth_vec);
+
+	ConfusionMatrixAccumulator accumulator(predicted, ground_truth);
+
+	EXPECT_EQ(1, accumulator.get_num_rejects());
+	EXPECT_DOUBLE_EQ(2.0 / 4.0, accumulator.get_accuracy(true));
+	EXPECT_DOUBLE_EQ(2.0 / 3.0, accumulator.get_accuracy(false));
+
+	auto evaluation = std::make_shared<MulticlassAccuracy>(false);
+	EXPECT_DOUBLE_EQ(2.0 / 3.0, evaluation->evaluate(predicted, ground_truth));
+	EXPECT_EQ(1, evaluation->get_rejects_num());
+}
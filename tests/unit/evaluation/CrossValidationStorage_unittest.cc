@@ -0,0 +1,97 @@
+#include <shogun/evaluation/CrossValidationStorage.h>
+#include <shogun/labels/BinaryLabels.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+namespace
+{
+	std::shared_ptr<CrossValidationFoldStorage> make_fold(
+	    index_t run, index_t fold, float64_t result)
+	{
+		auto storage = std::make_shared<CrossValidationFoldStorage>();
+		storage->put(CrossValidationFoldStorage::kCurrentRunIndex, run);
+		storage->put(CrossValidationFoldStorage::kCurrentFoldIndex, fold);
+		storage->put(CrossValidationFoldStorage::kEvalulationResult, result);
+
+		// one TP, one FP, one TN, one FN per fold
+		SGVector<float64_t> truth({1.0, 1.0, -1.0, -1.0});
+		SGVector<float64_t> predicted({1.0, -1.0, 1.0, -1.0});
+		storage->put(
+		    CrossValidationFoldStorage::kTestTrueResult,
+		    std::shared_ptr<Labels>(std::make_shared<BinaryLabels>(truth)));
+		storage->put(
+		    CrossValidationFoldStorage::kTestResult,
+		    std::shared_ptr<Labels>(
+		        std::make_shared<BinaryLabels>(predicted)));
+
+		SGVector<index_t> train_indices({0, 1});
+		SGVector<index_t> test_indices({2, 3});
+		storage->put(
+		    CrossValidationFoldStorage::kTrainIndices, train_indices);
+		storage->put(CrossValidationFoldStorage::kTestIndices, test_indices);
+		return storage;
+	}
+}
+
+TEST(CrossValidationStorage, streaming_aggregates_and_discards)
+{
+	auto storage = std::make_shared<CrossValidationStorage>();
+	storage->set_streaming_mode(true);
+
+	storage->append_fold_result(make_fold(0, 0, 0.5));
+	storage->append_fold_result(make_fold(0, 1, 0.7));
+	storage->append_fold_result(make_fold(0, 2, 0.9));
+
+	EXPECT_EQ(0, storage->get_num_retained_folds());
+	EXPECT_DOUBLE_EQ(0.7, storage->get_aggregated_mean());
+	EXPECT_DOUBLE_EQ(0.04, storage->get_aggregated_variance());
+
+	SGVector<int64_t> confusion = storage->get_confusion_counts();
+	ASSERT_EQ(4, confusion.vlen);
+	for (index_t i = 0; i < 4; i++)
+		EXPECT_EQ(3, confusion[i]);
+}
+
+TEST(CrossValidationStorage, streaming_opt_in_retention)
+{
+	auto storage = std::make_shared<CrossValidationStorage>();
+	storage->set_streaming_mode(true);
+	storage->set_retained_artifacts(false, false, true);
+
+	storage->append_fold_result(make_fold(0, 0, 0.5));
+	storage->append_fold_result(make_fold(0, 1, 0.7));
+
+	ASSERT_EQ(2, storage->get_num_retained_folds());
+	auto fold = storage->get<CrossValidationFoldStorage>("folds", 1);
+	EXPECT_EQ(
+	    1, fold->get<index_t>(CrossValidationFoldStorage::kCurrentFoldIndex));
+	EXPECT_DOUBLE_EQ(
+	    0.7,
+	    fold->get<float64_t>(
+	        CrossValidationFoldStorage::kEvalulationResult));
+
+	SGVector<index_t> train_indices = fold->get<SGVector<index_t>>(
+	    CrossValidationFoldStorage::kTrainIndices);
+	ASSERT_EQ(2, train_indices.vlen);
+	EXPECT_EQ(0, train_indices[0]);
+	EXPECT_EQ(1, train_indices[1]);
+
+	// labels were not requested, so they were dropped
+	EXPECT_EQ(
+	    nullptr, fold->get(CrossValidationFoldStorage::kTestResult, std::nothrow));
+}
+
+TEST(CrossValidationStorage, non_streaming_retains_everything)
+{
+	auto storage = std::make_shared<CrossValidationStorage>();
+
+	storage->append_fold_result(make_fold(0, 0, 0.5));
+	storage->append_fold_result(make_fold(0, 1, 0.7));
+
+	ASSERT_EQ(2, storage->get_num_retained_folds());
+	auto fold = storage->get<CrossValidationFoldStorage>("folds", 0);
+	EXPECT_NE(
+	    nullptr, fold->get(CrossValidationFoldStorage::kTestResult, std::nothrow));
+}
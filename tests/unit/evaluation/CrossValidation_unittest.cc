@@ -192,3 +192,83 @@ TYPED_TEST(CrossValidationTests, single_multi_same_result)
 
 	EXPECT_NEAR(single, multi, 1e-7);
 }
+
+TEST(CrossValidationPrecomputeKernel, same_result_as_recomputing)
+{
+	auto N = 50;
+	auto D = 5;
+
+	std::mt19937_64 prng(57);
+	NormalDistribution<float64_t> randn;
+
+	SGMatrix<float64_t> X(D, N);
+	for (auto i : range(D * N))
+		X.matrix[i] = randn(prng);
+	auto features = std::make_shared<DenseFeatures<float64_t>>(X);
+
+	SGVector<float64_t> y(N);
+	for (auto i : range(N))
+		y[i] = linalg::mean(X.get_column(i)) < 0 ? -1 : 1;
+	auto labels = std::make_shared<BinaryLabels>(y);
+
+	auto run = [&](bool precompute)
+	{
+		auto machine = std::make_shared<LibSVM>();
+		machine->set_kernel(std::make_shared<GaussianKernel>());
+		auto ss = std::make_shared<CrossValidationSplitting>(labels, 5);
+		auto cv = std::make_shared<CrossValidation>(machine, features,
+			labels, ss, std::make_shared<AccuracyMeasure>());
+		cv->set_precompute_kernel(precompute);
+		cv->put("seed", 1);
+		return cv->evaluate()->get<float64_t>("mean");
+	};
+
+	auto recomputed = run(false);
+	auto precomputed = run(true);
+
+	// float32 kernel storage costs a few digits of precision
+	EXPECT_NEAR(recomputed, precomputed, 1e-4);
+}
+
+TEST(MachineEvaluationAsync, future_matches_blocking_call)
+{
+	auto N = 50;
+	auto D = 5;
+
+	std::mt19937_64 prng(57);
+	NormalDistribution<float64_t> randn;
+
+	SGMatrix<float64_t> X(D, N);
+	for (auto i : range(D * N))
+		X.matrix[i] = randn(prng);
+	auto features = std::make_shared<DenseFeatures<float64_t>>(X);
+
+	SGVector<float64_t> y(N);
+	for (auto i : range(N))
+		y[i] = linalg::mean(X.get_column(i)) < 0 ? -1 : 1;
+	auto labels = std::make_shared<BinaryLabels>(y);
+
+	auto make_cv = [&]()
+	{
+		auto machine = std::make_shared<LibSVM>();
+		machine->set_kernel(std::make_shared<GaussianKernel>());
+		auto ss = std::make_shared<CrossValidationSplitting>(labels, 5);
+		auto cv = std::make_shared<CrossValidation>(machine, features,
+			labels, ss, std::make_shared<AccuracyMeasure>());
+		cv->put("seed", 1);
+		return cv;
+	};
+
+	auto blocking = make_cv()->evaluate()->get<float64_t>("mean");
+
+	// two candidates in flight at once, as a model selection driver would
+	auto cv_a = make_cv();
+	auto cv_b = make_cv();
+	auto future_a = cv_a->evaluate_async();
+	auto future_b = cv_b->evaluate_async();
+
+	EXPECT_DOUBLE_EQ(blocking, future_a.get()->get<float64_t>("mean"));
+	EXPECT_DOUBLE_EQ(blocking, future_b.get()->get<float64_t>("mean"));
+	EXPECT_FALSE(cv_a->is_evaluating());
+	EXPECT_FALSE(cv_b->is_evaluating());
+}
@@ -43,16 +43,16 @@ TEST(SigmoidCalibrationTest, binary_calibration)
 	auto calibrated_labels = sigmoid_calibration->calibrate_binary(predictions);
 	auto values = calibrated_labels->get_values();
 
-	EXPECT_EQ(values[0], 0.656628663983293337);
-	EXPECT_EQ(values[1], 0.159375349583615822);
-	EXPECT_EQ(values[2], 0.718534704684106407);
-	EXPECT_EQ(values[3], 0.819801347075004516);
-	EXPECT_EQ(values[4], 0.201976857736835741);
-	EXPECT_EQ(values[5], 0.124359200656053326);
-	EXPECT_EQ(values[6], 0.819801347075004516);
-	EXPECT_EQ(values[7], 0.656628663983293337);
-	EXPECT_EQ(values[8], 0.124359200656053326);
-	EXPECT_EQ(values[9], 0.718534704684106407);
+	EXPECT_NEAR(values[0], 0.656628663983293337, 1E-10);
+	EXPECT_NEAR(values[1], 0.159375349583615822, 1E-10);
+	EXPECT_NEAR(values[2], 0.718534704684106407, 1E-10);
+	EXPECT_NEAR(values[3], 0.819801347075004516, 1E-10);
+	EXPECT_NEAR(values[4], 0.201976857736835741, 1E-10);
+	EXPECT_NEAR(values[5], 0.124359200656053326, 1E-10);
+	EXPECT_NEAR(values[6], 0.819801347075004516, 1E-10);
+	EXPECT_NEAR(values[7], 0.656628663983293337, 1E-10);
+	EXPECT_NEAR(values[8], 0.124359200656053326, 1E-10);
+	EXPECT_NEAR(values[9], 0.718534704684106407, 1E-10);
 }
 
 TEST(SigmoidCalibrationTest, multiclass_calibration)
@@ -0,0 +1,66 @@
+#include <shogun/evaluation/PRCEvaluation.h>
+#include <shogun/evaluation/ROCEvaluation.h>
+#include <shogun/evaluation/ThresholdSweep.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/mathematics/NormalDistribution.h>
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(ThresholdSweep, matches_roc_and_prc_evaluations)
+{
+	const int32_t n = 100;
+	std::mt19937_64 prng(17);
+	NormalDistribution<float64_t> randn;
+
+	SGVector<float64_t> scores(n);
+	SGVector<float64_t> truth(n);
+	for (int32_t i = 0; i < n; i++)
+	{
+		truth[i] = i % 2 ? 1.0 : -1.0;
+		scores[i] = 0.5 * truth[i] + randn(prng);
+	}
+
+	auto pred = std::make_shared<BinaryLabels>(scores);
+	auto gt = std::make_shared<BinaryLabels>(truth);
+
+	auto roc = std::make_shared<ROCEvaluation>();
+	auto prc = std::make_shared<PRCEvaluation>();
+
+	ThresholdSweep sweep(scores, truth);
+	EXPECT_DOUBLE_EQ(roc->evaluate(pred, gt), sweep.get_auROC());
+	EXPECT_DOUBLE_EQ(prc->evaluate(pred, gt), sweep.get_auPRC());
+}
+
+TEST(ThresholdSweep, f1_sweep_and_batch)
+{
+	SGVector<float64_t> scores({0.9, 0.8, 0.7, 0.6, 0.5, 0.4});
+	SGVector<float64_t> truth({1.0, 1.0, -1.0, 1.0, -1.0, -1.0});
+
+	ThresholdSweep sweep(scores, truth);
+
+	SGVector<float64_t> thresholds = sweep.get_distinct_thresholds();
+	SGVector<float64_t> f1 = sweep.sweep(
+		[](int32_t tp, int32_t fp, int32_t pos, int32_t neg)
+		{
+			return 2.0 * tp / (2.0 * tp + fp + (pos - tp));
+		});
+
+	ASSERT_EQ(thresholds.vlen, f1.vlen);
+	ASSERT_EQ(6, f1.vlen);
+	// at threshold 0.6, tp=3, fp=1, fn=0
+	EXPECT_DOUBLE_EQ(0.6, thresholds[3]);
+	EXPECT_DOUBLE_EQ(6.0 / 7.0, f1[3]);
+
+	std::vector<SGVector<float64_t>> many_scores = {scores, scores};
+	std::vector<SGVector<float64_t>> many_truths = {truth, truth};
+	SGVector<float64_t> aucs =
+		ThresholdSweep::batch_auROC(many_scores, many_truths);
+	ASSERT_EQ(2, aucs.vlen);
+	EXPECT_DOUBLE_EQ(sweep.get_auROC(), aucs[0]);
+	EXPECT_DOUBLE_EQ(sweep.get_auROC(), aucs[1]);
+}
@@ -5,8 +5,11 @@
  */
 
 #include <shogun/features/Alphabet.h>
+#include <shogun/lib/SGVector.h>
 #include <gtest/gtest.h>
 
+#include <random>
+
 using namespace shogun;
 
 TEST(AlphabetTest, test_clone)
@@ -20,3 +23,72 @@ TEST(AlphabetTest, test_clone)
 
 
 }
+
+TEST(AlphabetTest, long_string_histogram_matches_bytewise)
+{
+    const char symbols[4] = {'A', 'C', 'G', 'T'};
+    const int64_t len = 5000; // long enough for the unrolled path
+
+    std::mt19937_64 prng(17);
+    SGVector<char> seq(len);
+    int64_t expected[4] = {0, 0, 0, 0};
+    for (int64_t i = 0; i < len; i++)
+    {
+        int64_t s = prng() % 4;
+        seq[i] = symbols[s];
+        expected[s]++;
+    }
+
+    auto alph = std::make_shared<Alphabet>(DNA);
+    alph->add_string_to_histogram(seq.vector, seq.vlen);
+
+    for (int64_t s = 0; s < 4; s++)
+        EXPECT_EQ(expected[s], alph->get_histogram()[(uint8_t)symbols[s]]);
+    EXPECT_TRUE(alph->check_alphabet(false));
+}
+
+TEST(AlphabetTest, bulk_remap_matches_scalar)
+{
+    const char symbols[4] = {'A', 'C', 'G', 'T'};
+    const int64_t len = 1000; // odd tail after the 16-byte blocks
+
+    std::mt19937_64 prng(17);
+    SGVector<uint8_t> seq(len);
+    for (int64_t i = 0; i < len; i++)
+        seq[i] = (uint8_t)symbols[prng() % 4];
+
+    auto alph = std::make_shared<Alphabet>(DNA);
+
+    SGVector<uint8_t> bulk(len);
+    alph->remap_to_bin(bulk.vector, seq.vector, len);
+    for (int64_t i = 0; i < len; i++)
+        EXPECT_EQ(alph->remap_to_bin(seq[i]), bulk[i]);
+
+    // non-byte destinations go through the generic element-wise path
+    SGVector<uint16_t> wide(len);
+    alph->remap_to_bin(wide.vector, seq.vector, len);
+    for (int64_t i = 0; i < len; i++)
+        EXPECT_EQ((uint16_t)alph->remap_to_bin(seq[i]), wide[i]);
+}
+
+TEST(AlphabetTest, bulk_remap_nibble_collisions)
+{
+    // 'A' (0x41) and 'Q' (0x51) share a low nibble but map to
+    // different bins, so the nibble table must stay disabled and the
+    // bulk remap must fall back to the scalar maptable
+    const char symbols[] = "ACDEFGHIKLMNPQRSTVWY";
+    const int64_t num_symbols = 20;
+    const int64_t len = 1000;
+
+    std::mt19937_64 prng(17);
+    SGVector<uint8_t> seq(len);
+    for (int64_t i = 0; i < len; i++)
+        seq[i] = (uint8_t)symbols[prng() % num_symbols];
+
+    auto alph = std::make_shared<Alphabet>(PROTEIN);
+
+    SGVector<uint8_t> bulk(len);
+    alph->remap_to_bin(bulk.vector, seq.vector, len);
+    for (int64_t i = 0; i < len; i++)
+        EXPECT_EQ(alph->remap_to_bin(seq[i]), bulk[i]);
+}
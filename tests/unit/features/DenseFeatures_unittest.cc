@@ -13,6 +13,8 @@
 #include <shogun/mathematics/RandomNamespace.h>
 #include <shogun/mathematics/UniformIntDistribution.h>
 #include <shogun/mathematics/NormalDistribution.h>
+
+#include <unistd.h>
 #include <shogun/lib/View.h>
 #include <shogun/util/zip_iterator.h>
 
@@ -332,4 +334,35 @@ TEST(DenseFeaturesTest, const_iterator)
         for (const auto& [test, truth]: zip_iterator(iter, tmp))
             EXPECT_EQ(test, truth);
     }
-}
\ No newline at end of file
+}
+TEST(DenseFeaturesTest, binary_file_backing)
+{
+	const char* fname="DenseFeaturesTest_binary_backing.bin";
+	index_t num_features=4;
+	index_t num_vectors=9;
+
+	SGMatrix<float64_t> data(num_features, num_vectors);
+	for (index_t i=0; i<num_features*num_vectors; i++)
+		data.matrix[i]=0.25*i;
+
+	auto features=std::make_shared<DenseFeatures<float64_t>>(data);
+	ASSERT_TRUE(features->save_feature_matrix_to_binary(fname));
+
+	/* mapping the file back must expose the identical matrix without a
+	 * parse or copy */
+	auto mapped=std::make_shared<DenseFeatures<float64_t>>();
+	ASSERT_TRUE(mapped->map_feature_matrix_from_binary(fname,
+			num_features, num_vectors));
+	EXPECT_EQ(num_vectors, mapped->get_num_vectors());
+	EXPECT_EQ(num_features, mapped->get_num_features());
+
+	for (index_t j=0; j<num_vectors; j++)
+	{
+		SGVector<float64_t> vec=mapped->get_feature_vector(j);
+		for (index_t i=0; i<num_features; i++)
+			EXPECT_EQ(data(i, j), vec[i]);
+	}
+
+	mapped->free_feature_matrix();
+	unlink(fname);
+}
@@ -5,6 +5,9 @@
  */
 #include <gtest/gtest.h>
 #include <shogun/features/RandomFourierDotFeatures.h>
+#include <shogun/mathematics/Math.h>
+
+#include <cmath>
 
 
 using namespace shogun;
@@ -197,3 +200,63 @@ TEST(RandomFourierDotFeatures, dim_output)
 }
 
 
+
+TEST(RandomFourierDotFeatures, fastfood_consistency)
+{
+	int32_t num_dims = 20;
+	int32_t num_vecs = 4;
+	int32_t num_dims_rff = 64;
+
+	SGMatrix<float64_t> data(num_dims, num_vecs);
+	for (index_t i=0; i<num_vecs; i++)
+	{
+		for (index_t j=0; j<num_dims; j++)
+			data(j,i) = 0.1*(i+j);
+	}
+
+	auto d_feats = std::make_shared<DenseFeatures<float64_t>>(data);
+	SGVector<float64_t> params(1);
+	params[0] = 8;
+	auto r_feats = std::make_shared<RandomFourierDotFeatures>(
+			d_feats, num_dims_rff, GAUSSIAN, params, true);
+
+	/* materialize the transformed vectors through add_to_dense_vec */
+	SGMatrix<float64_t> z(num_dims_rff, num_vecs);
+	z.zero();
+	for (index_t i=0; i<num_vecs; i++)
+		r_feats->add_to_dense_vec(1.0, i, z.get_column_vector(i),
+				num_dims_rff, false);
+
+	/* every feature is constant * cos(.) and hence bounded */
+	float64_t bound = std::sqrt(2.0/num_dims_rff) + 1e-12;
+	for (index_t i=0; i<num_vecs; i++)
+	{
+		for (index_t k=0; k<num_dims_rff; k++)
+			EXPECT_LE(Math::abs(z(k,i)), bound);
+	}
+
+	/* pairwise dots must agree with the materialized vectors */
+	for (index_t i=0; i<num_vecs; i++)
+	{
+		for (index_t j=0; j<num_vecs; j++)
+		{
+			float64_t expected = 0;
+			for (index_t k=0; k<num_dims_rff; k++)
+				expected += z(k,i)*z(k,j);
+			EXPECT_NEAR(r_feats->dot(i, r_feats, j), expected, 1e-10);
+		}
+	}
+
+	/* dense dots must agree as well */
+	SGVector<float64_t> w(num_dims_rff);
+	for (index_t k=0; k<num_dims_rff; k++)
+		w[k] = 0.01*k;
+
+	for (index_t i=0; i<num_vecs; i++)
+	{
+		float64_t expected = 0;
+		for (index_t k=0; k<num_dims_rff; k++)
+			expected += z(k,i)*w[k];
+		EXPECT_NEAR(r_feats->dot(i, w), expected, 1e-10);
+	}
+}
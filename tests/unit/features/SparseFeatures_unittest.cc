@@ -412,3 +412,42 @@ TEST(SparseFeaturesTest,subset_get_full_feature_vector_smaller)
 
 
 }
+
+TEST(SparseFeaturesTest,csr_layout_dot_products)
+{
+	SGMatrix<float64_t> data(4, 6);
+	for (index_t i=0; i<4*6; ++i)
+		data.matrix[i]=(i%3==0) ? 0.0 : 0.5*i;
+
+	auto features=std::make_shared<SparseFeatures<float64_t>>(data);
+
+	SGVector<float64_t> dense(4);
+	for (index_t i=0; i<4; ++i)
+		dense[i]=0.25*(i+1);
+
+	/* reference results from the per-vector layout */
+	SGVector<float64_t> ref_dot(6);
+	SGVector<float64_t> ref_add(4);
+	ref_add.zero();
+	for (index_t i=0; i<6; ++i)
+	{
+		ref_dot[i]=features->dot(i, dense);
+		features->add_to_dense_vec(2.0, i, ref_add.vector, 4, false);
+	}
+
+	features->convert_to_csr();
+	ASSERT_TRUE(features->has_csr_layout());
+
+	SGVector<float64_t> csr_add(4);
+	csr_add.zero();
+	for (index_t i=0; i<6; ++i)
+	{
+		EXPECT_NEAR(features->dot(i, dense), ref_dot[i], 1e-14);
+		EXPECT_NEAR(features->dense_dot(1.0, i, dense.vector, 4, 0.0),
+				ref_dot[i], 1e-14);
+		features->add_to_dense_vec(2.0, i, csr_add.vector, 4, false);
+	}
+
+	for (index_t j=0; j<4; ++j)
+		EXPECT_NEAR(csr_add[j], ref_add[j], 1e-14);
+}
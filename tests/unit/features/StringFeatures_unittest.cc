@@ -91,3 +91,33 @@ TEST(StringFeaturesTest,equals)
 
 
 }
+
+TEST(StringFeaturesTest,pack_into_arena)
+{
+	std::mt19937_64 prng(25);
+	std::vector<SGVector<char>> strings = generateRandomStringData(prng);
+
+	auto f=std::make_shared<StringFeatures<char>>(strings, ALPHANUM);
+	EXPECT_FALSE(f->has_arena_storage());
+
+	f->pack_into_arena();
+	ASSERT_TRUE(f->has_arena_storage());
+
+	/* packed strings must be bitwise identical and laid out contiguously */
+	const char* prev_end=NULL;
+	for (index_t i=0; i<f->get_num_vectors(); ++i)
+	{
+		SGVector<char> vec=f->get_feature_vector(i);
+		ASSERT_EQ(vec.vlen, strings[i].vlen);
+		for (index_t j=0; j<vec.vlen; ++j)
+			EXPECT_EQ(vec.vector[j], strings[i].vector[j]);
+
+		if (prev_end)
+			EXPECT_EQ(vec.vector, prev_end);
+		prev_end=vec.vector+vec.vlen;
+	}
+
+	/* replacing the strings drops the arena */
+	f->set_features(strings);
+	EXPECT_FALSE(f->has_arena_storage());
+}
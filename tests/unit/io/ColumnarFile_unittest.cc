@@ -0,0 +1,120 @@
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/io/ColumnarFile.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGSparseVector.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+
+#include <cstdio>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(ColumnarFileTest, dense_labels_roundtrip)
+{
+	int32_t seed = 100;
+	int32_t num_feat = 16;
+	int32_t num_vec = 32;
+
+	std::mt19937_64 prng(seed);
+	UniformRealDistribution<float64_t> uniform_real_dist(0., 1.);
+
+	SGMatrix<float64_t> mat(num_feat, num_vec);
+	for (int32_t i = 0; i < num_feat * num_vec; i++)
+		mat.matrix[i] = uniform_real_dist(prng);
+
+	SGVector<float64_t> lab(num_vec);
+	for (int32_t i = 0; i < num_vec; i++)
+		lab[i] = uniform_real_dist(prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(mat);
+	auto labels = std::make_shared<RegressionLabels>(lab);
+
+	auto fout = std::make_shared<ColumnarFile>(
+	    "ColumnarFileTest_dense_output.bin", 'w');
+	fout->write_dense("features", features);
+	fout->write_labels("labels", labels);
+	fout.reset();
+
+	auto fin = std::make_shared<ColumnarFile>(
+	    "ColumnarFileTest_dense_output.bin", 'r');
+	EXPECT_EQ(2, fin->get_num_sections());
+
+	auto features_from_file = fin->read_dense("features");
+	SGMatrix<float64_t> mat_from_file =
+	    features_from_file->get_feature_matrix();
+
+	EXPECT_EQ(num_feat, mat_from_file.num_rows);
+	EXPECT_EQ(num_vec, mat_from_file.num_cols);
+	for (int32_t i = 0; i < num_feat * num_vec; i++)
+		EXPECT_EQ(mat.matrix[i], mat_from_file.matrix[i]);
+
+	SGVector<float64_t> lab_from_file = fin->read_labels("labels");
+	EXPECT_EQ(num_vec, lab_from_file.vlen);
+	for (int32_t i = 0; i < num_vec; i++)
+		EXPECT_EQ(lab[i], lab_from_file[i]);
+
+	features_from_file.reset();
+	fin.reset();
+
+	unlink("ColumnarFileTest_dense_output.bin");
+}
+
+TEST(ColumnarFileTest, sparse_roundtrip)
+{
+	int32_t seed = 100;
+	int32_t max_num_entries = 64;
+	int32_t num_feat = 128;
+	int32_t num_vec = 32;
+
+	std::mt19937_64 prng(seed);
+	UniformIntDistribution<int32_t> uniform_int_dist;
+	UniformRealDistribution<float64_t> uniform_real_dist(0., 1.);
+
+	SGSparseMatrix<float64_t> sm(num_feat, num_vec);
+	for (int32_t i = 0; i < num_vec; i++)
+	{
+		sm.sparse_matrix[i] = SGSparseVector<float64_t>(
+		    uniform_int_dist(prng, {0, max_num_entries}));
+		for (int32_t j = 0; j < sm.sparse_matrix[i].num_feat_entries; j++)
+		{
+			sm.sparse_matrix[i].features[j].feat_index = j * 2;
+			sm.sparse_matrix[i].features[j].entry = uniform_real_dist(prng);
+		}
+	}
+
+	auto features = std::make_shared<SparseFeatures<float64_t>>(sm);
+
+	auto fout = std::make_shared<ColumnarFile>(
+	    "ColumnarFileTest_sparse_output.bin", 'w');
+	fout->write_sparse("features", features);
+	fout.reset();
+
+	auto fin = std::make_shared<ColumnarFile>(
+	    "ColumnarFileTest_sparse_output.bin", 'r');
+	auto features_from_file = fin->read_sparse("features");
+
+	EXPECT_EQ(num_feat, features_from_file->get_num_features());
+	EXPECT_EQ(num_vec, features_from_file->get_num_vectors());
+	for (int32_t i = 0; i < num_vec; i++)
+	{
+		SGSparseVector<float64_t> vec =
+		    features_from_file->get_sparse_feature_vector(i);
+		EXPECT_EQ(sm.sparse_matrix[i].num_feat_entries, vec.num_feat_entries);
+		for (int32_t j = 0; j < vec.num_feat_entries; j++)
+		{
+			EXPECT_EQ(sm.sparse_matrix[i].features[j].feat_index,
+			          vec.features[j].feat_index);
+			EXPECT_EQ(sm.sparse_matrix[i].features[j].entry,
+			          vec.features[j].entry);
+		}
+		features_from_file->free_sparse_feature_vector(i);
+	}
+
+	unlink("ColumnarFileTest_sparse_output.bin");
+}
@@ -9,6 +9,8 @@
 #include <shogun/lib/SGVector.h>
 
 #include <cstring>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using namespace shogun;
@@ -70,3 +72,36 @@ TEST(LineReaderTest, read_yourself)
 	fclose(fin);
 }
 
+
+TEST(LineReaderTest, read_lines_block)
+{
+	FILE* fin=fopen(__FILE__, "r");
+	FILE* fin_block=fopen(__FILE__, "r");
+
+	auto tokenizer=std::make_shared<DelimiterTokenizer>(true);
+	tokenizer->delimiters['\n']=1;
+
+	auto reader=std::make_shared<LineReader>(max_line_length, fin, tokenizer);
+	auto block_reader=std::make_shared<LineReader>(max_line_length, fin_block,
+		tokenizer);
+
+	SGVector<char> storage;
+	std::vector<SGVector<char>> lines=block_reader->read_lines(storage);
+	EXPECT_FALSE(block_reader->has_next());
+
+	// line-at-a-time reading must see exactly the same lines
+	size_t lines_count=0;
+	while (reader->has_next())
+	{
+		SGVector<char> line=reader->read_line();
+		ASSERT_LT(lines_count, lines.size());
+		ASSERT_EQ(line.vlen, lines[lines_count].vlen);
+		for (int i=0; i<line.vlen; i++)
+			EXPECT_EQ(line.vector[i], lines[lines_count].vector[i]);
+		lines_count++;
+	}
+	EXPECT_EQ(lines_count, lines.size());
+
+	fclose(fin);
+	fclose(fin_block);
+}
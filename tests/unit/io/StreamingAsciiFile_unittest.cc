@@ -0,0 +1,69 @@
+#include <shogun/io/streaming/StreamingAsciiFile.h>
+#include <shogun/lib/SGVector.h>
+
+#include <cstdio>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(StreamingAsciiFile, binary_cache_replay)
+{
+	const char* fname = "streaming_ascii_cache_test.txt";
+	const int32_t num_examples = 10;
+	const int32_t num_feat = 4;
+
+	FILE* fout = fopen(fname, "w");
+	ASSERT_TRUE(fout != NULL);
+	for (int32_t i = 0; i < num_examples; i++)
+	{
+		fprintf(fout, "%d", i % 2);
+		for (int32_t j = 0; j < num_feat; j++)
+			fprintf(fout, " %f", 0.25 * (i * num_feat + j));
+		fprintf(fout, "\n");
+	}
+	fclose(fout);
+
+	auto file = std::make_shared<StreamingAsciiFile>(fname, 'r');
+	file->set_binary_cache();
+	EXPECT_FALSE(file->is_seekable());
+
+	// first pass parses the ascii file and fills the spill cache
+	SGVector<float64_t> first_pass(num_examples * num_feat);
+	SGVector<float64_t> first_labels(num_examples);
+	float64_t* vector = NULL;
+	int32_t len = 0;
+	float64_t label = 0;
+	for (int32_t i = 0; i < num_examples; i++)
+	{
+		file->get_vector_and_label(vector, len, label);
+		ASSERT_EQ(num_feat, len);
+		first_labels[i] = label;
+		for (int32_t j = 0; j < len; j++)
+			first_pass[i * num_feat + j] = vector[j];
+	}
+	file->get_vector_and_label(vector, len, label);
+	EXPECT_EQ(-1, len);
+	EXPECT_TRUE(file->is_seekable());
+
+	// later passes must replay identical examples from the binary cache
+	for (int32_t pass = 0; pass < 2; pass++)
+	{
+		file->reset_stream();
+		for (int32_t i = 0; i < num_examples; i++)
+		{
+			file->get_vector_and_label(vector, len, label);
+			ASSERT_EQ(num_feat, len);
+			EXPECT_DOUBLE_EQ(first_labels[i], label);
+			for (int32_t j = 0; j < len; j++)
+				EXPECT_DOUBLE_EQ(first_pass[i * num_feat + j], vector[j]);
+		}
+		file->get_vector_and_label(vector, len, label);
+		EXPECT_EQ(-1, len);
+	}
+
+	SG_FREE(vector);
+	file.reset();
+	unlink(fname);
+}
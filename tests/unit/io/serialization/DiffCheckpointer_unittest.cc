@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/io/fs/FileSystem.h>
+#include <shogun/io/serialization/BitseryDeserializer.h>
+#include <shogun/io/serialization/BitserySerializer.h>
+#include <shogun/io/serialization/DiffCheckpointer.h>
+#include <shogun/kernel/GaussianKernel.h>
+
+#include <string>
+#include <vector>
+
+using namespace shogun;
+using namespace shogun::io;
+
+static bool ends_with(const std::string& s, const std::string& suffix)
+{
+	return s.size() >= suffix.size() &&
+		s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+TEST(DiffCheckpointer, keyframe_and_delta)
+{
+	auto kernel = std::make_shared<GaussianKernel>();
+	kernel->put("log_width", 1.0);
+
+	auto checkpointer = std::make_shared<DiffCheckpointer>(
+		std::make_shared<BitserySerializer>(), "diff_ckpt_test", 16);
+
+	std::vector<std::string> paths;
+
+	// first snapshot is always a full keyframe
+	paths.push_back(checkpointer->snapshot(kernel));
+	EXPECT_TRUE(ends_with(paths.back(), ".keyframe"));
+	EXPECT_EQ(1, checkpointer->get_num_snapshots());
+
+	auto restored = deserialize(
+		paths.back(), std::make_shared<BitseryDeserializer>());
+	EXPECT_TRUE(kernel->equals(restored));
+
+	// unchanged state yields an empty delta that applies as a no-op
+	paths.push_back(checkpointer->snapshot(kernel));
+	EXPECT_TRUE(ends_with(paths.back(), ".delta"));
+	checkpointer->apply_delta(restored, paths.back());
+	EXPECT_TRUE(kernel->equals(restored));
+
+	// a changed parameter lands in the next delta
+	kernel->put("log_width", 2.5);
+	paths.push_back(checkpointer->snapshot(kernel));
+	EXPECT_TRUE(ends_with(paths.back(), ".delta"));
+	EXPECT_FALSE(kernel->equals(restored));
+
+	checkpointer->apply_delta(restored, paths.back());
+	EXPECT_TRUE(kernel->equals(restored));
+
+	auto fs = env();
+	for (const auto& path : paths)
+		ASSERT_FALSE(fs->delete_file(path));
+}
@@ -145,3 +145,23 @@ TYPED_TEST(SerializationTest, serialize)
 
 	ASSERT_TRUE(obj->equals(deser_obj));
 }
+
+TEST(SerializationFastProfileTest, serialize)
+{
+	SGMatrix<float64_t> data {{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+	auto df = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto obj = std::make_shared<GaussianKernel>(df, df, 2.0);
+
+	auto serializer = std::make_shared<BitserySerializer>(true);
+	auto stream = std::make_shared<DummyOutputStream>();
+	serializer->attach(stream);
+	serializer->write(obj);
+
+	// the profile is detected from the stream head, no flag needed here
+	auto deserializer = std::make_shared<BitseryDeserializer>();
+	auto istream = std::make_shared<DummyInputStream>(stream->buffer());
+	deserializer->attach(istream);
+	auto deser_obj = deserializer->read_object();
+
+	ASSERT_TRUE(obj->equals(deser_obj));
+}
@@ -0,0 +1,96 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/base/ShogunEnv.h>
+#include <shogun/io/ShogunErrc.h>
+#include <shogun/io/fs/FileSystem.h>
+#include <shogun/io/stream/FileInputStream.h>
+#include <shogun/io/stream/FileOutputStream.h>
+#include <shogun/io/stream/PrefetchInputStream.h>
+
+using namespace std;
+using namespace shogun;
+
+static std::vector<int> kChunkSizes = {1, 2, 3, 4, 7, 8, 9, 65536};
+
+static error_condition write_to_file(io::FileSystemRegistry* fs,
+	const string& fname, const string& content)
+{
+	std::unique_ptr<io::WritableFile> file;
+	auto ec = fs->new_writable_file(fname, &file);
+	if (ec)
+		return ec;
+
+	ec = file->append(content);
+	if (!ec)
+		ec = file->close();
+	return ec;
+}
+
+TEST(PrefetchInputStream, read)
+{
+	auto fs = env();
+	string filename = "pis_test";
+	ASSERT_FALSE(write_to_file(fs, filename, "foobarbaz"));
+	std::unique_ptr<io::RandomAccessFile> file;
+	ASSERT_FALSE(fs->new_random_access_file(filename, &file));
+
+	for (auto chunk_size : kChunkSizes)
+	{
+		auto fis = std::make_unique<io::FileInputStream>(file.get());
+		auto in = std::make_unique<io::PrefetchInputStream>(
+			fis.get(), chunk_size, 2);
+		string read;
+		EXPECT_EQ(0, in->tell());
+		ASSERT_FALSE(in->read(&read, 3));
+		EXPECT_EQ(read, "foo");
+		EXPECT_EQ(3, in->tell());
+		ASSERT_FALSE(in->read(&read, 0));
+		EXPECT_EQ(read, "");
+		ASSERT_FALSE(in->read(&read, 4));
+		EXPECT_EQ(read, "barb");
+		EXPECT_EQ(7, in->tell());
+		EXPECT_TRUE(io::is_out_of_range(in->read(&read, 5)));
+		EXPECT_EQ(read, "az");
+		EXPECT_EQ(9, in->tell());
+		EXPECT_TRUE(io::is_out_of_range(in->read(&read, 5)));
+		EXPECT_EQ(read, "");
+		EXPECT_EQ(9, in->tell());
+	}
+	ASSERT_FALSE(fs->delete_file(filename));
+}
+
+TEST(PrefetchInputStream, skip_and_reset)
+{
+	auto fs = env();
+	string filename = "pis_test_skip";
+	ASSERT_FALSE(write_to_file(fs, filename, "foobarbaz"));
+	std::unique_ptr<io::RandomAccessFile> file;
+	ASSERT_FALSE(fs->new_random_access_file(filename, &file));
+
+	for (auto chunk_size : kChunkSizes)
+	{
+		auto fis = std::make_unique<io::FileInputStream>(file.get());
+		auto in = std::make_unique<io::PrefetchInputStream>(
+			fis.get(), chunk_size, 2);
+		string read;
+		ASSERT_FALSE(in->skip(3));
+		EXPECT_EQ(3, in->tell());
+		ASSERT_FALSE(in->read(&read, 3));
+		EXPECT_EQ(read, "bar");
+		ASSERT_FALSE(in->skip(2));
+		EXPECT_EQ(8, in->tell());
+		ASSERT_FALSE(in->read(&read, 1));
+		EXPECT_EQ(read, "z");
+		EXPECT_TRUE(io::is_out_of_range(in->skip(5)));
+		EXPECT_EQ(9, in->tell());
+
+		in->reset();
+		EXPECT_EQ(0, in->tell());
+		ASSERT_FALSE(in->read(&read, 9));
+		EXPECT_EQ(read, "foobarbaz");
+	}
+	ASSERT_FALSE(fs->delete_file(filename));
+}
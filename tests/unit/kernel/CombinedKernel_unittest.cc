@@ -335,3 +335,28 @@ TEST(CombinedKernelTest,combination)
 		++j;
 	}
 }
+
+TEST(CombinedKernelTest,fused_block_computation)
+{
+	int32_t n=40, dim=3;
+	SGMatrix<float64_t> data(dim, n);
+	for (int32_t i=0; i<dim*n; i++)
+		data.matrix[i]=std::sin(0.1*i);
+	auto feats=std::make_shared<DenseFeatures<float64_t>>(data);
+
+	auto combined=std::make_shared<CombinedKernel>();
+	combined->append_kernel(std::make_shared<GaussianKernel>(10, 4));
+	combined->append_kernel(std::make_shared<GaussianKernel>(10, 8));
+	combined->init(feats, feats);
+	combined->get_kernel(0)->set_combined_kernel_weight(0.7);
+	combined->get_kernel(1)->set_combined_kernel_weight(0.3);
+
+	ASSERT_TRUE(combined->has_block_computation());
+
+	SGMatrix<float64_t> km=combined->get_kernel_matrix();
+	for (int32_t i=0; i<n; i++)
+	{
+		for (int32_t j=0; j<n; j++)
+			EXPECT_NEAR(combined->kernel(i, j), km(i, j), 1e-12);
+	}
+}
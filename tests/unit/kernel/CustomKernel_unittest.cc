@@ -16,6 +16,8 @@
 #include <shogun/mathematics/Math.h>
 #include <shogun/mathematics/RandomNamespace.h>
 
+#include <unistd.h>
+
 using namespace shogun;
 using namespace Eigen;
 
@@ -638,4 +640,36 @@ TEST(CustomKernelTest, row_col_wise_sum_block_no_diag)
 
 
 
+}
+
+TEST(CustomKernelTest,binary_file_backing)
+{
+	const char* fname="CustomKernelTest_binary_backing.bin";
+	const index_t n=15;
+
+	SGMatrix<float64_t> km(n, n);
+	for (index_t i=0; i<n; i++)
+	{
+		for (index_t j=0; j<n; j++)
+			km(i, j)=0.5*(i+1)+0.25*(j+1);
+	}
+
+	auto kernel=std::make_shared<CustomKernel>(km);
+	ASSERT_TRUE(kernel->save_kernel_matrix_to_binary(fname));
+
+	/* a fresh kernel backed by the memory-mapped file must reproduce the
+	 * matrix without owning a copy in RAM */
+	auto mapped=std::make_shared<CustomKernel>();
+	ASSERT_TRUE(mapped->map_kernel_matrix_from_binary(fname, n, n));
+	EXPECT_EQ(n, mapped->get_num_vec_lhs());
+	EXPECT_EQ(n, mapped->get_num_vec_rhs());
+
+	for (index_t i=0; i<n; i++)
+	{
+		for (index_t j=0; j<n; j++)
+			EXPECT_NEAR(kernel->kernel(i, j), mapped->kernel(i, j), 1e-6);
+	}
+
+	mapped->cleanup();
+	unlink(fname);
 }
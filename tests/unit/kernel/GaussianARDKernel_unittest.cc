@@ -729,3 +729,69 @@ TEST(GaussianARDKernel,get_parameter_gradient_diagonal)
 
 
 }
+
+TEST(GaussianARDKernel_vector,get_parameter_gradient_batch)
+{
+	index_t n=6;
+	index_t dim=2;
+	index_t m=3;
+	float64_t rel_tolerance=1e-10;
+	float64_t abs_tolerance;
+
+	SGMatrix<float64_t> feat_train(dim, n);
+	SGMatrix<float64_t> lat_feat_train(dim, m);
+
+	feat_train(0,0)=-0.81263;
+	feat_train(0,1)=-0.99976;
+	feat_train(0,2)=1.17037;
+	feat_train(0,3)=-1.51752;
+	feat_train(0,4)=8.57765;
+	feat_train(0,5)=3.89440;
+
+	feat_train(1,0)=-0.5;
+	feat_train(1,1)=5.4576;
+	feat_train(1,2)=7.17637;
+	feat_train(1,3)=-2.56752;
+	feat_train(1,4)=4.57765;
+	feat_train(1,5)=2.89440;
+
+	lat_feat_train(0,0)=1.00000;
+	lat_feat_train(0,1)=23.00000;
+	lat_feat_train(0,2)=4.00000;
+
+	lat_feat_train(1,0)=3.00000;
+	lat_feat_train(1,1)=2.00000;
+	lat_feat_train(1,2)=-5.00000;
+
+	auto features_train=std::make_shared<DenseFeatures<float64_t>>(feat_train);
+	auto latent_features_train=std::make_shared<DenseFeatures<float64_t>>(lat_feat_train);
+
+	auto kernel=std::make_shared<GaussianARDKernel>(10);
+	SGVector<float64_t> weights(dim);
+	weights[0]=0.2;
+	weights[1]=0.5;
+	kernel->set_vector_weights(weights);
+
+	kernel->init(features_train, latent_features_train);
+
+	auto params = kernel->get_params();
+	auto weight_param=params.find("log_weights");
+
+	/* the batched gradients must coincide with the per-element ones */
+	std::vector<SGMatrix<float64_t>> batch=
+		kernel->get_parameter_gradient_batch(*weight_param);
+	EXPECT_EQ(batch.size(), (size_t)dim);
+
+	for (index_t idx=0; idx<dim; idx++)
+	{
+		SGMatrix<float64_t> mat=kernel->get_parameter_gradient(*weight_param, idx);
+		for(int32_t i=0;i<mat.num_rows;i++)
+		{
+			for(int32_t j=0;j<mat.num_cols;j++)
+			{
+				abs_tolerance=Math::get_abs_tolerance(mat(i,j),rel_tolerance);
+				EXPECT_NEAR(batch[idx](i,j),mat(i,j),abs_tolerance);
+			}
+		}
+	}
+}
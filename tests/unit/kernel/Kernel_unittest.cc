@@ -370,3 +370,34 @@ TEST(Kernel, gaussian_get_kernel_matrix)
 
 
 }
+
+TEST(Kernel, gaussian_get_kernel_matrix_blocked_tiles)
+{
+	const int32_t seed = 101;
+	// more vectors than the tile size of the blocked path, so the
+	// matrix spans several tiles in both directions
+	const index_t num_feats_p=300;
+	const index_t num_feats_q=280;
+	const index_t dim=4;
+
+	std::mt19937_64 prng(seed);
+	SGMatrix<float64_t> data_p = generate_std_norm_matrix(num_feats_p, dim, prng);
+	SGMatrix<float64_t> data_q = generate_std_norm_matrix(num_feats_q, dim, prng);
+	auto feats_p=std::make_shared<DenseFeatures<float64_t>>(data_p);
+	auto feats_q=std::make_shared<DenseFeatures<float64_t>>(data_q);
+
+	auto kernel=std::make_shared<GaussianKernel>(feats_p, feats_q, 2);
+	ASSERT_TRUE(kernel->has_block_computation());
+
+	SGMatrix<float64_t> km=kernel->get_kernel_matrix();
+	for (index_t i=0; i<km.num_rows; i++)
+		for (index_t j=0; j<km.num_cols; ++j)
+			EXPECT_NEAR(kernel->kernel(i,j), km(i, j), 1E-12);
+
+	// symmetric case exercises the mirrored tiles
+	kernel->init(feats_p, feats_p);
+	SGMatrix<float64_t> km_sym=kernel->get_kernel_matrix();
+	for (index_t i=0; i<km_sym.num_rows; i++)
+		for (index_t j=0; j<km_sym.num_cols; ++j)
+			EXPECT_NEAR(kernel->kernel(i,j), km_sym(i, j), 1E-12);
+}
@@ -0,0 +1,111 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/NystromApproximation.h>
+#include <shogun/mathematics/NormalDistribution.h>
+
+#include <random>
+
+using namespace shogun;
+
+static std::shared_ptr<Kernel> create_symmetric_kernel(index_t n, index_t dim)
+{
+	std::mt19937_64 prng(23);
+	NormalDistribution<float64_t> normal;
+
+	SGMatrix<float64_t> data(dim, n);
+	for (index_t i = 0; i < dim * n; i++)
+		data.matrix[i] = normal(prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto kernel = std::make_shared<GaussianKernel>(2.0);
+	kernel->init(features, features);
+	return kernel;
+}
+
+TEST(NystromApproximation, exact_for_full_landmark_set)
+{
+	const index_t n = 30;
+	auto kernel = create_symmetric_kernel(n, 4);
+
+	/* with all points as landmarks the approximation is exact */
+	auto nystrom = kernel->get_nystrom_approximation(n);
+	nystrom->put("seed", int32_t(7));
+	SGMatrix<float64_t> factor = nystrom->get_factor();
+
+	ASSERT_EQ(n, factor.num_rows);
+	for (index_t i = 0; i < n; i++)
+	{
+		for (index_t j = 0; j < n; j++)
+		{
+			float64_t approx = 0;
+			for (index_t r = 0; r < factor.num_cols; r++)
+				approx += factor(i, r) * factor(j, r);
+			EXPECT_NEAR(kernel->kernel(i, j), approx, 1e-8);
+		}
+	}
+}
+
+TEST(NystromApproximation, landmark_subset_reasonable)
+{
+	const index_t n = 60;
+	auto kernel = create_symmetric_kernel(n, 2);
+
+	auto nystrom = kernel->get_nystrom_approximation(30);
+	nystrom->put("seed", int32_t(13));
+	SGMatrix<float64_t> factor = nystrom->get_factor();
+
+	ASSERT_EQ(n, factor.num_rows);
+	ASSERT_LE(factor.num_cols, 30);
+	ASSERT_EQ(30, nystrom->get_landmark_indices().vlen);
+
+	/* low-rank reconstruction error must be small relative to the
+	 * Frobenius norm of the exact matrix */
+	float64_t err = 0, norm = 0;
+	for (index_t i = 0; i < n; i++)
+	{
+		for (index_t j = 0; j < n; j++)
+		{
+			float64_t approx = 0;
+			for (index_t r = 0; r < factor.num_cols; r++)
+				approx += factor(i, r) * factor(j, r);
+			float64_t exact = kernel->kernel(i, j);
+			err += CMath::sq(exact - approx);
+			norm += CMath::sq(exact);
+		}
+	}
+	EXPECT_LT(std::sqrt(err / norm), 0.5);
+}
+
+TEST(NystromApproximation, apply_matches_factor)
+{
+	const index_t n = 25;
+	auto kernel = create_symmetric_kernel(n, 3);
+
+	auto nystrom = kernel->get_nystrom_approximation(n);
+	nystrom->put("seed", int32_t(3));
+	SGMatrix<float64_t> factor = nystrom->get_factor();
+
+	SGVector<float64_t> vec(n);
+	for (index_t i = 0; i < n; i++)
+		vec[i] = 1.0 / (i + 1);
+
+	SGVector<float64_t> product = nystrom->apply(vec);
+	for (index_t i = 0; i < n; i++)
+	{
+		float64_t expected = 0;
+		for (index_t j = 0; j < n; j++)
+		{
+			float64_t k_ij = 0;
+			for (index_t r = 0; r < factor.num_cols; r++)
+				k_ij += factor(i, r) * factor(j, r);
+			expected += k_ij * vec[j];
+		}
+		EXPECT_NEAR(expected, product[i], 1e-8);
+	}
+}
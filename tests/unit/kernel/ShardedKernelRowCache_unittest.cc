@@ -0,0 +1,145 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/kernel/ShardedKernelRowCache.h>
+#include <shogun/mathematics/UniformRealDistribution.h>
+
+#include <atomic>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace shogun;
+
+static std::shared_ptr<Kernel> create_kernel(index_t n, index_t dim)
+{
+	std::mt19937_64 prng(17);
+	UniformRealDistribution<float64_t> uniform(-1.0, 1.0);
+
+	SGMatrix<float64_t> data(dim, n);
+	for (index_t i = 0; i < dim * n; i++)
+		data.matrix[i] = uniform(prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto kernel = std::make_shared<GaussianKernel>(2.0);
+	kernel->init(features, features);
+	return kernel;
+}
+
+TEST(ShardedKernelRowCache, cached_rows_match_kernel)
+{
+	const index_t n = 20;
+	auto kernel = create_kernel(n, 3);
+	kernel->enable_concurrent_row_cache();
+
+	for (index_t i = 0; i < n; i++)
+	{
+		SGVector<KERNELCACHE_ELEM> row = kernel->get_row_concurrent(i);
+		ASSERT_EQ(n, row.vlen);
+		for (index_t j = 0; j < n; j++)
+			EXPECT_NEAR(kernel->kernel(i, j), row[j], 1e-12);
+	}
+}
+
+TEST(ShardedKernelRowCache, repeated_lookups_hit)
+{
+	const index_t n = 10;
+	auto kernel = create_kernel(n, 3);
+	auto cache =
+	    std::make_shared<ShardedKernelRowCache>(kernel.get(), 1 << 20, 4);
+
+	for (index_t repeat = 0; repeat < 3; repeat++)
+	{
+		for (index_t i = 0; i < n; i++)
+			cache->get_row(i);
+	}
+
+	EXPECT_EQ(n, cache->get_num_misses());
+	EXPECT_EQ(2 * n, cache->get_num_hits());
+}
+
+TEST(ShardedKernelRowCache, eviction_respects_budget)
+{
+	const index_t n = 64;
+	auto kernel = create_kernel(n, 2);
+
+	/* budget of roughly four rows in a single shard */
+	int64_t budget = 4 * n * sizeof(KERNELCACHE_ELEM);
+	auto cache =
+	    std::make_shared<ShardedKernelRowCache>(kernel.get(), budget, 1);
+
+	for (index_t i = 0; i < n; i++)
+		cache->get_row(i);
+
+	/* every row was evicted before being requested again */
+	for (index_t i = 0; i < n; i++)
+	{
+		SGVector<KERNELCACHE_ELEM> row = cache->get_row(i);
+		for (index_t j = 0; j < n; j++)
+			EXPECT_NEAR(kernel->kernel(i, j), row[j], 1e-12);
+	}
+}
+
+TEST(ShardedKernelRowCache, concurrent_lookups)
+{
+	const index_t n = 32;
+	auto kernel = create_kernel(n, 3);
+	kernel->enable_concurrent_row_cache(8);
+
+	SGMatrix<float64_t> reference = kernel->get_kernel_matrix();
+
+	const int32_t num_workers = 4;
+	std::vector<std::thread> workers;
+	std::atomic<int32_t> num_failures(0);
+
+	for (int32_t t = 0; t < num_workers; t++)
+	{
+		workers.emplace_back([&, t]() {
+			for (index_t pass = 0; pass < 5; pass++)
+			{
+				for (index_t i = t; i < n; i += num_workers)
+				{
+					SGVector<KERNELCACHE_ELEM> row =
+					    kernel->get_row_concurrent(i);
+					for (index_t j = 0; j < n; j++)
+					{
+						if (std::abs(reference(i, j) - row[j]) > 1e-12)
+							num_failures++;
+					}
+				}
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+		worker.join();
+
+	EXPECT_EQ(0, num_failures.load());
+}
+
+TEST(ShardedKernelRowCache, single_precision_storage)
+{
+	const index_t n = 16;
+	auto kernel = create_kernel(n, 3);
+	kernel->set_precision(KERNEL_PRECISION_SINGLE);
+	kernel->enable_concurrent_row_cache(2);
+
+	for (index_t i = 0; i < n; i++)
+	{
+		SGVector<KERNELCACHE_ELEM> first = kernel->get_row_concurrent(i);
+		SGVector<KERNELCACHE_ELEM> second = kernel->get_row_concurrent(i);
+		for (index_t j = 0; j < n; j++)
+		{
+			/* values are rounded to float32 but identical between the
+			 * miss and subsequent hits */
+			EXPECT_EQ(first[j], second[j]);
+			EXPECT_NEAR(kernel->kernel(i, j), first[j], 1e-6);
+		}
+	}
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <shogun/labels/BinaryLabels.h>
+#include <shogun/labels/MulticlassLabels.h>
+#include <shogun/lib/exception/ShogunException.h>
+
+using namespace shogun;
+
+TEST(DenseLabels, bitpacked_binary_roundtrip)
+{
+	// more than one 64-bit word plus a tail
+	const int32_t n = 130;
+
+	SGVector<float64_t> labels(n);
+	for (int32_t i = 0; i < n; i++)
+		labels[i] = (i % 3 == 0) ? 1.0 : -1.0;
+
+	auto binary = std::make_shared<BinaryLabels>(labels);
+	binary->compact_labels(LSM_BITPACK_BINARY);
+
+	EXPECT_EQ(LSM_BITPACK_BINARY, binary->get_storage_mode());
+	EXPECT_EQ(n, binary->get_num_labels());
+	EXPECT_TRUE(binary->is_valid());
+	for (int32_t i = 0; i < n; i++)
+		EXPECT_DOUBLE_EQ(labels[i], binary->get_label(i));
+
+	// setters keep working on packed storage
+	EXPECT_TRUE(binary->set_label(1, 1.0));
+	EXPECT_DOUBLE_EQ(1.0, binary->get_label(1));
+	EXPECT_TRUE(binary->set_label(1, -1.0));
+	EXPECT_THROW(binary->set_label(1, 0.5), ShogunException);
+
+	// bulk getters materialize float64 on the fly
+	SGVector<float64_t> materialized = binary->get_labels();
+	ASSERT_EQ(n, materialized.vlen);
+	for (int32_t i = 0; i < n; i++)
+		EXPECT_DOUBLE_EQ(labels[i], materialized[i]);
+
+	binary->compact_labels(LSM_FLOAT64);
+	EXPECT_EQ(LSM_FLOAT64, binary->get_storage_mode());
+	for (int32_t i = 0; i < n; i++)
+		EXPECT_DOUBLE_EQ(labels[i], binary->get_label(i));
+}
+
+TEST(DenseLabels, uint8_multiclass_roundtrip)
+{
+	const int32_t n = 50;
+	const int32_t num_classes = 7;
+
+	SGVector<float64_t> labels(n);
+	for (int32_t i = 0; i < n; i++)
+		labels[i] = i % num_classes;
+
+	auto multiclass = std::make_shared<MulticlassLabels>(labels);
+	multiclass->compact_labels(LSM_UINT8);
+
+	EXPECT_EQ(LSM_UINT8, multiclass->get_storage_mode());
+	EXPECT_EQ(n, multiclass->get_num_labels());
+	EXPECT_TRUE(multiclass->is_valid());
+	EXPECT_EQ(num_classes, multiclass->get_num_classes());
+	for (int32_t i = 0; i < n; i++)
+		EXPECT_EQ(i % num_classes, multiclass->get_int_label(i));
+
+	// values outside [0, 255] do not fit one byte
+	EXPECT_THROW(multiclass->set_label(0, 300), ShogunException);
+	EXPECT_THROW(multiclass->set_label(0, 2.5), ShogunException);
+
+	multiclass->compact_labels(LSM_UINT16);
+	EXPECT_TRUE(multiclass->set_label(0, 300));
+	EXPECT_EQ(300, multiclass->get_int_label(0));
+}
+
+TEST(DenseLabels, compact_storage_with_subset)
+{
+	const int32_t n = 20;
+
+	SGVector<float64_t> labels(n);
+	for (int32_t i = 0; i < n; i++)
+		labels[i] = (i % 2 == 0) ? 1.0 : -1.0;
+
+	auto binary = std::make_shared<BinaryLabels>(labels);
+	binary->compact_labels(LSM_BITPACK_BINARY);
+
+	SGVector<index_t> subset_idx(5);
+	for (index_t i = 0; i < 5; i++)
+		subset_idx[i] = 2 * i + 1;
+	binary->add_subset(subset_idx);
+
+	EXPECT_EQ(5, binary->get_num_labels());
+	for (index_t i = 0; i < 5; i++)
+		EXPECT_DOUBLE_EQ(labels[subset_idx[i]], binary->get_label(i));
+
+	SGVector<float64_t> copy = binary->get_labels();
+	ASSERT_EQ(5, copy.vlen);
+	for (index_t i = 0; i < 5; i++)
+		EXPECT_DOUBLE_EQ(labels[subset_idx[i]], copy[i]);
+
+	binary->remove_subset();
+	EXPECT_EQ(n, binary->get_num_labels());
+}
@@ -0,0 +1,68 @@
+#include <shogun/lib/AllocationTracker.h>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(AllocationTracker, charges_innermost_scope)
+{
+	AllocationTracker::reset();
+
+	int dummy_a, dummy_b;
+	AllocationTracker::record_alloc(&dummy_a, 100);
+	{
+		AllocationScope scope("outer");
+		AllocationTracker::record_copy();
+		{
+			AllocationScope inner("inner");
+			AllocationTracker::record_alloc(&dummy_b, 50);
+			AllocationTracker::record_shared_ref();
+		}
+	}
+
+	auto stats = AllocationTracker::snapshot();
+
+	ASSERT_EQ(1u, stats.count("untagged"));
+	EXPECT_EQ(1u, stats["untagged"].allocs);
+	EXPECT_EQ(100u, stats["untagged"].bytes_allocated);
+
+	ASSERT_EQ(1u, stats.count("outer"));
+	EXPECT_EQ(1u, stats["outer"].copies);
+	EXPECT_EQ(0u, stats["outer"].allocs);
+
+	ASSERT_EQ(1u, stats.count("inner"));
+	EXPECT_EQ(1u, stats["inner"].allocs);
+	EXPECT_EQ(50u, stats["inner"].bytes_allocated);
+	EXPECT_EQ(1u, stats["inner"].shared_refs);
+}
+
+TEST(AllocationTracker, frees_return_bytes_to_allocating_tag)
+{
+	AllocationTracker::reset();
+
+	int dummy_a, dummy_b;
+	{
+		AllocationScope scope("site");
+		AllocationTracker::record_alloc(&dummy_a, 100);
+		AllocationTracker::record_alloc(&dummy_b, 200);
+		AllocationTracker::record_free(&dummy_a);
+	}
+	// freed from a different (no) scope, still credited to "site"
+	AllocationTracker::record_free(&dummy_b);
+	// unknown pointers are ignored
+	AllocationTracker::record_free(nullptr);
+
+	auto stats = AllocationTracker::snapshot();
+	ASSERT_EQ(1u, stats.count("site"));
+	EXPECT_EQ(2u, stats["site"].allocs);
+	EXPECT_EQ(2u, stats["site"].frees);
+	EXPECT_EQ(300u, stats["site"].bytes_allocated);
+	EXPECT_EQ(0u, stats["site"].current_bytes);
+	EXPECT_EQ(300u, stats["site"].peak_bytes);
+
+	std::string report = AllocationTracker::report();
+	EXPECT_NE(std::string::npos, report.find("site"));
+
+	AllocationTracker::reset();
+	EXPECT_TRUE(AllocationTracker::snapshot().empty());
+}
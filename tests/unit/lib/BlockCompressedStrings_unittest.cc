@@ -0,0 +1,58 @@
+#include <shogun/lib/BlockCompressedStrings.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/UniformIntDistribution.h>
+
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(BlockCompressedStrings, roundtrip)
+{
+	int32_t seed = 17;
+	index_t num_strings = 100;
+	int32_t strings_per_block = 8;
+	int32_t num_cached_blocks = 2;
+
+	std::mt19937_64 prng(seed);
+	UniformIntDistribution<int32_t> uniform_int_dist;
+
+	std::vector<SGVector<char>> strings;
+	for (index_t i = 0; i < num_strings; i++)
+	{
+		SGVector<char> str(uniform_int_dist(prng, {0, 64}));
+		for (index_t j = 0; j < str.vlen; j++)
+			str[j] = 'A' + uniform_int_dist(prng, {0, 3});
+		strings.push_back(str);
+	}
+
+	auto storage = std::make_shared<BlockCompressedStrings<char>>(
+	    strings, UNCOMPRESSED, strings_per_block, num_cached_blocks);
+
+	EXPECT_EQ(num_strings, storage->get_num_strings());
+
+	// random access exercises block eviction with the small cache
+	for (index_t round = 0; round < 3; round++)
+	{
+		for (index_t i = num_strings - 1; i >= 0; i--)
+		{
+			SGVector<char> str = storage->get_string(i);
+			ASSERT_EQ(strings[i].vlen, str.vlen);
+			for (index_t j = 0; j < str.vlen; j++)
+				EXPECT_EQ(strings[i][j], str[j]);
+		}
+	}
+
+	std::vector<SGVector<char>> all = storage->get_strings();
+	ASSERT_EQ(strings.size(), all.size());
+	for (index_t i = 0; i < num_strings; i++)
+	{
+		ASSERT_EQ(strings[i].vlen, all[i].vlen);
+		for (index_t j = 0; j < all[i].vlen; j++)
+			EXPECT_EQ(strings[i][j], all[i][j]);
+	}
+
+	EXPECT_DOUBLE_EQ(1.0, storage->get_compression_ratio());
+}
@@ -151,6 +151,25 @@ TYPED_TEST(DynamicArrayFixture, append_array)
 	}
 }
 
+TYPED_TEST(DynamicArrayFixture, append_range)
+{
+	this->wrapper_array->reset_array();
+	EXPECT_EQ(this->wrapper_array->get_num_elements(), 0);
+
+	TypeParam range[3] = {(TypeParam)0, (TypeParam)1, (TypeParam)2};
+	this->wrapper_array->append_range(range, 3);
+	EXPECT_EQ(this->wrapper_array->get_num_elements(), 3);
+
+	std::vector<TypeParam> more = {(TypeParam)3, (TypeParam)4};
+	this->wrapper_array->append_range(more.begin(), more.end());
+	EXPECT_EQ(this->wrapper_array->get_num_elements(), 5);
+
+	for (int32_t i = 0; i < 5; i++)
+	{
+		EXPECT_EQ(this->wrapper_array->get_element(i), (TypeParam)i);
+	}
+}
+
 TYPED_TEST(DynamicArrayFixture, back_operation)
 {
 	EXPECT_EQ(this->wrapper_array->back(), (TypeParam)4);
@@ -0,0 +1,98 @@
+#include <shogun/lib/FlatMap.h>
+
+#include <shogun/mathematics/UniformIntDistribution.h>
+
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+using namespace shogun;
+
+TEST(FlatMap, add_contains_get)
+{
+	FlatMap<int32_t, float64_t> map;
+
+	EXPECT_EQ(0, map.get_num_elements());
+	EXPECT_TRUE(map.add(1, 1.5));
+	EXPECT_TRUE(map.add(2, 2.5));
+	// duplicate keys keep the first data, as in CMap
+	EXPECT_FALSE(map.add(1, 99.0));
+
+	EXPECT_EQ(2, map.get_num_elements());
+	EXPECT_TRUE(map.contains(1));
+	EXPECT_TRUE(map.contains(2));
+	EXPECT_FALSE(map.contains(3));
+	EXPECT_DOUBLE_EQ(1.5, map.get_element(1));
+	EXPECT_DOUBLE_EQ(2.5, map.get_element(2));
+
+	map.set(1, 99.0);
+	EXPECT_DOUBLE_EQ(99.0, map.get_element(1));
+
+	map[3] += 7.0;
+	EXPECT_DOUBLE_EQ(7.0, map.get_element(3));
+	EXPECT_EQ(3, map.get_num_elements());
+}
+
+TEST(FlatMap, remove_with_backward_shift)
+{
+	FlatMap<int32_t, int32_t> map;
+	for (int32_t i = 0; i < 100; i++)
+		map.add(i, i * i);
+
+	for (int32_t i = 0; i < 100; i += 2)
+		EXPECT_TRUE(map.remove(i));
+	EXPECT_FALSE(map.remove(0));
+
+	EXPECT_EQ(50, map.get_num_elements());
+	for (int32_t i = 0; i < 100; i++)
+	{
+		if (i % 2)
+		{
+			ASSERT_TRUE(map.contains(i));
+			EXPECT_EQ(i * i, map.get_element(i));
+		}
+		else
+			EXPECT_FALSE(map.contains(i));
+	}
+}
+
+TEST(FlatMap, matches_reference_under_growth)
+{
+	int32_t seed = 17;
+	std::mt19937_64 prng(seed);
+	UniformIntDistribution<int32_t> uniform_int_dist(0, 9999);
+
+	FlatMap<int32_t, int32_t> map(4);
+	std::map<int32_t, int32_t> reference;
+
+	for (int32_t i = 0; i < 5000; i++)
+	{
+		int32_t key = uniform_int_dist(prng);
+		map.set(key, i);
+		reference[key] = i;
+	}
+
+	EXPECT_EQ((int32_t)reference.size(), map.get_num_elements());
+	for (const auto& [key, value] : reference)
+	{
+		ASSERT_TRUE(map.contains(key));
+		EXPECT_EQ(value, map.get_element(key));
+	}
+
+	int32_t visited = 0;
+	map.for_each([&](const int32_t& key, int32_t& value) {
+		EXPECT_EQ(reference[key], value);
+		visited++;
+	});
+	EXPECT_EQ((int32_t)reference.size(), visited);
+}
+
+TEST(FlatMap, synchronized_mode)
+{
+	FlatMap<int32_t, int32_t> map(16, true);
+	for (int32_t i = 0; i < 100; i++)
+		map.add(i, i);
+	EXPECT_EQ(100, map.get_num_elements());
+	EXPECT_EQ(42, map.get_element(42));
+}
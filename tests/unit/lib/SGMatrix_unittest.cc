@@ -713,6 +713,27 @@ TEST(SGMatrixTest, get_column)
 		EXPECT_EQ(mat(i, col), vec[i]);
 }
 
+TEST(SGMatrixTest, view)
+{
+	const index_t n_rows = 6, n_cols = 8;
+
+	SGMatrix<float64_t> mat(n_rows, n_cols);
+	for (index_t i = 0; i < n_rows * n_cols; ++i)
+		mat[i] = i;
+
+	auto borrowed = mat.view();
+	EXPECT_EQ(mat.matrix, borrowed.matrix);
+	EXPECT_EQ(mat.num_rows, borrowed.num_rows);
+	EXPECT_EQ(mat.num_cols, borrowed.num_cols);
+	// views do not participate in reference counting
+	EXPECT_EQ(-1, borrowed.ref_count());
+	EXPECT_EQ(1, mat.ref_count());
+
+	// writes through the view alias the owner
+	borrowed(2, 3) = 42;
+	EXPECT_EQ(42, mat(2, 3));
+}
+
 TEST(SGMatrixTest, set_column)
 {
 	const int32_t seed = 100;
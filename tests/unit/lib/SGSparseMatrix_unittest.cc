@@ -345,3 +345,40 @@ TEST(SGSparseMatrix, pointer_equal)
 	SGSparseMatrix<float64_t> m3(2, 2);
 	EXPECT_FALSE(m1 == m3);
 }
+
+TEST(SGSparseMatrix, multiply_dense_matrix)
+{
+	const int32_t num_feat=6;
+	const int32_t num_vec=5;
+	const int32_t num_cols=4;
+
+	std::mt19937_64 prng(17);
+	UniformRealDistribution<float64_t> uniform_real_dist(-1.0, 1.0);
+
+	SGSparseMatrix<float64_t> m(num_feat, num_vec);
+	for (index_t i=0; i<num_vec; ++i)
+	{
+		m.sparse_matrix[i]=SGSparseVector<float64_t>(3);
+		for (index_t j=0; j<3; ++j)
+		{
+			m.sparse_matrix[i].features[j].feat_index=(i+j*2)%num_feat;
+			m.sparse_matrix[i].features[j].entry=uniform_real_dist(prng);
+		}
+	}
+
+	SGMatrix<float64_t> dense(num_feat, num_cols);
+	for (index_t i=0; i<dense.size(); ++i)
+		dense[i]=uniform_real_dist(prng);
+
+	SGMatrix<float64_t> result=m*dense;
+	ASSERT_EQ(result.num_rows, num_vec);
+	ASSERT_EQ(result.num_cols, num_cols);
+
+	for (index_t c=0; c<num_cols; ++c)
+	{
+		SGVector<float64_t> col(dense.get_column_vector(c), num_feat, false);
+		SGVector<float64_t> expected=m*col;
+		for (index_t i=0; i<num_vec; ++i)
+			EXPECT_NEAR(result(i, c), expected[i], 1E-15);
+	}
+}
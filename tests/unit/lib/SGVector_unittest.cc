@@ -489,3 +489,27 @@ TEST(SGVectorTest, slice)
 			EXPECT_EQ(vec[i], sliced_vec2[i - l - l2]);
 	}
 }
+
+TEST(SGVectorTest, view)
+{
+	index_t vlen = 10;
+	SGVector<float64_t> vec(vlen);
+	vec.range_fill();
+
+	auto borrowed = vec.view();
+	EXPECT_EQ(vec.vector, borrowed.vector);
+	EXPECT_EQ(vec.vlen, borrowed.vlen);
+	// views do not participate in reference counting
+	EXPECT_EQ(-1, borrowed.ref_count());
+	EXPECT_EQ(1, vec.ref_count());
+
+	// writes through the view alias the owner
+	borrowed[3] = 42;
+	EXPECT_EQ(42, vec[3]);
+
+	// copies of a view are views as well
+	SGVector<float64_t> copy(borrowed);
+	EXPECT_EQ(vec.vector, copy.vector);
+	EXPECT_EQ(-1, copy.ref_count());
+	EXPECT_EQ(1, vec.ref_count());
+}
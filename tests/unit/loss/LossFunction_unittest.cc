@@ -33,6 +33,8 @@
 #include <shogun/loss/AbsoluteDeviationLoss.h>
 #include <shogun/loss/SquaredLoss.h>
 #include <shogun/loss/HuberLoss.h>
+#include <shogun/loss/HingeLoss.h>
+#include <shogun/loss/LogLoss.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/mathematics/Math.h>
 #include <gtest/gtest.h>
@@ -217,3 +219,50 @@ TEST(LossFunction, huber_loss_test)
 
 
 }
+
+TEST(LossFunction, log_loss_batch_test)
+{
+	SGVector<float64_t> z(5);
+	z[0]=-25.0;
+	z[1]=-1.5;
+	z[2]=0.0;
+	z[3]=2.5;
+	z[4]=30.0;
+
+	auto lossf=std::make_shared<LogLoss>();
+
+	SGVector<float64_t> loss(5);
+	SGVector<float64_t> firstd(5);
+	lossf->loss(z,loss);
+	lossf->first_derivative(z,firstd);
+
+	float64_t epsilon=1e-14;
+	for (int32_t i=0;i<5;i++)
+	{
+		EXPECT_NEAR(loss[i],lossf->loss(z[i]),epsilon);
+		EXPECT_NEAR(firstd[i],lossf->first_derivative(z[i]),epsilon);
+	}
+}
+
+TEST(LossFunction, hinge_loss_batch_test)
+{
+	SGVector<float64_t> z(5);
+	z[0]=-2.0;
+	z[1]=-0.5;
+	z[2]=0.0;
+	z[3]=0.5;
+	z[4]=2.0;
+
+	auto lossf=std::make_shared<HingeLoss>();
+
+	SGVector<float64_t> loss(5);
+	SGVector<float64_t> firstd(5);
+	lossf->loss(z,loss);
+	lossf->first_derivative(z,firstd);
+
+	for (int32_t i=0;i<5;i++)
+	{
+		EXPECT_EQ(loss[i],lossf->loss(z[i]));
+		EXPECT_EQ(firstd[i],lossf->first_derivative(z[i]));
+	}
+}
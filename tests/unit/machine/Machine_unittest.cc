@@ -0,0 +1,64 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+
+#include <shogun/machine/Machine.h>
+
+using namespace shogun;
+
+namespace
+{
+class ChunkedApplyTestMachine : public Machine
+{
+public:
+	ChunkedApplyTestMachine(bool parallel) : Machine(), m_parallel(parallel)
+	{
+	}
+
+	float64_t apply_one(int32_t i) override
+	{
+		return 2.0 * i;
+	}
+
+	bool supports_parallel_apply() const override
+	{
+		return m_parallel;
+	}
+
+	SGVector<float64_t> outputs(int32_t num_vectors)
+	{
+		return apply_get_outputs_chunked(num_vectors);
+	}
+
+	const char* get_name() const override
+	{
+		return "ChunkedApplyTestMachine";
+	}
+
+private:
+	bool m_parallel;
+};
+} // namespace
+
+TEST(Machine, apply_get_outputs_chunked_serial)
+{
+	// spans several chunks so both chunked and serial paths are exercised
+	const int32_t num_vectors = 1000;
+	auto machine = std::make_shared<ChunkedApplyTestMachine>(false);
+	SGVector<float64_t> outputs = machine->outputs(num_vectors);
+	ASSERT_EQ(outputs.vlen, num_vectors);
+	for (int32_t i = 0; i < num_vectors; i++)
+		EXPECT_EQ(outputs[i], 2.0 * i);
+}
+
+TEST(Machine, apply_get_outputs_chunked_parallel)
+{
+	const int32_t num_vectors = 1000;
+	auto machine = std::make_shared<ChunkedApplyTestMachine>(true);
+	SGVector<float64_t> outputs = machine->outputs(num_vectors);
+	ASSERT_EQ(outputs.vlen, num_vectors);
+	for (int32_t i = 0; i < num_vectors; i++)
+		EXPECT_EQ(outputs[i], 2.0 * i);
+}
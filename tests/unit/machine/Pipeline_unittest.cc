@@ -93,3 +93,38 @@ TEST_F(PipelineTest, get)
 	EXPECT_EQ(pipeline->get_transformer(transformer_name), transformer2);
 	EXPECT_EQ(pipeline->get_machine(), machine);
 }
+
+TEST_F(PipelineTest, cached_train_skips_transformer_front)
+{
+	auto features = std::make_shared<NiceMock<MockFeatures>>();
+	auto transformed = std::make_shared<NiceMock<MockFeatures>>();
+
+	auto pipeline = std::make_shared<PipelineBuilder>()
+	                    ->over(transformer1)
+	                    ->then(machine);
+	pipeline->set_cache_enabled(true);
+
+	// second train() with identical input and stage parameters hits the
+	// cache, so the transformer front runs exactly once
+	EXPECT_CALL(*transformer1, fit(_)).Times(1);
+	EXPECT_CALL(*transformer1, transform(_, _))
+	    .Times(1)
+	    .WillOnce(Return(transformed));
+	EXPECT_CALL(*machine, train_machine(_)).Times(2);
+
+	pipeline->train(features);
+	pipeline->train(features);
+
+	Mock::VerifyAndClearExpectations(transformer1.get());
+	Mock::VerifyAndClearExpectations(machine.get());
+
+	// disabling the cache drops the entries and transforms again
+	pipeline->set_cache_enabled(false);
+	EXPECT_CALL(*transformer1, fit(_)).Times(1);
+	EXPECT_CALL(*transformer1, transform(_, _))
+	    .Times(1)
+	    .WillOnce(Return(transformed));
+	EXPECT_CALL(*machine, train_machine(_)).Times(1);
+
+	pipeline->train(features);
+}
@@ -0,0 +1,142 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+#include <gtest/gtest.h>
+#include <shogun/lib/config.h>
+
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/machine/gp/ConjugateGradientInferenceMethod.h>
+#include <shogun/machine/gp/ExactInferenceMethod.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/machine/gp/ZeroMean.h>
+#include <shogun/mathematics/Math.h>
+
+using namespace shogun;
+
+/** the deterministic quantities (CG solve for alpha, posterior mean and the
+ * lazily computed dense factor) must match ExactInferenceMethod up to the
+ * solver tolerance; the log-determinant and trace terms are randomized
+ * estimates and are not compared here
+ */
+TEST(ConjugateGradientInferenceMethod,matches_exact_inference)
+{
+	/* create some easy regression data: 1d noisy sine wave */
+	index_t n=5;
+
+	SGMatrix<float64_t> X(1, n);
+	SGVector<float64_t> Y(n);
+
+	X[0]=0.5;
+	X[1]=2.5;
+	X[2]=4.5;
+	X[3]=6.5;
+	X[4]=8.5;
+
+	for (index_t i=0; i<n; ++i)
+	{
+		Y[i] = std::sin(X(0, i));
+	}
+
+	/* shogun representation */
+	auto feat_train=std::make_shared<DenseFeatures<float64_t>>(X);
+	auto label_train=std::make_shared<RegressionLabels>(Y);
+
+	auto kernel=std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>();
+	lik->set_sigma(0.5);
+
+	auto inf=std::make_shared<ConjugateGradientInferenceMethod>(kernel,
+		feat_train, mean, label_train, lik);
+	inf->set_scale(1.5);
+
+	auto kernel_exact=std::make_shared<GaussianKernel>(10, 2.0);
+	auto inf_exact=std::make_shared<ExactInferenceMethod>(kernel_exact,
+		feat_train, mean, label_train, lik);
+	inf_exact->set_scale(1.5);
+
+	/* alpha is computed with conjugate gradients and must agree with the
+	 * direct solve up to the solver tolerance */
+	SGVector<float64_t> alpha=inf->get_alpha();
+	SGVector<float64_t> alpha_exact=inf_exact->get_alpha();
+
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(alpha[i], alpha_exact[i], 1e-4);
+
+	/* posterior mean of the latent function */
+	SGVector<float64_t> mu=inf->get_posterior_mean();
+	SGVector<float64_t> mu_exact=inf_exact->get_posterior_mean();
+
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(mu[i], mu_exact[i], 1e-4);
+
+	/* the lazily computed dense factor used by the prediction paths is the
+	 * same matrix as in exact inference */
+	SGMatrix<float64_t> L=inf->get_cholesky();
+	SGMatrix<float64_t> L_exact=inf_exact->get_cholesky();
+
+	for (index_t i=0; i<n*n; i++)
+		EXPECT_NEAR(L.matrix[i], L_exact.matrix[i], 1e-10);
+
+	/* posterior covariance goes through the lazy factor as well */
+	SGMatrix<float64_t> Sigma=inf->get_posterior_covariance();
+	SGMatrix<float64_t> Sigma_exact=inf_exact->get_posterior_covariance();
+
+	for (index_t i=0; i<n*n; i++)
+		EXPECT_NEAR(Sigma.matrix[i], Sigma_exact.matrix[i], 1e-4);
+}
+
+/** with single precision storage the solves run against a float32 copy of the
+ * system matrix; the float64 iterative refinement against the double precision
+ * kernel matrix must recover the accuracy of the double precision solve
+ */
+TEST(ConjugateGradientInferenceMethod,single_precision_storage)
+{
+	index_t n=5;
+
+	SGMatrix<float64_t> X(1, n);
+	SGVector<float64_t> Y(n);
+
+	X[0]=0.5;
+	X[1]=2.5;
+	X[2]=4.5;
+	X[3]=6.5;
+	X[4]=8.5;
+
+	for (index_t i=0; i<n; ++i)
+	{
+		Y[i] = std::sin(X(0, i));
+	}
+
+	auto feat_train=std::make_shared<DenseFeatures<float64_t>>(X);
+	auto label_train=std::make_shared<RegressionLabels>(Y);
+
+	auto kernel=std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>();
+	lik->set_sigma(0.5);
+
+	auto inf=std::make_shared<ConjugateGradientInferenceMethod>(kernel,
+		feat_train, mean, label_train, lik);
+	inf->set_scale(1.5);
+	inf->set_single_precision_storage(true);
+
+	auto kernel_exact=std::make_shared<GaussianKernel>(10, 2.0);
+	auto inf_exact=std::make_shared<ExactInferenceMethod>(kernel_exact,
+		feat_train, mean, label_train, lik);
+	inf_exact->set_scale(1.5);
+
+	SGVector<float64_t> alpha=inf->get_alpha();
+	SGVector<float64_t> alpha_exact=inf_exact->get_alpha();
+
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(alpha[i], alpha_exact[i], 1e-4);
+
+	SGVector<float64_t> mu=inf->get_posterior_mean();
+	SGVector<float64_t> mu_exact=inf_exact->get_posterior_mean();
+
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(mu[i], mu_exact[i], 1e-4);
+}
@@ -472,3 +472,140 @@ TEST(ExactInferenceMethod,get_posterior_mean2)
 	abs_tolerance = Math::get_abs_tolerance(-0.9860387397670280495987072, rel_tolerance);
 	EXPECT_NEAR(mu[4],  -0.9860387397670280495987072,  abs_tolerance);
 }
+
+TEST(ExactInferenceMethod,update_with_new_points)
+{
+	/* create some easy regression data: 1d noisy sine wave */
+	index_t n=4;
+	index_t n_new=2;
+
+	SGMatrix<float64_t> X(1, n);
+	SGMatrix<float64_t> X_new(1, n_new);
+	SGMatrix<float64_t> X_all(1, n+n_new);
+	SGVector<float64_t> Y(n);
+	SGVector<float64_t> Y_new(n_new);
+	SGVector<float64_t> Y_all(n+n_new);
+
+	X[0]=0;
+	X[1]=1.1;
+	X[2]=2.2;
+	X[3]=3.3;
+
+	X_new[0]=4.4;
+	X_new[1]=5.5;
+
+	for (index_t i=0; i<n; ++i)
+	{
+		Y[i] = std::sin(X[i]);
+		X_all[i]=X[i];
+		Y_all[i]=Y[i];
+	}
+
+	for (index_t i=0; i<n_new; ++i)
+	{
+		Y_new[i] = std::sin(X_new[i]);
+		X_all[n+i]=X_new[i];
+		Y_all[n+i]=Y_new[i];
+	}
+
+	auto feat_train=std::make_shared<DenseFeatures<float64_t>>(X);
+	auto label_train=std::make_shared<RegressionLabels>(Y);
+	auto feat_new=std::make_shared<DenseFeatures<float64_t>>(X_new);
+	auto label_new=std::make_shared<RegressionLabels>(Y_new);
+	auto feat_all=std::make_shared<DenseFeatures<float64_t>>(X_all);
+	auto label_all=std::make_shared<RegressionLabels>(Y_all);
+
+	auto kernel=std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>();
+	lik->set_sigma(0.5);
+
+	/* incrementally updated inference */
+	auto inf=std::make_shared<ExactInferenceMethod>(kernel, feat_train,
+			mean, label_train, lik);
+	inf->update();
+	inf->update_with_new_points(feat_new, label_new);
+
+	/* reference inference on the full data set */
+	auto kernel_ref=std::make_shared<GaussianKernel>(10, 2.0);
+	auto inf_ref=std::make_shared<ExactInferenceMethod>(kernel_ref, feat_all,
+			mean, label_all, lik);
+
+	SGMatrix<float64_t> L=inf->get_cholesky();
+	SGMatrix<float64_t> L_ref=inf_ref->get_cholesky();
+
+	for (index_t i=0; i<L.num_rows*L.num_cols; i++)
+		EXPECT_NEAR(L[i], L_ref[i], 1e-12);
+
+	SGVector<float64_t> alpha=inf->get_alpha();
+	SGVector<float64_t> alpha_ref=inf_ref->get_alpha();
+
+	for (index_t i=0; i<alpha.vlen; i++)
+		EXPECT_NEAR(alpha[i], alpha_ref[i], 1e-12);
+
+	EXPECT_NEAR(inf->get_negative_log_marginal_likelihood(),
+		inf_ref->get_negative_log_marginal_likelihood(), 1e-12);
+}
+
+TEST(ExactInferenceMethod,remove_oldest_points)
+{
+	/* create some easy regression data: 1d noisy sine wave */
+	index_t n=5;
+	index_t n_removed=2;
+
+	SGMatrix<float64_t> X(1, n);
+	SGMatrix<float64_t> X_rest(1, n-n_removed);
+	SGVector<float64_t> Y(n);
+	SGVector<float64_t> Y_rest(n-n_removed);
+
+	X[0]=0;
+	X[1]=1.1;
+	X[2]=2.2;
+	X[3]=3.3;
+	X[4]=4.4;
+
+	for (index_t i=0; i<n; ++i)
+		Y[i] = std::sin(X[i]);
+
+	for (index_t i=0; i<n-n_removed; ++i)
+	{
+		X_rest[i]=X[n_removed+i];
+		Y_rest[i]=Y[n_removed+i];
+	}
+
+	auto feat_train=std::make_shared<DenseFeatures<float64_t>>(X);
+	auto label_train=std::make_shared<RegressionLabels>(Y);
+	auto feat_rest=std::make_shared<DenseFeatures<float64_t>>(X_rest);
+	auto label_rest=std::make_shared<RegressionLabels>(Y_rest);
+
+	auto kernel=std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>();
+	lik->set_sigma(0.5);
+
+	/* incrementally downdated inference */
+	auto inf=std::make_shared<ExactInferenceMethod>(kernel, feat_train,
+			mean, label_train, lik);
+	inf->update();
+	inf->remove_oldest_points(n_removed);
+
+	/* reference inference on the remaining points */
+	auto kernel_ref=std::make_shared<GaussianKernel>(10, 2.0);
+	auto inf_ref=std::make_shared<ExactInferenceMethod>(kernel_ref, feat_rest,
+			mean, label_rest, lik);
+
+	SGMatrix<float64_t> L=inf->get_cholesky();
+	SGMatrix<float64_t> L_ref=inf_ref->get_cholesky();
+
+	for (index_t i=0; i<L.num_rows*L.num_cols; i++)
+		EXPECT_NEAR(L[i], L_ref[i], 1e-12);
+
+	SGVector<float64_t> alpha=inf->get_alpha();
+	SGVector<float64_t> alpha_ref=inf_ref->get_alpha();
+
+	for (index_t i=0; i<alpha.vlen; i++)
+		EXPECT_NEAR(alpha[i], alpha_ref[i], 1e-12);
+
+	EXPECT_NEAR(inf->get_negative_log_marginal_likelihood(),
+		inf_ref->get_negative_log_marginal_likelihood(), 1e-12);
+}
@@ -0,0 +1,155 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/lib/config.h>
+#include <shogun/labels/RegressionLabels.h>
+#include <shogun/features/DenseFeatures.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/machine/gp/SVGPInferenceMethod.h>
+#include <shogun/machine/gp/ExactInferenceMethod.h>
+#include <shogun/machine/gp/ZeroMean.h>
+#include <shogun/machine/gp/GaussianLikelihood.h>
+#include <shogun/optimization/SGDMinimizer.h>
+#include <shogun/optimization/GradientDescendUpdater.h>
+#include <shogun/optimization/ConstLearningRate.h>
+
+using namespace shogun;
+
+TEST(SVGPInferenceMethod,converges_to_exact_posterior)
+{
+	// with the inducing points placed on the training points and a Gaussian
+	// likelihood, the optimum of the evidence lower bound is the exact
+	// posterior, so a converged SVGP must reproduce exact inference
+	index_t n=5;
+
+	SGMatrix<float64_t> feat_train(1, n);
+	SGVector<float64_t> lab_train(n);
+
+	feat_train[0]=0.5;
+	feat_train[1]=2.5;
+	feat_train[2]=4.5;
+	feat_train[3]=6.5;
+	feat_train[4]=8.5;
+
+	lab_train[0]=0.47943;
+	lab_train[1]=0.59847;
+	lab_train[2]=-0.97753;
+	lab_train[3]=0.21512;
+	lab_train[4]=0.79849;
+
+	auto features_train=std::make_shared<DenseFeatures<float64_t>>(feat_train);
+	auto inducing_features_train=std::make_shared<DenseFeatures<float64_t>>(feat_train);
+	auto labels_train=std::make_shared<RegressionLabels>(lab_train);
+
+	auto kernel=std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>(0.5);
+
+	auto inf=std::make_shared<SVGPInferenceMethod>(kernel, features_train,
+		mean, labels_train, lik, inducing_features_train);
+	inf->set_inducing_noise(1e-6);
+	inf->set_scale(1.5);
+
+	// full-batch gradient descent so the optimization is deterministic and
+	// converges to the optimum of the bound
+	inf->set_minibatch_size(n);
+	auto minimizer=std::make_shared<SGDMinimizer>();
+	minimizer->set_gradient_updater(std::make_shared<GradientDescendUpdater>());
+	auto rate=std::make_shared<ConstLearningRate>();
+	rate->set_const_learning_rate(1e-2);
+	minimizer->set_learning_rate(rate);
+	minimizer->set_number_passes(20000);
+	inf->register_minimizer(minimizer);
+
+	auto kernel_exact=std::make_shared<GaussianKernel>(10, 2.0);
+	auto inf_exact=std::make_shared<ExactInferenceMethod>(kernel_exact,
+		features_train, mean, labels_train, lik);
+	inf_exact->set_scale(1.5);
+
+	// the negative lower bound upper bounds the exact negative log marginal
+	// likelihood and becomes tight at the optimum
+	float64_t nlZ=inf->get_negative_log_marginal_likelihood();
+	float64_t nlZ_exact=inf_exact->get_negative_log_marginal_likelihood();
+	EXPECT_GE(nlZ, nlZ_exact-1e-6);
+	EXPECT_NEAR(nlZ, nlZ_exact, 1e-2);
+
+	// q(u) must match the exact posterior over the latent function values
+	SGVector<float64_t> mu=inf->get_posterior_mean();
+	SGVector<float64_t> mu_exact=inf_exact->get_posterior_mean();
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(mu[i], mu_exact[i], 1e-2);
+
+	SGMatrix<float64_t> Sigma=inf->get_posterior_covariance();
+	SGMatrix<float64_t> Sigma_exact=inf_exact->get_posterior_covariance();
+	for (index_t i=0; i<n; i++)
+	{
+		for (index_t j=0; j<n; j++)
+			EXPECT_NEAR(Sigma(i,j), Sigma_exact(i,j), 1e-2);
+	}
+}
+
+TEST(SVGPInferenceMethod,minibatch_gradients)
+{
+	// minibatch updates must optimize the same bound: with a small constant
+	// learning rate the stochastic solution has to approach the full-batch
+	// optimum of the bound
+	index_t n=6;
+
+	SGMatrix<float64_t> feat_train(1, n);
+	SGMatrix<float64_t> lat_feat_train(1, 3);
+	SGVector<float64_t> lab_train(n);
+
+	feat_train[0]=0.5;
+	feat_train[1]=2.5;
+	feat_train[2]=4.5;
+	feat_train[3]=6.5;
+	feat_train[4]=8.5;
+	feat_train[5]=10.5;
+
+	lat_feat_train[0]=1.00000;
+	lat_feat_train[1]=5.00000;
+	lat_feat_train[2]=9.00000;
+
+	lab_train[0]=0.47943;
+	lab_train[1]=0.59847;
+	lab_train[2]=-0.97753;
+	lab_train[3]=0.21512;
+	lab_train[4]=0.79849;
+	lab_train[5]=-0.87970;
+
+	auto features_train=std::make_shared<DenseFeatures<float64_t>>(feat_train);
+	auto inducing_features_train=std::make_shared<DenseFeatures<float64_t>>(lat_feat_train);
+	auto labels_train=std::make_shared<RegressionLabels>(lab_train);
+
+	auto mean=std::make_shared<ZeroMean>();
+	auto lik=std::make_shared<GaussianLikelihood>(0.5);
+
+	auto inf_batch=std::make_shared<SVGPInferenceMethod>(
+		std::make_shared<GaussianKernel>(10, 2.0), features_train, mean,
+		labels_train, lik, inducing_features_train);
+	inf_batch->set_inducing_noise(1e-6);
+	inf_batch->set_minibatch_size(n);
+
+	auto inf_stochastic=std::make_shared<SVGPInferenceMethod>(
+		std::make_shared<GaussianKernel>(10, 2.0), features_train, mean,
+		labels_train, lik, inducing_features_train);
+	inf_stochastic->set_inducing_noise(1e-6);
+	inf_stochastic->set_minibatch_size(2);
+
+	for (auto& inf : {inf_batch, inf_stochastic})
+	{
+		auto minimizer=std::make_shared<SGDMinimizer>();
+		minimizer->set_gradient_updater(std::make_shared<GradientDescendUpdater>());
+		auto rate=std::make_shared<ConstLearningRate>();
+		rate->set_const_learning_rate(1e-3);
+		minimizer->set_learning_rate(rate);
+		minimizer->set_number_passes(20000);
+		inf->register_minimizer(minimizer);
+	}
+
+	float64_t nlZ_batch=inf_batch->get_negative_log_marginal_likelihood();
+	float64_t nlZ_stochastic=inf_stochastic->get_negative_log_marginal_likelihood();
+	EXPECT_NEAR(nlZ_stochastic, nlZ_batch, 1e-2);
+}
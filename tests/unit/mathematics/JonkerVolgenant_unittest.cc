@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/JonkerVolgenant.h>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace shogun;
+
+static float64_t brute_force_assignment(const SGMatrix<float64_t>& cost)
+{
+	int32_t dim=cost.num_rows;
+	SGVector<int32_t> perm(dim);
+	std::iota(perm.vector, perm.vector+dim, 0);
+
+	float64_t best=0;
+	for (int32_t i=0; i<dim; i++)
+		best+=cost(i, perm[i]);
+
+	while (std::next_permutation(perm.vector, perm.vector+dim))
+	{
+		float64_t total=0;
+		for (int32_t i=0; i<dim; i++)
+			total+=cost(i, perm[i]);
+		if (total<best)
+			best=total;
+	}
+
+	return best;
+}
+
+TEST(JonkerVolgenant, known_assignment)
+{
+	SGMatrix<float64_t> cost(3, 3);
+	cost(0,0)=1; cost(0,1)=2; cost(0,2)=3;
+	cost(1,0)=2; cost(1,1)=4; cost(1,2)=6;
+	cost(2,0)=3; cost(2,1)=6; cost(2,2)=9;
+
+	JonkerVolgenant solver(cost);
+	SGVector<int32_t> row_to_col;
+	SGVector<int32_t> col_to_row;
+	float64_t total=solver.solve(row_to_col, col_to_row);
+
+	/* reversing the diagonal is optimal: 3+4+3 */
+	EXPECT_EQ(10, total);
+	EXPECT_EQ(2, row_to_col[0]);
+	EXPECT_EQ(1, row_to_col[1]);
+	EXPECT_EQ(0, row_to_col[2]);
+	for (int32_t i=0; i<3; i++)
+		EXPECT_EQ(i, col_to_row[row_to_col[i]]);
+}
+
+TEST(JonkerVolgenant, matches_brute_force)
+{
+	/* deterministic pseudo-random costs, exhaustively checked */
+	uint32_t state=12345;
+	for (int32_t trial=0; trial<20; trial++)
+	{
+		int32_t dim=2+trial%6;
+		SGMatrix<float64_t> cost(dim, dim);
+		for (int32_t i=0; i<dim*dim; i++)
+		{
+			state=state*1103515245+12345;
+			cost.matrix[i]=(state>>16)%100;
+		}
+
+		JonkerVolgenant solver(cost);
+		SGVector<int32_t> row_to_col;
+		SGVector<int32_t> col_to_row;
+		float64_t total=solver.solve(row_to_col, col_to_row);
+
+		/* the assignment is a permutation consistent in both directions */
+		SGVector<int32_t> seen(dim);
+		seen.zero();
+		for (int32_t i=0; i<dim; i++)
+		{
+			EXPECT_EQ(i, col_to_row[row_to_col[i]]);
+			seen[row_to_col[i]]++;
+		}
+		for (int32_t j=0; j<dim; j++)
+			EXPECT_EQ(1, seen[j]);
+
+		EXPECT_EQ(brute_force_assignment(cost), total);
+	}
+}
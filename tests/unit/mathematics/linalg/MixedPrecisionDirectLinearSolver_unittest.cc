@@ -0,0 +1,41 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
+#include <shogun/mathematics/linalg/linsolver/MixedPrecisionDirectLinearSolver.h>
+
+using namespace shogun;
+using namespace Eigen;
+
+TEST(MixedPrecisionDirectLinearSolver, solve)
+{
+	const index_t size=32;
+
+	// symmetric positive definite system
+	SGMatrix<float64_t> m(size, size);
+	Map<MatrixXd> map_m(m.matrix, size, size);
+	MatrixXd base=MatrixXd::Random(size, size);
+	map_m=base*base.transpose()+10.0*MatrixXd::Identity(size, size);
+
+	SGVector<float64_t> b(size);
+	Map<VectorXd> map_b(b.vector, size);
+	map_b=VectorXd::Random(size);
+
+	auto A=std::make_shared<DenseMatrixOperator<float64_t>>(m);
+	auto solver=std::make_shared<MixedPrecisionDirectLinearSolver>();
+	SGVector<float64_t> x=solver->solve(A, b);
+
+	// iterative refinement must recover float64 accuracy despite the
+	// float32 factorization
+	Map<VectorXd> map_x(x.vector, x.vlen);
+	VectorXd residual=map_b-map_m*map_x;
+	EXPECT_NEAR(residual.norm()/map_b.norm(), 0.0, 1E-12);
+}
@@ -0,0 +1,64 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+
+#include <shogun/lib/config.h>
+
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/mathematics/eigen3.h>
+#include <shogun/mathematics/linalg/eigsolver/RandomizedEigenSolver.h>
+#include <shogun/mathematics/linalg/linop/DenseMatrixOperator.h>
+
+using namespace shogun;
+using namespace Eigen;
+
+TEST(RandomizedEigenSolver, compute)
+{
+	const index_t size=64;
+	const index_t num_components=5;
+
+	// symmetric PSD matrix with rapidly decaying spectrum, so the
+	// randomized range finder captures the dominant subspace accurately
+	SGMatrix<float64_t> m(size, size);
+	Map<MatrixXd> map_m(m.matrix, size, size);
+	MatrixXd base=MatrixXd::Random(size, size);
+	VectorXd weights(size);
+	for (index_t i=0; i<size; ++i)
+		weights[i]=std::pow(0.5, i);
+	HouseholderQR<MatrixXd> qr(base);
+	MatrixXd basis=qr.householderQ()*MatrixXd::Identity(size, size);
+	map_m=basis*weights.asDiagonal()*basis.transpose();
+	map_m=(map_m+map_m.transpose())/2.0;
+
+	auto A=std::make_shared<DenseMatrixOperator<float64_t>>(m);
+
+	auto eig_solver=std::make_shared<RandomizedEigenSolver>(A, num_components);
+	eig_solver->put("seed", 17);
+	eig_solver->compute();
+
+	SGVector<float64_t> eigenvalues=eig_solver->get_eigenvalues();
+	SGMatrix<float64_t> eigenvectors=eig_solver->get_eigenvectors();
+	ASSERT_EQ(eigenvalues.vlen, num_components);
+	ASSERT_EQ(eigenvectors.num_rows, size);
+	ASSERT_EQ(eigenvectors.num_cols, num_components);
+
+	SelfAdjointEigenSolver<MatrixXd> reference(map_m);
+
+	// eigenvalues are in increasing order, matching the reference tail
+	for (index_t i=0; i<num_components; ++i)
+	{
+		EXPECT_NEAR(eigenvalues[i],
+			reference.eigenvalues()[size-num_components+i], 1E-8);
+
+		// eigenvectors are determined up to sign
+		Map<VectorXd> v(eigenvectors.get_column_vector(i), size);
+		VectorXd ref_v=reference.eigenvectors().col(size-num_components+i);
+		EXPECT_NEAR(std::abs(v.dot(ref_v)), 1.0, 1E-6);
+	}
+
+	EXPECT_NEAR(eig_solver->get_max_eigenvalue(),
+		reference.eigenvalues()[size-1], 1E-8);
+}
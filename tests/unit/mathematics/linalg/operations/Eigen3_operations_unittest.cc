@@ -7,6 +7,7 @@
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
 #include <shogun/mathematics/linalg/LinalgSpecialPurposes.h>
+#include <shogun/mathematics/linalg/internal/ParallelDispatch.h>
 #include <shogun/util/zip_iterator.h>
 #include <cmath>
 
@@ -1530,6 +1531,18 @@ TYPED_TEST(LinalgBackendEigenAllTypesTest, SGVector_max)
 	EXPECT_NEAR(8, max(A), get_epsilon<TypeParam>());
 }
 
+TYPED_TEST(LinalgBackendEigenAllTypesTest, SGVector_arg_max)
+{
+	SGVector<TypeParam> A(9);
+
+	TypeParam a[] = {1, 2, 5, 8, 3, 1, 0, 2, 4};
+
+	for (index_t i = 0; i < A.size(); ++i)
+		A[i] = a[i];
+
+	EXPECT_EQ(3, arg_max(A));
+}
+
 TYPED_TEST(LinalgBackendEigenAllTypesTest, SGMatrix_max)
 {
 	const index_t nrows = 3, ncols = 3;
@@ -2543,3 +2556,126 @@ TYPED_TEST(LinalgBackendEigenNonIntegerTypesTest, SGMatrix_squared_error)
 	auto result = linalg::squared_error(A, B);
 	EXPECT_NEAR(ref, result, get_epsilon<TypeParam>());
 }
+
+TEST(LinalgBackendEigen, parallel_dispatch_large_ranges)
+{
+	/* large enough to cross the threaded dispatch threshold, so the chunked
+	 * parallel path of the elementwise and reduction kernels is exercised */
+	const index_t size = PARALLEL_DISPATCH_MIN_SIZE + 123;
+
+	SGVector<float64_t> A(size);
+	SGVector<float64_t> B(size);
+
+	for (index_t i = 0; i < size; ++i)
+	{
+		A[i] = std::sin(i * 1e-3);
+		B[i] = std::cos(i * 1e-3);
+	}
+
+	auto result = add(A, B, 1.5, -0.5);
+
+	for (index_t i = 0; i < size; ++i)
+		ASSERT_NEAR(1.5 * A[i] - 0.5 * B[i], result[i], 1e-15);
+
+	float64_t s = sum(A);
+	float64_t s_ref = 0;
+	for (index_t i = 0; i < size; ++i)
+		s_ref += A[i];
+	EXPECT_NEAR(s, s_ref, 1e-9);
+}
+
+TEST(LinalgLazy, fused_chain_matches_eager)
+{
+	const index_t size = 10;
+
+	SGVector<float64_t> a(size);
+	SGVector<float64_t> b(size);
+	SGVector<float64_t> c(size);
+
+	for (index_t i = 0; i < size; ++i)
+	{
+		a[i] = 0.1 * i;
+		b[i] = 1.0 - 0.05 * i;
+		c[i] = 0.5 * i - 1.0;
+	}
+
+	/* the lazy chain evaluates in one traversal without intermediate
+	 * containers and must match the eager per-call evaluation */
+	auto result = add(element_prod(lazy(a), lazy(b)), lazy(c), 2.0, -1.0).eval();
+	auto reference = add(element_prod(a, b), c, 2.0, -1.0);
+
+	for (index_t i = 0; i < size; ++i)
+		EXPECT_NEAR(reference[i], result[i], 1e-15);
+
+	/* unary nodes chain as well */
+	auto exp_result = exponent(element_div(lazy(a), lazy(b))).eval();
+
+	for (index_t i = 0; i < size; ++i)
+		EXPECT_NEAR(std::exp(a[i] / b[i]), exp_result[i], 1e-15);
+}
+
+TEST(LinalgLazy, matrix_expressions)
+{
+	const index_t nrows = 3, ncols = 4;
+
+	SGMatrix<float64_t> A(nrows, ncols);
+	SGMatrix<float64_t> B(nrows, ncols);
+
+	for (index_t i = 0; i < nrows * ncols; ++i)
+	{
+		A[i] = 0.25 * i;
+		B[i] = 2.0 - 0.1 * i;
+	}
+
+	SGMatrix<float64_t> result = element_prod(lazy(A), lazy(B)).eval();
+
+	EXPECT_EQ(result.num_rows, nrows);
+	EXPECT_EQ(result.num_cols, ncols);
+	for (index_t i = 0; i < nrows * ncols; ++i)
+		EXPECT_NEAR(A[i] * B[i], result[i], 1e-15);
+}
+
+TEST(LinalgBackendEigen, SGMatrix_matrix_prod_batched)
+{
+	const index_t batch_size = 7;
+
+	std::vector<SGMatrix<float64_t>> A;
+	std::vector<SGMatrix<float64_t>> B;
+
+	for (index_t i = 0; i < batch_size; ++i)
+	{
+		/* varying small shapes, as in per-node tree math */
+		const index_t m = 2 + i % 3, k = 3 + i % 2, n = 2 + i % 4;
+
+		SGMatrix<float64_t> a(m, k);
+		SGMatrix<float64_t> b(k, n);
+		for (index_t j = 0; j < m * k; ++j)
+			a[j] = 0.1 * (i + j);
+		for (index_t j = 0; j < k * n; ++j)
+			b[j] = 1.0 - 0.05 * (i + j);
+
+		A.push_back(a);
+		B.push_back(b);
+	}
+
+	auto results = matrix_prod_batched(A, B);
+
+	ASSERT_EQ(results.size(), (size_t)batch_size);
+	for (index_t i = 0; i < batch_size; ++i)
+	{
+		SGMatrix<float64_t> reference = matrix_prod(A[i], B[i]);
+		ASSERT_EQ(results[i].num_rows, reference.num_rows);
+		ASSERT_EQ(results[i].num_cols, reference.num_cols);
+		for (index_t j = 0; j < reference.num_rows * reference.num_cols; ++j)
+			EXPECT_NEAR(reference[j], results[i][j], 1e-15);
+	}
+
+	/* transposed variant goes through the same batched dispatch */
+	auto results_t = matrix_prod_batched(B, A, true, true);
+	for (index_t i = 0; i < batch_size; ++i)
+	{
+		SGMatrix<float64_t> reference = matrix_prod(B[i], A[i], true, true);
+		for (index_t j = 0; j < reference.num_rows * reference.num_cols; ++j)
+			EXPECT_NEAR(reference[j], results_t[i][j], 1e-15);
+	}
+}
@@ -0,0 +1,68 @@
+#include <shogun/lib/SGMatrix.h>
+#include <shogun/lib/SGVector.h>
+#include <shogun/multiclass/ecoc/ECOCAEDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCEDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCHDDecoder.h>
+#include <shogun/multiclass/ecoc/ECOCLLBDecoder.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace shogun;
+
+namespace
+{
+	// blocked decoding must pick the same codewords as the per-sample
+	// per-codeword distance loops it replaces
+	void check_blocked_matches_loop(const std::shared_ptr<ECOCDecoder>& decoder)
+	{
+		const int32_t code_len=12;
+		const int32_t num_classes=7;
+		const int32_t num_samples=50;
+
+		SGMatrix<int32_t> codebook(code_len, num_classes);
+		SGMatrix<float64_t> outputs(code_len, num_samples);
+
+		int32_t state=17;
+		for (int32_t i=0; i<code_len*num_classes; ++i)
+		{
+			state=(state*31+7)%101;
+			codebook.matrix[i]=state%3-1;
+		}
+		for (int32_t i=0; i<code_len*num_samples; ++i)
+		{
+			state=(state*31+7)%101;
+			outputs.matrix[i]=(state-50)/25.0;
+		}
+
+		SGVector<int32_t> blocked=decoder->decide_labels(outputs, codebook);
+		ASSERT_EQ(num_samples, blocked.vlen);
+
+		for (int32_t i=0; i<num_samples; ++i)
+		{
+			SGVector<float64_t> query(outputs.get_column_vector(i), code_len, false);
+			EXPECT_EQ(decoder->decide_label(query, codebook), blocked[i]);
+		}
+	}
+}
+
+TEST(ECOCDecoder,decide_labels_hd)
+{
+	check_blocked_matches_loop(std::make_shared<ECOCHDDecoder>());
+}
+
+TEST(ECOCDecoder,decide_labels_ed)
+{
+	check_blocked_matches_loop(std::make_shared<ECOCEDDecoder>());
+}
+
+TEST(ECOCDecoder,decide_labels_aed)
+{
+	check_blocked_matches_loop(std::make_shared<ECOCAEDDecoder>());
+}
+
+TEST(ECOCDecoder,decide_labels_llb)
+{
+	check_blocked_matches_loop(std::make_shared<ECOCLLBDecoder>());
+}
@@ -530,6 +530,67 @@ TEST(CARTree, handle_missing_continuous)
 	EXPECT_EQ(4.0,right->data.total_weight);
 }
 
+TEST(CARTree, histogram_mode_matches_exact_splits)
+{
+	// same setup as classify_non_nominal; with more bins than distinct
+	// feature values the quantile edges contain every value, so the
+	// histogram splits must reproduce the exact ones
+	SGMatrix<float64_t> data(4,14);
+
+	data(0,0)=sunny;    data(1,0)=hot;   data(2,0)=high;   data(3,0)=weak;
+	data(0,1)=sunny;    data(1,1)=hot;   data(2,1)=high;   data(3,1)=strong;
+	data(0,2)=overcast; data(1,2)=hot;   data(2,2)=high;   data(3,2)=weak;
+	data(0,3)=rain;     data(1,3)=mild;  data(2,3)=high;   data(3,3)=weak;
+	data(0,4)=rain;     data(1,4)=cool;  data(2,4)=normal; data(3,4)=weak;
+	data(0,5)=rain;     data(1,5)=cool;  data(2,5)=normal; data(3,5)=strong;
+	data(0,6)=overcast; data(1,6)=cool;  data(2,6)=normal; data(3,6)=strong;
+	data(0,7)=sunny;    data(1,7)=mild;  data(2,7)=high;   data(3,7)=weak;
+	data(0,8)=sunny;    data(1,8)=cool;  data(2,8)=normal; data(3,8)=weak;
+	data(0,9)=rain;     data(1,9)=mild;  data(2,9)=normal; data(3,9)=weak;
+	data(0,10)=sunny;   data(1,10)=mild; data(2,10)=normal;data(3,10)=strong;
+	data(0,11)=overcast;data(1,11)=mild; data(2,11)=high;  data(3,11)=strong;
+	data(0,12)=overcast;data(1,12)=hot;  data(2,12)=normal;data(3,12)=weak;
+	data(0,13)=rain;    data(1,13)=mild; data(2,13)=high;  data(3,13)=strong;
+
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(data);
+
+	SGVector<float64_t> lab(14);
+	lab[0]=0.0; lab[1]=0.0; lab[2]=1.0; lab[3]=1.0; lab[4]=1.0;
+	lab[5]=0.0; lab[6]=1.0; lab[7]=0.0; lab[8]=1.0; lab[9]=1.0;
+	lab[10]=1.0; lab[11]=1.0; lab[12]=1.0; lab[13]=0.0;
+
+	SGVector<bool> ft=SGVector<bool>(4);
+	ft[0]=false;
+	ft[1]=false;
+	ft[2]=false;
+	ft[3]=false;
+
+	auto labels=std::make_shared<MulticlassLabels>(lab);
+
+	auto c=std::make_shared<CARTree>();
+	c->set_labels(labels);
+	c->set_feature_types(ft);
+	c->set_histogram_bins(256);
+	c->train(feats);
+
+	SGMatrix<float64_t> test(4,5);
+	test(0,0)=overcast; test(1,0)=hot;  test(2,0)=normal; test(3,0)=strong;
+	test(0,1)=rain;     test(1,1)=cool; test(2,1)=high;   test(3,1)=strong;
+	test(0,2)=sunny;    test(1,2)=mild; test(2,2)=high;   test(3,2)=weak;
+	test(0,3)=rain;     test(1,3)=mild; test(2,3)=normal; test(3,3)=weak;
+	test(0,4)=sunny;    test(1,4)=hot;  test(2,4)=normal; test(3,4)=strong;
+
+	auto test_feats=std::make_shared<DenseFeatures<float64_t>>(test);
+	auto result=c->apply(test_feats)->as<MulticlassLabels>();
+	SGVector<float64_t> res_vector=result->get_labels();
+
+	EXPECT_EQ(1.0,res_vector[0]);
+	EXPECT_EQ(0.0,res_vector[1]);
+	EXPECT_EQ(0.0,res_vector[2]);
+	EXPECT_EQ(1.0,res_vector[3]);
+	EXPECT_EQ(1.0,res_vector[4]);
+}
+
 TEST(CARTree, form_t1_test)
 {
 	SGMatrix<float64_t> data(1,5);
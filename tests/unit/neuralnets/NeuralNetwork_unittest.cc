@@ -35,6 +35,8 @@
 #include <shogun/lib/SGVector.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/SparseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/labels/BinaryLabels.h>
 #include <shogun/labels/RegressionLabels.h>
 #include <shogun/labels/MulticlassLabels.h>
@@ -210,6 +212,39 @@ TEST(NeuralNetwork, backpropagation_rectified_linear)
 
 }
 
+/** Tests gradients computed using checkpointed backpropagation against
+ * gradients computed by numerical approximation. Uses a chain of
+ * NeuralLogisticLayers with checkpoints every 2 layers.
+ */
+TEST(NeuralNetwork, backpropagation_checkpointed)
+{
+	int32_t seed = 10;
+	float64_t tolerance = 1e-9;
+
+	std::vector<std::shared_ptr<NeuralLayer>> layers;
+	layers.push_back(std::make_shared<NeuralInputLayer>(5));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(6));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(5));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(6));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(5));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(4));
+	auto network = std::make_shared<NeuralNetwork>(layers);
+	network->put("seed", seed);
+
+	network->connect(0,1);
+	network->connect(1,2);
+	network->connect(2,3);
+	network->connect(3,4);
+	network->connect(4,5);
+
+	network->initialize_neural_network();
+	network->set_l1_coefficient(0.03);
+	network->set_l2_coefficient(0.01);
+	network->set_checkpoint_interval(2);
+	EXPECT_NEAR(network->check_gradients(), 0.0, tolerance);
+
+}
+
 /** Tests gradients computed using backpropagation against gradients computed
  * by numerical approximation. Uses a NeuralConvolutionalLayer-based network.
  */
@@ -298,6 +333,132 @@ TEST(NeuralNetwork, binary_classification)
 	EXPECT_NEAR(predictions->get_value(3), 0, 1e-8);
 }
 
+/** tests that single precision inference produces the same predictions as
+ * double precision inference, up to float32 accuracy
+ */
+TEST(NeuralNetwork, single_precision_inference)
+{
+	int32_t seed = 127;
+
+	SGMatrix<float64_t> inputs_matrix(2,4);
+	SGVector<float64_t> targets_vector(4);
+	inputs_matrix(0,0) = -1.0;
+	inputs_matrix(1,0) = -1.0;
+	targets_vector[0] = -1.0;
+
+	inputs_matrix(0,1) = -1.0;
+	inputs_matrix(1,1) = 1.0;
+	targets_vector[1] = 1.0;
+
+	inputs_matrix(0,2) = 1.0;
+	inputs_matrix(1,2) = -1.0;
+	targets_vector[2] = 1.0;
+
+	inputs_matrix(0,3) = 1.0;
+	inputs_matrix(1,3) = 1.0;
+	targets_vector[3] = -1.0;
+
+	auto features =
+		std::make_shared<DenseFeatures<float64_t>>(inputs_matrix);
+
+	auto labels = std::make_shared<BinaryLabels>(targets_vector);
+
+	std::vector<std::shared_ptr<NeuralLayer>> layers;
+	layers.push_back(std::make_shared<NeuralInputLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(1));
+
+	auto network = std::make_shared<NeuralNetwork>(layers);
+	network->put("seed", seed);
+	network->put("sigma", 0.1);
+
+	network->set_epsilon(1e-8);
+
+	network->set_labels(labels);
+	network->train(features);
+
+	auto predictions_double = network->apply_binary(features);
+
+	network->set_single_precision_inference(true);
+	auto predictions_single = network->apply_binary(features);
+
+	for (int32_t i=0; i<4; i++)
+	{
+		EXPECT_EQ(predictions_single->get_label(i),
+			predictions_double->get_label(i));
+		EXPECT_NEAR(predictions_single->get_value(i),
+			predictions_double->get_value(i), 1e-5);
+	}
+}
+
+/** tests that training and applying on SparseFeatures, where the first
+ * hidden layer computes its pre-activations directly from the non-zero
+ * entries, produces the same results as on the equivalent dense features
+ */
+TEST(NeuralNetwork, sparse_inputs)
+{
+	int32_t seed = 127;
+
+	SGMatrix<float64_t> inputs_matrix(2,4);
+	SGVector<float64_t> targets_vector(4);
+	inputs_matrix(0,0) = 0.0;
+	inputs_matrix(1,0) = 0.0;
+	targets_vector[0] = -1.0;
+
+	inputs_matrix(0,1) = 0.0;
+	inputs_matrix(1,1) = 1.0;
+	targets_vector[1] = 1.0;
+
+	inputs_matrix(0,2) = 1.0;
+	inputs_matrix(1,2) = 0.0;
+	targets_vector[2] = 1.0;
+
+	inputs_matrix(0,3) = 1.0;
+	inputs_matrix(1,3) = 1.0;
+	targets_vector[3] = -1.0;
+
+	auto dense_features =
+		std::make_shared<DenseFeatures<float64_t>>(inputs_matrix);
+	auto sparse_features =
+		std::make_shared<SparseFeatures<float64_t>>(inputs_matrix);
+
+	auto labels = std::make_shared<BinaryLabels>(targets_vector);
+
+	std::vector<std::shared_ptr<NeuralLayer>> layers;
+	layers.push_back(std::make_shared<NeuralInputLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(1));
+
+	auto network = std::make_shared<NeuralNetwork>(layers);
+	network->put("seed", seed);
+	network->put("sigma", 0.1);
+	network->set_epsilon(1e-8);
+	network->set_labels(labels);
+	network->train(sparse_features);
+
+	std::vector<std::shared_ptr<NeuralLayer>> layers_dense;
+	layers_dense.push_back(std::make_shared<NeuralInputLayer>(2));
+	layers_dense.push_back(std::make_shared<NeuralLogisticLayer>(2));
+	layers_dense.push_back(std::make_shared<NeuralLogisticLayer>(1));
+
+	auto network_dense = std::make_shared<NeuralNetwork>(layers_dense);
+	network_dense->put("seed", seed);
+	network_dense->put("sigma", 0.1);
+	network_dense->set_epsilon(1e-8);
+	network_dense->set_labels(labels);
+	network_dense->train(dense_features);
+
+	auto predictions = network->apply_binary(sparse_features);
+	auto predictions_dense = network_dense->apply_binary(dense_features);
+
+	for (int32_t i=0; i<4; i++)
+	{
+		EXPECT_EQ(predictions->get_label(i), predictions_dense->get_label(i));
+		EXPECT_NEAR(predictions->get_value(i),
+			predictions_dense->get_value(i), 1e-6);
+	}
+}
+
 /** tests a neural network on the multiclass XOR problem (the binary xor problem
  * in multiclass form)
  */
@@ -447,3 +608,71 @@ TEST(NeuralNetwork, gradient_descent)
 	for (int32_t i=0; i<4; i++)
 		EXPECT_EQ(predictions->get_label(i), labels->get_label(i));
 }
+
+/** tests mini-batch gradient descent training from a labelled stream on the
+ * binary XOR problem, with the data repeated to form a longer stream
+ */
+TEST(NeuralNetwork, train_on_stream)
+{
+	int32_t seed = 100;
+	int32_t num_repetitions = 1000;
+
+	SGMatrix<float64_t> xor_inputs(2,4);
+	SGVector<float64_t> xor_targets(4);
+	xor_inputs(0,0) = -1.0;
+	xor_inputs(1,0) = -1.0;
+	xor_targets[0] = 0.0;
+
+	xor_inputs(0,1) = -1.0;
+	xor_inputs(1,1) = 1.0;
+	xor_targets[1] = 1.0;
+
+	xor_inputs(0,2) = 1.0;
+	xor_inputs(1,2) = -1.0;
+	xor_targets[2] = 1.0;
+
+	xor_inputs(0,3) = 1.0;
+	xor_inputs(1,3) = 1.0;
+	xor_targets[3] = 0.0;
+
+	// a single output network uses the streamed labels directly as targets,
+	// so the labels are the 0/1 targets of the logistic output
+	SGMatrix<float64_t> inputs_matrix(2, 4*num_repetitions);
+	SGVector<float64_t> stream_labels(4*num_repetitions);
+	for (int32_t i=0; i<4*num_repetitions; i++)
+	{
+		inputs_matrix(0,i) = xor_inputs(0,i%4);
+		inputs_matrix(1,i) = xor_inputs(1,i%4);
+		stream_labels[i] = xor_targets[i%4];
+	}
+
+	auto dense_features =
+		std::make_shared<DenseFeatures<float64_t>>(inputs_matrix);
+	auto stream = std::make_shared<StreamingDenseFeatures<float64_t>>(
+		dense_features, stream_labels.vector);
+
+	std::vector<std::shared_ptr<NeuralLayer>> layers;
+	layers.push_back(std::make_shared<NeuralInputLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(2));
+	layers.push_back(std::make_shared<NeuralLogisticLayer>(1));
+
+	auto network = std::make_shared<NeuralNetwork>(layers);
+	network->put("seed", seed);
+	network->put("sigma", 0.1);
+
+	network->set_optimization_method(NNOM_GRADIENT_DESCENT);
+	network->set_gd_learning_rate(10.0);
+	network->set_gd_mini_batch_size(4);
+	network->set_epsilon(0.0);
+
+	network->train_on_stream(stream);
+
+	auto features =
+		std::make_shared<DenseFeatures<float64_t>>(xor_inputs);
+	auto predictions = network->apply_binary(features);
+
+	EXPECT_EQ(predictions->get_label(0), -1);
+	EXPECT_EQ(predictions->get_label(1), 1);
+	EXPECT_EQ(predictions->get_label(2), 1);
+	EXPECT_EQ(predictions->get_label(3), -1);
+}
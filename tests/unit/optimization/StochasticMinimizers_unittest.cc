@@ -38,6 +38,7 @@
 #include <shogun/optimization/ConstLearningRate.h>
 #include <shogun/mathematics/eigen3.h>
 #include <shogun/optimization/SVRGMinimizer.h>
+#include <shogun/optimization/HogwildSVRGMinimizer.h>
 #include <shogun/optimization/StandardMomentumCorrection.h>
 #include <shogun/optimization/AdaDeltaUpdater.h>
 #include <shogun/optimization/AdamUpdater.h>
@@ -271,6 +272,46 @@ SGVector<float64_t> ClassificationForTestCostFunction::get_gradient()
 	return result;
 }
 
+SGVector<float64_t> ParallelClassificationForTestCostFunction::get_gradient(
+	const SGVector<float64_t>& variable, index_t idx)
+{
+	SGVector<float64_t> result(variable.vlen);
+	Map<VectorXd> e_r(result.vector,result.vlen);
+
+	Map<VectorXd> e_w(variable.vector,variable.vlen);
+	Map<MatrixXd> e_x(m_features.matrix, m_features.num_rows, m_features.num_cols);
+	float64_t tmp=e_w.dot(e_x.col(idx));
+	tmp=exp(tmp*m_labels[idx]);
+	float64_t w=m_labels[idx]*tmp / (1.0+tmp);
+	e_r=w*e_x.col(idx);
+	return result;
+}
+
+void ParallelClassificationForTestCostFunction::get_gradient_batch(
+	const SGVector<float64_t>& variable, const SGVector<index_t>& indices,
+	SGMatrix<float64_t>& gradients)
+{
+	Map<VectorXd> e_w(variable.vector,variable.vlen);
+	Map<MatrixXd> e_x(m_features.matrix, m_features.num_rows, m_features.num_cols);
+
+	//gather the batch, compute all margins with one matrix-vector product
+	//and scale the gathered columns in one go
+	MatrixXd batch(m_features.num_rows, indices.vlen);
+	for (index_t i=0; i<indices.vlen; i++)
+		batch.col(i)=e_x.col(indices[i]);
+
+	VectorXd margins=batch.transpose()*e_w;
+	VectorXd scale(indices.vlen);
+	for (index_t i=0; i<indices.vlen; i++)
+	{
+		float64_t tmp=exp(margins[i]*m_labels[indices[i]]);
+		scale[i]=m_labels[indices[i]]*tmp/(1.0+tmp);
+	}
+
+	Map<MatrixXd> e_g(gradients.matrix, gradients.num_rows, gradients.num_cols);
+	e_g.leftCols(indices.vlen)=batch*scale.asDiagonal();
+}
+
 SGVector<float64_t> ClassificationForTestCostFunction::get_average_gradient()
 {
 	SGVector<float64_t> result(m_weight.vlen);
@@ -768,6 +809,63 @@ TEST(SVRGMinimizer,test2)
 	delete opt;
 }
 
+TEST(HogwildSVRGMinimizer,test1)
+{
+	ClassificationFixture data;
+	auto bb=std::make_shared<ParallelClassificationForTestCostFunction>();
+	bb->set_data(data.x, data.y);
+
+	auto opt=std::make_shared<HogwildSVRGMinimizer>(bb);
+	opt->set_penalty_weight(1.0/data.y.vlen);
+	auto penalty_type=std::make_shared<L2Penalty>();
+	opt->set_penalty_type(penalty_type);
+
+	auto rate=std::make_shared<ConstLearningRate>();
+	rate->set_const_learning_rate(0.1);
+	auto updater=std::make_shared<GradientDescendUpdater>();
+	opt->set_gradient_updater(updater);
+	opt->set_number_passes(20);
+	opt->set_learning_rate(rate);
+	opt->set_sgd_number_passes(0);
+	opt->set_average_update_interval(1);
+
+	opt->minimize();
+
+	//asynchronous lock-free updates are not bit-wise reproducible, so only
+	//check that the minimization made clear progress from the initial cost
+	//(log(2) per sample at w=0)
+	float64_t cost=bb->get_cost()/bb->get_sample_size();
+	EXPECT_LT(cost,0.45);
+}
+
+TEST(FirstOrderSAGCostFunction,get_gradient_batch)
+{
+	ClassificationFixture data;
+	auto bb=std::make_shared<ParallelClassificationForTestCostFunction>();
+	bb->set_data(data.x, data.y);
+
+	SGVector<float64_t> w(data.x.num_rows);
+	w[0]=0.5;
+	w[1]=-0.25;
+
+	SGVector<index_t> indices(4);
+	indices[0]=3;
+	indices[1]=0;
+	indices[2]=17;
+	indices[3]=9;
+
+	//the vectorized batch must match the per-sample gradients
+	SGMatrix<float64_t> gradients(w.vlen, indices.vlen);
+	bb->get_gradient_batch(w, indices, gradients);
+
+	for (index_t i=0; i<indices.vlen; i++)
+	{
+		SGVector<float64_t> grad=bb->get_gradient(w, indices[i]);
+		for (index_t k=0; k<w.vlen; k++)
+			EXPECT_NEAR(grad[k], gradients(k,i), 1e-12);
+	}
+}
+
 TEST(AdaDeltaUpdater, test1)
 {
 	ClassificationFixture data;
@@ -975,6 +1073,58 @@ TEST(L1PenaltyForTG, test2)
 	delete opt;
 }
 
+TEST(L1Penalty, lazy_sparse_update)
+{
+	SGVector<float64_t> w(3);
+	w[0]=1.0;
+	w[1]=-1.0;
+	w[2]=0.5;
+	auto penalty_type=std::make_shared<L1Penalty>();
+	penalty_type->set_rounding_epsilon(0);
+
+	SGVector<index_t> first_round(1);
+	first_round[0]=0;
+	penalty_type->update_variable_for_proximity(w, 0.1, first_round);
+
+	SGVector<index_t> second_round(2);
+	second_round[0]=0;
+	second_round[1]=1;
+	penalty_type->update_variable_for_proximity(w, 0.1, second_round);
+
+	//the dense update must catch the untouched coordinate up with the
+	//outstanding cumulative penalty of the sparse rounds
+	penalty_type->update_variable_for_proximity(w, 0.1);
+
+	EXPECT_NEAR(w[0],0.7,1e-15);
+	EXPECT_NEAR(w[1],-0.7,1e-15);
+	EXPECT_NEAR(w[2],0.2,1e-15);
+}
+
+TEST(L1PenaltyForTG, lazy_sparse_update)
+{
+	SGVector<float64_t> w(3);
+	w[0]=1.0;
+	w[1]=-1.0;
+	w[2]=0.5;
+	auto penalty_type=std::make_shared<L1PenaltyForTG>();
+	penalty_type->set_rounding_epsilon(0);
+
+	SGVector<index_t> first_round(1);
+	first_round[0]=0;
+	penalty_type->update_variable_for_proximity(w, 0.1, first_round);
+
+	SGVector<index_t> second_round(2);
+	second_round[0]=0;
+	second_round[1]=1;
+	penalty_type->update_variable_for_proximity(w, 0.1, second_round);
+
+	penalty_type->update_variable_for_proximity(w, 0.1);
+
+	EXPECT_NEAR(w[0],0.7,1e-15);
+	EXPECT_NEAR(w[1],-0.7,1e-15);
+	EXPECT_NEAR(w[2],0.2,1e-15);
+}
+
 TEST(ElasticNetPenalty, test1)
 {
 	ClassificationFixture data;
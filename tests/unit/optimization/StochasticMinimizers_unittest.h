@@ -87,6 +87,20 @@ protected:
 	void init();
 };
 
+class ParallelClassificationForTestCostFunction: public ClassificationForTestCostFunction
+{
+public:
+	ParallelClassificationForTestCostFunction()
+		:ClassificationForTestCostFunction(){};
+	virtual ~ParallelClassificationForTestCostFunction(){};
+	virtual bool supports_parallel_sampling() const { return true; }
+	virtual SGVector<float64_t> get_gradient(
+		const SGVector<float64_t>& variable, index_t idx);
+	virtual void get_gradient_batch(const SGVector<float64_t>& variable,
+		const SGVector<index_t>& indices, SGMatrix<float64_t>& gradients);
+	virtual const char* get_name() const { return "ParallelClassificationForTestCostFunction"; }
+};
+
 class ClassificationForTestCostFunction2: public ClassificationForTestCostFunction
 {
 public:
@@ -285,3 +285,40 @@ TEST(lbfgs, lbfgs_with_adjust_step_test2)
 	EXPECT_PRED_FORMAT2(::testing::DoubleLE, strict_scale, x[3]);
 	EXPECT_PRED_FORMAT2(::testing::DoubleLE, strict_scale, x[4]);
 }
+
+TEST(lbfgs, lbfgs_with_reused_workspace)
+{
+	index_t len=5;
+	SGVector<float64_t> x(len);
+	Map<VectorXd> eigen_x(x.vector, x.vlen);
+	eigen_x.fill(10);
+	lbfgs_parameter_t lbfgs_param=init_lbfgs_parameters();
+	lbfgs_workspace_t workspace;
+	float64_t opt_value=Math::INFTY;
+	lbfgs(x.vlen, x.vector, &opt_value,
+		evaluate, NULL, NULL, &lbfgs_param, NULL, &workspace);
+
+	float64_t rel_tolerance = 1e-15;
+	float64_t abs_tolerance;
+
+	abs_tolerance = Math::get_abs_tolerance(0, rel_tolerance);
+	EXPECT_NEAR(opt_value, 0, abs_tolerance);
+
+	//the buffers of the first invocation must be reused
+	const float64_t* gradient_buffer=workspace.g.vector;
+	eigen_x.fill(-10);
+	opt_value=Math::INFTY;
+	lbfgs(x.vlen, x.vector, &opt_value,
+		evaluate, NULL, NULL, &lbfgs_param, NULL, &workspace);
+
+	EXPECT_EQ(gradient_buffer, workspace.g.vector);
+
+	abs_tolerance = Math::get_abs_tolerance(0, rel_tolerance);
+	EXPECT_NEAR(opt_value, 0, abs_tolerance);
+
+	abs_tolerance = Math::get_abs_tolerance(0, rel_tolerance);
+	EXPECT_NEAR(x[0], 0, abs_tolerance);
+
+	abs_tolerance = Math::get_abs_tolerance(0, rel_tolerance);
+	EXPECT_NEAR(x[4], 0, abs_tolerance);
+}
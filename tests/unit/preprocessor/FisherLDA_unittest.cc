@@ -287,3 +287,27 @@ TEST_F(FLDATest, CANVAR_FLDA_for_D_greater_than_N )
 
 
 }
+
+TEST_F(FLDATest, refit_after_hyperparameter_change)
+{
+	// re-fitting on identical data must not reuse the cached
+	// factorization when a hyperparameter changed in between
+	FisherLDA fisherlda(1, CLASSIC_FLDA, 0.01, 0.0);
+	fisherlda.fit(dense_feat, labels);
+	SGMatrix<float64_t> before =
+	    fisherlda.get_transformation_matrix().clone();
+
+	fisherlda.put("m_gamma", 100.0);
+	fisherlda.fit(dense_feat, labels);
+	SGMatrix<float64_t> after = fisherlda.get_transformation_matrix();
+
+	ASSERT_EQ(before.num_rows, after.num_rows);
+	ASSERT_EQ(before.num_cols, after.num_cols);
+	bool changed = false;
+	for (int32_t i = 0; i < before.num_rows * before.num_cols; ++i)
+	{
+		if (std::abs(before.matrix[i] - after.matrix[i]) > 1e-12)
+			changed = true;
+	}
+	EXPECT_TRUE(changed);
+}
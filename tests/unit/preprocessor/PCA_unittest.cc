@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <shogun/mathematics/Math.h>
 #include <shogun/features/DenseFeatures.h>
+#include <shogun/features/streaming/StreamingDenseFeatures.h>
 #include <shogun/lib/SGMatrix.h>
 #include <shogun/lib/SGVector.h>
 #include <shogun/mathematics/linalg/LinalgNamespace.h>
@@ -603,3 +604,64 @@ TEST(PCA, PCA_WHITEN_EVD)
 	EXPECT_NEAR(0.0,covariance_mat(2,1),epsilon);
 	EXPECT_NEAR(1.0,covariance_mat(2,2),epsilon);
 }
+
+TEST(PCA, PCA_streaming_fit_matches_dense_fit)
+{
+	SGMatrix<float64_t> data(3,5);
+	data(0,0)=2.908008030729362;
+	data(0,1)=-1.058180257987362;
+	data(0,2)=1.098424617888623;
+	data(0,3)=-2.051816299911149;
+	data(0,4)=-1.577057022799202;
+	data(1,0)=0.825218894228491;
+	data(1,1)=-0.468615581100624;
+	data(1,2)=-0.277871932787639;
+	data(1,3)=-0.353849997774433;
+	data(1,4)=0.507974650905946;
+	data(2,0)=1.378971977916614;
+	data(2,1)=-0.272469409250187;
+	data(2,2)=0.701541458163284;
+	data(2,3)=-0.823586525156853;
+	data(2,4)=0.281984063670556;
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data.clone());
+	auto pca = std::make_shared<PCA>(EVD);
+	pca->set_target_dim(2);
+	pca->fit(features);
+
+	auto stream_source = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto stream =
+	    std::make_shared<StreamingDenseFeatures<float64_t>>(stream_source);
+	auto pca_stream = std::make_shared<PCA>(EVD);
+	pca_stream->set_target_dim(2);
+	/* force block boundaries plus a partial tail block */
+	pca_stream->put<int32_t>("block_size", 2);
+	pca_stream->fit(stream);
+
+	float64_t epsilon = 10E-8;
+
+	auto mean = pca->get_mean();
+	auto mean_stream = pca_stream->get_mean();
+	ASSERT_EQ(mean.vlen, mean_stream.vlen);
+	for (index_t i=0; i<mean.vlen; i++)
+		EXPECT_NEAR(mean[i], mean_stream[i], epsilon);
+
+	auto eigenvalues = pca->get_eigenvalues();
+	auto eigenvalues_stream = pca_stream->get_eigenvalues();
+	ASSERT_EQ(eigenvalues.vlen, eigenvalues_stream.vlen);
+	for (index_t i=0; i<eigenvalues.vlen; i++)
+		EXPECT_NEAR(eigenvalues[i], eigenvalues_stream[i], epsilon);
+
+	auto transmat = pca->get_transformation_matrix();
+	auto transmat_stream = pca_stream->get_transformation_matrix();
+	ASSERT_EQ(transmat.num_rows, transmat_stream.num_rows);
+	ASSERT_EQ(transmat.num_cols, transmat_stream.num_cols);
+	for (index_t j=0; j<transmat.num_cols; j++)
+	{
+		float64_t sign = check_eigenvector_eq(
+		    transmat.get_column(j), transmat_stream.get_column(j));
+		for (index_t i=0; i<transmat.num_rows; i++)
+			EXPECT_NEAR(
+			    transmat(i,j), sign*transmat_stream(i,j), epsilon);
+	}
+}
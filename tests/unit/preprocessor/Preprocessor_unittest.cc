@@ -33,6 +33,7 @@
 #include <shogun/features/DenseFeatures.h>
 #include <shogun/features/StringFeatures.h>
 #include <shogun/features/SparseFeatures.h>
+#include <shogun/preprocessor/LogPlusOne.h>
 #include <shogun/preprocessor/NormOne.h>
 #include <shogun/preprocessor/SortWordString.h>
 #include <shogun/lib/SGMatrix.h>
@@ -65,6 +66,62 @@ TEST(Preprocessor, dense)
 	EXPECT_EQ(preprocessed->get_feature_class(), C_DENSE);
 }
 
+TEST(Preprocessor, dense_inplace_chain_shares_buffer)
+{
+	const int32_t seed = 100;
+	const index_t dim=2;
+	const index_t size=4;
+
+	std::mt19937_64 prng(seed);
+	NormalDistribution<float64_t> normal_dist;
+	SGMatrix<float64_t> data(dim, size);
+	for (index_t i=0; i<dim*size; ++i)
+		data.matrix[i]=normal_dist(prng);
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto norm_one = std::make_shared<NormOne>();
+	norm_one->fit(features);
+	auto log_plus_one = std::make_shared<LogPlusOne>();
+	log_plus_one->fit(features);
+
+	/* chained in-place stages mutate the one original buffer and reuse
+	 * the feature object, no per-stage copies */
+	auto stage_one = norm_one->transform(features);
+	auto stage_two = log_plus_one->transform(stage_one);
+
+	EXPECT_EQ(features, stage_one);
+	EXPECT_EQ(features, stage_two);
+	EXPECT_EQ(
+	    data.matrix,
+	    stage_two->as<DenseFeatures<float64_t>>()
+	        ->get_feature_matrix()
+	        .matrix);
+}
+
+TEST(Preprocessor, dense_out_of_place_keeps_input)
+{
+	const int32_t seed = 100;
+	const index_t dim=2;
+	const index_t size=4;
+
+	std::mt19937_64 prng(seed);
+	NormalDistribution<float64_t> normal_dist;
+	SGMatrix<float64_t> data(dim, size);
+	for (index_t i=0; i<dim*size; ++i)
+		data.matrix[i]=normal_dist(prng);
+	SGMatrix<float64_t> original=data.clone();
+
+	auto features = std::make_shared<DenseFeatures<float64_t>>(data);
+	auto preproc = std::make_shared<NormOne>();
+	preproc->fit(features);
+
+	auto preprocessed = preproc->transform(features, false);
+
+	EXPECT_NE(features, preprocessed);
+	for (index_t i=0; i<dim*size; ++i)
+		EXPECT_EQ(original.matrix[i], data.matrix[i]);
+}
+
 TEST(Preprocessor, string)
 {
 	const int32_t seed = 100;
@@ -51,3 +51,38 @@ TEST(RescaleFeatures, transform)
 
 
 }
+
+TEST(RescaleFeatures, update)
+{
+	index_t num_features = 2;
+	index_t num_vectors = 2;
+	SGMatrix<float64_t> m(num_features, num_vectors);
+	m(0, 0) = 0;
+	m(1, 0) = -1;
+	m(0, 1) = 2;
+	m(1, 1) = 1;
+
+	auto feats = std::make_shared<DenseFeatures<float64_t>>(m);
+	auto rescaler = std::make_shared<RescaleFeatures>();
+	rescaler->fit(feats);
+
+	/* an example outside the fitted bounds widens them */
+	SGVector<float64_t> fresh(num_features);
+	fresh[0] = 4;
+	fresh[1] = -1;
+	rescaler->update(fresh);
+
+	SGVector<float64_t> probe(num_features);
+	probe[0] = 2;
+	probe[1] = 1;
+	SGVector<float64_t> scaled = rescaler->apply_to_feature_vector(probe);
+
+	EXPECT_DOUBLE_EQ(0.5, scaled[0]);
+	EXPECT_DOUBLE_EQ(1.0, scaled[1]);
+
+	/* examples within the current bounds leave the scaling untouched */
+	rescaler->update(probe);
+	scaled = rescaler->apply_to_feature_vector(probe);
+	EXPECT_DOUBLE_EQ(0.5, scaled[0]);
+	EXPECT_DOUBLE_EQ(1.0, scaled[1]);
+}
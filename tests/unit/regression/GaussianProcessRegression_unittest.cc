@@ -723,3 +723,69 @@ TEST(GaussianProcessRegression,fitc_regression)
 
 
 }
+
+TEST(GaussianProcessRegression,compiled_posterior_invalidation)
+{
+	/* create some easy regression data: 1d noisy sine wave */
+	index_t n=3;
+
+	SGMatrix<float64_t> X(1, n);
+	SGMatrix<float64_t> X_test(1, n);
+	SGVector<float64_t> Y(n);
+
+	X[0]=0;
+	X[1]=1.1;
+	X[2]=2.2;
+
+	X_test[0]=0.3;
+	X_test[1]=1.3;
+	X_test[2]=2.5;
+
+	for (index_t i=0; i<n; ++i)
+	{
+		Y[i] = std::sin(X(0, i));
+	}
+
+	/* shogun representation */
+	auto feat_train = std::make_shared<DenseFeatures<float64_t>>(X);
+	auto feat_test = std::make_shared<DenseFeatures<float64_t>>(X_test);
+	auto label_train = std::make_shared<RegressionLabels>(Y);
+
+	auto kernel = std::make_shared<GaussianKernel>(10, 2.0);
+	auto mean = std::make_shared<ZeroMean>();
+	auto lik = std::make_shared<GaussianLikelihood>();
+	lik->set_sigma(1);
+	auto inf = std::make_shared<ExactInferenceMethod>(kernel, feat_train,
+			mean, label_train, lik);
+
+	auto gpr = std::make_shared<GaussianProcessRegression>(inf);
+	gpr->train();
+
+	/* repeated applies must reuse the compiled posterior and return
+	 * identical predictions */
+	SGVector<float64_t> p1=
+		regression_labels(gpr->apply(feat_test))->get_labels();
+	SGVector<float64_t> p2=
+		regression_labels(gpr->apply(feat_test))->get_labels();
+	for (index_t i=0; i<n; i++)
+		EXPECT_EQ(p1[i], p2[i]);
+
+	/* changing a hyperparameter must invalidate the cache: predictions
+	 * have to match a machine trained with the new hyperparameter */
+	lik->set_sigma(0.5);
+	SGVector<float64_t> p3=
+		regression_labels(gpr->apply(feat_test))->get_labels();
+
+	auto kernel_ref = std::make_shared<GaussianKernel>(10, 2.0);
+	auto lik_ref = std::make_shared<GaussianLikelihood>();
+	lik_ref->set_sigma(0.5);
+	auto inf_ref = std::make_shared<ExactInferenceMethod>(kernel_ref,
+			feat_train, mean, label_train, lik_ref);
+	auto gpr_ref = std::make_shared<GaussianProcessRegression>(inf_ref);
+	gpr_ref->train();
+	SGVector<float64_t> p_ref=
+		regression_labels(gpr_ref->apply(feat_test))->get_labels();
+
+	for (index_t i=0; i<n; i++)
+		EXPECT_NEAR(p3[i], p_ref[i], 1e-12);
+}
@@ -0,0 +1,54 @@
+/*
+ * This software is distributed under BSD 3-clause license (see LICENSE file).
+ */
+
+#include <gtest/gtest.h>
+#include <shogun/kernel/GaussianKernel.h>
+#include <shogun/features/streaming/generators/MeanShiftDataGenerator.h>
+#include <shogun/statistical_testing/TestEnums.h>
+#include <shogun/statistical_testing/BTestMMD.h>
+
+using namespace shogun;
+
+TEST(BTestMMD, tune_blocksize)
+{
+	const int32_t seed=12345;
+	const index_t m=128;
+	const index_t n=128;
+	const index_t dim=3;
+
+	float64_t difference=0.5;
+
+	auto gen_p=std::make_shared<MeanShiftDataGenerator>(0, dim, 0);
+	auto gen_q=std::make_shared<MeanShiftDataGenerator>(difference, dim, 0);
+	gen_p->put("seed", seed);
+	gen_q->put("seed", seed);
+
+	auto features_p=gen_p->get_streamed_features(m);
+	auto features_q=gen_q->get_streamed_features(n);
+
+	float64_t sigma=2;
+	float64_t sq_sigma_twice=sigma*sigma*2;
+	auto kernel=std::make_shared<GaussianKernel>(10, sq_sigma_twice);
+
+	auto mmd=std::make_shared<BTestMMD>();
+	mmd->put("seed", seed);
+	mmd->set_p(features_p);
+	mmd->set_q(features_q);
+	mmd->set_kernel(kernel);
+	mmd->set_statistic_type(ST_UNBIASED_FULL);
+
+	const index_t min_blocksize=4;
+	const index_t max_blocksize=64;
+	index_t selected=mmd->tune_blocksize(min_blocksize, max_blocksize);
+
+	EXPECT_GE(selected, min_blocksize);
+	EXPECT_LE(selected, max_blocksize);
+	EXPECT_EQ(0, (m+n)%selected);
+
+	// the selected blocksize is set on the test and usable directly
+	float64_t statistic=mmd->compute_statistic();
+	float64_t variance=mmd->compute_variance();
+	EXPECT_TRUE(std::isfinite(statistic));
+	EXPECT_TRUE(std::isfinite(variance));
+}
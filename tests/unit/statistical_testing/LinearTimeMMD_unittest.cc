@@ -29,6 +29,9 @@
  * either expressed or implied, of the Shogun Development Team.
  */
 
+#include <algorithm>
+#include <random>
+#include <vector>
 #include <gtest/gtest.h>
 #include <shogun/kernel/GaussianKernel.h>
 #include <shogun/features/DenseFeatures.h>
@@ -441,3 +444,65 @@ TEST(LinearTimeMMD, perform_test_gaussian_unbiased_incomplete)
 	float64_t p_value_gaussian=mmd->compute_p_value(mmd->compute_statistic());
 	EXPECT_NEAR(p_value_gaussian, 0.46123518919938689, 1E-6);
 }
+
+TEST(LinearTimeMMD, sliding_window_incremental_updates)
+{
+	const int32_t seed=12345;
+	const index_t window_size=10;
+	const index_t num_pushes=15;
+	const index_t dim=3;
+
+	std::mt19937_64 prng(seed);
+	std::normal_distribution<float64_t> dist(0, 1);
+
+	float64_t sigma=2;
+	float64_t sq_sigma_twice=sigma*sigma*2;
+	auto kernel=std::make_shared<GaussianKernel>(10, sq_sigma_twice);
+
+	auto mmd=std::make_shared<LinearTimeMMD>();
+	mmd->set_kernel(kernel);
+	mmd->set_window_size(window_size);
+
+	// push more pairs than the window retains, so that evictions happen
+	std::vector<SGVector<float64_t>> samples_p, samples_q;
+	for (index_t t=0; t<num_pushes; ++t)
+	{
+		SGVector<float64_t> sample_p(dim);
+		SGVector<float64_t> sample_q(dim);
+		for (index_t i=0; i<dim; ++i)
+		{
+			sample_p[i]=dist(prng);
+			sample_q[i]=dist(prng)+0.5;
+		}
+		samples_p.push_back(sample_p);
+		samples_q.push_back(sample_q);
+		mmd->push_sample_pair(sample_p, sample_q);
+	}
+
+	// recompute the statistic from scratch over the retained window
+	const index_t start=num_pushes-window_size;
+	SGMatrix<float64_t> data(dim, 2*window_size);
+	for (index_t i=0; i<window_size; ++i)
+	{
+		std::copy(samples_p[start+i].vector, samples_p[start+i].vector+dim,
+			data.get_column_vector(i));
+		std::copy(samples_q[start+i].vector, samples_q[start+i].vector+dim,
+			data.get_column_vector(window_size+i));
+	}
+	auto features=std::make_shared<DenseFeatures<float64_t>>(data);
+	auto kernel_check=std::make_shared<GaussianKernel>(10, sq_sigma_twice);
+	kernel_check->init(features, features);
+
+	float64_t h_sum=0;
+	for (index_t i=0; i<window_size-1; ++i)
+	{
+		h_sum+=kernel_check->kernel(i, i+1)
+			+kernel_check->kernel(window_size+i, window_size+i+1)
+			-kernel_check->kernel(i, window_size+i+1)
+			-kernel_check->kernel(i+1, window_size+i);
+	}
+	float64_t expected=std::sqrt(window_size/2.0)*h_sum/(window_size-1);
+
+	EXPECT_NEAR(mmd->compute_windowed_statistic(), expected, 1E-12);
+	EXPECT_GE(mmd->compute_windowed_variance(), 0.0);
+}
@@ -545,6 +545,100 @@ TEST(QuadraticTimeMMD, precomputed_vs_nonprecomputed)
 		EXPECT_NEAR(result_1[i], result_2[i], 1E-6);
 }
 
+TEST(QuadraticTimeMMD, precomputed_vs_nonprecomputed_incomplete)
+{
+	const int32_t seed=12345;
+	const index_t m=30;
+	const index_t n=30;
+	const index_t dim=3;
+
+	float64_t difference=0.5;
+
+	auto gen_p=std::make_shared<MeanShiftDataGenerator>(0, dim, 0);
+	auto gen_q=std::make_shared<MeanShiftDataGenerator>(difference, dim, 0);
+
+	auto features_p=gen_p->get_streamed_features(m);
+	auto features_q=gen_q->get_streamed_features(n);
+
+	float64_t sigma=2;
+	float64_t sq_sigma_twice=sigma*sigma*2;
+	auto kernel=std::make_shared<GaussianKernel>(10, sq_sigma_twice);
+
+	auto mmd=std::make_shared<QuadraticTimeMMD>();
+	mmd->set_p(features_p);
+	mmd->set_q(features_q);
+	mmd->set_kernel(kernel);
+	mmd->set_statistic_type(ST_UNBIASED_INCOMPLETE);
+
+	index_t num_null_samples=10;
+	mmd->set_num_null_samples(num_null_samples);
+	mmd->set_null_approximation_method(NAM_PERMUTATION);
+
+	gen_p->put("seed", seed);
+	gen_q->put("seed", seed);
+	mmd->put("seed", seed);
+	SGVector<float64_t> result_1=mmd->sample_null();
+
+	mmd->precompute_kernel_matrix(false);
+	gen_p->put("seed", seed);
+	gen_q->put("seed", seed);
+	mmd->put("seed", seed);
+	SGVector<float64_t> result_2=mmd->sample_null();
+
+	ASSERT_EQ(result_1.size(), result_2.size());
+	for (auto i=0; i<result_1.size(); ++i)
+		EXPECT_NEAR(result_1[i], result_2[i], 1E-6);
+}
+
+TEST(QuadraticTimeMMD, precomputed_vs_nonprecomputed_tiled)
+{
+	const int32_t seed=12345;
+	// more samples than the tile edge of the streamed computation, so
+	// the statistic and the null samples cross tile boundaries
+	const index_t m=160;
+	const index_t n=160;
+	const index_t dim=3;
+
+	float64_t difference=0.5;
+
+	auto gen_p=std::make_shared<MeanShiftDataGenerator>(0, dim, 0);
+	auto gen_q=std::make_shared<MeanShiftDataGenerator>(difference, dim, 0);
+
+	auto features_p=gen_p->get_streamed_features(m);
+	auto features_q=gen_q->get_streamed_features(n);
+
+	float64_t sigma=2;
+	float64_t sq_sigma_twice=sigma*sigma*2;
+	auto kernel=std::make_shared<GaussianKernel>(10, sq_sigma_twice);
+
+	auto mmd=std::make_shared<QuadraticTimeMMD>();
+	mmd->set_p(features_p);
+	mmd->set_q(features_q);
+	mmd->set_kernel(kernel);
+
+	index_t num_null_samples=5;
+	mmd->set_num_null_samples(num_null_samples);
+	mmd->set_null_approximation_method(NAM_PERMUTATION);
+
+	gen_p->put("seed", seed);
+	gen_q->put("seed", seed);
+	mmd->put("seed", seed);
+	float64_t statistic_1=mmd->compute_statistic();
+	SGVector<float64_t> result_1=mmd->sample_null();
+
+	mmd->precompute_kernel_matrix(false);
+	gen_p->put("seed", seed);
+	gen_q->put("seed", seed);
+	mmd->put("seed", seed);
+	float64_t statistic_2=mmd->compute_statistic();
+	SGVector<float64_t> result_2=mmd->sample_null();
+
+	EXPECT_NEAR(statistic_1, statistic_2, 1E-6);
+	ASSERT_EQ(result_1.size(), result_2.size());
+	for (auto i=0; i<result_1.size(); ++i)
+		EXPECT_NEAR(result_1[i], result_2[i], 1E-6);
+}
+
 TEST(QuadraticTimeMMD, multikernel_compute_statistic)
 {
 	const int32_t seed=1;
@@ -165,6 +165,88 @@ TEST(FactorGraph, evaluate_energy_data_indep)
 
 
 
+}
+
+TEST(FactorGraph, evaluate_energy_frozen)
+{
+	// Create one simple pairwise factor type
+	SGVector<int32_t> card(2);
+	card[0] = 2;
+	card[1] = 2;
+	SGVector<float64_t> w(4);
+	w[0] = 0.0;
+	w[1] = 0.3;
+	w[2] = 0.2;
+	w[3] = 0.0;
+	int32_t tid = 0;
+	auto factortype = std::make_shared<TableFactorType>(tid, card, w);
+
+	SGVector<int32_t> card1(1);
+	card1[0] = 2;
+	SGVector<float64_t> w1(2);
+	w1[0] = 0.1;
+	w1[1] = 0.7;
+	int32_t tid1 = 1;
+	auto factortype1a = std::make_shared<TableFactorType>(tid1, card1, w1);
+
+	// Create a factor graph from the model: 2 binary variables
+	SGVector<int32_t> vc(2);
+	vc[0] = 2;
+	vc[1] = 2;
+	FactorGraph fg(vc);
+
+	// Add factors
+	SGVector<float64_t> data;
+	SGVector<int32_t> var_index(2);
+	var_index[0] = 0;
+	var_index[1] = 1;
+	auto fac1 = std::make_shared<Factor>(factortype, var_index, data);
+
+	fg.add_factor(fac1);
+
+	SGVector<int32_t> var_index1(1);
+	var_index1[0] = 1;
+	auto fac1a = std::make_shared<Factor>(factortype1a, var_index1, data);
+
+	fg.add_factor(fac1a);
+
+	EXPECT_FALSE(fg.is_frozen());
+
+	// flattened view is built by compute_energies()
+	fg.compute_energies();
+	EXPECT_TRUE(fg.is_frozen());
+
+	// flattened evaluation agrees with per-factor evaluation
+	SGVector<int32_t> state(2);
+	for (int32_t s0 = 0; s0 < 2; s0++)
+	{
+		for (int32_t s1 = 0; s1 < 2; s1++)
+		{
+			state[0] = s0;
+			state[1] = s1;
+
+			float64_t per_factor = fac1->evaluate_energy(state)
+				+ fac1a->evaluate_energy(state);
+			EXPECT_NEAR(per_factor, fg.evaluate_energy(state), 1E-10);
+		}
+	}
+
+	// adding a factor invalidates the view
+	SGVector<int32_t> var_index2(1);
+	var_index2[0] = 0;
+	auto fac1b = std::make_shared<Factor>(factortype1a, var_index2, data);
+
+	fg.add_factor(fac1b);
+	EXPECT_FALSE(fg.is_frozen());
+
+	fg.freeze();
+	EXPECT_TRUE(fg.is_frozen());
+
+	state[0] = 1;
+	state[1] = 0;
+	float64_t per_factor = fac1->evaluate_energy(state)
+		+ fac1a->evaluate_energy(state) + fac1b->evaluate_energy(state);
+	EXPECT_NEAR(per_factor, fg.evaluate_energy(state), 1E-10);
 }
 
 TEST(FactorGraph, evaluate_energy_data_dep)